@@ -62,6 +62,19 @@
 #include "xil_mmu.h"
 #endif
 
+/*
+ * Define XLWIP_CONFIG_AXIETH_DMAMEM in the compiler flags to take the BDs
+ * from the DMA descriptor memory of the BSP (xil_dmamem.h), shared with the
+ * other DMA drivers, instead of bd_space or the heap. The region is made
+ * uncached only on the ARM processors, so the option is ignored on
+ * MicroBlaze and when the region is kept cacheable.
+ */
+#if defined (XLWIP_CONFIG_AXIETH_DMAMEM) && !defined (XIL_DMAMEM_CACHEABLE) && \
+	(defined (__aarch64__) || defined (ARMR5) || defined (__arm__))
+#define AXIETH_BD_DMAMEM
+#include "xil_dmamem.h"
+#endif
+
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #ifndef XCACHE_FLUSH_DCACHE_RANGE
 #define XCACHE_FLUSH_DCACHE_RANGE(data, length)	\
@@ -75,7 +88,11 @@
 #endif
 
 /* Byte alignment of BDs */
+#ifdef AXIETH_BD_DMAMEM
+#define BD_ALIGNMENT XIL_DMAMEM_ALIGN_AXIETHERNET
+#else
 #define BD_ALIGNMENT (XAXIDMA_BD_MINIMUM_ALIGNMENT*2)
+#endif
 
 #if XPAR_INTC_0_HAS_FAST == 1
 /*********** Function Prototypes *********************************************/
@@ -97,7 +114,7 @@ xaxiemacif_s *xaxiemacif_fast;
 u32 xInsideISR = 0;
 #endif
 
-#if defined (__aarch64__) || defined (ARMR5)
+#if (defined (__aarch64__) || defined (ARMR5)) && !defined (AXIETH_BD_DMAMEM)
 u8_t bd_space[0x200000] __attribute__ ((aligned (0x200000)));
 #endif
 
@@ -651,6 +668,16 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
 #endif
 
+#ifdef AXIETH_BD_DMAMEM
+	/*
+	 * The DMA descriptor memory is uncached and shared with the other
+	 * DMA drivers, so several Axi Ethernet can be used.
+	 */
+	xaxiemacif->rx_bdspace = Xil_DmaMemAlloc(XAxiDma_BdRingMemCalc(
+				BD_ALIGNMENT, XLWIP_CONFIG_N_RX_DESC), BD_ALIGNMENT);
+	xaxiemacif->tx_bdspace = Xil_DmaMemAlloc(XAxiDma_BdRingMemCalc(
+				BD_ALIGNMENT, XLWIP_CONFIG_N_TX_DESC), BD_ALIGNMENT);
+#else
 	/* FIXME: On ZyqnMP Multiple Axi Ethernet are not supported */
 #if defined (__aarch64__) || defined (ARMR5)
 	xaxiemacif->rx_bdspace = (void *)(UINTPTR)&(bd_space[0]);;
@@ -667,6 +694,7 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 	Xil_SetTlbAttributes((UINTPTR)xaxiemacif->tx_bdspace, NORM_NONCACHE | INNER_SHAREABLE);
 	Xil_SetTlbAttributes((UINTPTR)xaxiemacif->rx_bdspace, NORM_NONCACHE | INNER_SHAREABLE);
 #endif
+#endif
 
 
 	LWIP_DEBUGF(NETIF_DEBUG, ("rx_bdspace: 0x%08x\r\n",
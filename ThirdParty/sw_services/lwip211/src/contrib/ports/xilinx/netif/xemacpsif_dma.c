@@ -42,6 +42,7 @@
 #include "xparameters_ps.h"
 #include "xil_exception.h"
 #include "xil_mmu.h"
+#include "xil_dmamem.h"
 #if defined (ARMR5)
 #include "xreg_cortexr5.h"
 #endif
@@ -58,8 +59,13 @@
 #define INTC_BASE_ADDR		XPAR_SCUGIC_0_CPU_BASEADDR
 #define INTC_DIST_BASE_ADDR	XPAR_SCUGIC_0_DIST_BASEADDR
 
+/* The BDs of the GEM are not flushed, they must be in uncached memory */
+#if defined (XIL_DMAMEM_CACHEABLE)
+#error "The GEM BDs need the DMA descriptor memory to be uncached"
+#endif
+
 /* Byte alignment of BDs */
-#define BD_ALIGNMENT (XEMACPS_DMABD_MINIMUM_ALIGNMENT*2)
+#define BD_ALIGNMENT XIL_DMAMEM_ALIGN_EMACPS
 
 /* A max of 4 different ethernet interfaces are supported */
 static UINTPTR tx_pbufs_storage[4*XLWIP_CONFIG_N_TX_DESC];
@@ -82,43 +88,16 @@ volatile u32_t notifyinfo[4*XLWIP_CONFIG_N_TX_DESC];
  * To avoid this, it is always safe to put the BD chains for Rx and tx side
  * at uncached memory location.
  *
- * The Xilinx standalone BSP for Cortex A9 implements only primary page tables.
- * Each table entry corresponds to 1 MB of address map. This means, if a memory
- * region has to be made uncached, the minimum granularity will be of 1 MB.
- *
- * The implementation below allocates a 1 MB of u8 array aligned to 1 MB.
- * This ensures that this array is put at 1 MB aligned memory (e.g. 0x1200000)
- * and accupies memory of 1 MB. The init_dma function then changes 1 MB of this
- * region to make it uncached (strongly ordered).
- * This increases the bss section of the program significantly and can be a
- * wastage of memory. The reason beings, BDs will hardly occupy few KBs of
- * memory and the rest of 1 MB of memory will be unused.
+ * The MMU of the processors maps memory in blocks of 1 MB (2 MB for 64-bit
+ * Cortex-A53/A72), so making memory uncached would require an array of that
+ * size for the few KBs used by the BDs. Instead, the BDs are allocated from
+ * the DMA descriptor memory of the standalone BSP (xil_dmamem.h). This region
+ * is made uncached once and is shared with the other drivers and libraries
+ * that need uncached memory for their DMA descriptors.
  *
- * If a program uses other peripherals that have DMAs/bus masters and need
- * uncached memory, they may also end of following the same approach. This
- * definitely aggravates the memory wastage issue. To avoid all this, the user
- * can create a new 1 MB section in the linker script and reserve it for such
- * use cases that need uncached memory location. They can then have their own
- * memory allocation logic in their application that allocates uncached memory
- * from this 1 MB location. For such a case, changes need to be done in this
- * file and appropriate uncached memory allocated through other means can be
- * used.
- *
- * The present implementation here allocates 1 MB of uncached memory. It
- * reserves of 64 KB of memory for each BD chain. 64 KB of memory means 8192 of
- * BDs for each BD chain which is more than enough for any application.
- * Assuming that both emac0 and emac1 are present, 256 KB of memory is allocated
- * for BDs. The rest 768 KB of memory is just unused.
+ * Each Rx and Tx BD chain takes the memory of the configured number of BDs.
  *********************************************************************************/
 
-#if defined __aarch64__
-u8_t bd_space[0x200000] __attribute__ ((aligned (0x200000)));
-#else
-u8_t bd_space[0x100000] __attribute__ ((aligned (0x100000)));
-#endif
-static volatile u32_t bd_space_index = 0;
-static volatile u32_t bd_space_attr_set = 0;
-
 #if !NO_SYS
 long xInsideISR = 0;
 #endif
@@ -608,7 +587,6 @@ XStatus init_dma(struct xemac_s *xemac)
 	XStatus status;
 	s32_t i;
 	u32_t bdindex;
-	volatile UINTPTR tempaddress;
 	u32_t index;
 	u32_t gigeversion;
 	XEmacPs_Bd *bdtxterminate = NULL;
@@ -620,45 +598,29 @@ XStatus init_dma(struct xemac_s *xemac)
 
 	index = get_base_index_rxpbufsstorage (xemacpsif);
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
-	/*
-	 * The BDs need to be allocated in uncached memory. Hence the 1 MB
-	 * address range allocated for Bd_Space is made uncached
-	 * by setting appropriate attributes in the translation table.
-	 * The Bd_Space is aligned to 1MB and has a size of 1 MB. This ensures
-	 * a reserved uncached area used only for BDs.
-	 */
-	if (bd_space_attr_set == 0) {
-#if defined (ARMR5)
-	Xil_SetTlbAttributes((s32_t)bd_space, STRONG_ORDERD_SHARED | PRIV_RW_USER_RW); // addr, attr
-#else
-#if defined __aarch64__
-	Xil_SetTlbAttributes((u64)bd_space, NORM_NONCACHE | INNER_SHAREABLE);
-#else
-	Xil_SetTlbAttributes((s32_t)bd_space, DEVICE_MEMORY); // addr, attr
-#endif
-#endif
-		bd_space_attr_set = 1;
-	}
-
 	rxringptr = &XEmacPs_GetRxRing(&xemacpsif->emacps);
 	txringptr = &XEmacPs_GetTxRing(&xemacpsif->emacps);
 	LWIP_DEBUGF(NETIF_DEBUG, ("rxringptr: 0x%08x\r\n", rxringptr));
 	LWIP_DEBUGF(NETIF_DEBUG, ("txringptr: 0x%08x\r\n", txringptr));
 
-	/* Allocate 64k for Rx and Tx bds each to take care of extreme cases */
-	tempaddress = (UINTPTR)&(bd_space[bd_space_index]);
-	xemacpsif->rx_bdspace = (void *)tempaddress;
-	bd_space_index += 0x10000;
-	tempaddress = (UINTPTR)&(bd_space[bd_space_index]);
-	xemacpsif->tx_bdspace = (void *)tempaddress;
-	bd_space_index += 0x10000;
+	/*
+	 * The BDs need to be allocated in uncached memory, they are taken from
+	 * the DMA descriptor memory of the BSP.
+	 */
+	xemacpsif->rx_bdspace = Xil_DmaMemAlloc(XEmacPs_BdRingMemCalc(
+				BD_ALIGNMENT, XLWIP_CONFIG_N_RX_DESC), BD_ALIGNMENT);
+	xemacpsif->tx_bdspace = Xil_DmaMemAlloc(XEmacPs_BdRingMemCalc(
+				BD_ALIGNMENT, XLWIP_CONFIG_N_TX_DESC), BD_ALIGNMENT);
 	if (gigeversion > 2) {
-		tempaddress = (UINTPTR)&(bd_space[bd_space_index]);
-		bdrxterminate = (XEmacPs_Bd *)tempaddress;
-		bd_space_index += 0x10000;
-		tempaddress = (UINTPTR)&(bd_space[bd_space_index]);
-		bdtxterminate = (XEmacPs_Bd *)tempaddress;
-		bd_space_index += 0x10000;
+		bdrxterminate = (XEmacPs_Bd *)Xil_DmaMemAlloc(
+				sizeof(XEmacPs_Bd), BD_ALIGNMENT);
+		bdtxterminate = (XEmacPs_Bd *)Xil_DmaMemAlloc(
+				sizeof(XEmacPs_Bd), BD_ALIGNMENT);
+		if (!bdrxterminate || !bdtxterminate) {
+			xil_printf("%s@%d: Error: Unable to allocate memory for TX/RX terminate buffer descriptors",
+					__FILE__, __LINE__);
+			return ERR_IF;
+		}
 	}
 
 	LWIP_DEBUGF(NETIF_DEBUG, ("rx_bdspace: %p \r\n", xemacpsif->rx_bdspace));
@@ -0,0 +1,296 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_async_test.c
+*
+* This file tests the asynchronous ZDMA copy service of xzdma_async.h on the
+* host, with the ZDMA channel replaced by the register model of dma_model.h.
+*
+* - Several copies are kept in flight, and every completion handler submits
+*   the next copy of its slot. The channel is polled with
+*   XZDma_AsyncIntrHandler() while the model runs the transfers on its own
+*   thread, so a transfer started by the service can complete while the
+*   interrupt handler is still running. A done interrupt lost by the service
+*   stops the test with a timeout.
+* - The driver is made to refuse XZDma_Start(). The request must be
+*   completed with XST_FAILURE and the channel must accept the next request.
+* - The data of every copy is checked.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "dma_model.h"
+#include "xzdma_async.h"
+
+/************************** Constant Definitions *****************************/
+#define NUM_SLOTS		4U	/* Copies in flight */
+#define COPY_SIZE		0x100U	/* Bytes per copy */
+#define NUM_COPIES		20000U	/* Copies of the stress phase */
+#define TIMEOUT_SEC		20	/* Limit of a phase */
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	XZDma_AsyncReq Req;		/* Request of the slot */
+	u8 *Src;			/* Source buffer */
+	u8 *Dst;			/* Destination buffer */
+	u32 Seq;			/* Pattern of the copy in flight */
+} Slot;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static int Setup(void);
+static int SubmitSlot(Slot *SlotPtr);
+static void SlotDone(void *CallBackRef, s32 Status);
+static void FailDone(void *CallBackRef, s32 Status);
+static int PollUntil(volatile u32 *CountPtr, u32 Target);
+
+/************************** Variable Definitions *****************************/
+static XDmaModel_Dev *ZDmaDev;
+static XZDma ZDma;
+static XZDma_Async Async;
+static Slot Slots[NUM_SLOTS];
+
+static u32 Submitted;		/* Copies submitted */
+static volatile u32 Completed;	/* Copies completed */
+static u32 DataErrors;		/* Copies with wrong data */
+static u32 StatusErrors;	/* Copies completed with an error */
+static volatile u32 FailCalls;	/* Calls of FailDone() */
+static s32 FailStatus;		/* Status given to FailDone() */
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	XZDma_AsyncChan *ChanPtr = &Async.Chan[0];
+	XZDma_AsyncReq Req;
+	u8 State;
+	u32 DscrCount;
+	u32 Index;
+	int Status;
+
+	if ((XDmaModel_Init() != XST_SUCCESS) || (Setup() != XST_SUCCESS)) {
+		printf("Setup failed\r\n");
+		return 1;
+	}
+
+	/* Phase 1: completions racing with the interrupt handler */
+	for (Index = 0U; Index < NUM_SLOTS; Index++) {
+		if (SubmitSlot(&Slots[Index]) != XST_SUCCESS) {
+			printf("Submit failed\r\n");
+			return 1;
+		}
+	}
+	Status = PollUntil(&Completed, NUM_COPIES);
+	if ((Status != XST_SUCCESS) || (DataErrors != 0U) ||
+	    (StatusErrors != 0U)) {
+		printf("Phase 1 failed, %u of %u copies, %u data errors, "
+			"%u status errors\r\n", Completed, NUM_COPIES,
+			DataErrors, StatusErrors);
+		return 1;
+	}
+	printf("Phase 1: %u copies completed\r\n", Completed);
+
+	/* Phase 2: XZDma_Start() refused by the driver */
+	State = ZDma.ChannelState;
+	DscrCount = ZDma.Descriptor.DscrCount;
+	ZDma.ChannelState = XZDMA_BUSY;
+	ZDma.Descriptor.DscrCount = 1U;
+	Status = XZDma_AsyncMemcpy(&Async, &Req, (UINTPTR)Slots[0].Dst,
+			(UINTPTR)Slots[0].Src, COPY_SIZE, FailDone, NULL);
+	ZDma.ChannelState = State;
+	ZDma.Descriptor.DscrCount = DscrCount;
+	if ((Status != XST_SUCCESS) || (FailCalls != 1U) ||
+	    (FailStatus != XST_FAILURE) || (ChanPtr->InFlight != 0U) ||
+	    (ChanPtr->Count != 0U)) {
+		printf("Phase 2 failed, %u calls, status %d, %u in flight, "
+			"%u queued\r\n", FailCalls, FailStatus,
+			ChanPtr->InFlight, ChanPtr->Count);
+		return 1;
+	}
+
+	Status = XZDma_AsyncMemcpy(&Async, &Req, (UINTPTR)Slots[0].Dst,
+			(UINTPTR)Slots[0].Src, COPY_SIZE, FailDone, NULL);
+	if (Status == XST_SUCCESS) {
+		Status = PollUntil(&FailCalls, 2U);
+	}
+	if ((Status != XST_SUCCESS) || (FailStatus != XST_SUCCESS)) {
+		printf("Phase 2 failed, the channel did not recover\r\n");
+		return 1;
+	}
+	printf("Phase 2: failed start reported, channel recovered\r\n");
+
+	XDmaModel_Shutdown();
+
+	printf("Successfully ran async test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up the ZDMA channel and the service.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int Setup(void)
+{
+	XZDma_Config Config;
+	u32 Index;
+
+	ZDmaDev = XDmaModel_ZDmaCreate();
+	if (ZDmaDev == NULL) {
+		return XST_FAILURE;
+	}
+	XDmaModel_ZDmaSetLinkedList(ZDmaDev, TRUE);
+
+	for (Index = 0U; Index < NUM_SLOTS; Index++) {
+		Slots[Index].Src = XDmaModel_Alloc(COPY_SIZE, 64U);
+		Slots[Index].Dst = XDmaModel_Alloc(COPY_SIZE, 64U);
+		if ((Slots[Index].Src == NULL) || (Slots[Index].Dst == NULL)) {
+			return XST_FAILURE;
+		}
+		Slots[Index].Seq = Index;
+	}
+
+	memset(&Config, 0, sizeof(Config));
+	Config.DmaType = 0U;
+	Config.IsCacheCoherent = 1U;
+	if (XZDma_CfgInitialize(&ZDma, &Config,
+			(u32)(UINTPTR)ZDmaDev->Regs) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XZDma_AsyncInitialize(&Async);
+
+	return XZDma_AsyncAddChannel(&Async, &ZDma,
+			(UINTPTR)XDmaModel_Alloc(XZDMA_ASYNC_DSCR_MEM_SIZE, 64U));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the source of a slot with its next pattern and submits
+* the copy.
+*
+* @param	SlotPtr is the slot.
+*
+* @return	Status of XZDma_AsyncMemcpy().
+*
+******************************************************************************/
+static int SubmitSlot(Slot *SlotPtr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < COPY_SIZE; Index++) {
+		SlotPtr->Src[Index] = (u8)(SlotPtr->Seq + Index);
+	}
+	Submitted++;
+
+	return XZDma_AsyncMemcpy(&Async, &SlotPtr->Req,
+			(UINTPTR)SlotPtr->Dst, (UINTPTR)SlotPtr->Src, COPY_SIZE,
+			SlotDone, SlotPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* Completion handler of the slots, checks the data and submits the next copy
+* of the slot.
+*
+* @param	CallBackRef is the slot.
+* @param	Status is the status of the request.
+*
+* @return	None.
+*
+******************************************************************************/
+static void SlotDone(void *CallBackRef, s32 Status)
+{
+	Slot *SlotPtr = (Slot *)CallBackRef;
+	u32 Index;
+
+	if (Status != XST_SUCCESS) {
+		StatusErrors++;
+	}
+	for (Index = 0U; Index < COPY_SIZE; Index++) {
+		if (SlotPtr->Dst[Index] != (u8)(SlotPtr->Seq + Index)) {
+			DataErrors++;
+			break;
+		}
+	}
+	Completed++;
+
+	if (Submitted < NUM_COPIES) {
+		SlotPtr->Seq += NUM_SLOTS;
+		if (SubmitSlot(SlotPtr) != XST_SUCCESS) {
+			StatusErrors++;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Completion handler of the requests of phase 2.
+*
+* @param	CallBackRef is not used.
+* @param	Status is the status of the request.
+*
+* @return	None.
+*
+******************************************************************************/
+static void FailDone(void *CallBackRef, s32 Status)
+{
+	(void)CallBackRef;
+
+	FailStatus = Status;
+	FailCalls++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function polls the channel until a counter reaches a value.
+*
+* @param	CountPtr is the counter.
+* @param	Target is the value.
+*
+* @return	XST_SUCCESS if the value is reached, XST_FAILURE on timeout.
+*
+******************************************************************************/
+static int PollUntil(volatile u32 *CountPtr, u32 Target)
+{
+	time_t Start = time(NULL);
+
+	while (*CountPtr < Target) {
+		if ((time(NULL) - Start) > TIMEOUT_SEC) {
+			return XST_FAILURE;
+		}
+		XZDma_AsyncIntrHandler(&ZDma);
+	}
+
+	return XST_SUCCESS;
+}
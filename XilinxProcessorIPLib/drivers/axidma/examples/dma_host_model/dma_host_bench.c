@@ -0,0 +1,1068 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_host_bench.c
+*
+* This file measures, on the host, the processor time spent in the AXI DMA,
+* AXI MCDMA and ZDMA drivers, with the cores replaced by the register model
+* of dma_model.h. The drivers are built unmodified.
+*
+* - AXI DMA: the submission patterns of xaxidma_example_sg_bench.c, BatchSize
+*   single packet BDs per XAxiDma_BdRingToHw() call on both channels, retired
+*   with XAxiDma_BdRingFromHw() and XAxiDma_BdRingFree().
+* - AXI MCDMA: BatchSize packets on each channel, submitted with
+*   XMcDma_ChanSubmit() and XMcDma_ChanToHw() per channel and retired with
+*   XMcdma_BdChainFromHW() per channel, compared with XMcDma_BatchSubmit()
+*   and XMcdma_BatchFromHw() for all the channels at once.
+* - ZDMA: copies done one at a time in simple mode, compared with batches of
+*   copies in scatter gather mode, with the completion reported by
+*   XZDma_IntrHandler() from the model interrupt.
+*
+* Only the time spent in the driver calls is accounted, the time spent
+* waiting for the model is not. The received data is checked after every
+* batch. The model runs the cores on a separate thread, so the absolute
+* numbers include the cost of the cache line transfers between the threads
+* and are only meant to compare the submission patterns with each other.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "dma_model.h"
+#include "xaxidma.h"
+#include "xmcdma.h"
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+#define MAX_PKT_LEN		0x400U	/* Packet length */
+#define NUMBER_OF_BATCHES	256U	/* Batches for every pattern */
+#define NUMBER_OF_PATTERNS	4U
+#define MAX_BATCH_SIZE		32U	/* Packets per batch and channel */
+#define BD_SPACE_SIZE		0x1000U	/* BD space of a channel */
+
+#define MCDMA_CHANNELS		4U	/* Channels in each direction */
+#define MCDMA_BD_COUNT		64U	/* BDs of a channel */
+
+#define ZDMA_COPIES		256U	/* Copies for every size */
+#define ZDMA_BATCH		8U	/* Copies per scatter gather start */
+#define ZDMA_NUM_SIZES		3U
+#define ZDMA_MAX_SIZE		0x10000U
+#define ZDMA_DSCR_MEM_SIZE	(ZDMA_BATCH * 2U * sizeof(XZDma_LlDscr))
+
+/**************************** Type Definitions *******************************/
+/*
+ * Driver time accounted for a submission pattern
+ */
+typedef struct {
+	u64 SubmitNs;		/* Time in the submit calls */
+	u64 RetireNs;		/* Time in the retire calls */
+	u32 NumPkts;		/* Packets transferred */
+} BenchResult;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u64 NowNs(void);
+static void FillBuffer(u8 *BufPtr, u32 Len, u32 Seed);
+static int CheckBuffer(const u8 *BufPtr, u32 Len, u32 Seed);
+static void PrintResult(const char *Name, u32 BatchSize,
+		const BenchResult *Result, u32 PktLen);
+
+static int AxiDmaBench(void);
+static int AxiDmaRingSetup(XAxiDma_BdRing *RingPtr);
+static int AxiDmaSubmit(XAxiDma_BdRing *RingPtr, u8 *BufPtr, u32 BatchSize,
+		u32 Ctrl);
+static int AxiDmaRetire(XAxiDma_BdRing *RingPtr, u32 BatchSize,
+		u64 *RetireNs);
+static int AxiDmaPattern(u32 BatchSize, BenchResult *Result);
+
+static int McDmaBench(void);
+static int McDmaPattern(u32 BatchSize, u32 UseBatch, BenchResult *Result);
+static int McDmaSubmitChan(u32 BatchSize);
+static int McDmaSubmitBatch(u32 BatchSize);
+static int McDmaRetireChan(u32 BatchSize, u64 *RetireNs);
+static int McDmaRetireBatch(u32 BatchSize, u64 *RetireNs);
+
+static int ZDmaBench(void);
+static int ZDmaPattern(u32 Size, u32 UseSg, BenchResult *Result);
+static void ZDmaDone(void *CallBackRef);
+static void ZDmaIrq(void *CallBackRef);
+
+/************************** Variable Definitions *****************************/
+static const u32 BatchSizes[NUMBER_OF_PATTERNS] = {1U, 4U, 16U,
+						   MAX_BATCH_SIZE};
+static const u32 ZDmaSizes[ZDMA_NUM_SIZES] = {0x100U, 0x1000U, ZDMA_MAX_SIZE};
+
+static XAxiDma AxiDma;
+static u8 *AxiDmaTxBuf;
+static u8 *AxiDmaRxBuf;
+
+static XMcdma McDma;
+static u8 *McDmaTxBuf;
+static u8 *McDmaRxBuf;
+
+static XZDma ZDma;
+static XDmaModel_Dev *ZDmaDev;
+static u8 *ZDmaSrcBuf;
+static u8 *ZDmaDstBuf;
+static volatile u32 ZDmaDoneCount;
+static u64 ZDmaIrqNs;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function starts the model and runs the benchmarks of the three
+* drivers.
+*
+* @return	0 if all the transfers completed with the right data, 1
+*		otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	if (XDmaModel_Init() != XST_SUCCESS) {
+		return 1;
+	}
+
+	Status = AxiDmaBench();
+	if (Status == XST_SUCCESS) {
+		Status = McDmaBench();
+	}
+	if (Status == XST_SUCCESS) {
+		Status = ZDmaBench();
+	}
+
+	XDmaModel_Shutdown();
+
+	if (Status != XST_SUCCESS) {
+		printf("DMA host benchmark failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran DMA host benchmark\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the monotonic time.
+*
+* @return	Time in nanoseconds.
+*
+******************************************************************************/
+static u64 NowNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a buffer with a pattern.
+*
+* @param	BufPtr is the buffer.
+* @param	Len is the length in bytes.
+* @param	Seed selects the pattern.
+*
+* @return	None.
+*
+******************************************************************************/
+static void FillBuffer(u8 *BufPtr, u32 Len, u32 Seed)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		BufPtr[Index] = (u8)((Seed * 7U) + Index);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks a buffer filled by FillBuffer().
+*
+* @param	BufPtr is the buffer.
+* @param	Len is the length in bytes.
+* @param	Seed is the pattern.
+*
+* @return	XST_SUCCESS if the data is right, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int CheckBuffer(const u8 *BufPtr, u32 Len, u32 Seed)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		if (BufPtr[Index] != (u8)((Seed * 7U) + Index)) {
+			printf("Data mismatch at %u, seed %u\r\n", Index, Seed);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the driver time accounted for a pattern.
+*
+* @param	Name is the name of the pattern.
+* @param	BatchSize is the number of packets per submit.
+* @param	Result is the accounted driver time.
+* @param	PktLen is the length of a packet.
+*
+* @return	None.
+*
+******************************************************************************/
+static void PrintResult(const char *Name, u32 BatchSize,
+		const BenchResult *Result, u32 PktLen)
+{
+	u64 Bytes = (u64)Result->NumPkts * PktLen;
+
+	printf("%-10s %8u  %12llu  %12llu  %12llu\r\n", Name, BatchSize,
+		(unsigned long long)(Result->SubmitNs / Result->NumPkts),
+		(unsigned long long)(Result->RetireNs / Result->NumPkts),
+		(unsigned long long)(((Result->SubmitNs + Result->RetireNs) *
+			0x100000U) / (Bytes * 1000U)));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the AXI DMA submission patterns.
+*
+* @return	XST_SUCCESS if all the packets are received with the right
+*		data, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int AxiDmaBench(void)
+{
+	XDmaModel_Dev *DevPtr;
+	XAxiDma_Config Config;
+	BenchResult Result;
+	u32 Index;
+	int Status;
+
+	DevPtr = XDmaModel_AxiDmaCreate();
+	AxiDmaTxBuf = XDmaModel_Alloc(MAX_PKT_LEN * MAX_BATCH_SIZE, 64U);
+	AxiDmaRxBuf = XDmaModel_Alloc(MAX_PKT_LEN * MAX_BATCH_SIZE, 64U);
+	if ((DevPtr == NULL) || (AxiDmaTxBuf == NULL) ||
+	    (AxiDmaRxBuf == NULL)) {
+		return XST_FAILURE;
+	}
+
+	memset(&Config, 0, sizeof(Config));
+	Config.BaseAddr = (UINTPTR)DevPtr->Regs;
+	Config.HasMm2S = 1;
+	Config.Mm2SDataWidth = 32;
+	Config.Mm2SBurstSize = 16;
+	Config.HasS2Mm = 1;
+	Config.S2MmDataWidth = 32;
+	Config.S2MmBurstSize = 16;
+	Config.HasSg = 1;
+	Config.Mm2sNumChannels = 1;
+	Config.S2MmNumChannels = 1;
+	Config.AddrWidth = 32;
+	Config.SgLengthWidth = 23;
+
+	Status = XAxiDma_CfgInitialize(&AxiDma, &Config);
+	if (Status != XST_SUCCESS) {
+		printf("AXI DMA initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = AxiDmaRingSetup(XAxiDma_GetTxRing(&AxiDma));
+	if (Status == XST_SUCCESS) {
+		Status = AxiDmaRingSetup(XAxiDma_GetRxRing(&AxiDma));
+	}
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	printf("\r\nAXI DMA, packet length %u bytes, %u batches\r\n",
+		MAX_PKT_LEN, NUMBER_OF_BATCHES);
+	printf("Pattern    Pkts/call  Submit ns/pkt  Retire ns/pkt  "
+		"Driver us/MB\r\n");
+	for (Index = 0U; Index < NUMBER_OF_PATTERNS; Index++) {
+		Status = AxiDmaPattern(BatchSizes[Index], &Result);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		PrintResult("ToHw", BatchSizes[Index], &Result, MAX_PKT_LEN);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the BD ring of an AXI DMA channel and starts it.
+*
+* @param	RingPtr is the BD ring of the channel.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int AxiDmaRingSetup(XAxiDma_BdRing *RingPtr)
+{
+	XAxiDma_Bd BdTemplate;
+	UINTPTR BdSpace;
+	u32 BdCount;
+	int Status;
+
+	BdSpace = (UINTPTR)XDmaModel_Alloc(BD_SPACE_SIZE,
+			XAXIDMA_BD_MINIMUM_ALIGNMENT);
+	if (BdSpace == 0U) {
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdRingIntDisable(RingPtr, XAXIDMA_IRQ_ALL_MASK);
+	XAxiDma_BdRingSetCoalesce(RingPtr, 1, 0);
+
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+			BD_SPACE_SIZE);
+	Status = XAxiDma_BdRingCreate(RingPtr, BdSpace, BdSpace,
+			XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		printf("Create BD ring failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RingPtr, &BdTemplate);
+	if (Status == XST_SUCCESS) {
+		Status = XAxiDma_BdRingStart(RingPtr);
+	}
+	if (Status != XST_SUCCESS) {
+		printf("Start BD ring failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits a batch of single packet BDs to an AXI DMA channel.
+*
+* @param	RingPtr is the BD ring of the channel.
+* @param	BufPtr is the buffer of the first packet.
+* @param	BatchSize is the number of BDs.
+* @param	Ctrl is the control word of every BD.
+*
+* @return	XST_SUCCESS if the BDs are submitted, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int AxiDmaSubmit(XAxiDma_BdRing *RingPtr, u8 *BufPtr, u32 BatchSize,
+		u32 Ctrl)
+{
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	UINTPTR BufAddr = (UINTPTR)BufPtr;
+	u32 Index;
+	int Status;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, BatchSize, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0U; Index < BatchSize; Index++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, BufAddr);
+		if (Status == XST_SUCCESS) {
+			Status = XAxiDma_BdSetLength(BdCurPtr, MAX_PKT_LEN,
+					RingPtr->MaxTransferLen);
+		}
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		XAxiDma_BdSetCtrl(BdCurPtr, Ctrl);
+		XAxiDma_BdSetId(BdCurPtr, BufAddr);
+
+		BufAddr += MAX_PKT_LEN;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	return XAxiDma_BdRingToHw(RingPtr, BatchSize, BdPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires a batch of BDs from an AXI DMA channel. Polls which
+* do not return any BD are not accounted in the retire time.
+*
+* @param	RingPtr is the BD ring of the channel.
+* @param	BatchSize is the number of BDs to be retired.
+* @param	RetireNs is incremented by the driver time to retire the BDs.
+*
+* @return	XST_SUCCESS if the BDs are retired, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int AxiDmaRetire(XAxiDma_BdRing *RingPtr, u32 BatchSize,
+		u64 *RetireNs)
+{
+	XAxiDma_Bd *BdPtr;
+	int ProcessedBdCount;
+	int Status;
+	u64 Start;
+
+	while (BatchSize > 0U) {
+		Start = NowNs();
+		ProcessedBdCount = XAxiDma_BdRingFromHw(RingPtr,
+				XAXIDMA_ALL_BDS, &BdPtr);
+		if (ProcessedBdCount == 0) {
+			continue;
+		}
+
+		Status = XAxiDma_BdRingFree(RingPtr, ProcessedBdCount, BdPtr);
+		*RetireNs += NowNs() - Start;
+		if (Status != XST_SUCCESS) {
+			printf("Failed to free %d BDs %d\r\n",
+				ProcessedBdCount, Status);
+			return XST_FAILURE;
+		}
+		BatchSize -= (u32)ProcessedBdCount;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs one AXI DMA submission pattern.
+*
+* @param	BatchSize is the number of BDs submitted per ToHw call.
+* @param	Result is updated with the accounted driver time.
+*
+* @return	XST_SUCCESS if all the batches are transferred with the right
+*		data, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int AxiDmaPattern(u32 BatchSize, BenchResult *Result)
+{
+	XAxiDma_BdRing *TxRingPtr = XAxiDma_GetTxRing(&AxiDma);
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(&AxiDma);
+	u64 Start;
+	u32 Batch;
+	u32 Index;
+	int Status;
+
+	memset(Result, 0, sizeof(*Result));
+
+	for (Batch = 0U; Batch < NUMBER_OF_BATCHES; Batch++) {
+		for (Index = 0U; Index < BatchSize; Index++) {
+			FillBuffer(AxiDmaTxBuf + (Index * MAX_PKT_LEN),
+				MAX_PKT_LEN, Batch + Index);
+		}
+		memset(AxiDmaRxBuf, 0, MAX_PKT_LEN * BatchSize);
+
+		Start = NowNs();
+		Status = AxiDmaSubmit(RxRingPtr, AxiDmaRxBuf, BatchSize, 0U);
+		if (Status == XST_SUCCESS) {
+			Status = AxiDmaSubmit(TxRingPtr, AxiDmaTxBuf,
+					BatchSize, XAXIDMA_BD_CTRL_TXEOF_MASK |
+					XAXIDMA_BD_CTRL_TXSOF_MASK);
+		}
+		Result->SubmitNs += NowNs() - Start;
+		if (Status != XST_SUCCESS) {
+			printf("Submit of %u BDs failed\r\n", BatchSize);
+			return XST_FAILURE;
+		}
+
+		Status = AxiDmaRetire(TxRingPtr, BatchSize, &Result->RetireNs);
+		if (Status == XST_SUCCESS) {
+			Status = AxiDmaRetire(RxRingPtr, BatchSize,
+					&Result->RetireNs);
+		}
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		for (Index = 0U; Index < BatchSize; Index++) {
+			if (CheckBuffer(AxiDmaRxBuf + (Index * MAX_PKT_LEN),
+				MAX_PKT_LEN, Batch + Index) != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+		Result->NumPkts += BatchSize;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the AXI MCDMA submission patterns.
+*
+* @return	XST_SUCCESS if all the packets are received with the right
+*		data, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int McDmaBench(void)
+{
+	XDmaModel_Dev *DevPtr;
+	XMcdma_Config Config;
+	XMcdma_ChanCtrl *ChanPtr;
+	BenchResult Result;
+	u32 Index;
+	u32 ChanId;
+	int Status;
+
+	DevPtr = XDmaModel_McDmaCreate(MCDMA_CHANNELS);
+	McDmaTxBuf = XDmaModel_Alloc(MAX_PKT_LEN * MAX_BATCH_SIZE *
+			MCDMA_CHANNELS, 64U);
+	McDmaRxBuf = XDmaModel_Alloc(MAX_PKT_LEN * MAX_BATCH_SIZE *
+			MCDMA_CHANNELS, 64U);
+	if ((DevPtr == NULL) || (McDmaTxBuf == NULL) || (McDmaRxBuf == NULL)) {
+		return XST_FAILURE;
+	}
+
+	memset(&Config, 0, sizeof(Config));
+	Config.BaseAddress = (UINTPTR)DevPtr->Regs;
+	Config.AddrWidth = 32;
+	Config.HasMM2S = 1;
+	Config.TxNumChannels = (int)MCDMA_CHANNELS;
+	Config.HasS2MM = 1;
+	Config.RxNumChannels = (int)MCDMA_CHANNELS;
+	Config.MM2SDataWidth = 32;
+	Config.S2MMDataWidth = 32;
+	Config.MaxTransferlen = 16U;
+	Config.HasRxLength = 1;
+
+	Status = XMcDma_CfgInitialize(&McDma, &Config);
+	if (Status != XST_SUCCESS) {
+		printf("MCDMA initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	for (ChanId = 1U; ChanId <= MCDMA_CHANNELS; ChanId++) {
+		ChanPtr = XMcdma_GetMcdmaTxChan(&McDma, ChanId);
+		XMcdma_IntrDisable(ChanPtr, XMCDMA_IRQ_ALL_MASK);
+		Status = XMcDma_ChanBdCreatePool(ChanPtr, MCDMA_BD_COUNT);
+		if (Status == XST_SUCCESS) {
+			ChanPtr = XMcdma_GetMcdmaRxChan(&McDma, ChanId);
+			XMcdma_IntrDisable(ChanPtr, XMCDMA_IRQ_ALL_MASK);
+			Status = XMcDma_ChanBdCreatePool(ChanPtr,
+					MCDMA_BD_COUNT);
+		}
+		if (Status != XST_SUCCESS) {
+			printf("MCDMA BD pool creation failed %d\r\n", Status);
+			return XST_FAILURE;
+		}
+	}
+
+	printf("\r\nMCDMA, %u channels, packet length %u bytes, %u batches\r\n",
+		MCDMA_CHANNELS, MAX_PKT_LEN, NUMBER_OF_BATCHES);
+	printf("Pattern    Pkts/chan  Submit ns/pkt  Retire ns/pkt  "
+		"Driver us/MB\r\n");
+	for (Index = 0U; Index < NUMBER_OF_PATTERNS; Index++) {
+		Status = McDmaPattern(BatchSizes[Index], FALSE, &Result);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		PrintResult("PerChan", BatchSizes[Index], &Result,
+			MAX_PKT_LEN);
+
+		Status = McDmaPattern(BatchSizes[Index], TRUE, &Result);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		PrintResult("Batch", BatchSizes[Index], &Result, MAX_PKT_LEN);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits BatchSize packets on every MCDMA channel, one
+* channel at a time.
+*
+* @param	BatchSize is the number of packets per channel.
+*
+* @return	XST_SUCCESS if the packets are submitted, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int McDmaSubmitChan(u32 BatchSize)
+{
+	XMcdma_ChanCtrl *ChanPtr;
+	UINTPTR BufAddr;
+	u32 ChanId;
+	u32 Index;
+	u32 Status;
+
+	for (ChanId = 1U; ChanId <= MCDMA_CHANNELS; ChanId++) {
+		ChanPtr = XMcdma_GetMcdmaRxChan(&McDma, ChanId);
+		BufAddr = (UINTPTR)McDmaRxBuf +
+			((ChanId - 1U) * MAX_BATCH_SIZE * MAX_PKT_LEN);
+		for (Index = 0U; Index < BatchSize; Index++) {
+			Status = XMcDma_ChanSubmit(ChanPtr, BufAddr,
+					MAX_PKT_LEN);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			BufAddr += MAX_PKT_LEN;
+		}
+		if (XMcDma_ChanToHw(ChanPtr) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	for (ChanId = 1U; ChanId <= MCDMA_CHANNELS; ChanId++) {
+		ChanPtr = XMcdma_GetMcdmaTxChan(&McDma, ChanId);
+		BufAddr = (UINTPTR)McDmaTxBuf +
+			((ChanId - 1U) * MAX_BATCH_SIZE * MAX_PKT_LEN);
+		for (Index = 0U; Index < BatchSize; Index++) {
+			Status = XMcDma_ChanSubmit(ChanPtr, BufAddr,
+					MAX_PKT_LEN);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			XMcDma_BdSetCtrl(ChanPtr->BdTail,
+				XMCDMA_BD_CTRL_SOF_MASK |
+				XMCDMA_BD_CTRL_EOF_MASK);
+			BufAddr += MAX_PKT_LEN;
+		}
+		if (XMcDma_ChanToHw(ChanPtr) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function submits BatchSize packets on every MCDMA channel with one
+* XMcDma_BatchSubmit() call per direction.
+*
+* @param	BatchSize is the number of packets per channel.
+*
+* @return	XST_SUCCESS if the packets are submitted, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int McDmaSubmitBatch(u32 BatchSize)
+{
+	static XMcdma_BatchDesc Desc[MAX_BATCH_SIZE * MCDMA_CHANNELS];
+	u32 Num = 0U;
+	u32 ChanId;
+	u32 Index;
+	u32 Offset;
+
+	for (Index = 0U; Index < BatchSize; Index++) {
+		for (ChanId = 1U; ChanId <= MCDMA_CHANNELS; ChanId++) {
+			Offset = (((ChanId - 1U) * MAX_BATCH_SIZE) + Index) *
+				MAX_PKT_LEN;
+			Desc[Num].ChanId = ChanId;
+			Desc[Num].BufAddr = (UINTPTR)McDmaRxBuf + Offset;
+			Desc[Num].Len = MAX_PKT_LEN;
+			Desc[Num].AppPtr = NULL;
+			Num++;
+		}
+	}
+	if (XMcDma_BatchSubmit(&McDma, XMCDMA_DEV_TO_MEM, Desc, Num) !=
+	    XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < Num; Index++) {
+		Desc[Index].BufAddr += (UINTPTR)McDmaTxBuf -
+				(UINTPTR)McDmaRxBuf;
+	}
+
+	return (int)XMcDma_BatchSubmit(&McDma, XMCDMA_MEM_TO_DEV, Desc, Num);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires BatchSize packets on every MCDMA channel, one channel
+* at a time. Polls which do not return any BD are not accounted.
+*
+* @param	BatchSize is the number of packets per channel.
+* @param	RetireNs is incremented by the driver time to retire the BDs.
+*
+* @return	XST_SUCCESS if the packets are retired, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int McDmaRetireChan(u32 BatchSize, u64 *RetireNs)
+{
+	XMcdma_ChanCtrl *ChanPtr;
+	XMcdma_Bd *BdPtr;
+	u32 Left[2U][MCDMA_CHANNELS];
+	u32 Pending = 2U * MCDMA_CHANNELS * BatchSize;
+	u32 ChanId;
+	u32 Dir;
+	int Count;
+	int Status;
+	u64 Start;
+
+	for (ChanId = 0U; ChanId < MCDMA_CHANNELS; ChanId++) {
+		Left[0U][ChanId] = BatchSize;
+		Left[1U][ChanId] = BatchSize;
+	}
+
+	while (Pending > 0U) {
+		for (Dir = 0U; Dir < 2U; Dir++) {
+			for (ChanId = 1U; ChanId <= MCDMA_CHANNELS; ChanId++) {
+				if (Left[Dir][ChanId - 1U] == 0U) {
+					continue;
+				}
+				ChanPtr = (Dir == 0U) ?
+					XMcdma_GetMcdmaTxChan(&McDma, ChanId) :
+					XMcdma_GetMcdmaRxChan(&McDma, ChanId);
+				Start = NowNs();
+				Count = XMcdma_BdChainFromHW(ChanPtr,
+						MCDMA_BD_COUNT, &BdPtr);
+				if (Count <= 0) {
+					continue;
+				}
+				Status = XMcdma_BdChainFree(ChanPtr, Count,
+						BdPtr);
+				*RetireNs += NowNs() - Start;
+				if (Status != XST_SUCCESS) {
+					return XST_FAILURE;
+				}
+				Left[Dir][ChanId - 1U] -= (u32)Count;
+				Pending -= (u32)Count;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires BatchSize packets on every MCDMA channel with
+* XMcdma_BatchFromHw() and XMcdma_BatchFree(). Polls which do not return any
+* BD are not accounted.
+*
+* @param	BatchSize is the number of packets per channel.
+* @param	RetireNs is incremented by the driver time to retire the BDs.
+*
+* @return	XST_SUCCESS if the packets are retired, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int McDmaRetireBatch(u32 BatchSize, u64 *RetireNs)
+{
+	XMcdma_BatchChain Chains[MCDMA_CHANNELS];
+	u32 Pending[2U];
+	u64 Start;
+	int Status;
+	u32 Direction;
+	u32 NumChains;
+	u32 Index;
+	u32 Dir;
+
+	Pending[0U] = MCDMA_CHANNELS * BatchSize;
+	Pending[1U] = MCDMA_CHANNELS * BatchSize;
+
+	while ((Pending[0U] + Pending[1U]) > 0U) {
+		for (Dir = 0U; Dir < 2U; Dir++) {
+			if (Pending[Dir] == 0U) {
+				continue;
+			}
+			Direction = (Dir == 0U) ? XMCDMA_MEM_TO_DEV :
+					XMCDMA_DEV_TO_MEM;
+			Start = NowNs();
+			NumChains = XMcdma_BatchFromHw(&McDma, Direction,
+					MCDMA_BD_COUNT, Chains, MCDMA_CHANNELS);
+			if (NumChains == 0U) {
+				continue;
+			}
+			Status = XMcdma_BatchFree(&McDma, Direction, Chains,
+					NumChains);
+			*RetireNs += NowNs() - Start;
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			for (Index = 0U; Index < NumChains; Index++) {
+				Pending[Dir] -= (u32)Chains[Index].BdCount;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs one AXI MCDMA submission pattern.
+*
+* @param	BatchSize is the number of packets per channel and batch.
+* @param	UseBatch selects the batch functions of the driver.
+* @param	Result is updated with the accounted driver time.
+*
+* @return	XST_SUCCESS if all the batches are transferred with the right
+*		data, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int McDmaPattern(u32 BatchSize, u32 UseBatch, BenchResult *Result)
+{
+	u32 Total = MCDMA_CHANNELS * MAX_BATCH_SIZE;
+	u64 Start;
+	u32 Batch;
+	u32 Index;
+	int Status;
+
+	memset(Result, 0, sizeof(*Result));
+
+	for (Batch = 0U; Batch < NUMBER_OF_BATCHES; Batch++) {
+		for (Index = 0U; Index < Total; Index++) {
+			FillBuffer(McDmaTxBuf + (Index * MAX_PKT_LEN),
+				MAX_PKT_LEN, Batch + Index);
+		}
+		memset(McDmaRxBuf, 0, MAX_PKT_LEN * Total);
+
+		Start = NowNs();
+		Status = (UseBatch != FALSE) ? McDmaSubmitBatch(BatchSize) :
+				McDmaSubmitChan(BatchSize);
+		Result->SubmitNs += NowNs() - Start;
+		if (Status != XST_SUCCESS) {
+			printf("MCDMA submit of %u packets failed\r\n",
+				BatchSize);
+			return XST_FAILURE;
+		}
+
+		Status = (UseBatch != FALSE) ?
+			McDmaRetireBatch(BatchSize, &Result->RetireNs) :
+			McDmaRetireChan(BatchSize, &Result->RetireNs);
+		if (Status != XST_SUCCESS) {
+			printf("MCDMA retire failed\r\n");
+			return XST_FAILURE;
+		}
+
+		for (Index = 0U; Index < Total; Index++) {
+			if ((Index % MAX_BATCH_SIZE) >= BatchSize) {
+				continue;
+			}
+			if (CheckBuffer(McDmaRxBuf + (Index * MAX_PKT_LEN),
+				MAX_PKT_LEN, Batch + Index) != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+		Result->NumPkts += MCDMA_CHANNELS * BatchSize;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the ZDMA copies in simple and scatter gather mode.
+*
+* @return	XST_SUCCESS if all the copies are done with the right data,
+*		XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int ZDmaBench(void)
+{
+	XZDma_Config Config;
+	BenchResult Result;
+	u32 Index;
+	int Status;
+
+	ZDmaDev = XDmaModel_ZDmaCreate();
+	ZDmaSrcBuf = XDmaModel_Alloc(ZDMA_MAX_SIZE * ZDMA_BATCH, 64U);
+	ZDmaDstBuf = XDmaModel_Alloc(ZDMA_MAX_SIZE * ZDMA_BATCH, 64U);
+	if ((ZDmaDev == NULL) || (ZDmaSrcBuf == NULL) ||
+	    (ZDmaDstBuf == NULL)) {
+		return XST_FAILURE;
+	}
+
+	memset(&Config, 0, sizeof(Config));
+	Config.DmaType = 0U;
+	Config.IsCacheCoherent = 1U;
+	Status = XZDma_CfgInitialize(&ZDma, &Config,
+			(u32)(UINTPTR)ZDmaDev->Regs);
+	if (Status != XST_SUCCESS) {
+		printf("ZDMA initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	(void)XZDma_SetCallBack(&ZDma, XZDMA_HANDLER_DONE, (void *)ZDmaDone,
+			&ZDma);
+	XDmaModel_ConnectIrq(ZDmaDev, ZDmaIrq, &ZDma);
+
+	printf("\r\nZDMA, %u copies per size, %u copies per SG start\r\n",
+		ZDMA_COPIES, ZDMA_BATCH);
+	printf("Pattern        Bytes  Start ns/copy   Done ns/copy  "
+		"Driver us/MB\r\n");
+	for (Index = 0U; Index < ZDMA_NUM_SIZES; Index++) {
+		Status = ZDmaPattern(ZDmaSizes[Index], FALSE, &Result);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		PrintResult("Simple", ZDmaSizes[Index], &Result,
+			ZDmaSizes[Index]);
+
+		Status = ZDmaPattern(ZDmaSizes[Index], TRUE, &Result);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		PrintResult("SgLinear", ZDmaSizes[Index], &Result,
+			ZDmaSizes[Index]);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the done handler of the ZDMA, called by
+* XZDma_IntrHandler() on the model thread.
+*
+* @param	CallBackRef is the ZDMA instance.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ZDmaDone(void *CallBackRef)
+{
+	(void)CallBackRef;
+	__atomic_add_fetch(&ZDmaDoneCount, 1U, __ATOMIC_RELEASE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt service routine connected to the model, it
+* accounts the time spent in XZDma_IntrHandler().
+*
+* @param	CallBackRef is the ZDMA instance.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ZDmaIrq(void *CallBackRef)
+{
+	u64 Start = NowNs();
+
+	XZDma_IntrHandler(CallBackRef);
+	__atomic_add_fetch(&ZDmaIrqNs, NowNs() - Start, __ATOMIC_RELAXED);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs ZDMA_COPIES copies of one size. In simple mode every
+* copy is started on its own, in scatter gather mode ZDMA_BATCH copies are
+* started together with linear descriptors.
+*
+* @param	Size is the size of a copy.
+* @param	UseSg selects the scatter gather mode.
+* @param	Result is updated with the accounted driver time. The done
+*		time is the time spent in XZDma_IntrHandler() on the model
+*		thread.
+*
+* @return	XST_SUCCESS if all the copies are done with the right data,
+*		XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int ZDmaPattern(u32 Size, u32 UseSg, BenchResult *Result)
+{
+	static u8 DscrMem[ZDMA_DSCR_MEM_SIZE] __attribute__ ((aligned (64)));
+	XZDma_Transfer Data[ZDMA_BATCH];
+	u32 PerStart = (UseSg != FALSE) ? ZDMA_BATCH : 1U;
+	u32 Copy;
+	u32 Index;
+	u32 Done;
+	u64 Start;
+	int Status;
+
+	memset(Result, 0, sizeof(*Result));
+	ZDmaIrqNs = 0U;
+
+	Status = XZDma_SetMode(&ZDma, (u8)UseSg, XZDMA_NORMAL_MODE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	if (UseSg != FALSE) {
+		XDmaModel_ZDmaSetLinkedList(ZDmaDev, FALSE);
+		(void)XZDma_CreateBDList(&ZDma, XZDMA_LINEAR,
+				(UINTPTR)DscrMem, sizeof(DscrMem));
+	}
+	XZDma_EnableIntr(&ZDma, XZDMA_IXR_DMA_DONE_MASK);
+
+	memset(Data, 0, sizeof(Data));
+	for (Copy = 0U; Copy < ZDMA_COPIES; Copy += PerStart) {
+		for (Index = 0U; Index < PerStart; Index++) {
+			FillBuffer(ZDmaSrcBuf + (Index * Size), Size,
+				Copy + Index);
+			Data[Index].SrcAddr = (UINTPTR)ZDmaSrcBuf +
+				(Index * Size);
+			Data[Index].DstAddr = (UINTPTR)ZDmaDstBuf +
+				(Index * Size);
+			Data[Index].Size = Size;
+			Data[Index].SrcCoherent = 1U;
+			Data[Index].DstCoherent = 1U;
+		}
+		memset(ZDmaDstBuf, 0, Size * PerStart);
+
+		Done = ZDmaDoneCount;
+		Start = NowNs();
+		Status = XZDma_Start(&ZDma, Data, PerStart);
+		Result->SubmitNs += NowNs() - Start;
+		if (Status != XST_SUCCESS) {
+			printf("ZDMA start failed\r\n");
+			return XST_FAILURE;
+		}
+
+		while (__atomic_load_n(&ZDmaDoneCount, __ATOMIC_ACQUIRE) ==
+		       Done) {
+			;
+		}
+
+		for (Index = 0U; Index < PerStart; Index++) {
+			if (CheckBuffer(ZDmaDstBuf + (Index * Size), Size,
+					Copy + Index) != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+		Result->NumPkts += PerStart;
+	}
+
+	XZDma_DisableIntr(&ZDma, XZDMA_IXR_ALL_INTR_MASK);
+	Result->RetireNs = __atomic_exchange_n(&ZDmaIrqNs, 0U,
+			__ATOMIC_RELAXED);
+
+	return XST_SUCCESS;
+}
@@ -0,0 +1,547 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_model.c
+*
+* This file contains the common part of the host register model: the memory
+* of the cores, the register window dispatch, the device thread and the
+* AXI4-Stream loopback. It also provides the BSP functions the drivers need
+* on the host.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xstatus.h"
+#include "dma_model.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static void *XDmaModel_Thread(void *Arg);
+static XDmaModel_Dev *XDmaModel_Lookup(UINTPTR Addr);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Memory of the cores, below 4 GB in a position dependent executable
+ */
+static u8 Arena[XDMAMODEL_ARENA_SIZE] __attribute__ ((aligned (0x1000)));
+static u32 ArenaUsed;
+
+static XDmaModel_Dev Devices[XDMAMODEL_MAX_DEVICES];
+static u32 NumDevices;
+
+static pthread_mutex_t ModelLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ModelCond = PTHREAD_COND_INITIALIZER;
+static pthread_t ModelThread;
+static u32 Kicks;
+static u32 Running;
+
+/* BSP assert state */
+u32 Xil_AssertStatus;
+s32 Xil_AssertWait;
+
+/*****************************************************************************/
+/**
+*
+* This function checks the memory of the cores and starts the device thread.
+*
+* @return	XST_SUCCESS if the model is started, XST_FAILURE otherwise.
+*
+******************************************************************************/
+int XDmaModel_Init(void)
+{
+	if ((u64)(UINTPTR)&Arena[XDMAMODEL_ARENA_SIZE - 1U] > 0xFFFFFFFFULL) {
+		printf("Model memory is above 4 GB, link with -no-pie\r\n");
+		return XST_FAILURE;
+	}
+
+	Running = 1U;
+	if (pthread_create(&ModelThread, NULL, XDmaModel_Thread, NULL) != 0) {
+		Running = 0U;
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the device thread.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_Shutdown(void)
+{
+	pthread_mutex_lock(&ModelLock);
+	Running = 0U;
+	pthread_cond_signal(&ModelCond);
+	pthread_mutex_unlock(&ModelLock);
+	(void)pthread_join(ModelThread, NULL);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates memory for the cores, which is never freed.
+*
+* @param	Size is the number of bytes.
+* @param	Align is the alignment, a power of 2.
+*
+* @return	Pointer to the memory, NULL if there is not enough memory.
+*
+******************************************************************************/
+void *XDmaModel_Alloc(u32 Size, u32 Align)
+{
+	u32 Start = (ArenaUsed + Align - 1U) & ~(Align - 1U);
+
+	if ((Start > XDMAMODEL_ARENA_SIZE) ||
+	    (Size > (XDMAMODEL_ARENA_SIZE - Start))) {
+		return NULL;
+	}
+
+	ArenaUsed = Start + Size;
+	memset(&Arena[Start], 0, Size);
+
+	return &Arena[Start];
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a core and allocates its register window.
+*
+* @param	Name is the name of the core.
+* @param	Size is the size of the register window in bytes.
+*
+* @return	Pointer to the core, NULL if no more core can be added.
+*
+******************************************************************************/
+XDmaModel_Dev *XDmaModel_AddDevice(const char *Name, u32 Size)
+{
+	XDmaModel_Dev *DevPtr;
+
+	if (NumDevices == XDMAMODEL_MAX_DEVICES) {
+		return NULL;
+	}
+
+	DevPtr = &Devices[NumDevices];
+	memset(DevPtr, 0, sizeof(*DevPtr));
+	DevPtr->Regs = XDmaModel_Alloc(Size, 0x1000U);
+	if (DevPtr->Regs == NULL) {
+		return NULL;
+	}
+	DevPtr->Name = Name;
+	DevPtr->Size = Size;
+
+	pthread_mutex_lock(&ModelLock);
+	NumDevices++;
+	pthread_mutex_unlock(&ModelLock);
+
+	return DevPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function connects an interrupt service routine to a core. The routine
+* is called by the device thread while the interrupt line of the core is
+* asserted, as a level sensitive interrupt.
+*
+* @param	DevPtr is the core.
+* @param	Handler is the interrupt service routine.
+* @param	CallBackRef is the argument of the routine.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_ConnectIrq(XDmaModel_Dev *DevPtr, XDmaModel_IrqHandler Handler,
+		void *CallBackRef)
+{
+	pthread_mutex_lock(&ModelLock);
+	DevPtr->IrqRef = CallBackRef;
+	DevPtr->IrqHandler = Handler;
+	pthread_mutex_unlock(&ModelLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes the model lock.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_Lock(void)
+{
+	pthread_mutex_lock(&ModelLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function releases the model lock.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_Unlock(void)
+{
+	pthread_mutex_unlock(&ModelLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function wakes up the device thread, it is called with the model lock
+* held by the register write handlers which start a core.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_Kick(void)
+{
+	Kicks++;
+	pthread_cond_signal(&ModelCond);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a descriptor word of the core. The store is ordered
+* after the previous data and descriptor writes, like the last write of a
+* descriptor update by the hardware.
+*
+* @param	Addr is the address of the word.
+* @param	Value is the value to write.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_StoreWord(UINTPTR Addr, u32 Value)
+{
+	__atomic_store_n((u32 *)Addr, Value, __ATOMIC_RELEASE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a descriptor word of the core.
+*
+* @param	Addr is the address of the word.
+*
+* @return	Value of the word.
+*
+******************************************************************************/
+u32 XDmaModel_LoadWord(UINTPTR Addr)
+{
+	return __atomic_load_n((u32 *)Addr, __ATOMIC_ACQUIRE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a register or memory word, in place of Xil_In32().
+* Register reads have no side effects in the model and are not locked.
+*
+* @param	Addr is the address to read.
+*
+* @return	Value read.
+*
+******************************************************************************/
+u32 XDmaModel_In32(UINTPTR Addr)
+{
+	return __atomic_load_n((u32 *)Addr, __ATOMIC_ACQUIRE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a register or memory word, in place of Xil_Out32().
+*
+* @param	Addr is the address to write.
+* @param	Value is the value to write.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_Out32(UINTPTR Addr, u32 Value)
+{
+	XDmaModel_Dev *DevPtr = XDmaModel_Lookup(Addr);
+
+	if (DevPtr == NULL) {
+		__atomic_store_n((u32 *)Addr, Value, __ATOMIC_RELEASE);
+		return;
+	}
+
+	pthread_mutex_lock(&ModelLock);
+	DevPtr->Write(DevPtr, (u32)(Addr - (UINTPTR)DevPtr->Regs), Value);
+	pthread_mutex_unlock(&ModelLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the core which register window contains an address.
+*
+* @param	Addr is the address.
+*
+* @return	Pointer to the core, NULL if the address is not a register.
+*
+******************************************************************************/
+static XDmaModel_Dev *XDmaModel_Lookup(UINTPTR Addr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < NumDevices; Index++) {
+		if ((Addr >= (UINTPTR)Devices[Index].Regs) &&
+		    (Addr < ((UINTPTR)Devices[Index].Regs +
+			     Devices[Index].Size))) {
+			return &Devices[Index];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the device thread. It runs the cores until none of them
+* makes progress, calls the connected interrupt service routines and waits
+* for a register write which starts a core.
+*
+* @param	Arg is not used.
+*
+* @return	NULL.
+*
+******************************************************************************/
+static void *XDmaModel_Thread(void *Arg)
+{
+	u32 Index;
+	u32 Seen;
+	int Progress;
+	XDmaModel_Dev *DevPtr;
+
+	(void)Arg;
+
+	pthread_mutex_lock(&ModelLock);
+	while (Running != 0U) {
+		Seen = Kicks;
+		pthread_mutex_unlock(&ModelLock);
+
+		do {
+			Progress = 0;
+			for (Index = 0U; Index < NumDevices; Index++) {
+				DevPtr = &Devices[Index];
+				Progress |= DevPtr->Run(DevPtr);
+
+				pthread_mutex_lock(&ModelLock);
+				while ((DevPtr->IrqHandler != NULL) &&
+				       (DevPtr->IrqLine(DevPtr) != 0)) {
+					pthread_mutex_unlock(&ModelLock);
+					DevPtr->IrqHandler(DevPtr->IrqRef);
+					pthread_mutex_lock(&ModelLock);
+					Progress = 1;
+				}
+				pthread_mutex_unlock(&ModelLock);
+			}
+		} while (Progress != 0);
+
+		pthread_mutex_lock(&ModelLock);
+		if ((Running != 0U) && (Seen == Kicks)) {
+			pthread_cond_wait(&ModelCond, &ModelLock);
+		}
+	}
+	pthread_mutex_unlock(&ModelLock);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a stream.
+*
+* @param	StreamPtr is the stream.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if the buffer can't be allocated.
+*
+******************************************************************************/
+int XDmaModel_StreamInit(XDmaModel_Stream *StreamPtr)
+{
+	memset(StreamPtr, 0, sizeof(*StreamPtr));
+	StreamPtr->Data = malloc(XDMAMODEL_STREAM_SIZE);
+
+	return (StreamPtr->Data != NULL) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the free space of a stream. No space is left when the
+* packet queue is full.
+*
+* @param	StreamPtr is the stream.
+*
+* @return	Number of bytes which can be written.
+*
+******************************************************************************/
+u32 XDmaModel_StreamSpace(const XDmaModel_Stream *StreamPtr)
+{
+	if ((StreamPtr->PktWr - StreamPtr->PktRd) == XDMAMODEL_STREAM_PKTS) {
+		return 0U;
+	}
+
+	return XDMAMODEL_STREAM_SIZE - (StreamPtr->WrPos - StreamPtr->RdPos);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the data of a transmit descriptor to a stream. The
+* caller checks the space first.
+*
+* @param	StreamPtr is the stream.
+* @param	Src is the address of the data.
+* @param	Len is the number of bytes.
+* @param	Eof is non zero for the last descriptor of a packet.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_StreamWrite(XDmaModel_Stream *StreamPtr, UINTPTR Src,
+		u32 Len, u32 Eof)
+{
+	u32 Pos = StreamPtr->WrPos % XDMAMODEL_STREAM_SIZE;
+	u32 First = XDMAMODEL_STREAM_SIZE - Pos;
+
+	if (First > Len) {
+		First = Len;
+	}
+	memcpy(&StreamPtr->Data[Pos], (const void *)Src, First);
+	memcpy(StreamPtr->Data, (const u8 *)Src + First, Len - First);
+
+	StreamPtr->WrPos += Len;
+	StreamPtr->TxLen += Len;
+	if (Eof != 0U) {
+		StreamPtr->PktLen[StreamPtr->PktWr % XDMAMODEL_STREAM_PKTS] =
+			StreamPtr->TxLen;
+		StreamPtr->PktWr++;
+		StreamPtr->TxLen = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the data of a receive descriptor from a stream. Only
+* complete packets are read. A packet larger than the descriptor continues in
+* the next descriptor.
+*
+* @param	StreamPtr is the stream.
+* @param	Dst is the address of the buffer.
+* @param	Len is the size of the buffer.
+* @param	SofPtr is set to 1 if the data starts a packet, 0 otherwise.
+* @param	EofPtr is set to 1 if the data ends a packet, 0 otherwise.
+*
+* @return	Number of bytes read, 0 if no packet is available.
+*
+******************************************************************************/
+u32 XDmaModel_StreamRead(XDmaModel_Stream *StreamPtr, UINTPTR Dst,
+		u32 Len, u32 *SofPtr, u32 *EofPtr)
+{
+	u32 Pos;
+	u32 First;
+
+	*SofPtr = 0U;
+	if (StreamPtr->RxInPkt == 0U) {
+		if (StreamPtr->PktRd == StreamPtr->PktWr) {
+			return 0U;
+		}
+		StreamPtr->RxLeft =
+			StreamPtr->PktLen[StreamPtr->PktRd % XDMAMODEL_STREAM_PKTS];
+		StreamPtr->PktRd++;
+		StreamPtr->RxInPkt = 1U;
+		*SofPtr = 1U;
+	}
+
+	if (Len > StreamPtr->RxLeft) {
+		Len = StreamPtr->RxLeft;
+	}
+
+	Pos = StreamPtr->RdPos % XDMAMODEL_STREAM_SIZE;
+	First = XDMAMODEL_STREAM_SIZE - Pos;
+	if (First > Len) {
+		First = Len;
+	}
+	memcpy((void *)Dst, &StreamPtr->Data[Pos], First);
+	memcpy((u8 *)Dst + First, StreamPtr->Data, Len - First);
+
+	StreamPtr->RdPos += Len;
+	StreamPtr->RxLeft -= Len;
+	*EofPtr = (StreamPtr->RxLeft == 0U) ? 1U : 0U;
+	if (*EofPtr != 0U) {
+		StreamPtr->RxInPkt = 0U;
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/*
+ * BSP functions used by the drivers
+ */
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert failed in %s:%d\r\n", File, (int)Line);
+	exit(1);
+}
+
+void xil_printf(const char8 *Format, ...)
+{
+	va_list Args;
+
+	va_start(Args, Format);
+	(void)vprintf(Format, Args);
+	va_end(Args);
+}
+
+void Xil_DCacheFlushRange(INTPTR Addr, INTPTR Len)
+{
+	(void)Addr;
+	(void)Len;
+}
+
+void Xil_DCacheInvalidateRange(INTPTR Addr, INTPTR Len)
+{
+	(void)Addr;
+	(void)Len;
+}
+
+void Xil_DCacheFlush(void)
+{
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_model.h
+*
+* This file contains the interface of the host register model of the AXI DMA,
+* AXI MCDMA and ZDMA cores.
+*
+* The drivers are built unmodified for the host. The include/xil_io.h header
+* of this directory routes Xil_In32() and Xil_Out32() to XDmaModel_In32() and
+* XDmaModel_Out32(). Accesses inside the register window of a modelled core
+* go to the model, other accesses go to memory.
+*
+* Register side effects which the drivers poll for, such as the end of a reset
+* or the halted bit after a run/stop change, are applied during the register
+* write. Descriptor chains are executed by a device thread, concurrently with
+* the driver, and the completion status is written to the descriptors the way
+* the hardware does.
+*
+* All the memory given to the cores must come from XDmaModel_Alloc() or the
+* BSP DMA memory region, which are both below 4 GB as some drivers keep
+* addresses in u32 variables. The program must be linked as a position
+* dependent executable for the BSP region to be below 4 GB.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef DMA_MODEL_H_
+#define DMA_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XDMAMODEL_MAX_DEVICES		4U	/**< Modelled cores */
+#define XDMAMODEL_ARENA_SIZE		0x4000000U /**< Memory of the cores */
+#define XDMAMODEL_STREAM_SIZE		0x40000U /**< Bytes of a stream */
+#define XDMAMODEL_STREAM_PKTS		1024U	/**< Packets of a stream */
+
+/**************************** Type Definitions *******************************/
+typedef struct XDmaModel_Dev XDmaModel_Dev;
+
+/**
+* Register write handler of a core, called with the model lock held. The
+* handler stores the value and applies its side effects.
+*/
+typedef void (*XDmaModel_WriteHandler)(XDmaModel_Dev *DevPtr, u32 Offset,
+		u32 Value);
+
+/**
+* Descriptor processing of a core, called by the device thread without the
+* model lock. The lock is taken to access the registers only, the data and
+* the descriptors owned by the core are accessed without it. Returns non zero
+* when progress was made.
+*/
+typedef int (*XDmaModel_RunHandler)(XDmaModel_Dev *DevPtr);
+
+/**
+* Interrupt line of a core, returns non zero while the interrupt is asserted.
+*/
+typedef int (*XDmaModel_IrqLine)(XDmaModel_Dev *DevPtr);
+
+/**
+* Interrupt service routine connected to a core, e.g. XZDma_IntrHandler().
+*/
+typedef void (*XDmaModel_IrqHandler)(void *CallBackRef);
+
+/**
+* Modelled core
+*/
+struct XDmaModel_Dev {
+	const char *Name;		/**< Name of the core */
+	volatile u32 *Regs;		/**< Register window */
+	u32 Size;			/**< Size of the window in bytes */
+	XDmaModel_WriteHandler Write;	/**< Register write handler */
+	XDmaModel_RunHandler Run;	/**< Descriptor processing */
+	XDmaModel_IrqLine IrqLine;	/**< Interrupt line, NULL if none */
+	XDmaModel_IrqHandler IrqHandler;/**< Connected handler */
+	void *IrqRef;			/**< Handler argument */
+	void *Priv;			/**< State of the core model */
+	u64 BytesMoved;			/**< Bytes moved by the core */
+};
+
+/**
+* AXI4-Stream loopback between a transmit and a receive channel. The stream is
+* only accessed by the device thread.
+*/
+typedef struct {
+	u8 *Data;			/**< Stream buffer */
+	u32 WrPos;			/**< Write position */
+	u32 RdPos;			/**< Read position */
+	u32 PktLen[XDMAMODEL_STREAM_PKTS]; /**< Length of complete packets */
+	u32 PktWr;			/**< Packets written */
+	u32 PktRd;			/**< Packets read */
+	u32 TxLen;			/**< Bytes of the packet being written */
+	u32 RxLeft;			/**< Bytes left in the packet being read */
+	u32 RxInPkt;			/**< A packet is being read */
+} XDmaModel_Stream;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/** Register of a core */
+#define XDmaModel_Reg(DevPtr, Offset)	((DevPtr)->Regs[(Offset) >> 2U])
+
+/************************** Function Prototypes ******************************/
+int XDmaModel_Init(void);
+void XDmaModel_Shutdown(void);
+void *XDmaModel_Alloc(u32 Size, u32 Align);
+XDmaModel_Dev *XDmaModel_AddDevice(const char *Name, u32 Size);
+void XDmaModel_ConnectIrq(XDmaModel_Dev *DevPtr, XDmaModel_IrqHandler Handler,
+		void *CallBackRef);
+void XDmaModel_Lock(void);
+void XDmaModel_Unlock(void);
+void XDmaModel_Kick(void);
+void XDmaModel_StoreWord(UINTPTR Addr, u32 Value);
+u32 XDmaModel_LoadWord(UINTPTR Addr);
+
+int XDmaModel_StreamInit(XDmaModel_Stream *StreamPtr);
+u32 XDmaModel_StreamSpace(const XDmaModel_Stream *StreamPtr);
+void XDmaModel_StreamWrite(XDmaModel_Stream *StreamPtr, UINTPTR Src,
+		u32 Len, u32 Eof);
+u32 XDmaModel_StreamRead(XDmaModel_Stream *StreamPtr, UINTPTR Dst,
+		u32 Len, u32 *SofPtr, u32 *EofPtr);
+
+u32 XDmaModel_In32(UINTPTR Addr);
+void XDmaModel_Out32(UINTPTR Addr, u32 Value);
+
+XDmaModel_Dev *XDmaModel_AxiDmaCreate(void);
+XDmaModel_Dev *XDmaModel_McDmaCreate(u32 NumChannels);
+XDmaModel_Dev *XDmaModel_ZDmaCreate(void);
+void XDmaModel_ZDmaSetLinkedList(XDmaModel_Dev *DevPtr, u32 LinkedList);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMA_MODEL_H_ */
@@ -0,0 +1,377 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_model_axidma.c
+*
+* This file contains the register model of the AXI DMA core in scatter gather
+* mode, with the MM2S channel looped back to the S2MM channel.
+*
+* The model follows the descriptor protocol of the core:
+* - The current descriptor register is latched when written, while the
+*   channel is halted.
+* - A write of the tail descriptor register starts the processing from the
+*   current descriptor up to the tail descriptor. The channel is idle once
+*   the tail descriptor is completed.
+* - A descriptor with the complete bit set is not processed, the channel
+*   halts with an SG internal error.
+* - The IOC status bit is set at the end of every packet, after the
+*   coalescing count of packets.
+*
+* Multichannel mode, keyhole and cyclic mode, the delay timer and the user
+* application words are not modelled.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include "dma_model.h"
+#include "xaxidma_hw.h"
+
+/************************** Constant Definitions *****************************/
+#define AXIDMA_WINDOW_SIZE	0x1000U	/* Register window */
+#define AXIDMA_LEN_MASK		0x03FFFFFFU	/* 26 bit length */
+#define AXIDMA_NUM_CHANNELS	2U
+
+/**************************** Type Definitions *******************************/
+/*
+ * Channel state
+ */
+typedef struct {
+	u32 Base;		/* Register offset of the channel */
+	u32 IsRx;		/* S2MM channel */
+	UINTPTR Next;		/* Next descriptor to process */
+	u32 Work;		/* Descriptors up to the tail are pending */
+	u32 Coalesce;		/* Packets left before IOC */
+} AxiDmaChan;
+
+/*
+ * Core state
+ */
+typedef struct {
+	AxiDmaChan Chan[AXIDMA_NUM_CHANNELS];
+	XDmaModel_Stream Stream;
+} AxiDmaModel;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define ChanReg(DevPtr, ChanPtr, Offset) \
+	XDmaModel_Reg((DevPtr), (ChanPtr)->Base + (Offset))
+
+/************************** Function Prototypes ******************************/
+static void AxiDma_Write(XDmaModel_Dev *DevPtr, u32 Offset, u32 Value);
+static int AxiDma_Run(XDmaModel_Dev *DevPtr);
+static int AxiDma_RunChan(XDmaModel_Dev *DevPtr, AxiDmaChan *ChanPtr);
+static void AxiDma_Reset(XDmaModel_Dev *DevPtr);
+static UINTPTR AxiDma_Desc(XDmaModel_Dev *DevPtr, AxiDmaChan *ChanPtr,
+		u32 Offset);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function creates an AXI DMA core.
+*
+* @return	Pointer to the core, NULL on failure. The register base address
+*		of the core is (UINTPTR)DevPtr->Regs.
+*
+******************************************************************************/
+XDmaModel_Dev *XDmaModel_AxiDmaCreate(void)
+{
+	XDmaModel_Dev *DevPtr;
+	AxiDmaModel *ModelPtr;
+
+	ModelPtr = calloc(1U, sizeof(*ModelPtr));
+	if ((ModelPtr == NULL) ||
+	    (XDmaModel_StreamInit(&ModelPtr->Stream) != XST_SUCCESS)) {
+		return NULL;
+	}
+
+	DevPtr = XDmaModel_AddDevice("axidma", AXIDMA_WINDOW_SIZE);
+	if (DevPtr == NULL) {
+		return NULL;
+	}
+
+	ModelPtr->Chan[0].Base = XAXIDMA_TX_OFFSET;
+	ModelPtr->Chan[1].Base = XAXIDMA_RX_OFFSET;
+	ModelPtr->Chan[1].IsRx = 1U;
+	DevPtr->Priv = ModelPtr;
+	DevPtr->Write = AxiDma_Write;
+	DevPtr->Run = AxiDma_Run;
+
+	XDmaModel_Lock();
+	AxiDma_Reset(DevPtr);
+	XDmaModel_Unlock();
+
+	return DevPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function resets the core, the reset completes immediately.
+*
+* @param	DevPtr is the core.
+*
+* @return	None.
+*
+******************************************************************************/
+static void AxiDma_Reset(XDmaModel_Dev *DevPtr)
+{
+	AxiDmaModel *ModelPtr = DevPtr->Priv;
+	AxiDmaChan *ChanPtr;
+	u32 Index;
+	u32 Offset;
+
+	for (Index = 0U; Index < AXIDMA_NUM_CHANNELS; Index++) {
+		ChanPtr = &ModelPtr->Chan[Index];
+		for (Offset = 0U; Offset < XAXIDMA_RX_OFFSET; Offset += 4U) {
+			ChanReg(DevPtr, ChanPtr, Offset) = 0U;
+		}
+		ChanReg(DevPtr, ChanPtr, XAXIDMA_CR_OFFSET) =
+			1U << XAXIDMA_COALESCE_SHIFT;
+		ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) =
+			XAXIDMA_HALTED_MASK;
+		ChanPtr->Next = 0U;
+		ChanPtr->Work = 0U;
+		ChanPtr->Coalesce = 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the register write handler of the core.
+*
+* @param	DevPtr is the core.
+* @param	Offset is the register offset.
+* @param	Value is the value written.
+*
+* @return	None.
+*
+******************************************************************************/
+static void AxiDma_Write(XDmaModel_Dev *DevPtr, u32 Offset, u32 Value)
+{
+	AxiDmaModel *ModelPtr = DevPtr->Priv;
+	AxiDmaChan *ChanPtr;
+	u32 Reg;
+
+	if (Offset >= (2U * XAXIDMA_RX_OFFSET)) {
+		XDmaModel_Reg(DevPtr, Offset) = Value;
+		return;
+	}
+
+	ChanPtr = &ModelPtr->Chan[(Offset >= XAXIDMA_RX_OFFSET) ? 1U : 0U];
+	Reg = Offset - ChanPtr->Base;
+
+	switch (Reg) {
+	case XAXIDMA_CR_OFFSET:
+		if ((Value & XAXIDMA_CR_RESET_MASK) != 0U) {
+			AxiDma_Reset(DevPtr);
+			break;
+		}
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		ChanPtr->Coalesce = (Value & XAXIDMA_COALESCE_MASK) >>
+				XAXIDMA_COALESCE_SHIFT;
+		if ((Value & XAXIDMA_CR_RUNSTOP_MASK) != 0U) {
+			ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) &=
+				~XAXIDMA_HALTED_MASK;
+			if (ChanPtr->Work == 0U) {
+				ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) |=
+					XAXIDMA_IDLE_MASK;
+			}
+			XDmaModel_Kick();
+		} else {
+			ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) |=
+				XAXIDMA_HALTED_MASK;
+		}
+		break;
+
+	case XAXIDMA_SR_OFFSET:
+		/* Interrupt bits are write 1 to clear */
+		ChanReg(DevPtr, ChanPtr, Reg) &= ~(Value & XAXIDMA_IRQ_ALL_MASK);
+		break;
+
+	case XAXIDMA_CDESC_OFFSET:
+	case XAXIDMA_CDESC_MSB_OFFSET:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		if ((ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) &
+		     XAXIDMA_HALTED_MASK) != 0U) {
+			ChanPtr->Next = AxiDma_Desc(DevPtr, ChanPtr,
+					XAXIDMA_CDESC_OFFSET);
+		}
+		break;
+
+	case XAXIDMA_TDESC_OFFSET:
+	case XAXIDMA_TDESC_MSB_OFFSET:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		ChanPtr->Work = 1U;
+		ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) &=
+			~XAXIDMA_IDLE_MASK;
+		XDmaModel_Kick();
+		break;
+
+	default:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns a descriptor pointer register pair of a channel.
+*
+* @param	DevPtr is the core.
+* @param	ChanPtr is the channel.
+* @param	Offset is the offset of the LSB register.
+*
+* @return	Descriptor address.
+*
+******************************************************************************/
+static UINTPTR AxiDma_Desc(XDmaModel_Dev *DevPtr, AxiDmaChan *ChanPtr,
+		u32 Offset)
+{
+	u64 Addr = ((u64)ChanReg(DevPtr, ChanPtr, Offset + 4U) << 32U) |
+		(ChanReg(DevPtr, ChanPtr, Offset) & XAXIDMA_DESC_LSB_MASK);
+
+	return (UINTPTR)Addr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the two channels of the core.
+*
+* @param	DevPtr is the core.
+*
+* @return	Non zero if a descriptor was processed.
+*
+******************************************************************************/
+static int AxiDma_Run(XDmaModel_Dev *DevPtr)
+{
+	AxiDmaModel *ModelPtr = DevPtr->Priv;
+	int Progress = 0;
+
+	while ((AxiDma_RunChan(DevPtr, &ModelPtr->Chan[0]) |
+		AxiDma_RunChan(DevPtr, &ModelPtr->Chan[1])) != 0) {
+		Progress = 1;
+	}
+
+	return Progress;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function processes the next descriptor of a channel.
+*
+* @param	DevPtr is the core.
+* @param	ChanPtr is the channel.
+*
+* @return	Non zero if a descriptor was processed.
+*
+******************************************************************************/
+static int AxiDma_RunChan(XDmaModel_Dev *DevPtr, AxiDmaChan *ChanPtr)
+{
+	AxiDmaModel *ModelPtr = DevPtr->Priv;
+	XDmaModel_Stream *StreamPtr = &ModelPtr->Stream;
+	UINTPTR Bd;
+	UINTPTR Buf;
+	u32 Ctrl;
+	u32 Len;
+	u32 Sts;
+	u32 Sof;
+	u32 Eof;
+
+	XDmaModel_Lock();
+	if ((ChanPtr->Work == 0U) ||
+	    ((ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) &
+	      XAXIDMA_HALTED_MASK) != 0U)) {
+		XDmaModel_Unlock();
+		return 0;
+	}
+	Bd = ChanPtr->Next;
+	XDmaModel_Unlock();
+
+	Ctrl = XDmaModel_LoadWord(Bd + XAXIDMA_BD_CTRL_LEN_OFFSET);
+	Len = Ctrl & AXIDMA_LEN_MASK;
+	Buf = (UINTPTR)(((u64)XDmaModel_LoadWord(Bd +
+			XAXIDMA_BD_BUFA_MSB_OFFSET) << 32U) |
+			XDmaModel_LoadWord(Bd + XAXIDMA_BD_BUFA_OFFSET));
+	Sts = XDmaModel_LoadWord(Bd + XAXIDMA_BD_STS_OFFSET);
+
+	if (((Sts & XAXIDMA_BD_STS_COMPLETE_MASK) != 0U) || (Len == 0U) ||
+	    (Len > XDMAMODEL_STREAM_SIZE)) {
+		XDmaModel_Lock();
+		ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) |=
+			XAXIDMA_HALTED_MASK | XAXIDMA_ERR_SG_INT_MASK |
+			XAXIDMA_IRQ_ERROR_MASK;
+		ChanReg(DevPtr, ChanPtr, XAXIDMA_CDESC_OFFSET) = (u32)Bd;
+		ChanPtr->Work = 0U;
+		XDmaModel_Unlock();
+		return 1;
+	}
+
+	if (ChanPtr->IsRx == 0U) {
+		if (XDmaModel_StreamSpace(StreamPtr) < Len) {
+			return 0;
+		}
+		Eof = Ctrl & XAXIDMA_BD_CTRL_TXEOF_MASK;
+		XDmaModel_StreamWrite(StreamPtr, Buf, Len, Eof);
+		Sts = XAXIDMA_BD_STS_COMPLETE_MASK | Len;
+	} else {
+		Len = XDmaModel_StreamRead(StreamPtr, Buf, Len, &Sof, &Eof);
+		if (Len == 0U) {
+			return 0;
+		}
+		Sts = XAXIDMA_BD_STS_COMPLETE_MASK | Len;
+		if (Sof != 0U) {
+			Sts |= XAXIDMA_BD_STS_RXSOF_MASK;
+		}
+		if (Eof != 0U) {
+			Sts |= XAXIDMA_BD_STS_RXEOF_MASK;
+		}
+	}
+	DevPtr->BytesMoved += Len;
+	XDmaModel_StoreWord(Bd + XAXIDMA_BD_STS_OFFSET, Sts);
+
+	XDmaModel_Lock();
+	if (Eof != 0U) {
+		if (ChanPtr->Coalesce > 1U) {
+			ChanPtr->Coalesce--;
+		} else {
+			ChanPtr->Coalesce = (ChanReg(DevPtr, ChanPtr,
+				XAXIDMA_CR_OFFSET) & XAXIDMA_COALESCE_MASK) >>
+				XAXIDMA_COALESCE_SHIFT;
+			ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) |=
+				XAXIDMA_IRQ_IOC_MASK;
+		}
+	}
+	ChanReg(DevPtr, ChanPtr, XAXIDMA_CDESC_OFFSET) = (u32)Bd;
+	ChanReg(DevPtr, ChanPtr, XAXIDMA_CDESC_MSB_OFFSET) = UPPER_32_BITS(Bd);
+	ChanPtr->Next = (UINTPTR)(((u64)XDmaModel_LoadWord(Bd +
+			XAXIDMA_BD_NDESC_MSB_OFFSET) << 32U) |
+			(XDmaModel_LoadWord(Bd + XAXIDMA_BD_NDESC_OFFSET) &
+			 XAXIDMA_DESC_LSB_MASK));
+	if (Bd == AxiDma_Desc(DevPtr, ChanPtr, XAXIDMA_TDESC_OFFSET)) {
+		ChanPtr->Work = 0U;
+		ChanReg(DevPtr, ChanPtr, XAXIDMA_SR_OFFSET) |=
+			XAXIDMA_IDLE_MASK;
+	}
+	XDmaModel_Unlock();
+
+	return 1;
+}
@@ -0,0 +1,456 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_model_mcdma.c
+*
+* This file contains the register model of the AXI MCDMA core, with each MM2S
+* channel looped back to the S2MM channel of the same number.
+*
+* The model follows the descriptor protocol of the core:
+* - The current descriptor register of a channel is latched when written,
+*   while the channel has no descriptor to process.
+* - A channel processes its descriptors up to the tail descriptor once the
+*   direction is running, the channel is running and the channel is enabled
+*   in the channel enable register.
+* - The running channels are served in round robin, one descriptor at a
+*   time.
+* - A descriptor with the complete bit set is not processed, the channel
+*   stops with an SG internal error.
+* - The IOC status bit of a channel is set at the end of every packet, after
+*   the coalescing count of packets, and the packet counter is incremented.
+*
+* Scheduling weights, packet drop, the delay timer and the sideband fields
+* are not modelled.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include "dma_model.h"
+#include "xmcdma_hw.h"
+
+/************************** Constant Definitions *****************************/
+#define MCDMA_WINDOW_SIZE	0x1000U	/* Register window */
+#define MCDMA_MAX_CHANNELS	16U
+#define MCDMA_CHAN_END		0x440U	/* End of the channel registers */
+#define MCDMA_NUM_DIRS		2U
+
+/**************************** Type Definitions *******************************/
+/*
+ * Channel state
+ */
+typedef struct {
+	u32 Base;		/* Register offset of the channel */
+	UINTPTR Next;		/* Next descriptor to process */
+	u32 Work;		/* Descriptors up to the tail are pending */
+	u32 Coalesce;		/* Packets left before IOC */
+} McDmaChan;
+
+/*
+ * Core state, direction 0 is MM2S and direction 1 is S2MM
+ */
+typedef struct {
+	u32 NumChannels;
+	McDmaChan Chan[MCDMA_NUM_DIRS][MCDMA_MAX_CHANNELS];
+	XDmaModel_Stream Stream[MCDMA_MAX_CHANNELS];
+} McDmaModel;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define DirBase(Dir)	(((Dir) != 0U) ? XMCDMA_RX_OFFSET : 0U)
+
+#define ChanReg(DevPtr, ChanPtr, Offset) \
+	XDmaModel_Reg((DevPtr), (ChanPtr)->Base + (Offset))
+
+/************************** Function Prototypes ******************************/
+static void McDma_Write(XDmaModel_Dev *DevPtr, u32 Offset, u32 Value);
+static void McDma_WriteChan(XDmaModel_Dev *DevPtr, McDmaChan *ChanPtr,
+		u32 Reg, u32 Value);
+static int McDma_Run(XDmaModel_Dev *DevPtr);
+static int McDma_RunChan(XDmaModel_Dev *DevPtr, u32 Dir, u32 Id);
+static void McDma_Reset(XDmaModel_Dev *DevPtr);
+static UINTPTR McDma_Desc(XDmaModel_Dev *DevPtr, McDmaChan *ChanPtr,
+		u32 Offset);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function creates an AXI MCDMA core.
+*
+* @param	NumChannels is the number of channels in each direction.
+*
+* @return	Pointer to the core, NULL on failure. The register base address
+*		of the core is (UINTPTR)DevPtr->Regs.
+*
+******************************************************************************/
+XDmaModel_Dev *XDmaModel_McDmaCreate(u32 NumChannels)
+{
+	XDmaModel_Dev *DevPtr;
+	McDmaModel *ModelPtr;
+	u32 Dir;
+	u32 Id;
+
+	if ((NumChannels == 0U) || (NumChannels > MCDMA_MAX_CHANNELS)) {
+		return NULL;
+	}
+
+	ModelPtr = calloc(1U, sizeof(*ModelPtr));
+	if (ModelPtr == NULL) {
+		return NULL;
+	}
+
+	for (Id = 0U; Id < NumChannels; Id++) {
+		if (XDmaModel_StreamInit(&ModelPtr->Stream[Id]) !=
+		    XST_SUCCESS) {
+			return NULL;
+		}
+	}
+
+	DevPtr = XDmaModel_AddDevice("mcdma", MCDMA_WINDOW_SIZE);
+	if (DevPtr == NULL) {
+		return NULL;
+	}
+
+	ModelPtr->NumChannels = NumChannels;
+	for (Dir = 0U; Dir < MCDMA_NUM_DIRS; Dir++) {
+		for (Id = 0U; Id < NumChannels; Id++) {
+			ModelPtr->Chan[Dir][Id].Base = DirBase(Dir) +
+				(Id * XMCDMA_NXTCHAN_OFFSET);
+		}
+	}
+	DevPtr->Priv = ModelPtr;
+	DevPtr->Write = McDma_Write;
+	DevPtr->Run = McDma_Run;
+
+	XDmaModel_Lock();
+	McDma_Reset(DevPtr);
+	XDmaModel_Unlock();
+
+	return DevPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function resets the core, the reset completes immediately.
+*
+* @param	DevPtr is the core.
+*
+* @return	None.
+*
+******************************************************************************/
+static void McDma_Reset(XDmaModel_Dev *DevPtr)
+{
+	McDmaModel *ModelPtr = DevPtr->Priv;
+	McDmaChan *ChanPtr;
+	u32 Offset;
+	u32 Dir;
+	u32 Id;
+
+	for (Offset = 0U; Offset < MCDMA_WINDOW_SIZE; Offset += 4U) {
+		XDmaModel_Reg(DevPtr, Offset) = 0U;
+	}
+
+	for (Dir = 0U; Dir < MCDMA_NUM_DIRS; Dir++) {
+		XDmaModel_Reg(DevPtr, DirBase(Dir) + XMCDMA_CSR_OFFSET) =
+			XMCDMA_CSR_HALTED_MASK;
+		for (Id = 0U; Id < ModelPtr->NumChannels; Id++) {
+			ChanPtr = &ModelPtr->Chan[Dir][Id];
+			ChanReg(DevPtr, ChanPtr, XMCDMA_CR_OFFSET) =
+				1U << XMCDMA_COALESCE_SHIFT;
+			ChanPtr->Next = 0U;
+			ChanPtr->Work = 0U;
+			ChanPtr->Coalesce = 1U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the register write handler of the core.
+*
+* @param	DevPtr is the core.
+* @param	Offset is the register offset.
+* @param	Value is the value written.
+*
+* @return	None.
+*
+******************************************************************************/
+static void McDma_Write(XDmaModel_Dev *DevPtr, u32 Offset, u32 Value)
+{
+	McDmaModel *ModelPtr = DevPtr->Priv;
+	u32 Dir = (Offset >= XMCDMA_RX_OFFSET) ? 1U : 0U;
+	u32 Reg = Offset - DirBase(Dir);
+	u32 Id;
+
+	if ((Reg >= XMCDMA_CR_OFFSET) && (Reg < MCDMA_CHAN_END)) {
+		Id = (Reg - XMCDMA_CR_OFFSET) / XMCDMA_NXTCHAN_OFFSET;
+		if (Id < ModelPtr->NumChannels) {
+			McDma_WriteChan(DevPtr, &ModelPtr->Chan[Dir][Id],
+				XMCDMA_CR_OFFSET +
+				((Reg - XMCDMA_CR_OFFSET) %
+				 XMCDMA_NXTCHAN_OFFSET), Value);
+		}
+		return;
+	}
+
+	switch (Reg) {
+	case XMCDMA_CCR_OFFSET:
+		if ((Value & XMCDMA_CCR_RESET_MASK) != 0U) {
+			/* Resetting one direction resets the whole core */
+			McDma_Reset(DevPtr);
+			break;
+		}
+		XDmaModel_Reg(DevPtr, Offset) = Value;
+		if ((Value & XMCDMA_CCR_RUNSTOP_MASK) != 0U) {
+			XDmaModel_Reg(DevPtr, DirBase(Dir) +
+				XMCDMA_CSR_OFFSET) &= ~XMCDMA_CSR_HALTED_MASK;
+			XDmaModel_Kick();
+		} else {
+			XDmaModel_Reg(DevPtr, DirBase(Dir) +
+				XMCDMA_CSR_OFFSET) |= XMCDMA_CSR_HALTED_MASK;
+		}
+		break;
+
+	case XMCDMA_CHEN_OFFSET:
+		XDmaModel_Reg(DevPtr, Offset) = Value;
+		XDmaModel_Kick();
+		break;
+
+	default:
+		XDmaModel_Reg(DevPtr, Offset) = Value;
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function handles a write to a channel register.
+*
+* @param	DevPtr is the core.
+* @param	ChanPtr is the channel.
+* @param	Reg is the offset of the register for channel 1.
+* @param	Value is the value written.
+*
+* @return	None.
+*
+******************************************************************************/
+static void McDma_WriteChan(XDmaModel_Dev *DevPtr, McDmaChan *ChanPtr,
+		u32 Reg, u32 Value)
+{
+	switch (Reg) {
+	case XMCDMA_CR_OFFSET:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		ChanPtr->Coalesce = (Value & XMCDMA_COALESCE_MASK) >>
+				XMCDMA_COALESCE_SHIFT;
+		XDmaModel_Kick();
+		break;
+
+	case XMCDMA_SR_OFFSET:
+		/* Interrupt bits are write 1 to clear */
+		ChanReg(DevPtr, ChanPtr, Reg) &= ~(Value & XMCDMA_IRQ_ALL_MASK);
+		break;
+
+	case XMCDMA_CDESC_OFFSET:
+	case XMCDMA_CDESC_MSB_OFFSET:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		if (ChanPtr->Work == 0U) {
+			ChanPtr->Next = McDma_Desc(DevPtr, ChanPtr,
+					XMCDMA_CDESC_OFFSET);
+		}
+		break;
+
+	case XMCDMA_TDESC_OFFSET:
+	case XMCDMA_TDESC_MSB_OFFSET:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		ChanPtr->Work = 1U;
+		XDmaModel_Kick();
+		break;
+
+	default:
+		ChanReg(DevPtr, ChanPtr, Reg) = Value;
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns a descriptor pointer register pair of a channel.
+*
+* @param	DevPtr is the core.
+* @param	ChanPtr is the channel.
+* @param	Offset is the offset of the LSB register.
+*
+* @return	Descriptor address.
+*
+******************************************************************************/
+static UINTPTR McDma_Desc(XDmaModel_Dev *DevPtr, McDmaChan *ChanPtr,
+		u32 Offset)
+{
+	u64 Addr = ((u64)ChanReg(DevPtr, ChanPtr, Offset + 4U) << 32U) |
+		ChanReg(DevPtr, ChanPtr, Offset);
+
+	return (UINTPTR)Addr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function serves the channels in round robin.
+*
+* @param	DevPtr is the core.
+*
+* @return	Non zero if a descriptor was processed.
+*
+******************************************************************************/
+static int McDma_Run(XDmaModel_Dev *DevPtr)
+{
+	McDmaModel *ModelPtr = DevPtr->Priv;
+	int Progress = 0;
+	int Round;
+	u32 Dir;
+	u32 Id;
+
+	do {
+		Round = 0;
+		for (Id = 0U; Id < ModelPtr->NumChannels; Id++) {
+			for (Dir = 0U; Dir < MCDMA_NUM_DIRS; Dir++) {
+				Round |= McDma_RunChan(DevPtr, Dir, Id);
+			}
+		}
+		Progress |= Round;
+	} while (Round != 0);
+
+	return Progress;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function processes the next descriptor of a channel.
+*
+* @param	DevPtr is the core.
+* @param	Dir is the direction, 0 for MM2S and 1 for S2MM.
+* @param	Id is the channel index, starting from 0.
+*
+* @return	Non zero if a descriptor was processed.
+*
+******************************************************************************/
+static int McDma_RunChan(XDmaModel_Dev *DevPtr, u32 Dir, u32 Id)
+{
+	McDmaModel *ModelPtr = DevPtr->Priv;
+	McDmaChan *ChanPtr = &ModelPtr->Chan[Dir][Id];
+	XDmaModel_Stream *StreamPtr = &ModelPtr->Stream[Id];
+	UINTPTR Bd;
+	UINTPTR Buf;
+	u32 Ctrl;
+	u32 Len;
+	u32 Sts;
+	u32 Sof;
+	u32 Eof;
+
+	XDmaModel_Lock();
+	if ((ChanPtr->Work == 0U) ||
+	    ((XDmaModel_Reg(DevPtr, DirBase(Dir) + XMCDMA_CSR_OFFSET) &
+	      XMCDMA_CSR_HALTED_MASK) != 0U) ||
+	    ((ChanReg(DevPtr, ChanPtr, XMCDMA_CR_OFFSET) &
+	      XMCDMA_CCR_RUNSTOP_MASK) == 0U) ||
+	    ((XDmaModel_Reg(DevPtr, DirBase(Dir) + XMCDMA_CHEN_OFFSET) &
+	      (1U << Id)) == 0U)) {
+		XDmaModel_Unlock();
+		return 0;
+	}
+	Bd = ChanPtr->Next;
+	XDmaModel_Unlock();
+
+	Ctrl = XDmaModel_LoadWord(Bd + XMCDMA_BD_CTRL_OFFSET);
+	Len = Ctrl & XMCDMA_MAX_TRANSFER_LEN;
+	Buf = (UINTPTR)(((u64)XDmaModel_LoadWord(Bd +
+			XMCDMA_BD_BUFA_MSB_OFFSET) << 32U) |
+			XDmaModel_LoadWord(Bd + XMCDMA_BD_BUFA_OFFSET));
+	Sts = XDmaModel_LoadWord(Bd + ((Dir == 0U) ?
+			XMCDMA_BD_SIDEBAND_STS_OFFSET : XMCDMA_BD_STS_OFFSET));
+
+	if (((Sts & XMCDMA_BD_STS_COMPLETE_MASK) != 0U) || (Len == 0U) ||
+	    (Len > XDMAMODEL_STREAM_SIZE)) {
+		XDmaModel_Lock();
+		ChanReg(DevPtr, ChanPtr, XMCDMA_CR_OFFSET) &=
+			~XMCDMA_CCR_RUNSTOP_MASK;
+		ChanReg(DevPtr, ChanPtr, XMCDMA_SR_OFFSET) |=
+			XMCDMA_IRQ_ERROR_MASK;
+		XDmaModel_Reg(DevPtr, DirBase(Dir) + XMCDMA_ERR_OFFSET) |=
+			XMCDMA_ERR_SG_INT_MASK;
+		ChanPtr->Work = 0U;
+		XDmaModel_Unlock();
+		return 1;
+	}
+
+	if (Dir == 0U) {
+		if (XDmaModel_StreamSpace(StreamPtr) < Len) {
+			return 0;
+		}
+		Eof = Ctrl & XMCDMA_BD_CTRL_EOF_MASK;
+		XDmaModel_StreamWrite(StreamPtr, Buf, Len, Eof);
+		XDmaModel_StoreWord(Bd + XMCDMA_BD_SIDEBAND_STS_OFFSET,
+			XMCDMA_BD_STS_COMPLETE_MASK | Len);
+	} else {
+		Len = XDmaModel_StreamRead(StreamPtr, Buf, Len, &Sof, &Eof);
+		if (Len == 0U) {
+			return 0;
+		}
+		Sts = XMCDMA_BD_STS_COMPLETE_MASK | Len;
+		if (Sof != 0U) {
+			Sts |= XMCDMA_BD_STS_RXSOF_MASK;
+		}
+		if (Eof != 0U) {
+			Sts |= XMCDMA_BD_STS_RXEOF_MASK;
+		}
+		XDmaModel_StoreWord(Bd + XMCDMA_BD_STS_OFFSET, Sts);
+	}
+	DevPtr->BytesMoved += Len;
+
+	XDmaModel_Lock();
+	if (Eof != 0U) {
+		ChanReg(DevPtr, ChanPtr, (Dir == 0U) ?
+			XMCDMA_TX_PKTCNT_STAT_OFFSET :
+			XMCDMA_RX_PKTCNT_STAT_OFFSET) += 1U;
+		if (ChanPtr->Coalesce > 1U) {
+			ChanPtr->Coalesce--;
+		} else {
+			ChanPtr->Coalesce = (ChanReg(DevPtr, ChanPtr,
+				XMCDMA_CR_OFFSET) & XMCDMA_COALESCE_MASK) >>
+				XMCDMA_COALESCE_SHIFT;
+			ChanReg(DevPtr, ChanPtr, XMCDMA_SR_OFFSET) |=
+				XMCDMA_IRQ_IOC_MASK;
+		}
+	}
+	ChanReg(DevPtr, ChanPtr, XMCDMA_CDESC_OFFSET) = (u32)Bd;
+	ChanReg(DevPtr, ChanPtr, XMCDMA_CDESC_MSB_OFFSET) = UPPER_32_BITS(Bd);
+	XDmaModel_Reg(DevPtr, DirBase(Dir) + XMCDMA_CHSER_OFFSET) = 1U << Id;
+	ChanPtr->Next = (UINTPTR)(((u64)XDmaModel_LoadWord(Bd +
+			XMCDMA_BD_NDESC_MSB_OFFSET) << 32U) |
+			XDmaModel_LoadWord(Bd + XMCDMA_BD_NDESC_OFFSET));
+	if (Bd == McDma_Desc(DevPtr, ChanPtr, XMCDMA_TDESC_OFFSET)) {
+		ChanPtr->Work = 0U;
+	}
+	XDmaModel_Unlock();
+
+	return 1;
+}
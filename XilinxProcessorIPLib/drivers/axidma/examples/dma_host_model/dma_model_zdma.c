@@ -0,0 +1,398 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_model_zdma.c
+*
+* This file contains the register model of one ZDMA channel.
+*
+* The model supports the simple mode, including the write only mode, and the
+* scatter gather mode with linear or linked list descriptors:
+* - Setting the enable bit of CTRL2 starts the transfer, the channel is busy
+*   until the transfer is done and the enable bit is cleared then.
+* - In scatter gather mode the source and destination descriptors are
+*   processed in pairs, until a source descriptor with the stop or pause
+*   command. The continue bit of CTRL0 resumes a paused channel with the
+*   next descriptor pair.
+* - The interrupt status bits are write 1 to clear, and the interrupt line
+*   is asserted while a status bit is set and not masked.
+*
+* The driver does not set the descriptor type bit of WORD3, which is what
+* the hardware uses to fetch linked list descriptors. The descriptor format
+* is selected with XDmaModel_ZDmaSetLinkedList() instead, to match the
+* XZDma_CreateBDList() call of the application.
+*
+* Rate control, the read only mode, the descriptor interrupt counters and
+* the AXI attributes are not modelled.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#include "dma_model.h"
+#include "xzdma_hw.h"
+
+/************************** Constant Definitions *****************************/
+#define ZDMA_WINDOW_SIZE	0x1000U	/* Register window */
+#define ZDMA_LI_DSCR_SIZE	16U	/* Linear descriptor */
+#define ZDMA_DSCR_SIZE_OFFSET	8U	/* Size word of a descriptor */
+#define ZDMA_DSCR_CNTL_OFFSET	12U	/* Control word of a descriptor */
+#define ZDMA_DSCR_NEXT_OFFSET	16U	/* Next descriptor, linked list */
+#define ZDMA_WRONLY_BYTES	16U	/* Write only pattern */
+
+/**************************** Type Definitions *******************************/
+/*
+ * Channel state
+ */
+typedef struct {
+	u32 LinkedList;		/* Descriptors are linked list */
+	u32 Work;		/* A transfer is being processed */
+	UINTPTR SrcDscr;	/* Next source descriptor */
+	UINTPTR DstDscr;	/* Next destination descriptor */
+} ZDmaModel;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define RegPair(DevPtr, Offset) \
+	((UINTPTR)(((u64)(XDmaModel_Reg((DevPtr), (Offset) + 4U) & \
+	XZDMA_WORD1_MSB_MASK) << 32U) | XDmaModel_Reg((DevPtr), (Offset))))
+
+/************************** Function Prototypes ******************************/
+static void ZDma_Write(XDmaModel_Dev *DevPtr, u32 Offset, u32 Value);
+static int ZDma_Run(XDmaModel_Dev *DevPtr);
+static int ZDma_IrqLine(XDmaModel_Dev *DevPtr);
+static void ZDma_Done(XDmaModel_Dev *DevPtr, u32 Size, u32 Intr, u32 Sts);
+static u32 ZDma_Simple(XDmaModel_Dev *DevPtr);
+static UINTPTR ZDma_LoadAddr(UINTPTR Dscr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function creates a ZDMA channel, using linear descriptors.
+*
+* @param	None.
+*
+* @return	Pointer to the channel, NULL on failure. The register base
+*		address of the channel is (UINTPTR)DevPtr->Regs.
+*
+******************************************************************************/
+XDmaModel_Dev *XDmaModel_ZDmaCreate(void)
+{
+	XDmaModel_Dev *DevPtr;
+	ZDmaModel *ModelPtr;
+
+	ModelPtr = calloc(1U, sizeof(*ModelPtr));
+	if (ModelPtr == NULL) {
+		return NULL;
+	}
+
+	DevPtr = XDmaModel_AddDevice("zdma", ZDMA_WINDOW_SIZE);
+	if (DevPtr == NULL) {
+		return NULL;
+	}
+
+	DevPtr->Priv = ModelPtr;
+	DevPtr->Write = ZDma_Write;
+	DevPtr->Run = ZDma_Run;
+	DevPtr->IrqLine = ZDma_IrqLine;
+
+	XDmaModel_Lock();
+	XDmaModel_Reg(DevPtr, XZDMA_CH_IMR_OFFSET) = XZDMA_IXR_ALL_INTR_MASK;
+	XDmaModel_Reg(DevPtr, XZDMA_CH_CTRL0_OFFSET) = XZDMA_CTRL0_RESET_VALUE;
+	XDmaModel_Reg(DevPtr, XZDMA_CH_CTRL1_OFFSET) = XZDMA_CTRL1_RESET_VALUE;
+	XDmaModel_Reg(DevPtr, XZDMA_CH_DATA_ATTR_OFFSET) =
+		XZDMA_DATA_ATTR_RESET_VALUE;
+	XDmaModel_Unlock();
+
+	return DevPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function selects the descriptor format of the scatter gather mode.
+*
+* @param	DevPtr is the channel.
+* @param	LinkedList is non zero for linked list descriptors, zero for
+*		linear descriptors.
+*
+* @return	None.
+*
+******************************************************************************/
+void XDmaModel_ZDmaSetLinkedList(XDmaModel_Dev *DevPtr, u32 LinkedList)
+{
+	ZDmaModel *ModelPtr = DevPtr->Priv;
+
+	XDmaModel_Lock();
+	ModelPtr->LinkedList = LinkedList;
+	XDmaModel_Unlock();
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the register write handler of the channel.
+*
+* @param	DevPtr is the channel.
+* @param	Offset is the register offset.
+* @param	Value is the value written.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ZDma_Write(XDmaModel_Dev *DevPtr, u32 Offset, u32 Value)
+{
+	ZDmaModel *ModelPtr = DevPtr->Priv;
+	u32 Sts = XDmaModel_Reg(DevPtr, XZDMA_CH_STS_OFFSET) &
+			XZDMA_STS_ALL_MASK;
+
+	switch (Offset) {
+	case XZDMA_CH_ISR_OFFSET:
+		XDmaModel_Reg(DevPtr, Offset) &= ~Value;
+		break;
+
+	case XZDMA_CH_IMR_OFFSET:
+		/* Read only */
+		break;
+
+	case XZDMA_CH_IEN_OFFSET:
+		XDmaModel_Reg(DevPtr, XZDMA_CH_IMR_OFFSET) &= ~Value;
+		XDmaModel_Kick();
+		break;
+
+	case XZDMA_CH_IDS_OFFSET:
+		XDmaModel_Reg(DevPtr, XZDMA_CH_IMR_OFFSET) |=
+			(Value & XZDMA_IXR_ALL_INTR_MASK);
+		break;
+
+	case XZDMA_CH_CTRL0_OFFSET:
+		XDmaModel_Reg(DevPtr, Offset) = Value & ~XZDMA_CTRL0_CONT_MASK;
+		if (((Value & XZDMA_CTRL0_CONT_MASK) != 0U) &&
+		    (Sts == XZDMA_STS_PAUSE_MASK)) {
+			XDmaModel_Reg(DevPtr, XZDMA_CH_STS_OFFSET) =
+				XZDMA_STS_BUSY_MASK;
+			ModelPtr->Work = 1U;
+			XDmaModel_Kick();
+		}
+		break;
+
+	case XZDMA_CH_TOTAL_BYTE_OFFSET:
+		/* Cleared by writing the value read */
+		XDmaModel_Reg(DevPtr, Offset) -= Value;
+		break;
+
+	case XZDMA_CH_CTRL2_OFFSET:
+		XDmaModel_Reg(DevPtr, Offset) = Value;
+		if (((Value & XZDMA_CH_CTRL2_EN_MASK) != 0U) &&
+		    (ModelPtr->Work == 0U)) {
+			ModelPtr->SrcDscr = RegPair(DevPtr,
+					XZDMA_CH_SRC_START_LSB_OFFSET);
+			ModelPtr->DstDscr = RegPair(DevPtr,
+					XZDMA_CH_DST_START_LSB_OFFSET);
+			ModelPtr->Work = 1U;
+			XDmaModel_Reg(DevPtr, XZDMA_CH_STS_OFFSET) =
+				XZDMA_STS_BUSY_MASK;
+			XDmaModel_Kick();
+		}
+		break;
+
+	default:
+		XDmaModel_Reg(DevPtr, Offset) = Value;
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the interrupt line of the channel.
+*
+* @param	DevPtr is the channel.
+*
+* @return	Non zero while an unmasked interrupt is pending.
+*
+******************************************************************************/
+static int ZDma_IrqLine(XDmaModel_Dev *DevPtr)
+{
+	return (XDmaModel_Reg(DevPtr, XZDMA_CH_ISR_OFFSET) &
+		~XDmaModel_Reg(DevPtr, XZDMA_CH_IMR_OFFSET)) != 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function updates the registers at the end of a transfer or of a
+* paused descriptor. It is called with the model lock held.
+*
+* @param	DevPtr is the channel.
+* @param	Size is the number of bytes moved.
+* @param	Intr is the interrupt status to be set.
+* @param	Sts is the new channel state.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ZDma_Done(XDmaModel_Dev *DevPtr, u32 Size, u32 Intr, u32 Sts)
+{
+	ZDmaModel *ModelPtr = DevPtr->Priv;
+
+	XDmaModel_Reg(DevPtr, XZDMA_CH_TOTAL_BYTE_OFFSET) += Size;
+	XDmaModel_Reg(DevPtr, XZDMA_CH_STS_OFFSET) = Sts;
+	XDmaModel_Reg(DevPtr, XZDMA_CH_ISR_OFFSET) |= Intr;
+	if (Sts != XZDMA_STS_PAUSE_MASK) {
+		XDmaModel_Reg(DevPtr, XZDMA_CH_CTRL2_OFFSET) &=
+			~XZDMA_CH_CTRL2_EN_MASK;
+	}
+	ModelPtr->Work = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function does a simple mode transfer.
+*
+* @param	DevPtr is the channel.
+*
+* @return	Number of bytes moved.
+*
+******************************************************************************/
+static u32 ZDma_Simple(XDmaModel_Dev *DevPtr)
+{
+	u32 Pattern[ZDMA_WRONLY_BYTES / 4U];
+	UINTPTR Src;
+	UINTPTR Dst;
+	u32 Size;
+	u32 Ctrl0;
+	u32 Index;
+
+	XDmaModel_Lock();
+	Ctrl0 = XDmaModel_Reg(DevPtr, XZDMA_CH_CTRL0_OFFSET);
+	Src = RegPair(DevPtr, XZDMA_CH_SRC_DSCR_WORD0_OFFSET);
+	Dst = RegPair(DevPtr, XZDMA_CH_DST_DSCR_WORD0_OFFSET);
+	Size = XDmaModel_Reg(DevPtr, XZDMA_CH_DST_DSCR_WORD2_OFFSET) &
+		XZDMA_WORD2_SIZE_MASK;
+	for (Index = 0U; Index < (ZDMA_WRONLY_BYTES / 4U); Index++) {
+		Pattern[Index] = XDmaModel_Reg(DevPtr,
+			XZDMA_CH_WR_ONLY_WORD0_OFFSET + (Index * 4U));
+	}
+	XDmaModel_Unlock();
+
+	if ((Ctrl0 & XZDMA_CTRL0_MODE_MASK) == XZDMA_CTRL0_WRONLY_MASK) {
+		for (Index = 0U; Index < Size; Index += ZDMA_WRONLY_BYTES) {
+			(void)memcpy((void *)(Dst + Index), Pattern,
+				((Size - Index) < ZDMA_WRONLY_BYTES) ?
+				(Size - Index) : ZDMA_WRONLY_BYTES);
+		}
+	} else {
+		(void)memcpy((void *)Dst, (const void *)Src, Size);
+	}
+
+	return Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the address word of a descriptor.
+*
+* @param	Dscr is the descriptor.
+*
+* @return	Address.
+*
+******************************************************************************/
+static UINTPTR ZDma_LoadAddr(UINTPTR Dscr)
+{
+	return (UINTPTR)(((u64)XDmaModel_LoadWord(Dscr + 4U) << 32U) |
+		XDmaModel_LoadWord(Dscr));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function processes the channel, one descriptor pair at a time in
+* scatter gather mode.
+*
+* @param	DevPtr is the channel.
+*
+* @return	Non zero if data was moved.
+*
+******************************************************************************/
+static int ZDma_Run(XDmaModel_Dev *DevPtr)
+{
+	ZDmaModel *ModelPtr = DevPtr->Priv;
+	UINTPTR SrcDscr;
+	UINTPTR DstDscr;
+	UINTPTR Src;
+	UINTPTR Dst;
+	u32 LinkedList;
+	u32 Size;
+	u32 Cmd;
+
+	XDmaModel_Lock();
+	if (ModelPtr->Work == 0U) {
+		XDmaModel_Unlock();
+		return 0;
+	}
+	LinkedList = ModelPtr->LinkedList;
+	SrcDscr = ModelPtr->SrcDscr;
+	DstDscr = ModelPtr->DstDscr;
+	if ((XDmaModel_Reg(DevPtr, XZDMA_CH_CTRL0_OFFSET) &
+	     XZDMA_CTRL0_POINT_TYPE_MASK) == 0U) {
+		XDmaModel_Unlock();
+		Size = ZDma_Simple(DevPtr);
+		DevPtr->BytesMoved += Size;
+		XDmaModel_Lock();
+		ZDma_Done(DevPtr, Size, XZDMA_IXR_DMA_DONE_MASK,
+			XZDMA_STS_DONE_MASK);
+		XDmaModel_Unlock();
+		return 1;
+	}
+	XDmaModel_Unlock();
+
+	Src = ZDma_LoadAddr(SrcDscr);
+	Dst = ZDma_LoadAddr(DstDscr);
+	Size = XDmaModel_LoadWord(SrcDscr + ZDMA_DSCR_SIZE_OFFSET) &
+		XZDMA_WORD2_SIZE_MASK;
+	Cmd = XDmaModel_LoadWord(SrcDscr + ZDMA_DSCR_CNTL_OFFSET) &
+		XZDMA_WORD3_CMD_MASK;
+	(void)memcpy((void *)Dst, (const void *)Src, Size);
+	DevPtr->BytesMoved += Size;
+
+	if (LinkedList != 0U) {
+		SrcDscr = ZDma_LoadAddr(SrcDscr + ZDMA_DSCR_NEXT_OFFSET);
+		DstDscr = ZDma_LoadAddr(DstDscr + ZDMA_DSCR_NEXT_OFFSET);
+	} else {
+		SrcDscr += ZDMA_LI_DSCR_SIZE;
+		DstDscr += ZDMA_LI_DSCR_SIZE;
+	}
+
+	XDmaModel_Lock();
+	ModelPtr->SrcDscr = SrcDscr;
+	ModelPtr->DstDscr = DstDscr;
+	if (Cmd == XZDMA_WORD3_CMD_STOP_MASK) {
+		ZDma_Done(DevPtr, Size, XZDMA_IXR_DMA_DONE_MASK,
+			XZDMA_STS_DONE_MASK);
+	} else if (Cmd == XZDMA_WORD3_CMD_PAUSE_MASK) {
+		ZDma_Done(DevPtr, Size, XZDMA_IXR_DMA_PAUSE_MASK,
+			XZDMA_STS_PAUSE_MASK);
+	} else {
+		XDmaModel_Reg(DevPtr, XZDMA_CH_TOTAL_BYTE_OFFSET) += Size;
+	}
+	XDmaModel_Unlock();
+
+	return 1;
+}
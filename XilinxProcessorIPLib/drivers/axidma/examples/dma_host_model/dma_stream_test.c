@@ -0,0 +1,484 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file dma_stream_test.c
+*
+* This file tests the streaming channel layer of xaxidma_stream.h on the host,
+* with the AXI DMA core replaced by the register model of dma_model.h.
+*
+* - Packets are sent on the transmit channel while the receive pool is
+*   smaller than the number of packets, the receive channel must report the
+*   starvation and the transmit channel must not.
+* - The arming of a batch of receive buffers is made to fail from the
+*   handler. XAxiDma_StreamService() must report the failure along with the
+*   batch passed to the handler, and the next call must arm the buffers
+*   again, so every buffer of the pool keeps receiving data.
+* - The freeing of a batch of BDs is made to fail from the handler. The BDs
+*   must be returned to the ring, and the next calls must recycle the BDs
+*   and arm the buffers again.
+* - The received data is checked for every packet.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+*       ag   10/19/26 Make the freeing of a batch of BDs fail
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include "dma_model.h"
+#include "xaxidma_stream.h"
+
+/************************** Constant Definitions *****************************/
+#define PKT_LEN			0x400U	/* Packet and RX buffer length */
+#define NUM_RX_BUFS		8U	/* RX pool */
+#define NUM_PKTS		32U	/* Packets per phase */
+#define BD_SPACE_SIZE		0x1000U	/* BD space of a channel */
+#define POLL_LIMIT		100000000U
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static int Setup(void);
+static int SendPackets(u32 First, u32 Num);
+static int ServiceTx(u32 Num);
+static int ServiceRx(u32 Num, u32 ExpectFailure);
+static void RxHandler(void *CallBackRef, const XAxiDma_StreamBuf *BufPtr,
+		u32 NumBufs);
+static void TxHandler(void *CallBackRef, const XAxiDma_StreamBuf *BufPtr,
+		u32 NumBufs);
+static int RingSetup(XAxiDma_BdRing *RingPtr);
+
+/************************** Variable Definitions *****************************/
+static XDmaModel_Dev *DevPtr;
+static XAxiDma AxiDma;
+static XAxiDma_Stream TxStream;
+static XAxiDma_Stream RxStream;
+static u8 *TxBuf;
+static u8 *RxPool;
+
+static u32 RxCount;		/* Packets received */
+static u32 RxErrors;		/* Packets received with wrong data */
+static u32 RxBufSeen;		/* Bit map of the pool buffers used */
+static u32 TxCount;		/* Packets sent */
+static u32 BreakArm;		/* Make the next arm fail from the handler */
+static XAxiDma_Bd *StolenBd;	/* BD allocated to make the arm fail */
+static u32 BreakFree;		/* Make the next free fail from the handler */
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	XAxiDma_StreamStats *TxStats;
+	XAxiDma_StreamStats *RxStats;
+	u64 Expected;
+	u32 Poll;
+	int Status;
+
+	if ((XDmaModel_Init() != XST_SUCCESS) || (Setup() != XST_SUCCESS)) {
+		printf("Setup failed\r\n");
+		return 1;
+	}
+	TxStats = XAxiDma_StreamGetStats(&TxStream);
+	RxStats = XAxiDma_StreamGetStats(&RxStream);
+
+	/* Phase 1: the pool is filled before the receive side is serviced */
+	Status = SendPackets(0U, NUM_PKTS);
+	if (Status == XST_SUCCESS) {
+		Status = ServiceTx(NUM_PKTS);
+	}
+	Expected = ((u64)NUM_PKTS + NUM_RX_BUFS) * PKT_LEN;
+	for (Poll = 0U; (Poll < POLL_LIMIT) &&
+	     (__atomic_load_n(&DevPtr->BytesMoved, __ATOMIC_RELAXED) <
+	      Expected); Poll++) {
+		;
+	}
+	if (Status == XST_SUCCESS) {
+		Status = ServiceRx(NUM_PKTS, FALSE);
+	}
+	if ((Status != XST_SUCCESS) || (RxStats->Starved == 0U) ||
+	    (TxStats->Starved != 0U)) {
+		printf("Phase 1 failed, RX starved %u, TX starved %u\r\n",
+			RxStats->Starved, TxStats->Starved);
+		return 1;
+	}
+	printf("Phase 1: %u packets, RX starved %u, TX starved %u\r\n",
+		RxCount, RxStats->Starved, TxStats->Starved);
+
+	/* Phase 2: the arming of one batch fails */
+	BreakArm = TRUE;
+	Status = SendPackets(NUM_PKTS, NUM_PKTS);
+	if (Status == XST_SUCCESS) {
+		Status = ServiceTx(NUM_PKTS);
+	}
+	if (Status == XST_SUCCESS) {
+		Status = ServiceRx(NUM_PKTS, TRUE);
+	}
+	if ((Status != XST_SUCCESS) || (RxStats->RecycleErrors != 1U)) {
+		printf("Phase 2 failed, recycle errors %u\r\n",
+			RxStats->RecycleErrors);
+		return 1;
+	}
+	printf("Phase 2: %u packets, recycle errors %u\r\n", RxCount,
+		RxStats->RecycleErrors);
+
+	/* Phase 3: every buffer of the pool is still armed */
+	RxBufSeen = 0U;
+	Status = SendPackets(2U * NUM_PKTS, NUM_PKTS);
+	if (Status == XST_SUCCESS) {
+		Status = ServiceTx(NUM_PKTS);
+	}
+	if (Status == XST_SUCCESS) {
+		Status = ServiceRx(NUM_PKTS, FALSE);
+	}
+	if ((Status != XST_SUCCESS) ||
+	    (RxBufSeen != ((1U << NUM_RX_BUFS) - 1U))) {
+		printf("Phase 3 failed, buffers used 0x%x\r\n", RxBufSeen);
+		return 1;
+	}
+	printf("Phase 3: %u packets, buffers used 0x%x\r\n", RxCount,
+		RxBufSeen);
+
+	/* Phase 4: the freeing of one batch of BDs fails */
+	BreakFree = TRUE;
+	Status = SendPackets(3U * NUM_PKTS, NUM_PKTS);
+	if (Status == XST_SUCCESS) {
+		Status = ServiceTx(NUM_PKTS);
+	}
+	if (Status == XST_SUCCESS) {
+		Status = ServiceRx(NUM_PKTS, TRUE);
+	}
+	if ((Status != XST_SUCCESS) || (RxStats->RecycleErrors != 2U)) {
+		printf("Phase 4 failed, recycle errors %u\r\n",
+			RxStats->RecycleErrors);
+		return 1;
+	}
+	printf("Phase 4: %u packets, recycle errors %u\r\n", RxCount,
+		RxStats->RecycleErrors);
+
+	/* Phase 5: no BD is lost, every buffer of the pool is still armed */
+	RxBufSeen = 0U;
+	Status = SendPackets(4U * NUM_PKTS, NUM_PKTS);
+	if (Status == XST_SUCCESS) {
+		Status = ServiceTx(NUM_PKTS);
+	}
+	if (Status == XST_SUCCESS) {
+		Status = ServiceRx(NUM_PKTS, FALSE);
+	}
+	if ((Status != XST_SUCCESS) ||
+	    (RxBufSeen != ((1U << NUM_RX_BUFS) - 1U)) ||
+	    (RxStream.RingPtr->PostCnt != 0) ||
+	    (RxStream.RingPtr->HwCnt != (int)NUM_RX_BUFS)) {
+		printf("Phase 5 failed, buffers used 0x%x, BDs post %d hw %d"
+			"\r\n", RxBufSeen, RxStream.RingPtr->PostCnt,
+			RxStream.RingPtr->HwCnt);
+		return 1;
+	}
+	printf("Phase 5: %u packets, buffers used 0x%x\r\n", RxCount,
+		RxBufSeen);
+
+	XDmaModel_Shutdown();
+
+	if ((RxErrors != 0U) || (RxCount != (5U * NUM_PKTS)) ||
+	    (TxCount != (5U * NUM_PKTS)) || (RxStats->Errors != 0U)) {
+		printf("Stream test failed, %u data errors\r\n", RxErrors);
+		return 1;
+	}
+
+	printf("Successfully ran stream test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up the core and the two streaming channels.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int Setup(void)
+{
+	XAxiDma_Config Config;
+	int Status;
+
+	DevPtr = XDmaModel_AxiDmaCreate();
+	TxBuf = XDmaModel_Alloc(PKT_LEN * NUM_PKTS, 64U);
+	RxPool = XDmaModel_Alloc(PKT_LEN * NUM_RX_BUFS, 64U);
+	if ((DevPtr == NULL) || (TxBuf == NULL) || (RxPool == NULL)) {
+		return XST_FAILURE;
+	}
+
+	memset(&Config, 0, sizeof(Config));
+	Config.BaseAddr = (UINTPTR)DevPtr->Regs;
+	Config.HasMm2S = 1;
+	Config.Mm2SDataWidth = 32;
+	Config.Mm2SBurstSize = 16;
+	Config.HasS2Mm = 1;
+	Config.S2MmDataWidth = 32;
+	Config.S2MmBurstSize = 16;
+	Config.HasSg = 1;
+	Config.Mm2sNumChannels = 1;
+	Config.S2MmNumChannels = 1;
+	Config.AddrWidth = 32;
+	Config.SgLengthWidth = 23;
+
+	Status = XAxiDma_CfgInitialize(&AxiDma, &Config);
+	if (Status == XST_SUCCESS) {
+		Status = RingSetup(XAxiDma_GetTxRing(&AxiDma));
+	}
+	if (Status == XST_SUCCESS) {
+		Status = RingSetup(XAxiDma_GetRxRing(&AxiDma));
+	}
+	if (Status == XST_SUCCESS) {
+		Status = XAxiDma_StreamTxInit(&TxStream,
+				XAxiDma_GetTxRing(&AxiDma));
+	}
+	if (Status == XST_SUCCESS) {
+		Status = XAxiDma_StreamRxInit(&RxStream,
+				XAxiDma_GetRxRing(&AxiDma), (UINTPTR)RxPool,
+				PKT_LEN, NUM_RX_BUFS);
+	}
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XAxiDma_StreamSetHandler(&TxStream, TxHandler, NULL);
+	XAxiDma_StreamSetHandler(&RxStream, RxHandler, NULL);
+
+	Status = XAxiDma_StreamStart(&RxStream);
+	if (Status == XST_SUCCESS) {
+		Status = XAxiDma_StreamStart(&TxStream);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the BD ring of a channel.
+*
+* @param	RingPtr is the BD ring of the channel.
+*
+* @return	XST_SUCCESS if the ring is created, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int RingSetup(XAxiDma_BdRing *RingPtr)
+{
+	UINTPTR BdSpace;
+
+	BdSpace = (UINTPTR)XDmaModel_Alloc(BD_SPACE_SIZE,
+			XAXIDMA_BD_MINIMUM_ALIGNMENT);
+	if (BdSpace == 0U) {
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdRingIntDisable(RingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	return XAxiDma_BdRingCreate(RingPtr, BdSpace, BdSpace,
+			XAXIDMA_BD_MINIMUM_ALIGNMENT,
+			XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+				BD_SPACE_SIZE));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends packets, the data of packet N is the pattern N.
+*
+* @param	First is the number of the first packet.
+* @param	Num is the number of packets.
+*
+* @return	XST_SUCCESS if the packets are queued, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int SendPackets(u32 First, u32 Num)
+{
+	u8 *PktPtr;
+	u32 Pkt;
+	u32 Index;
+
+	for (Pkt = 0U; Pkt < Num; Pkt++) {
+		PktPtr = TxBuf + (Pkt * PKT_LEN);
+		for (Index = 0U; Index < PKT_LEN; Index++) {
+			PktPtr[Index] = (u8)(First + Pkt + Index);
+		}
+		if (XAxiDma_StreamSend(&TxStream, (UINTPTR)PktPtr, PKT_LEN) !=
+		    XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services the transmit channel until Num more packets are
+* sent.
+*
+* @param	Num is the number of packets.
+*
+* @return	XST_SUCCESS if the packets are sent, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int ServiceTx(u32 Num)
+{
+	u32 Target = TxCount + Num;
+	u32 Poll;
+
+	for (Poll = 0U; (Poll < POLL_LIMIT) && (TxCount < Target); Poll++) {
+		if (XAxiDma_StreamService(&TxStream, NULL) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return (TxCount == Target) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services the receive channel until Num more packets are
+* received.
+*
+* @param	Num is the number of packets.
+* @param	ExpectFailure is TRUE when exactly one service call must fail.
+*
+* @return	XST_SUCCESS if the packets are received and the service calls
+*		returned the expected status, XST_FAILURE otherwise.
+*
+******************************************************************************/
+static int ServiceRx(u32 Num, u32 ExpectFailure)
+{
+	u32 Target = RxCount + Num;
+	u32 Failures = 0U;
+	u32 Before;
+	u32 NumBufs;
+	u32 Poll;
+	int Status;
+
+	for (Poll = 0U; (Poll < POLL_LIMIT) && (RxCount < Target); Poll++) {
+		Before = RxCount;
+		Status = XAxiDma_StreamService(&RxStream, &NumBufs);
+		if (NumBufs != (RxCount - Before)) {
+			printf("Service reported %u buffers, handler got %u\r\n",
+				NumBufs, RxCount - Before);
+			return XST_FAILURE;
+		}
+		if (Status != XST_SUCCESS) {
+			Failures++;
+			if (RxStream.NumUnarmed == 0U) {
+				return XST_FAILURE;
+			}
+			/* Give the BD back, the next call arms the buffers */
+			if (StolenBd != NULL) {
+				(void)XAxiDma_BdRingUnAlloc(RxStream.RingPtr,
+						1, StolenBd);
+				StolenBd = NULL;
+			}
+		}
+	}
+
+	if ((RxCount != Target) ||
+	    (Failures != ((ExpectFailure != FALSE) ? 1U : 0U))) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the handler of the receive channel, it checks the data.
+* When BreakArm is set, it allocates a BD so that the arming of the batch by
+* XAxiDma_StreamService() fails. When BreakFree is set, it frees the first BD
+* of the batch so that the freeing of the batch by XAxiDma_StreamService()
+* fails.
+*
+* @param	CallBackRef is not used.
+* @param	BufPtr is the batch of buffers.
+* @param	NumBufs is the number of buffers.
+*
+* @return	None.
+*
+******************************************************************************/
+static void RxHandler(void *CallBackRef, const XAxiDma_StreamBuf *BufPtr,
+		u32 NumBufs)
+{
+	const u8 *DataPtr;
+	u32 Buf;
+	u32 Index;
+
+	(void)CallBackRef;
+
+	for (Buf = 0U; Buf < NumBufs; Buf++) {
+		DataPtr = (const u8 *)BufPtr[Buf].BufAddr;
+		RxBufSeen |= 1U << ((BufPtr[Buf].BufAddr - (UINTPTR)RxPool) /
+				    PKT_LEN);
+		if (BufPtr[Buf].Length != PKT_LEN) {
+			RxErrors++;
+		}
+		for (Index = 0U; Index < PKT_LEN; Index++) {
+			if (DataPtr[Index] != (u8)(RxCount + Index)) {
+				RxErrors++;
+				break;
+			}
+		}
+		RxCount++;
+	}
+
+	if (BreakArm != FALSE) {
+		BreakArm = FALSE;
+		(void)XAxiDma_BdRingAlloc(RxStream.RingPtr, 1, &StolenBd);
+	}
+
+	if (BreakFree != FALSE) {
+		BreakFree = FALSE;
+		(void)XAxiDma_BdRingFree(RxStream.RingPtr, 1,
+				RxStream.RingPtr->PostHead);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the handler of the transmit channel.
+*
+* @param	CallBackRef is not used.
+* @param	BufPtr is the batch of buffers.
+* @param	NumBufs is the number of buffers.
+*
+* @return	None.
+*
+******************************************************************************/
+static void TxHandler(void *CallBackRef, const XAxiDma_StreamBuf *BufPtr,
+		u32 NumBufs)
+{
+	(void)CallBackRef;
+	(void)BufPtr;
+
+	TxCount += NumBufs;
+}
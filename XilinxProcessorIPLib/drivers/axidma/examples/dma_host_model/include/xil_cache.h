@@ -0,0 +1,24 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache.h
+*
+* This file declares the cache maintenance functions used by the drivers.
+* The host model is cache coherent, the functions do nothing.
+*
+******************************************************************************/
+#ifndef DMA_MODEL_XIL_CACHE_H_
+#define DMA_MODEL_XIL_CACHE_H_
+
+#include "xil_types.h"
+
+void Xil_DCacheFlushRange(INTPTR Addr, INTPTR Len);
+void Xil_DCacheInvalidateRange(INTPTR Addr, INTPTR Len);
+void Xil_DCacheFlush(void);
+
+#endif /* DMA_MODEL_XIL_CACHE_H_ */
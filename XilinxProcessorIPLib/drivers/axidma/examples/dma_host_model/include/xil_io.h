@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* This file routes the 32 bit register accesses of the drivers to the host
+* register model. The BSP header is included first, the macros below then
+* replace Xil_In32() and Xil_Out32() in the driver sources.
+*
+******************************************************************************/
+#ifndef DMA_MODEL_XIL_IO_H_
+#define DMA_MODEL_XIL_IO_H_
+
+#include_next "xil_io.h"
+
+u32 XDmaModel_In32(UINTPTR Addr);
+void XDmaModel_Out32(UINTPTR Addr, u32 Value);
+
+#define Xil_In32	XDmaModel_In32
+#define Xil_Out32	XDmaModel_Out32
+
+#endif /* DMA_MODEL_XIL_IO_H_ */
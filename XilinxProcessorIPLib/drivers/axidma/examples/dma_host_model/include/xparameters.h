@@ -0,0 +1,18 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* The host model has no generated hardware parameters, the configuration of
+* the cores is built by the benchmark.
+*
+******************************************************************************/
+#ifndef DMA_MODEL_XPARAMETERS_H_
+#define DMA_MODEL_XPARAMETERS_H_
+
+#endif /* DMA_MODEL_XPARAMETERS_H_ */
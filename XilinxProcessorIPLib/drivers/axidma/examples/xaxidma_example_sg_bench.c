@@ -0,0 +1,463 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xaxidma_example_sg_bench.c
+ *
+ * This file measures the processor time spent in the xaxidma driver to
+ * submit and retire packets on the Xilinx AXI DMA core (AXIDMA) configured
+ * in Scatter Gather Mode.
+ *
+ * For every submission pattern, packets are submitted in batches of
+ * BatchSize BDs per XAxiDma_BdRingToHw call on both the channels and retired
+ * with XAxiDma_BdRingFromHw/XAxiDma_BdRingFree in polling mode. Only the time
+ * spent in the driver calls is accounted, the time spent waiting for the
+ * hardware is not. The results are reported as driver time per BD and per
+ * MB transferred.
+ *
+ * This code assumes a loopback hardware widget is connected to the AXI DMA
+ * core for data packet loopback. The global timer of the ARM processors is
+ * used for the measurements, so the example is supported only on ARM.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 9.14  ag   10/19/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+/***************************** Include Files *********************************/
+#include "xaxidma.h"
+#include "xparameters.h"
+#include "xdebug.h"
+#include "xtime_l.h"
+
+#ifdef __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#if (!defined(DEBUG))
+extern void xil_printf(const char *format, ...);
+#endif
+
+/******************** Constant Definitions **********************************/
+
+/*
+ * Device hardware build related constants.
+ */
+
+#define DMA_DEV_ID		XPAR_AXIDMA_0_DEVICE_ID
+
+#ifdef XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif defined (XPAR_MIG7SERIES_0_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_MIG7SERIES_0_BASEADDR
+#elif defined (XPAR_MIG_0_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_MIG_0_BASEADDR
+#elif defined (XPAR_PSU_DDR_0_S_AXI_BASEADDR)
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#endif
+
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR		0x01000000
+#else
+#define MEM_BASE_ADDR		(DDR_BASE_ADDR + 0x1000000)
+#endif
+
+#define TX_BD_SPACE_BASE	(MEM_BASE_ADDR)
+#define TX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x00000FFF)
+#define RX_BD_SPACE_BASE	(MEM_BASE_ADDR + 0x00001000)
+#define RX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x00001FFF)
+#define TX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00100000)
+#define RX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00300000)
+#define RX_BUFFER_HIGH		(MEM_BASE_ADDR + 0x004FFFFF)
+
+#define MAX_PKT_LEN		0x400
+#define MARK_UNCACHEABLE        0x701
+
+/*
+ * Number of batches submitted for every pattern
+ */
+#define NUMBER_OF_BATCHES	256
+
+/*
+ * Submission patterns, BDs submitted per XAxiDma_BdRingToHw call. The
+ * biggest batch must fit in the BD space of a channel.
+ */
+#define NUMBER_OF_PATTERNS	4
+#define MAX_BATCH_SIZE		32
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * Driver time accounted for a submission pattern
+ */
+typedef struct {
+	XTime SubmitTime;	/* Time in Alloc, BD setup and ToHw */
+	XTime RetireTime;	/* Time in FromHw and Free */
+	u32 NumBds;		/* Number of BDs submitted on a channel */
+} BenchResult;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+static int RingSetup(XAxiDma_BdRing *RingPtr, UINTPTR BdSpaceBase,
+		UINTPTR BdSpaceHigh);
+static int SubmitBatch(XAxiDma_BdRing *RingPtr, UINTPTR BufAddr,
+		int BatchSize, u32 Ctrl);
+static int RetireBatch(XAxiDma_BdRing *RingPtr, int BatchSize,
+		XTime *RetireTime);
+static int RunPattern(XAxiDma * AxiDmaInstPtr, int BatchSize,
+		BenchResult *Result);
+static void PrintResult(int BatchSize, const BenchResult *Result);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XAxiDma AxiDma;
+
+/*
+ * Number of BDs submitted per XAxiDma_BdRingToHw call in every pattern
+ */
+static const int BatchSizes[NUMBER_OF_PATTERNS] = {1, 4, 16, MAX_BATCH_SIZE};
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function sets up the DMA engine and runs every submission pattern.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if benchmark completes
+*		- XST_FAILURE if benchmark fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	int Index;
+	XAxiDma_Config *Config;
+	BenchResult Result;
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+
+#ifdef __aarch64__
+	Xil_SetTlbAttributes(TX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+	Xil_SetTlbAttributes(RX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+#endif
+
+	Config = XAxiDma_LookupConfig(DMA_DEV_ID);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", DMA_DEV_ID);
+
+		return XST_FAILURE;
+	}
+
+	/* Initialize DMA engine */
+	Status = XAxiDma_CfgInitialize(&AxiDma, Config);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	if(!XAxiDma_HasSg(&AxiDma)) {
+		xil_printf("Device configured as Simple mode \r\n");
+
+		return XST_FAILURE;
+	}
+
+	Status = RingSetup(XAxiDma_GetTxRing(&AxiDma), TX_BD_SPACE_BASE,
+			TX_BD_SPACE_HIGH);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = RingSetup(XAxiDma_GetRxRing(&AxiDma), RX_BD_SPACE_BASE,
+			RX_BD_SPACE_HIGH);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	xil_printf("Packet length %d bytes, %d batches per pattern\r\n",
+		MAX_PKT_LEN, NUMBER_OF_BATCHES);
+	xil_printf("BDs/ToHw  Submit ns/BD  Retire ns/BD  Driver us/MB\r\n");
+
+	for (Index = 0; Index < NUMBER_OF_PATTERNS; Index++) {
+		Status = RunPattern(&AxiDma, BatchSizes[Index], &Result);
+		if (Status != XST_SUCCESS) {
+			xil_printf("AXI DMA SG Benchmark Example Failed\r\n");
+			return XST_FAILURE;
+		}
+		PrintResult(BatchSizes[Index], &Result);
+	}
+
+	xil_printf("Successfully ran AXI DMA SG Benchmark Example\r\n");
+	xil_printf("--- Exiting main() --- \r\n");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function creates the BD ring of a channel and starts the channel.
+*
+* @param	RingPtr is the pointer to the BD ring of the channel.
+* @param	BdSpaceBase is the start address of the BD space.
+* @param	BdSpaceHigh is the end address of the BD space.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RingSetup(XAxiDma_BdRing *RingPtr, UINTPTR BdSpaceBase,
+		UINTPTR BdSpaceHigh)
+{
+	XAxiDma_Bd BdTemplate;
+	int Status;
+	u32 BdCount;
+
+	XAxiDma_BdRingIntDisable(RingPtr, XAXIDMA_IRQ_ALL_MASK);
+	XAxiDma_BdRingSetCoalesce(RingPtr, 1, 0);
+
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+				BdSpaceHigh - BdSpaceBase + 1);
+	if (BdCount < MAX_BATCH_SIZE) {
+		xil_printf("BD space too small for %d BDs\r\n", MAX_BATCH_SIZE);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingCreate(RingPtr, BdSpaceBase, BdSpaceBase,
+				XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Create BD ring failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Clone BD failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingStart(RingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Start BD ring failed %d\r\n", Status);
+
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function allocates, sets up and submits a batch of single packet BDs
+* to a channel.
+*
+* @param	RingPtr is the pointer to the BD ring of the channel.
+* @param	BufAddr is the address of the buffer of the first packet.
+* @param	BatchSize is the number of BDs to be submitted.
+* @param	Ctrl is the control word of every BD.
+*
+* @return	XST_SUCCESS if the BDs are submitted, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SubmitBatch(XAxiDma_BdRing *RingPtr, UINTPTR BufAddr,
+		int BatchSize, u32 Ctrl)
+{
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	int Status;
+	int Index;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, BatchSize, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0; Index < BatchSize; Index++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, BufAddr);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = XAxiDma_BdSetLength(BdCurPtr, MAX_PKT_LEN,
+				RingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		XAxiDma_BdSetCtrl(BdCurPtr, Ctrl);
+		XAxiDma_BdSetId(BdCurPtr, BufAddr);
+
+		BufAddr += MAX_PKT_LEN;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	return XAxiDma_BdRingToHw(RingPtr, BatchSize, BdPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires a batch of BDs from a channel. Polls which do not
+* return any BD are not accounted in the retire time.
+*
+* @param	RingPtr is the pointer to the BD ring of the channel.
+* @param	BatchSize is the number of BDs to be retired.
+* @param	RetireTime is incremented by the driver time to retire the BDs.
+*
+* @return	XST_SUCCESS if the BDs are retired, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RetireBatch(XAxiDma_BdRing *RingPtr, int BatchSize,
+		XTime *RetireTime)
+{
+	XAxiDma_Bd *BdPtr;
+	XTime Start;
+	XTime End;
+	int ProcessedBdCount;
+	int Status;
+
+	while (BatchSize > 0) {
+		XTime_GetTime(&Start);
+		ProcessedBdCount = XAxiDma_BdRingFromHw(RingPtr,
+				XAXIDMA_ALL_BDS, &BdPtr);
+		if (ProcessedBdCount == 0) {
+			continue;
+		}
+
+		Status = XAxiDma_BdRingFree(RingPtr, ProcessedBdCount, BdPtr);
+		XTime_GetTime(&End);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Failed to free %d BDs %d\r\n",
+			    ProcessedBdCount, Status);
+			return XST_FAILURE;
+		}
+
+		*RetireTime += End - Start;
+		BatchSize -= ProcessedBdCount;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs one submission pattern and accounts the driver time.
+*
+* @param	AxiDmaInstPtr points to the DMA engine instance.
+* @param	BatchSize is the number of BDs submitted per ToHw call.
+* @param	Result is updated with the accounted driver time.
+*
+* @return	XST_SUCCESS if all the batches are transferred,
+*		XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RunPattern(XAxiDma * AxiDmaInstPtr, int BatchSize,
+		BenchResult *Result)
+{
+	XAxiDma_BdRing *TxRingPtr = XAxiDma_GetTxRing(AxiDmaInstPtr);
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(AxiDmaInstPtr);
+	XTime Start;
+	XTime End;
+	int Batch;
+	int Status;
+
+	Result->SubmitTime = 0;
+	Result->RetireTime = 0;
+	Result->NumBds = 0;
+
+	Xil_DCacheFlushRange((UINTPTR)TX_BUFFER_BASE, MAX_PKT_LEN * BatchSize);
+	Xil_DCacheFlushRange((UINTPTR)RX_BUFFER_BASE, MAX_PKT_LEN * BatchSize);
+
+	for (Batch = 0; Batch < NUMBER_OF_BATCHES; Batch++) {
+		XTime_GetTime(&Start);
+		Status = SubmitBatch(RxRingPtr, RX_BUFFER_BASE, BatchSize, 0);
+		if (Status == XST_SUCCESS) {
+			Status = SubmitBatch(TxRingPtr, TX_BUFFER_BASE,
+				BatchSize, XAXIDMA_BD_CTRL_TXEOF_MASK |
+				XAXIDMA_BD_CTRL_TXSOF_MASK);
+		}
+		XTime_GetTime(&End);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Submit of %d BDs failed %d\r\n",
+				BatchSize, Status);
+			return XST_FAILURE;
+		}
+		Result->SubmitTime += End - Start;
+
+		Status = RetireBatch(TxRingPtr, BatchSize, &Result->RetireTime);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = RetireBatch(RxRingPtr, BatchSize, &Result->RetireTime);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Result->NumBds += BatchSize;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the driver time accounted for a submission pattern.
+* The time per BD is for one BD on each channel, that is one packet.
+*
+* @param	BatchSize is the number of BDs submitted per ToHw call.
+* @param	Result is the accounted driver time.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void PrintResult(int BatchSize, const BenchResult *Result)
+{
+	u64 SubmitNs = ((u64)Result->SubmitTime * 1000000000U) /
+			(COUNTS_PER_SECOND * (u64)Result->NumBds);
+	u64 RetireNs = ((u64)Result->RetireTime * 1000000000U) /
+			(COUNTS_PER_SECOND * (u64)Result->NumBds);
+	u64 Bytes = (u64)Result->NumBds * MAX_PKT_LEN;
+	u64 UsPerMb = (((u64)(Result->SubmitTime + Result->RetireTime) *
+			1000000U) / COUNTS_PER_SECOND) * 0x100000U / Bytes;
+
+	xil_printf("%8d  %12d  %12d  %12d\r\n", BatchSize, (u32)SubmitNs,
+		(u32)RetireNs, (u32)UsPerMb);
+}
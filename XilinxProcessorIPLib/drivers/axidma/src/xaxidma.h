@@ -137,6 +137,12 @@
 * memory needed for a certain number of BDs. XAxiDma_BdRingCntCalc() can be
 * used to find out how many BDs can be allocated for certain amount of memory.
 *
+* Alternatively, XAxiDma_BdRingCreatePool() allocates the BD ring from the
+* non-cacheable DMA descriptor memory of the BSP (xil_dmamem.h), which is
+* shared with the other DMA drivers, and XAxiDma_BdRingDestroyPool() releases
+* it. These functions are in xaxidma_bdring_pool.c, so the descriptor memory
+* is linked only into the applications which call them.
+*
 * A helper function, XAxiDma_BdRingClone(), can speed up the BD ring setup if
 * the BDs have same types of controls, for example, SOF and EOF. After
 * using the XAxiDma_BdRingClone(), the application only needs to setup the
@@ -279,6 +285,13 @@
 * be flushed from the cache before passing the associated BD to this driver.
 * Buffers for receive MUST be invalidated before accessing the data.
 *
+* <b> Streaming Channels </b>
+*
+* For continuous streaming, xaxidma_stream.h provides a layer on top of the
+* BD ring API which owns a BD ring, re-arms a fixed pool of receive buffers,
+* does the cache maintenance of the data buffers and reports the completed
+* buffers to a handler in batches, along with per channel statistics.
+*
 * <b> Alignment </b>
 *
 * For BDs:
@@ -452,6 +465,11 @@
 *                     In XAxiDma_LookupConfigBaseAddr() use UINTPTR for Baseaddr.
 * 9.7  rsp   04/25/18 Add SgLengthWidth member in dma config structure. CR #1000474
 * 9.13 rsp   01/08/21 Fix compilation failure in XAxiDma_IntrGetEnabled().
+* 9.14 ag    10/19/26 Added the streaming channel layer in xaxidma_stream.c,
+*                     which recycles the BDs of a ring and reports the
+*                     completed buffers in batches.
+*      ag    10/19/26 Added XAxiDma_BdRingCreatePool() to allocate the BD
+*                     ring from the BSP DMA descriptor memory.
 * </pre>
 *
 ******************************************************************************/
@@ -44,6 +44,10 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.14  ag   10/19/26  Added XAxiDma_BdRingCreatePool() and
+*                      XAxiDma_BdRingDestroyPool().
+*       ag   10/19/26  Moved XAxiDma_BdRingCreatePool() and
+*                      XAxiDma_BdRingDestroyPool() to xaxidma_bdring_pool.c.
 *
 * </pre>
 ******************************************************************************/
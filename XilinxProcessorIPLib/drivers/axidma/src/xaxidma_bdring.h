@@ -43,6 +43,8 @@
 *		       backward compatibility.
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
+* 9.14  ag   10/19/26  Added XAxiDma_BdRingCreatePool() and
+*                      XAxiDma_BdRingDestroyPool().
 *
 * </pre>
 *
@@ -492,6 +494,8 @@ int XAxiDma_StartBdRingHw(XAxiDma_BdRing* RingPtr);
 int XAxiDma_UpdateBdRingCDesc(XAxiDma_BdRing* RingPtr);
 u32 XAxiDma_BdRingCreate(XAxiDma_BdRing * RingPtr, UINTPTR PhysAddr,
 		UINTPTR VirtAddr, u32 Alignment, int BdCount);
+u32 XAxiDma_BdRingCreatePool(XAxiDma_BdRing *RingPtr, int BdCount);
+int XAxiDma_BdRingDestroyPool(XAxiDma_BdRing *RingPtr);
 int XAxiDma_BdRingClone(XAxiDma_BdRing * RingPtr, XAxiDma_Bd * SrcBdPtr);
 int XAxiDma_BdRingAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_Bd ** BdSetPtr);
@@ -0,0 +1,119 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_bdring_pool.c
+* @addtogroup axidma_v9_13
+* @{
+*
+* This file implements the creation of BD rings in the DMA descriptor memory
+* of the BSP. It is kept apart from xaxidma_bdring.c so that the descriptor
+* memory is linked only into the applications which use these functions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release, moved from xaxidma_bdring.c
+*
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma.h"
+#include "xil_dmamem.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * This function creates and setup the BD ring in memory allocated from the
+ * DMA descriptor memory of the BSP, see xil_dmamem.h. The memory is shared
+ * with the other DMA drivers and is non-cacheable, so no descriptor array
+ * needs to be reserved by the application.
+ *
+ * @param	RingPtr is the BD ring instance to be worked on.
+ * @param	BdCount is the number of BDs of the ring. The minimum valid
+ *		value for this parameter is 1.
+ *
+ * @return
+ *		- XST_SUCCESS if initialization was successful
+ *		- XST_FAILURE if the descriptor memory is exhausted
+ *		- Status of XAxiDma_BdRingCreate() otherwise
+ *
+ * @note	This function can be used only when DMA is in SG mode.
+ *		The memory is released with XAxiDma_BdRingDestroyPool().
+ *
+ *****************************************************************************/
+u32 XAxiDma_BdRingCreatePool(XAxiDma_BdRing *RingPtr, int BdCount)
+{
+	void *MemPtr;
+	u32 Status;
+
+	if (BdCount <= 0) {
+		return XST_INVALID_PARAM;
+	}
+
+	MemPtr = Xil_DmaMemAlloc((u32)XAxiDma_BdRingMemCalc(
+			XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount),
+			XIL_DMAMEM_ALIGN_AXIDMA);
+	if (MemPtr == NULL) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingCreatePool: no memory"
+				" for %d BDs\r\n", BdCount);
+
+		return XST_FAILURE;
+	}
+
+	Status = XAxiDma_BdRingCreate(RingPtr, (UINTPTR)MemPtr,
+			(UINTPTR)MemPtr, XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		(void)Xil_DmaMemFree(MemPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function releases the memory of a BD ring created with
+ * XAxiDma_BdRingCreatePool(). The channel must be stopped, by a reset of the
+ * DMA engine, before the ring is destroyed.
+ *
+ * @param	RingPtr is the BD ring instance to be worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the memory is released
+ *		- XST_INVALID_PARAM if the ring was not created from the
+ *		descriptor memory
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingDestroyPool(XAxiDma_BdRing *RingPtr)
+{
+	if (Xil_DmaMemFree((void *)RingPtr->FirstBdAddr) != XST_SUCCESS) {
+		return XST_INVALID_PARAM;
+	}
+
+	RingPtr->AllCnt = 0;
+	RingPtr->FreeCnt = 0;
+	RingPtr->HwCnt = 0;
+	RingPtr->PreCnt = 0;
+	RingPtr->PostCnt = 0;
+	RingPtr->RunState = AXIDMA_CHANNEL_HALTED;
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -0,0 +1,523 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_stream.c
+* @addtogroup axidma_v9_14
+* @{
+*
+* This file implements the streaming channel layer of the AXI DMA driver.
+* Please see xaxidma_stream.h for more details.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+*       ag   10/19/26 Report the BD recycling errors, keep the receive
+*                     buffers which could not be armed again and count
+*                     only the receive starvation
+*       ag   10/19/26 Return the retrieved BDs to the free group when they
+*                     could not be freed
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma_stream.h"
+
+/************************** Function Prototypes ******************************/
+
+static UINTPTR XAxiDma_StreamBdBufAddr(XAxiDma_Bd *BdPtr);
+static int XAxiDma_StreamRxArm(XAxiDma_Stream *StreamPtr,
+		const XAxiDma_StreamBuf *BufPtr, u32 NumBufs);
+static void XAxiDma_StreamUpdateOccupancy(XAxiDma_Stream *StreamPtr);
+
+/*****************************************************************************/
+/**
+* Initialize a receive streaming channel. The BD ring is cloned from an empty
+* template, and every buffer of the pool is attached to a BD and committed to
+* the hardware. The channel is started with XAxiDma_StreamStart().
+*
+* @param	StreamPtr is a pointer to the streaming channel to initialize.
+* @param	RingPtr is the RX BD ring, already created with
+*		XAxiDma_BdRingCreate().
+* @param	BufBase is the base address of the buffer pool.
+* @param	BufSize is the size in bytes of each buffer of the pool.
+* @param	NumBufs is the number of buffers in the pool.
+*
+* @return
+*		- XST_SUCCESS if the channel is initialized.
+*		- XST_INVALID_PARAM if the ring is not a receive ring, or if
+*		  the buffers don't fit in the ring or the BD length field.
+*		- XST_FAILURE if the BDs could not be setup.
+*
+*****************************************************************************/
+int XAxiDma_StreamRxInit(XAxiDma_Stream *StreamPtr, XAxiDma_BdRing *RingPtr,
+		UINTPTR BufBase, u32 BufSize, u32 NumBufs)
+{
+	XAxiDma_Bd BdTemplate;
+	u32 Index;
+	u32 Count;
+	u32 i;
+	int Status;
+
+	if ((StreamPtr == NULL) || (RingPtr == NULL) ||
+	    (RingPtr->IsRxChannel == 0) || (NumBufs == 0U) ||
+	    (NumBufs > (u32)XAxiDma_BdRingGetFreeCnt(RingPtr)) ||
+	    (BufSize == 0U) || (BufSize > RingPtr->MaxTransferLen)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(StreamPtr, 0, sizeof(XAxiDma_Stream));
+	StreamPtr->RingPtr = RingPtr;
+	StreamPtr->BufBase = BufBase;
+	StreamPtr->BufSize = BufSize;
+	StreamPtr->NumBufs = NumBufs;
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Arm the pool in batches, the batch array holds the addresses */
+	for (Index = 0U; Index < NumBufs; Index += Count) {
+		Count = NumBufs - Index;
+		if (Count > XAXIDMA_STREAM_BATCH_SIZE) {
+			Count = XAXIDMA_STREAM_BATCH_SIZE;
+		}
+
+		for (i = 0U; i < Count; i++) {
+			StreamPtr->Batch[i].BufAddr = BufBase +
+					((UINTPTR)(Index + i) * BufSize);
+		}
+
+		Status = XAxiDma_StreamRxArm(StreamPtr, StreamPtr->Batch,
+					     Count);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Initialize a transmit streaming channel. The BD ring is cloned from an
+* empty template. The channel is started with XAxiDma_StreamStart().
+*
+* @param	StreamPtr is a pointer to the streaming channel to initialize.
+* @param	RingPtr is the TX BD ring, already created with
+*		XAxiDma_BdRingCreate().
+*
+* @return
+*		- XST_SUCCESS if the channel is initialized.
+*		- XST_INVALID_PARAM if the ring is not a transmit ring.
+*		- XST_FAILURE if the BDs could not be setup.
+*
+*****************************************************************************/
+int XAxiDma_StreamTxInit(XAxiDma_Stream *StreamPtr, XAxiDma_BdRing *RingPtr)
+{
+	XAxiDma_Bd BdTemplate;
+	int Status;
+
+	if ((StreamPtr == NULL) || (RingPtr == NULL) ||
+	    (RingPtr->IsRxChannel != 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(StreamPtr, 0, sizeof(XAxiDma_Stream));
+	StreamPtr->RingPtr = RingPtr;
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Set the handler called with the buffers completed by the hardware.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+* @param	Handler is the completion handler, NULL to only recycle the
+*		BDs.
+* @param	CallBackRef is the argument passed to the handler.
+*
+* @return	None.
+*
+*****************************************************************************/
+void XAxiDma_StreamSetHandler(XAxiDma_Stream *StreamPtr,
+		XAxiDma_StreamHandler Handler, void *CallBackRef)
+{
+	StreamPtr->Handler = Handler;
+	StreamPtr->CallBackRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+* Set the interrupt coalescing parameters of the streaming channel. The
+* handler is then called once per Counter completed BDs, or when the delay
+* timer expires.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+* @param	Counter is the coalescing threshold, see
+*		XAxiDma_BdRingSetCoalesce().
+* @param	Timer is the delay timer, see XAxiDma_BdRingSetCoalesce().
+*
+* @return	Status returned by XAxiDma_BdRingSetCoalesce().
+*
+*****************************************************************************/
+int XAxiDma_StreamSetCoalesce(XAxiDma_Stream *StreamPtr, u32 Counter,
+		u32 Timer)
+{
+	return XAxiDma_BdRingSetCoalesce(StreamPtr->RingPtr, Counter, Timer);
+}
+
+/*****************************************************************************/
+/**
+* Start the streaming channel.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+*
+* @return	Status returned by XAxiDma_BdRingStart().
+*
+*****************************************************************************/
+int XAxiDma_StreamStart(XAxiDma_Stream *StreamPtr)
+{
+	return XAxiDma_BdRingStart(StreamPtr->RingPtr);
+}
+
+/*****************************************************************************/
+/**
+* Queue a buffer for transmission on a transmit streaming channel. The buffer
+* is sent as one packet and is owned by the hardware until it is passed to
+* the handler.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+* @param	BufAddr is the address of the buffer to send.
+* @param	Length is the number of bytes to send.
+*
+* @return
+*		- XST_SUCCESS if the buffer is queued.
+*		- XST_INVALID_PARAM if the length or the address is invalid.
+*		- XST_FAILURE if no BD is free, the completed BDs must be
+*		  recycled with XAxiDma_StreamService().
+*		- Status of XAxiDma_BdRingToHw() if the BD is not committed.
+*
+*****************************************************************************/
+int XAxiDma_StreamSend(XAxiDma_Stream *StreamPtr, UINTPTR BufAddr,
+		u32 Length)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_Bd *BdPtr;
+	int Status;
+
+	RingPtr = StreamPtr->RingPtr;
+	if ((Length == 0U) || (Length > RingPtr->MaxTransferLen)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, 1, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		StreamPtr->Stats.RingFull++;
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(BdPtr);
+	Status = XAxiDma_BdSetBufAddr(BdPtr, BufAddr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XAxiDma_BdSetLength(BdPtr, Length, RingPtr->MaxTransferLen);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	XAxiDma_BdSetCtrl(BdPtr, XAXIDMA_BD_CTRL_TXSOF_MASK |
+			  XAXIDMA_BD_CTRL_TXEOF_MASK);
+	XAxiDma_BdSetId(BdPtr, BufAddr);
+
+	Xil_DCacheFlushRange(BufAddr, Length);
+
+	Status = XAxiDma_BdRingToHw(RingPtr, 1, BdPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	XAxiDma_StreamUpdateOccupancy(StreamPtr);
+
+END:
+	if (Status != XST_SUCCESS) {
+		(void)XAxiDma_BdRingUnAlloc(RingPtr, 1, BdPtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Retrieve the BDs completed by the hardware, pass the buffers to the handler
+* in batches of up to XAXIDMA_STREAM_BATCH_SIZE and recycle the BDs. On a
+* receive channel, the buffers are armed again once the handler returns.
+*
+* This function is called from the channel interrupt handler, after the
+* interrupt is acknowledged, or from a polling loop.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+* @param	NumBufsPtr is set to the number of buffers passed to the
+*		handler, including the batch for which the recycling failed.
+*		It can be NULL.
+*
+* @return
+*		- XST_SUCCESS if all the completed BDs are recycled.
+*		- XST_FAILURE if a batch of BDs could not be freed, or a batch
+*		  of receive buffers could not be armed again. The receive
+*		  buffers are kept by the channel and armed again by the next
+*		  call. The completed BDs which are not retrieved yet are
+*		  left to the next call as well. If the BDs could not be
+*		  freed, all the BDs retrieved from the hardware and not
+*		  freed yet are returned to the free group.
+*
+* @note		The DMA engine halts on errors. BDs completed with an error
+*		are passed to the handler with the error bits in Status and
+*		counted in the statistics, the application has to reset the
+*		engine.
+*
+*****************************************************************************/
+int XAxiDma_StreamService(XAxiDma_Stream *StreamPtr, u32 *NumBufsPtr)
+{
+	XAxiDma_BdRing *RingPtr;
+	XAxiDma_StreamBuf *BufPtr;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	int BdCount;
+	u32 Done = 0U;
+	u32 Count;
+	u32 Index;
+	int Status = XST_SUCCESS;
+
+	RingPtr = StreamPtr->RingPtr;
+
+	/* Buffers which could not be armed by a previous call go first */
+	if (StreamPtr->NumUnarmed != 0U) {
+		Status = XAxiDma_StreamRxArm(StreamPtr, StreamPtr->Unarmed,
+					     StreamPtr->NumUnarmed);
+		if (Status != XST_SUCCESS) {
+			StreamPtr->Stats.RecycleErrors++;
+			goto END;
+		}
+		StreamPtr->NumUnarmed = 0U;
+	}
+
+	while (Status == XST_SUCCESS) {
+		/*
+		 * A batch at a time, so that a recycling failure leaves the
+		 * remaining BDs to the hardware side of the ring
+		 */
+		BdCount = XAxiDma_BdRingFromHw(RingPtr,
+					       XAXIDMA_STREAM_BATCH_SIZE,
+					       &BdPtr);
+		if (BdCount <= 0) {
+			break;
+		}
+		Count = (u32)BdCount;
+
+		/* All the armed buffers are filled, the stream is stalled */
+		if ((RingPtr->IsRxChannel != 0) && (RingPtr->HwCnt == 0)) {
+			StreamPtr->Stats.Starved++;
+		}
+
+		BdCurPtr = BdPtr;
+		for (Index = 0U; Index < Count; Index++) {
+			BufPtr = &StreamPtr->Batch[Index];
+			BufPtr->BufAddr = XAxiDma_StreamBdBufAddr(BdCurPtr);
+			BufPtr->Status = XAxiDma_BdGetSts(BdCurPtr);
+			BufPtr->Length = XAxiDma_BdGetActualLength(BdCurPtr,
+						RingPtr->MaxTransferLen);
+
+			if ((BufPtr->Status & XAXIDMA_BD_STS_ALL_ERR_MASK) != 0U) {
+				StreamPtr->Stats.Errors++;
+			}
+
+			if (RingPtr->IsRxChannel != 0) {
+				Xil_DCacheInvalidateRange(BufPtr->BufAddr,
+							  BufPtr->Length);
+			}
+
+			StreamPtr->Stats.Bytes += BufPtr->Length;
+			BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr,
+								  BdCurPtr);
+		}
+
+		StreamPtr->Stats.Buffers += Count;
+		if (StreamPtr->Handler != NULL) {
+			StreamPtr->Handler(StreamPtr->CallBackRef,
+					   StreamPtr->Batch, Count);
+			StreamPtr->Stats.Batches++;
+		}
+		Done += Count;
+
+		Status = XAxiDma_BdRingFree(RingPtr, (int)Count, BdPtr);
+		if (Status != XST_SUCCESS) {
+			/*
+			 * The post-processing group is out of step with the
+			 * batch, free it from its head so that no BD is lost
+			 */
+			(void)XAxiDma_BdRingFree(RingPtr, RingPtr->PostCnt,
+						 RingPtr->PostHead);
+		} else if (RingPtr->IsRxChannel != 0) {
+			Status = XAxiDma_StreamRxArm(StreamPtr,
+					StreamPtr->Batch, Count);
+		}
+
+		if (Status != XST_SUCCESS) {
+			StreamPtr->Stats.RecycleErrors++;
+			if (RingPtr->IsRxChannel != 0) {
+				memcpy(StreamPtr->Unarmed, StreamPtr->Batch,
+				       Count * sizeof(XAxiDma_StreamBuf));
+				StreamPtr->NumUnarmed = Count;
+			}
+		}
+	}
+
+END:
+	if (NumBufsPtr != NULL) {
+		*NumBufsPtr = Done;
+	}
+
+	return (Status == XST_SUCCESS) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* Clear the statistics of the streaming channel.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+*
+* @return	None.
+*
+*****************************************************************************/
+void XAxiDma_StreamResetStats(XAxiDma_Stream *StreamPtr)
+{
+	memset(&StreamPtr->Stats, 0, sizeof(XAxiDma_StreamStats));
+}
+
+/*****************************************************************************/
+/**
+* Get the buffer address programmed in a BD.
+*
+* @param	BdPtr is the BD to operate on.
+*
+* @return	Buffer address.
+*
+*****************************************************************************/
+static UINTPTR XAxiDma_StreamBdBufAddr(XAxiDma_Bd *BdPtr)
+{
+#if defined(__aarch64__) || defined(__arch64__)
+	return ((UINTPTR)XAxiDma_BdRead(BdPtr, XAXIDMA_BD_BUFA_MSB_OFFSET)
+			<< 32U) | XAxiDma_BdGetBufAddr(BdPtr);
+#else
+	return (UINTPTR)XAxiDma_BdGetBufAddr(BdPtr);
+#endif
+}
+
+/*****************************************************************************/
+/**
+* Attach receive buffers to free BDs and commit them to the hardware.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+* @param	BufPtr is the array of buffers, only BufAddr is used.
+* @param	NumBufs is the number of buffers.
+*
+* @return
+*		- XST_SUCCESS if the buffers are committed.
+*		- XST_FAILURE otherwise.
+*
+*****************************************************************************/
+static int XAxiDma_StreamRxArm(XAxiDma_Stream *StreamPtr,
+		const XAxiDma_StreamBuf *BufPtr, u32 NumBufs)
+{
+	XAxiDma_BdRing *RingPtr = StreamPtr->RingPtr;
+	XAxiDma_Bd *BdPtr = NULL;
+	XAxiDma_Bd *BdCurPtr;
+	u32 Index;
+	int Status;
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, (int)NumBufs, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		BdPtr = NULL;
+		goto END;
+	}
+
+	BdCurPtr = BdPtr;
+	for (Index = 0U; Index < NumBufs; Index++) {
+		XAxiDma_BdClear(BdCurPtr);
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, BufPtr[Index].BufAddr);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		Status = XAxiDma_BdSetLength(BdCurPtr, StreamPtr->BufSize,
+					     RingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		/* The hardware sets SOF/EOF in the status of RX BDs */
+		XAxiDma_BdSetCtrl(BdCurPtr, 0U);
+		XAxiDma_BdSetId(BdCurPtr, BufPtr[Index].BufAddr);
+
+		Xil_DCacheInvalidateRange(BufPtr[Index].BufAddr,
+					  StreamPtr->BufSize);
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdCurPtr);
+	}
+
+	Status = XAxiDma_BdRingToHw(RingPtr, (int)NumBufs, BdPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	XAxiDma_StreamUpdateOccupancy(StreamPtr);
+
+END:
+	if (Status != XST_SUCCESS) {
+		if (BdPtr != NULL) {
+			(void)XAxiDma_BdRingUnAlloc(RingPtr, (int)NumBufs,
+						    BdPtr);
+		}
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Record the highest number of BDs owned by the hardware.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void XAxiDma_StreamUpdateOccupancy(XAxiDma_Stream *StreamPtr)
+{
+	u32 HwCnt = (u32)XAxiDma_StreamGetOccupancy(StreamPtr);
+
+	if (HwCnt > StreamPtr->Stats.MaxOccupancy) {
+		StreamPtr->Stats.MaxOccupancy = HwCnt;
+	}
+}
+/** @} */
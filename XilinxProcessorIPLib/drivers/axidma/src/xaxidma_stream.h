@@ -0,0 +1,182 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_stream.h
+* @addtogroup axidma_v9_14
+* @{
+*
+* This file contains the streaming channel layer built on top of the BD ring
+* API of the AXI DMA driver. A streaming channel owns one BD ring and takes
+* care of the BD recycling that continuous streaming applications otherwise
+* implement with XAxiDma_BdRingAlloc(), XAxiDma_BdRingToHw(),
+* XAxiDma_BdRingFromHw() and XAxiDma_BdRingFree().
+*
+* For the receive channel, the application gives a pool of equally sized
+* buffers to XAxiDma_StreamRxInit(). Every buffer is attached to a BD, and
+* once the handler has been called for a completed buffer, the buffer is
+* armed again on the ring. The handler must therefore consume or copy the
+* data before returning.
+*
+* For the transmit channel, buffers are queued with XAxiDma_StreamSend() and
+* handed back to the application through the handler once the hardware has
+* transmitted them.
+*
+* XAxiDma_StreamService() retrieves the completed BDs and calls the handler
+* with up to XAXIDMA_STREAM_BATCH_SIZE buffers per call. It is called from
+* the channel interrupt handler, after acknowledging the interrupt, or from
+* a polling loop. The cache maintenance of the data buffers is done by this
+* layer. When a batch of receive buffers can't be armed again, the buffers
+* are kept by the channel and armed by the next XAxiDma_StreamService()
+* call, so no buffer of the pool is lost.
+*
+* The BD ring must be created with XAxiDma_BdRingCreate() before the
+* streaming channel is initialized. The driver is not thread safe, the
+* streaming channel must not be used concurrently with other calls that
+* modify the same BD ring.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.14  ag   10/19/26 First release
+*       ag   10/19/26 Report the BD recycling errors, keep the receive
+*                     buffers which could not be armed again and count
+*                     only the receive starvation
+*
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XAXIDMA_STREAM_H_	/* prevent circular inclusions */
+#define XAXIDMA_STREAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Maximum number of buffers passed to the handler in one call */
+#ifndef XAXIDMA_STREAM_BATCH_SIZE
+#define XAXIDMA_STREAM_BATCH_SIZE	16
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Buffer completed by the hardware
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Length;		/**< Number of bytes transferred */
+	u32 Status;		/**< BD status, holds the RX SOF/EOF flags */
+} XAxiDma_StreamBuf;
+
+/**
+ * Completion handler, called with a batch of completed buffers
+ */
+typedef void (*XAxiDma_StreamHandler)(void *CallBackRef,
+		const XAxiDma_StreamBuf *BufPtr, u32 NumBufs);
+
+/**
+ * Streaming channel statistics
+ *
+ * The throughput is obtained by sampling Bytes at two points in time.
+ */
+typedef struct {
+	u64 Bytes;		/**< Bytes transferred */
+	u32 Buffers;		/**< Buffers completed */
+	u32 Batches;		/**< Number of handler calls */
+	u32 Errors;		/**< BDs completed with an error */
+	u32 RecycleErrors;	/**< BD free or receive buffer arm failures */
+	u32 Starved;		/**< Receive channel only, times all the
+				  *  armed buffers were found filled when
+				  *  serviced, incoming data was stalled */
+	u32 RingFull;		/**< Transmit requests rejected because no
+				  *  BD was free */
+	u32 MaxOccupancy;	/**< Highest number of BDs owned by the
+				  *  hardware */
+} XAxiDma_StreamStats;
+
+/**
+ * Streaming channel
+ */
+typedef struct {
+	XAxiDma_BdRing *RingPtr;	/**< BD ring of the channel */
+	UINTPTR BufBase;		/**< RX buffer pool base address */
+	u32 BufSize;			/**< RX buffer size in bytes */
+	u32 NumBufs;			/**< Number of RX buffers */
+	XAxiDma_StreamHandler Handler;	/**< Completion handler */
+	void *CallBackRef;		/**< Handler argument */
+	XAxiDma_StreamStats Stats;	/**< Channel statistics */
+	XAxiDma_StreamBuf Batch[XAXIDMA_STREAM_BATCH_SIZE];
+					/**< Buffers of the current batch */
+	XAxiDma_StreamBuf Unarmed[XAXIDMA_STREAM_BATCH_SIZE];
+					/**< RX buffers to be armed again */
+	u32 NumUnarmed;			/**< Number of RX buffers to be armed
+					  *  again */
+} XAxiDma_Stream;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Get the number of BDs currently owned by the hardware.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+*
+* @return	Number of BDs queued to the hardware.
+*
+* @note		C-style signature:
+*		int XAxiDma_StreamGetOccupancy(XAxiDma_Stream *StreamPtr)
+*
+*****************************************************************************/
+#define XAxiDma_StreamGetOccupancy(StreamPtr)	\
+		((StreamPtr)->RingPtr->HwCnt)
+
+/*****************************************************************************/
+/**
+* Get the statistics of the streaming channel.
+*
+* @param	StreamPtr is a pointer to the streaming channel.
+*
+* @return	Pointer to the statistics.
+*
+* @note		C-style signature:
+*		XAxiDma_StreamStats *XAxiDma_StreamGetStats(
+*					XAxiDma_Stream *StreamPtr)
+*
+*****************************************************************************/
+#define XAxiDma_StreamGetStats(StreamPtr)	(&((StreamPtr)->Stats))
+
+/************************** Function Prototypes ******************************/
+
+int XAxiDma_StreamRxInit(XAxiDma_Stream *StreamPtr, XAxiDma_BdRing *RingPtr,
+		UINTPTR BufBase, u32 BufSize, u32 NumBufs);
+int XAxiDma_StreamTxInit(XAxiDma_Stream *StreamPtr, XAxiDma_BdRing *RingPtr);
+void XAxiDma_StreamSetHandler(XAxiDma_Stream *StreamPtr,
+		XAxiDma_StreamHandler Handler, void *CallBackRef);
+int XAxiDma_StreamSetCoalesce(XAxiDma_Stream *StreamPtr, u32 Counter,
+		u32 Timer);
+int XAxiDma_StreamStart(XAxiDma_Stream *StreamPtr);
+int XAxiDma_StreamSend(XAxiDma_Stream *StreamPtr, UINTPTR BufAddr,
+		u32 Length);
+int XAxiDma_StreamService(XAxiDma_Stream *StreamPtr, u32 *NumBufsPtr);
+void XAxiDma_StreamResetStats(XAxiDma_Stream *StreamPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/** @} */
@@ -0,0 +1,385 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_aes_test.c
+*
+* This file checks the AES-128 functions of hdcp22_common on the host.
+*
+* - XHdcp22Cmn_Aes128Encrypt() and XHdcp22Cmn_Aes128Decrypt() give the
+*   FIPS-197 appendix C.1 vector.
+* - XHdcp22Cmn_Aes128EncryptBlocks() gives the four blocks of the
+*   SP 800-38A F.1.1 ECB-AES128 vector, also in place.
+* - XHdcp22Cmn_Aes128EncryptCtr() gives the SP 800-38A F.5.1 CTR-AES128
+*   vector for every length from 0 to 64 bytes, also in place at every byte
+*   offset, and decrypts it again.
+* - For random keys and blocks, the encryption is inverted by the byte
+*   oriented decryption, and a multi-block encryption gives the blocks of
+*   single block encryptions.
+*
+* The time of a block encryption, of a block decryption, of the
+* dkey0 || dkey1 derivation with one and with two key schedules and of a
+* 64 byte CTR encryption is printed. The file is built with and without
+* XHDCP22_CMN_AES_TTABLE.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.10  ag   10/19/26 First release
+*       ag   10/19/26 Added the CTR vector and the T-table build
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions *****************************/
+#define BLOCK_SIZE	16	/* AES block size in bytes */
+#define NUM_RANDOM	100000	/* Random key and block pairs */
+#define MAX_BLOCKS	8	/* Blocks of a random multi-block encryption */
+#define NUM_TIMED	200000	/* Timed calls */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int TestFips197(void);
+static int TestEcb(void);
+static int TestCtr(void);
+static int TestRandom(void);
+static void TimeCalls(void);
+static void RandomBytes(u8 *Buffer, u32 Size);
+static double Elapsed(const struct timespec *Start);
+
+/************************** Variable Definitions *****************************/
+/* FIPS-197 appendix C.1 */
+static const u8 Fips197Key[BLOCK_SIZE] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const u8 Fips197Plain[BLOCK_SIZE] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+	0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const u8 Fips197Cipher[BLOCK_SIZE] = {
+	0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+	0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+
+/* SP 800-38A F.1.1 */
+static const u8 EcbKey[BLOCK_SIZE] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+	0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const u8 EcbPlain[4 * BLOCK_SIZE] = {
+	0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+	0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+	0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+	0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+	0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+	0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+	0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+	0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+static const u8 EcbCipher[4 * BLOCK_SIZE] = {
+	0x3a, 0xd7, 0x7b, 0xb4, 0x0d, 0x7a, 0x36, 0x60,
+	0xa8, 0x9e, 0xca, 0xf3, 0x24, 0x66, 0xef, 0x97,
+	0xf5, 0xd3, 0xd5, 0x85, 0x03, 0xb9, 0x69, 0x9d,
+	0xe7, 0x85, 0x89, 0x5a, 0x96, 0xfd, 0xba, 0xaf,
+	0x43, 0xb1, 0xcd, 0x7f, 0x59, 0x8e, 0xce, 0x23,
+	0x88, 0x1b, 0x00, 0xe3, 0xed, 0x03, 0x06, 0x88,
+	0x7b, 0x0c, 0x78, 0x5e, 0x27, 0xe8, 0xad, 0x3f,
+	0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5d, 0xd4
+};
+
+/* SP 800-38A F.5.1, the key and plaintext are those of F.1.1 */
+static const u8 CtrIv[BLOCK_SIZE] = {
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+	0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+static const u8 CtrCipher[4 * BLOCK_SIZE] = {
+	0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+	0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+	0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+	0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+	0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+	0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+	0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+	0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+};
+
+#ifdef XHDCP22_CMN_AES_TTABLE
+#define ENCRYPT_NAME	"T-table"
+#else
+#define ENCRYPT_NAME	"byte oriented"
+#endif
+
+/* Sink of the timed calls */
+static volatile u8 Sink;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	srand(1U);
+	printf("Encryption: %s\r\n", ENCRYPT_NAME);
+	if ((TestFips197() != XST_SUCCESS) || (TestEcb() != XST_SUCCESS) ||
+	    (TestCtr() != XST_SUCCESS) || (TestRandom() != XST_SUCCESS)) {
+		return 1;
+	}
+	TimeCalls();
+
+	printf("Successfully ran AES test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the FIPS-197 appendix C.1 vector.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestFips197(void)
+{
+	u8 Block[BLOCK_SIZE];
+
+	XHdcp22Cmn_Aes128Encrypt(Fips197Plain, Fips197Key, Block);
+	CHECK(memcmp(Block, Fips197Cipher, BLOCK_SIZE) == 0,
+			"FIPS-197 encryption");
+	XHdcp22Cmn_Aes128Decrypt(Fips197Cipher, Fips197Key, Block);
+	CHECK(memcmp(Block, Fips197Plain, BLOCK_SIZE) == 0,
+			"FIPS-197 decryption");
+
+	printf("FIPS-197 C.1 matches\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the SP 800-38A ECB-AES128 vector.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestEcb(void)
+{
+	u8 Blocks[4 * BLOCK_SIZE];
+	u32 Idx;
+
+	XHdcp22Cmn_Aes128EncryptBlocks(EcbPlain, 4, EcbKey, Blocks);
+	CHECK(memcmp(Blocks, EcbCipher, sizeof(Blocks)) == 0,
+			"ECB encryption");
+
+	memcpy(Blocks, EcbPlain, sizeof(Blocks));
+	XHdcp22Cmn_Aes128EncryptBlocks(Blocks, 4, EcbKey, Blocks);
+	CHECK(memcmp(Blocks, EcbCipher, sizeof(Blocks)) == 0,
+			"ECB encryption in place");
+
+	for (Idx = 0; Idx < 4; Idx++) {
+		XHdcp22Cmn_Aes128Decrypt(&EcbCipher[Idx * BLOCK_SIZE], EcbKey,
+				&Blocks[Idx * BLOCK_SIZE]);
+	}
+	CHECK(memcmp(Blocks, EcbPlain, sizeof(Blocks)) == 0,
+			"ECB decryption");
+
+	printf("SP 800-38A F.1.1 matches\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the SP 800-38A CTR-AES128 vector, truncated to every
+* length and in place at every offset of a word.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestCtr(void)
+{
+	u8 Buffer[4 * BLOCK_SIZE + 4];
+	u8 Out[4 * BLOCK_SIZE];
+	u32 Len;
+	u32 Offset;
+
+	for (Len = 0; Len <= sizeof(Out); Len++) {
+		memset(Out, 0xa5, sizeof(Out));
+		XHdcp22Cmn_Aes128EncryptCtr(EcbPlain, Len, EcbKey, CtrIv, Out);
+		CHECK(memcmp(Out, CtrCipher, Len) == 0, "CTR encryption");
+		CHECK((Len == sizeof(Out)) || (Out[Len] == 0xa5),
+				"CTR writes past the end");
+
+		for (Offset = 0; Offset < 4; Offset++) {
+			memcpy(&Buffer[Offset], CtrCipher, Len);
+			XHdcp22Cmn_Aes128EncryptCtr(&Buffer[Offset], Len, EcbKey,
+					CtrIv, &Buffer[Offset]);
+			CHECK(memcmp(&Buffer[Offset], EcbPlain, Len) == 0,
+					"CTR decryption in place");
+		}
+	}
+
+	printf("SP 800-38A F.5.1 matches\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks random keys and blocks.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRandom(void)
+{
+	u8 Key[BLOCK_SIZE];
+	u8 Plain[MAX_BLOCKS * BLOCK_SIZE];
+	u8 Cipher[MAX_BLOCKS * BLOCK_SIZE];
+	u8 Single[BLOCK_SIZE];
+	u8 Back[BLOCK_SIZE];
+	u32 NumBlocks;
+	u32 Idx;
+	int Run;
+
+	for (Run = 0; Run < NUM_RANDOM; Run++) {
+		RandomBytes(Key, sizeof(Key));
+		NumBlocks = 1 + ((u32)rand() % MAX_BLOCKS);
+		RandomBytes(Plain, NumBlocks * BLOCK_SIZE);
+
+		XHdcp22Cmn_Aes128EncryptBlocks(Plain, NumBlocks, Key, Cipher);
+		for (Idx = 0; Idx < NumBlocks; Idx++) {
+			XHdcp22Cmn_Aes128Encrypt(&Plain[Idx * BLOCK_SIZE], Key,
+					Single);
+			CHECK(memcmp(Single, &Cipher[Idx * BLOCK_SIZE],
+					BLOCK_SIZE) == 0,
+					"multi-block differs from single block");
+			XHdcp22Cmn_Aes128Decrypt(Single, Key, Back);
+			CHECK(memcmp(Back, &Plain[Idx * BLOCK_SIZE],
+					BLOCK_SIZE) == 0,
+					"decryption does not invert encryption");
+		}
+	}
+
+	printf("%d random keys match\r\n", NUM_RANDOM);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time of the AES calls.
+*
+* @return	None.
+*
+******************************************************************************/
+static void TimeCalls(void)
+{
+	struct timespec Start;
+	u8 In[4 * BLOCK_SIZE];
+	u8 Out[4 * BLOCK_SIZE];
+	u8 Key[BLOCK_SIZE];
+	int Run;
+
+	RandomBytes(In, sizeof(In));
+	RandomBytes(Key, sizeof(Key));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		In[0] = (u8)Run;
+		XHdcp22Cmn_Aes128Encrypt(In, Key, Out);
+		Sink ^= Out[0];
+	}
+	printf("Encrypt:                 %.3f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		In[0] = (u8)Run;
+		XHdcp22Cmn_Aes128Decrypt(In, Key, Out);
+		Sink ^= Out[0];
+	}
+	printf("Decrypt, byte oriented:  %.3f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		In[0] = (u8)Run;
+		XHdcp22Cmn_Aes128Encrypt(In, Key, Out);
+		XHdcp22Cmn_Aes128Encrypt(&In[BLOCK_SIZE], Key, &Out[BLOCK_SIZE]);
+		Sink ^= Out[0] ^ Out[BLOCK_SIZE];
+	}
+	printf("dkey0 || dkey1, 2 keys:  %.3f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		In[0] = (u8)Run;
+		XHdcp22Cmn_Aes128EncryptBlocks(In, 2, Key, Out);
+		Sink ^= Out[0] ^ Out[BLOCK_SIZE];
+	}
+	printf("dkey0 || dkey1, 1 key:   %.3f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		In[0] = (u8)Run;
+		XHdcp22Cmn_Aes128EncryptCtr(In, sizeof(In), Key, CtrIv, Out);
+		Sink ^= Out[0];
+	}
+	printf("CTR, 64 bytes:           %.3f us\r\n", Elapsed(&Start));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a buffer with random bytes.
+*
+******************************************************************************/
+static void RandomBytes(u8 *Buffer, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx++) {
+		Buffer[Idx] = (u8)rand();
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time per timed call since Start, in us.
+*
+******************************************************************************/
+static double Elapsed(const struct timespec *Start)
+{
+	struct timespec End;
+
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	return ((double)(End.tv_sec - Start->tv_sec) * 1e6 +
+		(double)(End.tv_nsec - Start->tv_nsec) / 1e3) / NUM_TIMED;
+}
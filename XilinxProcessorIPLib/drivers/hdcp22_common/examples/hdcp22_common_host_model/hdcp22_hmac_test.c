@@ -0,0 +1,411 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_hmac_test.c
+*
+* This file checks the SHA256 and HMAC-SHA256 functions of hdcp22_common on
+* the host.
+*
+* - XHdcp22Cmn_Sha256Hash() gives the FIPS 180-2 "abc", two block and
+*   million "a" vectors, the last one also streamed in 1000 byte updates.
+* - XHdcp22Cmn_HmacSha256Hash() and the streaming API with a key state give
+*   the RFC 4231 test cases 1 to 4, 6 and 7. Test case 5 truncates the
+*   output and is left out.
+* - For random data, streaming in random updates, in single bytes and in one
+*   call give the same hash, and one key state gives the same HMAC for
+*   several messages.
+*
+* The time of a SHA256 block, and of an 11 byte HMAC, the size of the H'
+* message, with and without the key state, is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.10  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions *****************************/
+#define HASH_SIZE	32	/* SHA256 output size in bytes */
+#define NUM_RFC4231	6	/* RFC 4231 test cases */
+#define NUM_RANDOM	2000	/* Random messages */
+#define MAX_DATA	1000	/* Bytes of a random message */
+#define NUM_TIMED	200000	/* Timed calls */
+
+/**************************** Type Definitions *******************************/
+/* RFC 4231 test case, the key and data are given or a repeated byte */
+typedef struct {
+	const u8 *Key;
+	u8 KeyByte;
+	int KeySize;
+	const char *Data;
+	u8 DataByte;
+	int DataSize;
+	u8 Mac[HASH_SIZE];
+} HmacVector;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int TestSha256(void);
+static int TestHmac(void);
+static int TestRandom(void);
+static void TimeCalls(void);
+static void RandomBytes(u8 *Buffer, u32 Size);
+static double Elapsed(const struct timespec *Start);
+
+/************************** Variable Definitions *****************************/
+/* FIPS 180-2 appendix B */
+static const char Sha256Msg1[] = "abc";
+static const u8 Sha256Hash1[HASH_SIZE] = {
+	0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+	0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+	0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+	0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+};
+static const char Sha256Msg2[] =
+	"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+static const u8 Sha256Hash2[HASH_SIZE] = {
+	0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8,
+	0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+	0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+	0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1
+};
+static const u8 Sha256Hash3[HASH_SIZE] = {
+	0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92,
+	0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+	0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+	0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+};
+
+/* RFC 4231 section 4 */
+static const u8 Rfc4231Key4[25] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+	0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+	0x19
+};
+static const HmacVector Rfc4231[NUM_RFC4231] = {
+	{ NULL, 0x0b, 20, "Hi There", 0, 8, {
+		0xb0, 0x34, 0x4c, 0x61, 0xd8, 0xdb, 0x38, 0x53,
+		0x5c, 0xa8, 0xaf, 0xce, 0xaf, 0x0b, 0xf1, 0x2b,
+		0x88, 0x1d, 0xc2, 0x00, 0xc9, 0x83, 0x3d, 0xa7,
+		0x26, 0xe9, 0x37, 0x6c, 0x2e, 0x32, 0xcf, 0xf7 } },
+	{ (const u8 *)"Jefe", 0, 4, "what do ya want for nothing?", 0, 28, {
+		0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e,
+		0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+		0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83,
+		0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43 } },
+	{ NULL, 0xaa, 20, NULL, 0xdd, 50, {
+		0x77, 0x3e, 0xa9, 0x1e, 0x36, 0x80, 0x0e, 0x46,
+		0x85, 0x4d, 0xb8, 0xeb, 0xd0, 0x91, 0x81, 0xa7,
+		0x29, 0x59, 0x09, 0x8b, 0x3e, 0xf8, 0xc1, 0x22,
+		0xd9, 0x63, 0x55, 0x14, 0xce, 0xd5, 0x65, 0xfe } },
+	{ Rfc4231Key4, 0, 25, NULL, 0xcd, 50, {
+		0x82, 0x55, 0x8a, 0x38, 0x9a, 0x44, 0x3c, 0x0e,
+		0xa4, 0xcc, 0x81, 0x98, 0x99, 0xf2, 0x08, 0x3a,
+		0x85, 0xf0, 0xfa, 0xa3, 0xe5, 0x78, 0xf8, 0x07,
+		0x7a, 0x2e, 0x3f, 0xf4, 0x67, 0x29, 0x66, 0x5b } },
+	{ NULL, 0xaa, 131,
+	  "Test Using Larger Than Block-Size Key - Hash Key First", 0, 54, {
+		0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f,
+		0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7, 0x7f,
+		0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14,
+		0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54 } },
+	{ NULL, 0xaa, 131,
+	  "This is a test using a larger than block-size key and a larger "
+	  "than block-size data. The key needs to be hashed before being "
+	  "used by the HMAC algorithm.", 0, 152, {
+		0x9b, 0x09, 0xff, 0xa7, 0x1b, 0x94, 0x2f, 0xcb,
+		0x27, 0x63, 0x5f, 0xbc, 0xd5, 0xb0, 0xe9, 0x44,
+		0xbf, 0xdc, 0x63, 0x64, 0x4f, 0x07, 0x13, 0x93,
+		0x8a, 0x7f, 0x51, 0x53, 0x5c, 0x3a, 0x35, 0xe2 } }
+};
+
+/* Message of the million "a" vector, streamed in 1000 byte updates */
+static u8 Block[MAX_DATA];
+
+/* Sink of the timed calls */
+static volatile u8 Sink;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	srand(1U);
+	if ((TestSha256() != XST_SUCCESS) || (TestHmac() != XST_SUCCESS) ||
+	    (TestRandom() != XST_SUCCESS)) {
+		return 1;
+	}
+	TimeCalls();
+
+	printf("Successfully ran HMAC test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the FIPS 180-2 vectors.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestSha256(void)
+{
+	XHdcp22Cmn_Sha256Ctx Ctx;
+	u8 Hash[HASH_SIZE];
+	int Idx;
+
+	XHdcp22Cmn_Sha256Hash((const u8 *)Sha256Msg1, strlen(Sha256Msg1),
+			Hash);
+	CHECK(memcmp(Hash, Sha256Hash1, HASH_SIZE) == 0, "\"abc\" differs");
+
+	XHdcp22Cmn_Sha256Hash((const u8 *)Sha256Msg2, strlen(Sha256Msg2),
+			Hash);
+	CHECK(memcmp(Hash, Sha256Hash2, HASH_SIZE) == 0,
+			"two block message differs");
+
+	memset(Block, 'a', sizeof(Block));
+	XHdcp22Cmn_Sha256Init(&Ctx);
+	for (Idx = 0; Idx < 1000; Idx++) {
+		XHdcp22Cmn_Sha256Update(&Ctx, Block, sizeof(Block));
+	}
+	XHdcp22Cmn_Sha256Final(&Ctx, Hash);
+	CHECK(memcmp(Hash, Sha256Hash3, HASH_SIZE) == 0,
+			"million \"a\" differs");
+
+	printf("FIPS 180-2 SHA256 vectors match\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the RFC 4231 vectors, in one call and with a key
+* state used for two messages.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestHmac(void)
+{
+	const HmacVector *VecPtr;
+	XHdcp22Cmn_HmacSha256Key KeyCtx;
+	XHdcp22Cmn_HmacSha256Ctx Ctx;
+	u8 Key[131];
+	u8 Data[152];
+	u8 Mac[HASH_SIZE];
+	int Idx;
+	int Run;
+
+	for (Idx = 0; Idx < NUM_RFC4231; Idx++) {
+		VecPtr = &Rfc4231[Idx];
+		if (VecPtr->Key != NULL) {
+			memcpy(Key, VecPtr->Key, VecPtr->KeySize);
+		} else {
+			memset(Key, VecPtr->KeyByte, VecPtr->KeySize);
+		}
+		if (VecPtr->Data != NULL) {
+			memcpy(Data, VecPtr->Data, VecPtr->DataSize);
+		} else {
+			memset(Data, VecPtr->DataByte, VecPtr->DataSize);
+		}
+
+		CHECK(XHdcp22Cmn_HmacSha256Hash(Data, VecPtr->DataSize, Key,
+				VecPtr->KeySize, Mac) == XST_SUCCESS,
+				"HMAC failed");
+		CHECK(memcmp(Mac, VecPtr->Mac, HASH_SIZE) == 0,
+				"HMAC in one call differs");
+
+		/* The key state is not changed by a message */
+		XHdcp22Cmn_HmacSha256SetKey(&KeyCtx, Key, VecPtr->KeySize);
+		for (Run = 0; Run < 2; Run++) {
+			XHdcp22Cmn_HmacSha256Init(&Ctx, &KeyCtx);
+			XHdcp22Cmn_HmacSha256Update(&Ctx, Data, 1);
+			XHdcp22Cmn_HmacSha256Update(&Ctx, &Data[1],
+					VecPtr->DataSize - 1);
+			XHdcp22Cmn_HmacSha256Final(&Ctx, Mac);
+			CHECK(memcmp(Mac, VecPtr->Mac, HASH_SIZE) == 0,
+					"HMAC with key state differs");
+		}
+	}
+
+	printf("RFC 4231 HMAC-SHA256 vectors match\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the streaming of random messages.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRandom(void)
+{
+	XHdcp22Cmn_Sha256Ctx Ctx;
+	XHdcp22Cmn_HmacSha256Key KeyCtx;
+	XHdcp22Cmn_HmacSha256Ctx HmacCtx;
+	u8 Data[MAX_DATA];
+	u8 Key[HASH_SIZE];
+	u8 Hash[HASH_SIZE];
+	u8 Ref[HASH_SIZE];
+	u32 Size;
+	u32 Pos;
+	u32 Len;
+	int Run;
+
+	RandomBytes(Key, sizeof(Key));
+	XHdcp22Cmn_HmacSha256SetKey(&KeyCtx, Key, sizeof(Key));
+
+	for (Run = 0; Run < NUM_RANDOM; Run++) {
+		Size = (u32)rand() % (MAX_DATA + 1);
+		RandomBytes(Data, Size);
+		XHdcp22Cmn_Sha256Hash(Data, Size, Ref);
+
+		/* Random updates, across and on the block boundaries */
+		XHdcp22Cmn_Sha256Init(&Ctx);
+		for (Pos = 0; Pos < Size; Pos += Len) {
+			Len = (u32)rand() % 150;
+			if (Len > Size - Pos) {
+				Len = Size - Pos;
+			}
+			XHdcp22Cmn_Sha256Update(&Ctx, &Data[Pos], Len);
+		}
+		XHdcp22Cmn_Sha256Final(&Ctx, Hash);
+		CHECK(memcmp(Hash, Ref, HASH_SIZE) == 0,
+				"random updates differ");
+
+		/* Single bytes */
+		XHdcp22Cmn_Sha256Init(&Ctx);
+		for (Pos = 0; Pos < Size; Pos++) {
+			XHdcp22Cmn_Sha256Update(&Ctx, &Data[Pos], 1);
+		}
+		XHdcp22Cmn_Sha256Final(&Ctx, Hash);
+		CHECK(memcmp(Hash, Ref, HASH_SIZE) == 0,
+				"single byte updates differ");
+
+		/* One key state for all the messages */
+		XHdcp22Cmn_HmacSha256Hash(Data, Size, Key, sizeof(Key), Ref);
+		XHdcp22Cmn_HmacSha256Init(&HmacCtx, &KeyCtx);
+		XHdcp22Cmn_HmacSha256Update(&HmacCtx, Data, Size);
+		XHdcp22Cmn_HmacSha256Final(&HmacCtx, Hash);
+		CHECK(memcmp(Hash, Ref, HASH_SIZE) == 0,
+				"HMAC with key state differs");
+	}
+
+	printf("%d random messages match\r\n", NUM_RANDOM);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time of the hash calls.
+*
+* @return	None.
+*
+******************************************************************************/
+static void TimeCalls(void)
+{
+	struct timespec Start;
+	XHdcp22Cmn_HmacSha256Key KeyCtx;
+	XHdcp22Cmn_HmacSha256Ctx Ctx;
+	u8 Data[64];
+	u8 Key[HASH_SIZE];
+	u8 Hash[HASH_SIZE];
+	int Run;
+
+	RandomBytes(Data, sizeof(Data));
+	RandomBytes(Key, sizeof(Key));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		Data[0] = (u8)Run;
+		XHdcp22Cmn_Sha256Hash(Data, 55, Hash);
+		Sink ^= Hash[0];
+	}
+	printf("SHA256, one block:         %.3f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		Data[0] = (u8)Run;
+		XHdcp22Cmn_HmacSha256Hash(Data, 11, Key, sizeof(Key), Hash);
+		Sink ^= Hash[0];
+	}
+	printf("HMAC, 11 bytes, with key:  %.3f us\r\n", Elapsed(&Start));
+
+	XHdcp22Cmn_HmacSha256SetKey(&KeyCtx, Key, sizeof(Key));
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		Data[0] = (u8)Run;
+		XHdcp22Cmn_HmacSha256Init(&Ctx, &KeyCtx);
+		XHdcp22Cmn_HmacSha256Update(&Ctx, Data, 11);
+		XHdcp22Cmn_HmacSha256Final(&Ctx, Hash);
+		Sink ^= Hash[0];
+	}
+	printf("HMAC, 11 bytes, key state: %.3f us\r\n", Elapsed(&Start));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a buffer with random bytes.
+*
+******************************************************************************/
+static void RandomBytes(u8 *Buffer, u32 Size)
+{
+	u32 Idx;
+
+	for (Idx = 0; Idx < Size; Idx++) {
+		Buffer[Idx] = (u8)rand();
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time per timed call since Start, in us.
+*
+******************************************************************************/
+static double Elapsed(const struct timespec *Start)
+{
+	struct timespec End;
+
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	return ((double)(End.tv_sec - Start->tv_sec) * 1e6 +
+		(double)(End.tv_nsec - Start->tv_nsec) / 1e3) / NUM_TIMED;
+}
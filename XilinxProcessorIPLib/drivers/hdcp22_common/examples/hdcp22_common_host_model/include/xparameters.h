@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* The host model has no generated hardware parameters.
+*
+******************************************************************************/
+#ifndef HDCP22_COMMON_MODEL_XPARAMETERS_H_
+#define HDCP22_COMMON_MODEL_XPARAMETERS_H_
+
+#endif /* HDCP22_COMMON_MODEL_XPARAMETERS_H_ */
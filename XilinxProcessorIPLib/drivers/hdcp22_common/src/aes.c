@@ -25,8 +25,21 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.01  MH   01/28/17 Fixed warnings and errors.
+* 1.02  ag   10/19/26 Added word oriented T-table encryption and multi-block
+*                     ECB encryption.
+*       ag   10/19/26 Added multi-block CTR encryption with a word wide XOR.
+*                     The T-table encryption is built only with
+*                     XHDCP22_CMN_AES_TTABLE.
 *</pre>
 *
+* The encryption runs the byte oriented rounds by default. Their S-box
+* lookups take 4 lines of a 64 byte data cache. Defining
+* XHDCP22_CMN_AES_TTABLE in the compiler flags selects a T-table
+* encryption, about 4 times faster, whose 1 KB table spans 16 lines, so its
+* key dependent lookups leak more through cache timing on processors with a
+* data cache shared with other software (Cortex-A53, Cortex-R5 with its cache
+* enabled). Neither version is constant time.
+*
 *****************************************************************************/
 
 /***************************** Include Files *********************************/
@@ -212,10 +225,81 @@ static const u8 Aes_GfMul[256][6] = {
 	{0xe7,0x19,0x4f,0xa8,0x9a,0x83},{0xe5,0x1a,0x46,0xa3,0x97,0x8d}
 };
 
+#ifdef XHDCP22_CMN_AES_TTABLE
+/* Encryption T-table, combining SubBytes and MixColumns for one column byte.
+   Entry x is {02}.S[x] || S[x] || S[x] || {03}.S[x], the tables of the other
+   rows are rotations of it. See the file header for its cache footprint. */
+static const u32 Aes_Te0[256] = {
+	0xC66363A5,0xF87C7C84,0xEE777799,0xF67B7B8D,0xFFF2F20D,0xD66B6BBD,
+	0xDE6F6FB1,0x91C5C554,0x60303050,0x02010103,0xCE6767A9,0x562B2B7D,
+	0xE7FEFE19,0xB5D7D762,0x4DABABE6,0xEC76769A,0x8FCACA45,0x1F82829D,
+	0x89C9C940,0xFA7D7D87,0xEFFAFA15,0xB25959EB,0x8E4747C9,0xFBF0F00B,
+	0x41ADADEC,0xB3D4D467,0x5FA2A2FD,0x45AFAFEA,0x239C9CBF,0x53A4A4F7,
+	0xE4727296,0x9BC0C05B,0x75B7B7C2,0xE1FDFD1C,0x3D9393AE,0x4C26266A,
+	0x6C36365A,0x7E3F3F41,0xF5F7F702,0x83CCCC4F,0x6834345C,0x51A5A5F4,
+	0xD1E5E534,0xF9F1F108,0xE2717193,0xABD8D873,0x62313153,0x2A15153F,
+	0x0804040C,0x95C7C752,0x46232365,0x9DC3C35E,0x30181828,0x379696A1,
+	0x0A05050F,0x2F9A9AB5,0x0E070709,0x24121236,0x1B80809B,0xDFE2E23D,
+	0xCDEBEB26,0x4E272769,0x7FB2B2CD,0xEA75759F,0x1209091B,0x1D83839E,
+	0x582C2C74,0x341A1A2E,0x361B1B2D,0xDC6E6EB2,0xB45A5AEE,0x5BA0A0FB,
+	0xA45252F6,0x763B3B4D,0xB7D6D661,0x7DB3B3CE,0x5229297B,0xDDE3E33E,
+	0x5E2F2F71,0x13848497,0xA65353F5,0xB9D1D168,0x00000000,0xC1EDED2C,
+	0x40202060,0xE3FCFC1F,0x79B1B1C8,0xB65B5BED,0xD46A6ABE,0x8DCBCB46,
+	0x67BEBED9,0x7239394B,0x944A4ADE,0x984C4CD4,0xB05858E8,0x85CFCF4A,
+	0xBBD0D06B,0xC5EFEF2A,0x4FAAAAE5,0xEDFBFB16,0x864343C5,0x9A4D4DD7,
+	0x66333355,0x11858594,0x8A4545CF,0xE9F9F910,0x04020206,0xFE7F7F81,
+	0xA05050F0,0x783C3C44,0x259F9FBA,0x4BA8A8E3,0xA25151F3,0x5DA3A3FE,
+	0x804040C0,0x058F8F8A,0x3F9292AD,0x219D9DBC,0x70383848,0xF1F5F504,
+	0x63BCBCDF,0x77B6B6C1,0xAFDADA75,0x42212163,0x20101030,0xE5FFFF1A,
+	0xFDF3F30E,0xBFD2D26D,0x81CDCD4C,0x180C0C14,0x26131335,0xC3ECEC2F,
+	0xBE5F5FE1,0x359797A2,0x884444CC,0x2E171739,0x93C4C457,0x55A7A7F2,
+	0xFC7E7E82,0x7A3D3D47,0xC86464AC,0xBA5D5DE7,0x3219192B,0xE6737395,
+	0xC06060A0,0x19818198,0x9E4F4FD1,0xA3DCDC7F,0x44222266,0x542A2A7E,
+	0x3B9090AB,0x0B888883,0x8C4646CA,0xC7EEEE29,0x6BB8B8D3,0x2814143C,
+	0xA7DEDE79,0xBC5E5EE2,0x160B0B1D,0xADDBDB76,0xDBE0E03B,0x64323256,
+	0x743A3A4E,0x140A0A1E,0x924949DB,0x0C06060A,0x4824246C,0xB85C5CE4,
+	0x9FC2C25D,0xBDD3D36E,0x43ACACEF,0xC46262A6,0x399191A8,0x319595A4,
+	0xD3E4E437,0xF279798B,0xD5E7E732,0x8BC8C843,0x6E373759,0xDA6D6DB7,
+	0x018D8D8C,0xB1D5D564,0x9C4E4ED2,0x49A9A9E0,0xD86C6CB4,0xAC5656FA,
+	0xF3F4F407,0xCFEAEA25,0xCA6565AF,0xF47A7A8E,0x47AEAEE9,0x10080818,
+	0x6FBABAD5,0xF0787888,0x4A25256F,0x5C2E2E72,0x381C1C24,0x57A6A6F1,
+	0x73B4B4C7,0x97C6C651,0xCBE8E823,0xA1DDDD7C,0xE874749C,0x3E1F1F21,
+	0x964B4BDD,0x61BDBDDC,0x0D8B8B86,0x0F8A8A85,0xE0707090,0x7C3E3E42,
+	0x71B5B5C4,0xCC6666AA,0x904848D8,0x06030305,0xF7F6F601,0x1C0E0E12,
+	0xC26161A3,0x6A35355F,0xAE5757F9,0x69B9B9D0,0x17868691,0x99C1C158,
+	0x3A1D1D27,0x279E9EB9,0xD9E1E138,0xEBF8F813,0x2B9898B3,0x22111133,
+	0xD26969BB,0xA9D9D970,0x078E8E89,0x339494A7,0x2D9B9BB6,0x3C1E1E22,
+	0x15878792,0xC9E9E920,0x87CECE49,0xAA5555FF,0x50282878,0xA5DFDF7A,
+	0x038C8C8F,0x59A1A1F8,0x09898980,0x1A0D0D17,0x65BFBFDA,0xD7E6E631,
+	0x844242C6,0xD06868B8,0x824141C3,0x299999B0,0x5A2D2D77,0x1E0F0F11,
+	0x7BB0B0CB,0xA85454FC,0x6DBBBBD6,0x2C16163A
+};
+#endif
+
 /***************** Macros (Inline Functions) Definitions *********************/
 // The least significant byte of the word is rotated to the end.
 #define AES_BLOCK_SIZE 16 /* AES operates on 16 bytes at a time */
 #define KE_ROTWORD(x) (((x) << 8) | ((x) >> 24))
+#ifdef XHDCP22_CMN_AES_TTABLE
+#define AES_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define AES_SBOX(x) ((u32)Aes_Sbox[((x) >> 4) & 0x0F][(x) & 0x0F])
+#define AES_GETU32(p) (((u32)(p)[0] << 24) | ((u32)(p)[1] << 16) | \
+                       ((u32)(p)[2] << 8) | ((u32)(p)[3]))
+#define AES_PUTU32(p, v) { (p)[0] = (u8)((v) >> 24); (p)[1] = (u8)((v) >> 16); \
+                           (p)[2] = (u8)((v) >> 8); (p)[3] = (u8)(v); }
+/* One column of a full round, the state words A, B, C, D supply rows 0-3 */
+#define AES_ROUND_COLUMN(A, B, C, D, K) (Aes_Te0[(A) >> 24] ^ \
+	AES_ROTR(Aes_Te0[((B) >> 16) & 0xFF], 8) ^ \
+	AES_ROTR(Aes_Te0[((C) >> 8) & 0xFF], 16) ^ \
+	AES_ROTR(Aes_Te0[(D) & 0xFF], 24) ^ (K))
+/* One column of the final round without MixColumns */
+#define AES_FINAL_COLUMN(A, B, C, D, K) (((AES_SBOX((A) >> 24) << 24) | \
+	(AES_SBOX(((B) >> 16) & 0xFF) << 16) | \
+	(AES_SBOX(((C) >> 8) & 0xFF) << 8) | \
+	AES_SBOX((D) & 0xFF)) ^ (K))
+#endif
+/* Number of CTR key stream blocks generated before each XOR pass */
+#define AES_CTR_BLOCKS 4
 
 /**************************** Type Definitions *******************************/
 
@@ -223,19 +307,21 @@ static const u8 Aes_GfMul[256][6] = {
 static u32  AesSubWord(u32 Word);
 static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits);
 static void AesAddRoundKey(u8 State[][4], const u32 W[]);
+#ifndef XHDCP22_CMN_AES_TTABLE
 static void AesSubBytes(u8 State[][4]);
-static void AesInvSubBytes(u8 State[][4]);
 static void AesShiftRows(u8 State[][4]);
-static void AesInvShiftRows(u8 State[][4]);
 static void AesMixColumns(u8 State[][4]);
+#endif
+static void AesInvSubBytes(u8 State[][4]);
+static void AesInvShiftRows(u8 State[][4]);
 static void AesInvMixColumns(u8 State[][4]);
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
-#ifdef AES_CIPHER_CTR_MODE
 static void Xor(u8 *C, const u8 *A, const u8 *B, u32 Size);
 static void AesIncrementIv(u8 Iv[], int CounterSize);
 static void AesEncryptCtr(const u8 In[], size_t InLen, u8 Out[],
 								  const u32 Key[], int KeySize, const u8 Iv[]);
+#ifdef AES_CIPHER_CTR_MODE
 static void AesDecryptCtr(const u8 In[], size_t InLen, u8 Out[],
 								 const u32 Key[], int KeySize, const u8 Iv[]);
 #endif
@@ -290,12 +376,72 @@ void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output)
 	AesDecrypt(Data, Output, KeySchedule, 128);
 }
 
-#ifdef AES_CIPHER_CTR_MODE
+/*****************************************************************************/
+/**
+*
+* This function encrypts consecutive 128 bit blocks independently (ECB) with
+* a key of size 128 bits. The key schedule is computed once for all the
+* blocks, e.g. for the dkey0 || dkey1 derivation.
+*
+* @param	Data is the NumBlocks*16 byte plaintext
+* @param	NumBlocks is the number of 16 byte blocks
+* @param	Key is the user supplied input key
+* @param	Output is the NumBlocks*16 byte ciphertext
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_Aes128EncryptBlocks(const u8 *Data, u32 NumBlocks, const u8 *Key, u8 *Output)
+{
+	u32 KeySchedule[60];
+	u32 Idx;
+
+	/* Setup the AES internal key */
+	AesKeySetup(Key, KeySchedule, 128);
+	for (Idx = 0; Idx < NumBlocks; Idx++) {
+		AesEncrypt(&Data[Idx * AES_BLOCK_SIZE], &Output[Idx * AES_BLOCK_SIZE],
+		           KeySchedule, 128);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts or decrypts data of any length in counter (CTR) mode
+* with a key of size 128 bits. The whole 16 byte counter block is
+* incremented as a big-endian integer.
+*
+* @param	Data is the input
+* @param	DataSize is the length of the input in bytes
+* @param	Key is the user supplied input key
+* @param	Iv is the 16 byte initial counter block
+* @param	Output is the output, same length as the input. It may be
+*			the same buffer as the input.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_Aes128EncryptCtr(const u8 *Data, u32 DataSize, const u8 *Key,
+                                 const u8 *Iv, u8 *Output)
+{
+	u32 KeySchedule[60];
+
+	/* Setup the AES internal key */
+	AesKeySetup(Key, KeySchedule, 128);
+	AesEncryptCtr(Data, DataSize, Output, KeySchedule, 128, Iv);
+}
+
 /****************************************************************************/
 /**
 *
 * This function calculates an XOR over each element of two equally sized
-* arrays.
+* arrays, a word at a time. The words are copied with memcpy(), which the
+* compiler turns into single loads and stores where the processor allows
+* unaligned accesses, so the arrays may have any alignment.
 *
 * C = A ^ B.
 *
@@ -306,17 +452,26 @@ void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output)
 *
 * @return	None.
 *
-* @note		None.
+* @note		C may be the same array as A or B.
 *
 *****************************************************************************/
 static void Xor(u8 *C, const u8 *A, const u8 *B, u32 Size)
 {
-	while(Size--)
-	{
-		C[Size] = A[Size] ^ B[Size];
+	u32 Idx = 0;
+	u32 WordA;
+	u32 WordB;
+
+	for (; (Idx + 4) <= Size; Idx += 4) {
+		memcpy(&WordA, &A[Idx], 4);
+		memcpy(&WordB, &B[Idx], 4);
+		WordA ^= WordB;
+		memcpy(&C[Idx], &WordA, 4);
+	}
+
+	for (; Idx < Size; Idx++) {
+		C[Idx] = A[Idx] ^ B[Idx];
 	}
 }
-#endif
 
 /*****************************************************************************/
 /**
@@ -445,6 +600,7 @@ static void AesAddRoundKey(u8 State[][4], const u32 w[])
 	State[3][3] ^= subkey[3];
 }
 
+#ifndef XHDCP22_CMN_AES_TTABLE
 /*****************************************************************************/
 /**
 *
@@ -478,38 +634,6 @@ static void AesSubBytes(u8 State[][4])
 	State[3][3] = Aes_Sbox[State[3][3] >> 4][State[3][3] & 0x0F];
 }
 
-/*****************************************************************************/
-/**
-*
-* This function Performs the inverted substates step.
-*
-* @param	State are the statevalues of the AES conversion
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesInvSubBytes(u8 State[][4])
-{
-	State[0][0] = Aes_Invsbox[State[0][0] >> 4][State[0][0] & 0x0F];
-	State[0][1] = Aes_Invsbox[State[0][1] >> 4][State[0][1] & 0x0F];
-	State[0][2] = Aes_Invsbox[State[0][2] >> 4][State[0][2] & 0x0F];
-	State[0][3] = Aes_Invsbox[State[0][3] >> 4][State[0][3] & 0x0F];
-	State[1][0] = Aes_Invsbox[State[1][0] >> 4][State[1][0] & 0x0F];
-	State[1][1] = Aes_Invsbox[State[1][1] >> 4][State[1][1] & 0x0F];
-	State[1][2] = Aes_Invsbox[State[1][2] >> 4][State[1][2] & 0x0F];
-	State[1][3] = Aes_Invsbox[State[1][3] >> 4][State[1][3] & 0x0F];
-	State[2][0] = Aes_Invsbox[State[2][0] >> 4][State[2][0] & 0x0F];
-	State[2][1] = Aes_Invsbox[State[2][1] >> 4][State[2][1] & 0x0F];
-	State[2][2] = Aes_Invsbox[State[2][2] >> 4][State[2][2] & 0x0F];
-	State[2][3] = Aes_Invsbox[State[2][3] >> 4][State[2][3] & 0x0F];
-	State[3][0] = Aes_Invsbox[State[3][0] >> 4][State[3][0] & 0x0F];
-	State[3][1] = Aes_Invsbox[State[3][1] >> 4][State[3][1] & 0x0F];
-	State[3][2] = Aes_Invsbox[State[3][2] >> 4][State[3][2] & 0x0F];
-	State[3][3] = Aes_Invsbox[State[3][3] >> 4][State[3][3] & 0x0F];
-}
-
 /*****************************************************************************/
 /**
 *
@@ -548,43 +672,6 @@ static void AesShiftRows(u8 State[][4])
 	State[3][1] = t;
 }
 
-/*****************************************************************************/
-/**
-*
-* All rows are shifted cylindrically to the right.
-*
-* @param	State are the statevalues of the AES conversion.
-*
-* @return	None.
-*
-* @note		None.
-*
-******************************************************************************/
-static void AesInvShiftRows(u8 State[][4])
-{
-	int t;
-
-	// Shift right by 1
-	t = State[1][3];
-	State[1][3] = State[1][2];
-	State[1][2] = State[1][1];
-	State[1][1] = State[1][0];
-	State[1][0] = t;
-	// Shift right by 2
-	t = State[2][3];
-	State[2][3] = State[2][1];
-	State[2][1] = t;
-	t = State[2][2];
-	State[2][2] = State[2][0];
-	State[2][0] = t;
-	// Shift right by 3
-	t = State[3][3];
-	State[3][3] = State[3][0];
-	State[3][0] = State[3][1];
-	State[3][1] = State[3][2];
-	State[3][2] = t;
-}
-
 /*****************************************************************************/
 /**
 *
@@ -690,6 +777,76 @@ static void AesMixColumns(u8 State[][4])
 	State[3][3] ^= Col[2];
 	State[3][3] ^= Aes_GfMul[Col[3]][0];
 }
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This function Performs the inverted substates step.
+*
+* @param	State are the statevalues of the AES conversion
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void AesInvSubBytes(u8 State[][4])
+{
+	State[0][0] = Aes_Invsbox[State[0][0] >> 4][State[0][0] & 0x0F];
+	State[0][1] = Aes_Invsbox[State[0][1] >> 4][State[0][1] & 0x0F];
+	State[0][2] = Aes_Invsbox[State[0][2] >> 4][State[0][2] & 0x0F];
+	State[0][3] = Aes_Invsbox[State[0][3] >> 4][State[0][3] & 0x0F];
+	State[1][0] = Aes_Invsbox[State[1][0] >> 4][State[1][0] & 0x0F];
+	State[1][1] = Aes_Invsbox[State[1][1] >> 4][State[1][1] & 0x0F];
+	State[1][2] = Aes_Invsbox[State[1][2] >> 4][State[1][2] & 0x0F];
+	State[1][3] = Aes_Invsbox[State[1][3] >> 4][State[1][3] & 0x0F];
+	State[2][0] = Aes_Invsbox[State[2][0] >> 4][State[2][0] & 0x0F];
+	State[2][1] = Aes_Invsbox[State[2][1] >> 4][State[2][1] & 0x0F];
+	State[2][2] = Aes_Invsbox[State[2][2] >> 4][State[2][2] & 0x0F];
+	State[2][3] = Aes_Invsbox[State[2][3] >> 4][State[2][3] & 0x0F];
+	State[3][0] = Aes_Invsbox[State[3][0] >> 4][State[3][0] & 0x0F];
+	State[3][1] = Aes_Invsbox[State[3][1] >> 4][State[3][1] & 0x0F];
+	State[3][2] = Aes_Invsbox[State[3][2] >> 4][State[3][2] & 0x0F];
+	State[3][3] = Aes_Invsbox[State[3][3] >> 4][State[3][3] & 0x0F];
+}
+
+/*****************************************************************************/
+/**
+*
+* All rows are shifted cylindrically to the right.
+*
+* @param	State are the statevalues of the AES conversion.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void AesInvShiftRows(u8 State[][4])
+{
+	int t;
+
+	// Shift right by 1
+	t = State[1][3];
+	State[1][3] = State[1][2];
+	State[1][2] = State[1][1];
+	State[1][1] = State[1][0];
+	State[1][0] = t;
+	// Shift right by 2
+	t = State[2][3];
+	State[2][3] = State[2][1];
+	State[2][1] = t;
+	t = State[2][2];
+	State[2][2] = State[2][0];
+	State[2][0] = t;
+	// Shift right by 3
+	t = State[3][3];
+	State[3][3] = State[3][0];
+	State[3][0] = State[3][1];
+	State[3][1] = State[3][2];
+	State[3][2] = t;
+}
 
 /*****************************************************************************/
 /**
@@ -793,7 +950,6 @@ static void AesInvMixColumns(u8 State[][4])
 	State[3][3] ^= Aes_GfMul[Col[3]][5];
 }
 
-#ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
 /**
 *
@@ -819,7 +975,6 @@ static void AesIncrementIv(u8 Iv[], int CounterSize)
 			break;
 	}
 }
-#endif
 
 /*****************************************************************************/
 /**
@@ -837,6 +992,52 @@ static void AesIncrementIv(u8 Iv[], int CounterSize)
 * 			can be used.
 *
 ******************************************************************************/
+#ifdef XHDCP22_CMN_AES_TTABLE
+static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
+{
+	u32 S0, S1, S2, S3;
+	u32 T0, T1, T2, T3;
+	int Round, Rounds;
+
+	switch (KeySize) {
+		case 192: Rounds = 12; break;
+		case 256: Rounds = 14; break;
+		default: Rounds = 10; break;
+	}
+
+	/* Load the columns of the state as big-endian words, as in the key
+	   schedule, and add the first round key. */
+	S0 = AES_GETU32(&In[0]) ^ Key[0];
+	S1 = AES_GETU32(&In[4]) ^ Key[1];
+	S2 = AES_GETU32(&In[8]) ^ Key[2];
+	S3 = AES_GETU32(&In[12]) ^ Key[3];
+
+	// Each full round does SubBytes, ShiftRows, MixColumns and AddRoundKey
+	// through the T-table. The last round does not perform MixColumns.
+	for (Round = 1; Round < Rounds; Round++) {
+		Key += 4;
+		T0 = AES_ROUND_COLUMN(S0, S1, S2, S3, Key[0]);
+		T1 = AES_ROUND_COLUMN(S1, S2, S3, S0, Key[1]);
+		T2 = AES_ROUND_COLUMN(S2, S3, S0, S1, Key[2]);
+		T3 = AES_ROUND_COLUMN(S3, S0, S1, S2, Key[3]);
+		S0 = T0;
+		S1 = T1;
+		S2 = T2;
+		S3 = T3;
+	}
+
+	Key += 4;
+	T0 = AES_FINAL_COLUMN(S0, S1, S2, S3, Key[0]);
+	T1 = AES_FINAL_COLUMN(S1, S2, S3, S0, Key[1]);
+	T2 = AES_FINAL_COLUMN(S2, S3, S0, S1, Key[2]);
+	T3 = AES_FINAL_COLUMN(S3, S0, S1, S2, Key[3]);
+
+	AES_PUTU32(&Out[0], T0);
+	AES_PUTU32(&Out[4], T1);
+	AES_PUTU32(&Out[8], T2);
+	AES_PUTU32(&Out[12], T3);
+}
+#else
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 {
 	u8 State[4][4];
@@ -925,6 +1126,7 @@ static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 	Out[14] = State[2][3];
 	Out[15] = State[3][3];
 }
+#endif
 
 /*****************************************************************************/
 /**
@@ -1026,11 +1228,12 @@ static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 }
 
 
-#ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
 /**
 *
-* This function encrypts using AES and a counter.
+* This function encrypts using AES and a counter. The key stream is
+* generated for AES_CTR_BLOCKS blocks at a time, then XORed with the input
+* in a single pass.
 *
 * @param	In is the plaintext
 * @param	InLen is any bytes length
@@ -1047,28 +1250,29 @@ static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 static void AesEncryptCtr(const u8 In[], size_t InLen, u8 Out[],
 								  const u32 Key[], int KeySize, const u8 Iv[])
 {
-	size_t Idx = 0, LastBlockLength;
-	u8 iv_buf[AES_BLOCK_SIZE], out_buf[AES_BLOCK_SIZE];
-
-	if (In != Out)
-		memcpy(Out, In, InLen);
+	size_t Idx = 0, Len, Offset;
+	u32 iv_buf[AES_BLOCK_SIZE / 4];
+	u32 out_buf[AES_CTR_BLOCKS * AES_BLOCK_SIZE / 4];
 
 	memcpy(iv_buf, Iv, AES_BLOCK_SIZE);
-	LastBlockLength = InLen - AES_BLOCK_SIZE;
 
-	if (InLen > AES_BLOCK_SIZE) {
-		for (Idx = 0; Idx < LastBlockLength; Idx += AES_BLOCK_SIZE) {
-			AesEncrypt(iv_buf, out_buf, Key, KeySize);
-			Xor(&Out[Idx], out_buf, &Out[Idx], AES_BLOCK_SIZE);
-			AesIncrementIv(iv_buf, AES_BLOCK_SIZE);
+	while (Idx < InLen) {
+		Len = InLen - Idx;
+		if (Len > sizeof(out_buf)) {
+			Len = sizeof(out_buf);
 		}
+
+		for (Offset = 0; Offset < Len; Offset += AES_BLOCK_SIZE) {
+			AesEncrypt((u8 *)iv_buf, (u8 *)out_buf + Offset, Key, KeySize);
+			AesIncrementIv((u8 *)iv_buf, AES_BLOCK_SIZE);
+		}
+		/* Use the Most Significant bytes of the last block. */
+		Xor(&Out[Idx], (u8 *)out_buf, &In[Idx], Len);
+		Idx += Len;
 	}
 
-	AesEncrypt(iv_buf, out_buf, Key, KeySize);
-	/* Use the Most Significant bytes. */
-	Xor(&Out[Idx], out_buf, &Out[Idx], InLen - Idx);
+	memset(out_buf, 0, sizeof(out_buf));
 }
-#endif
 
 #ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
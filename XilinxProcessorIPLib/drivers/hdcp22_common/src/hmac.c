@@ -16,6 +16,9 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
+* 1.10  ag   10/19/26 Added the HMAC key context and streaming API. The
+*                     data size of XHdcp22Cmn_HmacSha256Hash is no longer
+*                     limited by a local buffer.
 *</pre>
 *
 *****************************************************************************/
@@ -56,29 +59,52 @@
 * @param	HashedData is the output of this function.
 *
 * @return	- XST_SUCCESS if no errors occured
-*			- XST_FAILURE if the datasize execeeds the size of the local buffer.
+*			- XST_FAILURE if the datasize is negative.
 *
 * @note		None.
 *
 ******************************************************************************/
 int XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData)
 {
-	u8 Ipad[65];   /* inner padding-key XORd with ipad */
-	u8 Opad[65];   /* outer padding-key XORd with opad */
-	u8 Ktemp[SHA256_SIZE];
-	u8 Ktemp2[SHA256_SIZE];
-	u8 BufferIn[256];
-	u8 BufferOut[256];
-	int i;
+	XHdcp22Cmn_HmacSha256Key KeyCtx;
+	XHdcp22Cmn_HmacSha256Ctx Ctx;
 
-	memset(BufferIn, 0x00, 256);
-	memset(BufferOut, 0x00, 256);
-
-	/* If the input size exceeds the local buffers, return an error */
-	if(DataSize + 64 >  256) {
+	if(DataSize < 0) {
 		return XST_FAILURE;
 	}
 
+	XHdcp22Cmn_HmacSha256SetKey(&KeyCtx, Key, KeySize);
+	XHdcp22Cmn_HmacSha256Init(&Ctx, &KeyCtx);
+	XHdcp22Cmn_HmacSha256Update(&Ctx, Data, DataSize);
+	XHdcp22Cmn_HmacSha256Final(&Ctx, HashedData);
+
+	memset(&KeyCtx, 0, sizeof(KeyCtx));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prepares a HMAC_SHA256 key context. The key XOR ipad and
+* key XOR opad blocks are hashed once, so each message hashed with the
+* context saves two SHA256 compressions.
+*
+* @param	KeyCtx is the key context to initialize.
+* @param	Key is the hash-key to use.
+* @param	KeySize is the size of the hash key.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_HmacSha256SetKey(XHdcp22Cmn_HmacSha256Key *KeyCtx, const u8 *Key, int KeySize)
+{
+	u8 Pad[64];
+	u8 Ktemp[SHA256_SIZE];
+	int i;
+
 	/* If key is longer than 64 bytes reset it to Key=sha256(Key) */
 	if(KeySize > 64) {
 		XHdcp22Cmn_Sha256Hash(Key, KeySize, Ktemp );
@@ -86,28 +112,87 @@ int XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int K
 		KeySize = SHA256_SIZE;
 	}
 
-	/* start out by storing Key in pads */
-	memset(Ipad, 0, sizeof Ipad );
-	memset(Opad, 0, sizeof Opad );
-	memcpy(Ipad, Key, KeySize );
-	memcpy(Opad, Key, KeySize );
+	/* Inner state: SHA256(K XOR ipad, ...) */
+	memset(Pad, 0, sizeof Pad );
+	memcpy(Pad, Key, KeySize );
+	for(i = 0; i < 64; i++) {
+		Pad[i] ^= 0x36;
+	}
+	XHdcp22Cmn_Sha256Init(&KeyCtx->Inner);
+	XHdcp22Cmn_Sha256Update(&KeyCtx->Inner, Pad, 64);
 
-	/* XOR Key with Ipad and Opad values */
+	/* Outer state: SHA256(K XOR opad, ...), 0x36 ^ 0x5c = 0x6a */
 	for(i = 0; i < 64; i++) {
-		Ipad[i] ^= 0x36;
-		Opad[i] ^= 0x5c;
+		Pad[i] ^= 0x6a;
 	}
+	XHdcp22Cmn_Sha256Init(&KeyCtx->Outer);
+	XHdcp22Cmn_Sha256Update(&KeyCtx->Outer, Pad, 64);
+
+	memset(Pad, 0, sizeof Pad );
+	memset(Ktemp, 0, sizeof Ktemp );
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts a HMAC_SHA256 calculation with a key context.
+*
+* @param	Ctx is the message context.
+* @param	KeyCtx is the key context from XHdcp22Cmn_HmacSha256SetKey. It
+*			must remain valid until XHdcp22Cmn_HmacSha256Final.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_HmacSha256Init(XHdcp22Cmn_HmacSha256Ctx *Ctx, const XHdcp22Cmn_HmacSha256Key *KeyCtx)
+{
+	memcpy(&Ctx->Sha, &KeyCtx->Inner, sizeof(Ctx->Sha));
+	Ctx->Key = KeyCtx;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds data to a HMAC_SHA256 calculation.
+*
+* @param	Ctx is the message context.
+* @param	Data is the input data.
+* @param	Len is the size of the data buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_HmacSha256Update(XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Data, u32 Len)
+{
+	XHdcp22Cmn_Sha256Update(&Ctx->Sha, Data, Len);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function completes a HMAC_SHA256 calculation.
+*
+* @param	Ctx is the message context.
+* @param	HashedData is the 32 byte HMAC.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XHdcp22Cmn_HmacSha256Final(XHdcp22Cmn_HmacSha256Ctx *Ctx, u8 *HashedData)
+{
+	u8 InnerHash[SHA256_SIZE];
 
-	/* Execute inner SHA256 */
-	memcpy(BufferIn, Ipad, 64 );
-	memcpy(BufferIn + 64, Data, DataSize );
-	XHdcp22Cmn_Sha256Hash(BufferIn, 64 + DataSize, Ktemp2 );
+	XHdcp22Cmn_Sha256Final(&Ctx->Sha, InnerHash);
 
-	/* Execute outer SHA256 */
-	memcpy(BufferOut, Opad, 64);
-	memcpy(BufferOut + 64, Ktemp2, SHA256_SIZE );
-	XHdcp22Cmn_Sha256Hash(BufferOut, 64 + SHA256_SIZE,
-						(u8 *)HashedData );
+	memcpy(&Ctx->Sha, &Ctx->Key->Outer, sizeof(Ctx->Sha));
+	XHdcp22Cmn_Sha256Update(&Ctx->Sha, InnerHash, SHA256_SIZE);
+	XHdcp22Cmn_Sha256Final(&Ctx->Sha, HashedData);
 
-	return XST_SUCCESS;
+	memset(Ctx, 0, sizeof(*Ctx));
 }
@@ -16,6 +16,9 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.10  GM   10/14/19 Added "volatile" attribute to all "i" variables
+* 1.20  ag   10/19/26 Added the streaming init/update/final API, unrolled
+*                     Sha256Transform and block-wise Sha256Update. The
+*                     loop counters of 1.10 are kept volatile.
 *</pre>
 *
 *****************************************************************************/
@@ -23,14 +26,10 @@
 /***************************** Include Files ********************************/
 #include "string.h"
 #include "xil_types.h"
+#include "xhdcp22_common.h"
 
 /**************************** Type Definitions ******************************/
-typedef struct {
-   u8 data[64];
-   u32 datalen;
-   u32 bitlen[2];
-   u32 state[8];
-} Sha256Type;
+typedef XHdcp22Cmn_Sha256Ctx Sha256Type;
 
 /***************** Macros (Inline Functions) Definitions ********************/
 // DBL_INT_ADD treats two unsigned ints a and b as one 64-bit integer and adds c to it
@@ -45,6 +44,16 @@ typedef struct {
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
+// One round of the compression function. The working variables are renamed
+// by the caller instead of being shifted.
+#define SHA256_ROUND(a,b,c,d,e,f,g,h,K,M) { \
+   u32 t1 = (h) + EP1(e) + CH(e,f,g) + (K) + (M); \
+   (d) += t1; \
+   (h) = t1 + EP0(a) + MAJ(a,b,c); }
+// Message schedule word i >= 16 in a circular buffer of 16 words
+#define SHA256_SCHED(m,i) ((m)[(i) & 15] += SIG1((m)[((i) - 2) & 15]) + \
+   (m)[((i) - 7) & 15] + SIG0((m)[((i) - 15) & 15]))
+
 /************************** Variable Definitions ****************************/
 static const u32 k[64] = {
    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
@@ -60,10 +69,7 @@ static const u32 k[64] = {
 /************************** Function Prototypes *****************************/
 
 /* SHA-256 Hashing */
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data);
-static void Sha256Init(Sha256Type *Ctx);
-static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len);
-static void Sha256Final(Sha256Type *Ctx, u8 *Hash);
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data);
 
 /************************** Function Implementation *****************************/
 
@@ -85,10 +91,10 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 {
 	Sha256Type Ctx;
 
-	Sha256Init(&Ctx);
+	XHdcp22Cmn_Sha256Init(&Ctx);
 
-	Sha256Update(&Ctx, Data, DataSize);
-	Sha256Final(&Ctx, HashedData);
+	XHdcp22Cmn_Sha256Update(&Ctx, Data, DataSize);
+	XHdcp22Cmn_Sha256Final(&Ctx, HashedData);
 }
 
 /*****************************************************************************/
@@ -103,15 +109,13 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data)
 {
   volatile u32 i;
-  u32 a,b,c,d,e,f,g,h,j,t1,t2,m[64];
+  u32 a,b,c,d,e,f,g,h,m[16];
 
-   for (i=0,j=0; i < 16; ++i, j += 4)
-      m[i] = (Data[j] << 24) | (Data[j+1] << 16) | (Data[j+2] << 8) | (Data[j+3]);
-   for ( ; i < 64; ++i)
-      m[i] = SIG1(m[i-2]) + m[i-7] + SIG0(m[i-15]) + m[i-16];
+   for (i=0; i < 16; ++i)
+      m[i] = (Data[4*i] << 24) | (Data[4*i+1] << 16) | (Data[4*i+2] << 8) | (Data[4*i+3]);
 
    a = Ctx->state[0];
    b = Ctx->state[1];
@@ -122,17 +126,28 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
    g = Ctx->state[6];
    h = Ctx->state[7];
 
-   for (i = 0; i < 64; ++i) {
-      t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-      t2 = EP0(a) + MAJ(a,b,c);
-      h = g;
-      g = f;
-      f = e;
-      e = d + t1;
-      d = c;
-      c = b;
-      b = a;
-      a = t1 + t2;
+   // Rounds 0-15 use the message words as loaded.
+   for (i = 0; i < 16; i += 8) {
+      SHA256_ROUND(a,b,c,d,e,f,g,h,k[i+0],m[i+0]);
+      SHA256_ROUND(h,a,b,c,d,e,f,g,k[i+1],m[i+1]);
+      SHA256_ROUND(g,h,a,b,c,d,e,f,k[i+2],m[i+2]);
+      SHA256_ROUND(f,g,h,a,b,c,d,e,k[i+3],m[i+3]);
+      SHA256_ROUND(e,f,g,h,a,b,c,d,k[i+4],m[i+4]);
+      SHA256_ROUND(d,e,f,g,h,a,b,c,k[i+5],m[i+5]);
+      SHA256_ROUND(c,d,e,f,g,h,a,b,k[i+6],m[i+6]);
+      SHA256_ROUND(b,c,d,e,f,g,h,a,k[i+7],m[i+7]);
+   }
+
+   // Rounds 16-63 extend the message schedule in place.
+   for ( ; i < 64; i += 8) {
+      SHA256_ROUND(a,b,c,d,e,f,g,h,k[i+0],SHA256_SCHED(m,i+0));
+      SHA256_ROUND(h,a,b,c,d,e,f,g,k[i+1],SHA256_SCHED(m,i+1));
+      SHA256_ROUND(g,h,a,b,c,d,e,f,k[i+2],SHA256_SCHED(m,i+2));
+      SHA256_ROUND(f,g,h,a,b,c,d,e,k[i+3],SHA256_SCHED(m,i+3));
+      SHA256_ROUND(e,f,g,h,a,b,c,d,k[i+4],SHA256_SCHED(m,i+4));
+      SHA256_ROUND(d,e,f,g,h,a,b,c,k[i+5],SHA256_SCHED(m,i+5));
+      SHA256_ROUND(c,d,e,f,g,h,a,b,k[i+6],SHA256_SCHED(m,i+6));
+      SHA256_ROUND(b,c,d,e,f,g,h,a,k[i+7],SHA256_SCHED(m,i+7));
    }
 
    Ctx->state[0] += a;
@@ -156,7 +171,7 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Init(Sha256Type *Ctx)
+void XHdcp22Cmn_Sha256Init(XHdcp22Cmn_Sha256Ctx *Ctx)
 {
    Ctx->datalen = 0;
    Ctx->bitlen[0] = 0;
@@ -175,6 +190,7 @@ static void Sha256Init(Sha256Type *Ctx)
 /**
 *
 * This function updates the SHA data before adding padding data.
+* It may be called any number of times between init and final.
 *
 * @param  Ctx is the context data for SHA256.
 * @param  Data is the input data.
@@ -185,25 +201,37 @@ static void Sha256Init(Sha256Type *Ctx)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
+void XHdcp22Cmn_Sha256Update(XHdcp22Cmn_Sha256Ctx *Ctx, const u8 *Data, u32 Len)
 {
    volatile u32 i;
+   u32 Size;
 
-   for (i=0; i < Len; ++i) {
-      Ctx->data[Ctx->datalen] = Data[i];
-      Ctx->datalen++;
-      if (Ctx->datalen == 64) {
-	  Sha256Transform(Ctx,Ctx->data);
-         DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
+   for (i=0; i < Len; i += Size) {
+      if ((Ctx->datalen == 0) && (Len - i >= 64)) {
+         // Transform complete blocks directly from the input.
+         Sha256Transform(Ctx,&Data[i]);
+         Size = 64;
+      }
+      else {
+         Size = 64 - Ctx->datalen;
+         if (Size > Len - i)
+            Size = Len - i;
+         memcpy(&Ctx->data[Ctx->datalen], &Data[i], Size);
+         Ctx->datalen += Size;
+         if (Ctx->datalen < 64)
+            break;
+         Sha256Transform(Ctx,Ctx->data);
          Ctx->datalen = 0;
       }
+      DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
    }
 }
 
 /*****************************************************************************/
 /**
 *
-* This function adds padding
+* This function adds padding and writes the hash. The context must be
+* initialized again before it is reused.
 *
 * @param  Ctx is the context data for SHA256.
 * @param  Hash is the calculated hash (256-bits).
@@ -213,7 +241,7 @@ static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Final(Sha256Type *Ctx, u8 *Hash)
+void XHdcp22Cmn_Sha256Final(XHdcp22Cmn_Sha256Ctx *Ctx, u8 *Hash)
 {
    volatile u32 i;
 
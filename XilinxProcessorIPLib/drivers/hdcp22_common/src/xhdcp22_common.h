@@ -17,6 +17,10 @@
 * 1.00  MH   10/30/15 First Release.
 * 1.01  MH   01/15/16 Added prefix to function names.
 * 2.00  MH   06/21/17 Changed DIGIT_T type to u32 for ARM support.
+* 2.10  ag   10/19/26 Added multi-block AES-128 ECB encryption.
+*       ag   10/19/26 Added streaming SHA256 and HMAC-SHA256 with a
+*                     precomputed key context.
+*       ag   10/19/26 Added multi-block AES-128 CTR encryption.
 *</pre>
 *
 *****************************************************************************/
@@ -35,6 +39,34 @@ extern "C" {
 
 /**************************** Type Definitions ******************************/
 
+/**
+* SHA256 context for XHdcp22Cmn_Sha256Init/Update/Final.
+*/
+typedef struct {
+	u8  data[64];   /**< Partial input block */
+	u32 datalen;    /**< Bytes in the partial block */
+	u32 bitlen[2];  /**< Hashed length in bits, low word first */
+	u32 state[8];   /**< Intermediate hash value */
+} XHdcp22Cmn_Sha256Ctx;
+
+/**
+* HMAC-SHA256 key context, holding the SHA256 states after the key XOR ipad
+* and key XOR opad blocks. It may be reused for any number of messages with
+* the same key.
+*/
+typedef struct {
+	XHdcp22Cmn_Sha256Ctx Inner; /**< State after the key XOR ipad block */
+	XHdcp22Cmn_Sha256Ctx Outer; /**< State after the key XOR opad block */
+} XHdcp22Cmn_HmacSha256Key;
+
+/**
+* HMAC-SHA256 message context for XHdcp22Cmn_HmacSha256Init/Update/Final.
+*/
+typedef struct {
+	XHdcp22Cmn_Sha256Ctx Sha;            /**< Inner hash of the message */
+	const XHdcp22Cmn_HmacSha256Key *Key; /**< Key context */
+} XHdcp22Cmn_HmacSha256Ctx;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 /************************** Function Prototypes *****************************/
@@ -42,8 +74,18 @@ extern "C" {
 /* Cryptographic functions */
 void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData);
 int  XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData);
+void XHdcp22Cmn_Sha256Init(XHdcp22Cmn_Sha256Ctx *Ctx);
+void XHdcp22Cmn_Sha256Update(XHdcp22Cmn_Sha256Ctx *Ctx, const u8 *Data, u32 Len);
+void XHdcp22Cmn_Sha256Final(XHdcp22Cmn_Sha256Ctx *Ctx, u8 *Hash);
+void XHdcp22Cmn_HmacSha256SetKey(XHdcp22Cmn_HmacSha256Key *KeyCtx, const u8 *Key, int KeySize);
+void XHdcp22Cmn_HmacSha256Init(XHdcp22Cmn_HmacSha256Ctx *Ctx, const XHdcp22Cmn_HmacSha256Key *KeyCtx);
+void XHdcp22Cmn_HmacSha256Update(XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Data, u32 Len);
+void XHdcp22Cmn_HmacSha256Final(XHdcp22Cmn_HmacSha256Ctx *Ctx, u8 *HashedData);
 void XHdcp22Cmn_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output);
 void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128EncryptBlocks(const u8 *Data, u32 NumBlocks, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128EncryptCtr(const u8 *Data, u32 DataSize, const u8 *Key,
+                                 const u8 *Iv, u8 *Output);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,382 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_rx_crypt_test.c
+*
+* This file checks the key derivations and hashes of the receiver on the host
+* against the R1 and R2 facsimile vectors: H', Ekh(km), L' and ks from
+* Edkey(ks) for R1 and R2, the km of the stored km path from Ekh(km), and
+* V', V and M' for R1. It is built with the hdcp22_rx driver, and with
+* hdcp22_rx_dp when HDCP22_RX_MODEL_DP is defined, both with the software
+* Montgomery multiplication, _XHDCP22_RX_SW_MMULT_.
+*
+* The time of every computation is printed, and the time of the crypto of a
+* full exchange, AKE with and without a stored km, LC, SKE and, for a
+* repeater, V' and M'. The RSA decryption of the AKE without a stored km
+* uses the software Montgomery multiplication, on the target it runs on the
+* MMULT core and takes less time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.1   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef HDCP22_RX_MODEL_DP
+#include "xhdcp22_rx_dp.h"
+#include "xhdcp22_rx_dp_i.h"
+#else
+#include "xhdcp22_rx.h"
+#include "xhdcp22_rx_i.h"
+#endif
+#include "hdcp22_rx_kat.h"
+
+/************************** Constant Definitions *****************************/
+#define NUM_TIMED	20000	/* Timed calls */
+#define NUM_TIMED_AKE	20	/* Timed exchanges with an RSA decryption */
+
+/**************************** Type Definitions *******************************/
+#ifdef HDCP22_RX_MODEL_DP
+typedef XHdcp22_Rx_Dp RxInstance;
+typedef XHdcp22_Rx_Dp_SessionKeys SessionKeys;
+#else
+typedef XHdcp22_Rx RxInstance;
+typedef XHdcp22_Rx_SessionKeys SessionKeys;
+#endif
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int SetKey(int Set);
+static int TestSet(int Set);
+static int TestRepeater(void);
+static int TimeCalls(void);
+static void ComputeM(int Set, u8 *M);
+static double Elapsed(const struct timespec *Start, int Count);
+
+/************************** Variable Definitions *****************************/
+static RxInstance RxInst;
+static XHdcp22_Rx_KprivRx KprivRx;
+static SessionKeys Keys[HDCP22_RX_KAT_NUM];
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	int Set;
+
+	for (Set = 0; Set < HDCP22_RX_KAT_NUM; Set++) {
+		if ((SetKey(Set) != XST_SUCCESS) ||
+		    (TestSet(Set) != XST_SUCCESS)) {
+			return 1;
+		}
+	}
+	if ((TestRepeater() != XST_SUCCESS) ||
+	    (SetKey(0) != XST_SUCCESS) ||
+	    (TimeCalls() != XST_SUCCESS)) {
+		return 1;
+	}
+
+	printf("Successfully ran crypt test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the private key of a vector set and computes the
+* Montgomery constants of p and q, as XHdcp22Rx_SetKeys() does.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int SetKey(int Set)
+{
+	memset(&RxInst, 0, sizeof(RxInst));
+	memcpy(&KprivRx, Hdcp22RxKat_KprivRx[Set], sizeof(KprivRx));
+	CHECK(XHdcp22Rx_CalcMontNPrime(RxInst.NPrimeP, KprivRx.p,
+			XHDCP22_RX_P_SIZE / 4) == XST_SUCCESS, "NPrimeP");
+	CHECK(XHdcp22Rx_CalcMontNPrime(RxInst.NPrimeQ, KprivRx.q,
+			XHDCP22_RX_P_SIZE / 4) == XST_SUCCESS, "NPrimeQ");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks H', Ekh(km), km from Ekh(km), L' and ks of a vector
+* set.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestSet(int Set)
+{
+	u8 HPrime[XHDCP22_RX_HPRIME_SIZE];
+	u8 LPrime[XHDCP22_RX_LPRIME_SIZE];
+	u8 M[XHDCP22_RX_RTX_SIZE + XHDCP22_RX_RRX_SIZE];
+	u8 Ekh[XHDCP22_RX_EKH_SIZE];
+	u8 Km[XHDCP22_RX_KM_SIZE];
+	u8 Ks[XHDCP22_RX_KS_SIZE];
+
+	XHdcp22Rx_ComputeSessionKeys(Hdcp22RxKat_Km[Set], Hdcp22RxKat_Rrx[Set],
+		Hdcp22RxKat_Rtx[Set], &Keys[Set]);
+
+	XHdcp22Rx_ComputeHPrime(&Keys[Set], Hdcp22RxKat_Rtx[Set],
+		Hdcp22RxKat_RxCaps[Set], Hdcp22RxKat_TxCaps, HPrime);
+	CHECK(memcmp(HPrime, Hdcp22RxKat_HPrime[Set], sizeof(HPrime)) == 0,
+			"H' differs");
+
+	/* Pairing, and the stored km of the next AKE */
+	ComputeM(Set, M);
+	XHdcp22Rx_ComputeEkh(Hdcp22RxKat_KprivRx[Set], Hdcp22RxKat_Km[Set], M,
+		Ekh);
+	CHECK(memcmp(Ekh, Hdcp22RxKat_Ekh[Set], sizeof(Ekh)) == 0,
+			"Ekh(km) differs");
+	XHdcp22Rx_ComputeEkh(Hdcp22RxKat_KprivRx[Set], Hdcp22RxKat_Ekh[Set], M,
+		Km);
+	CHECK(memcmp(Km, Hdcp22RxKat_Km[Set], sizeof(Km)) == 0,
+			"km from Ekh(km) differs");
+
+	XHdcp22Rx_ComputeLPrime(&Keys[Set], Hdcp22RxKat_Rn[Set], LPrime);
+	CHECK(memcmp(LPrime, Hdcp22RxKat_LPrime[Set], sizeof(LPrime)) == 0,
+			"L' differs");
+
+	XHdcp22Rx_ComputeKs(Hdcp22RxKat_Rrx[Set], Hdcp22RxKat_Rtx[Set],
+		Hdcp22RxKat_Km[Set], Hdcp22RxKat_Rn[Set], Hdcp22RxKat_Eks[Set],
+		Ks);
+	CHECK(memcmp(Ks, Hdcp22RxKat_Ks, sizeof(Ks)) == 0, "ks differs");
+
+	printf("R%d: H', Ekh(km), km, L' and ks match\r\n", Set + 1);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks V', V and M' of the R1 repeater vectors, with the
+* key states of R1 computed by TestSet.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRepeater(void)
+{
+	u8 VPrime[XHDCP22_RX_VPRIME_SIZE];
+	u8 MPrime[XHDCP22_RX_MPRIME_SIZE];
+
+	XHdcp22Rx_ComputeVPrime(Hdcp22RxKat_RcvIdList, HDCP22_RX_KAT_NUM_RCVID,
+		Hdcp22RxKat_RxInfo, Hdcp22RxKat_SeqNumV, &Keys[0], VPrime);
+	CHECK(memcmp(VPrime, Hdcp22RxKat_VPrime,
+			sizeof(Hdcp22RxKat_VPrime)) == 0, "V' differs");
+	CHECK(memcmp(&VPrime[sizeof(Hdcp22RxKat_VPrime)], Hdcp22RxKat_V,
+			sizeof(Hdcp22RxKat_V)) == 0, "V differs");
+
+	XHdcp22Rx_ComputeMPrime(Hdcp22RxKat_StreamIdType, Hdcp22RxKat_SeqNumM,
+		&Keys[0], MPrime);
+	CHECK(memcmp(MPrime, Hdcp22RxKat_MPrime, sizeof(MPrime)) == 0,
+			"M' differs");
+
+	printf("R1: V', V and M' match\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time of the computations of R1, then the time of
+* the crypto of the exchanges, in the order of the driver:
+* - AKE without a stored km: RSA decryption of Ekpub(km), key states, H'
+*   and Ekh(km).
+* - AKE with a stored km: km from Ekh(km), key states and H'.
+* - LC and SKE: L' and ks.
+* - Repeater: V' and M'.
+* The message transfers and the state machine are not part of the time.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TimeCalls(void)
+{
+	struct timespec Start;
+	SessionKeys TimedKeys;
+	u8 M[XHDCP22_RX_RTX_SIZE + XHDCP22_RX_RRX_SIZE];
+	u8 Ekm[XHDCP22_RX_N_SIZE];
+	u8 Km[XHDCP22_RX_N_SIZE];
+	u8 Out[XHDCP22_RX_HASH_SIZE];
+	double Rsa;
+	double Ake;
+	double StoredAke;
+	double Lc;
+	double Ske;
+	double Repeater;
+	int KmLen;
+	int Run;
+
+	ComputeM(0, M);
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeSessionKeys(Hdcp22RxKat_Km[0],
+			Hdcp22RxKat_Rrx[0], Hdcp22RxKat_Rtx[0], &TimedKeys);
+	}
+	printf("Key states: %.2f us\r\n", Elapsed(&Start, NUM_TIMED));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeHPrime(&Keys[0], Hdcp22RxKat_Rtx[0],
+			Hdcp22RxKat_RxCaps[0], Hdcp22RxKat_TxCaps, Out);
+	}
+	printf("H':         %.2f us\r\n", Elapsed(&Start, NUM_TIMED));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeEkh(Hdcp22RxKat_KprivRx[0],
+			Hdcp22RxKat_Km[0], M, Out);
+	}
+	printf("Ekh(km):    %.2f us\r\n", Elapsed(&Start, NUM_TIMED));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeLPrime(&Keys[0], Hdcp22RxKat_Rn[0], Out);
+	}
+	Lc = Elapsed(&Start, NUM_TIMED);
+	printf("L':         %.2f us\r\n", Lc);
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeKs(Hdcp22RxKat_Rrx[0], Hdcp22RxKat_Rtx[0],
+			Hdcp22RxKat_Km[0], Hdcp22RxKat_Rn[0],
+			Hdcp22RxKat_Eks[0], Out);
+	}
+	Ske = Elapsed(&Start, NUM_TIMED);
+	printf("ks:         %.2f us\r\n", Ske);
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeVPrime(Hdcp22RxKat_RcvIdList,
+			HDCP22_RX_KAT_NUM_RCVID, Hdcp22RxKat_RxInfo,
+			Hdcp22RxKat_SeqNumV, &Keys[0], Out);
+		XHdcp22Rx_ComputeMPrime(Hdcp22RxKat_StreamIdType,
+			Hdcp22RxKat_SeqNumM, &Keys[0], Out);
+	}
+	Repeater = Elapsed(&Start, NUM_TIMED);
+	printf("V' and M':  %.2f us\r\n", Repeater);
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED_AKE; Run++) {
+		memcpy(Ekm, Hdcp22RxKat_Ekm[0], sizeof(Ekm));
+		KmLen = 0;
+		CHECK(XHdcp22Rx_RsaesOaepDecrypt(&RxInst, &KprivRx, Ekm, Km,
+				&KmLen) == XST_SUCCESS, "decryption failed");
+	}
+	Rsa = Elapsed(&Start, NUM_TIMED_AKE);
+	CHECK(memcmp(Km, Hdcp22RxKat_Km[0], XHDCP22_RX_KM_SIZE) == 0,
+			"km differs");
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeSessionKeys(Hdcp22RxKat_Km[0],
+			Hdcp22RxKat_Rrx[0], Hdcp22RxKat_Rtx[0], &TimedKeys);
+		XHdcp22Rx_ComputeHPrime(&TimedKeys, Hdcp22RxKat_Rtx[0],
+			Hdcp22RxKat_RxCaps[0], Hdcp22RxKat_TxCaps, Out);
+		XHdcp22Rx_ComputeEkh(Hdcp22RxKat_KprivRx[0],
+			Hdcp22RxKat_Km[0], M, Out);
+	}
+	Ake = Rsa + Elapsed(&Start, NUM_TIMED);
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Rx_ComputeEkh(Hdcp22RxKat_KprivRx[0],
+			Hdcp22RxKat_Ekh[0], M, Km);
+		XHdcp22Rx_ComputeSessionKeys(Km, Hdcp22RxKat_Rrx[0],
+			Hdcp22RxKat_Rtx[0], &TimedKeys);
+		XHdcp22Rx_ComputeHPrime(&TimedKeys, Hdcp22RxKat_Rtx[0],
+			Hdcp22RxKat_RxCaps[0], Hdcp22RxKat_TxCaps, Out);
+	}
+	StoredAke = Elapsed(&Start, NUM_TIMED);
+
+	printf("RSA decryption (software Montgomery): %.2f us\r\n", Rsa);
+	printf("AKE+LC+SKE, no stored km:             %.2f us\r\n",
+		Ake + Lc + Ske);
+	printf("AKE+LC+SKE+repeater, no stored km:    %.2f us\r\n",
+		Ake + Lc + Ske + Repeater);
+	printf("AKE+LC+SKE, stored km:                %.2f us\r\n",
+		StoredAke + Lc + Ske);
+	printf("AKE+LC+SKE+repeater, stored km:       %.2f us\r\n",
+		StoredAke + Lc + Ske + Repeater);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function concatenates m = rtx || rrx of a vector set, the AES input
+* of Ekh(km).
+*
+* @param	Set is the vector set.
+* @param	M is the output, XHDCP22_RX_RTX_SIZE + XHDCP22_RX_RRX_SIZE
+*		bytes.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ComputeM(int Set, u8 *M)
+{
+	memcpy(M, Hdcp22RxKat_Rtx[Set], XHDCP22_RX_RTX_SIZE);
+	memcpy(M + XHDCP22_RX_RTX_SIZE, Hdcp22RxKat_Rrx[Set],
+		XHDCP22_RX_RRX_SIZE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time per timed call since Start, in us.
+*
+* @param	Start is the time before the first call.
+* @param	Count is the number of calls.
+*
+* @return	The time per call in us.
+*
+******************************************************************************/
+static double Elapsed(const struct timespec *Start, int Count)
+{
+	struct timespec End;
+
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	return ((double)(End.tv_sec - Start->tv_sec) * 1e6 +
+		(double)(End.tv_nsec - Start->tv_nsec) / 1e3) / Count;
+}
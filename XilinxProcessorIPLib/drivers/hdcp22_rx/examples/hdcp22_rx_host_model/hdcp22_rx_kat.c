@@ -0,0 +1,334 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_rx_kat.c
+*
+* This file contains the known answer vectors of the receiver, R1 and R2 of
+* the DCP facsimile keys. They are the vectors of the _XHDCP22_RX_TEST_
+* directed tests in xhdcp22_rx_test.c.
+* The R1 repeater vectors of the errata check V' and M'.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.1   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "hdcp22_rx_kat.h"
+
+/************************** Variable Definitions *****************************/
+/* Public key of the receiver certificate, modulus and exponent */
+const u8 Hdcp22RxKat_KpubRx[2][131] = {
+	/* R1 */
+	{
+		0xaf, 0xb5, 0xc5, 0xc6, 0x7b, 0xc5, 0x3a, 0x34, 0x90, 0xa9, 0x54, 0xc0,
+		0x8f, 0xb7, 0xeb, 0xa1, 0x54, 0xd2, 0x4f, 0x22, 0xde, 0x83, 0xf5, 0x03,
+		0xa6, 0xc6, 0x68, 0x46, 0x9b, 0xc0, 0xb8, 0xc8, 0x6c, 0xdb, 0x26, 0xf9,
+		0x3c, 0x49, 0x2f, 0x02, 0xe1, 0x71, 0xdf, 0x4e, 0xf3, 0x0e, 0xc8, 0xbf,
+		0x22, 0x9d, 0x04, 0xcf, 0xbf, 0xa9, 0x0d, 0xff, 0x68, 0xab, 0x05, 0x6f,
+		0x1f, 0x12, 0x8a, 0x68, 0x62, 0xeb, 0xfe, 0xc9, 0xea, 0x9f, 0xa7, 0xfb,
+		0x8c, 0xba, 0xb1, 0xbd, 0x65, 0xac, 0x35, 0x9c, 0xa0, 0x33, 0xb1, 0xdd,
+		0xa6, 0x05, 0x36, 0xaf, 0x00, 0xa2, 0x7f, 0xbc, 0x07, 0xb2, 0xdd, 0xb5,
+		0xcc, 0x57, 0x5c, 0xdc, 0xc0, 0x95, 0x50, 0xe5, 0xff, 0x1f, 0x20, 0xdb,
+		0x59, 0x46, 0xfa, 0x47, 0xc4, 0xed, 0x12, 0x2e, 0x9e, 0x22, 0xbd, 0x95,
+		0xa9, 0x85, 0x59, 0xa1, 0x59, 0x3c, 0xc7, 0x83, 0x01, 0x00, 0x01
+	},
+	/* R2 */
+	{
+		0xe4, 0x68, 0x63, 0x8a, 0xda, 0x97, 0x2d, 0xde, 0x9a, 0x8d, 0x1c, 0xb1,
+		0x65, 0x4b, 0x85, 0x8d, 0xe5, 0x46, 0xd6, 0xdb, 0x95, 0xa5, 0xf6, 0x66,
+		0x74, 0xea, 0x81, 0x0b, 0x9a, 0x58, 0x58, 0x66, 0x26, 0x86, 0xa6, 0xb4,
+		0x56, 0x2b, 0x29, 0x43, 0xe5, 0xbb, 0x81, 0x74, 0x86, 0xa7, 0xb7, 0x16,
+		0x2f, 0x07, 0xec, 0xd1, 0xb5, 0xf9, 0xae, 0x4f, 0x98, 0x89, 0xa9, 0x91,
+		0x7d, 0x58, 0x5b, 0x8d, 0x20, 0xd5, 0xc5, 0x08, 0x40, 0x3b, 0x86, 0xaf,
+		0xf4, 0xd6, 0xb9, 0x20, 0x95, 0xe8, 0x90, 0x3b, 0x8f, 0x9f, 0x36, 0x5b,
+		0x46, 0xb6, 0xd4, 0x1e, 0xf5, 0x05, 0x88, 0x80, 0x14, 0xe7, 0x2c, 0x77,
+		0x5d, 0x6e, 0x54, 0xe9, 0x65, 0x81, 0x5a, 0x68, 0x92, 0xa5, 0xd6, 0x40,
+		0x78, 0x11, 0x97, 0x65, 0xd7, 0x64, 0x36, 0x5e, 0x8d, 0x2a, 0x87, 0xa8,
+		0xeb, 0x7d, 0x06, 0x2c, 0x10, 0xf8, 0x0a, 0x7d, 0x01, 0x00, 0x01
+	}
+};
+
+/* Private key quintuple: p, q, dP, dQ and qInv */
+const u8 Hdcp22RxKat_KprivRx[2][320] = {
+	/* R1 */
+	{
+		0xec, 0xbe, 0xe5, 0x5b, 0x9e, 0x7a, 0x50, 0x8a, 0x96, 0x80, 0xc8, 0xdb,
+		0xb0, 0xed, 0x44, 0xf2, 0xba, 0x1d, 0x5d, 0x80, 0xc1, 0xc8, 0xb3, 0xc2,
+		0x74, 0xde, 0xee, 0x28, 0xec, 0xdc, 0x78, 0xc8, 0x67, 0x53, 0x07, 0xf2,
+		0xf8, 0x75, 0x9c, 0x4c, 0xa5, 0x6c, 0x48, 0x94, 0xc8, 0xeb, 0xad, 0xd7,
+		0x7d, 0xd2, 0xea, 0xdf, 0x74, 0x20, 0x62, 0xc9, 0x81, 0xa8, 0x3c, 0x36,
+		0xb9, 0xea, 0x40, 0xfd, 0xbe, 0x00, 0x19, 0x76, 0xc6, 0xb4, 0xba, 0x19,
+		0xd4, 0x69, 0xfa, 0x4d, 0xe2, 0xf8, 0x30, 0x27, 0x36, 0x2b, 0x4c, 0xc4,
+		0x34, 0xab, 0xd3, 0xd9, 0x8c, 0xd6, 0xb8, 0x0d, 0x37, 0x5e, 0x59, 0x4b,
+		0x76, 0x70, 0x68, 0x2b, 0x1f, 0x4c, 0x3d, 0x47, 0x5f, 0xa5, 0xb1, 0xcd,
+		0x74, 0x56, 0x88, 0xfe, 0x7c, 0xf8, 0x3b, 0x30, 0x6f, 0xfd, 0xc3, 0xed,
+		0x87, 0x3c, 0xa1, 0x53, 0x84, 0xc3, 0xd2, 0x7f, 0x60, 0x71, 0x9b, 0xe9,
+		0xe8, 0xf3, 0x97, 0x1f, 0xfe, 0x13, 0xd4, 0xbf, 0x7a, 0xa2, 0x0d, 0xf6,
+		0x7b, 0xcf, 0x3e, 0xaa, 0x17, 0x47, 0x75, 0xc3, 0x7f, 0xec, 0xd9, 0x44,
+		0x9e, 0xc9, 0x6a, 0x02, 0xe9, 0xe4, 0xaf, 0x56, 0x51, 0xd5, 0x47, 0xa9,
+		0x09, 0xb2, 0xc5, 0x16, 0xa7, 0x8b, 0x2b, 0x34, 0xa0, 0x33, 0x6e, 0x2f,
+		0x3d, 0x95, 0x7b, 0xe8, 0xef, 0x02, 0xe4, 0x14, 0xbf, 0x44, 0x28, 0xd9,
+		0x10, 0x0e, 0x2e, 0x18, 0xad, 0x5d, 0xe4, 0x43, 0xfe, 0x81, 0x1e, 0x17,
+		0xaa, 0xd0, 0x52, 0x31, 0x5e, 0x10, 0x76, 0xa2, 0x35, 0xd9, 0x37, 0x43,
+		0xb0, 0xf5, 0x0c, 0x04, 0x81, 0xe3, 0x45, 0x24, 0x6d, 0x53, 0xbe, 0x59,
+		0xb6, 0x81, 0x58, 0xc4, 0x49, 0x3e, 0xd5, 0x31, 0x89, 0x5d, 0x2e, 0xa2,
+		0x62, 0xa9, 0x0f, 0x47, 0x5e, 0x8f, 0x51, 0x19, 0x27, 0x4e, 0x66, 0x4b,
+		0x8a, 0x72, 0x89, 0xbd, 0x3e, 0x53, 0x0a, 0xf4, 0x8e, 0x75, 0xe1, 0x52,
+		0xc6, 0x24, 0xe9, 0xf7, 0xbb, 0xac, 0x3f, 0x22, 0x5f, 0xe8, 0xe0, 0x79,
+		0x35, 0xff, 0x91, 0xee, 0x22, 0x56, 0xd2, 0x00, 0x68, 0x32, 0xc4, 0xe1,
+		0x5f, 0xff, 0xf8, 0xb1, 0x1d, 0xee, 0xdc, 0x57, 0x81, 0xd1, 0xab, 0x8b,
+		0x37, 0x22, 0xe3, 0x9f, 0xd0, 0xa1, 0xc1, 0xce, 0x1d, 0xd0, 0x24, 0x23,
+		0xa0, 0x0e, 0xf7, 0xa6, 0xdb, 0xa3, 0xea, 0xd3
+	},
+	/* R2 */
+	{
+		0xf5, 0xf6, 0xfa, 0x44, 0xa2, 0x16, 0x2f, 0xa7, 0x1f, 0x7f, 0x16, 0x05,
+		0x99, 0x26, 0xc4, 0x1b, 0x80, 0x7f, 0xfa, 0x52, 0x4e, 0x3e, 0xaa, 0x3d,
+		0x1e, 0xb0, 0xf1, 0x9a, 0xc6, 0x3d, 0x8f, 0x57, 0x2b, 0x9e, 0xcd, 0xe8,
+		0x03, 0xd6, 0xf3, 0x91, 0x75, 0xe2, 0x19, 0x44, 0x9e, 0x11, 0x58, 0x5f,
+		0xd6, 0x88, 0x7c, 0xc4, 0xc1, 0x5b, 0x45, 0x9b, 0x84, 0xcf, 0x72, 0x1d,
+		0x35, 0xbf, 0x24, 0xd5, 0xed, 0xba, 0x08, 0xbf, 0x42, 0x2c, 0x0e, 0xfa,
+		0x3a, 0xc4, 0xd2, 0xc7, 0x01, 0x51, 0x25, 0xae, 0xb0, 0xa1, 0xcc, 0xdb,
+		0x67, 0x9b, 0xaa, 0x50, 0xf0, 0x80, 0xac, 0x4b, 0x9f, 0x5c, 0xba, 0x1e,
+		0xf4, 0x7f, 0xa9, 0xb3, 0x21, 0x8b, 0x62, 0x2c, 0x36, 0xda, 0xcd, 0xa7,
+		0x4d, 0xa4, 0xd6, 0x44, 0xed, 0xb1, 0x34, 0xe7, 0x69, 0x10, 0x77, 0x5a,
+		0x6a, 0xff, 0xf5, 0x63, 0x8a, 0x2c, 0x43, 0x09, 0x61, 0x5a, 0xc4, 0x6c,
+		0x6e, 0x0b, 0x82, 0x09, 0x10, 0x3a, 0x69, 0x29, 0x06, 0x19, 0x85, 0xfd,
+		0xac, 0xba, 0xfb, 0x05, 0xa0, 0xda, 0xc4, 0xdf, 0x34, 0x4a, 0xad, 0x16,
+		0xa9, 0xe8, 0xab, 0xd7, 0xc0, 0xf8, 0x36, 0x5f, 0xe3, 0x45, 0x2d, 0x5b,
+		0x21, 0xe1, 0xc0, 0x46, 0x9c, 0x9a, 0x18, 0xf4, 0xb6, 0x21, 0x87, 0xe1,
+		0x08, 0xf7, 0x6b, 0x71, 0xc6, 0xfb, 0xa5, 0x1b, 0x52, 0xae, 0xb9, 0x91,
+		0x5a, 0x83, 0x7f, 0xbb, 0x1a, 0xbd, 0xdd, 0xc2, 0x06, 0xc8, 0x54, 0x1c,
+		0xb3, 0x72, 0xab, 0x2f, 0x55, 0x4f, 0x75, 0xc9, 0x80, 0x2c, 0x73, 0xef,
+		0xb7, 0x72, 0xb6, 0xa7, 0x60, 0x79, 0x14, 0xe0, 0x9e, 0x65, 0x51, 0x3e,
+		0xc4, 0x21, 0xe6, 0xf2, 0x40, 0xbc, 0x94, 0x9b, 0x03, 0xe4, 0x24, 0x35,
+		0x40, 0x6f, 0x3d, 0x5e, 0x72, 0xd1, 0x73, 0x30, 0x39, 0x17, 0x55, 0xde,
+		0x5d, 0x88, 0xb6, 0xc9, 0xbc, 0x91, 0x2a, 0x93, 0x6a, 0x8d, 0x24, 0x3c,
+		0xd5, 0x7d, 0x12, 0x3b, 0xa3, 0x71, 0xc7, 0x3a, 0xf0, 0x64, 0x72, 0x50,
+		0x7e, 0x18, 0x71, 0xe1, 0xb4, 0x3b, 0x1e, 0xfc, 0x38, 0xca, 0xe6, 0x8c,
+		0x16, 0x51, 0x97, 0xd6, 0x3f, 0x04, 0xee, 0x23, 0x8b, 0x45, 0x0c, 0x4b,
+		0x98, 0x36, 0x18, 0x27, 0x29, 0x1b, 0x4d, 0x73, 0x7e, 0xe8, 0xb0, 0x1a,
+		0xc7, 0xfb, 0x5c, 0xea, 0x78, 0xd0, 0x6e, 0x97
+	}
+};
+
+/* Km encrypted with the public key, Ekpub(km) */
+const u8 Hdcp22RxKat_Ekm[2][128] = {
+	/* R1 */
+	{
+		0x9b, 0x9f, 0x80, 0x19, 0xad, 0x0e, 0xa2, 0xf0, 0xdd, 0xa0, 0x29, 0x33,
+		0xd9, 0x6d, 0x1c, 0x77, 0x31, 0x37, 0x57, 0xe0, 0xe5, 0xb2, 0xbd, 0xdd,
+		0x36, 0x3e, 0x38, 0x4e, 0x7d, 0x40, 0x78, 0x66, 0x97, 0x7a, 0x4c, 0xce,
+		0xc5, 0xc7, 0x5d, 0x01, 0x57, 0x26, 0xcc, 0xa2, 0xf6, 0xde, 0x34, 0xdd,
+		0x29, 0xbe, 0x5e, 0x31, 0xe8, 0xf1, 0x34, 0xe8, 0x1a, 0x63, 0xa3, 0x6d,
+		0x46, 0xdc, 0x0a, 0x06, 0x08, 0x99, 0x9d, 0xdb, 0x3c, 0xa2, 0x9c, 0x04,
+		0xdd, 0x4e, 0xd9, 0x02, 0x7d, 0x20, 0x54, 0xec, 0xca, 0x86, 0x42, 0x1b,
+		0x18, 0xda, 0x30, 0x9c, 0xc4, 0xcb, 0xac, 0xb4, 0x54, 0xde, 0x84, 0x68,
+		0x71, 0x53, 0x6d, 0x92, 0x17, 0xca, 0x08, 0x8a, 0x7a, 0xf9, 0x98, 0x9a,
+		0xb6, 0x7b, 0x22, 0x92, 0xac, 0x7d, 0x0d, 0x6b, 0xd6, 0x7f, 0x31, 0xab,
+		0xf0, 0x10, 0xc5, 0x2a, 0x0f, 0x6d, 0x27, 0xa0
+	},
+	/* R2 */
+	{
+		0xa8, 0x55, 0xc2, 0xc4, 0xc6, 0xbe, 0xef, 0xcd, 0xcb, 0x9f, 0xe3, 0x9f,
+		0x2a, 0xb7, 0x29, 0x76, 0xfe, 0xd8, 0xda, 0xc9, 0x38, 0xfa, 0x39, 0xf0,
+		0xab, 0xca, 0x8a, 0xed, 0x95, 0x7b, 0x93, 0xb2, 0xdf, 0xd0, 0x7d, 0x09,
+		0x9d, 0x05, 0x96, 0x66, 0x03, 0x6e, 0xba, 0xe0, 0x63, 0x0f, 0x30, 0x77,
+		0xc2, 0xbb, 0xe2, 0x11, 0x39, 0xe5, 0x27, 0x78, 0xee, 0x64, 0xf2, 0x85,
+		0x36, 0x57, 0xc3, 0x39, 0xd2, 0x7b, 0x79, 0x03, 0xb7, 0xcc, 0x82, 0xcb,
+		0xf0, 0x62, 0x82, 0x43, 0x38, 0x09, 0x9b, 0x71, 0xaa, 0x38, 0xa6, 0x3f,
+		0x48, 0x12, 0x6d, 0x8c, 0x5e, 0x07, 0x90, 0x76, 0xac, 0x90, 0x99, 0x51,
+		0x5b, 0x06, 0xa5, 0xfa, 0x50, 0xe4, 0xf9, 0x25, 0xc3, 0x07, 0x12, 0x37,
+		0x64, 0x92, 0xd7, 0xdb, 0xd3, 0x34, 0x1c, 0xe4, 0xfa, 0xdd, 0x09, 0xe6,
+		0x28, 0x3d, 0x0c, 0xad, 0xa9, 0xd8, 0xe1, 0xb5
+	}
+};
+
+/* Master key km */
+const u8 Hdcp22RxKat_Km[2][16] = {
+	/* R1 */
+	{
+		0x68, 0xbc, 0xc5, 0x1b, 0xa9, 0xdb, 0x1b, 0xd0, 0xfa, 0xf1, 0x5e, 0x9a,
+		0xd8, 0xa5, 0xaf, 0xb9
+	},
+	/* R2 */
+	{
+		0xca, 0x9f, 0x83, 0x95, 0x70, 0xd0, 0xd0, 0xf9, 0xcf, 0xe4, 0xeb, 0x54,
+		0x7e, 0x09, 0xfa, 0x3b
+	}
+};
+
+/* TxCaps of AKE_Init */
+const u8 Hdcp22RxKat_TxCaps[3] = {
+	0x02, 0x00, 0x00
+};
+
+/* RxCaps of AKE_Send_Cert */
+const u8 Hdcp22RxKat_RxCaps[2][3] = {
+	/* R1 */
+	{
+		0x02, 0x00, 0x01
+	},
+	/* R2 */
+	{
+		0x02, 0x00, 0x00
+	}
+};
+
+/* Random value rtx of the transmitter */
+const u8 Hdcp22RxKat_Rtx[2][8] = {
+	/* R1 */
+	{
+		0x18, 0xfa, 0xe4, 0x20, 0x6a, 0xfb, 0x51, 0x49
+	},
+	/* R2 */
+	{
+		0xf9, 0xf1, 0x30, 0xa8, 0x2d, 0x5b, 0xe5, 0xc3
+	}
+};
+
+/* Random value rrx of the receiver */
+const u8 Hdcp22RxKat_Rrx[2][8] = {
+	/* R1 */
+	{
+		0x3b, 0xa0, 0xbe, 0xde, 0x0c, 0x46, 0xa9, 0x91
+	},
+	/* R2 */
+	{
+		0xe1, 0x7a, 0xb0, 0xfd, 0x0f, 0x54, 0x40, 0x52
+	}
+};
+
+/* H' of AKE_Send_H_prime */
+const u8 Hdcp22RxKat_HPrime[2][32] = {
+	/* R1 */
+	{
+		0x69, 0xe0, 0xab, 0x21, 0x2f, 0xdb, 0x57, 0xe6, 0x7e, 0xfc, 0x43, 0x76,
+		0x1a, 0x2c, 0x5c, 0xce, 0x76, 0xc3, 0x65, 0xf1, 0x9b, 0x75, 0xc3, 0xea,
+		0xc2, 0xd2, 0x77, 0xdd, 0x5c, 0x7e, 0x4a, 0xc4
+	},
+	/* R2 */
+	{
+		0x4f, 0xf1, 0xa2, 0xa5, 0x61, 0x67, 0xc8, 0xe0, 0xad, 0x16, 0xc8, 0x95,
+		0x99, 0x1b, 0x1a, 0x21, 0xa8, 0x80, 0xc6, 0x27, 0x39, 0x3f, 0xc7, 0xbb,
+		0x83, 0xed, 0xa7, 0xe5, 0x69, 0x07, 0xa5, 0xdc
+	}
+};
+
+/* Ekh(km) of AKE_Send_Pairing_Info */
+const u8 Hdcp22RxKat_Ekh[2][16] = {
+	/* R1 */
+	{
+		0xb8, 0x9f, 0xf9, 0x72, 0x6a, 0x6f, 0x2c, 0x1e, 0x29, 0xb6, 0x44, 0x8d,
+		0xdc, 0xa3, 0x10, 0xbd
+	},
+	/* R2 */
+	{
+		0xe6, 0x57, 0x8e, 0xbc, 0xc7, 0x68, 0x44, 0x87, 0x88, 0x8a, 0x9b, 0xd7,
+		0xd6, 0xae, 0x38, 0xbe
+	}
+};
+
+/* Locality check nonce rn */
+const u8 Hdcp22RxKat_Rn[2][8] = {
+	/* R1 */
+	{
+		0x32, 0x75, 0x3e, 0xa8, 0x78, 0xa6, 0x38, 0x1c
+	},
+	/* R2 */
+	{
+		0xa0, 0xfe, 0x9b, 0xb8, 0x20, 0x60, 0x58, 0xca
+	}
+};
+
+/* L' of LC_Send_L_prime */
+const u8 Hdcp22RxKat_LPrime[2][32] = {
+	/* R1 */
+	{
+		0xbc, 0x20, 0x92, 0x33, 0x54, 0x91, 0xc1, 0x9e, 0xa4, 0xde, 0x8b, 0x30,
+		0x49, 0xc2, 0x06, 0x6a, 0xd8, 0x11, 0xa2, 0x2a, 0xb1, 0x46, 0xdf, 0x74,
+		0x58, 0x47, 0x05, 0xa8, 0xb7, 0x67, 0xfb, 0xdd
+	},
+	/* R2 */
+	{
+		0xf2, 0x0f, 0x13, 0x6e, 0x85, 0x53, 0xc1, 0x0c, 0xd3, 0xdd, 0xb2, 0xf9,
+		0x6d, 0x33, 0x31, 0xf9, 0xcb, 0x6e, 0x97, 0x8c, 0xcd, 0x5e, 0xda, 0x13,
+		0xdd, 0xea, 0x41, 0x44, 0x10, 0x9b, 0x51, 0xb0
+	}
+};
+
+/* Edkey(ks) of SKE_Send_Eks */
+const u8 Hdcp22RxKat_Eks[2][16] = {
+	/* R1 */
+	{
+		0x4c, 0x32, 0x47, 0x12, 0xc4, 0xbe, 0xc6, 0x69, 0x0a, 0xc2, 0x19, 0x64,
+		0xde, 0x91, 0xf1, 0x83
+	},
+	/* R2 */
+	{
+		0xb6, 0x8b, 0x8a, 0xa4, 0xd2, 0xcb, 0xba, 0xff, 0x53, 0x33, 0xc1, 0xd9,
+		0xbb, 0xb7, 0x10, 0xa9
+	}
+};
+
+/* Session key ks, the same for R1 and R2 */
+const u8 Hdcp22RxKat_Ks[16] = {
+	0xf3, 0xdf, 0x1d, 0xd9, 0x57, 0x96, 0x12, 0x3f, 0x98, 0x97, 0x89, 0xb4,
+	0x21, 0xe1, 0x2d, 0xe1
+};
+
+/* Receiver ID list of the R1 repeater, three IDs */
+const u8 Hdcp22RxKat_RcvIdList[HDCP22_RX_KAT_NUM_RCVID * 5] = {
+	0x47, 0x8e, 0x71, 0xe2, 0x0f, 0x35, 0x79, 0x6a, 0x17, 0x0e, 0x74, 0xe8,
+	0x53, 0x97, 0xa2
+};
+
+/* RxInfo of the R1 repeater */
+const u8 Hdcp22RxKat_RxInfo[2] = {
+	0x02, 0x31
+};
+
+/* seq_num_V of the R1 repeater */
+const u8 Hdcp22RxKat_SeqNumV[3] = {
+	0x00, 0x00, 0x00
+};
+
+/* Most significant 128 bits of V' of the R1 repeater */
+const u8 Hdcp22RxKat_VPrime[16] = {
+	0xbc, 0xcc, 0x7d, 0x16, 0xe6, 0xbc, 0xb9, 0x02, 0x60, 0x08, 0x1d, 0xf7,
+	0x4a, 0xb4, 0x5c, 0x8a
+};
+
+/* Least significant 128 bits of V' of the R1 repeater, V of the transmitter */
+const u8 Hdcp22RxKat_V[16] = {
+	0x63, 0x6d, 0xc5, 0x08, 0x4d, 0x6c, 0xb1, 0x0e, 0x93, 0xa5, 0x28, 0x67,
+	0x0f, 0x34, 0x1f, 0x88
+};
+
+/* seq_num_M of the R1 repeater */
+const u8 Hdcp22RxKat_SeqNumM[3] = {
+	0x00, 0x00, 0x00
+};
+
+/* StreamID_Type of the R1 repeater, one type 1 stream */
+const u8 Hdcp22RxKat_StreamIdType[2] = {
+	0x00, 0x01
+};
+
+/* M' of the R1 repeater */
+const u8 Hdcp22RxKat_MPrime[32] = {
+	0xdd, 0x26, 0xe9, 0x52, 0x6e, 0x0e, 0x1d, 0x69, 0xc8, 0x84, 0xe4, 0xcc,
+	0xc8, 0x09, 0xaa, 0xc7, 0x71, 0xe9, 0x97, 0xb5, 0x61, 0x89, 0x09, 0x6e,
+	0x4d, 0x94, 0x24, 0xc2, 0x1b, 0x64, 0x58, 0xc6
+};
@@ -0,0 +1,64 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_rx_kat.h
+*
+* This file declares the known answer vectors of the receiver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.1   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef HDCP22_RX_KAT_H_
+#define HDCP22_RX_KAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define HDCP22_RX_KAT_NUM	2	/**< Vector sets, R1 and R2 */
+#define HDCP22_RX_KAT_NUM_RCVID	3	/**< Receiver IDs of the R1 repeater */
+
+/************************** Variable Definitions *****************************/
+extern const u8 Hdcp22RxKat_KpubRx[HDCP22_RX_KAT_NUM][131];
+extern const u8 Hdcp22RxKat_KprivRx[HDCP22_RX_KAT_NUM][320];
+extern const u8 Hdcp22RxKat_Ekm[HDCP22_RX_KAT_NUM][128];
+extern const u8 Hdcp22RxKat_Km[HDCP22_RX_KAT_NUM][16];
+extern const u8 Hdcp22RxKat_TxCaps[3];
+extern const u8 Hdcp22RxKat_RxCaps[HDCP22_RX_KAT_NUM][3];
+extern const u8 Hdcp22RxKat_Rtx[HDCP22_RX_KAT_NUM][8];
+extern const u8 Hdcp22RxKat_Rrx[HDCP22_RX_KAT_NUM][8];
+extern const u8 Hdcp22RxKat_HPrime[HDCP22_RX_KAT_NUM][32];
+extern const u8 Hdcp22RxKat_Ekh[HDCP22_RX_KAT_NUM][16];
+extern const u8 Hdcp22RxKat_Rn[HDCP22_RX_KAT_NUM][8];
+extern const u8 Hdcp22RxKat_LPrime[HDCP22_RX_KAT_NUM][32];
+extern const u8 Hdcp22RxKat_Eks[HDCP22_RX_KAT_NUM][16];
+extern const u8 Hdcp22RxKat_Ks[16];
+extern const u8 Hdcp22RxKat_RcvIdList[HDCP22_RX_KAT_NUM_RCVID * 5];
+extern const u8 Hdcp22RxKat_RxInfo[2];
+extern const u8 Hdcp22RxKat_SeqNumV[3];
+extern const u8 Hdcp22RxKat_VPrime[16];
+extern const u8 Hdcp22RxKat_V[16];
+extern const u8 Hdcp22RxKat_SeqNumM[3];
+extern const u8 Hdcp22RxKat_StreamIdType[2];
+extern const u8 Hdcp22RxKat_MPrime[32];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HDCP22_RX_KAT_H_ */
@@ -0,0 +1,267 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_rx_rsa_test.c
+*
+* This file runs the RSA private key decryption of the receiver on the host,
+* with the MMULT core model, or with the software Montgomery multiplication
+* when built with _XHDCP22_RX_SW_MMULT_.
+*
+* - The Ekm of the R1 and R2 facsimile vectors decrypts to the Km of the
+*   vectors.
+* - Random Km encrypted with the public key of the receiver decrypt to the
+*   same Km.
+* - With the MMULT model, every multiplication uses the NPrime of its
+*   modulus, and the number of multiplications of a decryption is printed
+*   with the number of the binary method, 32 * NDigits squarings plus one
+*   multiplication per set exponent bit and the final one, per CRT half.
+*
+* The time of a decryption on the host is printed. With the MMULT model it is
+* the time of the model, not of the core.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.1   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xhdcp22_rx.h"
+#include "xhdcp22_rx_i.h"
+#include "mmult_model.h"
+#include "hdcp22_rx_kat.h"
+
+/************************** Constant Definitions *****************************/
+#define NUM_ROUND_TRIPS	50	/* Random encryptions per key */
+#define NUM_TIMED	200	/* Timed decryptions */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int SetKey(int Set);
+static int TestKat(int Set);
+static int TestRoundTrip(int Set);
+static int TestTime(int Set);
+#ifndef _XHDCP22_RX_SW_MMULT_
+static u32 PopCount(const u8 *Octets, int Len);
+#endif
+
+/************************** Variable Definitions *****************************/
+static XHdcp22_Rx RxInst;
+static XHdcp22_Rx_KpubRx KpubRx;
+static XHdcp22_Rx_KprivRx KprivRx;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	int Set;
+
+	srand(1U);
+	for (Set = 0; Set < HDCP22_RX_KAT_NUM; Set++) {
+		if ((SetKey(Set) != XST_SUCCESS) ||
+		    (TestKat(Set) != XST_SUCCESS) ||
+		    (TestRoundTrip(Set) != XST_SUCCESS) ||
+		    (TestTime(Set) != XST_SUCCESS)) {
+			return 1;
+		}
+	}
+
+	printf("Successfully ran RSA test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the keys of a vector set and computes the Montgomery
+* constants of p and q, as XHdcp22Rx_SetKeys() does.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int SetKey(int Set)
+{
+	memset(&RxInst, 0, sizeof(RxInst));
+	CHECK(XMmultModel_Init(&RxInst.MmultInst) == XST_SUCCESS, "init");
+
+	memcpy(&KpubRx, Hdcp22RxKat_KpubRx[Set], sizeof(KpubRx));
+	memcpy(&KprivRx, Hdcp22RxKat_KprivRx[Set], sizeof(KprivRx));
+	CHECK(XHdcp22Rx_CalcMontNPrime(RxInst.NPrimeP, KprivRx.p,
+			XHDCP22_RX_P_SIZE / 4) == XST_SUCCESS, "NPrimeP");
+	CHECK(XHdcp22Rx_CalcMontNPrime(RxInst.NPrimeQ, KprivRx.q,
+			XHDCP22_RX_P_SIZE / 4) == XST_SUCCESS, "NPrimeQ");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function decrypts the Ekm of the vector set.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestKat(int Set)
+{
+	u8 Ekm[XHDCP22_RX_N_SIZE];
+	u8 Km[XHDCP22_RX_N_SIZE];
+	int KmLen = 0;
+#ifndef _XHDCP22_RX_SW_MMULT_
+	u32 Binary;
+#endif
+
+	memcpy(Ekm, Hdcp22RxKat_Ekm[Set], sizeof(Ekm));
+	XMmultModel_ResetStarts();
+	CHECK(XHdcp22Rx_RsaesOaepDecrypt(&RxInst, &KprivRx, Ekm, Km,
+			&KmLen) == XST_SUCCESS, "decryption failed");
+	CHECK(KmLen == XHDCP22_RX_KM_SIZE, "Km length");
+	CHECK(memcmp(Km, Hdcp22RxKat_Km[Set], XHDCP22_RX_KM_SIZE) == 0,
+			"Km differs from the vector");
+
+#ifndef _XHDCP22_RX_SW_MMULT_
+	CHECK(XMmultModel_GetErrors() == 0U, "NPrime of another modulus");
+	Binary = 2U * (XHDCP22_RX_P_SIZE * 8U + 1U) +
+		PopCount(KprivRx.dp, XHDCP22_RX_P_SIZE) +
+		PopCount(KprivRx.dq, XHDCP22_RX_P_SIZE);
+	printf("R%d: Km matches, %u multiplications, binary method %u\r\n",
+		Set + 1, XMmultModel_GetStarts(), Binary);
+	CHECK(XMmultModel_GetStarts() < Binary, "no fewer multiplications");
+#else
+	printf("R%d: Km matches\r\n", Set + 1);
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts random Km with the public key and decrypts them.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRoundTrip(int Set)
+{
+	u8 Km[XHDCP22_RX_KM_SIZE];
+	u8 Seed[XHDCP22_RX_HASH_SIZE];
+	u8 Ekm[XHDCP22_RX_N_SIZE];
+	u8 Message[XHDCP22_RX_N_SIZE];
+	int MessageLen;
+	int Trip;
+	int Index;
+
+	for (Trip = 0; Trip < NUM_ROUND_TRIPS; Trip++) {
+		for (Index = 0; Index < XHDCP22_RX_KM_SIZE; Index++) {
+			Km[Index] = (u8)rand();
+		}
+		for (Index = 0; Index < XHDCP22_RX_HASH_SIZE; Index++) {
+			Seed[Index] = (u8)rand();
+		}
+
+		CHECK(XHdcp22Rx_RsaesOaepEncrypt(&KpubRx, Km, sizeof(Km),
+				Seed, Ekm) == XST_SUCCESS, "encryption failed");
+		MessageLen = 0;
+		CHECK(XHdcp22Rx_RsaesOaepDecrypt(&RxInst, &KprivRx, Ekm,
+				Message, &MessageLen) == XST_SUCCESS,
+				"decryption failed");
+		CHECK((MessageLen == XHDCP22_RX_KM_SIZE) &&
+		      (memcmp(Message, Km, sizeof(Km)) == 0),
+				"round trip differs");
+	}
+	CHECK(XMmultModel_GetErrors() == 0U, "NPrime of another modulus");
+	printf("R%d: %d round trips match\r\n", Set + 1, NUM_ROUND_TRIPS);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the mean time of a decryption on the host.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestTime(int Set)
+{
+	u8 Ekm[XHDCP22_RX_N_SIZE];
+	u8 Km[XHDCP22_RX_N_SIZE];
+	struct timespec Start;
+	struct timespec End;
+	double Elapsed;
+	int KmLen;
+	int Run;
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		memcpy(Ekm, Hdcp22RxKat_Ekm[Set], sizeof(Ekm));
+		CHECK(XHdcp22Rx_RsaesOaepDecrypt(&RxInst, &KprivRx, Ekm, Km,
+				&KmLen) == XST_SUCCESS, "decryption failed");
+	}
+	clock_gettime(CLOCK_MONOTONIC, &End);
+
+	Elapsed = (double)(End.tv_sec - Start.tv_sec) * 1e6 +
+		(double)(End.tv_nsec - Start.tv_nsec) / 1e3;
+	printf("R%d: %.1f us per decryption\r\n", Set + 1,
+		Elapsed / NUM_TIMED);
+
+	return XST_SUCCESS;
+}
+
+#ifndef _XHDCP22_RX_SW_MMULT_
+/*****************************************************************************/
+/**
+*
+* This function returns the number of set bits of an octet string.
+*
+******************************************************************************/
+static u32 PopCount(const u8 *Octets, int Len)
+{
+	u32 Count = 0U;
+	int Index;
+
+	for (Index = 0; Index < Len; Index++) {
+		Count += (u32)__builtin_popcount(Octets[Index]);
+	}
+
+	return Count;
+}
+#endif
@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* The host model has no BSP configuration.
+*
+******************************************************************************/
+#ifndef HDCP22_RX_MODEL_BSPCONFIG_H_
+#define HDCP22_RX_MODEL_BSPCONFIG_H_
+
+#endif /* HDCP22_RX_MODEL_BSPCONFIG_H_ */
@@ -0,0 +1,18 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* The host model has no generated hardware parameters, the MMULT core is
+* configured by mmult_model.c.
+*
+******************************************************************************/
+#ifndef HDCP22_RX_MODEL_XPARAMETERS_H_
+#define HDCP22_RX_MODEL_XPARAMETERS_H_
+
+#endif /* HDCP22_RX_MODEL_XPARAMETERS_H_ */
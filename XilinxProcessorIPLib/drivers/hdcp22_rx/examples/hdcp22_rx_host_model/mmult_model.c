@@ -0,0 +1,246 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mmult_model.c
+*
+* This file contains the host model of the MMULT core and the BSP and driver
+* functions the receiver crypto needs on the host. See mmult_model.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.1   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "mmult_model.h"
+#ifdef HDCP22_RX_MODEL_DP
+#include "xhdcp22_rx_dp.h"
+#else
+#include "xhdcp22_rx.h"
+#endif
+#include "bigdigits.h"
+
+/************************** Constant Definitions *****************************/
+#define NDIGITS		XHDCP22_MMULT_CTRL_DEPTH_N	/* Words of the operands */
+#define REGION_SIZE	(XHDCP22_MMULT_CTRL_ADDR_NPRIME_HIGH + 1)
+#define AP_START	0x01U
+#define AP_DONE		0x02U
+#define AP_IDLE		0x04U
+#define AP_AUTO_RESTART	0x80U
+
+/************************** Function Prototypes ******************************/
+static void XMmultModel_Compute(void);
+
+/************************** Variable Definitions *****************************/
+static u32 Regs[REGION_SIZE / 4];
+static XHdcp22_mmult_Config Config;
+static u32 Starts;
+static u32 Errors;
+static u32 LastN[NDIGITS];	/* Modulus of RInv */
+static u32 RInv[NDIGITS];	/* R^-1 mod N */
+
+/*****************************************************************************/
+/**
+*
+* This function clears the model and initializes the MMULT driver on it.
+*
+* @param	InstancePtr is the MMULT instance.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+int XMmultModel_Init(XHdcp22_mmult *InstancePtr)
+{
+	memset(Regs, 0, sizeof(Regs));
+	memset(LastN, 0, sizeof(LastN));
+	Regs[XHDCP22_MMULT_CTRL_ADDR_AP_CTRL / 4] = AP_IDLE;
+	Starts = 0U;
+	Errors = 0U;
+
+	Config.DeviceId = 0U;
+	Config.BaseAddress = (UINTPTR)Regs;
+
+	return XHdcp22_mmult_CfgInitialize(InstancePtr, &Config,
+			Config.BaseAddress);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of multiplications run by the core.
+*
+******************************************************************************/
+u32 XMmultModel_GetStarts(void)
+{
+	return Starts;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the number of multiplications run by the core.
+*
+******************************************************************************/
+void XMmultModel_ResetStarts(void)
+{
+	Starts = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of multiplications started with an
+* NPrime which is not the Montgomery constant of N.
+*
+******************************************************************************/
+u32 XMmultModel_GetErrors(void)
+{
+	return Errors;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs a multiplication, U = A * B * R^-1 mod N with
+* R = 2^(32 * NDIGITS).
+*
+* @return	None.
+*
+******************************************************************************/
+static void XMmultModel_Compute(void)
+{
+	const u32 *N = &Regs[XHDCP22_MMULT_CTRL_ADDR_N_BASE / 4];
+	const u32 *NPrime = &Regs[XHDCP22_MMULT_CTRL_ADDR_NPRIME_BASE / 4];
+	u32 *U = &Regs[XHDCP22_MMULT_CTRL_ADDR_U_BASE / 4];
+	u32 Mod[NDIGITS];
+	u32 Wide[2 * NDIGITS];
+	u32 R[2 * NDIGITS];
+	u32 T[NDIGITS];
+	u32 Index;
+
+	memcpy(Mod, N, sizeof(Mod));
+	if (mpEqual(Mod, LastN, NDIGITS) == 0) {
+		/* RInv = (R mod N)^-1 mod N */
+		memset(R, 0, sizeof(R));
+		R[NDIGITS] = 1U;
+		mpModulo(T, R, 2 * NDIGITS, Mod, NDIGITS);
+		mpModInv(RInv, T, Mod, NDIGITS);
+		memcpy(LastN, Mod, sizeof(LastN));
+	}
+
+	/* N * NPrime = -1 mod R */
+	mpMultiply(Wide, N, NPrime, NDIGITS);
+	for (Index = 0U; Index < NDIGITS; Index++) {
+		if (Wide[Index] != 0xFFFFFFFFU) {
+			Errors++;
+			break;
+		}
+	}
+
+	mpModMult(T, &Regs[XHDCP22_MMULT_CTRL_ADDR_A_BASE / 4],
+		&Regs[XHDCP22_MMULT_CTRL_ADDR_B_BASE / 4], Mod, NDIGITS);
+	mpModMult(U, T, RInv, Mod, NDIGITS);
+	Starts++;
+}
+
+/*****************************************************************************/
+/**
+*
+* Register read of the MMULT driver.
+*
+******************************************************************************/
+u32 XMmultModel_In32(UINTPTR Addr)
+{
+	return Regs[(Addr - (UINTPTR)Regs) / 4];
+}
+
+/*****************************************************************************/
+/**
+*
+* Register write of the MMULT driver. A start runs the multiplication at
+* once, the core is done and idle on the next read.
+*
+******************************************************************************/
+void XMmultModel_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 Offset = (u32)(Addr - (UINTPTR)Regs);
+
+	Regs[Offset / 4] = Value;
+	if ((Offset == XHDCP22_MMULT_CTRL_ADDR_AP_CTRL) &&
+	    ((Value & AP_START) != 0U)) {
+		XMmultModel_Compute();
+		Regs[Offset / 4] = (Value & AP_AUTO_RESTART) | AP_DONE | AP_IDLE;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Functions of the other drivers used by xhdcp22_rx_crypt.c and
+* xhdcp22_rx_dp_crypt.c.
+*
+******************************************************************************/
+#ifdef HDCP22_RX_MODEL_DP
+void XHdcp22Rx_Dp_LogWr(XHdcp22_Rx_Dp *InstancePtr, u16 Evt, u16 Data)
+#else
+void XHdcp22Rx_LogWr(XHdcp22_Rx *InstancePtr, u16 Evt, u16 Data)
+#endif
+{
+	(void)InstancePtr;
+	(void)Evt;
+	(void)Data;
+}
+
+void XHdcp22Rng_GetRandom(XHdcp22_Rng *InstancePtr, u8 *BufferPtr,
+		u16 BufferLength, u16 RandomLength)
+{
+	u16 Index;
+
+	(void)InstancePtr;
+	(void)BufferLength;
+	for (Index = 0U; Index < RandomLength; Index++) {
+		BufferPtr[Index] = (u8)rand();
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* BSP functions used by the drivers.
+*
+******************************************************************************/
+u32 Xil_AssertStatus;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+void print(const char8 *Ptr)
+{
+	(void)fputs(Ptr, stdout);
+}
+
+void xil_printf(const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, Ctrl1);
+	(void)vprintf(Ctrl1, Args);
+	va_end(Args);
+}
@@ -0,0 +1,49 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mmult_model.h
+*
+* This file contains the host model of the HDCP 2.2 Montgomery multiplier
+* (MMULT) core, used to run the RSA decryption of the receiver on the host
+* with the unmodified MMULT driver.
+*
+* The register space of the core is RAM. The N, NPrime, A and B memories are
+* written by the driver, a start computes U = A * B * R^-1 mod N with the
+* big digit functions of hdcp22_common, independently of the FIOS code of
+* the receiver, and checks that NPrime is the Montgomery constant of N.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.1   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef MMULT_MODEL_H_
+#define MMULT_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xhdcp22_mmult.h"
+
+/************************** Function Prototypes ******************************/
+int XMmultModel_Init(XHdcp22_mmult *InstancePtr);
+u32 XMmultModel_GetStarts(void);
+void XMmultModel_ResetStarts(void);
+u32 XMmultModel_GetErrors(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MMULT_MODEL_H_ */
@@ -31,6 +31,8 @@
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
 * 2.20  MH   06/08/17 Updated for 64 bit support.
+* 3.1   ag   10/19/26 The HMAC key states of Kd are computed once per
+*                     session, with H'.
 *</pre>
 *
 *****************************************************************************/
@@ -1755,6 +1757,7 @@ static void XHdcp22Rx_ResetParams(XHdcp22_Rx *InstancePtr)
 	memset(InstancePtr->Params.SeqNumM,      0, sizeof(InstancePtr->Params.SeqNumM));
 	memset(InstancePtr->Params.StreamIdType, 0, sizeof(InstancePtr->Params.StreamIdType));
 	memset(InstancePtr->Params.MPrime,       0, sizeof(InstancePtr->Params.MPrime));
+	memset(&InstancePtr->Params.SessionKeys, 0, sizeof(InstancePtr->Params.SessionKeys));
 }
 
 /*****************************************************************************/
@@ -3108,8 +3111,10 @@ static int XHdcp22Rx_SendMessageAKESendHPrime(XHdcp22_Rx *InstancePtr)
 
 	/* Compute H Prime */
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME);
-	XHdcp22Rx_ComputeHPrime(InstancePtr->Params.Rrx, InstancePtr->Params.RxCaps,
-			InstancePtr->Params.Rtx, InstancePtr->Params.TxCaps, InstancePtr->Params.Km,
+	XHdcp22Rx_ComputeSessionKeys(InstancePtr->Params.Km, InstancePtr->Params.Rrx,
+			InstancePtr->Params.Rtx, &InstancePtr->Params.SessionKeys);
+	XHdcp22Rx_ComputeHPrime(&InstancePtr->Params.SessionKeys, InstancePtr->Params.Rtx,
+			InstancePtr->Params.RxCaps, InstancePtr->Params.TxCaps,
 			MsgPtr->AKESendHPrime.HPrime);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME_DONE);
 
@@ -3264,8 +3269,8 @@ static int XHdcp22Rx_SendMessageLCSendLPrime(XHdcp22_Rx *InstancePtr)
 
 	/* Compute LPrime */
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_LPRIME);
-	XHdcp22Rx_ComputeLPrime(InstancePtr->Params.Rn, InstancePtr->Params.Km, InstancePtr->Params.Rrx,
-		InstancePtr->Params.Rtx, MsgPtr->LCSendLPrime.LPrime);
+	XHdcp22Rx_ComputeLPrime(&InstancePtr->Params.SessionKeys, InstancePtr->Params.Rn,
+		MsgPtr->LCSendLPrime.LPrime);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_LPRIME_DONE);
 
 	/* Generate LC_Send_L_prime message */
@@ -3413,9 +3418,7 @@ static int XHdcp22Rx_SendMessageRepeaterAuthSendRxIdList(XHdcp22_Rx *InstancePtr
 			InstancePtr->Topology.DeviceCnt,
 			MsgPtr->RepeaterAuthSendRxIdList.RxInfo,
 			MsgPtr->RepeaterAuthSendRxIdList.SeqNumV,
-			InstancePtr->Params.Km,
-			InstancePtr->Params.Rrx,
-			InstancePtr->Params.Rtx,
+			&InstancePtr->Params.SessionKeys,
 			InstancePtr->Params.VPrime);
 		XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_VPRIME_DONE);
 
@@ -3582,8 +3585,7 @@ static int XHdcp22Rx_SendMessageRepeaterAuthStreamReady(XHdcp22_Rx *InstancePtr)
 	/* Compute MPrime */
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_MPRIME);
 	XHdcp22Rx_ComputeMPrime(InstancePtr->Params.StreamIdType, InstancePtr->Params.SeqNumM,
-		InstancePtr->Params.Km, InstancePtr->Params.Rrx, InstancePtr->Params.Rtx,
-		MsgPtr->RepeaterAuthStreamReady.MPrime);
+		&InstancePtr->Params.SessionKeys, MsgPtr->RepeaterAuthStreamReady.MPrime);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_MPRIME_DONE);
 
 	/* Generate RepeaterAuth_Stream_Ready message */
@@ -76,6 +76,7 @@
 *                     to array. Added function XHDCP22Rx_GetVersion.
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
+* 3.1   ag   10/19/26 Added the HMAC-SHA256 key states of the session.
 *</pre>
 *
 *****************************************************************************/
@@ -94,6 +95,7 @@ extern "C" {
 #include "xdebug.h"
 #include "xtmrctr.h"
 #include "xhdcp22_rng.h"
+#include "xhdcp22_common.h"
 #include "xhdcp22_mmult.h"
 #include "xhdcp22_cipher.h"
 
@@ -384,6 +386,17 @@ typedef struct
 	u8                    IsEncryptionStatusCallbackSet;
 } XHdcp22_Rx_Handles;
 
+/**
+ * This typedef contains the HMAC-SHA256 key states derived from Kd. They are
+ * computed once per session, when H' is computed, and used for L', V' and M'.
+ */
+typedef struct
+{
+	XHdcp22Cmn_HmacSha256Key Kd;       /**< Key Kd, for H' and V'. */
+	XHdcp22Cmn_HmacSha256Key KdRrx;    /**< Key Kd XOR Rrx, for L'. */
+	XHdcp22Cmn_HmacSha256Key Sha256Kd; /**< Key SHA256(Kd), for M'. */
+} XHdcp22_Rx_SessionKeys;
+
 /**
  * This typedef is used to store temporary parameters for computations
  */
@@ -404,6 +417,7 @@ typedef struct
 	u8 SeqNumM[3];
 	u8 StreamIdType[2];
 	u8 MPrime[32];
+	XHdcp22_Rx_SessionKeys SessionKeys;
 } XHdcp22_Rx_Parameters;
 
 /**
@@ -22,6 +22,10 @@
 * 1.00  MH   10/30/15 First Release
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.20  MH   06/21/17 Updated for 64 bit support.
+* 3.1   ag   10/19/26 Use sliding window exponentiation for the CRT halves.
+*                     Stream H', V' and M' through the HMAC-SHA256 context.
+*                     Assert the precision of XHdcp22Rx_Pkcs1MontExp().
+*                     Compute the HMAC key states of Kd once per session.
 *</pre>
 *
 *****************************************************************************/
@@ -36,6 +40,10 @@
 #include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
+/* Window size of the sliding window exponentiation, 2^(W-1) odd powers
+ * of the base are pre-computed */
+#define XHDCP22_RX_MONTEXP_WINDOW	4
+#define XHDCP22_RX_MONTEXP_POWERS	(1 << (XHDCP22_RX_MONTEXP_WINDOW - 1))
 
 /**************************** Type Definitions ******************************/
 
@@ -64,6 +72,8 @@ static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
 	            const u32 *NPrime, int NDigits);
 static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
 #endif
+static void XHdcp22Rx_Pkcs1MontMult(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
+	            u32 *B, u32 *N, const u32 *NPrime, int NDigits);
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A, u32 *E,
 	            u32 *N, const u32 *NPrime, int NDigits);
 
@@ -877,10 +887,48 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 }
 #endif
 
+/****************************************************************************/
+/**
+* This function runs a Montgomery multiplication on the MMULT hardware or,
+* with _XHDCP22_RX_SW_MMULT_, in software.
+*
+* U = MontMult(A,B,N)
+*
+* @param	InstancePtr is a pointer to the MMULT instance.
+* @param	U is the MMM result
+* @param	A is the n-residue input, A' = A*R mod N
+* @param	B is the n-residue input, B' = B*R mod N
+* @param	N is the modulus
+* @param	NPrime is a pre-computed constant, NPrime = (1-R*Rbar)/N
+* @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime)
+*
+* @return	None.
+*
+* @note		None.
+*****************************************************************************/
+static void XHdcp22Rx_Pkcs1MontMult(XHdcp22_Rx *InstancePtr, u32 *U, u32 *A,
+	u32 *B, u32 *N, const u32 *NPrime, int NDigits)
+{
+#ifndef _XHDCP22_RX_SW_MMULT_
+	(void)N;
+	(void)NPrime;
+	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, U, A, B, NDigits);
+#else
+	(void)InstancePtr;
+	XHdcp22Rx_Pkcs1MontMultFiosStub(U, A, B, N, NPrime, NDigits);
+#endif
+}
+
 /****************************************************************************/
 /**
 * This function performs the modular exponentation operation using the
-* binary square and multiply method.
+* left-to-right sliding window method. The odd powers A^1, A^3, ...,
+* A^(2^W-1) are pre-computed, then each window of up to W exponent bits
+* starting and ending with a one costs a single multiplication. For the
+* 512-bit CRT exponents the squarings are unchanged, and the about 256
+* multiplications by the base of the binary method become about 110
+* including the pre-computation. The squarings of the leading zero bits of
+* the exponent are skipped.
 *
 * C = ModExp(A, E, N) = A^E*mod(N)
 *
@@ -890,7 +938,8 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx *InstancePtr, u32 *U,
 * @param	N is the modulus
 * @param	NPrime is a constant
 * @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime).
-* 			Maximum integer precision is 16.
+* 			Maximum integer precision is 16, the size of the
+* 			pre-computed powers.
 *
 * @return	None.
 *
@@ -900,9 +949,24 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
 {
 	int Offset;
+	int Low;
+	int Bit;
+	int Window;
+	int Started = FALSE;
 	u32 R[XHDCP22_RX_N_SIZE/4];
 	u32 Abar[XHDCP22_RX_N_SIZE/4];
 	u32 Xbar[XHDCP22_RX_N_SIZE/4];
+	u32 Abar2[XHDCP22_RX_P_SIZE/4];
+	u32 Powers[XHDCP22_RX_MONTEXP_POWERS][XHDCP22_RX_P_SIZE/4];
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(C != NULL);
+	Xil_AssertNonvoid(A != NULL);
+	Xil_AssertNonvoid(E != NULL);
+	Xil_AssertNonvoid(N != NULL);
+	Xil_AssertNonvoid(NPrime != NULL);
+	Xil_AssertNonvoid(NDigits > 0);
+	Xil_AssertNonvoid(NDigits <= XHDCP22_RX_P_SIZE/4);
 
 	memset(R, 0, sizeof(R));
 	memset(Abar, 0, sizeof(Abar));
@@ -922,34 +986,68 @@ static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx *InstancePtr, u32 *C, u32 *A,
 	/* Step 2: Abar = A*R*mod(N) */
 	mpModMult(Abar, A, Xbar, N, 2*NDigits);
 
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
+	/* Step 3: Powers[i] = Abar^(2i+1) */
+	memcpy(Powers[0], Abar, 4*NDigits);
+	XHdcp22Rx_Pkcs1MontMult(InstancePtr, Abar2, Abar, Abar, N, NPrime, NDigits);
+	for(Window=1; Window<XHDCP22_RX_MONTEXP_POWERS; Window++)
 	{
-#ifndef _XHDCP22_RX_SW_MMULT_
-		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
-#else
-		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
-#endif
+		XHdcp22Rx_Pkcs1MontMult(InstancePtr, Powers[Window],
+			Powers[Window-1], Abar2, N, NPrime, NDigits);
+	}
 
-		if(mpGetBit(E, NDigits, Offset) == TRUE)
+	/* Step 4: Sliding window square and multiply */
+	Offset = (int)mpBitLength(E, NDigits) - 1;
+	while(Offset >= 0)
+	{
+		if(mpGetBit(E, NDigits, Offset) == FALSE)
 		{
-#ifndef _XHDCP22_RX_SW_MMULT_
-			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Abar, NDigits);
-#else
-			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Abar, N, NPrime, NDigits);
-#endif
+			XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Xbar, N, NPrime, NDigits);
+			Offset--;
+			continue;
 		}
+
+		/* Longest window of at most W bits ending with a one */
+		Low = Offset - XHDCP22_RX_MONTEXP_WINDOW + 1;
+		if(Low < 0)
+		{
+			Low = 0;
+		}
+		while(mpGetBit(E, NDigits, Low) == FALSE)
+		{
+			Low++;
+		}
+
+		Window = 0;
+		for(Bit=Offset; Bit>=Low; Bit--)
+		{
+			Window = (Window << 1) | mpGetBit(E, NDigits, Bit);
+			if(Started == TRUE)
+			{
+				XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Xbar, N, NPrime, NDigits);
+			}
+		}
+
+		if(Started == TRUE)
+		{
+			XHdcp22Rx_Pkcs1MontMult(InstancePtr, Xbar, Xbar, Powers[Window >> 1],
+				N, NPrime, NDigits);
+		}
+		else
+		{
+			memcpy(Xbar, Powers[Window >> 1], 4*NDigits);
+			Started = TRUE;
+		}
+		Offset = Low - 1;
 	}
 
-	/* Step 4: C=MonPro(Xbar,1) */
+	/* Step 5: C=MonPro(Xbar,1) */
 	memset(R, 0, sizeof(R));
 	R[0] = 1;
+	XHdcp22Rx_Pkcs1MontMult(InstancePtr, C, Xbar, R, N, NPrime, NDigits);
 
-#ifndef _XHDCP22_RX_SW_MMULT_
-	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, C, Xbar, R, NDigits);
-#else
-	XHdcp22Rx_Pkcs1MontMultFiosStub(C, Xbar, R, N, NPrime, NDigits);
-#endif
+	/* Clear the powers of the secret base */
+	memset(Abar2, 0, sizeof(Abar2));
+	memset(Powers, 0, sizeof(Powers));
 
 	return XST_SUCCESS;
 }
@@ -1028,53 +1126,93 @@ static void XHdcp22Rx_ComputeDKey(const u8* Rrx, const u8* Rtx, const u8 *Km,
 
 /*****************************************************************************/
 /**
-* This function computes HPrime used during HDCP 2.2 authentication and key
-* exchange.
+* This function computes the HMAC-SHA256 key states of a session. The key
+* schedule of each HMAC key, the two hashes of the padded key blocks, is
+* computed once here instead of for every H', L', V' and M'.
 *
-* Reference: HDCP v2.2, section 2.2
+* Reference: HDCP v2.2, section 2.7
 *
+* @param	Km is the master key generated by tx.
 * @param	Rrx is the Rx random generated value.
-* @param	RxCaps are the capabilities of the receiver.
 * @param	Rtx is the Tx random generated value.
-* @param	TxCaps are the capabilities of the receiver.
-* @param	Km is the master key generated by tx.
-* @param	HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+* @param	KeysPtr is a pointer to the key states output.
 *
 * @return	None.
 *
-* @note		None.
+* @note		The key states must be computed again when Km, Rrx or Rtx
+*			changes, that is for every AKE.
 ******************************************************************************/
-void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
-	const u8 *TxCaps, const u8 *Km, u8 *HPrime)
+void XHdcp22Rx_ComputeSessionKeys(const u8 *Km, const u8 *Rrx, const u8 *Rtx,
+	XHdcp22_Rx_SessionKeys *KeysPtr)
 {
-	u8 HashInput[XHDCP22_RX_RTX_SIZE + XHDCP22_RX_RXCAPS_SIZE + XHDCP22_RX_TXCAPS_SIZE];
-	int Idx = 0;
+	u8 HashKey[XHDCP22_RX_HASH_SIZE];
 	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
 	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
 
-
 	/* Verify arguments */
+	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(RxCaps != NULL);
 	Xil_AssertVoid(Rtx != NULL);
-	Xil_AssertVoid(TxCaps != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(HPrime != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 
 	/* Generate derived keys dkey0 and dkey1
 	   HashKey Kd = dkey0 || dkey1 */
 	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
 	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
 
-	/* HashInput = Rtx || RxCaps || TxCaps */
-	memcpy(HashInput, Rtx, XHDCP22_RX_RTX_SIZE);
-	Idx += XHDCP22_RX_RTX_SIZE;
-	memcpy(&HashInput[Idx], RxCaps, XHDCP22_RX_RXCAPS_SIZE);
-	Idx += XHDCP22_RX_RXCAPS_SIZE;
-	memcpy(&HashInput[Idx], TxCaps, XHDCP22_RX_TXCAPS_SIZE);
+	/* Key of H' and V' = Kd */
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->Kd, Kd, XHDCP22_RX_KD_SIZE);
 
-	/* Compute H' = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), Kd, XHDCP22_RX_KD_SIZE, HPrime);
+	/* Key of L' = Kd[256:64] || (Kd[63:0] xor Rrx) */
+	memcpy(HashKey, Kd, XHDCP22_RX_KD_SIZE);
+	XHdcp22Rx_Xor(HashKey+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE),
+		Kd+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE), Rrx, XHDCP22_RX_RRX_SIZE);
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->KdRrx, HashKey, XHDCP22_RX_KD_SIZE);
+
+	/* Key of M' = SHA256(Kd) */
+	XHdcp22Cmn_Sha256Hash(Kd, XHDCP22_RX_KD_SIZE, HashKey);
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->Sha256Kd, HashKey, XHDCP22_RX_HASH_SIZE);
+
+	memset(Kd, 0, sizeof(Kd));
+	memset(HashKey, 0, sizeof(HashKey));
+}
+
+/*****************************************************************************/
+/**
+* This function computes HPrime used during HDCP 2.2 authentication and key
+* exchange.
+*
+* Reference: HDCP v2.2, section 2.2
+*
+* @param	KeysPtr is a pointer to the key states of the session, see
+*			#XHdcp22Rx_ComputeSessionKeys.
+* @param	Rtx is the Tx random generated value.
+* @param	RxCaps are the capabilities of the receiver.
+* @param	TxCaps are the capabilities of the receiver.
+* @param	HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+void XHdcp22Rx_ComputeHPrime(const XHdcp22_Rx_SessionKeys *KeysPtr, const u8 *Rtx,
+	const u8 *RxCaps, const u8 *TxCaps, u8 *HPrime)
+{
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
+
+	/* Verify arguments */
+	Xil_AssertVoid(KeysPtr != NULL);
+	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(RxCaps != NULL);
+	Xil_AssertVoid(TxCaps != NULL);
+	Xil_AssertVoid(HPrime != NULL);
+
+	/* Compute H' = HMAC-SHA256(Rtx || RxCaps || TxCaps, Kd) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Kd);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, Rtx, XHDCP22_RX_RTX_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RxCaps, XHDCP22_RX_RXCAPS_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, TxCaps, XHDCP22_RX_TXCAPS_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, HPrime);
 }
 
 /*****************************************************************************/
@@ -1117,41 +1255,28 @@ void XHdcp22Rx_ComputeEkh(const u8 *KprivRx, const u8 *Km, const u8 *M, u8 *Ekh)
 *
 * Reference: HDCP v2.2, section 2.3
 *
+* @param	KeysPtr is a pointer to the key states of the session, see
+*			#XHdcp22Rx_ComputeSessionKeys.
 * @param	Rn is the 64-bit psuedo-random nonce generated by the transmitter.
-* @param	Km is the 128-bit master key generated by tx.
-* @param	Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param	Rtx is the 64-bit pseudo-random number generated by the transmitter.
 * @param	LPrime is the 256-bit value generated for locality check.
 *
 * @return	None.
 *
 * @note		None.
 ******************************************************************************/
-void XHdcp22Rx_ComputeLPrime(const u8 *Rn, const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *LPrime)
+void XHdcp22Rx_ComputeLPrime(const XHdcp22_Rx_SessionKeys *KeysPtr, const u8 *Rn, u8 *LPrime)
 {
-	u8 HashKey[XHDCP22_RX_KD_SIZE];
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Verify arguments */
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
 	Xil_AssertVoid(LPrime != NULL);
 
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
-	/* HashKey = Kd[256:64] || (Kd[63:0] xor Rrx) */
-	memcpy(HashKey, Kd, XHDCP22_RX_KD_SIZE);
-	XHdcp22Rx_Xor(HashKey+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE),
-		Kd+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE), Rrx, XHDCP22_RX_RRX_SIZE);
-
-	/* LPrime = HMAC-SHA256(Rn, HashKey) */
-	XHdcp22Cmn_HmacSha256Hash(Rn, XHDCP22_RX_RN_SIZE, HashKey, XHDCP22_RX_KD_SIZE, LPrime);
+	/* LPrime = HMAC-SHA256(Rn, Kd[256:64] || (Kd[63:0] xor Rrx)) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->KdRrx);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, Rn, XHDCP22_RX_RN_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, LPrime);
 }
 
 /*****************************************************************************/
@@ -1207,9 +1332,10 @@ void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *R
 *         There can be between 1 and 31 devices in the list.
 * @param  RxInfo is the 16-bit field in the RepeaterAuth_Send_ReceiverID_List
 *         message.
-* @param  Km is the 128-bit master key generated by tx.
-* @param  Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param  Rtx is the 64-bit pseudo-random number generated by the transmitter.
+* @param  SeqNumV is the 24-bit field in the
+*         RepeaterAuth_Send_ReceiverID_List message.
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Rx_ComputeSessionKeys.
 * @param  VPrime is the 256-bit value generated for repeater authentication.
 *
 * @return None.
@@ -1217,58 +1343,41 @@ void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *R
 * @note   None.
 ******************************************************************************/
 void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
-       const u8 *RxInfo, const u8 *SeqNumV, const u8 *Km, const u8 *Rrx,
-       const u8 *Rtx, u8 *VPrime)
+       const u8 *RxInfo, const u8 *SeqNumV, const XHdcp22_Rx_SessionKeys *KeysPtr,
+       u8 *VPrime)
 {
-	int Idx = 0;
-	u8 HashInput[XHDCP22_RX_SEQNUMV_SIZE +
-					XHDCP22_RX_RXINFO_SIZE +
-					(XHDCP22_RX_MAX_DEVICE_COUNT*XHDCP22_RX_RCVID_SIZE)];
-	int HashInputSize = (ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE) +
-					XHDCP22_RX_SEQNUMV_SIZE + XHDCP22_RX_RXINFO_SIZE;
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Verify arguments */
 	Xil_AssertVoid(ReceiverIdList != NULL);
 	Xil_AssertVoid(ReceiverIdListSize > 0);
 	Xil_AssertVoid(RxInfo != NULL);
 	Xil_AssertVoid(SeqNumV != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(VPrime != NULL);
 
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
-	/* HashInput = ReceiverIdList || RxInfo || SeqNumV */
-	memcpy(HashInput, ReceiverIdList, ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE);
-	Idx += ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE;
-	memcpy(&HashInput[Idx], RxInfo, XHDCP22_RX_RXINFO_SIZE);
-	Idx += XHDCP22_RX_RXINFO_SIZE;
-	memcpy(&HashInput[Idx], SeqNumV, XHDCP22_RX_SEQNUMV_SIZE);
-
-	/* VPrime = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, HashInputSize, Kd, XHDCP22_RX_KD_SIZE, VPrime);
+	/* VPrime = HMAC-SHA256(ReceiverIdList || RxInfo || SeqNumV, Kd) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Kd);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, ReceiverIdList,
+		ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RxInfo, XHDCP22_RX_RXINFO_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, SeqNumV, XHDCP22_RX_SEQNUMV_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, VPrime);
 }
 
 /*****************************************************************************/
 /**
-* This function computes VPrime used during HDCP 2.2 repeater
-* authentication.
+* This function computes MPrime used during HDCP 2.2 repeater
+* content stream management.
 *
 * Reference: HDCP v2.2, section 2.3
 *
-* @param  StreamIdType is the 16-bit field in the RepeaterAuth_Send_ReceiverID_List
+* @param  StreamIdType is the 16-bit field in the RepeaterAuth_Stream_Manage
 * 			  message.
 * @param  SeqNumM is the 24-bit field in the RepeaterAuth_Stream_Manage
 * 			  message.
-* @param  Km is the 128-bit master key generated by tx.
-* @param  Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param  Rtx is the 64-bit pseudo-random number generated by the transmitter.
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Rx_ComputeSessionKeys.
 * @param  MPrime is the 256-bit value generated for repeater stream
 *         management ready.
 *
@@ -1277,37 +1386,21 @@ void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
 * @note	  None.
 ******************************************************************************/
 void XHdcp22Rx_ComputeMPrime(const u8 *StreamIdType, const u8 *SeqNumM,
-       const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *MPrime)
+       const XHdcp22_Rx_SessionKeys *KeysPtr, u8 *MPrime)
 {
-	int Idx = 0;
-	u8 HashInput[XHDCP22_RX_STREAMID_SIZE + XHDCP22_RX_SEQNUMM_SIZE];
-	u8 HashKey[XHDCP22_RX_HASH_SIZE];
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Verify arguments */
 	Xil_AssertVoid(StreamIdType != NULL);
 	Xil_AssertVoid(SeqNumM != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(MPrime != NULL);
 
-	/* HashInput = StreamIdType || SeqNumM */
-	memcpy(HashInput, StreamIdType, XHDCP22_RX_STREAMID_SIZE);
-	Idx += XHDCP22_RX_STREAMID_SIZE;
-	memcpy(&HashInput[Idx], SeqNumM, XHDCP22_RX_SEQNUMM_SIZE);
-
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
-	/* Hashkey = SHA256(Kd) */
-	XHdcp22Cmn_Sha256Hash(Kd, XHDCP22_RX_KD_SIZE, HashKey);
-
-	/* VPrime = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), HashKey, XHDCP22_RX_HASH_SIZE, MPrime);
+	/* MPrime = HMAC-SHA256(StreamIdType || SeqNumM, SHA256(Kd)) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Sha256Kd);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, StreamIdType, XHDCP22_RX_STREAMID_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, SeqNumM, XHDCP22_RX_SEQNUMM_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, MPrime);
 }
 
 /** @} */
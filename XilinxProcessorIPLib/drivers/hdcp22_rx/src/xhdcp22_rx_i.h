@@ -22,6 +22,7 @@
 * 1.01  MH   03/02/16 Moved prototype of XHdcp22Rx_CalcMontNPrime to
 *                     to internal functions.
 * 1.02  MH   04/14/16 Updated for repeater upstream support.
+* 3.1   ag   10/19/26 H', L', V' and M' take the key states of the session.
 *</pre>
 *
 *****************************************************************************/
@@ -424,17 +425,19 @@ int  XHdcp22Rx_RsaesOaepEncrypt(const XHdcp22_Rx_KpubRx *KpubRx, const u8 *Messa
 			const u32 MessageLen, const u8 *MaskingSeed, u8 *EncryptedMessage);
 int  XHdcp22Rx_RsaesOaepDecrypt(XHdcp22_Rx *InstancePtr, const XHdcp22_Rx_KprivRx *KprivRx,
 			 u8 *EncryptedMessage, u8 *Message, int *MessageLen);
-void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
-	     const u8 *TxCaps, const u8 *Km, u8 *HPrime);
+void XHdcp22Rx_ComputeSessionKeys(const u8 *Km, const u8 *Rrx, const u8 *Rtx,
+	     XHdcp22_Rx_SessionKeys *KeysPtr);
+void XHdcp22Rx_ComputeHPrime(const XHdcp22_Rx_SessionKeys *KeysPtr, const u8 *Rtx,
+	     const u8 *RxCaps, const u8 *TxCaps, u8 *HPrime);
 void XHdcp22Rx_ComputeEkh(const u8 *KprivRx, const u8 *Km, const u8 *M, u8 *Ekh);
-void XHdcp22Rx_ComputeLPrime(const u8 *Rn, const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *LPrime);
+void XHdcp22Rx_ComputeLPrime(const XHdcp22_Rx_SessionKeys *KeysPtr, const u8 *Rn, u8 *LPrime);
 void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *Rn,
 			 const u8 *Eks, u8 * Ks);
 void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
-       const u8 *RxInfo, const u8 *SeqNumV, const u8 *Km, const u8 *Rrx,
-       const u8 *Rtx, u8 *VPrime);
+       const u8 *RxInfo, const u8 *SeqNumV, const XHdcp22_Rx_SessionKeys *KeysPtr,
+       u8 *VPrime);
 void XHdcp22Rx_ComputeMPrime(const u8 *StreamIdType, const u8 *SeqNumM,
-       const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *MPrime);
+       const XHdcp22_Rx_SessionKeys *KeysPtr, u8 *MPrime);
 
 #ifdef _XHDCP22_RX_TEST_
 /* External functions used for self-testing */
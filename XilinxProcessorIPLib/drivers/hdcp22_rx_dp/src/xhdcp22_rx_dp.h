@@ -72,6 +72,7 @@
 * 3.00  JB   12/24/21 File name changed from xhdcp22_rx.h to xhdcp22_rx_dp.h,
 *                     Also all the APIs and sructure names are added with
 *                     suffix _dp.
+*       ag   10/19/26 Added the HMAC-SHA256 key states of the session.
 *</pre>
 *
 *****************************************************************************/
@@ -90,6 +91,7 @@ extern "C" {
 #include "xdebug.h"
 #include "xtmrctr.h"
 #include "xhdcp22_rng.h"
+#include "xhdcp22_common.h"
 #include "xhdcp22_mmult.h"
 #include "xhdcp22_cipher_dp.h"
 
@@ -485,6 +487,17 @@ typedef struct
 
 } XHdcp22_Rx_Dp_Handles;
 
+/**
+ * This typedef contains the HMAC-SHA256 key states derived from Kd. They are
+ * computed once per session, when H' is computed, and used for L', V' and M'.
+ */
+typedef struct
+{
+	XHdcp22Cmn_HmacSha256Key Kd;       /**< Key Kd, for H' and V'. */
+	XHdcp22Cmn_HmacSha256Key KdRrx;    /**< Key Kd XOR Rrx, for L'. */
+	XHdcp22Cmn_HmacSha256Key Sha256Kd; /**< Key SHA256(Kd), for M'. */
+} XHdcp22_Rx_Dp_SessionKeys;
+
 /**
  * This typedef is used to store temporary parameters for computations
  */
@@ -505,6 +518,7 @@ typedef struct
 	u8 SeqNumM[3];
 	u8 StreamIdType[2];
 	u8 MPrime[32];
+	XHdcp22_Rx_Dp_SessionKeys SessionKeys;
 } XHdcp22_Rx_Dp_Parameters;
 
 /**
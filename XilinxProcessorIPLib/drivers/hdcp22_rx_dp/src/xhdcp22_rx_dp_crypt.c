@@ -22,6 +22,9 @@
 * 1.00  JB   02/19/19 First Release.
 * 3.00  JB   12/24/21 File name changed from xhdcp22_rx_crypt.c to
 *                     xhdcp22_rx_dp_crypt.c.
+*       ag   10/19/26 Compute the HMAC key states of Kd once per session
+*                     and stream H', V' and M' through the HMAC-SHA256
+*                     context.
 *</pre>
 *
 *****************************************************************************/
@@ -1028,53 +1031,93 @@ static void XHdcp22Rx_ComputeDKey(const u8* Rrx, const u8* Rtx, const u8 *Km,
 
 /*****************************************************************************/
 /**
-* This function computes HPrime used during HDCP 2.2 authentication and key
-* exchange.
+* This function computes the HMAC-SHA256 key states of a session. The key
+* schedule of each HMAC key, the two hashes of the padded key blocks, is
+* computed once here instead of for every H', L', V' and M'.
 *
-* Reference: HDCP v2.2, section 2.2
+* Reference: HDCP v2.2, section 2.7
 *
+* @param	Km is the master key generated by tx.
 * @param	Rrx is the Rx random generated value.
-* @param	RxCaps are the capabilities of the receiver.
 * @param	Rtx is the Tx random generated value.
-* @param	TxCaps are the capabilities of the receiver.
-* @param	Km is the master key generated by tx.
-* @param	HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+* @param	KeysPtr is a pointer to the key states output.
 *
 * @return	None.
 *
-* @note		None.
+* @note		The key states must be computed again when Km, Rrx or Rtx
+*			changes, that is for every AKE.
 ******************************************************************************/
-void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
-	const u8 *TxCaps, const u8 *Km, u8 *HPrime)
+void XHdcp22Rx_ComputeSessionKeys(const u8 *Km, const u8 *Rrx, const u8 *Rtx,
+	XHdcp22_Rx_Dp_SessionKeys *KeysPtr)
 {
-	u8 HashInput[XHDCP22_RX_RTX_SIZE + XHDCP22_RX_RXCAPS_SIZE + XHDCP22_RX_TXCAPS_SIZE];
-	int Idx = 0;
+	u8 HashKey[XHDCP22_RX_HASH_SIZE];
 	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
 	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
 
-
 	/* Verify arguments */
+	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(RxCaps != NULL);
 	Xil_AssertVoid(Rtx != NULL);
-	Xil_AssertVoid(TxCaps != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(HPrime != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 
 	/* Generate derived keys dkey0 and dkey1
 	   HashKey Kd = dkey0 || dkey1 */
 	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
 	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
 
-	/* HashInput = Rtx || RxCaps || TxCaps */
-	memcpy(HashInput, Rtx, XHDCP22_RX_RTX_SIZE);
-	Idx += XHDCP22_RX_RTX_SIZE;
-	memcpy(&HashInput[Idx], RxCaps, XHDCP22_RX_RXCAPS_SIZE);
-	Idx += XHDCP22_RX_RXCAPS_SIZE;
-	memcpy(&HashInput[Idx], TxCaps, XHDCP22_RX_TXCAPS_SIZE);
+	/* Key of H' and V' = Kd */
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->Kd, Kd, XHDCP22_RX_KD_SIZE);
+
+	/* Key of L' = Kd[256:64] || (Kd[63:0] xor Rrx) */
+	memcpy(HashKey, Kd, XHDCP22_RX_KD_SIZE);
+	XHdcp22Rx_Xor(HashKey+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE),
+		Kd+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE), Rrx, XHDCP22_RX_RRX_SIZE);
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->KdRrx, HashKey, XHDCP22_RX_KD_SIZE);
+
+	/* Key of M' = SHA256(Kd) */
+	XHdcp22Cmn_Sha256Hash(Kd, XHDCP22_RX_KD_SIZE, HashKey);
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->Sha256Kd, HashKey, XHDCP22_RX_HASH_SIZE);
+
+	memset(Kd, 0, sizeof(Kd));
+	memset(HashKey, 0, sizeof(HashKey));
+}
+
+/*****************************************************************************/
+/**
+* This function computes HPrime used during HDCP 2.2 authentication and key
+* exchange.
+*
+* Reference: HDCP v2.2, section 2.2
+*
+* @param	KeysPtr is a pointer to the key states of the session, see
+*			#XHdcp22Rx_ComputeSessionKeys.
+* @param	Rtx is the Tx random generated value.
+* @param	RxCaps are the capabilities of the receiver.
+* @param	TxCaps are the capabilities of the receiver.
+* @param	HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+*
+* @return	None.
+*
+* @note		None.
+******************************************************************************/
+void XHdcp22Rx_ComputeHPrime(const XHdcp22_Rx_Dp_SessionKeys *KeysPtr, const u8 *Rtx,
+	const u8 *RxCaps, const u8 *TxCaps, u8 *HPrime)
+{
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
+
+	/* Verify arguments */
+	Xil_AssertVoid(KeysPtr != NULL);
+	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(RxCaps != NULL);
+	Xil_AssertVoid(TxCaps != NULL);
+	Xil_AssertVoid(HPrime != NULL);
 
-	/* Compute H' = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), Kd, XHDCP22_RX_KD_SIZE, HPrime);
+	/* Compute H' = HMAC-SHA256(Rtx || RxCaps || TxCaps, Kd) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Kd);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, Rtx, XHDCP22_RX_RTX_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RxCaps, XHDCP22_RX_RXCAPS_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, TxCaps, XHDCP22_RX_TXCAPS_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, HPrime);
 }
 
 /*****************************************************************************/
@@ -1117,41 +1160,28 @@ void XHdcp22Rx_ComputeEkh(const u8 *KprivRx, const u8 *Km, const u8 *M, u8 *Ekh)
 *
 * Reference: HDCP v2.2, section 2.3
 *
+* @param	KeysPtr is a pointer to the key states of the session, see
+*			#XHdcp22Rx_ComputeSessionKeys.
 * @param	Rn is the 64-bit psuedo-random nonce generated by the transmitter.
-* @param	Km is the 128-bit master key generated by tx.
-* @param	Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param	Rtx is the 64-bit pseudo-random number generated by the transmitter.
 * @param	LPrime is the 256-bit value generated for locality check.
 *
 * @return	None.
 *
 * @note		None.
 ******************************************************************************/
-void XHdcp22Rx_ComputeLPrime(const u8 *Rn, const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *LPrime)
+void XHdcp22Rx_ComputeLPrime(const XHdcp22_Rx_Dp_SessionKeys *KeysPtr, const u8 *Rn, u8 *LPrime)
 {
-	u8 HashKey[XHDCP22_RX_KD_SIZE];
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Verify arguments */
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
 	Xil_AssertVoid(LPrime != NULL);
 
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
-	/* HashKey = Kd[256:64] || (Kd[63:0] xor Rrx) */
-	memcpy(HashKey, Kd, XHDCP22_RX_KD_SIZE);
-	XHdcp22Rx_Xor(HashKey+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE),
-		Kd+(XHDCP22_RX_KD_SIZE-XHDCP22_RX_RRX_SIZE), Rrx, XHDCP22_RX_RRX_SIZE);
-
-	/* LPrime = HMAC-SHA256(Rn, HashKey) */
-	XHdcp22Cmn_HmacSha256Hash(Rn, XHDCP22_RX_RN_SIZE, HashKey, XHDCP22_RX_KD_SIZE, LPrime);
+	/* LPrime = HMAC-SHA256(Rn, Kd[256:64] || (Kd[63:0] xor Rrx)) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->KdRrx);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, Rn, XHDCP22_RX_RN_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, LPrime);
 }
 
 /*****************************************************************************/
@@ -1207,9 +1237,10 @@ void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *R
 *         There can be between 1 and 31 devices in the list.
 * @param  RxInfo is the 16-bit field in the RepeaterAuth_Send_ReceiverID_List
 *         message.
-* @param  Km is the 128-bit master key generated by tx.
-* @param  Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param  Rtx is the 64-bit pseudo-random number generated by the transmitter.
+* @param  SeqNumV is the 24-bit field in the
+*         RepeaterAuth_Send_ReceiverID_List message.
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Rx_ComputeSessionKeys.
 * @param  VPrime is the 256-bit value generated for repeater authentication.
 *
 * @return None.
@@ -1217,57 +1248,41 @@ void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *R
 * @note   None.
 ******************************************************************************/
 void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
-       const u8 *RxInfo, const u8 *SeqNumV, const u8 *Km, const u8 *Rrx,
-       const u8 *Rtx, u8 *VPrime)
+       const u8 *RxInfo, const u8 *SeqNumV, const XHdcp22_Rx_Dp_SessionKeys *KeysPtr,
+       u8 *VPrime)
 {
-	int Idx = 0;
-	u8 HashInput[XHDCP22_RX_SEQNUMV_SIZE +
-					XHDCP22_RX_RXINFO_SIZE +
-					(XHDCP22_RX_MAX_DEVICE_COUNT*XHDCP22_RX_RCVID_SIZE)];
-	int HashInputSize = (ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE) +
-					XHDCP22_RX_SEQNUMV_SIZE + XHDCP22_RX_RXINFO_SIZE;
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Verify arguments */
 	Xil_AssertVoid(ReceiverIdList != NULL);
 	Xil_AssertVoid(ReceiverIdListSize > 0);
 	Xil_AssertVoid(RxInfo != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(SeqNumV != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(VPrime != NULL);
 
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
-	/* HashInput = ReceiverIdList || RxInfo || SeqNumV */
-	memcpy(HashInput, ReceiverIdList, ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE);
-	Idx += ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE;
-	memcpy(&HashInput[Idx], RxInfo, XHDCP22_RX_RXINFO_SIZE);
-	Idx += XHDCP22_RX_RXINFO_SIZE;
-	memcpy(&HashInput[Idx], SeqNumV, XHDCP22_RX_SEQNUMV_SIZE);
-
-	/* VPrime = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, HashInputSize, Kd, XHDCP22_RX_KD_SIZE, VPrime);
+	/* VPrime = HMAC-SHA256(ReceiverIdList || RxInfo || SeqNumV, Kd) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Kd);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, ReceiverIdList,
+		ReceiverIdListSize*XHDCP22_RX_RCVID_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RxInfo, XHDCP22_RX_RXINFO_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, SeqNumV, XHDCP22_RX_SEQNUMV_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, VPrime);
 }
 
 /*****************************************************************************/
 /**
-* This function computes VPrime used during HDCP 2.2 repeater
-* authentication.
+* This function computes MPrime used during HDCP 2.2 repeater
+* content stream management.
 *
 * Reference: HDCP v2.2, section 2.3
 *
-* @param  StreamIdType is the 16-bit field in the RepeaterAuth_Send_ReceiverID_List
+* @param  StreamIdType is the 16-bit field in the RepeaterAuth_Stream_Manage
 * 			  message.
 * @param  SeqNumM is the 24-bit field in the RepeaterAuth_Stream_Manage
 * 			  message.
-* @param  Km is the 128-bit master key generated by tx.
-* @param  Rrx is the 64-bit pseudo-random number generated by the receiver.
-* @param  Rtx is the 64-bit pseudo-random number generated by the transmitter.
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Rx_ComputeSessionKeys.
 * @param  MPrime is the 256-bit value generated for repeater stream
 *         management ready.
 *
@@ -1276,35 +1291,21 @@ void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
 * @note	  None.
 ******************************************************************************/
 void XHdcp22Rx_ComputeMPrime(const u8 *StreamIdType, const u8 *SeqNumM,
-       const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *MPrime)
+       const XHdcp22_Rx_Dp_SessionKeys *KeysPtr, u8 *MPrime)
 {
-	int Idx = 0;
-	u8 HashInput[XHDCP22_RX_STREAMID_SIZE + XHDCP22_RX_SEQNUMM_SIZE];
-	u8 HashKey[XHDCP22_RX_HASH_SIZE];
-	u8 Ctr[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-	u8 Kd[2 * XHDCP22_RX_AES_SIZE]; /* dkey0 || dkey 1 */
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Verify arguments */
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(StreamIdType != NULL);
+	Xil_AssertVoid(SeqNumM != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(MPrime != NULL);
 
-	/* HashInput = StreamIdType || SeqNumM */
-	memcpy(HashInput, StreamIdType, XHDCP22_RX_STREAMID_SIZE);
-	Idx += XHDCP22_RX_STREAMID_SIZE;
-	memcpy(&HashInput[Idx], SeqNumM, XHDCP22_RX_SEQNUMM_SIZE);
-
-	/* Generate derived keys dkey0 and dkey1
-	   HashKey Kd = dkey0 || dkey1 */
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, NULL, Kd);
-	XHdcp22Rx_ComputeDKey(Rrx, Rtx, Km, NULL, Ctr, Kd+XHDCP22_RX_AES_SIZE);
-
-	/* Hashkey = SHA256(Kd) */
-	XHdcp22Cmn_Sha256Hash(Kd, XHDCP22_RX_KD_SIZE, HashKey);
-
-	/* VPrime = HMAC-SHA256(HashInput, Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), HashKey, XHDCP22_RX_HASH_SIZE, MPrime);
+	/* MPrime = HMAC-SHA256(StreamIdType || SeqNumM, SHA256(Kd)) */
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Sha256Kd);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, StreamIdType, XHDCP22_RX_STREAMID_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, SeqNumM, XHDCP22_RX_SEQNUMM_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, MPrime);
 }
 
 /** @} */
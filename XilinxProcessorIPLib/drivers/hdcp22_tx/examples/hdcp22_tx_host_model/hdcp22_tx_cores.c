@@ -0,0 +1,165 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_cores.c
+*
+* This file contains the functions of the timer, RNG and cipher drivers the
+* transmitter calls. The registers of the cores are host memory, aligned so
+* that the subcore offsets can be or'ed to the base address as the driver
+* does.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xhdcp22_tx.h"
+#include "hdcp22_tx_cores.h"
+
+/************************** Constant Definitions *****************************/
+#define SUBCORE_SIZE	0x1000	/* Register space of a subcore */
+
+/************************** Variable Definitions *****************************/
+static u8 Regs[4 * SUBCORE_SIZE] __attribute__((aligned(4 * SUBCORE_SIZE)));
+static XTmrCtr_Config TmrCtrConfig = { 0, 0 * SUBCORE_SIZE, 100000000 };
+static XHdcp22_Rng_Config RngConfig = { 0, 1 * SUBCORE_SIZE };
+static XHdcp22_Cipher_Config CipherConfig = { 0, 2 * SUBCORE_SIZE };
+
+/*****************************************************************************/
+/**
+*
+* This function returns the base address to pass to XHdcp22Tx_CfgInitialize.
+*
+******************************************************************************/
+UINTPTR Hdcp22TxCores_BaseAddress(void)
+{
+	return (UINTPTR)Regs;
+}
+
+/*****************************************************************************/
+/**
+*
+* Functions of the other drivers used by the transmitter. The cores are
+* register space in Regs.
+*
+******************************************************************************/
+XTmrCtr_Config *XTmrCtr_LookupConfig(u16 DeviceId)
+{
+	(void)DeviceId;
+	return &TmrCtrConfig;
+}
+
+void XTmrCtr_CfgInitialize(XTmrCtr *InstancePtr, XTmrCtr_Config *ConfigPtr,
+		UINTPTR EffectiveAddr)
+{
+	InstancePtr->Config = *ConfigPtr;
+	InstancePtr->Config.BaseAddress = EffectiveAddr;
+	InstancePtr->BaseAddress = EffectiveAddr;
+	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+}
+
+void XTmrCtr_SetOptions(XTmrCtr *InstancePtr, u8 TmrCtrNumber, u32 Options)
+{
+	(void)InstancePtr;
+	(void)TmrCtrNumber;
+	(void)Options;
+}
+
+void XTmrCtr_SetHandler(XTmrCtr *InstancePtr, XTmrCtr_Handler FuncPtr,
+		void *CallBackRef)
+{
+	InstancePtr->Handler = FuncPtr;
+	InstancePtr->CallBackRef = CallBackRef;
+}
+
+void XTmrCtr_SetResetValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber,
+		u32 ResetValue)
+{
+	(void)InstancePtr;
+	(void)TmrCtrNumber;
+	(void)ResetValue;
+}
+
+void XTmrCtr_Start(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+	(void)InstancePtr;
+	(void)TmrCtrNumber;
+}
+
+void XTmrCtr_Stop(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+	(void)InstancePtr;
+	(void)TmrCtrNumber;
+}
+
+u32 XTmrCtr_GetValue(XTmrCtr *InstancePtr, u8 TmrCtrNumber)
+{
+	(void)InstancePtr;
+	(void)TmrCtrNumber;
+	return 0U;
+}
+
+XHdcp22_Rng_Config *XHdcp22Rng_LookupConfig(u16 DeviceId)
+{
+	(void)DeviceId;
+	return &RngConfig;
+}
+
+int XHdcp22Rng_CfgInitialize(XHdcp22_Rng *InstancePtr,
+		XHdcp22_Rng_Config *CfgPtr, UINTPTR EffectiveAddr)
+{
+	InstancePtr->Config = *CfgPtr;
+	InstancePtr->Config.BaseAddress = EffectiveAddr;
+	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+	return XST_SUCCESS;
+}
+
+XHdcp22_Cipher_Config *XHdcp22Cipher_LookupConfig(u16 DeviceId)
+{
+	(void)DeviceId;
+	return &CipherConfig;
+}
+
+int XHdcp22Cipher_CfgInitialize(XHdcp22_Cipher *InstancePtr,
+		XHdcp22_Cipher_Config *CfgPtr, UINTPTR EffectiveAddr)
+{
+	InstancePtr->Config = *CfgPtr;
+	InstancePtr->Config.BaseAddress = EffectiveAddr;
+	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+	return XST_SUCCESS;
+}
+
+void XHdcp22Cipher_SetKs(XHdcp22_Cipher *InstancePtr, const u8 *KsPtr,
+		u16 Length)
+{
+	(void)InstancePtr;
+	(void)KsPtr;
+	(void)Length;
+}
+
+void XHdcp22Cipher_SetLc128(XHdcp22_Cipher *InstancePtr, const u8 *Lc128Ptr,
+		u16 Length)
+{
+	(void)InstancePtr;
+	(void)Lc128Ptr;
+	(void)Length;
+}
+
+void XHdcp22Cipher_SetRiv(XHdcp22_Cipher *InstancePtr, const u8 *RivPtr,
+		u16 Length)
+{
+	(void)InstancePtr;
+	(void)RivPtr;
+	(void)Length;
+}
@@ -0,0 +1,40 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_cores.h
+*
+* This file declares the host model of the timer, RNG and cipher cores of the
+* transmitter, so that XHdcp22Tx_CfgInitialize() can run on the host.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef HDCP22_TX_CORES_H_
+#define HDCP22_TX_CORES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Function Prototypes ******************************/
+UINTPTR Hdcp22TxCores_BaseAddress(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HDCP22_TX_CORES_H_ */
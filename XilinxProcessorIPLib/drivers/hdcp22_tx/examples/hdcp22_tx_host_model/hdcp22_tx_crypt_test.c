@@ -0,0 +1,235 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_crypt_test.c
+*
+* This file checks the key derivations and hashes of the transmitter on the
+* host against the R1 and R2 facsimile vectors: H', L' and Edkey(Ks) for R1
+* and R2, V' and V, and M' for R1. It is built with the hdcp22_tx driver, and
+* with hdcp22_tx_dp when HDCP22_TX_MODEL_DP is defined.
+*
+* H', L', V and M are computed from the HMAC-SHA256 key states of the
+* session, computed once per vector set as the driver does once per AKE.
+* The time of every computation is printed, and the time of the key states.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "hdcp22_tx_kat.h"
+
+/************************** Constant Definitions *****************************/
+#define NUM_TIMED	20000	/* Timed calls */
+#define NUM_RCVID	3	/* Receiver IDs of the repeater vector */
+
+/**************************** Type Definitions *******************************/
+#ifdef HDCP22_TX_MODEL_DP
+typedef XHdcp22_Tx_Dp_SessionKeys SessionKeys;
+#else
+typedef XHdcp22_Tx_SessionKeys SessionKeys;
+#endif
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int TestSet(int Set);
+static int TestRepeater(void);
+static void TimeCalls(void);
+static double Elapsed(const struct timespec *Start);
+
+/************************** Variable Definitions *****************************/
+/* StreamID_Type and k of the stream management vector, one type 1 stream */
+static const u8 StreamIDType[XHDCP22_TX_STREAMID_TYPE_SIZE] = { 0x00, 0x01 };
+static const u8 K[XHDCP22_TX_K_SIZE] = { 0x00, 0x01 };
+static SessionKeys Keys[HDCP22_TX_KAT_NUM];
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	int Set;
+
+	for (Set = 0; Set < HDCP22_TX_KAT_NUM; Set++) {
+		if (TestSet(Set) != XST_SUCCESS) {
+			return 1;
+		}
+	}
+	if (TestRepeater() != XST_SUCCESS) {
+		return 1;
+	}
+	TimeCalls();
+
+	printf("Successfully ran crypt test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks H', L' and Edkey(Ks) of a vector set.
+*
+* @param	Set is the vector set.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestSet(int Set)
+{
+	u8 HPrime[XHDCP22_TX_H_PRIME_SIZE];
+	u8 LPrime[XHDCP22_TX_L_PRIME_SIZE];
+	u8 EdkeyKs[XHDCP22_TX_EDKEY_KS_SIZE];
+
+	XHdcp22Tx_ComputeSessionKeys(Hdcp22TxKat_Km[Set], Hdcp22TxKat_Rrx[Set],
+		Hdcp22TxKat_Rtx[Set], &Keys[Set]);
+
+	XHdcp22Tx_ComputeHPrime(&Keys[Set], Hdcp22TxKat_Rtx[Set],
+		Hdcp22TxKat_RxCaps[Set], Hdcp22TxKat_TxCaps, HPrime);
+	CHECK(memcmp(HPrime, Hdcp22TxKat_H1[Set], sizeof(HPrime)) == 0,
+			"H' differs");
+
+	XHdcp22Tx_ComputeLPrime(&Keys[Set], Hdcp22TxKat_Rn[Set], LPrime);
+	CHECK(memcmp(LPrime, Hdcp22TxKat_L1[Set], sizeof(LPrime)) == 0,
+			"L' differs");
+
+	XHdcp22Tx_ComputeEdkeyKs(Hdcp22TxKat_Rn[Set], Hdcp22TxKat_Km[Set],
+		Hdcp22TxKat_Ks, Hdcp22TxKat_Rrx[Set], Hdcp22TxKat_Rtx[Set],
+		EdkeyKs);
+	CHECK(memcmp(EdkeyKs, Hdcp22TxKat_EdkeyKs[Set], sizeof(EdkeyKs)) == 0,
+			"Edkey(Ks) differs");
+
+	printf("R%d: H', L' and Edkey(Ks) match\r\n", Set + 1);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks V', V and M' of the R1 repeater vectors, with the
+* key states of R1 computed by TestSet.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRepeater(void)
+{
+	u8 V[XHDCP22_TX_V_SIZE];
+	u8 M[XHDCP22_TX_M_PRIME_SIZE];
+
+	XHdcp22Tx_ComputeV(&Keys[0], Hdcp22TxKat_RxInfo, Hdcp22TxKat_RcvIDList,
+		NUM_RCVID, Hdcp22TxKat_SeqNum_V, V);
+	CHECK(memcmp(V, Hdcp22TxKat_V1, XHDCP22_TX_V_PRIME_SIZE) == 0,
+			"V' differs");
+	CHECK(memcmp(&V[XHDCP22_TX_V_PRIME_SIZE], Hdcp22TxKat_V,
+			XHDCP22_TX_V_PRIME_SIZE) == 0, "V differs");
+
+	XHdcp22Tx_ComputeM(&Keys[0], StreamIDType, K, Hdcp22TxKat_SeqNum_M, M);
+	CHECK(memcmp(M, Hdcp22TxKat_M1, sizeof(M)) == 0, "M' differs");
+
+	printf("R1: V', V and M' match\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time of the computations. Before the key states
+* were kept for the session, every H', L', V and M also took the time of
+* the key states.
+*
+* @return	None.
+*
+******************************************************************************/
+static void TimeCalls(void)
+{
+	struct timespec Start;
+	SessionKeys TimedKeys;
+	u8 Out[XHDCP22_TX_V_SIZE];
+	int Run;
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Tx_ComputeSessionKeys(Hdcp22TxKat_Km[0],
+			Hdcp22TxKat_Rrx[0], Hdcp22TxKat_Rtx[0], &TimedKeys);
+	}
+	printf("Key states: %.2f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Tx_ComputeHPrime(&Keys[0], Hdcp22TxKat_Rtx[0],
+			Hdcp22TxKat_RxCaps[0], Hdcp22TxKat_TxCaps, Out);
+	}
+	printf("H':         %.2f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Tx_ComputeLPrime(&Keys[0], Hdcp22TxKat_Rn[0], Out);
+	}
+	printf("L':         %.2f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Tx_ComputeEdkeyKs(Hdcp22TxKat_Rn[0], Hdcp22TxKat_Km[0],
+			Hdcp22TxKat_Ks, Hdcp22TxKat_Rrx[0], Hdcp22TxKat_Rtx[0],
+			Out);
+	}
+	printf("Edkey(Ks):  %.2f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Tx_ComputeV(&Keys[0], Hdcp22TxKat_RxInfo,
+			Hdcp22TxKat_RcvIDList, NUM_RCVID,
+			Hdcp22TxKat_SeqNum_V, Out);
+	}
+	printf("V:          %.2f us\r\n", Elapsed(&Start));
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		XHdcp22Tx_ComputeM(&Keys[0], StreamIDType, K,
+			Hdcp22TxKat_SeqNum_M, Out);
+	}
+	printf("M':         %.2f us\r\n", Elapsed(&Start));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time per timed call since Start, in us.
+*
+******************************************************************************/
+static double Elapsed(const struct timespec *Start)
+{
+	struct timespec End;
+
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	return ((double)(End.tv_sec - Start->tv_sec) * 1e6 +
+		(double)(End.tv_nsec - Start->tv_nsec) / 1e3) / NUM_TIMED;
+}
@@ -0,0 +1,156 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_kat.c
+*
+* This file contains the R1 and R2 facsimile vectors of the HDCP 2.2
+* specification errata used by the transmitter, as in xhdcp22_tx_test.c.
+* The repeater vectors, V and M, are given for R1 only.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "hdcp22_tx_kat.h"
+
+/************************** Variable Definitions *****************************/
+/** Authentication and key exchange
+ * Tx->Rx AKE_INIT: hardcoded rtx is normally generated by TX
+ */
+const u8 Hdcp22TxKat_Rtx[HDCP22_TX_KAT_NUM][XHDCP22_TX_RTX_SIZE] =
+{{ 0x18, 0xFA, 0xE4, 0x20, 0x6A, 0xFB, 0x51, 0x49 },  // R1
+ { 0xF9, 0xF1, 0x30, 0xA8, 0x2D, 0x5B, 0xE5, 0xC3 }};
+
+/** Tx->Rx AKE_INIT: tx caps */
+const u8 Hdcp22TxKat_TxCaps[XHDCP22_TX_TXCAPS_SIZE] = { 0x02, 0x00, 0x00 };
+
+/** Rx->Tx AKE_Send_Cert: RxCaps */
+const u8 Hdcp22TxKat_RxCaps[HDCP22_TX_KAT_NUM][XHDCP22_TX_RXCAPS_SIZE] =
+{{ 0x02, 0x00, 0x01 },  // R1
+ { 0x02, 0x00, 0x00 }};
+
+/** Rx->Tx AKE_Send_Cert: Rrx */
+const u8 Hdcp22TxKat_Rrx[HDCP22_TX_KAT_NUM][XHDCP22_TX_RRX_SIZE] =
+{{ 0x3B, 0xA0, 0xBE, 0xDE, 0x0C, 0x46, 0xA9, 0x91 },  // R1
+ { 0xE1, 0x7A, 0xB0, 0xFD, 0x0F, 0x54, 0x40, 0x52 }};
+
+/** Tx->Rx AKE_No_Stored_km: hardcoded Km is normally generated by TX */
+const u8 Hdcp22TxKat_Km[HDCP22_TX_KAT_NUM][XHDCP22_TX_KM_SIZE] =
+{{ // R1
+	0x68, 0xbc, 0xc5, 0x1b, 0xa9, 0xdb, 0x1b, 0xd0, 0xfa, 0xf1, 0x5e, 0x9a, 0xd8, 0xa5, 0xaf, 0xb9
+ },
+ { // R2
+	0xCA, 0x9F, 0x83, 0x95, 0x70, 0xD0, 0xD0, 0xF9, 0xCF, 0xE4, 0xEB, 0x54, 0x7E, 0x09, 0xFA, 0x3B
+}};
+
+/** Rx->Tx AKE_Send_H_Prime: H' */
+const u8 Hdcp22TxKat_H1[HDCP22_TX_KAT_NUM][XHDCP22_TX_H_PRIME_SIZE] =
+{{ // R1
+	0x69, 0xe0, 0xab, 0x21, 0x2f, 0xdb, 0x57, 0xe6, 0x7e, 0xfc, 0x43, 0x76,
+	0x1a, 0x2c, 0x5c, 0xce, 0x76, 0xc3, 0x65, 0xf1, 0x9b, 0x75, 0xc3, 0xea,
+	0xc2, 0xd2, 0x77, 0xdd, 0x5c, 0x7e, 0x4a, 0xc4
+ },
+ {  // R2
+	0x4F, 0xF1, 0xA2, 0xA5, 0x61, 0x67, 0xC8, 0xE0, 0xAD, 0x16, 0xC8, 0x95,
+	0x99, 0x1B, 0x1A, 0x21, 0xA8, 0x80, 0xC6, 0x27, 0x39, 0x3F, 0xC7, 0xBB,
+	0x83, 0xED, 0xA7, 0xE5, 0x69, 0x07, 0xA5, 0xDC
+}};
+
+/** Locality check
+ * Tx->Rx LC_Init: Rn hardcoded Rn is normally generated by TX*/
+const u8 Hdcp22TxKat_Rn[HDCP22_TX_KAT_NUM][XHDCP22_TX_RN_SIZE] =
+{{ // R1
+	0x32, 0x75, 0x3e, 0xa8, 0x78, 0xa6, 0x38, 0x1c
+ },
+ { // R2
+	0xA0, 0xFE, 0x9B, 0xB8, 0x20, 0x60, 0x58, 0xCA
+}};
+
+/** Tx->Rx SKE_Send_Eks */
+const u8 Hdcp22TxKat_Ks[XHDCP22_TX_KS_SIZE] = {
+	0xF3, 0xDF, 0x1D, 0xD9, 0x57, 0x96, 0x12, 0x3F,
+	0x98, 0x97, 0x89, 0xB4, 0x21, 0xE1, 0x2D, 0xE1
+};
+
+/** Tx->Rx SKE_Send_Eks */
+const u8 Hdcp22TxKat_EdkeyKs[HDCP22_TX_KAT_NUM][XHDCP22_TX_EDKEY_KS_SIZE] =
+{{ // R1
+	0x4c, 0x32, 0x47, 0x12, 0xc4, 0xbe, 0xc6, 0x69,
+	0x0a, 0xc2, 0x19, 0x64, 0xde, 0x91, 0xf1, 0x83
+ },
+ { // R2
+	0xB6, 0x8B, 0x8A, 0xA4, 0xD2, 0xCB, 0xBA, 0xFF,
+	0x53, 0x33, 0xC1, 0xD9, 0xBB, 0xB7, 0x10, 0xA9
+}};
+
+/** Rx->Tx LC_Send_L_Prime: L' */
+const u8 Hdcp22TxKat_L1[HDCP22_TX_KAT_NUM][XHDCP22_TX_L_PRIME_SIZE] =
+{{ // R1
+	0xbc, 0x20, 0x92, 0x33, 0x54, 0x91, 0xc1, 0x9e, 0xa4, 0xde, 0x8b, 0x30,
+	0x49, 0xc2, 0x06, 0x6a, 0xd8, 0x11, 0xa2, 0x2a, 0xb1, 0x46, 0xdf, 0x74,
+	0x58, 0x47, 0x05, 0xa8, 0xb7, 0x67, 0xfb, 0xdd
+ },
+ { // R2
+	0xF2, 0x0F, 0x13, 0x6E, 0x85, 0x53, 0xC1, 0x0C, 0xD3, 0xDD, 0xB2, 0xF9,
+	0x6D, 0x33, 0x31, 0xF9, 0xCB, 0x6E, 0x97, 0x8C, 0xCD, 0x5E, 0xDA, 0x13,
+	0xDD, 0xEA, 0x41, 0x44, 0x10, 0x9B, 0x51, 0xB0
+}};
+
+/** Tx->Rx RepeaterAuth_Send_Ack: V */
+const u8 Hdcp22TxKat_V[XHDCP22_TX_V_PRIME_SIZE] =
+{ // R1
+	0x63, 0x6d, 0xc5, 0x08, 0x4d, 0x6c, 0xb1, 0x0e, 0x93, 0xa5, 0x28, 0x67,
+	0x0f, 0x34, 0x1f, 0x88
+};
+
+/** Rx->Tx RepeaterAuth_Send_RecieverID_List: V' */
+const u8 Hdcp22TxKat_V1[XHDCP22_TX_V_PRIME_SIZE] =
+{ // R1
+	0xbc, 0xcc, 0x7d, 0x16, 0xe6, 0xbc, 0xb9, 0x02, 0x60, 0x08, 0x1d, 0xf7,
+	0x4a, 0xb4, 0x5c, 0x8a
+};
+
+/** Rx->Tx RepeaterAuth_Send_RecieverID_List: RxInfo */
+const u8 Hdcp22TxKat_RxInfo[XHDCP22_TX_RXINFO_SIZE] =
+{
+	0x02, 0x31
+};
+
+/** Rx->Tx RepeaterAuth_Send_RecieverID_List: seq_num_V */
+const u8 Hdcp22TxKat_SeqNum_V[XHDCP22_TX_SEQ_NUM_V_SIZE] =
+{
+	0x00, 0x00, 0x00
+};
+
+/** Rx->Tx RepeaterAuth_Send_RecieverID_List: ReceiverID list */
+const u8 Hdcp22TxKat_RcvIDList[3*XHDCP22_TX_RCVID_SIZE] =
+{
+	0x47, 0x8e, 0x71, 0xe2, 0x0f,
+	0x35, 0x79, 0x6a, 0x17, 0x0e,
+	0x74, 0xe8, 0x53, 0x97, 0xa2
+};
+
+/** Tx->Rx RepeaterAuth_Stream_Manage: seq_num_M */
+const u8 Hdcp22TxKat_SeqNum_M[XHDCP22_TX_SEQ_NUM_M_SIZE] =
+{
+	0x00, 0x00, 0x00
+};
+
+/** Rx->Tx RepeaterAuth_Stream_Ready: M' */
+const u8 Hdcp22TxKat_M1[XHDCP22_TX_M_PRIME_SIZE] =
+{
+	0xdd, 0x26, 0xe9, 0x52, 0x6e, 0x0e, 0x1d, 0x69, 0xc8, 0x84, 0xe4, 0xcc, 0xc8, 0x09, 0xaa, 0xc7,
+	0x71, 0xe9, 0x97, 0xb5, 0x61, 0x89, 0x09, 0x6e, 0x4d, 0x94, 0x24, 0xc2, 0x1b, 0x64, 0x58, 0xc6
+};
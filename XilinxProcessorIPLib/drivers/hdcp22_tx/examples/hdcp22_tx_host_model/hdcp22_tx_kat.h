@@ -0,0 +1,64 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_kat.h
+*
+* This file declares the known answer vectors of the transmitter. The
+* vectors are built with the hdcp22_tx driver, or with hdcp22_tx_dp when
+* HDCP22_TX_MODEL_DP is defined.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef HDCP22_TX_KAT_H_
+#define HDCP22_TX_KAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#ifdef HDCP22_TX_MODEL_DP
+#include "xhdcp22_tx_dp_i.h"
+#else
+#include "xhdcp22_tx_i.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#define HDCP22_TX_KAT_NUM	2	/**< Vector sets, R1 and R2 */
+
+/************************** Variable Definitions *****************************/
+extern const u8 Hdcp22TxKat_Rtx[HDCP22_TX_KAT_NUM][XHDCP22_TX_RTX_SIZE];
+extern const u8 Hdcp22TxKat_TxCaps[XHDCP22_TX_TXCAPS_SIZE];
+extern const u8 Hdcp22TxKat_RxCaps[HDCP22_TX_KAT_NUM][XHDCP22_TX_RXCAPS_SIZE];
+extern const u8 Hdcp22TxKat_Rrx[HDCP22_TX_KAT_NUM][XHDCP22_TX_RRX_SIZE];
+extern const u8 Hdcp22TxKat_Km[HDCP22_TX_KAT_NUM][XHDCP22_TX_KM_SIZE];
+extern const u8 Hdcp22TxKat_H1[HDCP22_TX_KAT_NUM][XHDCP22_TX_H_PRIME_SIZE];
+extern const u8 Hdcp22TxKat_Rn[HDCP22_TX_KAT_NUM][XHDCP22_TX_RN_SIZE];
+extern const u8 Hdcp22TxKat_Ks[XHDCP22_TX_KS_SIZE];
+extern const u8 Hdcp22TxKat_EdkeyKs[HDCP22_TX_KAT_NUM][XHDCP22_TX_EDKEY_KS_SIZE];
+extern const u8 Hdcp22TxKat_L1[HDCP22_TX_KAT_NUM][XHDCP22_TX_L_PRIME_SIZE];
+extern const u8 Hdcp22TxKat_V[XHDCP22_TX_V_PRIME_SIZE];
+extern const u8 Hdcp22TxKat_V1[XHDCP22_TX_V_PRIME_SIZE];
+extern const u8 Hdcp22TxKat_RxInfo[XHDCP22_TX_RXINFO_SIZE];
+extern const u8 Hdcp22TxKat_SeqNum_V[XHDCP22_TX_SEQ_NUM_V_SIZE];
+extern const u8 Hdcp22TxKat_RcvIDList[3*XHDCP22_TX_RCVID_SIZE];
+extern const u8 Hdcp22TxKat_SeqNum_M[XHDCP22_TX_SEQ_NUM_M_SIZE];
+extern const u8 Hdcp22TxKat_M1[XHDCP22_TX_M_PRIME_SIZE];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HDCP22_TX_KAT_H_ */
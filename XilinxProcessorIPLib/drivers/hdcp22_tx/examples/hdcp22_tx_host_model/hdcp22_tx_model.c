@@ -0,0 +1,78 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_model.c
+*
+* This file contains the BSP and driver functions the transmitter needs on
+* the host.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_printf.h"
+#include "xhdcp22_rng.h"
+
+/************************** Variable Definitions *****************************/
+u32 Xil_AssertStatus;
+
+/*****************************************************************************/
+/**
+*
+* Functions of the other drivers used by the transmitter.
+*
+******************************************************************************/
+void XHdcp22Rng_GetRandom(XHdcp22_Rng *InstancePtr, u8 *BufferPtr,
+		u16 BufferLength, u16 RandomLength)
+{
+	u16 Index;
+
+	(void)InstancePtr;
+	(void)BufferLength;
+	for (Index = 0U; Index < RandomLength; Index++) {
+		BufferPtr[Index] = (u8)rand();
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* BSP functions used by the drivers.
+*
+******************************************************************************/
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+void print(const char8 *Ptr)
+{
+	(void)fputs(Ptr, stdout);
+}
+
+void xil_printf(const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, Ctrl1);
+	(void)vprintf(Ctrl1, Args);
+	va_end(Args);
+}
@@ -0,0 +1,474 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_pairing_test.c
+*
+* This file checks the pairing info cache of the hdcp22_tx driver on the
+* host. The driver source is included, so that the static lookup, store and
+* invalidate functions of the state machine can be called.
+*
+* - XHdcp22Tx_CfgInitialize() sets every callback to a stub, and clearing the
+*   pairing info before the callback is set is safe.
+* - Random lookups, stores and invalidations of receivers from a pool twice
+*   the size of the cache are compared with a reference LRU model: the
+*   stored receivers, their Ready flags and the evictions match, and the
+*   hash index refers to every stored entry once.
+* - The pairing info updated callback fires when an entry becomes complete,
+*   a complete entry is invalidated and the list is cleared.
+* - A saved image restores the complete entries in LRU order. A corrupted
+*   image and a short buffer are rejected.
+*
+* The time of a lookup in a full cache is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/xhdcp22_tx.c"
+#include "hdcp22_tx_cores.h"
+
+/************************** Constant Definitions *****************************/
+#define MAX_ENTRIES	XHDCP22_TX_MAX_STORED_PAIRINGINFO
+#define NUM_IDS		(2 * MAX_ENTRIES)	/* Receivers of the pool */
+#define NUM_OPS		200000		/* Random operations */
+#define NUM_TIMED	1000000		/* Timed lookups */
+
+/**************************** Type Definitions *******************************/
+/* Reference model entry of a receiver of the pool */
+typedef struct {
+	u8 Stored;
+	u8 Ready;
+	u32 Age;
+} ModelEntry;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int TestInit(void);
+static int TestRandom(void);
+static int TestSaveLoad(void);
+static void TimeLookup(void);
+static int CheckModel(void);
+static void ModelStore(int Id, u8 Ready);
+static void MakePairingInfo(int Id, XHdcp22_Tx_PairingInfo *InfoPtr);
+static void PairingInfoUpdated(void *RefPtr);
+
+/************************** Variable Definitions *****************************/
+static XHdcp22_Tx Hdcp22Tx;
+static XHdcp22_Tx_Config Hdcp22TxConfig;
+static u8 Ids[NUM_IDS][XHDCP22_TX_CERT_RCVID_SIZE];
+static ModelEntry Model[NUM_IDS];
+static u32 ModelClock;
+static u32 ModelEvictions;
+static u32 NumUpdated;
+static u8 Image[XHDCP22_TX_PAIRINGINFO_STORE_SIZE];
+
+/* Sink of the timed calls */
+static volatile u8 Sink;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	srand(1U);
+	if ((TestInit() != XST_SUCCESS) || (TestRandom() != XST_SUCCESS) ||
+	    (TestSaveLoad() != XST_SUCCESS)) {
+		return 1;
+	}
+	TimeLookup();
+
+	printf("Successfully ran pairing test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the transmitter and checks the callbacks.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestInit(void)
+{
+	int Idx;
+
+	Hdcp22TxConfig.Mode = XHDCP22_TX_TRANSMITTER;
+	CHECK(XHdcp22Tx_CfgInitialize(&Hdcp22Tx, &Hdcp22TxConfig,
+			Hdcp22TxCores_BaseAddress()) == XST_SUCCESS, "initialization failed");
+	CHECK((Hdcp22Tx.AuthenticatedCallback == XHdcp22Tx_StubCallback) &&
+	      (Hdcp22Tx.UnauthenticatedCallback == XHdcp22Tx_StubCallback) &&
+	      (Hdcp22Tx.DownstreamTopologyAvailableCallback ==
+			XHdcp22Tx_StubCallback) &&
+	      (Hdcp22Tx.PairingInfoUpdatedCallback == XHdcp22Tx_StubCallback) &&
+	      (Hdcp22Tx.IsPairingInfoUpdatedCallbackSet == FALSE),
+			"callback not set to the stub");
+
+	/* As the test mode does, before the callback is set */
+	CHECK(XHdcp22Tx_ClearPairingInfo(&Hdcp22Tx) == XST_SUCCESS,
+			"clear failed");
+
+	CHECK(XHdcp22Tx_SetCallback(&Hdcp22Tx,
+			XHDCP22_TX_HANDLER_PAIRING_INFO_UPDATED,
+			(void *)PairingInfoUpdated, &Hdcp22Tx) == XST_SUCCESS,
+			"callback not set");
+	XHdcp22Tx_ClearPairingInfo(&Hdcp22Tx);
+	CHECK(NumUpdated == 1U, "clear not reported");
+
+	/* Distinct, non zero receiver Ids */
+	for (Idx = 0; Idx < NUM_IDS; Idx++) {
+		Ids[Idx][0] = (u8)(Idx + 1);
+		Ids[Idx][1] = (u8)rand();
+		Ids[Idx][2] = (u8)rand();
+		Ids[Idx][3] = (u8)rand();
+		Ids[Idx][4] = (u8)rand();
+	}
+
+	printf("Callbacks initialized to the stub\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs random operations on the cache and on the model.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRandom(void)
+{
+	XHdcp22_Tx_PairingInfo Info;
+	XHdcp22_Tx_PairingInfo *InfoPtr;
+	XHdcp22_Tx_PairingStats *StatsPtr;
+	u32 Updated;
+	int Op;
+	int Id;
+
+	for (Op = 0; Op < NUM_OPS; Op++) {
+		Id = rand() % NUM_IDS;
+		Updated = NumUpdated;
+
+		switch (rand() % 4) {
+		case 0:
+			/* Lookup at AKE_Send_Cert */
+			InfoPtr = XHdcp22Tx_GetPairingInfo(&Hdcp22Tx, Ids[Id]);
+			CHECK((InfoPtr != NULL) == (Model[Id].Stored != 0U),
+					"lookup differs");
+			if (InfoPtr != NULL) {
+				CHECK(InfoPtr->Ready == Model[Id].Ready,
+						"Ready differs");
+				if (Model[Id].Ready == TRUE) {
+					Model[Id].Age = ++ModelClock;
+				}
+			}
+			break;
+
+		case 1:
+			/* No stored Km, the entry is not complete yet */
+			MakePairingInfo(Id, &Info);
+			XHdcp22Tx_UpdatePairingInfo(&Hdcp22Tx, &Info, FALSE);
+			ModelStore(Id, FALSE);
+			CHECK(NumUpdated == Updated, "incomplete entry reported");
+			break;
+
+		case 2:
+			/* AKE_Send_Pairing_Info */
+			MakePairingInfo(Id, &Info);
+			XHdcp22Tx_UpdatePairingInfo(&Hdcp22Tx, &Info, TRUE);
+			ModelStore(Id, TRUE);
+			CHECK(NumUpdated == Updated + 1U,
+					"complete entry not reported");
+			break;
+
+		default:
+			/* Failed authentication */
+			XHdcp22Tx_InvalidatePairingInfo(&Hdcp22Tx, Ids[Id]);
+			CHECK(NumUpdated == Updated +
+				((Model[Id].Stored && Model[Id].Ready) ? 1U : 0U),
+					"invalidation reported wrongly");
+			Model[Id].Stored = 0U;
+			break;
+		}
+
+		if (CheckModel() != XST_SUCCESS) {
+			printf("Operation %d\r\n", Op);
+			return XST_FAILURE;
+		}
+	}
+
+	StatsPtr = XHdcp22Tx_GetPairingStats(&Hdcp22Tx);
+	CHECK(StatsPtr->Evictions == ModelEvictions, "evictions differ");
+	CHECK(StatsPtr->Hits + StatsPtr->Misses == StatsPtr->Lookups,
+			"statistics inconsistent");
+	printf("%d operations match the LRU model, %u lookups, %u hits, "
+		"%u evictions\r\n", NUM_OPS, StatsPtr->Lookups, StatsPtr->Hits,
+		StatsPtr->Evictions);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the save and load of the pairing info.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestSaveLoad(void)
+{
+	XHdcp22_Tx_PairingInfo Saved[MAX_ENTRIES];
+	XHdcp22_Tx_PairingInfo Info;
+	XHdcp22_Tx_PairingInfo *InfoPtr;
+	u32 Size;
+	u32 Short;
+	int NumReady = 0;
+	int Idx;
+	int Id;
+
+	/* A full cache with a few incomplete entries */
+	XHdcp22Tx_ClearPairingInfo(&Hdcp22Tx);
+	memset(Model, 0, sizeof(Model));
+	for (Id = 0; Id < MAX_ENTRIES; Id++) {
+		MakePairingInfo(Id, &Info);
+		XHdcp22Tx_UpdatePairingInfo(&Hdcp22Tx, &Info, (Id % 5) != 0);
+		ModelStore(Id, (Id % 5) != 0);
+	}
+	/* Use the first ones again, they are saved last */
+	for (Id = 0; Id < MAX_ENTRIES / 2; Id++) {
+		(void)XHdcp22Tx_GetPairingInfo(&Hdcp22Tx, Ids[Id]);
+	}
+	memcpy(Saved, Hdcp22Tx.Info.PairingInfo, sizeof(Saved));
+	for (Idx = 0; Idx < MAX_ENTRIES; Idx++) {
+		NumReady += (Saved[Idx].Ready == TRUE) ? 1 : 0;
+	}
+
+	CHECK(XHdcp22Tx_SavePairingInfo(&Hdcp22Tx, Image, sizeof(Image),
+			&Size) == XST_SUCCESS, "save failed");
+	CHECK(Size == 8U + (u32)NumReady * XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE +
+			XHDCP22_TX_SHA256_HASH_SIZE, "image size differs");
+	CHECK(XHdcp22Tx_SavePairingInfo(&Hdcp22Tx, Image, Size - 1U,
+			&Short) == XST_FAILURE, "short buffer accepted");
+
+	/* Restore into a new instance */
+	CHECK(XHdcp22Tx_CfgInitialize(&Hdcp22Tx, &Hdcp22TxConfig,
+			Hdcp22TxCores_BaseAddress()) == XST_SUCCESS, "initialization failed");
+	CHECK(XHdcp22Tx_LoadPairingInfo(&Hdcp22Tx, Image, Size) ==
+			XST_SUCCESS, "load failed");
+	for (Idx = 0; Idx < MAX_ENTRIES; Idx++) {
+		InfoPtr = XHdcp22Tx_GetPairingInfo(&Hdcp22Tx,
+				Saved[Idx].ReceiverId);
+		if (Saved[Idx].Ready == TRUE) {
+			CHECK((InfoPtr != NULL) &&
+			      (memcmp(InfoPtr, &Saved[Idx], sizeof(Info)) == 0),
+					"restored entry differs");
+		} else {
+			CHECK(InfoPtr == NULL, "incomplete entry restored");
+		}
+	}
+
+	/* The restored order is the LRU order: the next new receiver
+	 * replaces the least recently used one of the image */
+	XHdcp22Tx_LoadPairingInfo(&Hdcp22Tx, Image, Size);
+	for (Id = MAX_ENTRIES; Id < MAX_ENTRIES + (MAX_ENTRIES - NumReady) + 1;
+	     Id++) {
+		MakePairingInfo(Id, &Info);
+		XHdcp22Tx_UpdatePairingInfo(&Hdcp22Tx, &Info, TRUE);
+	}
+	CHECK(XHdcp22Tx_FindPairingInfo(&Hdcp22Tx, Ids[MAX_ENTRIES / 2]) < 0,
+			"least recently used entry kept");
+	CHECK(XHdcp22Tx_FindPairingInfo(&Hdcp22Tx, Ids[1]) >= 0,
+			"recently used entry replaced");
+
+	/* Corrupted image, the list is left untouched */
+	Image[8 + XHDCP22_TX_CERT_RCVID_SIZE] ^= 0x01;
+	CHECK(XHdcp22Tx_LoadPairingInfo(&Hdcp22Tx, Image, Size) ==
+			XST_FAILURE, "corrupted image accepted");
+	Image[8 + XHDCP22_TX_CERT_RCVID_SIZE] ^= 0x01;
+	CHECK(XHdcp22Tx_LoadPairingInfo(&Hdcp22Tx, Image, Size - 1U) ==
+			XST_FAILURE, "short image accepted");
+	CHECK(XHdcp22Tx_FindPairingInfo(&Hdcp22Tx, Ids[MAX_ENTRIES]) >= 0,
+			"list changed by a rejected image");
+
+	printf("%d entries saved and restored in LRU order\r\n", NumReady);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time of a lookup in a full cache.
+*
+* @return	None.
+*
+******************************************************************************/
+static void TimeLookup(void)
+{
+	XHdcp22_Tx_PairingInfo Info;
+	XHdcp22_Tx_PairingInfo *InfoPtr;
+	struct timespec Start;
+	struct timespec End;
+	int Run;
+	int Id;
+
+	XHdcp22Tx_ClearPairingInfo(&Hdcp22Tx);
+	for (Id = 0; Id < MAX_ENTRIES; Id++) {
+		MakePairingInfo(Id, &Info);
+		XHdcp22Tx_UpdatePairingInfo(&Hdcp22Tx, &Info, TRUE);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		InfoPtr = XHdcp22Tx_GetPairingInfo(&Hdcp22Tx,
+				Ids[Run % NUM_IDS]);
+		Sink ^= (InfoPtr != NULL) ? InfoPtr->Km[0] : 0U;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &End);
+
+	printf("Lookup, %d entries: %.1f ns\r\n", MAX_ENTRIES,
+		((double)(End.tv_sec - Start.tv_sec) * 1e9 +
+		 (double)(End.tv_nsec - Start.tv_nsec)) / NUM_TIMED);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares the cache with the model and checks the index.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int CheckModel(void)
+{
+	XHdcp22_Tx_Info *InfoPtr = &Hdcp22Tx.Info;
+	int NumStored = 0;
+	int NumIndexed = 0;
+	int Bucket;
+	int Id;
+
+	for (Id = 0; Id < NUM_IDS; Id++) {
+		Bucket = XHdcp22Tx_FindPairingInfo(&Hdcp22Tx, Ids[Id]);
+		CHECK((Bucket >= 0) == (Model[Id].Stored != 0U),
+				"stored receivers differ");
+		if (Bucket >= 0) {
+			CHECK(InfoPtr->PairingInfo[InfoPtr->PairingInfoIndex[
+				Bucket] - 1].Ready == Model[Id].Ready,
+					"Ready differs");
+			NumStored++;
+		}
+	}
+
+	for (Bucket = 0; Bucket < XHDCP22_TX_PAIRINGINFO_HASH_SIZE; Bucket++) {
+		NumIndexed += (InfoPtr->PairingInfoIndex[Bucket] != 0U) ? 1 : 0;
+	}
+	CHECK(NumIndexed == NumStored, "index refers to a removed entry");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stores a receiver in the model. When the model is full,
+* the least recently used incomplete entry, or else the least recently
+* used complete entry is evicted.
+*
+* @param	Id is the receiver of the pool.
+* @param	Ready indicates if the entry is complete.
+*
+* @return	None.
+*
+******************************************************************************/
+static void ModelStore(int Id, u8 Ready)
+{
+	int NumStored = 0;
+	int Victim = -1;
+	int Idx;
+
+	if (Model[Id].Stored == 0U) {
+		for (Idx = 0; Idx < NUM_IDS; Idx++) {
+			if (Model[Idx].Stored == 0U) {
+				continue;
+			}
+			NumStored++;
+			if ((Victim < 0) ||
+			    (Model[Idx].Ready < Model[Victim].Ready) ||
+			    ((Model[Idx].Ready == Model[Victim].Ready) &&
+			     (Model[Idx].Age < Model[Victim].Age))) {
+				Victim = Idx;
+			}
+		}
+		if (NumStored == MAX_ENTRIES) {
+			ModelEvictions += (Model[Victim].Ready == TRUE) ? 1U : 0U;
+			Model[Victim].Stored = 0U;
+		}
+	}
+
+	Model[Id].Stored = 1U;
+	Model[Id].Ready = Ready;
+	Model[Id].Age = ++ModelClock;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills the pairing info of a receiver of the pool.
+*
+******************************************************************************/
+static void MakePairingInfo(int Id, XHdcp22_Tx_PairingInfo *InfoPtr)
+{
+	u32 Idx;
+
+	memset(InfoPtr, 0, sizeof(*InfoPtr));
+	memcpy(InfoPtr->ReceiverId, Ids[Id], sizeof(InfoPtr->ReceiverId));
+	for (Idx = 0U; Idx < sizeof(InfoPtr->Km); Idx++) {
+		InfoPtr->Km[Idx] = (u8)rand();
+		InfoPtr->Ekh_Km[Idx] = (u8)rand();
+	}
+	InfoPtr->Rtx[0] = (u8)Id;
+	InfoPtr->Rrx[0] = (u8)~Id;
+	InfoPtr->RxCaps[2] = 0x02;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function counts the pairing info updated callbacks.
+*
+******************************************************************************/
+static void PairingInfoUpdated(void *RefPtr)
+{
+	(void)RefPtr;
+	NumUpdated++;
+}
@@ -0,0 +1,477 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file hdcp22_tx_revocation_test.c
+*
+* This file checks the revocation list of the hdcp22_tx driver on the host.
+* The driver source is included, with the SRM signature check redirected to
+* a function that can accept the SRMs built by the test.
+*
+* - The production SRM of xhdcp22_tx_test.c passes the real signature check
+*   and loads an empty, valid list. Loading it again skips the check. With
+*   the test keys, the errata SRM loads its two receiver IDs.
+* - A two generation SRM of 944 receiver IDs loads a sorted list, and every
+*   listed ID and random IDs give the result of a linear scan.
+* - An SRM of more IDs than the list holds fails and leaves no valid list.
+*   A rejected signature leaves the previous list.
+* - XHdcp22Tx_RevokeReceiverId adds an ID in order, and the next load of the
+*   same SRM drops it. With no valid list, it starts a list of that ID.
+*
+* The time of the revocation check of a topology of 31 devices, with a
+* linear scan and with the binary search, and of the loads is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.0   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Redirect the SRM signature check of the driver */
+#define XHdcp22Tx_VerifySRM VerifySrm
+#include "../../src/xhdcp22_tx.c"
+#undef XHdcp22Tx_VerifySRM
+#include "hdcp22_tx_cores.h"
+
+/************************** Constant Definitions *****************************/
+#define MAX_DEVICES	XHDCP22_TX_REVOCATION_LIST_MAX_DEVICES
+#define GEN1_DEVICES	600	/* IDs of the first generation */
+#define NUM_RANDOM	100000	/* Random IDs checked */
+#define NUM_TOPOLOGY	31	/* Devices of a full topology */
+#define NUM_TIMED	10000	/* Timed topology checks */
+#define SRM_MAX_SIZE	(2 * (12 + XHDCP22_TX_SRM_SIGNATURE_SIZE) + \
+			 1023 * XHDCP22_TX_SRM_RCVID_SIZE)
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+int XHdcp22Tx_VerifySRM(const u8* SrmPtr, int SrmSize,
+			const u8* KpubDcpNPtr, int KpubDcpNSize,
+			const u8* KpubDcpEPtr, int KpubDcpESize);
+static int TestProduction(void);
+static int TestLoad(void);
+static int TestFailures(void);
+static int TestRevoke(void);
+static u32 BuildSrm(u8 *SrmPtr, u16 Version, u32 Gen1Devices,
+		u32 Gen2Devices);
+static u8 LinearScan(const u8 *RecvIdPtr);
+static double ElapsedUs(const struct timespec *Start);
+
+/************************** Variable Definitions *****************************/
+static XHdcp22_Tx Hdcp22Tx;
+static XHdcp22_Tx_Config Hdcp22TxConfig;
+static u8 Srm[SRM_MAX_SIZE];
+static u8 SrmIds[1023 * 2][XHDCP22_TX_SRM_RCVID_SIZE];
+static u32 NumSrmIds;
+static u8 ForgeSignatures;
+static u8 ErrataId[2][XHDCP22_TX_SRM_RCVID_SIZE] = {
+	{0x74, 0x5B, 0xB8, 0xBD, 0x04}, {0x8B, 0xA4, 0x47, 0x42, 0xFB}
+};
+static u32 NumVerified;
+
+/* Sink of the timed calls */
+static volatile u8 Sink;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	srand(1U);
+	Hdcp22TxConfig.Mode = XHDCP22_TX_TRANSMITTER;
+	if (XHdcp22Tx_CfgInitialize(&Hdcp22Tx, &Hdcp22TxConfig,
+			Hdcp22TxCores_BaseAddress()) != XST_SUCCESS) {
+		printf("Initialization failed\r\n");
+		return 1;
+	}
+
+	if ((TestProduction() != XST_SUCCESS) || (TestLoad() != XST_SUCCESS) ||
+	    (TestFailures() != XST_SUCCESS) || (TestRevoke() != XST_SUCCESS)) {
+		return 1;
+	}
+
+	printf("Successfully ran revocation test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads the production SRM with the real signature check.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestProduction(void)
+{
+	const u8 *SrmPtr = XHdcp22Tx_TestGetSrm(&Hdcp22Tx, 2);
+	struct timespec Start;
+	double First;
+	double Again;
+
+	ForgeSignatures = FALSE;
+	NumVerified = 0U;
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, SrmPtr) == XST_SUCCESS,
+			"production SRM rejected");
+	First = ElapsedUs(&Start);
+	CHECK((Hdcp22Tx.Info.IsRevocationListValid == TRUE) &&
+	      (Hdcp22Tx.RevocationList.NumDevices == 0U) &&
+	      (NumVerified == 1U), "production SRM not loaded");
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, SrmPtr) == XST_SUCCESS,
+			"production SRM rejected");
+	Again = ElapsedUs(&Start);
+	CHECK(NumVerified == 1U, "loaded SRM verified again");
+
+	/* Errata SRM, signed with the test key */
+	XHdcp22Tx_TestSetMode(&Hdcp22Tx, XHDCP22_TX_TESTMODE_USE_TESTKEYS, 0);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx,
+			XHdcp22Tx_TestGetSrm(&Hdcp22Tx, 0)) == XST_SUCCESS,
+			"errata SRM rejected");
+	XHdcp22Tx_TestSetMode(&Hdcp22Tx, XHDCP22_TX_TESTMODE_DISABLED, 0);
+	CHECK((Hdcp22Tx.RevocationList.NumDevices == 2U) &&
+	      XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, ErrataId[0]) &&
+	      XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, ErrataId[1]) &&
+	      (NumVerified == 2U), "errata SRM not loaded");
+
+	printf("Production SRM: %.0f us, loaded again %.1f us\r\n", First,
+		Again);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function loads a full list and checks the lookups.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestLoad(void)
+{
+	XHdcp22_Tx_RevocationList *ListPtr = &Hdcp22Tx.RevocationList;
+	u8 Topology[NUM_TOPOLOGY][XHDCP22_TX_SRM_RCVID_SIZE];
+	u8 RecvId[XHDCP22_TX_SRM_RCVID_SIZE];
+	struct timespec Start;
+	double Linear;
+	double Binary;
+	u32 Idx;
+	int Run;
+
+	ForgeSignatures = TRUE;
+	BuildSrm(Srm, 2, GEN1_DEVICES, MAX_DEVICES - GEN1_DEVICES);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_SUCCESS,
+			"full SRM rejected");
+	CHECK((Hdcp22Tx.Info.IsRevocationListValid == TRUE) &&
+	      (ListPtr->NumDevices == MAX_DEVICES), "full SRM not loaded");
+	for (Idx = 1U; Idx < ListPtr->NumDevices; Idx++) {
+		CHECK(memcmp(ListPtr->ReceiverId[Idx - 1U],
+				ListPtr->ReceiverId[Idx],
+				XHDCP22_TX_SRM_RCVID_SIZE) < 0,
+				"list not sorted");
+	}
+
+	for (Idx = 0U; Idx < NumSrmIds; Idx++) {
+		CHECK(XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, SrmIds[Idx]),
+				"listed ID not revoked");
+	}
+	for (Run = 0; Run < NUM_RANDOM; Run++) {
+		for (Idx = 0U; Idx < sizeof(RecvId); Idx++) {
+			RecvId[Idx] = (u8)rand();
+		}
+		if ((Run & 1) != 0) {
+			/* Next to a listed ID */
+			memcpy(RecvId, SrmIds[Run % NumSrmIds], sizeof(RecvId));
+			RecvId[4] ^= (u8)(1U << (Run % 8));
+		}
+		CHECK(XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, RecvId) ==
+				LinearScan(RecvId), "lookup differs");
+	}
+
+	/* A topology of mostly unrevoked devices */
+	for (Idx = 0U; Idx < NUM_TOPOLOGY; Idx++) {
+		memcpy(Topology[Idx], SrmIds[(Idx * 97U) % NumSrmIds],
+				XHDCP22_TX_SRM_RCVID_SIZE);
+		Topology[Idx][0] ^= (Idx % 4U != 0U) ? 0x80 : 0x00;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		for (Idx = 0U; Idx < NUM_TOPOLOGY; Idx++) {
+			Sink ^= LinearScan(Topology[Idx]);
+		}
+	}
+	Linear = ElapsedUs(&Start) / NUM_TIMED;
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	for (Run = 0; Run < NUM_TIMED; Run++) {
+		for (Idx = 0U; Idx < NUM_TOPOLOGY; Idx++) {
+			Sink ^= XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx,
+					Topology[Idx]);
+		}
+	}
+	Binary = ElapsedUs(&Start) / NUM_TIMED;
+
+	printf("%u IDs loaded, %d random IDs match a linear scan\r\n",
+		(unsigned)ListPtr->NumDevices, NUM_RANDOM);
+	printf("Topology of %d: linear %.2f us, binary %.2f us\r\n",
+		NUM_TOPOLOGY, Linear, Binary);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the SRMs that fail to load.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestFailures(void)
+{
+	u32 Size;
+
+	/* Rejected signature, the loaded list stays in use */
+	ForgeSignatures = TRUE;
+	BuildSrm(Srm, 3, 10, 0);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_SUCCESS,
+			"SRM rejected");
+	ForgeSignatures = FALSE;
+	Size = BuildSrm(Srm, 4, 20, 0);
+	Srm[Size - 1U] ^= 0x01;
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_FAILURE,
+			"bad signature accepted");
+	CHECK((Hdcp22Tx.Info.IsRevocationListValid == TRUE) &&
+	      (Hdcp22Tx.RevocationList.NumDevices == 10U),
+			"list changed by a rejected SRM");
+
+	/* More IDs than the list holds, in the first and in the second
+	 * generation */
+	ForgeSignatures = TRUE;
+	BuildSrm(Srm, 5, 1000, 0);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_FAILURE,
+			"overflowing SRM accepted");
+	CHECK(Hdcp22Tx.Info.IsRevocationListValid == FALSE,
+			"overflowed list valid");
+
+	BuildSrm(Srm, 3, 10, 0);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_SUCCESS,
+			"SRM rejected");
+	BuildSrm(Srm, 6, GEN1_DEVICES, MAX_DEVICES - GEN1_DEVICES + 1U);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_FAILURE,
+			"overflowing SRM accepted");
+	CHECK(Hdcp22Tx.Info.IsRevocationListValid == FALSE,
+			"overflowed list valid");
+
+	printf("Overflowing SRMs leave no valid list\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks XHdcp22Tx_RevokeReceiverId.
+*
+* @return	XST_SUCCESS or XST_FAILURE.
+*
+******************************************************************************/
+static int TestRevoke(void)
+{
+	XHdcp22_Tx_RevocationList *ListPtr = &Hdcp22Tx.RevocationList;
+	u8 RecvId[XHDCP22_TX_SRM_RCVID_SIZE] = {0x55, 0x12, 0x34, 0x56, 0x78};
+	u32 Idx;
+
+	/* No valid list after the overflow, a new list is started */
+	XHdcp22Tx_RevokeReceiverId(&Hdcp22Tx, RecvId);
+	CHECK((Hdcp22Tx.Info.IsRevocationListValid == TRUE) &&
+	      (ListPtr->NumDevices == 1U) &&
+	      XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, RecvId),
+			"list of the revoked ID not started");
+
+	/* Added to a loaded list, in order */
+	BuildSrm(Srm, 7, 50, 0);
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_SUCCESS,
+			"SRM rejected");
+	CHECK(!XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, RecvId),
+			"revoked ID kept by the load");
+	XHdcp22Tx_RevokeReceiverId(&Hdcp22Tx, RecvId);
+	CHECK((ListPtr->NumDevices == 51U) && (ListPtr->IsSrmLoaded == FALSE) &&
+	      XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, RecvId),
+			"revoked ID not added");
+	for (Idx = 1U; Idx < ListPtr->NumDevices; Idx++) {
+		CHECK(memcmp(ListPtr->ReceiverId[Idx - 1U],
+				ListPtr->ReceiverId[Idx],
+				XHDCP22_TX_SRM_RCVID_SIZE) < 0,
+				"list not sorted");
+	}
+
+	/* The same SRM rebuilds the list */
+	CHECK(XHdcp22Tx_LoadRevocationTable(&Hdcp22Tx, Srm) == XST_SUCCESS,
+			"SRM rejected");
+	CHECK((ListPtr->NumDevices == 50U) &&
+	      !XHdcp22Tx_IsDeviceRevoked(&Hdcp22Tx, RecvId),
+			"revoked ID kept by the load of the same SRM");
+
+	printf("Revoked IDs are dropped by the next SRM load\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds an SRM of one or two generations with random receiver
+* IDs, and keeps the IDs in SrmIds. The signatures are left zero.
+*
+* @param	SrmPtr is the SRM buffer.
+* @param	Version is the SRM version.
+* @param	Gen1Devices is the number of IDs of the first generation.
+* @param	Gen2Devices is the number of IDs of the second generation,
+*		0 for no second generation.
+*
+* @return	The size of the SRM in bytes.
+*
+******************************************************************************/
+static u32 BuildSrm(u8 *SrmPtr, u16 Version, u32 Gen1Devices,
+		u32 Gen2Devices)
+{
+	u32 Length;
+	u32 Offset;
+	u32 Idx;
+
+	memset(SrmPtr, 0, SRM_MAX_SIZE);
+	NumSrmIds = 0U;
+
+	Length = 12U + Gen1Devices * XHDCP22_TX_SRM_RCVID_SIZE +
+		XHDCP22_TX_SRM_SIGNATURE_SIZE - 5U;
+	SrmPtr[0] = 0x91;
+	SrmPtr[2] = (u8)(Version >> 8);
+	SrmPtr[3] = (u8)Version;
+	SrmPtr[4] = (Gen2Devices != 0U) ? 2U : 1U;
+	SrmPtr[5] = (u8)(Length >> 16);
+	SrmPtr[6] = (u8)(Length >> 8);
+	SrmPtr[7] = (u8)Length;
+	SrmPtr[8] = (u8)(Gen1Devices >> 2);
+	SrmPtr[9] = (u8)((Gen1Devices & 0x3U) << 6);
+	Offset = 12U;
+	for (Idx = 0U; Idx < Gen1Devices; Idx++) {
+		SrmIds[NumSrmIds][0] = (u8)rand();
+		SrmIds[NumSrmIds][1] = (u8)rand();
+		SrmIds[NumSrmIds][2] = (u8)rand();
+		SrmIds[NumSrmIds][3] = (u8)(NumSrmIds >> 8);
+		SrmIds[NumSrmIds][4] = (u8)NumSrmIds;
+		memcpy(&SrmPtr[Offset], SrmIds[NumSrmIds],
+				XHDCP22_TX_SRM_RCVID_SIZE);
+		Offset += XHDCP22_TX_SRM_RCVID_SIZE;
+		NumSrmIds++;
+	}
+	Offset += XHDCP22_TX_SRM_SIGNATURE_SIZE;
+
+	if (Gen2Devices != 0U) {
+		Length = 4U + Gen2Devices * XHDCP22_TX_SRM_RCVID_SIZE +
+			XHDCP22_TX_SRM_SIGNATURE_SIZE;
+		SrmPtr[Offset] = (u8)(Length >> 8);
+		SrmPtr[Offset + 1U] = (u8)Length;
+		SrmPtr[Offset + 2U] = (u8)((Gen2Devices >> 8) & 0x3U);
+		SrmPtr[Offset + 3U] = (u8)Gen2Devices;
+		Offset += 4U;
+		for (Idx = 0U; Idx < Gen2Devices; Idx++) {
+			SrmIds[NumSrmIds][0] = (u8)rand();
+			SrmIds[NumSrmIds][1] = (u8)rand();
+			SrmIds[NumSrmIds][2] = (u8)rand();
+			SrmIds[NumSrmIds][3] = (u8)(NumSrmIds >> 8);
+			SrmIds[NumSrmIds][4] = (u8)NumSrmIds;
+			memcpy(&SrmPtr[Offset], SrmIds[NumSrmIds],
+					XHDCP22_TX_SRM_RCVID_SIZE);
+			Offset += XHDCP22_TX_SRM_RCVID_SIZE;
+			NumSrmIds++;
+		}
+		Offset += XHDCP22_TX_SRM_SIGNATURE_SIZE;
+	}
+
+	return Offset;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the SRM signature check of the driver. It accepts every
+* SRM when ForgeSignatures is set, otherwise it runs the real check.
+*
+******************************************************************************/
+int VerifySrm(const u8* SrmPtr, int SrmSize,
+		const u8* KpubDcpNPtr, int KpubDcpNSize,
+		const u8* KpubDcpEPtr, int KpubDcpESize)
+{
+	NumVerified++;
+	if (ForgeSignatures == TRUE) {
+		return XST_SUCCESS;
+	}
+
+	return XHdcp22Tx_VerifySRM(SrmPtr, SrmSize, KpubDcpNPtr, KpubDcpNSize,
+			KpubDcpEPtr, KpubDcpESize);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up a receiver ID as the driver did before the sort.
+*
+******************************************************************************/
+static u8 LinearScan(const u8 *RecvIdPtr)
+{
+	XHdcp22_Tx_RevocationList *ListPtr = &Hdcp22Tx.RevocationList;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < ListPtr->NumDevices; Idx++) {
+		if (memcmp(RecvIdPtr, ListPtr->ReceiverId[Idx],
+				XHDCP22_TX_SRM_RCVID_SIZE) == 0) {
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time since Start, in us.
+*
+******************************************************************************/
+static double ElapsedUs(const struct timespec *Start)
+{
+	struct timespec End;
+
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	return (double)(End.tv_sec - Start->tv_sec) * 1e6 +
+		(double)(End.tv_nsec - Start->tv_nsec) / 1e3;
+}
@@ -51,6 +51,18 @@
 *                          RxStatus register.
 * 2.31  YB     03/28/19 Moved the reading of the DDC status from
 *                          XHdcp22Tx_TimerHandler to XHdcp22Tx_Poll.
+* 3.0   ag     10/19/26 Replaced the linear pairing info table with a
+*                       receiver ID hash index and LRU replacement. Added
+*                       pairing info statistics, save/load of the pairing
+*                       info and the pairing info updated callback.
+*                       Revocation list is sorted on SRM load and binary
+*                       searched. Reloading the loaded SRM is skipped.
+*                       The HMAC key states of Kd are computed once per
+*                       session, at the verification of H'.
+*                       The pairing info updated callback is initialized
+*                       to the stub callback.
+*                       The revocation list is invalid while an SRM is
+*                       parsed. Revoking a receiver ID drops the loaded SRM.
 * </pre>
 *
 ******************************************************************************/
@@ -58,12 +70,16 @@
 /***************************** Include Files *********************************/
 #include "xhdcp22_tx.h"
 #include "xhdcp22_tx_i.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions *****************************/
 
 /** RxStatus value used to force re-authentication */
 #define XHDCP22_TX_INVALID_RXSTATUS 0xFFFF
 
+/** Magic number of a serialized pairing info image ("HPI1") */
+#define XHDCP22_TX_PAIRINGINFO_MAGIC 0x48504931
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /** Case replacement to copy a case Id to a string with a pre-lead */
@@ -174,6 +190,16 @@ static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
                                              const u8* ReceiverId);
 static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(XHdcp22_Tx *InstancePtr,
                               const XHdcp22_Tx_PairingInfo *PairingInfo, u8 Ready);
+static XHdcp22_Tx_PairingInfo *XHdcp22Tx_StorePairingInfo(XHdcp22_Tx *InstancePtr,
+                              const XHdcp22_Tx_PairingInfo *PairingInfo, u8 Ready);
+static int XHdcp22Tx_FindPairingInfo(XHdcp22_Tx *InstancePtr,
+                                     const u8 *ReceiverId);
+static void XHdcp22Tx_RemovePairingInfo(XHdcp22_Tx *InstancePtr, u32 Bucket);
+static u32 XHdcp22Tx_PairingInfoHash(const u8 *ReceiverId);
+static void XHdcp22Tx_PairingInfoUpdated(XHdcp22_Tx *InstancePtr);
+static void XHdcp22Tx_SortRevocationList(XHdcp22_Tx_RevocationList *RevocationListPtr);
+static u8 XHdcp22Tx_FindRevokedId(const XHdcp22_Tx_RevocationList *RevocationListPtr,
+                                  const u8 *RecvIdPtr, u32 *PosPtr);
 
 /* Timer functions */
 static void XHdcp22Tx_TimerHandler(void *CallbackRef, u8 TmrCntNumber);
@@ -313,6 +339,8 @@ int XHdcp22Tx_CfgInitialize(XHdcp22_Tx *InstancePtr, XHdcp22_Tx_Config *CfgPtr,
 	InstancePtr->IsUnauthenticatedCallbackSet = (FALSE);
 	InstancePtr->DownstreamTopologyAvailableCallback = XHdcp22Tx_StubCallback;
 	InstancePtr->IsDownstreamTopologyAvailableCallbackSet = (FALSE);
+	InstancePtr->PairingInfoUpdatedCallback = XHdcp22Tx_StubCallback;
+	InstancePtr->IsPairingInfoUpdatedCallbackSet = (FALSE);
 
 	InstancePtr->Info.Protocol = XHDCP22_TX_HDMI;
 
@@ -560,9 +588,17 @@ void XHdcp22Tx_LoadLc128(XHdcp22_Tx *InstancePtr, const u8 *Lc128Ptr)
 *
 * @return
 *    - XST_SUCCESS if loaded SRM successfully.
-*    - XST_FAILURE if SRM signature verification failed.
-*
-* @note		None.
+*    - XST_FAILURE if the SRM ID is unknown, the SRM signature
+*      verification failed or the SRM lists more receiver IDs than the
+*      revocation list holds.
+*
+* @note		The revocation list is sorted after loading. Loading the SRM
+*		that is already loaded, identified by its version and SHA256
+*		digest, skips signature verification and parsing. An SRM that
+*		is rejected before parsing leaves the previous list in use. An
+*		SRM that overflows the list leaves no valid list, so
+*		authentication is aborted until an SRM is loaded. The list
+*		replaces the receiver IDs added by #XHdcp22Tx_RevokeReceiverId.
 *
 ******************************************************************************/
 int XHdcp22Tx_LoadRevocationTable(XHdcp22_Tx *InstancePtr, const u8 *SrmPtr)
@@ -575,8 +611,10 @@ int XHdcp22Tx_LoadRevocationTable(XHdcp22_Tx *InstancePtr, const u8 *SrmPtr)
 	u8 SrmGenNr;
 	u32 BlockSize;
 	u32 LengthField;
+	u32 SrmSize;
 	u16 NumDevices;
 	const u8* ReceiverIdPtr;
+	u8 SrmDigest[XHDCP22_TX_SHA256_HASH_SIZE];
 	XHdcp22_Tx_RevocationList* RevocationListPtr = NULL;
 
 	/* Verify arguments */
@@ -610,6 +648,27 @@ int XHdcp22Tx_LoadRevocationTable(XHdcp22_Tx *InstancePtr, const u8 *SrmPtr)
 
 	/* The size of the first-generation SRM block */
 	BlockSize = LengthField + 5;
+	SrmSize = BlockSize;
+
+	/* Add the sizes of the next-generation SRM blocks */
+	for (int i = 1; i < SrmGenNr; i++) {
+		SrmBlockPtr = &SrmPtr[SrmSize];
+		LengthField  = SrmBlockPtr[0] << 8; // MSB
+		LengthField |= SrmBlockPtr[1];      // LSB
+		SrmSize += LengthField;
+	}
+
+	/* Nothing to do if this SRM is already loaded */
+	RevocationListPtr = XHdcp22Tx_GetRevocationReceiverIdList(InstancePtr);
+	XHdcp22Cmn_Sha256Hash(SrmPtr, SrmSize, SrmDigest);
+	if ((InstancePtr->Info.IsRevocationListValid == TRUE) &&
+	    (RevocationListPtr->IsSrmLoaded == TRUE) &&
+	    (RevocationListPtr->SrmVersion == SrmVersion) &&
+	    (memcmp(RevocationListPtr->SrmDigest, SrmDigest, sizeof(SrmDigest)) == 0)) {
+		return XST_SUCCESS;
+	}
+
+	SrmBlockPtr = SrmPtr;
 
 	KPubDpcPtr = XHdcp22Tx_GetKPubDpc(InstancePtr);
 
@@ -669,8 +728,10 @@ int XHdcp22Tx_LoadRevocationTable(XHdcp22_Tx *InstancePtr, const u8 *SrmPtr)
 	NumDevices  = SrmBlockPtr[8] << 2; // MSB
 	NumDevices |= SrmBlockPtr[9] >> 6; // LSB
 
-	RevocationListPtr = XHdcp22Tx_GetRevocationReceiverIdList(InstancePtr);
+	/* The list is not valid until it is parsed and sorted */
+	InstancePtr->Info.IsRevocationListValid = (FALSE);
 	RevocationListPtr->NumDevices = 0;
+	RevocationListPtr->IsSrmLoaded = (FALSE);
 
 	/* byte 12 will contain the first byte of the first receiver ID */
 	ReceiverIdPtr = &SrmBlockPtr[12];
@@ -721,11 +782,118 @@ int XHdcp22Tx_LoadRevocationTable(XHdcp22_Tx *InstancePtr, const u8 *SrmPtr)
 		SrmBlockPtr += BlockSize;
 	}
 
+	/* Sort the list for binary search lookups */
+	XHdcp22Tx_SortRevocationList(RevocationListPtr);
+
+	/* Remember the SRM so that reloading it is for free */
+	RevocationListPtr->SrmVersion = SrmVersion;
+	memcpy(RevocationListPtr->SrmDigest, SrmDigest, sizeof(SrmDigest));
+	RevocationListPtr->IsSrmLoaded = (TRUE);
+
 	InstancePtr->Info.IsRevocationListValid = (TRUE);
 
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function sorts the receiver IDs of the revocation list in ascending
+* order using an in-place heap sort.
+*
+* @param    RevocationListPtr is a pointer to the revocation list.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XHdcp22Tx_SortRevocationList(XHdcp22_Tx_RevocationList *RevocationListPtr)
+{
+	u8 (*Id)[XHDCP22_TX_SRM_RCVID_SIZE] = RevocationListPtr->ReceiverId;
+	u8 Tmp[XHDCP22_TX_SRM_RCVID_SIZE];
+	u32 Num = RevocationListPtr->NumDevices;
+	u32 Start, End, Root, Child;
+
+	if (Num < 2) {
+		return;
+	}
+
+	/* Build a max-heap, then repeatedly move the maximum to the end */
+	Start = Num / 2;
+	End = Num;
+	while (End > 1) {
+		if (Start > 0) {
+			Start--;
+		} else {
+			End--;
+			memcpy(Tmp, Id[0], sizeof(Tmp));
+			memcpy(Id[0], Id[End], sizeof(Tmp));
+			memcpy(Id[End], Tmp, sizeof(Tmp));
+		}
+
+		/* Sift down */
+		Root = Start;
+		while ((Child = (2 * Root) + 1) < End) {
+			if ((Child + 1 < End) &&
+			    (memcmp(Id[Child], Id[Child + 1], sizeof(Tmp)) < 0)) {
+				Child++;
+			}
+			if (memcmp(Id[Root], Id[Child], sizeof(Tmp)) >= 0) {
+				break;
+			}
+			memcpy(Tmp, Id[Root], sizeof(Tmp));
+			memcpy(Id[Root], Id[Child], sizeof(Tmp));
+			memcpy(Id[Child], Tmp, sizeof(Tmp));
+			Root = Child;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function binary searches the sorted revocation list.
+*
+* @param    RevocationListPtr is a pointer to the revocation list.
+* @param    RecvIdPtr is a pointer to the ReceiverID to lookup.
+* @param    PosPtr is a pointer to the index of the ReceiverID, or the index
+*           where it is to be inserted if it is not found.
+*
+* @return
+*    - TRUE if Receiver ID was found in the revocation list
+*    - FALSE if Receiver ID was not found in the revocation list
+*
+* @note     None.
+*
+******************************************************************************/
+static u8 XHdcp22Tx_FindRevokedId(const XHdcp22_Tx_RevocationList *RevocationListPtr,
+                                  const u8 *RecvIdPtr, u32 *PosPtr)
+{
+	u32 Low = 0;
+	u32 High = RevocationListPtr->NumDevices;
+	u32 Mid;
+	int Result;
+
+	while (Low < High) {
+		Mid = Low + ((High - Low) / 2);
+		Result = memcmp(RecvIdPtr, RevocationListPtr->ReceiverId[Mid],
+		                XHDCP22_TX_SRM_RCVID_SIZE);
+		if (Result == 0) {
+			*PosPtr = Mid;
+			return TRUE;
+		}
+		if (Result < 0) {
+			High = Mid;
+		} else {
+			Low = Mid + 1;
+		}
+	}
+
+	*PosPtr = Low;
+	return FALSE;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -743,23 +911,14 @@ int XHdcp22Tx_LoadRevocationTable(XHdcp22_Tx *InstancePtr, const u8 *SrmPtr)
 ******************************************************************************/
 u8 XHdcp22Tx_IsDeviceRevoked(XHdcp22_Tx *InstancePtr, u8 *RecvIdPtr)
 {
-	int Result;
-	u32 i;
-	XHdcp22_Tx_RevocationList* RevocationListPtr = NULL;
+	u32 Pos;
 
 	/* Verify arguments */
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(RecvIdPtr != NULL);
 
-	RevocationListPtr = XHdcp22Tx_GetRevocationReceiverIdList(InstancePtr);
-
-	/* Loop over the revocation list */
-	for (i = 0; i < RevocationListPtr->NumDevices; i++) {
-		Result = memcmp(RecvIdPtr, RevocationListPtr->ReceiverId[i], XHDCP22_TX_SRM_RCVID_SIZE);
-		if (Result == 0)
-			return TRUE;
-	}
-	return FALSE;
+	return XHdcp22Tx_FindRevokedId(
+		XHdcp22Tx_GetRevocationReceiverIdList(InstancePtr), RecvIdPtr, &Pos);
 }
 
 /*****************************************************************************/
@@ -1067,6 +1226,10 @@ int XHdcp22Tx_Reset(XHdcp22_Tx *InstancePtr)
 	/* Clear Topology Available flag */
 	InstancePtr->Info.IsTopologyAvailable = (FALSE);
 
+	/* Clear the key states of the session */
+	memset(&InstancePtr->Info.SessionKeys, 0x00,
+	       sizeof(InstancePtr->Info.SessionKeys));
+
 	/* Disable encryption */
 	XHdcp22Tx_DisableEncryption(InstancePtr);
 
@@ -1455,6 +1618,14 @@ int XHdcp22Tx_SetCallback(XHdcp22_Tx *InstancePtr, XHdcp22_Tx_HandlerType Handle
 			Status = (XST_SUCCESS);
 			break;
 
+		// Stored pairing info has changed
+		case (XHDCP22_TX_HANDLER_PAIRING_INFO_UPDATED) :
+			InstancePtr->PairingInfoUpdatedCallback = (XHdcp22_Tx_Callback)CallbackFunc;
+			InstancePtr->PairingInfoUpdatedCallbackRef = CallbackRef;
+			InstancePtr->IsPairingInfoUpdatedCallbackSet = (TRUE);
+			Status = (XST_SUCCESS);
+			break;
+
 		default:
 			Status = (XST_INVALID_PARAM);
 			break;
@@ -1878,9 +2049,12 @@ static XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_Nsk0(XHdcp22_Tx *InstancePtr)
 	/* Verify the received H' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
                   XHDCP22_TX_LOG_DBG_COMPUTE_H);
-	XHdcp22Tx_ComputeHPrime(PairingInfoPtr->Rrx, PairingInfoPtr->RxCaps,
-	                        PairingInfoPtr->Rtx, XHdcp22_Tx_TxCaps,
-	                        PairingInfoPtr->Km, HPrime);
+	XHdcp22Tx_ComputeSessionKeys(PairingInfoPtr->Km, PairingInfoPtr->Rrx,
+	                             PairingInfoPtr->Rtx,
+	                             &InstancePtr->Info.SessionKeys);
+	XHdcp22Tx_ComputeHPrime(&InstancePtr->Info.SessionKeys,
+	                        PairingInfoPtr->Rtx, PairingInfoPtr->RxCaps,
+	                        XHdcp22_Tx_TxCaps, HPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	                XHDCP22_TX_LOG_DBG_COMPUTE_H_DONE);
 
@@ -2013,9 +2187,12 @@ static XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_Sk0(XHdcp22_Tx *InstancePtr)
 	/* Verify the received H' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 								 XHDCP22_TX_LOG_DBG_COMPUTE_H);
-	XHdcp22Tx_ComputeHPrime(InstancePtr->Info.Rrx, PairingInfoPtr->RxCaps,
-							InstancePtr->Info.Rtx, XHdcp22_Tx_TxCaps,
-							PairingInfoPtr->Km, HPrime);
+	XHdcp22Tx_ComputeSessionKeys(PairingInfoPtr->Km, InstancePtr->Info.Rrx,
+	                             InstancePtr->Info.Rtx,
+	                             &InstancePtr->Info.SessionKeys);
+	XHdcp22Tx_ComputeHPrime(&InstancePtr->Info.SessionKeys,
+							InstancePtr->Info.Rtx, PairingInfoPtr->RxCaps,
+							XHdcp22_Tx_TxCaps, HPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 								 XHDCP22_TX_LOG_DBG_COMPUTE_H_DONE);
 
@@ -2100,8 +2277,6 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx *InstancePtr)
 	int Result = XST_SUCCESS;
 	u8 LPrime[XHDCP22_TX_H_PRIME_SIZE];
 
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-	                       (XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 	                      (XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 
@@ -2137,9 +2312,8 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx *InstancePtr)
 	/* Verify the received L' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	XHDCP22_TX_LOG_DBG_COMPUTE_L);
-	XHdcp22Tx_ComputeLPrime(InstancePtr->Info.Rn, PairingInfoPtr->Km,
-	                        InstancePtr->Info.Rrx, InstancePtr->Info.Rtx,
-	                        LPrime);
+	XHdcp22Tx_ComputeLPrime(&InstancePtr->Info.SessionKeys,
+	                        InstancePtr->Info.Rn, LPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 		XHDCP22_TX_LOG_DBG_COMPUTE_L_DONE);
 
@@ -2354,8 +2528,6 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA6_A7_A8(XHdcp22_Tx *InstancePtr)
 	 * so clear the topology available flag */
 	InstancePtr->Info.IsTopologyAvailable = (FALSE);
 
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-		(XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 		(XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 	/* Wait for the receiver to respond within 3 secs.
@@ -2416,13 +2588,11 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA6_A7_A8(XHdcp22_Tx *InstancePtr)
 
 	/* Verify the received VPrime */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_V);
-	XHdcp22Tx_ComputeV(InstancePtr->Info.Rn, InstancePtr->Info.Rrx,
+	XHdcp22Tx_ComputeV(&InstancePtr->Info.SessionKeys,
 		MsgPtr->Message.RepeatAuthSendRecvIDList.RxInfo,
-		InstancePtr->Info.Rtx,
 		(u8 *)MsgPtr->Message.RepeatAuthSendRecvIDList.ReceiverIDs,
 		DeviceCount,
 		MsgPtr->Message.RepeatAuthSendRecvIDList.SeqNum_V,
-		PairingInfoPtr->Km,
 		V);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_V_DONE);
 
@@ -3474,6 +3644,10 @@ static int XHdcp22Tx_WriteAKEInit(XHdcp22_Tx *InstancePtr)
 	MsgPtr->DdcAddress = XHDCP22_TX_HDCPPORT_WRITE_MSG_OFFSET;
 	MsgPtr->Message.MsgId = XHDCP22_TX_AKE_INIT;
 
+	/* A new session starts, clear the key states of the last one */
+	memset(&InstancePtr->Info.SessionKeys, 0x00,
+	       sizeof(InstancePtr->Info.SessionKeys));
+
 	/* Generate Rtx and add to the buffer*/
 	XHdcp22Tx_GenerateRtx(InstancePtr, InstancePtr->Info.Rtx);
 
@@ -3701,8 +3875,6 @@ static int XHdcp22Tx_WriteRepeaterAuth_Send_Ack(XHdcp22_Tx *InstancePtr, const u
 ******************************************************************************/
 static int XHdcp22Tx_WriteRepeaterAuth_Stream_Manage(XHdcp22_Tx *InstancePtr)
 {
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-		(XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage* MsgPtr =
 		(XHdcp22_Tx_DDCMessage*)InstancePtr->MessageBuffer;
 
@@ -3727,13 +3899,10 @@ static int XHdcp22Tx_WriteRepeaterAuth_Stream_Manage(XHdcp22_Tx *InstancePtr)
 	/* To make verifying the MPrime from the repeater easier,
 	 * the M is calculated and stored before executing the write */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_M);
-	XHdcp22Tx_ComputeM(InstancePtr->Info.Rn,
-		InstancePtr->Info.Rrx,
-		InstancePtr->Info.Rtx,
+	XHdcp22Tx_ComputeM(&InstancePtr->Info.SessionKeys,
 		MsgPtr->Message.RepeatAuthStreamManage.StreamID_Type,
 		MsgPtr->Message.RepeatAuthStreamManage.K,
 		MsgPtr->Message.RepeatAuthStreamManage.SeqNum_M,
-		PairingInfoPtr->Km,
 		InstancePtr->Info.M);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_M_DONE);
 
@@ -3821,7 +3990,7 @@ static int XHdcp22Tx_ReceiveMsg(XHdcp22_Tx *InstancePtr, u8 MessageId,
 *
 * @return  XST_SUCCESS
 *
-* @note    None.
+* @note    The pairing info updated callback is invoked, if set.
 *
 ******************************************************************************/
 int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr)
@@ -3830,9 +3999,346 @@ int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr)
 
 	memset(InstancePtr->Info.PairingInfo, 0x00,
 	       sizeof(InstancePtr->Info.PairingInfo));
+	memset(InstancePtr->Info.PairingInfoIndex, 0x00,
+	       sizeof(InstancePtr->Info.PairingInfoIndex));
+	memset(InstancePtr->Info.PairingInfoAge, 0x00,
+	       sizeof(InstancePtr->Info.PairingInfoAge));
+	InstancePtr->Info.PairingInfoClock = 0;
+
+	XHdcp22Tx_PairingInfoUpdated(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function serializes the valid pairing info entries into a buffer,
+* so they can be written to persistent storage and restored with
+* #XHdcp22Tx_LoadPairingInfo after a power cycle. The entries are written
+* from least to most recently used and protected by a SHA256 digest.
+*
+* @param  InstancePtr is a pointer to the XHdcp22Tx core instance.
+* @param  BufferPtr is a pointer to the output buffer.
+* @param  BufferSize is the size of the output buffer in bytes. A buffer of
+*         #XHDCP22_TX_PAIRINGINFO_STORE_SIZE bytes always suffices.
+* @param  SizePtr is a pointer to the number of bytes written.
+*
+* @return
+*         - XST_SUCCESS if the pairing info was serialized.
+*         - XST_FAILURE if the buffer is too small.
+*
+* @note   The image contains Km and Ekh(Km) in the clear. It shall only be
+*         written to storage that is protected against readout.
+*
+******************************************************************************/
+int XHdcp22Tx_SavePairingInfo(XHdcp22_Tx *InstancePtr, u8 *BufferPtr,
+                              u32 BufferSize, u32 *SizePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(SizePtr != NULL);
+
+	u8 Order[XHDCP22_TX_MAX_STORED_PAIRINGINFO];
+	XHdcp22_Tx_PairingInfo *InfoPtr;
+	u32 NumEntries = 0;
+	u32 Offset;
+	int i, j;
+
+	/* Collect the valid entries sorted from oldest to newest */
+	for (i = 0; i < XHDCP22_TX_MAX_STORED_PAIRINGINFO; i++) {
+		if (InstancePtr->Info.PairingInfo[i].Ready != TRUE) {
+			continue;
+		}
+		for (j = NumEntries; j > 0; j--) {
+			if (InstancePtr->Info.PairingInfoAge[Order[j - 1]] <=
+			    InstancePtr->Info.PairingInfoAge[i]) {
+				break;
+			}
+			Order[j] = Order[j - 1];
+		}
+		Order[j] = i;
+		NumEntries++;
+	}
+
+	*SizePtr = 8 + (NumEntries * XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE) +
+	           XHDCP22_TX_SHA256_HASH_SIZE;
+	if (BufferSize < *SizePtr) {
+		return XST_FAILURE;
+	}
+
+	/* Header: magic || number of entries, both big endian */
+	BufferPtr[0] = (XHDCP22_TX_PAIRINGINFO_MAGIC >> 24) & 0xFF;
+	BufferPtr[1] = (XHDCP22_TX_PAIRINGINFO_MAGIC >> 16) & 0xFF;
+	BufferPtr[2] = (XHDCP22_TX_PAIRINGINFO_MAGIC >> 8) & 0xFF;
+	BufferPtr[3] = XHDCP22_TX_PAIRINGINFO_MAGIC & 0xFF;
+	BufferPtr[4] = (NumEntries >> 24) & 0xFF;
+	BufferPtr[5] = (NumEntries >> 16) & 0xFF;
+	BufferPtr[6] = (NumEntries >> 8) & 0xFF;
+	BufferPtr[7] = NumEntries & 0xFF;
+	Offset = 8;
+
+	for (i = 0; i < (int)NumEntries; i++) {
+		InfoPtr = &InstancePtr->Info.PairingInfo[Order[i]];
+		memcpy(&BufferPtr[Offset], InfoPtr->ReceiverId, sizeof(InfoPtr->ReceiverId));
+		Offset += sizeof(InfoPtr->ReceiverId);
+		memcpy(&BufferPtr[Offset], InfoPtr->RxCaps, sizeof(InfoPtr->RxCaps));
+		Offset += sizeof(InfoPtr->RxCaps);
+		memcpy(&BufferPtr[Offset], InfoPtr->Rtx, sizeof(InfoPtr->Rtx));
+		Offset += sizeof(InfoPtr->Rtx);
+		memcpy(&BufferPtr[Offset], InfoPtr->Rrx, sizeof(InfoPtr->Rrx));
+		Offset += sizeof(InfoPtr->Rrx);
+		memcpy(&BufferPtr[Offset], InfoPtr->Km, sizeof(InfoPtr->Km));
+		Offset += sizeof(InfoPtr->Km);
+		memcpy(&BufferPtr[Offset], InfoPtr->Ekh_Km, sizeof(InfoPtr->Ekh_Km));
+		Offset += sizeof(InfoPtr->Ekh_Km);
+	}
+
+	XHdcp22Cmn_Sha256Hash(BufferPtr, Offset, &BufferPtr[Offset]);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function restores the pairing info list from an image created with
+* #XHdcp22Tx_SavePairingInfo. The current list is replaced. If the image
+* holds more entries than #XHDCP22_TX_MAX_STORED_PAIRINGINFO, only the most
+* recently used entries are restored.
+*
+* @param  InstancePtr is a pointer to the XHdcp22Tx core instance.
+* @param  BufferPtr is a pointer to the serialized pairing info.
+* @param  Size is the size of the serialized pairing info in bytes.
+*
+* @return
+*         - XST_SUCCESS if the pairing info was restored.
+*         - XST_FAILURE if the image is malformed or corrupted, in which
+*           case the current list is left untouched.
+*
+* @note   Call after #XHdcp22Tx_CfgInitialize, which clears the list.
+*
+******************************************************************************/
+int XHdcp22Tx_LoadPairingInfo(XHdcp22_Tx *InstancePtr, const u8 *BufferPtr,
+                              u32 Size)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	u8 Digest[XHDCP22_TX_SHA256_HASH_SIZE];
+	XHdcp22_Tx_PairingInfo NewPairingInfo;
+	u32 Magic;
+	u32 NumEntries;
+	u32 Offset;
+	u32 i;
+
+	if (Size < 8 + XHDCP22_TX_SHA256_HASH_SIZE) {
+		return XST_FAILURE;
+	}
+
+	Magic = ((u32)BufferPtr[0] << 24) | ((u32)BufferPtr[1] << 16) |
+	        ((u32)BufferPtr[2] << 8) | (u32)BufferPtr[3];
+	NumEntries = ((u32)BufferPtr[4] << 24) | ((u32)BufferPtr[5] << 16) |
+	             ((u32)BufferPtr[6] << 8) | (u32)BufferPtr[7];
+
+	if ((Magic != XHDCP22_TX_PAIRINGINFO_MAGIC) ||
+	    (NumEntries > (Size - 8 - XHDCP22_TX_SHA256_HASH_SIZE) /
+	                   XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE) ||
+	    (Size != 8 + (NumEntries * XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE) +
+	             XHDCP22_TX_SHA256_HASH_SIZE)) {
+		return XST_FAILURE;
+	}
+
+	Offset = Size - XHDCP22_TX_SHA256_HASH_SIZE;
+	XHdcp22Cmn_Sha256Hash(BufferPtr, Offset, Digest);
+	if (memcmp(Digest, &BufferPtr[Offset], sizeof(Digest)) != 0) {
+		return XST_FAILURE;
+	}
+
+	/* Rebuild the list without reporting each insertion */
+	memset(InstancePtr->Info.PairingInfo, 0x00,
+	       sizeof(InstancePtr->Info.PairingInfo));
+	memset(InstancePtr->Info.PairingInfoIndex, 0x00,
+	       sizeof(InstancePtr->Info.PairingInfoIndex));
+	memset(InstancePtr->Info.PairingInfoAge, 0x00,
+	       sizeof(InstancePtr->Info.PairingInfoAge));
+	InstancePtr->Info.PairingInfoClock = 0;
+
+	/* Skip the oldest entries that do not fit */
+	i = 0;
+	if (NumEntries > XHDCP22_TX_MAX_STORED_PAIRINGINFO) {
+		i = NumEntries - XHDCP22_TX_MAX_STORED_PAIRINGINFO;
+	}
+
+	for (Offset = 8 + (i * XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE); i < NumEntries; i++) {
+		memcpy(NewPairingInfo.ReceiverId, &BufferPtr[Offset], sizeof(NewPairingInfo.ReceiverId));
+		Offset += sizeof(NewPairingInfo.ReceiverId);
+		memcpy(NewPairingInfo.RxCaps, &BufferPtr[Offset], sizeof(NewPairingInfo.RxCaps));
+		Offset += sizeof(NewPairingInfo.RxCaps);
+		memcpy(NewPairingInfo.Rtx, &BufferPtr[Offset], sizeof(NewPairingInfo.Rtx));
+		Offset += sizeof(NewPairingInfo.Rtx);
+		memcpy(NewPairingInfo.Rrx, &BufferPtr[Offset], sizeof(NewPairingInfo.Rrx));
+		Offset += sizeof(NewPairingInfo.Rrx);
+		memcpy(NewPairingInfo.Km, &BufferPtr[Offset], sizeof(NewPairingInfo.Km));
+		Offset += sizeof(NewPairingInfo.Km);
+		memcpy(NewPairingInfo.Ekh_Km, &BufferPtr[Offset], sizeof(NewPairingInfo.Ekh_Km));
+		Offset += sizeof(NewPairingInfo.Ekh_Km);
+
+		XHdcp22Tx_StorePairingInfo(InstancePtr, &NewPairingInfo, TRUE);
+	}
+
+	memset(&NewPairingInfo, 0x00, sizeof(NewPairingInfo));
 
 	return XST_SUCCESS;
 }
+
+/*****************************************************************************/
+/**
+*
+* This function returns the pairing info lookup statistics.
+*
+* @param  InstancePtr is a pointer to the XHdcp22Tx core instance.
+*
+* @return A pointer to the pairing info statistics.
+*
+* @note   The statistics are cleared by #XHdcp22Tx_CfgInitialize only.
+*
+******************************************************************************/
+XHdcp22_Tx_PairingStats *XHdcp22Tx_GetPairingStats(XHdcp22_Tx *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return &InstancePtr->Info.PairingStats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function invokes the pairing info updated callback, if set.
+*
+* @param  InstancePtr is a pointer to the XHdcp22Tx core instance.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+static void XHdcp22Tx_PairingInfoUpdated(XHdcp22_Tx *InstancePtr)
+{
+	if (InstancePtr->IsPairingInfoUpdatedCallbackSet) {
+		InstancePtr->PairingInfoUpdatedCallback(
+			InstancePtr->PairingInfoUpdatedCallbackRef);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the home bucket of a receiver Id in the pairing info
+* hash index.
+*
+* @param  ReceiverId is a pointer to a 5-byte receiver Id.
+*
+* @return The bucket number.
+*
+* @note   None.
+*
+******************************************************************************/
+static u32 XHdcp22Tx_PairingInfoHash(const u8 *ReceiverId)
+{
+	u32 Hash = 2166136261U;
+	int i;
+
+	/* FNV-1a */
+	for (i = 0; i < XHDCP22_TX_CERT_RCVID_SIZE; i++) {
+		Hash = (Hash ^ ReceiverId[i]) * 16777619U;
+	}
+
+	return Hash % XHDCP22_TX_PAIRINGINFO_HASH_SIZE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up a receiver Id in the pairing info hash index.
+*
+* @param  ReceiverId is a pointer to a 5-byte receiver Id.
+*
+* @return The bucket holding the receiver Id or -1 if it is not stored.
+*
+* @note   None.
+*
+******************************************************************************/
+static int XHdcp22Tx_FindPairingInfo(XHdcp22_Tx *InstancePtr,
+                                     const u8 *ReceiverId)
+{
+	u32 Bucket = XHdcp22Tx_PairingInfoHash(ReceiverId);
+	u8 Slot;
+	int i;
+
+	/* Linear probing, the index is never full */
+	for (i = 0; i < XHDCP22_TX_PAIRINGINFO_HASH_SIZE; i++) {
+		Slot = InstancePtr->Info.PairingInfoIndex[Bucket];
+		if (Slot == 0) {
+			break;
+		}
+		if (memcmp(ReceiverId, InstancePtr->Info.PairingInfo[Slot - 1].ReceiverId,
+		           XHDCP22_TX_CERT_RCVID_SIZE) == 0) {
+			return Bucket;
+		}
+		Bucket = (Bucket + 1) % XHDCP22_TX_PAIRINGINFO_HASH_SIZE;
+	}
+
+	return -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes a bucket from the pairing info hash index and clears
+* the entry it refers to. Following buckets of the same probe sequence are
+* shifted back so that lookups never need tombstones.
+*
+* @param  Bucket is the bucket to remove.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+static void XHdcp22Tx_RemovePairingInfo(XHdcp22_Tx *InstancePtr, u32 Bucket)
+{
+	u8 *Index = InstancePtr->Info.PairingInfoIndex;
+	u8 Slot = Index[Bucket];
+	u32 Next = Bucket;
+	u32 Home;
+
+	memset(&InstancePtr->Info.PairingInfo[Slot - 1], 0x00,
+	       sizeof(XHdcp22_Tx_PairingInfo));
+	InstancePtr->Info.PairingInfoAge[Slot - 1] = 0;
+	Index[Bucket] = 0;
+
+	for (;;) {
+		Next = (Next + 1) % XHDCP22_TX_PAIRINGINFO_HASH_SIZE;
+		if (Index[Next] == 0) {
+			break;
+		}
+
+		/* Move the entry into the hole unless its home bucket lies
+		 * cyclically in (Bucket, Next] */
+		Home = XHdcp22Tx_PairingInfoHash(
+			InstancePtr->Info.PairingInfo[Index[Next] - 1].ReceiverId);
+		if ((Bucket <= Next) ? ((Bucket < Home) && (Home <= Next)) :
+		                       ((Bucket < Home) || (Home <= Next))) {
+			continue;
+		}
+
+		Index[Bucket] = Index[Next];
+		Index[Next] = 0;
+		Bucket = Next;
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -3843,81 +4349,153 @@ int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr)
 * @return A pointer to the found ReceiverId or NULL if the pairing info wasn't
 *         stored yet.
 *
-* @note   None.
+* @note   The lookup is counted in the pairing info statistics.
 *
 ******************************************************************************/
 static XHdcp22_Tx_PairingInfo *XHdcp22Tx_GetPairingInfo(XHdcp22_Tx *InstancePtr,
 	                                                     const u8 *ReceiverId)
 {
-	int i = 0;
 	u8 IllegalRecvID[] = {0x0, 0x0, 0x0, 0x0, 0x0};
 	XHdcp22_Tx_PairingInfo * PairingInfoPtr = NULL;
+	int Bucket;
+	u8 Slot;
+
+	InstancePtr->Info.PairingStats.Lookups++;
 
 	/* Check for illegal Receiver ID */
 	if (memcmp(ReceiverId, IllegalRecvID, XHDCP22_TX_CERT_RCVID_SIZE) == 0) {
+		InstancePtr->Info.PairingStats.Misses++;
 		return NULL;
 	}
 
-	for (i=0; i<XHDCP22_TX_MAX_STORED_PAIRINGINFO; i++) {
-		PairingInfoPtr = &InstancePtr->Info.PairingInfo[i];
-		if (memcmp(ReceiverId, PairingInfoPtr->ReceiverId,
-		           XHDCP22_TX_CERT_RCVID_SIZE) == 0) {
-			return PairingInfoPtr;
-		}
+	Bucket = XHdcp22Tx_FindPairingInfo(InstancePtr, ReceiverId);
+	if (Bucket < 0) {
+		InstancePtr->Info.PairingStats.Misses++;
+		return NULL;
+	}
+
+	Slot = InstancePtr->Info.PairingInfoIndex[Bucket] - 1;
+	PairingInfoPtr = &InstancePtr->Info.PairingInfo[Slot];
+
+	if (PairingInfoPtr->Ready == TRUE) {
+		InstancePtr->Info.PairingStats.Hits++;
+		InstancePtr->Info.PairingInfoAge[Slot] = ++InstancePtr->Info.PairingInfoClock;
+	} else {
+		InstancePtr->Info.PairingStats.Misses++;
 	}
-	return NULL;
+
+	return PairingInfoPtr;
 }
 
 /*****************************************************************************/
 /**
 *
-* This function updates a pairing info entry in the storage.
+* This function stores a pairing info entry. An existing entry for the same
+* receiver is overwritten, otherwise a free entry is taken. If the list is
+* full, an incomplete entry or else the least recently used entry is
+* replaced.
 *
 * @param  PairingInfo is a pointer to a pairing info structure.
+* @param  Ready indicates if the entry is complete.
 *
-* @return
-*         - XST_SUCCESS if there was enough room
-*         - XST_FAILURE if there was no room for this receiver
+* @return A pointer to the stored entry.
 *
 * @note   None.
 *
 ******************************************************************************/
-static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(
+static XHdcp22_Tx_PairingInfo *XHdcp22Tx_StorePairingInfo(
 	                          XHdcp22_Tx *InstancePtr,
                               const XHdcp22_Tx_PairingInfo *PairingInfo,
                               u8 Ready)
 {
 	int i = 0;
-	int i_match = 0;
-	u8 Match = (FALSE);
+	int i_match = -1;
+	int Bucket;
+	u32 Age = 0;
+	u8 Ready_match = FALSE;
 	XHdcp22_Tx_PairingInfo * PairingInfoPtr = NULL;
 
-	/* Find slot */
-	for (i=0; i<XHDCP22_TX_MAX_STORED_PAIRINGINFO; i++) {
+	Bucket = XHdcp22Tx_FindPairingInfo(InstancePtr, PairingInfo->ReceiverId);
 
-		PairingInfoPtr = &InstancePtr->Info.PairingInfo[i];
+	if (Bucket >= 0) {
+		i_match = InstancePtr->Info.PairingInfoIndex[Bucket] - 1;
+	} else {
+		/* Take an unused slot (age 0), otherwise replace an incomplete
+		 * entry or else the least recently used entry */
+		for (i=0; i<XHDCP22_TX_MAX_STORED_PAIRINGINFO; i++) {
+			PairingInfoPtr = &InstancePtr->Info.PairingInfo[i];
+			if (InstancePtr->Info.PairingInfoAge[i] == 0) {
+				i_match = i;
+				break;
+			}
+			if ((i_match < 0) ||
+			    (PairingInfoPtr->Ready < Ready_match) ||
+			    ((PairingInfoPtr->Ready == Ready_match) &&
+			     (InstancePtr->Info.PairingInfoAge[i] < Age))) {
+				i_match = i;
+				Ready_match = PairingInfoPtr->Ready;
+				Age = InstancePtr->Info.PairingInfoAge[i];
+			}
+		}
 
-		/* Look for empty slot */
-		if ((PairingInfoPtr->Ready == FALSE) && (Match == FALSE)) {
-			i_match = i;
-			Match = (TRUE);
+		/* Free the victim */
+		if (InstancePtr->Info.PairingInfoAge[i_match] != 0) {
+			PairingInfoPtr = &InstancePtr->Info.PairingInfo[i_match];
+			if (PairingInfoPtr->Ready == TRUE) {
+				InstancePtr->Info.PairingStats.Evictions++;
+			}
+			XHdcp22Tx_RemovePairingInfo(InstancePtr,
+				XHdcp22Tx_FindPairingInfo(InstancePtr, PairingInfoPtr->ReceiverId));
 		}
 
-		/* Look for match, match overrides empty slot */
-		if (memcmp(PairingInfo->ReceiverId, PairingInfoPtr->ReceiverId,
-		           XHDCP22_TX_CERT_RCVID_SIZE) == 0) {
-			i_match = i;
-			break;
+		/* Index the new receiver */
+		Bucket = XHdcp22Tx_PairingInfoHash(PairingInfo->ReceiverId);
+		while (InstancePtr->Info.PairingInfoIndex[Bucket] != 0) {
+			Bucket = (Bucket + 1) % XHDCP22_TX_PAIRINGINFO_HASH_SIZE;
 		}
+		InstancePtr->Info.PairingInfoIndex[Bucket] = i_match + 1;
 	}
 
 	PairingInfoPtr = &InstancePtr->Info.PairingInfo[i_match];
 
 	/* Copy pairing info*/
-	memcpy(PairingInfoPtr, PairingInfo, sizeof(XHdcp22_Tx_PairingInfo));
+	if (PairingInfoPtr != PairingInfo) {
+		memcpy(PairingInfoPtr, PairingInfo, sizeof(XHdcp22_Tx_PairingInfo));
+	}
 
 	/* Set table ready */
 	PairingInfoPtr->Ready = Ready;
+	InstancePtr->Info.PairingInfoAge[i_match] = ++InstancePtr->Info.PairingInfoClock;
+
+	return PairingInfoPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function updates a pairing info entry in the storage.
+*
+* @param  PairingInfo is a pointer to a pairing info structure.
+* @param  Ready indicates if the entry is complete.
+*
+* @return A pointer to the stored entry.
+*
+* @note   The pairing info updated callback is invoked when an entry
+*         becomes complete.
+*
+******************************************************************************/
+static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(
+	                          XHdcp22_Tx *InstancePtr,
+                              const XHdcp22_Tx_PairingInfo *PairingInfo,
+                              u8 Ready)
+{
+	XHdcp22_Tx_PairingInfo * PairingInfoPtr;
+
+	PairingInfoPtr = XHdcp22Tx_StorePairingInfo(InstancePtr, PairingInfo, Ready);
+
+	if (Ready == TRUE) {
+		XHdcp22Tx_PairingInfoUpdated(InstancePtr);
+	}
 
 	return PairingInfoPtr;
 }
@@ -3931,21 +4509,29 @@ static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(
 *
 * @return None.
 *
-* @note   None.
+* @note   The pairing info updated callback is invoked when a complete
+*         entry is removed.
 *
 ******************************************************************************/
 static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
 	                                        const u8* ReceiverId)
 {
-	XHdcp22_Tx_PairingInfo *InfoPtr = XHdcp22Tx_GetPairingInfo(InstancePtr,
-		                                                       ReceiverId);
+	int Bucket = XHdcp22Tx_FindPairingInfo(InstancePtr, ReceiverId);
+	u8 Ready;
 
 	/* do nothing if the id was not found */
-	if (InfoPtr == NULL) {
+	if (Bucket < 0) {
 		return;
 	}
+
 	/* clear the found structure */
-	memset(InfoPtr, 0x00, sizeof(XHdcp22_Tx_PairingInfo));
+	Ready = InstancePtr->Info.PairingInfo[
+		InstancePtr->Info.PairingInfoIndex[Bucket] - 1].Ready;
+	XHdcp22Tx_RemovePairingInfo(InstancePtr, Bucket);
+
+	if (Ready == TRUE) {
+		XHdcp22Tx_PairingInfoUpdated(InstancePtr);
+	}
 }
 
 /*****************************************************************************/
@@ -3958,7 +4544,11 @@ static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
 *
 * @return None.
 *
-* @note Supposed to be called by Upstream Content Control Function
+* @note Supposed to be called by Upstream Content Control Function.
+*       The receiver ID is added to the loaded revocation list, or starts a
+*       new list if none is valid. The list then no longer matches the
+*       loaded SRM: the next #XHdcp22Tx_LoadRevocationTable, also of the
+*       same SRM, rebuilds the list from the SRM and drops the added IDs.
 *
 ******************************************************************************/
 void XHdcp22Tx_RevokeReceiverId(XHdcp22_Tx *InstancePtr,
@@ -3966,22 +4556,34 @@ void XHdcp22Tx_RevokeReceiverId(XHdcp22_Tx *InstancePtr,
 {
 	XHdcp22_Tx_RevocationList* RevocationListPtr;
 	u32 NumDevices;
+	u32 Pos;
 
 	/* Verify arguments. */
-	Xil_AssertNonvoid(InstancePtr != NULL);
-	Xil_AssertNonvoid(ReceiverIdPtr != NULL);
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(ReceiverIdPtr != NULL);
+
+	if (InstancePtr->Config.Mode != XHDCP22_TX_TRANSMITTER)
+		return;
 
 	RevocationListPtr =
 			XHdcp22Tx_GetRevocationReceiverIdList(InstancePtr);
-	NumDevices = RevocationListPtr->NumDevices;
 
-	if (InstancePtr->Config.Mode != XHDCP22_TX_TRANSMITTER)
-		return;
+	/* An invalid list may be partly parsed and unsorted */
+	if (InstancePtr->Info.IsRevocationListValid == FALSE) {
+		RevocationListPtr->NumDevices = 0;
+	}
+	NumDevices = RevocationListPtr->NumDevices;
 
-	if (!XHdcp22Tx_IsDeviceRevoked(InstancePtr, ReceiverIdPtr)) {
-		memcpy(RevocationListPtr->ReceiverId[NumDevices],
+	/* Insert in sorted order, if there is room */
+	if (!XHdcp22Tx_FindRevokedId(RevocationListPtr, ReceiverIdPtr, &Pos) &&
+	    (NumDevices < XHDCP22_TX_REVOCATION_LIST_MAX_DEVICES)) {
+		memmove(RevocationListPtr->ReceiverId[Pos + 1],
+				RevocationListPtr->ReceiverId[Pos],
+				(NumDevices - Pos) * XHDCP22_TX_SRM_RCVID_SIZE);
+		memcpy(RevocationListPtr->ReceiverId[Pos],
 				ReceiverIdPtr, XHDCP22_TX_SRM_RCVID_SIZE);
 		RevocationListPtr->NumDevices++;
+		RevocationListPtr->IsSrmLoaded = (FALSE);
 		InstancePtr->Info.IsRevocationListValid = TRUE;
 	}
 
@@ -4537,6 +5139,10 @@ void XHdcp22Tx_Info(XHdcp22_Tx *InstancePtr)
 
 	xil_printf("Auth Requests: %d\r\n", InstancePtr->Info.AuthRequestCnt);
 	xil_printf("Reauth Requests: %d\r\n", InstancePtr->Info.ReauthRequestCnt);
+	xil_printf("Pairing Lookups: %d, Hits: %d, Evictions: %d\r\n",
+		InstancePtr->Info.PairingStats.Lookups,
+		InstancePtr->Info.PairingStats.Hits,
+		InstancePtr->Info.PairingStats.Evictions);
 	xil_printf("Polling Interval: %d ms\r\n", InstancePtr->Info.PollingValue);
 }
 
@@ -60,6 +60,13 @@
 * 2.01  MH     02/28/17 Fixed compiler warnings.
 * 2.20  MH     04/12/17 Added function XHdcp22Tx_IsDwnstrmCapable.
 * 2.30  MH     07/06/17 Changed default polling value to 10 ms.
+* 3.0   ag     10/19/26 Added hashed LRU pairing info cache, pairing info
+*                       statistics and a serialized pairing info store.
+*                       Revocation list is kept sorted and the verified SRM
+*                       is cached by version and digest.
+*                       Added the HMAC-SHA256 key states of the session.
+*                       The maximum of stored pairing info items is checked
+*                       at compile time.
 * </pre>
 *
 ******************************************************************************/
@@ -82,6 +89,7 @@ extern "C" {
 #include "xtmrctr.h"
 #include "xhdcp22_cipher.h"
 #include "xhdcp22_rng.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -104,9 +112,37 @@ extern "C" {
 #define XHDCP22_TX_REVOCATION_LIST_MAX_DEVICES 944
 
 /**
-* The list of maximum pairing info items to store.
+* The list of maximum pairing info items to store. When the list is full the
+* least recently used entry is replaced. Must be less than 255.
 */
-#define XHDCP22_TX_MAX_STORED_PAIRINGINFO  2
+#ifndef XHDCP22_TX_MAX_STORED_PAIRINGINFO
+#define XHDCP22_TX_MAX_STORED_PAIRINGINFO  16
+#endif
+
+/* The hash index holds entry index + 1 in a u8 */
+#if (XHDCP22_TX_MAX_STORED_PAIRINGINFO < 1) || \
+    (XHDCP22_TX_MAX_STORED_PAIRINGINFO >= 255)
+#error "XHDCP22_TX_MAX_STORED_PAIRINGINFO must be from 1 to 254"
+#endif
+
+/**
+* Number of buckets in the receiver ID hash index of the pairing info list.
+* Kept at twice the number of entries so that probe sequences stay short.
+*/
+#define XHDCP22_TX_PAIRINGINFO_HASH_SIZE (2 * XHDCP22_TX_MAX_STORED_PAIRINGINFO)
+
+/**
+* Size in bytes of one serialized pairing info entry:
+* ReceiverId || RxCaps || Rtx || Rrx || Km || Ekh(Km).
+*/
+#define XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE  56
+
+/**
+* Maximum size in bytes of the image written by #XHdcp22Tx_SavePairingInfo:
+* 4-byte magic, 4-byte entry count, the entries and a SHA256 digest.
+*/
+#define XHDCP22_TX_PAIRINGINFO_STORE_SIZE  (8 + \
+	(XHDCP22_TX_MAX_STORED_PAIRINGINFO * XHDCP22_TX_PAIRINGINFO_ENTRY_SIZE) + 32)
 
 /**
 * The size of the log buffer.
@@ -126,6 +162,7 @@ typedef enum
 	XHDCP22_TX_HANDLER_AUTHENTICATED,
 	XHDCP22_TX_HANDLER_UNAUTHENTICATED,
 	XHDCP22_TX_HANDLER_DOWNSTREAM_TOPOLOGY_AVAILABLE,
+	XHDCP22_TX_HANDLER_PAIRING_INFO_UPDATED,
 	XHDCP22_TX_HANDLER_INVALID
 } XHdcp22_Tx_HandlerType;
 
@@ -294,6 +331,28 @@ typedef struct {
 	u8 Ekh_Km[16];       /**< Ekh(Km). */
      u8 Ready;            /**< Indicates a valid entry */
 } XHdcp22_Tx_PairingInfo;
+
+/**
+* This typedef contains the pairing info lookup statistics. The hit rate
+* of the stored Km path is Hits / Lookups.
+*/
+typedef struct {
+	u32 Lookups;         /**< Receiver lookups at AKE_Send_Cert. */
+	u32 Hits;            /**< Lookups that found stored Km. */
+	u32 Misses;          /**< Lookups that fell back to no stored Km. */
+	u32 Evictions;       /**< Valid entries replaced to make room. */
+} XHdcp22_Tx_PairingStats;
+
+/**
+* This typedef contains the HMAC-SHA256 key states derived from Kd. They are
+* computed once per session, when H' is verified, and used for L', V and M.
+*/
+typedef struct {
+	XHdcp22Cmn_HmacSha256Key Kd;       /**< Key Kd, for H' and V. */
+	XHdcp22Cmn_HmacSha256Key KdRrx;    /**< Key Kd XOR Rrx, for L'. */
+	XHdcp22Cmn_HmacSha256Key Sha256Kd; /**< Key SHA256(Kd), for M. */
+} XHdcp22_Tx_SessionKeys;
+
 /**
 * This typedef contains information about the HDCP22 transmitter.
 */
@@ -309,9 +368,18 @@ typedef struct
 	u8 Rn[8];                           /**< Internal used Rn. */
 	void *StateContext;                 /**< Context used internally by the state machine. */
 	u16  LocalityCheckCounter;          /**< Locality may attempt 1024 times. */
+	XHdcp22_Tx_SessionKeys SessionKeys; /**< Key states of the session. */
 	u8 MsgAvailable;                    /**< Message is available for reading. */
 
 	XHdcp22_Tx_PairingInfo PairingInfo[XHDCP22_TX_MAX_STORED_PAIRINGINFO];
+	/** Receiver ID hash index into PairingInfo, holds entry index + 1 or 0 if empty. */
+	u8 PairingInfoIndex[XHDCP22_TX_PAIRINGINFO_HASH_SIZE];
+	/** Last use time stamp of each PairingInfo entry for LRU replacement. */
+	u32 PairingInfoAge[XHDCP22_TX_MAX_STORED_PAIRINGINFO];
+	/** Time stamp counter for PairingInfoAge. */
+	u32 PairingInfoClock;
+	/** Pairing info lookup statistics. */
+	XHdcp22_Tx_PairingStats PairingStats;
 	/** The result after a call to #XHdcp22Tx_Poll. */
 	XHdcp22_Tx_AuthenticationType AuthenticationStatus;
 
@@ -405,12 +473,16 @@ typedef struct {
 } XHdcp22_Tx_Test;
 
 /**
-* This structure contains the HDCP2 Revocation information.
+* This structure contains the HDCP2 Revocation information. The receiver IDs
+* are kept in ascending order so that they can be binary searched.
 */
 typedef struct
 {
 	u32 NumDevices;
 	u8  ReceiverId[XHDCP22_TX_REVOCATION_LIST_MAX_DEVICES][5];
+	u8  IsSrmLoaded;     /**< Set once an SRM has been verified and parsed. */
+	u16 SrmVersion;      /**< Version of the loaded SRM. */
+	u8  SrmDigest[32];   /**< SHA256 of the loaded SRM. */
 } XHdcp22_Tx_RevocationList;
 
 /**
@@ -518,6 +590,12 @@ typedef struct
 	u8 IsDownstreamTopologyAvailableCallbackSet;
 	void *DownstreamTopologyAvailableCallbackRef;
 
+	/** Function pointer called after the stored pairing info has changed */
+	XHdcp22_Tx_Callback PairingInfoUpdatedCallback;
+	/** Set if PairingInfoUpdatedCallback handler is defined. */
+	u8 IsPairingInfoUpdatedCallbackSet;
+	void *PairingInfoUpdatedCallbackRef;
+
 	/** Internal used timer. */
 	XHdcp22_Tx_Timer Timer;
 
@@ -562,6 +640,11 @@ int XHdcp22Tx_CfgInitialize(XHdcp22_Tx *InstancePtr, XHdcp22_Tx_Config *CfgPtr,
                             UINTPTR EffectiveAddr);
 int XHdcp22Tx_Reset(XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr);
+int XHdcp22Tx_SavePairingInfo(XHdcp22_Tx *InstancePtr, u8 *BufferPtr,
+                              u32 BufferSize, u32 *SizePtr);
+int XHdcp22Tx_LoadPairingInfo(XHdcp22_Tx *InstancePtr, const u8 *BufferPtr,
+                              u32 Size);
+XHdcp22_Tx_PairingStats *XHdcp22Tx_GetPairingStats(XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_Authenticate (XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_Poll(XHdcp22_Tx *InstancePtr);
 int XHdcp22Tx_Enable (XHdcp22_Tx *InstancePtr);
@@ -793,7 +793,7 @@ void XHdcp22Tx_TestSetMode(XHdcp22_Tx *InstancePtr, XHdcp22_Tx_TestMode Mode,
 	}
 
 	if ((TestFlags & XHDCP22_TX_TEST_CLR_PAIRINGINFO) == XHDCP22_TX_TEST_CLR_PAIRINGINFO) {
-			memset(InstancePtr->Info.PairingInfo, 0, sizeof(InstancePtr->Info.PairingInfo));
+			XHdcp22Tx_ClearPairingInfo(InstancePtr);
 	}
 
 	/* Handle test scenarios */
@@ -23,6 +23,8 @@
 * 3.00  jb     12/24/21 File name changed from xhdcp22_tx.c to xhdcp22_tx_dp.c
 *                       Also all APIs and structure names are added with
 *                       suffix _dp.
+*       ag     10/19/26 The HMAC key states of Kd are computed once per
+*                       session, at the verification of H'.
 * </pre>
 *
 ******************************************************************************/
@@ -986,6 +988,10 @@ int XHdcp22Tx_Dp_Reset(XHdcp22_Tx_Dp *InstancePtr)
 	/* Clear Topology Available flag */
 	InstancePtr->Info.IsTopologyAvailable = (FALSE);
 
+	/* Clear the key states of the session */
+	memset(&InstancePtr->Info.SessionKeys, 0x00,
+	       sizeof(InstancePtr->Info.SessionKeys));
+
 	/* Disable encryption */
 	XHdcp22Tx_Dp_DisableEncryption(InstancePtr);
 
@@ -1824,9 +1830,12 @@ static XHdcp22_Tx_Dp_StateType Xhdcp22Tx_StateA1_Nsk0(XHdcp22_Tx_Dp *InstancePtr
 	/* Verify the received H' */
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
                   XHDCP22_TX_LOG_DBG_COMPUTE_H);
-	XHdcp22Tx_ComputeHPrime(PairingInfoPtr->Rrx, PairingInfoPtr->RxCaps,
-	                        PairingInfoPtr->Rtx, XHdcp22_Tx_TxCaps,
-	                        PairingInfoPtr->Km, HPrime);
+	XHdcp22Tx_ComputeSessionKeys(PairingInfoPtr->Km, PairingInfoPtr->Rrx,
+	                             PairingInfoPtr->Rtx,
+	                             &InstancePtr->Info.SessionKeys);
+	XHdcp22Tx_ComputeHPrime(&InstancePtr->Info.SessionKeys,
+	                        PairingInfoPtr->Rtx, PairingInfoPtr->RxCaps,
+	                        XHdcp22_Tx_TxCaps, HPrime);
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	                XHDCP22_TX_LOG_DBG_COMPUTE_H_DONE);
 
@@ -1964,9 +1973,12 @@ static XHdcp22_Tx_Dp_StateType Xhdcp22Tx_StateA1_Sk0(XHdcp22_Tx_Dp *InstancePtr)
 	/* Verify the received H' */
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 								 XHDCP22_TX_LOG_DBG_COMPUTE_H);
-	XHdcp22Tx_ComputeHPrime(InstancePtr->Info.Rrx, PairingInfoPtr->RxCaps,
-							InstancePtr->Info.Rtx, XHdcp22_Tx_TxCaps,
-							PairingInfoPtr->Km, HPrime);
+	XHdcp22Tx_ComputeSessionKeys(PairingInfoPtr->Km, InstancePtr->Info.Rrx,
+	                             InstancePtr->Info.Rtx,
+	                             &InstancePtr->Info.SessionKeys);
+	XHdcp22Tx_ComputeHPrime(&InstancePtr->Info.SessionKeys,
+							InstancePtr->Info.Rtx, PairingInfoPtr->RxCaps,
+							XHdcp22_Tx_TxCaps, HPrime);
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 								 XHDCP22_TX_LOG_DBG_COMPUTE_H_DONE);
 
@@ -2057,8 +2069,6 @@ static XHdcp22_Tx_Dp_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx_Dp *InstancePtr)
 	int Result = XST_SUCCESS;
 	u8 LPrime[XHDCP22_TX_H_PRIME_SIZE];
 
-	XHdcp22_Tx_Dp_PairingInfo *PairingInfoPtr =
-	                       (XHdcp22_Tx_Dp_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 	                      (XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 
@@ -2096,9 +2106,8 @@ static XHdcp22_Tx_Dp_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx_Dp *InstancePtr)
 	/* Verify the received L' */
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	XHDCP22_TX_LOG_DBG_COMPUTE_L);
-	XHdcp22Tx_ComputeLPrime(InstancePtr->Info.Rn, PairingInfoPtr->Km,
-	                        InstancePtr->Info.Rrx, InstancePtr->Info.Rtx,
-	                        LPrime);
+	XHdcp22Tx_ComputeLPrime(&InstancePtr->Info.SessionKeys,
+	                        InstancePtr->Info.Rn, LPrime);
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 		XHDCP22_TX_LOG_DBG_COMPUTE_L_DONE);
 
@@ -2367,8 +2376,6 @@ static XHdcp22_Tx_Dp_StateType XHdcp22Tx_StateA6_A7_A8(XHdcp22_Tx_Dp *InstancePt
 	 * so clear the topology available flag */
 	InstancePtr->Info.IsTopologyAvailable = (FALSE);
 
-	XHdcp22_Tx_Dp_PairingInfo *PairingInfoPtr =
-		(XHdcp22_Tx_Dp_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 		(XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 	/* Wait for the receiver to respond within 3 secs.
@@ -2430,13 +2437,11 @@ static XHdcp22_Tx_Dp_StateType XHdcp22Tx_StateA6_A7_A8(XHdcp22_Tx_Dp *InstancePt
 
 	/* Verify the received VPrime */
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_V);
-	XHdcp22Tx_ComputeV(InstancePtr->Info.Rn, InstancePtr->Info.Rrx,
+	XHdcp22Tx_ComputeV(&InstancePtr->Info.SessionKeys,
 		MsgPtr->Message.RepeatAuthSendRecvIDList.RxInfo,
-		InstancePtr->Info.Rtx,
 		(u8 *)MsgPtr->Message.RepeatAuthSendRecvIDList.ReceiverIDs,
 		DeviceCount,
 		MsgPtr->Message.RepeatAuthSendRecvIDList.SeqNum_V,
-		PairingInfoPtr->Km,
 		V);
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_V_DONE);
 
@@ -3459,6 +3464,10 @@ static int XHdcp22Tx_WriteAKEInit(XHdcp22_Tx_Dp *InstancePtr)
 	MsgPtr->DdcAddress = XHDCP22_TX_HDCPPORT_WRITE_MSG_OFFSET;
 	MsgPtr->Message.MsgId = XHDCP22_TX_AKE_INIT;
 
+	/* A new session starts, clear the key states of the last one */
+	memset(&InstancePtr->Info.SessionKeys, 0x00,
+	       sizeof(InstancePtr->Info.SessionKeys));
+
 	/* Generate Rtx and add to the buffer*/
 	XHdcp22Tx_GenerateRtx(InstancePtr, InstancePtr->Info.Rtx);
 
@@ -3744,8 +3753,6 @@ static int XHdcp22Tx_WriteRepeaterAuth_Send_Ack(XHdcp22_Tx_Dp *InstancePtr, cons
 ******************************************************************************/
 static int XHdcp22Tx_WriteRepeaterAuth_Stream_Manage(XHdcp22_Tx_Dp *InstancePtr)
 {
-	XHdcp22_Tx_Dp_PairingInfo *PairingInfoPtr =
-		(XHdcp22_Tx_Dp_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage* MsgPtr =
 		(XHdcp22_Tx_DDCMessage*)InstancePtr->MessageBuffer;
 
@@ -3770,13 +3777,10 @@ static int XHdcp22Tx_WriteRepeaterAuth_Stream_Manage(XHdcp22_Tx_Dp *InstancePtr)
 	/* To make verifying the MPrime from the repeater easier,
 	 * the M is calculated and stored before executing the write */
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_M);
-	XHdcp22Tx_ComputeM(InstancePtr->Info.Rn,
-		InstancePtr->Info.Rrx,
-		InstancePtr->Info.Rtx,
+	XHdcp22Tx_ComputeM(&InstancePtr->Info.SessionKeys,
 		MsgPtr->Message.RepeatAuthStreamManage.StreamID_Type,
 		MsgPtr->Message.RepeatAuthStreamManage.K,
 		MsgPtr->Message.RepeatAuthStreamManage.SeqNum_M,
-		PairingInfoPtr->Km,
 		InstancePtr->Info.M);
 	XHdcp22Tx_Dp_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_M_DONE);
 
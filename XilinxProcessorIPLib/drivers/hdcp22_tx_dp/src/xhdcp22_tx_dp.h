@@ -58,6 +58,7 @@
 * 3.00  jb     12/24/21 File name changed from xhdcp22_tx.h to xhdcp22_tx_dp.h
 *                       Also all APIs and structure names are added with
 *                       suffix _dp.
+*       ag     10/19/26 Added the HMAC-SHA256 key states of the session.
 * </pre>
 *
 ******************************************************************************/
@@ -80,6 +81,7 @@ extern "C" {
 #include "xtmrctr.h"
 #include "xhdcp22_cipher_dp.h"
 #include "xhdcp22_rng.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -351,6 +353,17 @@ typedef struct {
 	u8 Ekh_Km[16];       /**< Ekh(Km). */
      u8 Ready;            /**< Indicates a valid entry */
 } XHdcp22_Tx_Dp_PairingInfo;
+
+/**
+* This typedef contains the HMAC-SHA256 key states derived from Kd. They are
+* computed once per session, when H' is verified, and used for L', V and M.
+*/
+typedef struct {
+	XHdcp22Cmn_HmacSha256Key Kd;       /**< Key Kd, for H' and V. */
+	XHdcp22Cmn_HmacSha256Key KdRrx;    /**< Key Kd XOR Rrx, for L'. */
+	XHdcp22Cmn_HmacSha256Key Sha256Kd; /**< Key SHA256(Kd), for M. */
+} XHdcp22_Tx_Dp_SessionKeys;
+
 /**
 * This typedef contains information about the HDCP22 transmitter.
 */
@@ -366,6 +379,7 @@ typedef struct
 	u8 Rn[8];                           /**< Internal used Rn. */
 	void *StateContext;                 /**< Context used internally by the state machine. */
 	u16  LocalityCheckCounter;          /**< Locality may attempt 1024 times. */
+	XHdcp22_Tx_Dp_SessionKeys SessionKeys; /**< Key states of the session. */
 	u8 MsgAvailable;                    /**< Message is available for reading. */
 
 	XHdcp22_Tx_Dp_PairingInfo PairingInfo[XHDCP22_TX_MAX_STORED_PAIRINGINFO];
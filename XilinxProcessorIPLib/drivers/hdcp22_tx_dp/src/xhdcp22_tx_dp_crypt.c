@@ -21,6 +21,11 @@
 * 1.00  jb     02/21/19 Initial release
 * 3.00  jb     12/24/21 File name changed from xhdcp22_tx_crypt.c to
 *                       xhdcp22_tx_dp_crypt.c
+*       ag     10/19/26 Compute dkey0 || dkey1 with one AES key schedule.
+*                       Derive Kd in one function for H, L, V and M.
+*                       Compute the HMAC key states of Kd once per session
+*                       and stream H, V and M through the HMAC-SHA256
+*                       context instead of concatenating into a local buffer.
 * </pre>
 *
 ******************************************************************************/
@@ -57,6 +62,8 @@ static int XHdcp22Tx_RsaSignatureVerify(const u8 *MessagePtr, int MessageSize,
                                         const u8 *SignaturePtr,
                                         const u8 *KpubDcpNPtr, int KpubDcpNSize,
                                         const u8 *KpubDcpEPtr, int KpubDcpESize);
+static void XHdcp22Tx_ComputeKd(const u8 *Km, const u8 *Rrx, const u8 *Rtx,
+                                u8 *Kd);
 
 /************************** Variable Definitions *****************************/
 
@@ -512,76 +519,136 @@ int XHdcp22Tx_VerifySRM(const u8* SrmPtr, int SrmSize,
 /*****************************************************************************/
 /**
 *
-* This function computes HPrime
+* This function computes Kd = dkey0 || dkey1, the derived key of the session
+* key states. Both keys are encrypted with a single AES key schedule.
 *
-* @param  Rrx is the Rx random generated value on start of authentication.
-* @param  RxCaps are the capabilities of the receiver.
-* @param  Rtx is the Tx random generated value start of authentication.
-* @param  TxCaps are the capabilities of the receiver.
 * @param  Km is the master key generated by tx.
-* @param  HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+* @param  Rrx is the random value generated by rx.
+* @param  Rtx is the random value generated by tx.
+* @param  Kd is the 32 byte derived key output.
 *
 * @return None.
 *
-* @note   None.
+* @note   The AES key is Km XOR Rn, with Rn = 0 during AKE. The protocol
+*         says the incoming Rn should be XORed with Km, but then the output
+*         does not match the errata output, so Rn = 0 is used for all the
+*         hashes, which matches the test vectors.
 *
 ******************************************************************************/
-void XHdcp22Tx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps,
-                             const u8* Rtx, const u8 *TxCaps,
-                             const u8 *Km, u8 *HPrime)
+static void XHdcp22Tx_ComputeKd(const u8 *Km, const u8 *Rrx, const u8 *Rtx,
+                                u8 *Kd)
+{
+	u8 Aes_Iv[2 * XHDCP22_TX_AES128_SIZE]; /* m || m XOR Ctr1. */
+
+	/* Determine dkey0. */
+	/* Add m = Rtx || Rrx. */
+	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
+	/* Normally we should do Rrx XOR with Ctr0, but Ctr0 is 0. */
+	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
+
+	/* Determine dkey1, counter is 1: Rrx | 0x01. */
+	memcpy(&Aes_Iv[XHDCP22_TX_AES128_SIZE], Aes_Iv, XHDCP22_TX_AES128_SIZE);
+	Aes_Iv[XHDCP22_TX_AES128_SIZE + 15] ^= 0x01; /* big endian! */
+
+	XHdcp22Cmn_Aes128EncryptBlocks(Aes_Iv, 2, Km, Kd);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the HMAC-SHA256 key states of a session. The key
+* schedule of each HMAC key, the two hashes of the padded key blocks, is
+* computed once here instead of for every H', L', V and M.
+*
+* @param  Km is the master key generated by tx.
+* @param  Rrx is the random value generated by rx.
+* @param  Rtx is the random value generated by tx.
+* @param  KeysPtr is a pointer to the key states output.
+*
+* @return None.
+*
+* @note   The key states must be computed again when Km, Rrx or Rtx
+*         changes, that is for every AKE.
+*
+******************************************************************************/
+void XHdcp22Tx_ComputeSessionKeys(const u8 *Km, const u8 *Rrx, const u8 *Rtx,
+                                  XHdcp22_Tx_Dp_SessionKeys *KeysPtr)
 {
 	/* Verify arguments */
+	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(RxCaps != NULL);
 	Xil_AssertVoid(Rtx != NULL);
-	Xil_AssertVoid(TxCaps != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(HPrime != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
 	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
+	u8 HashKey[XHDCP22_TX_SHA256_HASH_SIZE];
 
-	u8 HashInput[XHDCP22_TX_RTX_SIZE + XHDCP22_TX_RXCAPS_SIZE +
-               XHDCP22_TX_TXCAPS_SIZE];
-	int Idx = 0;
+	/* Kd = dkey0 || dkey1. */
+	XHdcp22Tx_ComputeKd(Km, Rrx, Rtx, Kd);
 
-	/* Normally we should do: Key XOR with Rn, but Rn is 0. */
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
+	/* Key of H' and V: Kd. */
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->Kd, Kd, sizeof(Kd));
 
-	/* Determine dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Normally we should do Rrx XOR with Ctr0, but Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
+	/* Key of L': Kd XOR Rrx (least sign. 64 bits). */
+	memset(HashKey, 0x00, XHDCP22_TX_SHA256_HASH_SIZE);
+	memcpy(&HashKey[XHDCP22_TX_SHA256_HASH_SIZE-XHDCP22_TX_RRX_SIZE], Rrx,
+	       XHDCP22_TX_RRX_SIZE);
+	XHdcp22Tx_MemXor(HashKey, HashKey, Kd, XHDCP22_TX_SHA256_HASH_SIZE);
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->KdRrx, HashKey, sizeof(HashKey));
 
+	/* Key of M: SHA256(Kd). */
+	XHdcp22Cmn_Sha256Hash(Kd, sizeof(Kd), HashKey);
+	XHdcp22Cmn_HmacSha256SetKey(&KeysPtr->Sha256Kd, HashKey, sizeof(HashKey));
 
-	/* Determine dkey1, counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
+	memset(Kd, 0, sizeof(Kd));
+	memset(HashKey, 0, sizeof(HashKey));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes HPrime
+*
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Tx_ComputeSessionKeys.
+* @param  Rtx is the Tx random generated value start of authentication.
+* @param  RxCaps are the capabilities of the receiver.
+* @param  TxCaps are the capabilities of the receiver.
+* @param  HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+void XHdcp22Tx_ComputeHPrime(const XHdcp22_Tx_Dp_SessionKeys *KeysPtr,
+                             const u8 *Rtx, const u8 *RxCaps,
+                             const u8 *TxCaps, u8 *HPrime)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(KeysPtr != NULL);
+	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(RxCaps != NULL);
+	Xil_AssertVoid(TxCaps != NULL);
+	Xil_AssertVoid(HPrime != NULL);
 
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Create hash with HMAC-SHA256. */
-	/* Input: Rtx || RxCaps || TxCaps. */
-	memcpy(HashInput, Rtx, XHDCP22_TX_RTX_SIZE);
-	Idx += XHDCP22_TX_RTX_SIZE;
-	memcpy(&HashInput[Idx], RxCaps, XHDCP22_TX_RXCAPS_SIZE);
-	Idx += XHDCP22_TX_RXCAPS_SIZE;
-	memcpy(&HashInput[Idx], TxCaps, XHDCP22_TX_TXCAPS_SIZE);
-
 	/* HashKey:	Kd*/
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), Kd,
-                           sizeof(Kd), HPrime);
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Kd);
+
+	/* Input: Rtx || RxCaps || TxCaps. */
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, Rtx, XHDCP22_TX_RTX_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RxCaps, XHDCP22_TX_RXCAPS_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, TxCaps, XHDCP22_TX_TXCAPS_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, HPrime);
 }
 
 /*****************************************************************************/
 /**
 *
-* This function computes EdkeyKs. Kd is calculated as in
-* #XHdcp22Tx_ComputeHPrime, but could also be stored the first time.
-* This could save some computing time.
-* According protocol however, only Rrx and Rtx are supposed to be stored.
+* This function computes EdkeyKs.
 *
 * @param  Rn is a pseudo-random nonce.
 * @param  Km is the master key generated by tx..
@@ -640,66 +707,33 @@ void XHdcp22Tx_ComputeEdkeyKs(const u8* Rn, const u8* Km,
 /*****************************************************************************/
 /**
 *
-* This function computes LPrime. Kd is calculated as in
-* #XHdcp22Tx_ComputeHPrime, but could also be stored the first time.
-* This could save some computing time.
-* According protocol however, only Rrx and Rtx are supposed to be stored.
+* This function computes LPrime.
 *
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Tx_ComputeSessionKeys.
 * @param  Rn is a pseudo-random nonce.
-* @param  Km is the master key generated by tx and previouslyd stored.
-* @param  Rrx is the random value generated by rx.
-* @param  Rtx is the random value generated by tx.
 * @param  LPrime is a pointer to the computed LPrime hash.
 *
 * @return None.
 *
 * @note   None.
 ******************************************************************************/
-void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
-                             const u8 *Rrx, const u8 *Rtx,
-                             u8 *LPrime)
+void XHdcp22Tx_ComputeLPrime(const XHdcp22_Tx_Dp_SessionKeys *KeysPtr,
+                             const u8 *Rn, u8 *LPrime)
 {
 	/* Verify arguments */
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
 	Xil_AssertVoid(LPrime != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
-	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
-	u8 HashKey[XHDCP22_TX_SHA256_HASH_SIZE];
-
-	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
-	 * Note: Protocol says we should use incoming Rn and XOR it with Km,
-	 * but then the output does not match the errata output.
-	 * For now we use for Rn 0, which matches the test vectors.
-	 */
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
-
-	/* Compute Dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Rrx XOR Ctr0, where Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
-
-
-	/* Compute Dkey0 , counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
-
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Create hash with HMAC-SHA256. */
 	/* Input: Rn. */
 	/* Key:	Kd XOR Rrx (least sign. 64 bits). */
-	memset(HashKey, 0x00, XHDCP22_TX_SHA256_HASH_SIZE);
-	memcpy(&HashKey[XHDCP22_TX_SHA256_HASH_SIZE-XHDCP22_TX_RRX_SIZE], Rrx,
-         XHDCP22_TX_RRX_SIZE);
-	XHdcp22Tx_MemXor(HashKey, HashKey, Kd, XHDCP22_TX_SHA256_HASH_SIZE);
-	XHdcp22Cmn_HmacSha256Hash(Rn, XHDCP22_TX_RN_SIZE, HashKey,
-                           XHDCP22_TX_SHA256_HASH_SIZE, LPrime);
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->KdRrx);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, Rn, XHDCP22_TX_RN_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, LPrime);
 }
 
 /*****************************************************************************/
@@ -707,7 +741,12 @@ void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
 *
 * This function computes V
 *
-* @param
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Tx_ComputeSessionKeys.
+* @param  RxInfo is the RxInfo of the repeater.
+* @param  RecvIDList is the list of receiver IDs.
+* @param  RecvIDCount is the number of receiver IDs in RecvIDList.
+* @param  SeqNum_V is the sequence number V.
 * @param  V is a pointer to the computed V hash.
 *
 * @return None.
@@ -715,53 +754,28 @@ void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
 * @note   None.
 *
 ******************************************************************************/
-void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
-	const u8* Rtx, const u8* RecvIDList, const u8 RecvIDCount,
-	const u8* SeqNum_V, const u8* Km, u8* V)
+void XHdcp22Tx_ComputeV(const XHdcp22_Tx_Dp_SessionKeys *KeysPtr,
+                        const u8* RxInfo, const u8* RecvIDList,
+                        const u8 RecvIDCount, const u8* SeqNum_V, u8* V)
 {
 	/* Verify arguments */
-	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Rrx != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
 	Xil_AssertVoid(RxInfo != NULL);
-	Xil_AssertVoid(Km != NULL);
+	Xil_AssertVoid(SeqNum_V != NULL);
 	Xil_AssertVoid(V != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
-	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
-
-	u8 HashInput[(XHDCP22_TX_REPEATER_MAX_DEVICE_COUNT * XHDCP22_TX_RCVID_SIZE) +
-		XHDCP22_TX_RXINFO_SIZE + XHDCP22_TX_SEQ_NUM_V_SIZE];
-	int Idx = 0;
-
-	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
-	* Note: Protocol says we should use incoming Rn and XOR it with Km,
-	* but then the output does not match the errata output.
-	* For now we use for Rn 0, which matches the test vectors.
-	*/
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
-
-	/* Determine dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Normally we should do Rrx XOR with Ctr0, but Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
-
-	/* Determine dkey1, counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	/* Create hash with HMAC-SHA256. */
-	/* Input: ReceiverID list || RxInfo || seq_num_V. */
-	memcpy(HashInput, RecvIDList, (RecvIDCount*XHDCP22_TX_RCVID_SIZE));
-	Idx += (RecvIDCount*XHDCP22_TX_RCVID_SIZE);
-	memcpy(&HashInput[Idx], RxInfo, XHDCP22_TX_RXINFO_SIZE);
-	Idx += XHDCP22_TX_RXINFO_SIZE;
-	memcpy(&HashInput[Idx], SeqNum_V, XHDCP22_TX_SEQ_NUM_V_SIZE);
-	Idx += XHDCP22_TX_SEQ_NUM_V_SIZE;
 	/* HashKey:	Kd*/
-	XHdcp22Cmn_HmacSha256Hash(HashInput, Idx, Kd, sizeof(Kd), V);
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Kd);
+
+	/* Input: ReceiverID list || RxInfo || seq_num_V. */
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RecvIDList,
+		(RecvIDCount*XHDCP22_TX_RCVID_SIZE));
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, RxInfo, XHDCP22_TX_RXINFO_SIZE);
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, SeqNum_V, XHDCP22_TX_SEQ_NUM_V_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, V);
 }
 
 /*****************************************************************************/
@@ -769,7 +783,11 @@ void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
 *
 * This function computes M
 *
-* @param
+* @param  KeysPtr is a pointer to the key states of the session, see
+*         #XHdcp22Tx_ComputeSessionKeys.
+* @param  StreamIDType is the list of STREAM_ID || Type.
+* @param  k is the number of streams, big endian.
+* @param  SeqNum_M is the sequence number M.
 * @param  M is a pointer to the computed M hash.
 *
 * @return None.
@@ -777,23 +795,18 @@ void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
 * @note   None.
 *
 ******************************************************************************/
-void XHdcp22Tx_ComputeM(const u8* Rn, const u8* Rrx, const u8* Rtx,
-	const u8* StreamIDType, const u8* k,
-	const u8* SeqNum_M, const u8* Km, u8* M)
+void XHdcp22Tx_ComputeM(const XHdcp22_Tx_Dp_SessionKeys *KeysPtr,
+                        const u8* StreamIDType, const u8* k,
+                        const u8* SeqNum_M, u8* M)
 {
 	/* Verify arguments */
-	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(KeysPtr != NULL);
+	Xil_AssertVoid(StreamIDType != NULL);
 	Xil_AssertVoid(k != NULL);
-	Xil_AssertVoid(Km != NULL);
+	Xil_AssertVoid(SeqNum_M != NULL);
 	Xil_AssertVoid(M != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
-	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
-
-	u8 SHA256_Kd[XHDCP22_TX_SHA256_HASH_SIZE];
+	XHdcp22Cmn_HmacSha256Ctx HashCtx;
 
 	u16 StreamIDCount;
 
@@ -801,39 +814,15 @@ void XHdcp22Tx_ComputeM(const u8* Rn, const u8* Rrx, const u8* Rtx,
 	StreamIDCount  = k[0] << 8; // MSB
 	StreamIDCount |= k[1];      // LSB
 
-	u8 HashInput[(XHDCP22_TX_REPEATER_MAX_DEVICE_COUNT * XHDCP22_TX_RCVID_SIZE) +
-		XHDCP22_TX_RXINFO_SIZE + XHDCP22_TX_SEQ_NUM_M_SIZE];
-	int Idx = 0;
-
-	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
-	* Note: Protocol says we should use incoming Rn and XOR it with Km,
-	* but then the output does not match the errata output.
-	* For now we use for Rn 0, which matches the test vectors.
-	*/
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
-
-	/* Determine dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Normally we should do Rrx XOR with Ctr0, but Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
-
-	/* Determine dkey1, counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
-
-	/* Create hash with SHA256 */
-	XHdcp22Cmn_Sha256Hash(Kd, sizeof(Kd), SHA256_Kd);
-
 	/* Create hash with HMAC-SHA256. */
-	/* Input: StreamID_Type list || seq_num_M. */
-	memcpy(HashInput, StreamIDType, (StreamIDCount*XHDCP22_TX_STREAMID_TYPE_SIZE));
-	Idx += (StreamIDCount*XHDCP22_TX_STREAMID_TYPE_SIZE);
-	memcpy(&HashInput[Idx], SeqNum_M, XHDCP22_TX_SEQ_NUM_M_SIZE);
-	Idx += XHDCP22_TX_SEQ_NUM_M_SIZE;
 	/* HashKey:	SHA256(Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, Idx, SHA256_Kd, sizeof(SHA256_Kd), M);
+	XHdcp22Cmn_HmacSha256Init(&HashCtx, &KeysPtr->Sha256Kd);
+
+	/* Input: StreamID_Type list || seq_num_M. */
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, StreamIDType,
+		(StreamIDCount*XHDCP22_TX_STREAMID_TYPE_SIZE));
+	XHdcp22Cmn_HmacSha256Update(&HashCtx, SeqNum_M, XHDCP22_TX_SEQ_NUM_M_SIZE);
+	XHdcp22Cmn_HmacSha256Final(&HashCtx, M);
 }
 
 /*****************************************************************************/
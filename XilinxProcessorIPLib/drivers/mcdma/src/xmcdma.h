@@ -47,6 +47,11 @@
 *
 * - Setup the BD's for the Channel:
 *      - XMcDma_ChanBdCreate(...)
+*   or, to allocate the BDs from the DMA descriptor memory of the BSP
+*   (xil_dmamem.h) shared with the other DMA drivers:
+*      - XMcDma_ChanBdCreatePool(...)
+*   which is in xmcdma_bd_pool.c, so the descriptor memory is linked only
+*   into the applications which call it.
 *
 * - Submit a DMA transfer for the required length.
 *      - XMcDma_ChanSubmit(...)
@@ -62,6 +67,13 @@
 *   BDs back to the free pool:
 *      - XMcdma_BdChainFree(...)
 *
+* When buffers are queued on several channels of the same direction at once,
+* XMcDma_BatchSubmit() replaces the per channel submit and XMcDma_ChanToHw()
+* calls. It flushes each channel's BDs once, issues a single barrier and
+* enables all the channels with one register write. The completed BDs of all
+* the channels are retrieved with XMcdma_BatchFromHw() and freed with
+* XMcdma_BatchFree().
+*
 * The driver also provides API functions to get the status of a completed
 * BD, along with get functions for other fields in the BD.
 *
@@ -121,6 +133,11 @@
 *                        to program BD control and sideband information.
 * 1.5	sk	07/13/20 Add XMcDma_BdGetAppWord() function declaration to fix
 * 			 the gcc warning in mcdma integration test suite.
+* 1.6	ag	10/19/26 Add XMcDma_BatchSubmit(), XMcdma_BatchFromHw() and
+* 			 XMcdma_BatchFree() APIs to submit and retire BDs of
+* 			 multiple channels in one call.
+* 	ag	10/19/26 Add XMcDma_ChanBdCreatePool() and
+* 			 XMcDma_ChanBdDestroyPool() APIs.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -179,6 +196,26 @@ typedef void (*XMcdma_ChanDoneHandler) (void *CallBackRef);
 typedef void (*XMcdma_ChanErrorHandler) (void *CallBackRef, u32 ErrorMask);
 typedef void (*XMcdma_ChanPktDropHandler) (void *CallBackRef);
 
+/**
+ * Descriptor of one packet submitted with XMcDma_BatchSubmit()
+ */
+typedef struct {
+	u32 ChanId;		/**< Channel number, starting from 1 */
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Length of the buffer in bytes */
+	u32 *AppPtr;		/**< APP words to be programmed in the BDs,
+				  *  NULL if not used */
+} XMcdma_BatchDesc;
+
+/**
+ * Chain of BDs retired from a channel by XMcdma_BatchFromHw()
+ */
+typedef struct {
+	u32 ChanId;		/**< Channel number, starting from 1 */
+	int BdCount;		/**< Number of BDs processed by hardware */
+	XMcdma_Bd *BdPtr;	/**< First BD processed by hardware */
+} XMcdma_BatchChain;
+
 typedef enum {
 	XMCDMA_FIXED_PRIORITY,
 	XMCDMA_WRR,
@@ -602,6 +639,8 @@ void XMcdma_SetSGARCache(XMcdma *InstancePtr, u8 Value);
 int XMcdma_UpdateChanCDesc(XMcdma_ChanCtrl *Chan);
 int XMcdma_UpdateChanTDesc(XMcdma_ChanCtrl *Chan);
 u32 XMcDma_ChanBdCreate(XMcdma_ChanCtrl *Chan, UINTPTR Addr, u32 Count);
+u32 XMcDma_ChanBdCreatePool(XMcdma_ChanCtrl *Chan, u32 Count);
+u32 XMcDma_ChanBdDestroyPool(XMcdma_ChanCtrl *Chan);
 u32 XMcDma_ChanSubmit(XMcdma_ChanCtrl *Chan, UINTPTR BufAddr, u32 len);
 u32 XMcDma_Chan_Sideband_Submit(XMcdma_ChanCtrl *ChanPtr, UINTPTR BufAddr,
 				u32 Len, u32 *AppPtr, u16 Tuser, u16 Tid);
@@ -609,6 +648,12 @@ u32 XMcDma_ChanToHw(XMcdma_ChanCtrl *Chan);
 int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit,
 			 XMcdma_Bd **BdSetPtr);
 int XMcdma_BdChainFree(XMcdma_ChanCtrl *Chan, int BdCount, XMcdma_Bd *BdSetPtr);
+u32 XMcDma_BatchSubmit(XMcdma *InstancePtr, u32 Direction,
+		       const XMcdma_BatchDesc *DescPtr, u32 NumDesc);
+u32 XMcdma_BatchFromHw(XMcdma *InstancePtr, u32 Direction, u32 BdLimit,
+		       XMcdma_BatchChain *ChainPtr, u32 MaxChains);
+int XMcdma_BatchFree(XMcdma *InstancePtr, u32 Direction,
+		     const XMcdma_BatchChain *ChainPtr, u32 NumChains);
 u32 XMcdma_BdSetBufAddr(XMcdma_Bd *BdPtr, UINTPTR Addr);
 void XMcDma_BdSetCtrl(XMcdma_Bd *BdPtr, u32 Data);
 void XMcDma_DumpBd(XMcdma_Bd* BdPtr);
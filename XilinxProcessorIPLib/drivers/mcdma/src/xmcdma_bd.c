@@ -22,6 +22,12 @@
 *  1.3  rsp  02/11/19 Add top level submit XMcDma_Chan_Sideband_Submit() API
 *                     to program BD control and sideband information.
 *  1.4  rsp  09/17/19 Prefer using dmb in XMcdma_UpdateChanTDesc.
+*  1.6  ag   10/19/26 Add XMcDma_BatchSubmit(), XMcdma_BatchFromHw() and
+*                     XMcdma_BatchFree() APIs.
+*       ag   10/19/26 Add XMcDma_ChanBdCreatePool() and
+*                     XMcDma_ChanBdDestroyPool() APIs.
+*       ag   10/19/26 Move XMcDma_ChanBdCreatePool() and
+*                     XMcDma_ChanBdDestroyPool() to xmcdma_bd_pool.c.
 ******************************************************************************/
 
 #include "xmcdma.h"
@@ -568,6 +574,326 @@ int XMcdma_BdChainFree(XMcdma_ChanCtrl *Chan, int BdCount, XMcdma_Bd *BdSetPtr)
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function submits buffers to multiple channels of one direction and
+* starts the hardware. The BDs of all the channels are programmed first, each
+* channel's BD range is flushed once and a single barrier is issued before the
+* tail descriptors are written. All the channels are then enabled with one
+* write to the channel enable register.
+*
+* Each descriptor is one packet, for MM2S channels SOF is set in the first BD
+* and EOF in the last BD of the packet.
+*
+* @param	InstancePtr is a pointer to the MCDMA instance to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S channels or
+*		XMCDMA_DEV_TO_MEM for S2MM channels.
+* @param	DescPtr is the array of buffers to be submitted.
+* @param	NumDesc is the number of entries in DescPtr.
+*
+* @return
+*		- XST_SUCCESS if the buffers are submitted.
+*		- XST_INVALID_PARAM if a channel number or length is invalid.
+*		- XST_FAILURE if a channel doesn't have enough free BDs, in
+*		  this case none of the buffers are submitted.
+*		- XST_DMA_ERROR if the hardware could not be started.
+*
+* @note		This function should not be preempted by another XMcdma
+*		function call that modifies the BD space of the channels.
+*
+*****************************************************************************/
+u32 XMcDma_BatchSubmit(XMcdma *InstancePtr, u32 Direction,
+		       const XMcdma_BatchDesc *DescPtr, u32 NumDesc)
+{
+	XMcdma_ChanCtrl *Chan = NULL;
+	XMcdma_Bd *BdCurPtr;
+	UINTPTR BdFirst[XMCDMA_MAX_CHAN_PER_DEVICE];
+	u32 BdNeeded[XMCDMA_MAX_CHAN_PER_DEVICE] = {0U};
+	UINTPTR BufAddr;
+	UINTPTR Start;
+	UINTPTR End;
+	UINTPTR RingEnd;
+	u32 NumChannels;
+	u32 ChanMask = 0U;
+	u32 BdCount;
+	u32 Bdlen;
+	u32 Len;
+	u32 Ctrl;
+	u32 Reg;
+	u32 i;
+	u32 j;
+	u32 k;
+	u32 Status;
+
+	if ((InstancePtr == NULL) || (DescPtr == NULL) || (NumDesc == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		NumChannels = (u32)InstancePtr->Config.TxNumChannels;
+	} else {
+		NumChannels = (u32)InstancePtr->Config.RxNumChannels;
+	}
+
+	/* Check all the requests before programming any BD */
+	for (i = 0; i < NumDesc; i++) {
+		if ((DescPtr[i].ChanId == 0U) ||
+		    (DescPtr[i].ChanId > NumChannels) ||
+		    (DescPtr[i].Len == 0U)) {
+			return XST_INVALID_PARAM;
+		}
+
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr,
+						     DescPtr[i].ChanId);
+		} else {
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr,
+						     DescPtr[i].ChanId);
+		}
+
+		BdCount = (DescPtr[i].Len + (Chan->MaxTransferLen - 1)) /
+			  Chan->MaxTransferLen;
+		BdNeeded[DescPtr[i].ChanId - 1] += BdCount;
+		if (BdNeeded[DescPtr[i].ChanId - 1] > Chan->BdCnt) {
+			xil_printf("Channel %d has only %x free Bd's\n\r",
+				   DescPtr[i].ChanId, Chan->BdCnt);
+
+			return XST_FAILURE;
+		}
+
+		if ((ChanMask & (1U << (DescPtr[i].ChanId - 1))) == 0U) {
+			BdFirst[DescPtr[i].ChanId - 1] =
+					(UINTPTR)Chan->BdRestart;
+			ChanMask |= (1U << (DescPtr[i].ChanId - 1));
+		}
+	}
+
+	/* Program the BDs, the cache is flushed once per channel below */
+	for (i = 0; i < NumDesc; i++) {
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr,
+						     DescPtr[i].ChanId);
+		} else {
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr,
+						     DescPtr[i].ChanId);
+		}
+
+		BdCurPtr = Chan->BdRestart;
+		BufAddr = DescPtr[i].BufAddr;
+		Len = DescPtr[i].Len;
+		BdCount = 0U;
+
+		while (Len > 0U) {
+			Bdlen = Chan->MaxTransferLen;
+			if (Len < Chan->MaxTransferLen) {
+				Bdlen = Len;
+			}
+
+			XMcdma_BdClear(BdCurPtr);
+			XMcdma_BdSetBufAddr(BdCurPtr, BufAddr);
+
+			Ctrl = Bdlen;
+			if (!Chan->IsRxChan) {
+				if (BdCount == 0U) {
+					Ctrl |= XMCDMA_BD_CTRL_SOF_MASK;
+				}
+				if (Len == Bdlen) {
+					Ctrl |= XMCDMA_BD_CTRL_EOF_MASK;
+				}
+			}
+			XMcdma_BdWrite(BdCurPtr, XMCDMA_BD_CTRL_OFFSET, Ctrl);
+
+			if ((DescPtr[i].AppPtr != NULL) &&
+			    (!Chan->IsRxChan || Chan->HasRxLength)) {
+				for (k = 0; k <= XMCDMA_LAST_APPWORD; k++) {
+					XMcdma_BdWrite(BdCurPtr,
+						       XMCDMA_BD_USR0_OFFSET +
+						       (k * 4),
+						       DescPtr[i].AppPtr[k]);
+				}
+			}
+
+			Chan->BdTail = BdCurPtr;
+			BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan,
+								   BdCurPtr);
+			BufAddr += Bdlen;
+			Len -= Bdlen;
+			BdCount++;
+		}
+
+		Chan->BdRestart = BdCurPtr;
+		Chan->BdPendingCnt += BdCount;
+		Chan->BdCnt -= BdCount;
+	}
+
+	/*
+	 * Flush the BDs of each channel along with the BD following the
+	 * tail, splitting the range where it wraps around the ring.
+	 */
+	for (j = 0; j < NumChannels; j++) {
+		if ((ChanMask & (1U << j)) == 0U) {
+			continue;
+		}
+
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, j + 1);
+		} else {
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, j + 1);
+		}
+
+		Start = BdFirst[j];
+		End = Start + ((BdNeeded[j] + 1) * Chan->Separation);
+		RingEnd = Chan->LastBdAddr + Chan->Separation;
+		if (End <= RingEnd) {
+			XMCDMA_CACHE_FLUSH_RANGE(Start, End - Start);
+		} else {
+			XMCDMA_CACHE_FLUSH_RANGE(Start, RingEnd - Start);
+			XMCDMA_CACHE_FLUSH_RANGE(Chan->FirstBdAddr,
+						 End - RingEnd);
+		}
+	}
+	DATA_SYNC;
+
+	/* Update the descriptors of each channel */
+	for (j = 0; j < NumChannels; j++) {
+		if ((ChanMask & (1U << j)) == 0U) {
+			continue;
+		}
+
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, j + 1);
+		} else {
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, j + 1);
+		}
+
+		Status = XMcdma_UpdateChanCDesc(Chan);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Update CUR DESC failed %x", Status);
+			return Status;
+		}
+
+		Status = XMcdma_UpdateChanTDesc(Chan);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Update TAIL DESC failed %x", Status);
+			return Status;
+		}
+	}
+
+	/* Enable all the channels, they share the channel enable register */
+	Reg = XMcdma_ReadReg(Chan->ChanBase, XMCDMA_CHEN_OFFSET);
+	XMcdma_WriteReg(Chan->ChanBase, XMCDMA_CHEN_OFFSET, Reg | ChanMask);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function retrieves the BDs processed by hardware on all the channels
+* of one direction. For each channel with completed BDs an entry is added to
+* ChainPtr, the BDs are to be freed with XMcdma_BatchFree() once the
+* application is done with them.
+*
+* @param	InstancePtr is a pointer to the MCDMA instance to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S channels or
+*		XMCDMA_DEV_TO_MEM for S2MM channels.
+* @param	BdLimit is the maximum number of BDs to retrieve per channel.
+* @param	ChainPtr is the array in which the completed chains are
+*		returned.
+* @param	MaxChains is the number of entries in ChainPtr.
+*
+* @return	Number of entries filled in ChainPtr.
+*
+* @note		This function should not be preempted by another XMcdma
+*		function call that modifies the BD space of the channels.
+*
+*****************************************************************************/
+u32 XMcdma_BatchFromHw(XMcdma *InstancePtr, u32 Direction, u32 BdLimit,
+		       XMcdma_BatchChain *ChainPtr, u32 MaxChains)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_Bd *BdPtr;
+	u32 NumChannels;
+	u32 NumChains = 0U;
+	u32 i;
+	int BdCount;
+
+	if ((InstancePtr == NULL) || (ChainPtr == NULL)) {
+		return 0U;
+	}
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		NumChannels = (u32)InstancePtr->Config.TxNumChannels;
+	} else {
+		NumChannels = (u32)InstancePtr->Config.RxNumChannels;
+	}
+
+	for (i = 1; (i <= NumChannels) && (NumChains < MaxChains); i++) {
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, i);
+		} else {
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, i);
+		}
+
+		if (Chan->BdSubmitCnt == 0U) {
+			continue;
+		}
+
+		BdCount = XMcdma_BdChainFromHW(Chan, BdLimit, &BdPtr);
+		if (BdCount > 0) {
+			ChainPtr[NumChains].ChanId = i;
+			ChainPtr[NumChains].BdCount = BdCount;
+			ChainPtr[NumChains].BdPtr = BdPtr;
+			NumChains++;
+		}
+	}
+
+	return NumChains;
+}
+
+/*****************************************************************************/
+/**
+* Frees the BD chains retrieved with XMcdma_BatchFromHw().
+*
+* @param	InstancePtr is a pointer to the MCDMA instance to be worked on.
+* @param	Direction is the direction passed to XMcdma_BatchFromHw().
+* @param	ChainPtr is the array returned by XMcdma_BatchFromHw().
+* @param	NumChains is the number of entries in ChainPtr.
+*
+* @return
+*		- XST_SUCCESS if all the BDs were freed.
+*		- XST_INVALID_PARAM if an entry is invalid.
+*
+*****************************************************************************/
+int XMcdma_BatchFree(XMcdma *InstancePtr, u32 Direction,
+		     const XMcdma_BatchChain *ChainPtr, u32 NumChains)
+{
+	XMcdma_ChanCtrl *Chan;
+	u32 i;
+	int Status;
+
+	if ((InstancePtr == NULL) || (ChainPtr == NULL)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (i = 0; i < NumChains; i++) {
+		if (Direction == XMCDMA_MEM_TO_DEV) {
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr,
+						     ChainPtr[i].ChanId);
+		} else {
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr,
+						     ChainPtr[i].ChanId);
+		}
+
+		Status = XMcdma_BdChainFree(Chan, ChainPtr[i].BdCount,
+					    ChainPtr[i].BdPtr);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 * Set the Buffer descriptor buffer address field.
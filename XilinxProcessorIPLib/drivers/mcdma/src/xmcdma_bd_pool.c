@@ -0,0 +1,90 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_bd_pool.c
+* @addtogroup mcdma_v1_6
+* @{
+*
+* This file implements the creation of BD chains in the DMA descriptor memory
+* of the BSP. It is kept apart from xmcdma_bd.c so that the descriptor memory
+* is linked only into the applications which use these functions.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+*  1.6  ag   10/19/26 First release, moved from xmcdma_bd.c
+******************************************************************************/
+
+#include "xmcdma.h"
+#include "xil_dmamem.h"
+
+/*****************************************************************************/
+/**
+* This function creates and setup the BD Chain for the MCDMA Channel in memory
+* allocated from the DMA descriptor memory of the BSP, see xil_dmamem.h. The
+* memory is shared with the other DMA drivers and is non-cacheable.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	Count is the number of BDs of the chain.
+*
+* @return
+*		- XST_SUCCESS if initialization was successful
+*		- XST_INVALID_PARAM if Count is not positive.
+*		- XST_FAILURE if the descriptor memory is exhausted.
+*
+* @note		The memory is released with XMcDma_ChanBdDestroyPool().
+*
+*****************************************************************************/
+u32 XMcDma_ChanBdCreatePool(XMcdma_ChanCtrl *Chan, u32 Count)
+{
+	void *MemPtr;
+	u32 Status;
+
+	if (Count == 0U)
+		return XST_INVALID_PARAM;
+
+	MemPtr = Xil_DmaMemAlloc((u32)sizeof(XMcdma_Bd) * Count,
+				 XIL_DMAMEM_ALIGN_MCDMA);
+	if (MemPtr == NULL)
+		return XST_FAILURE;
+
+	Status = XMcDma_ChanBdCreate(Chan, (UINTPTR)MemPtr, Count);
+	if (Status != XST_SUCCESS)
+		(void)Xil_DmaMemFree(MemPtr);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function releases the memory of a BD Chain created with
+* XMcDma_ChanBdCreatePool(). The channel must be stopped before the chain is
+* destroyed.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+*
+* @return
+*		- XST_SUCCESS if the memory is released.
+*		- XST_INVALID_PARAM if the chain was not created from the
+*		  descriptor memory.
+*
+*****************************************************************************/
+u32 XMcDma_ChanBdDestroyPool(XMcdma_ChanCtrl *Chan)
+{
+	if (Xil_DmaMemFree((void *)Chan->FirstBdAddr) != XST_SUCCESS)
+		return XST_INVALID_PARAM;
+
+	Chan->BdCnt = 0;
+	Chan->BdPendingCnt = 0;
+	Chan->BdSubmitCnt = 0;
+	Chan->BdDoneCnt = 0;
+
+	return XST_SUCCESS;
+}
+/** @} */
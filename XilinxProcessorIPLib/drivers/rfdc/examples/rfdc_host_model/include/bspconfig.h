@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* The host model has no BSP configuration.
+*
+******************************************************************************/
+#ifndef RFDC_MODEL_BSPCONFIG_H_
+#define RFDC_MODEL_BSPCONFIG_H_
+
+#endif /* RFDC_MODEL_BSPCONFIG_H_ */
@@ -0,0 +1,18 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* The host model has no generated hardware parameters, the configuration of
+* the converter is built by rfdc_model.c.
+*
+******************************************************************************/
+#ifndef RFDC_MODEL_XPARAMETERS_H_
+#define RFDC_MODEL_XPARAMETERS_H_
+
+#endif /* RFDC_MODEL_XPARAMETERS_H_ */
@@ -0,0 +1,21 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpseudo_asm.h
+*
+* This file provides the barriers used by the BSP headers on the host.
+*
+******************************************************************************/
+#ifndef RFDC_MODEL_XPSEUDO_ASM_H_
+#define RFDC_MODEL_XPSEUDO_ASM_H_
+
+#define dmb()	__sync_synchronize()
+#define dsb()	__sync_synchronize()
+#define isb()	__sync_synchronize()
+
+#endif /* RFDC_MODEL_XPSEUDO_ASM_H_ */
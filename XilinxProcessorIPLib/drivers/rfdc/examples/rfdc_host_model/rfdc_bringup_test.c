@@ -0,0 +1,373 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_bringup_test.c
+*
+* This file is the latency model of the tile bring-up of the rfdc driver on
+* the host. The restart state machine of every tile is modelled over the time
+* of the register model: a restart moves the tile from its start state to its
+* end state, one state per STATE_TIME, and the tile waits at the clock
+* detection state for its PLL, which locks LOCK_TIME after the restart. The
+* lock time is different for every tile.
+*
+* XRFdc_StartUp() of all the ADC and then all the DAC tiles is timed in the
+* sequential and in the parallel bring-up mode set by
+* XRFdc_SetParallelBringUp().
+*
+* - Both modes must bring every tile to its end state.
+* - The sequential mode must take at least the sum of the tile latencies.
+* - The parallel mode must take the latency of the slowest tile, within the
+*   polling period of the driver.
+* - A tile whose PLL does not lock must fail the start up in both modes.
+*
+* The DTC scan of XRFdc_MultiConverter_Sync() is not modelled.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include "rfdc_model.h"
+
+/************************** Constant Definitions *****************************/
+#define STATE_TIME	100U	/* us per state of the state machine */
+#define LOCK_TIME	2000U	/* us, PLL lock time of tile 0 */
+#define LOCK_STEP	700U	/* us, added per tile */
+#define NEVER		0xFFFFFFFFU	/* Lock time of a PLL which never locks */
+#define POLL_MARGIN	200U	/* us, per type, polling of the parallel mode */
+#define PLL_DIVIDER0_PLL 0x40U	/* Output divider mode with the PLL used */
+
+/**************************** Type Definitions *******************************/
+/* State machine of a tile */
+typedef struct {
+	u32 Active;		/* Restart in progress */
+	u32 Start;		/* Start state */
+	u32 End;		/* End state */
+	u32 LockTime;		/* us after the restart */
+	u64 StartTime;		/* Time of the restart, us */
+} TileModel;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static int Setup(u32 FailTile);
+static int WriteHook(u32 Offset, u32 Value, int Width);
+static void TimeHook(u64 Now);
+static u64 TileLatency(const TileModel *TilePtr);
+static int BringUp(u8 Parallel, u32 FailTile, u64 *TimePtr, u64 *SumPtr,
+		u64 *MaxPtr);
+
+/************************** Variable Definitions *****************************/
+static XRFdc RFdcInst;
+static TileModel Tiles[2][XRFDC_NUM_OF_TILES4];
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	u64 SeqTime;
+	u64 ParTime;
+	u64 Sum;
+	u64 Max;
+
+	if ((BringUp(0U, NEVER, &SeqTime, &Sum, &Max) != XRFDC_SUCCESS) ||
+	    (SeqTime < Sum)) {
+		printf("Sequential bring-up failed, %llu us for %llu us of "
+			"tile latency\r\n", (unsigned long long)SeqTime,
+			(unsigned long long)Sum);
+		return 1;
+	}
+	if ((BringUp(1U, NEVER, &ParTime, &Sum, &Max) != XRFDC_SUCCESS) ||
+	    (ParTime > (Max + (2U * POLL_MARGIN)))) {
+		printf("Parallel bring-up failed, %llu us for %llu us of the "
+			"slowest tile per type\r\n", (unsigned long long)ParTime,
+			(unsigned long long)Max);
+		return 1;
+	}
+	printf("Start up of 4 ADC and 4 DAC tiles: sequential %llu us, "
+		"parallel %llu us\r\n", (unsigned long long)SeqTime,
+		(unsigned long long)ParTime);
+
+	if ((BringUp(0U, 2U, &SeqTime, &Sum, &Max) != XRFDC_FAILURE) ||
+	    (BringUp(1U, 2U, &ParTime, &Sum, &Max) != XRFDC_FAILURE)) {
+		printf("PLL lock timeout not reported\r\n");
+		return 1;
+	}
+	printf("PLL lock timeout of ADC 2: sequential %llu us, parallel "
+		"%llu us\r\n", (unsigned long long)SeqTime,
+		(unsigned long long)ParTime);
+
+	printf("Successfully ran bring-up latency model\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts up all the ADC tiles and then all the DAC tiles.
+*
+* @param	Parallel is 1 for the parallel bring-up, 0 for the sequential
+*		one.
+* @param	FailTile is the ADC tile whose PLL never locks, NEVER if none.
+* @param	TimePtr is the time of the start up, us.
+* @param	SumPtr is the sum of the latencies of the tiles, us.
+* @param	MaxPtr is the sum over the ADC and DAC types of the latency of
+*		the slowest tile, us.
+*
+* @return	XRFDC_SUCCESS if all the tiles reached their end state,
+*		XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int BringUp(u8 Parallel, u32 FailTile, u64 *TimePtr, u64 *SumPtr,
+		u64 *MaxPtr)
+{
+	u32 Type;
+	u32 Tile;
+	u32 Base;
+	u64 Latency;
+	u64 TypeMax;
+	int Status = XRFDC_SUCCESS;
+
+	if ((Setup(FailTile) != XRFDC_SUCCESS) ||
+	    (XRFdc_SetParallelBringUp(&RFdcInst, Parallel) != XRFDC_SUCCESS)) {
+		return XRFDC_FAILURE;
+	}
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		if (XRFdc_StartUp(&RFdcInst, Type, -1) != XRFDC_SUCCESS) {
+			Status = XRFDC_FAILURE;
+			break;
+		}
+	}
+	*TimePtr = XRFdcModel_GetTime();
+
+	*SumPtr = 0U;
+	*MaxPtr = 0U;
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		TypeMax = 0U;
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			Base = XRFDC_CTRL_STS_BASE(Type, Tile);
+			if ((Status == XRFDC_SUCCESS) &&
+			    ((XRFdcModel_Read(Base + XRFDC_CURRENT_STATE_OFFSET,
+					4) != XRFDC_STATE_FULL) ||
+			     (XRFdcModel_Read(Base + XRFDC_RESTART_OFFSET,
+					4) != 0U))) {
+				printf("%s %u not started\r\n",
+					(Type == XRFDC_ADC_TILE) ? "ADC" :
+					"DAC", Tile);
+				Status = XRFDC_FAILURE;
+			}
+			Latency = TileLatency(&Tiles[Type][Tile]);
+			*SumPtr += Latency;
+			if (Latency > TypeMax) {
+				TypeMax = Latency;
+			}
+		}
+		*MaxPtr += TypeMax;
+	}
+
+	XRFdcModel_SetWriteHook(NULL);
+	XRFdcModel_SetTimeHook(NULL);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the model with all the tiles clocked by their
+* internal PLL, and the state machines of the tiles idle.
+*
+* @param	FailTile is the ADC tile whose PLL never locks, NEVER if none.
+*
+* @return	XRFDC_SUCCESS if successful, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int Setup(u32 FailTile)
+{
+	u32 Type;
+	u32 Tile;
+
+	if (XRFdcModel_Init(&RFdcInst, 1U) != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+
+	memset(Tiles, 0, sizeof(Tiles));
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			XRFdcModel_Store(XRFDC_DRP_BASE(Type, Tile) +
+					XRFDC_HSCOM_ADDR + XRFDC_PLL_DIVIDER0,
+					PLL_DIVIDER0_PLL, 2);
+			Tiles[Type][Tile].LockTime = LOCK_TIME +
+					((Tile + (Type * 2U)) * LOCK_STEP);
+		}
+	}
+	if (FailTile != NEVER) {
+		Tiles[XRFDC_ADC_TILE][FailTile].LockTime = NEVER;
+	}
+
+	XRFdcModel_SetWriteHook(WriteHook);
+	XRFdcModel_SetTimeHook(TimeHook);
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write hook of the model, starts the state machine of a tile when its
+* restart bit is written.
+*
+* @param	Offset is the offset of the register.
+* @param	Value is the value written.
+* @param	Width is the access width in bytes.
+*
+* @return	0, the value is stored.
+*
+******************************************************************************/
+static int WriteHook(u32 Offset, u32 Value, int Width)
+{
+	TileModel *TilePtr;
+	u32 Type;
+	u32 Tile;
+	u32 Base;
+	u32 State;
+
+	(void)Width;
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			Base = XRFDC_CTRL_STS_BASE(Type, Tile);
+			if ((Offset != (Base + XRFDC_RESTART_OFFSET)) ||
+			    ((Value & XRFDC_RESTART_MASK) == 0U)) {
+				continue;
+			}
+			TilePtr = &Tiles[Type][Tile];
+			State = XRFdcModel_Read(Base +
+					XRFDC_RESTART_STATE_OFFSET, 4);
+			TilePtr->Start = (State >> XRFDC_RSR_START_SHIFT) &
+					XRFDC_CURRENT_STATE_MASK;
+			TilePtr->End = State & XRFDC_CURRENT_STATE_MASK;
+			TilePtr->StartTime = XRFdcModel_GetTime();
+			TilePtr->Active = 1U;
+			XRFdcModel_Store(Base + XRFDC_CURRENT_STATE_OFFSET,
+					TilePtr->Start, 4);
+			XRFdcModel_Store(Base + XRFDC_STATUS_OFFSET,
+					XRFdcModel_Read(Base +
+					XRFDC_STATUS_OFFSET, 4) &
+					~XRFDC_PLL_LOCKED_MASK, 4);
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Time hook of the model, moves the state machines of the tiles.
+*
+* @param	Now is the time of the model, us.
+*
+* @return	None.
+*
+******************************************************************************/
+static void TimeHook(u64 Now)
+{
+	TileModel *TilePtr;
+	u32 Type;
+	u32 Tile;
+	u32 Base;
+	u32 Locked;
+	u64 Elapsed;
+	u64 ClkDet;
+	u64 State;
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			TilePtr = &Tiles[Type][Tile];
+			if (TilePtr->Active == 0U) {
+				continue;
+			}
+			Base = XRFDC_CTRL_STS_BASE(Type, Tile);
+			Elapsed = Now - TilePtr->StartTime;
+
+			Locked = ((TilePtr->LockTime != NEVER) &&
+				  (Elapsed >= TilePtr->LockTime)) ? 1U : 0U;
+			if (Locked != 0U) {
+				XRFdcModel_Store(Base + XRFDC_STATUS_OFFSET,
+					XRFdcModel_Read(Base +
+					XRFDC_STATUS_OFFSET, 4) |
+					XRFDC_PLL_LOCKED_MASK, 4);
+			}
+
+			State = TilePtr->Start + (Elapsed / STATE_TIME);
+			if ((State > XRFDC_STATE_CLK_DET) &&
+			    (TilePtr->End > XRFDC_STATE_CLK_DET)) {
+				/* The states after the clock detection wait for the lock */
+				ClkDet = (XRFDC_STATE_CLK_DET - TilePtr->Start) *
+						STATE_TIME;
+				if (Locked == 0U) {
+					State = XRFDC_STATE_CLK_DET;
+				} else {
+					if (TilePtr->LockTime > ClkDet) {
+						ClkDet = TilePtr->LockTime;
+					}
+					State = XRFDC_STATE_CLK_DET +
+						((Elapsed - ClkDet) / STATE_TIME);
+				}
+			}
+			if (State >= TilePtr->End) {
+				State = TilePtr->End;
+				TilePtr->Active = 0U;
+				XRFdcModel_Store(Base + XRFDC_RESTART_OFFSET,
+						0U, 4);
+			}
+			XRFdcModel_Store(Base + XRFDC_CURRENT_STATE_OFFSET,
+					(u32)State, 4);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time a tile needs to go from state 1 to the full
+* state, the states after the clock detection wait for the PLL lock.
+*
+* @param	TilePtr is the tile.
+*
+* @return	Latency in us.
+*
+******************************************************************************/
+static u64 TileLatency(const TileModel *TilePtr)
+{
+	u64 ClkDet = (XRFDC_STATE_CLK_DET - XRFDC_SM_STATE1) * STATE_TIME;
+
+	if (TilePtr->LockTime == NEVER) {
+		return 0U;
+	}
+	if (TilePtr->LockTime > ClkDet) {
+		ClkDet = TilePtr->LockTime;
+	}
+
+	return ClkDet + ((XRFDC_STATE_FULL - XRFDC_STATE_CLK_DET) * STATE_TIME);
+}
@@ -0,0 +1,738 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_intr_test.c
+*
+* This file tests the interrupt demultiplexer of the rfdc driver on the host,
+* with a simulated interrupt source on the register model. The source raises
+* status bits in the converter and DRP status registers of the slices, keeps
+* the slice, common and tile summary bits of the IP up to date, and clears
+* the status bits written with one, as the IP does.
+*
+* - A burst of events on several tiles is serviced by one call of
+*   XRFdc_IntrDemuxHandler(), with one handler call per pending block and
+*   one write per status register with pending bits. The number of calls
+*   and writes of XRFdc_IntrHandler() for the same burst is reported, it
+*   clears the bits of a high speed ADC pair in both slices.
+* - A tile with only the common interrupt pending is reported with
+*   XRFDC_BLK_ID_NONE and counted in the statistics.
+* - A call with nothing pending is counted as spurious.
+* - A source thread raises random events and services them while the main
+*   thread reads the statistics of the blocks. Every snapshot must be
+*   consistent and the final counters must match the raised events.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "rfdc_model.h"
+
+/************************** Constant Definitions *****************************/
+#define REG_CONV	0U	/* Converter status, 32 bits */
+#define REG_FABRIC	1U	/* Fabric FIFO ISR */
+#define REG_OBS		2U	/* Observation FIFO ISR, ADC only */
+#define REG_DEC		3U	/* Sub-ADC decoder ISR, ADC only */
+#define REG_DATPATH	4U	/* Data path ISR */
+#define NUM_REGS	5U
+
+#define CAT_OVR_VOLTAGE	0U
+#define CAT_OVR_RANGE	1U
+#define CAT_CMODE	2U
+#define CAT_CONV_OVR	3U
+#define CAT_FIFO	4U
+#define CAT_DECODER	5U
+#define CAT_DATPATH	6U
+
+#define NUM_EVENTS	200000U	/* Events of the source thread */
+#define MAX_CALLS	64U	/* Calls of XRFdc_IntrHandler() for a burst */
+
+/**************************** Type Definitions *******************************/
+/* Event the source can raise */
+typedef struct {
+	u32 Reg;	/* Status register */
+	u32 Bits;	/* Possible bits, one is raised */
+	u32 Category;	/* Counter of the statistics */
+} SimEvent;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XRFDC_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int TestBurst(void);
+static int TestCommon(void);
+static int TestThreads(void);
+static void SimInit(void);
+static u32 SimRegOffset(u32 Type, u32 Tile_Id, u32 Slice, u32 Reg);
+static int SimRegWidth(u32 Reg);
+static void SimRaise(u32 Type, u32 Tile_Id, u32 Slice, u32 Reg, u32 Bits);
+static void SimSetCommon(u32 Type, u32 Tile_Id, u32 Pending);
+static void SimUpdate(void);
+static u32 SimPending(void);
+static int SimWriteHook(u32 Offset, u32 Value, int Width);
+static void StatusHandler(void *CallBackRef, u32 Type, u32 Tile_Id,
+		u32 Block_Id, u32 StatusEvent);
+static u32 *Counter(XRFdc_Intr_Block_Stats *StatsPtr, u32 Category);
+static u32 Random(u32 Range);
+static void *SourceThread(void *Arg);
+
+/************************** Variable Definitions *****************************/
+static XRFdc RFdcInst;
+static XRFdc_Intr_Stats Stats;
+static u32 Common[2][XRFDC_NUM_OF_TILES4];
+static u32 SimWrites;		/* Writes to the status registers */
+static u32 SimStaleWrites;	/* Writes of bits which were not pending */
+static u32 HandlerCalls;
+static u32 HandlerType;
+static u32 HandlerTile;
+static u32 HandlerBlock;
+static u32 HandlerEvent;
+static u32 Seed = 1U;
+static volatile u32 SourceDone;
+static XRFdc_Intr_Block_Stats Expected[2][4][4];
+
+static const SimEvent AdcEvents[] = {
+	{ REG_CONV, XRFDC_INTR_OVR_VOLTAGE_MASK, CAT_OVR_VOLTAGE },
+	{ REG_CONV, XRFDC_INTR_OVR_RANGE_MASK, CAT_OVR_RANGE },
+	{ REG_CONV, XRFDC_INTR_CMODE_OVR_MASK | XRFDC_INTR_CMODE_UNDR_MASK,
+		CAT_CMODE },
+	{ REG_CONV, XRFDC_INTR_FIFO_OVR_MASK | XRFDC_INTR_DAT_OVR_MASK,
+		CAT_CONV_OVR },
+	{ REG_FABRIC, XRFDC_IXR_FIFOUSRDAT_MASK, CAT_FIFO },
+	{ REG_OBS, XRFDC_IXR_FIFOUSRDAT_MASK, CAT_FIFO },
+	{ REG_DEC, XRFDC_DEC_ISR_SUBADC_MASK, CAT_DECODER },
+	{ REG_DATPATH, XRFDC_ADC_DAT_PATH_ISR_MASK, CAT_DATPATH },
+};
+
+static const SimEvent DacEvents[] = {
+	{ REG_CONV, XRFDC_INTR_FIFO_OVR_MASK | XRFDC_INTR_DAT_OVR_MASK,
+		CAT_CONV_OVR },
+	{ REG_FABRIC, XRFDC_IXR_FIFOUSRDAT_MASK | XRFDC_DAC_FIFO_IMR_SUPP_MASK,
+		CAT_FIFO },
+	{ REG_DATPATH, XRFDC_DAC_DAT_PATH_ISR_MASK, CAT_DATPATH },
+};
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	if ((TestBurst() != XRFDC_SUCCESS) ||
+	    (TestCommon() != XRFDC_SUCCESS) ||
+	    (TestThreads() != XRFDC_SUCCESS)) {
+		return 1;
+	}
+
+	printf("Successfully ran interrupt demultiplexer test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services a burst of events on several tiles with the
+* demultiplexer and with XRFdc_IntrHandler().
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int TestBurst(void)
+{
+	XRFdc_Intr_Block_Stats BlockStats;
+	u32 Calls;
+	u32 Pass;
+
+	for (Pass = 0U; Pass < 2U; Pass++) {
+		CHECK(XRFdcModel_Init(&RFdcInst, 1U) == XRFDC_SUCCESS, "init");
+		XRFdc_SetStatusHandler(&RFdcInst, NULL, StatusHandler);
+		XRFdc_SetIntrStats(&RFdcInst, &Stats);
+		SimInit();
+
+		/* Both slices of the ADC 0 block 0 pair and two other tiles */
+		SimRaise(XRFDC_ADC_TILE, 0U, 0U, REG_CONV,
+			XRFDC_INTR_OVR_VOLTAGE_MASK | XRFDC_INTR_OVR_RANGE_MASK);
+		SimRaise(XRFDC_ADC_TILE, 0U, 1U, REG_FABRIC, 0x3U);
+		SimRaise(XRFDC_ADC_TILE, 0U, 1U, REG_DEC, 0x81U);
+		SimRaise(XRFDC_ADC_TILE, 2U, 3U, REG_CONV,
+			XRFDC_INTR_CMODE_OVR_MASK);
+		SimRaise(XRFDC_DAC_TILE, 3U, 2U, REG_CONV,
+			XRFDC_INTR_DAT_OVR_MASK);
+		SimRaise(XRFDC_DAC_TILE, 3U, 2U, REG_DATPATH, 0x1U);
+		HandlerCalls = 0U;
+		SimWrites = 0U;
+
+		if (Pass == 0U) {
+			(void)XRFdc_IntrDemuxHandler(0U, &RFdcInst);
+			Calls = 1U;
+		} else {
+			for (Calls = 0U; (SimPending() != 0U) &&
+					(Calls < MAX_CALLS); Calls++) {
+				(void)XRFdc_IntrHandler(0U, &RFdcInst);
+			}
+		}
+		CHECK(SimPending() == 0U, "events left pending");
+		CHECK((Pass != 0U) || (SimStaleWrites == 0U),
+				"cleared a bit not pending");
+		printf("%-24s %2u calls, %u handler calls, %2u status writes, "
+			"%u with bits not pending\r\n",
+			(Pass == 0U) ? "XRFdc_IntrDemuxHandler" :
+			"XRFdc_IntrHandler", Calls, HandlerCalls, SimWrites,
+			SimStaleWrites);
+	}
+
+	/*
+	 * The last pass ran XRFdc_IntrHandler(), redo the burst with the
+	 * demultiplexer to check what it reported
+	 */
+	CHECK(XRFdcModel_Init(&RFdcInst, 1U) == XRFDC_SUCCESS, "init");
+	XRFdc_SetStatusHandler(&RFdcInst, NULL, StatusHandler);
+	XRFdc_SetIntrStats(&RFdcInst, &Stats);
+	SimInit();
+	SimRaise(XRFDC_ADC_TILE, 0U, 0U, REG_CONV,
+		XRFDC_INTR_OVR_VOLTAGE_MASK | XRFDC_INTR_OVR_RANGE_MASK);
+	SimRaise(XRFDC_ADC_TILE, 0U, 1U, REG_FABRIC, 0x3U);
+	SimRaise(XRFDC_ADC_TILE, 0U, 1U, REG_DEC, 0x81U);
+	HandlerCalls = 0U;
+	SimWrites = 0U;
+	(void)XRFdc_IntrDemuxHandler(0U, &RFdcInst);
+
+	/* One status handler call for the pair, one write per register */
+	CHECK((HandlerCalls == 1U) && (HandlerType == XRFDC_ADC_TILE) &&
+	      (HandlerTile == 0U) && (HandlerBlock == XRFDC_BLK_ID0),
+			"pair not reported once");
+	CHECK(HandlerEvent == (XRFDC_ADC_OVR_VOLTAGE_MASK |
+			XRFDC_ADC_OVR_RANGE_MASK | 0x3U |
+			(0x81U << XRFDC_ADC_SUBADC_DCDR_SHIFT)),
+			"wrong status event");
+	CHECK(SimWrites == 3U, "not one write per status register");
+	CHECK(XRFdc_GetIntrBlockStats(&RFdcInst, XRFDC_ADC_TILE, 0U,
+			XRFDC_BLK_ID0, &BlockStats) == XRFDC_SUCCESS,
+			"no statistics");
+	CHECK((BlockStats.Events == 1U) && (BlockStats.OverVoltage == 1U) &&
+	      (BlockStats.OverRange == 1U) && (BlockStats.FifoInterface == 1U) &&
+	      (BlockStats.Decoder == 1U) && (BlockStats.DataPath == 0U) &&
+	      (BlockStats.LastStatus == HandlerEvent), "wrong statistics");
+	CHECK((Stats.Interrupts == 1U) && (Stats.Spurious == 0U),
+			"wrong interrupt count");
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the common tile interrupt and the spurious calls.
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int TestCommon(void)
+{
+	XRFdc_Intr_Block_Stats BlockStats;
+	u32 Block;
+
+	CHECK(XRFdcModel_Init(&RFdcInst, 0U) == XRFDC_SUCCESS, "init");
+	XRFdc_SetStatusHandler(&RFdcInst, NULL, StatusHandler);
+	XRFdc_SetIntrStats(&RFdcInst, &Stats);
+	SimInit();
+
+	/* Only the common interrupt of DAC 2 */
+	SimSetCommon(XRFDC_DAC_TILE, 2U, 1U);
+	HandlerCalls = 0U;
+	(void)XRFdc_IntrDemuxHandler(0U, &RFdcInst);
+	CHECK((HandlerCalls == 1U) && (HandlerType == XRFDC_DAC_TILE) &&
+	      (HandlerTile == 2U) && (HandlerBlock == (u32)XRFDC_BLK_ID_NONE) &&
+	      (HandlerEvent == XRFDC_COMMON_MASK),
+			"common interrupt not reported");
+	CHECK(Stats.Common[XRFDC_DAC_TILE][2] == 1U,
+			"common interrupt not counted");
+	for (Block = XRFDC_BLK_ID0; Block < XRFDC_NUM_OF_BLKS4; Block++) {
+		(void)XRFdc_GetIntrBlockStats(&RFdcInst, XRFDC_DAC_TILE, 2U,
+				Block, &BlockStats);
+		CHECK(BlockStats.Events == 0U, "common counted as a block");
+	}
+
+	/* The common interrupt with a block event is counted once */
+	SimRaise(XRFDC_DAC_TILE, 2U, 1U, REG_CONV, XRFDC_INTR_FIFO_OVR_MASK);
+	HandlerCalls = 0U;
+	(void)XRFdc_IntrDemuxHandler(0U, &RFdcInst);
+	CHECK((HandlerCalls == 1U) && (HandlerBlock == XRFDC_BLK_ID1) &&
+	      ((HandlerEvent & XRFDC_COMMON_MASK) != 0U),
+			"common interrupt not given with the block");
+	CHECK(Stats.Common[XRFDC_DAC_TILE][2] == 2U,
+			"common interrupt not counted with the block");
+
+	/* Nothing pending */
+	SimSetCommon(XRFDC_DAC_TILE, 2U, 0U);
+	HandlerCalls = 0U;
+	(void)XRFdc_IntrDemuxHandler(0U, &RFdcInst);
+	CHECK((HandlerCalls == 0U) && (Stats.Spurious == 1U) &&
+	      (Stats.Interrupts == 3U), "spurious call not counted");
+
+	printf("Common tile interrupt: %u calls, %u spurious\r\n",
+		Stats.Interrupts, Stats.Spurious);
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the statistics of random blocks while the source
+* thread raises and services random events.
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int TestThreads(void)
+{
+	XRFdc_Intr_Block_Stats BlockStats;
+	u32 LastEvents[2][4][4];
+	struct timespec Start;
+	struct timespec End;
+	pthread_t Thread;
+	u32 Snapshots = 0U;
+	u32 Type;
+	u32 Tile;
+	u32 Block;
+	u32 Sum;
+	double Time;
+
+	CHECK(XRFdcModel_Init(&RFdcInst, 0U) == XRFDC_SUCCESS, "init");
+	XRFdc_SetStatusHandler(&RFdcInst, NULL, StatusHandler);
+	XRFdc_SetIntrStats(&RFdcInst, &Stats);
+	SimInit();
+	memset(Expected, 0, sizeof(Expected));
+	memset(LastEvents, 0, sizeof(LastEvents));
+	SourceDone = 0U;
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	CHECK(pthread_create(&Thread, NULL, SourceThread, NULL) == 0,
+			"no source thread");
+	while (SourceDone == 0U) {
+		/* A block of every type and tile in turn */
+		Type = Snapshots & 1U;
+		Tile = (Snapshots >> 1U) & 3U;
+		Block = (Snapshots >> 3U) & 3U;
+		(void)XRFdc_GetIntrBlockStats(&RFdcInst, Type, Tile, Block,
+				&BlockStats);
+		Sum = BlockStats.OverVoltage + BlockStats.OverRange +
+			BlockStats.CommonMode + BlockStats.ConvOverflow +
+			BlockStats.FifoInterface + BlockStats.Decoder +
+			BlockStats.DataPath;
+		if (((BlockStats.Sequence & 1U) != 0U) ||
+		    (BlockStats.Events != Sum) ||
+		    (BlockStats.Events < LastEvents[Type][Tile][Block])) {
+			SourceDone = 1U;
+			(void)pthread_join(Thread, NULL);
+			CHECK(0, "inconsistent snapshot");
+		}
+		LastEvents[Type][Tile][Block] = BlockStats.Events;
+		Snapshots++;
+	}
+	(void)pthread_join(Thread, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	Time = (double)(End.tv_sec - Start.tv_sec) +
+		((double)(End.tv_nsec - Start.tv_nsec) / 1e9);
+
+	CHECK(SimPending() == 0U, "events left pending");
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			for (Block = 0U; Block < XRFDC_NUM_OF_BLKS4; Block++) {
+				(void)XRFdc_GetIntrBlockStats(&RFdcInst, Type,
+						Tile, Block, &BlockStats);
+				Expected[Type][Tile][Block].Sequence =
+					BlockStats.Sequence;
+				Expected[Type][Tile][Block].LastStatus =
+					BlockStats.LastStatus;
+				Expected[Type][Tile][Block].LastTimestamp =
+					BlockStats.LastTimestamp;
+				CHECK(memcmp(&BlockStats,
+					&Expected[Type][Tile][Block],
+					sizeof(BlockStats)) == 0,
+					"counters differ from the events");
+			}
+		}
+	}
+	CHECK(Stats.Interrupts == NUM_EVENTS, "interrupts lost");
+
+	printf("Source thread: %u events in %.1f ms, %u snapshots read\r\n",
+		NUM_EVENTS, Time * 1e3, Snapshots);
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the source thread. It raises one random event at a time
+* and services it, as the interrupt of the IP would.
+*
+* @param	Arg is not used.
+*
+* @return	NULL
+*
+******************************************************************************/
+static void *SourceThread(void *Arg)
+{
+	const SimEvent *EventPtr;
+	u32 Type;
+	u32 Tile;
+	u32 Slice;
+	u32 Bit;
+	u32 Index;
+
+	(void)Arg;
+	for (Index = 0U; (Index < NUM_EVENTS) && (SourceDone == 0U); Index++) {
+		Type = Random(2U);
+		Tile = Random(XRFDC_NUM_OF_TILES4);
+		Slice = Random(XRFDC_NUM_OF_BLKS4);
+		if (Type == XRFDC_ADC_TILE) {
+			EventPtr = &AdcEvents[Random(sizeof(AdcEvents) /
+					sizeof(AdcEvents[0]))];
+		} else {
+			EventPtr = &DacEvents[Random(sizeof(DacEvents) /
+					sizeof(DacEvents[0]))];
+		}
+		do {
+			Bit = 1U << Random(32U);
+		} while ((EventPtr->Bits & Bit) == 0U);
+
+		SimRaise(Type, Tile, Slice, EventPtr->Reg, Bit);
+		Expected[Type][Tile][Slice].Events++;
+		(*Counter(&Expected[Type][Tile][Slice], EventPtr->Category))++;
+		(void)XRFdc_IntrDemuxHandler(0U, &RFdcInst);
+	}
+	SourceDone = 1U;
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the simulated source and sets its write hook.
+*
+* @return	None
+*
+******************************************************************************/
+static void SimInit(void)
+{
+	memset(Common, 0, sizeof(Common));
+	SimWrites = 0U;
+	SimStaleWrites = 0U;
+	XRFdcModel_SetWriteHook(SimWriteHook);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the offset of a status register of a slice.
+*
+* @param	Type is ADC or DAC.
+* @param	Tile_Id is the tile.
+* @param	Slice is the converter slice.
+* @param	Reg is the status register.
+*
+* @return	The offset, 0 for a register the slice does not have.
+*
+******************************************************************************/
+static u32 SimRegOffset(u32 Type, u32 Tile_Id, u32 Slice, u32 Reg)
+{
+	u32 BaseAddr;
+
+	if (Reg == REG_CONV) {
+		return XRFDC_CTRL_STS_BASE(Type, Tile_Id) +
+			XRFDC_CONV_INTR_STS(Slice);
+	}
+
+	if (Type == XRFDC_ADC_TILE) {
+		BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id) +
+			XRFDC_BLOCK_ADDR_OFFSET(Slice);
+		switch (Reg) {
+		case REG_FABRIC:
+			return BaseAddr + XRFDC_ADC_FABRIC_ISR_OFFSET;
+		case REG_OBS:
+			return BaseAddr + XRFDC_ADC_FABRIC_ISR_OBS_OFFSET;
+		case REG_DEC:
+			return BaseAddr + XRFDC_ADC_DEC_ISR_OFFSET;
+		default:
+			return BaseAddr + XRFDC_DATPATH_ISR_OFFSET;
+		}
+	}
+
+	BaseAddr = XRFDC_DAC_TILE_DRP_ADDR(Tile_Id) +
+		XRFDC_BLOCK_ADDR_OFFSET(Slice);
+	switch (Reg) {
+	case REG_FABRIC:
+		return BaseAddr + XRFDC_DAC_FABRIC_ISR_OFFSET;
+	case REG_DATPATH:
+		return BaseAddr + XRFDC_DATPATH_ISR_OFFSET;
+	default:
+		return 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the width of a status register.
+*
+* @param	Reg is the status register.
+*
+* @return	The width in bytes.
+*
+******************************************************************************/
+static int SimRegWidth(u32 Reg)
+{
+	return (Reg == REG_CONV) ? 4 : 2;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function raises status bits of a slice.
+*
+* @param	Type is ADC or DAC.
+* @param	Tile_Id is the tile.
+* @param	Slice is the converter slice.
+* @param	Reg is the status register.
+* @param	Bits are the status bits to raise.
+*
+* @return	None
+*
+******************************************************************************/
+static void SimRaise(u32 Type, u32 Tile_Id, u32 Slice, u32 Reg, u32 Bits)
+{
+	u32 Offset = SimRegOffset(Type, Tile_Id, Slice, Reg);
+	int Width = SimRegWidth(Reg);
+
+	XRFdcModel_Store(Offset, XRFdcModel_Read(Offset, Width) | Bits, Width);
+	SimUpdate();
+}
+
+/*****************************************************************************/
+/**
+*
+* This function raises or lowers the common interrupt of a tile. The
+* interrupt is not cleared by the driver.
+*
+* @param	Type is ADC or DAC.
+* @param	Tile_Id is the tile.
+* @param	Pending is 1 to raise the interrupt, 0 to lower it.
+*
+* @return	None
+*
+******************************************************************************/
+static void SimSetCommon(u32 Type, u32 Tile_Id, u32 Pending)
+{
+	Common[Type][Tile_Id] = Pending;
+	SimUpdate();
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the summary bits of the tiles and of the IP from
+* the status registers of the slices.
+*
+* @return	None
+*
+******************************************************************************/
+static void SimUpdate(void)
+{
+	u32 CommonSts = 0U;
+	u32 TileSts;
+	u32 Offset;
+	u32 Type;
+	u32 Tile;
+	u32 Slice;
+	u32 Reg;
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			TileSts = (Common[Type][Tile] != 0U) ?
+				XRFDC_INTR_COMMON_MASK : 0U;
+			for (Slice = 0U; Slice < XRFDC_NUM_OF_BLKS4; Slice++) {
+				for (Reg = 0U; Reg < NUM_REGS; Reg++) {
+					Offset = SimRegOffset(Type, Tile,
+							Slice, Reg);
+					if ((Offset != 0U) &&
+					    (XRFdcModel_Read(Offset,
+						SimRegWidth(Reg)) != 0U)) {
+						TileSts |=
+						XRFDC_EN_INTR_SLICE0_MASK <<
+							Slice;
+					}
+				}
+			}
+			XRFdcModel_Store(XRFDC_CTRL_STS_BASE(Type, Tile) +
+					XRFDC_INTR_STS, TileSts, 2);
+			if (TileSts != 0U) {
+				CommonSts |= ((Type == XRFDC_ADC_TILE) ?
+					XRFDC_EN_INTR_ADC_TILE0_MASK :
+					XRFDC_EN_INTR_DAC_TILE0_MASK) << Tile;
+			}
+		}
+	}
+	XRFdcModel_Store(XRFDC_COMMON_INTR_STS, CommonSts, 2);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the pending tiles of the IP.
+*
+* @return	The common interrupt status.
+*
+******************************************************************************/
+static u32 SimPending(void)
+{
+	return XRFdcModel_Read(XRFDC_COMMON_INTR_STS, 2);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the write hook of the model. The status registers of the
+* slices are write one to clear, the other registers store the value.
+*
+* @param	Offset is the offset of the register.
+* @param	Value is the value written.
+* @param	Width is the width of the access in bytes.
+*
+* @return	1 for a status register, 0 otherwise.
+*
+******************************************************************************/
+static int SimWriteHook(u32 Offset, u32 Value, int Width)
+{
+	u32 Old;
+	u32 Type;
+	u32 Tile;
+	u32 Slice;
+	u32 Reg;
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile < XRFDC_NUM_OF_TILES4; Tile++) {
+			for (Slice = 0U; Slice < XRFDC_NUM_OF_BLKS4; Slice++) {
+				for (Reg = 0U; Reg < NUM_REGS; Reg++) {
+					if (SimRegOffset(Type, Tile, Slice,
+							Reg) == Offset) {
+						goto FOUND;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+
+FOUND:
+	Old = XRFdcModel_Read(Offset, Width);
+	if ((Value & ~Old) != 0U) {
+		SimStaleWrites++;
+	}
+	XRFdcModel_Store(Offset, Old & ~Value, Width);
+	SimWrites++;
+	SimUpdate();
+
+	return 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the status handler of the driver. It keeps the last call.
+*
+* @param	CallBackRef is not used.
+* @param	Type is ADC or DAC.
+* @param	Tile_Id is the tile.
+* @param	Block_Id is the block.
+* @param	StatusEvent is the interrupt mask.
+*
+* @return	None
+*
+******************************************************************************/
+static void StatusHandler(void *CallBackRef, u32 Type, u32 Tile_Id,
+		u32 Block_Id, u32 StatusEvent)
+{
+	(void)CallBackRef;
+	HandlerCalls++;
+	HandlerType = Type;
+	HandlerTile = Tile_Id;
+	HandlerBlock = Block_Id;
+	HandlerEvent = StatusEvent;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the counter of a category in block statistics.
+*
+* @param	StatsPtr is the statistics of the block.
+* @param	Category is the category.
+*
+* @return	The counter.
+*
+******************************************************************************/
+static u32 *Counter(XRFdc_Intr_Block_Stats *StatsPtr, u32 Category)
+{
+	switch (Category) {
+	case CAT_OVR_VOLTAGE:
+		return &StatsPtr->OverVoltage;
+	case CAT_OVR_RANGE:
+		return &StatsPtr->OverRange;
+	case CAT_CMODE:
+		return &StatsPtr->CommonMode;
+	case CAT_CONV_OVR:
+		return &StatsPtr->ConvOverflow;
+	case CAT_FIFO:
+		return &StatsPtr->FifoInterface;
+	case CAT_DECODER:
+		return &StatsPtr->Decoder;
+	default:
+		return &StatsPtr->DataPath;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns a pseudo random number, the sequence is the same on
+* every run.
+*
+* @param	Range is the number of values.
+*
+* @return	A number from 0 to Range - 1.
+*
+******************************************************************************/
+static u32 Random(u32 Range)
+{
+	Seed = (Seed * 1103515245U) + 12345U;
+
+	return (Seed >> 8U) % Range;
+}
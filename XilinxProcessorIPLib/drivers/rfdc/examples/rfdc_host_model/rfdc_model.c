@@ -0,0 +1,349 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_model.c
+*
+* This file contains the host register model of the RFdc IP. Please see
+* rfdc_model.h for more details.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include "rfdc_model.h"
+#include <metal/sys.h>
+
+/************************** Constant Definitions *****************************/
+#define XRFDC_MODEL_BASE_ADDR	0xA0000000U	/* Physical address given to
+						   the driver */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static uint64_t XRFdcModel_IoRead(struct metal_io_region *io,
+		unsigned long offset, memory_order order, int width);
+static void XRFdcModel_IoWrite(struct metal_io_region *io,
+		unsigned long offset, uint64_t value, memory_order order,
+		int width);
+
+/************************** Variable Definitions *****************************/
+static u8 Regs[XRFDC_REGION_SIZE] __attribute__ ((aligned (8)));
+static struct metal_io_region Io;
+static metal_phys_addr_t Phys = XRFDC_MODEL_BASE_ADDR;
+static XRFdc_Config Config;
+static XRFdcModel_WriteHook WriteHook;
+static XRFdcModel_TimeHook TimeHook;
+static u32 Writes;
+static u64 Now;			/* Time of the model, us */
+
+static const struct metal_io_ops IoOps = {
+	.read = XRFdcModel_IoRead,
+	.write = XRFdcModel_IoWrite,
+};
+
+/*****************************************************************************/
+/**
+*
+* This function initializes libmetal, the register space and the driver
+* instance.
+*
+* @param	InstancePtr is the driver instance.
+* @param	HighSpeedAdc is non zero for high speed (two block) ADC tiles,
+*		0 for quad ADC tiles.
+*
+* @return	XRFDC_SUCCESS if the instance is initialized, XRFDC_FAILURE
+*		otherwise.
+*
+******************************************************************************/
+int XRFdcModel_Init(XRFdc *InstancePtr, u32 HighSpeedAdc)
+{
+	struct metal_init_params Params = METAL_INIT_DEFAULTS;
+	u32 Tile;
+	u32 Block;
+
+	/* The tests check failures on purpose, only report critical errors */
+	Params.log_level = METAL_LOG_CRITICAL;
+	if (metal_init(&Params) != 0) {
+		return XRFDC_FAILURE;
+	}
+
+	memset(Regs, 0, sizeof(Regs));
+	metal_io_init(&Io, Regs, &Phys, sizeof(Regs), (unsigned int)(-1), 0,
+			&IoOps);
+
+	XRFdcModel_Store(XRFDC_IP_BASE + XRFDC_TILES_ENABLED_OFFSET, 0xFFU, 4);
+	XRFdcModel_Store(XRFDC_IP_BASE + XRFDC_ADC_PATHS_ENABLED_OFFSET,
+			0xFFFFFFFFU, 4);
+	XRFdcModel_Store(XRFDC_IP_BASE + XRFDC_DAC_PATHS_ENABLED_OFFSET,
+			0xFFFFFFFFU, 4);
+
+	memset(&Config, 0, sizeof(Config));
+	Config.BaseAddr = XRFDC_MODEL_BASE_ADDR;
+	Config.ADCType = (HighSpeedAdc != 0U) ? 1U : 0U;
+	Config.IPType = XRFDC_GEN3;
+	for (Tile = 0U; Tile <= XRFDC_TILE_ID_MAX; Tile++) {
+		Config.ADCTile_Config[Tile].Enable = 1U;
+		Config.ADCTile_Config[Tile].SamplingRate = XRFDC_MODEL_ADC_RATE;
+		Config.ADCTile_Config[Tile].NumSlices = (HighSpeedAdc != 0U) ?
+				XRFDC_NUM_SLICES_HSADC : XRFDC_NUM_SLICES_LSADC;
+		Config.DACTile_Config[Tile].Enable = 1U;
+		Config.DACTile_Config[Tile].SamplingRate = XRFDC_MODEL_DAC_RATE;
+		Config.DACTile_Config[Tile].NumSlices = 4U;
+		for (Block = 0U; Block <= XRFDC_BLOCK_ID_MAX; Block++) {
+			Config.ADCTile_Config[Tile].ADCBlock_Digital_Config[Block]
+				.MixerType = XRFDC_MIXER_TYPE_FINE;
+			Config.DACTile_Config[Tile].DACBlock_Digital_Config[Block]
+				.MixerType = XRFDC_MIXER_TYPE_FINE;
+		}
+	}
+
+	memset(InstancePtr, 0, sizeof(XRFdc));
+	InstancePtr->io = &Io;
+	if (XRFdc_CfgInitialize(InstancePtr, &Config) != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+	Writes = 0U;
+	Now = 0U;
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the write hook of the model.
+*
+* @param	Hook is the hook, NULL to store all the writes.
+*
+* @return	None.
+*
+******************************************************************************/
+void XRFdcModel_SetWriteHook(XRFdcModel_WriteHook Hook)
+{
+	WriteHook = Hook;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the time hook of the model.
+*
+* @param	Hook is the hook, NULL if none.
+*
+* @return	None.
+*
+******************************************************************************/
+void XRFdcModel_SetTimeHook(XRFdcModel_TimeHook Hook)
+{
+	TimeHook = Hook;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time of the model, the sum of the sleeps of the
+* driver since XRFdcModel_Init().
+*
+* @return	Time in microseconds.
+*
+******************************************************************************/
+u64 XRFdcModel_GetTime(void)
+{
+	return Now;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a register without going through the driver.
+*
+* @param	Offset is the offset in the register space.
+* @param	Width is the access width in bytes, 1, 2 or 4.
+*
+* @return	Value of the register.
+*
+******************************************************************************/
+u32 XRFdcModel_Read(u32 Offset, int Width)
+{
+	u32 Value = 0U;
+
+	memcpy(&Value, &Regs[Offset], (size_t)Width);
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stores a register value without going through the driver or
+* the write hook, e.g. to raise a status bit.
+*
+* @param	Offset is the offset in the register space.
+* @param	Value is the value.
+* @param	Width is the access width in bytes, 1, 2 or 4.
+*
+* @return	None.
+*
+******************************************************************************/
+void XRFdcModel_Store(u32 Offset, u32 Value, int Width)
+{
+	memcpy(&Regs[Offset], &Value, (size_t)Width);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of register writes done by the driver
+* since the last reset of the counter.
+*
+* @return	Number of writes.
+*
+******************************************************************************/
+u32 XRFdcModel_GetWrites(void)
+{
+	return Writes;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function resets the register write counter.
+*
+* @return	None.
+*
+******************************************************************************/
+void XRFdcModel_ResetWrites(void)
+{
+	Writes = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies the whole register space, XRFDC_REGION_SIZE bytes.
+*
+* @param	BufPtr is the destination.
+*
+* @return	None.
+*
+******************************************************************************/
+void XRFdcModel_Snapshot(u8 *BufPtr)
+{
+	memcpy(BufPtr, Regs, sizeof(Regs));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function restores the register space from a snapshot.
+*
+* @param	BufPtr is the snapshot.
+*
+* @return	None.
+*
+******************************************************************************/
+void XRFdcModel_Restore(const u8 *BufPtr)
+{
+	memcpy(Regs, BufPtr, sizeof(Regs));
+}
+
+/*****************************************************************************/
+/**
+*
+* Read operation of the libmetal I/O region.
+*
+******************************************************************************/
+static uint64_t XRFdcModel_IoRead(struct metal_io_region *io,
+		unsigned long offset, memory_order order, int width)
+{
+	(void)io;
+	(void)order;
+
+	return XRFdcModel_Read((u32)offset, width);
+}
+
+/*****************************************************************************/
+/**
+*
+* Write operation of the libmetal I/O region.
+*
+******************************************************************************/
+static void XRFdcModel_IoWrite(struct metal_io_region *io,
+		unsigned long offset, uint64_t value, memory_order order,
+		int width)
+{
+	(void)io;
+	(void)order;
+
+	Writes++;
+	if ((WriteHook == NULL) ||
+	    (WriteHook((u32)offset, (u32)value, width) == 0)) {
+		XRFdcModel_Store((u32)offset, (u32)value, width);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Timestamp of libmetal, in nanoseconds. The generic system of libmetal has
+* no time source.
+*
+******************************************************************************/
+unsigned long long metal_get_timestamp(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((unsigned long long)Ts.tv_sec * 1000000000ULL) +
+		(unsigned long long)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* BSP functions used by the driver.
+*
+******************************************************************************/
+u32 Xil_AssertStatus;
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+void usleep(ULONG useconds)
+{
+	Now += useconds;
+	if (TimeHook != NULL) {
+		TimeHook(Now);
+	}
+}
+
+void xil_printf(const char8 *Format, ...)
+{
+	va_list Args;
+
+	va_start(Args, Format);
+	(void)vprintf(Format, Args);
+	va_end(Args);
+}
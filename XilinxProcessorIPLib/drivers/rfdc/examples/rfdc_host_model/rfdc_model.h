@@ -0,0 +1,82 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_model.h
+*
+* This file contains the host register model of the RFdc IP, used to run the
+* unmodified rfdc driver on the host.
+*
+* The register space is RAM, given to the driver as a libmetal I/O region
+* with metal_io_init(). Every register access of the driver goes through the
+* read and write operations of the region, so the model counts the writes and
+* lets a test give its own behaviour to some registers with a write hook,
+* e.g. write one to clear interrupt status registers.
+*
+* The converter is a Gen 3 IP with the four ADC and the four DAC tiles
+* enabled. The ADC tiles are high speed (two blocks) or quad (four blocks)
+* tiles, all the blocks use the fine mixer.
+*
+* The usleep() called by the driver does not sleep, it advances the time of
+* the model and calls the time hook, so a test can make registers change
+* over time, e.g. the state machine of the tiles, and measure the time the
+* driver waits for them.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef RFDC_MODEL_H_
+#define RFDC_MODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xrfdc.h"
+
+/************************** Constant Definitions *****************************/
+#define XRFDC_MODEL_ADC_RATE	4.0	/**< ADC sampling rate, GHz */
+#define XRFDC_MODEL_DAC_RATE	6.4	/**< DAC sampling rate, GHz */
+
+/**************************** Type Definitions *******************************/
+/**
+* Write hook of the model. Called for every register write of the driver
+* with the offset in the register space, returns non zero when the write is
+* handled by the hook, 0 to store the value.
+*/
+typedef int (*XRFdcModel_WriteHook)(u32 Offset, u32 Value, int Width);
+
+/**
+* Time hook of the model. Called when the driver sleeps, with the time of
+* the model in microseconds once the sleep is over.
+*/
+typedef void (*XRFdcModel_TimeHook)(u64 Now);
+
+/************************** Function Prototypes ******************************/
+int XRFdcModel_Init(XRFdc *InstancePtr, u32 HighSpeedAdc);
+void XRFdcModel_SetWriteHook(XRFdcModel_WriteHook Hook);
+void XRFdcModel_SetTimeHook(XRFdcModel_TimeHook Hook);
+u64 XRFdcModel_GetTime(void);
+u32 XRFdcModel_Read(u32 Offset, int Width);
+void XRFdcModel_Store(u32 Offset, u32 Value, int Width);
+u32 XRFdcModel_GetWrites(void);
+void XRFdcModel_ResetWrites(void);
+void XRFdcModel_Snapshot(u8 *BufPtr);
+void XRFdcModel_Restore(const u8 *BufPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RFDC_MODEL_H_ */
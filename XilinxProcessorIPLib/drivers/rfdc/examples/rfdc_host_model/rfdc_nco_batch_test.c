@@ -0,0 +1,264 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_nco_batch_test.c
+*
+* This file tests the NCO batch retune API of the rfdc driver on the host,
+* with the register space of the IP given to the driver as a libmetal I/O
+* region on RAM. The test is built with a batch of three blocks.
+*
+* - A block of a high speed ADC tile stages both blocks of its pair, and
+*   staging the pair again replaces its entries.
+* - A high speed ADC pair which does not fit in the batch is refused, and
+*   none of its blocks is staged.
+* - A block of a quad ADC tile stages only that block.
+* - The commit writes the staged words of every block, issues one update
+*   event per tile, counts its register writes and updates the instance.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include "rfdc_model.h"
+
+/************************** Constant Definitions *****************************/
+#define FREQ_1		100.0	/* MHz */
+#define FREQ_2		-250.0	/* MHz */
+#define FREQ_3		300.0	/* MHz */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XRFDC_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int TestHighSpeedPair(void);
+static int TestQuadBlock(void);
+static const XRFdc_NCO_Stage *FindStage(const XRFdc_NCO_Batch *BatchPtr,
+		u32 Type, u32 Tile_Id, u32 Block_Id);
+static u32 CheckWords(const XRFdc_NCO_Stage *StagePtr);
+
+/************************** Variable Definitions *****************************/
+static XRFdc RFdcInst;
+static XRFdc_NCO_Batch Batch;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	if ((TestHighSpeedPair() != XRFDC_SUCCESS) ||
+	    (TestQuadBlock() != XRFDC_SUCCESS)) {
+		return 1;
+	}
+
+	printf("Successfully ran NCO batch test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the staging of the high speed ADC pairs and the
+* commit of the batch.
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int TestHighSpeedPair(void)
+{
+	const XRFdc_NCO_Stage *Blk2;
+	const XRFdc_NCO_Stage *Blk3;
+	const XRFdc_NCO_Stage *Dac;
+	u16 FreqWord;
+	u32 Status;
+
+	CHECK(XRFdcModel_Init(&RFdcInst, 1U) == XRFDC_SUCCESS, "init");
+	XRFdc_NCOBatchReset(&Batch);
+
+	/* Block 1 of a high speed tile is the pair of blocks 2 and 3 */
+	Status = XRFdc_NCOBatchAdd(&RFdcInst, &Batch, XRFDC_ADC_TILE, 1U,
+			XRFDC_BLK_ID1, FREQ_1, 0.0);
+	CHECK(Status == XRFDC_SUCCESS, "pair not staged");
+	Blk2 = FindStage(&Batch, XRFDC_ADC_TILE, 1U, XRFDC_BLK_ID2);
+	Blk3 = FindStage(&Batch, XRFDC_ADC_TILE, 1U, XRFDC_BLK_ID3);
+	CHECK((Batch.NumStaged == 2U) && (Blk2 != NULL) && (Blk3 != NULL),
+			"pair staged partially");
+	CHECK((Blk2->FreqWord[0] == Blk3->FreqWord[0]) &&
+	      (Blk2->FreqWord[1] == Blk3->FreqWord[1]) &&
+	      (Blk2->FreqWord[2] == Blk3->FreqWord[2]),
+			"blocks of the pair differ");
+	FreqWord = Blk2->FreqWord[1];
+
+	/* Staging the pair again replaces its entries */
+	Status = XRFdc_NCOBatchAdd(&RFdcInst, &Batch, XRFDC_ADC_TILE, 1U,
+			XRFDC_BLK_ID1, FREQ_2, 45.0);
+	CHECK((Status == XRFDC_SUCCESS) && (Batch.NumStaged == 2U),
+			"pair not replaced");
+	CHECK((Blk2->FreqWord[1] != FreqWord) &&
+	      (Blk3->FreqWord[1] == Blk2->FreqWord[1]) &&
+	      (Blk3->Freq == FREQ_2), "pair entries not updated");
+
+	/* One free entry left, the next pair must be refused as a whole */
+	Status = XRFdc_NCOBatchAdd(&RFdcInst, &Batch, XRFDC_ADC_TILE, 0U,
+			XRFDC_BLK_ID0, FREQ_3, 0.0);
+	CHECK(Status == XRFDC_FAILURE, "full batch accepted a pair");
+	CHECK((Batch.NumStaged == 2U) &&
+	      (FindStage(&Batch, XRFDC_ADC_TILE, 0U, XRFDC_BLK_ID0) == NULL) &&
+	      (FindStage(&Batch, XRFDC_ADC_TILE, 0U, XRFDC_BLK_ID1) == NULL) &&
+	      ((Batch.TileMask[XRFDC_ADC_TILE] & 0x1U) == 0U),
+			"refused pair left a block in the batch");
+
+	/* The free entry is still available to a single block */
+	Status = XRFdc_NCOBatchAdd(&RFdcInst, &Batch, XRFDC_DAC_TILE, 2U,
+			XRFDC_BLK_ID3, FREQ_3, 0.0);
+	CHECK((Status == XRFDC_SUCCESS) && (Batch.NumStaged == 3U),
+			"DAC block not staged");
+
+	/* The commit writes the three blocks and one event per tile */
+	Dac = FindStage(&Batch, XRFDC_DAC_TILE, 2U, XRFDC_BLK_ID3);
+	CHECK(Dac != NULL, "DAC block lost");
+	CHECK((CheckWords(Blk2) == 0U) && (CheckWords(Blk3) == 0U) &&
+	      (CheckWords(Dac) == 0U), "words written before the commit");
+	XRFdcModel_ResetWrites();
+	Status = XRFdc_NCOBatchCommit(&RFdcInst, &Batch);
+	CHECK(Status == XRFDC_SUCCESS, "commit failed");
+	CHECK((CheckWords(Blk2) == 1U) && (CheckWords(Blk3) == 1U) &&
+	      (CheckWords(Dac) == 1U), "staged words not written");
+	CHECK(XRFdcModel_Read(XRFDC_ADC_TILE_DRP_ADDR(1U) + XRFDC_HSCOM_ADDR +
+			XRFDC_HSCOM_UPDT_DYN_OFFSET, 2) == 1U,
+			"no ADC update event");
+	CHECK(XRFdcModel_Read(XRFDC_DAC_TILE_DRP_ADDR(2U) + XRFDC_HSCOM_ADDR +
+			XRFDC_HSCOM_UPDT_DYN_OFFSET, 2) == 1U,
+			"no DAC update event");
+	CHECK(XRFdcModel_Read(XRFDC_ADC_TILE_DRP_ADDR(0U) + XRFDC_HSCOM_ADDR +
+			XRFDC_HSCOM_UPDT_DYN_OFFSET, 2) == 0U,
+			"event on the tile of the refused pair");
+	CHECK((Batch.Stats.Events == 2U) &&
+	      (Batch.Stats.RegWrites == XRFdcModel_GetWrites()),
+			"wrong commit statistics");
+	CHECK((Batch.NumStaged == 0U) && (Batch.Stats.Commits == 1U),
+			"batch not emptied");
+	CHECK((RFdcInst.ADC_Tile[1].ADCBlock_Digital_Datapath[XRFDC_BLK_ID2]
+			.Mixer_Settings.Freq == FREQ_2) &&
+	      (RFdcInst.ADC_Tile[1].ADCBlock_Digital_Datapath[XRFDC_BLK_ID3]
+			.Mixer_Settings.Freq == FREQ_2) &&
+	      (RFdcInst.DAC_Tile[2].DACBlock_Digital_Datapath[XRFDC_BLK_ID3]
+			.Mixer_Settings.Freq == FREQ_3), "instance not updated");
+
+	printf("High speed ADC pairs: %u writes, %u events\r\n",
+		Batch.Stats.RegWrites, Batch.Stats.Events);
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks that a block of a quad ADC tile is staged alone.
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int TestQuadBlock(void)
+{
+	u32 Status;
+
+	CHECK(XRFdcModel_Init(&RFdcInst, 0U) == XRFDC_SUCCESS, "init");
+	XRFdc_NCOBatchReset(&Batch);
+
+	Status = XRFdc_NCOBatchAdd(&RFdcInst, &Batch, XRFDC_ADC_TILE, 3U,
+			XRFDC_BLK_ID1, FREQ_1, 0.0);
+	CHECK((Status == XRFDC_SUCCESS) && (Batch.NumStaged == 1U) &&
+	      (FindStage(&Batch, XRFDC_ADC_TILE, 3U, XRFDC_BLK_ID1) != NULL),
+			"quad ADC block not staged alone");
+
+	Status = XRFdc_NCOBatchCommit(&RFdcInst, &Batch);
+	CHECK((Status == XRFDC_SUCCESS) && (Batch.Stats.Events == 1U),
+			"quad ADC block not committed");
+
+	printf("Quad ADC block: %u writes, %u events\r\n",
+		Batch.Stats.RegWrites, Batch.Stats.Events);
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks for the entry of a block in a batch.
+*
+* @param	BatchPtr is the batch.
+* @param	Type is ADC or DAC.
+* @param	Tile_Id is the tile.
+* @param	Block_Id is the block.
+*
+* @return	The entry, NULL if the block is not staged.
+*
+******************************************************************************/
+static const XRFdc_NCO_Stage *FindStage(const XRFdc_NCO_Batch *BatchPtr,
+		u32 Type, u32 Tile_Id, u32 Block_Id)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < BatchPtr->NumStaged; Index++) {
+		if ((BatchPtr->Stage[Index].Type == Type) &&
+		    (BatchPtr->Stage[Index].Tile_Id == Tile_Id) &&
+		    (BatchPtr->Stage[Index].Block_Id == Block_Id)) {
+			return &BatchPtr->Stage[Index];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares the NCO registers of a block with its staged words.
+* The entry is read before the commit empties the batch, the batch array
+* keeps its contents.
+*
+* @param	StagePtr is the entry of the block.
+*
+* @return	1 if the registers hold the staged words, 0 otherwise.
+*
+******************************************************************************/
+static u32 CheckWords(const XRFdc_NCO_Stage *StagePtr)
+{
+	u32 BaseAddr = StagePtr->BaseAddr;
+
+	return ((XRFdcModel_Read(BaseAddr + XRFDC_ADC_NCO_FQWD_LOW_OFFSET, 2) ==
+			StagePtr->FreqWord[0]) &&
+		(XRFdcModel_Read(BaseAddr + XRFDC_ADC_NCO_FQWD_MID_OFFSET, 2) ==
+			StagePtr->FreqWord[1]) &&
+		(XRFdcModel_Read(BaseAddr + XRFDC_ADC_NCO_FQWD_UPP_OFFSET, 2) ==
+			StagePtr->FreqWord[2]) &&
+		(XRFdcModel_Read(BaseAddr + XRFDC_NCO_PHASE_LOW_OFFSET, 2) ==
+			StagePtr->PhaseWord[0]) &&
+		(XRFdcModel_Read(BaseAddr + XRFDC_NCO_PHASE_UPP_OFFSET, 2) ==
+			StagePtr->PhaseWord[1])) ? 1U : 0U;
+}
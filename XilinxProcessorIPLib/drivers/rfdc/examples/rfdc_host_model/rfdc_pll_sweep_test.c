@@ -0,0 +1,313 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_pll_sweep_test.c
+*
+* This file tests the PLL frequency plan cache of the rfdc driver on the host.
+* XRFdc_DynamicPLLConfig() is called over a sweep of sampling rates for an
+* ADC and a DAC tile, every call starting from the same register state.
+*
+* - The reference sweep runs without a cache and records the register space
+*   and the PLL settings of the instance after each rate.
+* - With an empty cache every rate is configured twice, a miss then a hit,
+*   and both must give the reference result.
+* - With a table computed offline by XRFdc_ComputePLLPlan() and given to
+*   XRFdc_PLLPlanCacheInit(), every rate must hit and give the reference
+*   result.
+*
+* The time spent in XRFdc_DynamicPLLConfig() with and without the cache is
+* reported.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <metal/time.h>
+#include "rfdc_model.h"
+
+/************************** Constant Definitions *****************************/
+#define REF_CLK_FREQ	245.76	/* MHz */
+#define ADC_RATE_MIN	1000.0	/* MHz */
+#define ADC_RATE_MAX	4000.0	/* MHz */
+#define ADC_RATE_STEP	7.5	/* MHz */
+#define DAC_RATE_MIN	500.0	/* MHz */
+#define DAC_RATE_MAX	6400.0	/* MHz */
+#define DAC_RATE_STEP	15.0	/* MHz */
+#define MAX_RATES	512U	/* Rates of a sweep */
+
+/**************************** Type Definitions *******************************/
+/* Result of a rate */
+typedef struct {
+	u32 Status;
+	u32 Hash;			/* Hash of the register space */
+	XRFdc_PLL_Settings Settings;	/* PLL settings of the tile */
+} Result;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static int Sweep(u32 Type, double RateMin, double RateMax, double RateStep);
+static void Configure(u32 Type, double Rate, Result *ResultPtr, u64 *TimePtr);
+static int Compare(const Result *ResultPtr, const Result *RefPtr);
+static u32 Hash(const u8 *BufPtr, u32 Len);
+
+/************************** Variable Definitions *****************************/
+static XRFdc RFdcInst;
+static u8 StartRegs[XRFDC_REGION_SIZE];
+static u8 Regs[XRFDC_REGION_SIZE];
+static XRFdc_PLL_Settings StartSettings;
+static double Rates[MAX_RATES];
+static Result Ref[MAX_RATES];
+static XRFdc_PLL_Plan Plans[MAX_RATES];
+static XRFdc_PLL_Plan_Cache Cache;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	if (XRFdcModel_Init(&RFdcInst, 1U) != XRFDC_SUCCESS) {
+		printf("Init failed\r\n");
+		return 1;
+	}
+
+	if (XRFdc_PLLPlanCacheInit(&RFdcInst, &Cache, Plans, MAX_RATES,
+			MAX_RATES + 1U) != XRFDC_FAILURE) {
+		printf("More plans than the table accepted\r\n");
+		return 1;
+	}
+
+	if ((Sweep(XRFDC_ADC_TILE, ADC_RATE_MIN, ADC_RATE_MAX,
+			ADC_RATE_STEP) != XRFDC_SUCCESS) ||
+	    (Sweep(XRFDC_DAC_TILE, DAC_RATE_MIN, DAC_RATE_MAX,
+			DAC_RATE_STEP) != XRFDC_SUCCESS)) {
+		return 1;
+	}
+
+	printf("Successfully ran PLL sweep test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the three sweeps of a tile type on tile 0.
+*
+* @param	Type is ADC or DAC.
+* @param	RateMin is the first sampling rate, MHz.
+* @param	RateMax is the last sampling rate, MHz.
+* @param	RateStep is the step of the sweep, MHz.
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int Sweep(u32 Type, double RateMin, double RateMax, double RateStep)
+{
+	const char *Name = (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC";
+	Result Res;
+	u32 NumRates = 0U;
+	u32 NumValid = 0U;
+	u32 Index;
+	u64 ComputeTime = 0U;
+	u64 MissTime = 0U;
+	u64 HitTime = 0U;
+	u64 LoadTime = 0U;
+
+	/* Reference clock divider of 1, tile powered down */
+	XRFdcModel_Store(XRFDC_DRP_BASE(Type, 0U) + XRFDC_HSCOM_ADDR +
+			XRFDC_PLL_REFDIV, XRFDC_REFCLK_DIV_1_MASK, 2);
+	XRFdcModel_Snapshot(StartRegs);
+	StartSettings = (Type == XRFDC_ADC_TILE) ?
+			RFdcInst.ADC_Tile[0].PLL_Settings :
+			RFdcInst.DAC_Tile[0].PLL_Settings;
+
+	/* Reference, no cache */
+	(void)XRFdc_PLLPlanCacheInit(&RFdcInst, NULL, NULL, 0U, 0U);
+	while ((NumRates < MAX_RATES) &&
+	       ((RateMin + (NumRates * RateStep)) <= RateMax)) {
+		Rates[NumRates] = RateMin + (NumRates * RateStep);
+		Configure(Type, Rates[NumRates], &Ref[NumRates], &ComputeTime);
+		if (Ref[NumRates].Status == XRFDC_SUCCESS) {
+			NumValid++;
+		}
+		NumRates++;
+	}
+	if (NumValid == 0U) {
+		printf("%s: no valid rate\r\n", Name);
+		return XRFDC_FAILURE;
+	}
+
+	/* Empty cache, a miss then a hit per rate */
+	if (XRFdc_PLLPlanCacheInit(&RFdcInst, &Cache, Plans, MAX_RATES, 0U) !=
+			XRFDC_SUCCESS) {
+		printf("%s: cache init failed\r\n", Name);
+		return XRFDC_FAILURE;
+	}
+	for (Index = 0U; Index < NumRates; Index++) {
+		Configure(Type, Rates[Index], &Res, &MissTime);
+		if (Compare(&Res, &Ref[Index]) != XRFDC_SUCCESS) {
+			printf("%s: %.1f MHz differs on a miss\r\n", Name,
+				Rates[Index]);
+			return XRFDC_FAILURE;
+		}
+		Configure(Type, Rates[Index], &Res, &HitTime);
+		if (Compare(&Res, &Ref[Index]) != XRFDC_SUCCESS) {
+			printf("%s: %.1f MHz differs on a hit\r\n", Name,
+				Rates[Index]);
+			return XRFDC_FAILURE;
+		}
+	}
+	if ((Cache.Misses != NumValid) || (Cache.Hits != NumValid) ||
+	    (Cache.NumPlans != NumValid)) {
+		printf("%s: %u misses, %u hits, %u plans for %u rates\r\n",
+			Name, Cache.Misses, Cache.Hits, Cache.NumPlans,
+			NumValid);
+		return XRFDC_FAILURE;
+	}
+
+	/* Table computed offline */
+	memset(Plans, 0, sizeof(Plans));
+	NumValid = 0U;
+	for (Index = 0U; Index < NumRates; Index++) {
+		if (XRFdc_ComputePLLPlan(RFdcInst.RFdc_Config.IPType, Type,
+				REF_CLK_FREQ, Rates[Index],
+				&Plans[NumValid]) == XRFDC_SUCCESS) {
+			NumValid++;
+		}
+	}
+	if (XRFdc_PLLPlanCacheInit(&RFdcInst, &Cache, Plans, MAX_RATES,
+			NumValid) != XRFDC_SUCCESS) {
+		printf("%s: cache load failed\r\n", Name);
+		return XRFDC_FAILURE;
+	}
+	for (Index = 0U; Index < NumRates; Index++) {
+		Configure(Type, Rates[Index], &Res, &LoadTime);
+		if (Compare(&Res, &Ref[Index]) != XRFDC_SUCCESS) {
+			printf("%s: %.1f MHz differs with a loaded plan\r\n",
+				Name, Rates[Index]);
+			return XRFDC_FAILURE;
+		}
+	}
+	if ((Cache.Misses != 0U) || (Cache.Hits != NumValid) ||
+	    (Cache.NumPlans != NumValid)) {
+		printf("%s: loaded table, %u misses, %u hits for %u plans\r\n",
+			Name, Cache.Misses, Cache.Hits, NumValid);
+		return XRFDC_FAILURE;
+	}
+
+	printf("%s: %u rates, %u with a plan, us per call: computed %.2f, "
+		"miss %.2f, hit %.2f, loaded %.2f\r\n", Name, NumRates,
+		NumValid, (double)ComputeTime / NumRates / 1000.0,
+		(double)MissTime / NumRates / 1000.0,
+		(double)HitTime / NumRates / 1000.0,
+		(double)LoadTime / NumRates / 1000.0);
+
+	(void)XRFdc_PLLPlanCacheInit(&RFdcInst, NULL, NULL, 0U, 0U);
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function configures the PLL of tile 0 from the start state and
+* records the result.
+*
+* @param	Type is ADC or DAC.
+* @param	Rate is the sampling rate, MHz.
+* @param	ResultPtr is the result to fill.
+* @param	TimePtr is the time counter, the time of the call is added.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Configure(u32 Type, double Rate, Result *ResultPtr, u64 *TimePtr)
+{
+	XRFdc_PLL_Settings *SettingsPtr = (Type == XRFDC_ADC_TILE) ?
+			&RFdcInst.ADC_Tile[0].PLL_Settings :
+			&RFdcInst.DAC_Tile[0].PLL_Settings;
+	u64 StartTime;
+
+	XRFdcModel_Restore(StartRegs);
+	*SettingsPtr = StartSettings;
+
+	StartTime = metal_get_timestamp();
+	ResultPtr->Status = XRFdc_DynamicPLLConfig(&RFdcInst, Type, 0U,
+			XRFDC_INTERNAL_PLL_CLK, REF_CLK_FREQ, Rate);
+	*TimePtr += metal_get_timestamp() - StartTime;
+
+	XRFdcModel_Snapshot(Regs);
+	ResultPtr->Hash = Hash(Regs, sizeof(Regs));
+	ResultPtr->Settings = *SettingsPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares a result with the reference.
+*
+* @param	ResultPtr is the result.
+* @param	RefPtr is the reference.
+*
+* @return	XRFDC_SUCCESS if they are the same, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int Compare(const Result *ResultPtr, const Result *RefPtr)
+{
+	const XRFdc_PLL_Settings *Set = &ResultPtr->Settings;
+	const XRFdc_PLL_Settings *RefSet = &RefPtr->Settings;
+
+	if ((ResultPtr->Status != RefPtr->Status) ||
+	    (ResultPtr->Hash != RefPtr->Hash) ||
+	    (Set->Enabled != RefSet->Enabled) ||
+	    (Set->RefClkFreq != RefSet->RefClkFreq) ||
+	    (Set->SampleRate != RefSet->SampleRate) ||
+	    (Set->RefClkDivider != RefSet->RefClkDivider) ||
+	    (Set->FeedbackDivider != RefSet->FeedbackDivider) ||
+	    (Set->OutputDivider != RefSet->OutputDivider)) {
+		return XRFDC_FAILURE;
+	}
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the FNV-1a hash of a buffer.
+*
+* @param	BufPtr is the buffer.
+* @param	Len is the length of the buffer in bytes.
+*
+* @return	The hash.
+*
+******************************************************************************/
+static u32 Hash(const u8 *BufPtr, u32 Len)
+{
+	u32 Value = 2166136261U;
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		Value = (Value ^ BufPtr[Index]) * 16777619U;
+	}
+
+	return Value;
+}
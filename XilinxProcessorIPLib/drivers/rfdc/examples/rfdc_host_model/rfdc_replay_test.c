@@ -0,0 +1,242 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file rfdc_replay_test.c
+*
+* This file exercises the register access trace and replay of the rfdc driver
+* on the host. A sequence of API calls, PLL configuration of an ADC and a
+* DAC tile and an NCO retune, is recorded, then replayed on a register space
+* cleared to zero.
+*
+* - The replay of the unchanged sequence has no mismatch, and leaves every
+*   traced register with the recorded value.
+* - A trace with one access moved to another register gives exactly one
+*   mismatch, the replay stays in step with the driver.
+* - A sequence with another sampling rate is detected by the compared write
+*   values, without losing the step.
+*
+* The register reads and writes of every scope of the recording are printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 11.1  ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include "rfdc_model.h"
+
+/************************** Constant Definitions *****************************/
+#define REF_CLK_FREQ	245.76	/* MHz */
+#define ADC_RATE	3000.0	/* MHz */
+#define DAC_RATE	5000.0	/* MHz */
+#define DAC_RATE_ALT	5120.0	/* MHz, rate of the changed sequence */
+#define NCO_FREQ	125.0	/* MHz */
+#define MAX_ENTRIES	4096U	/* Entries of the trace */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond, Msg)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("%s line %d: %s\r\n", __func__,		\
+				__LINE__, (Msg));			\
+			return XRFDC_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes ******************************/
+static int RunTest(void);
+static u32 RunSequence(XRFdc_Trace *TracePtr, double DacRate);
+static int Replay(XRFdc_Trace *TracePtr, double DacRate);
+
+/************************** Variable Definitions *****************************/
+static XRFdc RFdcInst;
+static XRFdc_NCO_Batch Batch;
+static XRFdc_Trace Trace;
+static XRFdc_Trace_Entry Entries[MAX_ENTRIES];
+static u8 Zero[XRFDC_REGION_SIZE];
+static u8 Recorded[XRFDC_REGION_SIZE];
+static u8 Replayed[XRFDC_REGION_SIZE];
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* @return	0 if all the checks pass, 1 otherwise.
+*
+******************************************************************************/
+int main(void)
+{
+	if (RunTest() != XRFDC_SUCCESS) {
+		return 1;
+	}
+
+	printf("Successfully ran replay test\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function records the sequence and runs the replays.
+*
+* @return	XRFDC_SUCCESS if all the checks pass, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int RunTest(void)
+{
+	XRFdc_Trace_Entry *EntryPtr;
+	u32 NumEntries;
+	u32 NumWrites = 0U;
+	u32 Moved;
+	u32 Index;
+
+	/* Record */
+	CHECK(XRFdcModel_Init(&RFdcInst, 1U) == XRFDC_SUCCESS, "init");
+	CHECK(XRFdc_TraceStart(&RFdcInst, &Trace, Entries, MAX_ENTRIES) ==
+			XRFDC_SUCCESS, "trace not started");
+	CHECK(RunSequence(&Trace, DAC_RATE) == XRFDC_SUCCESS,
+			"recorded sequence failed");
+	CHECK(XRFdc_TraceStop(&RFdcInst, &Trace) == XRFDC_SUCCESS,
+			"trace not stopped");
+	CHECK((Trace.Dropped == 0U) && (Trace.NumEntries > 0U),
+			"trace incomplete");
+	NumEntries = Trace.NumEntries;
+	XRFdcModel_Snapshot(Recorded);
+
+	for (Index = 0U; Index < Trace.NumScopes; Index++) {
+		printf("%-12s %u calls, %u reads, %u writes\r\n",
+			Trace.Scope[Index].Name, Trace.Scope[Index].Calls,
+			Trace.Scope[Index].Reads, Trace.Scope[Index].Writes);
+	}
+
+	/* Unchanged sequence */
+	CHECK(Replay(&Trace, DAC_RATE) == XRFDC_SUCCESS, "replay failed");
+	CHECK((Trace.Mismatches == 0U) && (Trace.ReplayIndex == NumEntries),
+			"unchanged sequence mismatches");
+	XRFdcModel_Snapshot(Replayed);
+	for (Index = 0U; Index < NumEntries; Index++) {
+		EntryPtr = &Entries[Index];
+		CHECK(memcmp(&Recorded[EntryPtr->Offset],
+				&Replayed[EntryPtr->Offset],
+				EntryPtr->Width) == 0,
+				"register differs after the replay");
+		if (EntryPtr->Write != 0U) {
+			NumWrites++;
+		}
+	}
+	printf("Unchanged: %u accesses, %u mismatches\r\n", NumEntries,
+		Trace.Mismatches);
+
+	/* One access moved to another register, in the middle of the trace */
+	for (Moved = NumEntries / 2U; Moved < NumEntries; Moved++) {
+		if (Entries[Moved].Write != 0U) {
+			break;
+		}
+	}
+	CHECK(Moved < NumEntries, "no write to move");
+	Entries[Moved].Offset += 4U;
+	CHECK(Replay(&Trace, DAC_RATE) == XRFDC_SUCCESS, "replay failed");
+	Entries[Moved].Offset -= 4U;
+	CHECK((Trace.Mismatches == 1U) && (Trace.ReplayIndex == NumEntries),
+			"moved access not counted once");
+	printf("Moved access: %u mismatches\r\n", Trace.Mismatches);
+
+	/* Another sampling rate, same registers with other values */
+	CHECK(Replay(&Trace, DAC_RATE_ALT) == XRFDC_SUCCESS, "replay failed");
+	CHECK((Trace.Mismatches > 0U) && (Trace.Mismatches <= NumWrites) &&
+	      (Trace.ReplayIndex == NumEntries),
+			"changed sequence not detected in step");
+	printf("Changed rate: %u mismatches for %u writes\r\n",
+		Trace.Mismatches, NumWrites);
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the traced sequence of API calls.
+*
+* @param	TracePtr is the active trace.
+* @param	DacRate is the sampling rate of the DAC tile, MHz.
+*
+* @return	XRFDC_SUCCESS if all the calls succeed, XRFDC_FAILURE
+*		otherwise.
+*
+******************************************************************************/
+static u32 RunSequence(XRFdc_Trace *TracePtr, double DacRate)
+{
+	u32 Status;
+
+	XRFdc_TraceBegin(TracePtr, "ADC PLL");
+	Status = XRFdc_DynamicPLLConfig(&RFdcInst, XRFDC_ADC_TILE, 0U,
+			XRFDC_INTERNAL_PLL_CLK, REF_CLK_FREQ, ADC_RATE);
+	XRFdc_TraceEnd(TracePtr);
+	if (Status != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+
+	XRFdc_TraceBegin(TracePtr, "DAC PLL");
+	Status = XRFdc_DynamicPLLConfig(&RFdcInst, XRFDC_DAC_TILE, 0U,
+			XRFDC_INTERNAL_PLL_CLK, REF_CLK_FREQ, DacRate);
+	XRFdc_TraceEnd(TracePtr);
+	if (Status != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+
+	XRFdc_NCOBatchReset(&Batch);
+	XRFdc_TraceBegin(TracePtr, "NCO batch");
+	Status = XRFdc_NCOBatchAdd(&RFdcInst, &Batch, XRFDC_ADC_TILE, 0U,
+			XRFDC_BLK_ID0, NCO_FREQ, 0.0);
+	if (Status == XRFDC_SUCCESS) {
+		Status = XRFdc_NCOBatchCommit(&RFdcInst, &Batch);
+	}
+	XRFdc_TraceEnd(TracePtr);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function replays the recorded entries on a new instance, with the
+* register space cleared, so that every value read comes from the trace.
+*
+* @param	TracePtr is the trace.
+* @param	DacRate is the sampling rate of the DAC tile, MHz.
+*
+* @return	XRFDC_SUCCESS if the replay ran, XRFDC_FAILURE otherwise.
+*
+******************************************************************************/
+static int Replay(XRFdc_Trace *TracePtr, double DacRate)
+{
+	u32 NumEntries = TracePtr->NumEntries;
+
+	CHECK(XRFdcModel_Init(&RFdcInst, 1U) == XRFDC_SUCCESS, "init");
+	XRFdcModel_Restore(Zero);
+	CHECK(XRFdc_ReplayStart(&RFdcInst, TracePtr, Entries, NumEntries) ==
+			XRFDC_SUCCESS, "replay not started");
+	(void)RunSequence(TracePtr, DacRate);
+	CHECK(XRFdc_TraceStop(&RFdcInst, TracePtr) == XRFDC_SUCCESS,
+			"replay not stopped");
+
+	/* Keep the number of recorded entries for the next replay */
+	TracePtr->NumEntries = NumEntries;
+
+	return XRFDC_SUCCESS;
+}
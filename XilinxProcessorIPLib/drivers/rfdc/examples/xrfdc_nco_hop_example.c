@@ -0,0 +1,451 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xrfdc_nco_hop_example.c
+*
+* This example retunes the NCOs of all the enabled ADC and DAC blocks through
+* a list of frequencies, first block by block with XRFdc_SetMixerSettings()
+* and XRFdc_UpdateEvent(), and then with the NCO batch API
+* (XRFdc_NCOBatchAdd() and XRFdc_NCOBatchCommit()), and prints the time of
+* a retune of all the blocks for both methods.
+*
+* The fine mixer of every block is set with the tile event source, the
+* settings read back at the end are compared with the last hop.
+*
+* For zcu111 board users are expected to define XPS_BOARD_ZCU111 macro
+* while compiling this example.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 11.1  ag     10/19/26 First release
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#ifdef __BAREMETAL__
+#include "xparameters.h"
+#include "xtime_l.h"
+#else
+#include <metal/time.h>
+#endif
+#include "xrfdc.h"
+#ifdef XPS_BOARD_ZCU111
+#include "xrfdc_clk.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifdef __BAREMETAL__
+#define RFDC_DEVICE_ID 	XPAR_XRFDC_0_DEVICE_ID
+#define I2CBUS	1
+#define XRFDC_BASE_ADDR		XPAR_XRFDC_0_BASEADDR
+#define RFDC_DEV_NAME    XPAR_XRFDC_0_DEV_NAME
+#else
+#define RFDC_DEVICE_ID 	0
+#define I2CBUS	12
+#endif
+
+#define NUM_HOPS	8U	/* Frequencies of the hop list */
+
+/**************************** Type Definitions ******************************/
+
+
+/***************** Macros (Inline Functions) Definitions ********************/
+#ifdef __BAREMETAL__
+#define printf xil_printf
+#endif
+/************************** Function Prototypes *****************************/
+
+static int RFdcNcoHopExample(u16 RFdcDeviceId);
+static int SetupMixer(XRFdc *RFdcInstPtr, u32 Type, u32 Tile, u32 Block);
+static int HopSingle(XRFdc *RFdcInstPtr, double Freq);
+static int HopBatch(XRFdc *RFdcInstPtr, double Freq);
+static int IsBlockEnabled(XRFdc *RFdcInstPtr, u32 Type, u32 Tile, u32 Block);
+static u64 GetTime(void);
+
+/************************** Variable Definitions ****************************/
+
+static XRFdc RFdcInst;      /* RFdc driver instance */
+static XRFdc_NCO_Batch Batch;	/* NCO batch */
+struct metal_device *deviceptr = NULL;
+
+static const double HopFreq[NUM_HOPS] = {
+	-150.0, -100.0, -50.0, -10.0, 10.0, 50.0, 100.0, 150.0
+};
+
+#ifdef XPS_BOARD_ZCU111
+unsigned int LMK04208_CKin[1][26] = {
+		{0x00160040,0x80140320,0x80140321,0x80140322,
+		0xC0140023,0x40140024,0x80141E05,0x03300006,0x01300007,0x06010008,
+		0x55555549,0x9102410A,0x0401100B,0x1B0C006C,0x2302886D,0x0200000E,
+		0x8000800F,0xC1550410,0x00000058,0x02C9C419,0x8FA8001A,0x10001E1B,
+		0x0021201C,0x0180033D,0x0200033E,0x003F001F }};
+#endif
+
+#ifdef __BAREMETAL__
+metal_phys_addr_t metal_phys = XRFDC_BASE_ADDR;
+static struct metal_device CustomDev = {
+	/* RFdc device */
+	.name = RFDC_DEV_NAME,
+	.bus = NULL,
+	.num_regions = 1,
+	.regions = {
+		{
+			.virt = (void *)XRFDC_BASE_ADDR,
+			.physmap = &metal_phys,
+			.size = 0x40000,
+			.page_shift = (unsigned)(-1),
+			.page_mask = (unsigned)(-1),
+			.mem_flags = 0x0,
+			.ops = {NULL},
+		}
+	},
+	.node = {NULL},
+	.irq_num = 0,
+	.irq_info = NULL,
+};
+#endif
+
+/****************************************************************************/
+/**
+*
+* Main function that invokes the example in this file.
+*
+* @param	None.
+*
+* @return
+*		- XRFDC_SUCCESS if the example has completed successfully.
+*		- XRFDC_FAILURE if the example has failed.
+*
+* @note		None.
+*
+*****************************************************************************/
+int main(void)
+{
+
+	int Status;
+
+	printf("RFdc NCO Hop Example Test\r\n");
+	/*
+	 * Specify the Device ID
+	 * generated in xparameters.h.
+	 */
+	Status = RFdcNcoHopExample(RFDC_DEVICE_ID);
+	if (Status != XRFDC_SUCCESS) {
+		printf("NCO Hop Example Test failed\r\n");
+		return XRFDC_FAILURE;
+	}
+
+	printf("Successfully ran NCO Hop Example\r\n");
+	return XRFDC_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function initializes the driver, sets up the fine mixers and times the
+* block by block and the batched retunes.
+*
+* @param	RFdcDeviceId is the XPAR_<XRFDC_instance>_DEVICE_ID value
+*		from xparameters.h.
+*
+* @return
+*		- XRFDC_SUCCESS if the example has completed successfully.
+*		- XRFDC_FAILURE if the example has failed.
+*
+* @note   	None
+*
+****************************************************************************/
+static int RFdcNcoHopExample(u16 RFdcDeviceId)
+{
+	int Status;
+	u32 Type;
+	u32 Tile;
+	u32 Block;
+	u32 Hop;
+	u64 Start;
+	u64 SingleTime;
+	u64 BatchTime;
+	XRFdc_Config *ConfigPtr;
+	XRFdc *RFdcInstPtr = &RFdcInst;
+	XRFdc_Mixer_Settings GetMixerSettings = {0};
+	struct metal_init_params init_param = METAL_INIT_DEFAULTS;
+
+	if (metal_init(&init_param)) {
+		printf("ERROR: Failed to run metal initialization\n");
+		return XRFDC_FAILURE;
+	}
+
+	/* Initialize the RFdc driver. */
+	ConfigPtr = XRFdc_LookupConfig(RFdcDeviceId);
+	if (ConfigPtr == NULL) {
+		return XRFDC_FAILURE;
+	}
+
+	/* Register & MAP RFDC to Libmetal */
+#ifdef __BAREMETAL__
+	deviceptr = &CustomDev;
+#endif
+
+	Status = XRFdc_RegisterMetal(RFdcInstPtr, RFdcDeviceId, &deviceptr);
+	if (Status != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+
+	/* Initializes the controller */
+	Status = XRFdc_CfgInitialize(RFdcInstPtr, ConfigPtr);
+	if (Status != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+
+#ifdef XPS_BOARD_ZCU111
+printf("\n Configuring the Clock \r\n");
+	LMK04208ClockConfig(I2CBUS, LMK04208_CKin);
+	LMX2594ClockConfig(I2CBUS, 3932160);
+#endif
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile <= XRFDC_TILE_ID_MAX; Tile++) {
+			for (Block = 0U; Block <= XRFDC_BLOCK_ID_MAX; Block++) {
+				if (IsBlockEnabled(RFdcInstPtr, Type, Tile, Block) == 0) {
+					continue;
+				}
+				Status = SetupMixer(RFdcInstPtr, Type, Tile, Block);
+				if (Status != XRFDC_SUCCESS) {
+					return XRFDC_FAILURE;
+				}
+			}
+		}
+	}
+
+	Start = GetTime();
+	for (Hop = 0U; Hop < NUM_HOPS; Hop++) {
+		Status = HopSingle(RFdcInstPtr, HopFreq[Hop]);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
+	}
+	SingleTime = (GetTime() - Start) / NUM_HOPS;
+
+	XRFdc_NCOBatchReset(&Batch);
+	Start = GetTime();
+	for (Hop = 0U; Hop < NUM_HOPS; Hop++) {
+		Status = HopBatch(RFdcInstPtr, HopFreq[Hop]);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
+	}
+	BatchTime = (GetTime() - Start) / NUM_HOPS;
+
+	printf("Retune of all blocks: single %u, batch %u ticks\r\n", (u32)SingleTime, (u32)BatchTime);
+	printf("Batch commit: %u register writes, %u events\r\n", Batch.Stats.RegWrites, Batch.Stats.Events);
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile <= XRFDC_TILE_ID_MAX; Tile++) {
+			for (Block = 0U; Block <= XRFDC_BLOCK_ID_MAX; Block++) {
+				if (IsBlockEnabled(RFdcInstPtr, Type, Tile, Block) == 0) {
+					continue;
+				}
+				Status = XRFdc_GetMixerSettings(RFdcInstPtr, Type, Tile, Block, &GetMixerSettings);
+				if (Status != XRFDC_SUCCESS) {
+					return XRFDC_FAILURE;
+				}
+				if ((GetMixerSettings.Freq - HopFreq[NUM_HOPS - 1U] > 0.001) ||
+				    (HopFreq[NUM_HOPS - 1U] - GetMixerSettings.Freq > 0.001)) {
+					printf("%s %u block %u NCO mismatch\r\n",
+					       (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile, Block);
+					return XRFDC_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XRFDC_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the fine mixer of a block, with the tile event source.
+*
+* @param	RFdcInstPtr is a pointer to the RFdc instance.
+* @param	Type is ADC or DAC.
+* @param	Tile is the tile number.
+* @param	Block is the block number.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*		- XRFDC_FAILURE if failed.
+*
+****************************************************************************/
+static int SetupMixer(XRFdc *RFdcInstPtr, u32 Type, u32 Tile, u32 Block)
+{
+	int Status;
+	XRFdc_Mixer_Settings MixerSettings = {0};
+
+	if ((Type == XRFDC_DAC_TILE) && (RFdcInstPtr->RFdc_Config.IPType >= XRFDC_GEN3)) {
+		Status = XRFdc_SetDataPathMode(RFdcInstPtr, Tile, Block, XRFDC_DATAPATH_MODE_DUC_0_FSDIVTWO);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
+	}
+
+	MixerSettings.MixerType = XRFDC_MIXER_TYPE_FINE;
+	MixerSettings.MixerMode = (Type == XRFDC_ADC_TILE) ? XRFDC_MIXER_MODE_R2C : XRFDC_MIXER_MODE_C2R;
+	MixerSettings.CoarseMixFreq = XRFDC_COARSE_MIX_OFF;
+	MixerSettings.Freq = HopFreq[0];
+	MixerSettings.PhaseOffset = 0.0;
+	MixerSettings.FineMixerScale = XRFDC_MIXER_SCALE_AUTO;
+	MixerSettings.EventSource = XRFDC_EVNT_SRC_TILE;
+	Status = XRFdc_SetMixerSettings(RFdcInstPtr, Type, Tile, Block, &MixerSettings);
+	if (Status != XRFDC_SUCCESS) {
+		return XRFDC_FAILURE;
+	}
+
+	return XRFdc_UpdateEvent(RFdcInstPtr, Type, Tile, Block, XRFDC_EVENT_MIXER);
+}
+
+/****************************************************************************/
+/**
+*
+* This function retunes all the enabled blocks one by one.
+*
+* @param	RFdcInstPtr is a pointer to the RFdc instance.
+* @param	Freq is the NCO frequency in MHz.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*		- XRFDC_FAILURE if failed.
+*
+****************************************************************************/
+static int HopSingle(XRFdc *RFdcInstPtr, double Freq)
+{
+	int Status;
+	u32 Type;
+	u32 Tile;
+	u32 Block;
+	XRFdc_Mixer_Settings MixerSettings;
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile <= XRFDC_TILE_ID_MAX; Tile++) {
+			for (Block = 0U; Block <= XRFDC_BLOCK_ID_MAX; Block++) {
+				if (IsBlockEnabled(RFdcInstPtr, Type, Tile, Block) == 0) {
+					continue;
+				}
+				Status = XRFdc_GetMixerSettings(RFdcInstPtr, Type, Tile, Block, &MixerSettings);
+				if (Status != XRFDC_SUCCESS) {
+					return XRFDC_FAILURE;
+				}
+				MixerSettings.Freq = Freq;
+				Status = XRFdc_SetMixerSettings(RFdcInstPtr, Type, Tile, Block, &MixerSettings);
+				if (Status != XRFDC_SUCCESS) {
+					return XRFDC_FAILURE;
+				}
+				Status = XRFdc_UpdateEvent(RFdcInstPtr, Type, Tile, Block, XRFDC_EVENT_MIXER);
+				if (Status != XRFDC_SUCCESS) {
+					return XRFDC_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XRFDC_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function retunes all the enabled blocks with the NCO batch API.
+*
+* @param	RFdcInstPtr is a pointer to the RFdc instance.
+* @param	Freq is the NCO frequency in MHz.
+*
+* @return
+*		- XRFDC_SUCCESS if successful.
+*		- XRFDC_FAILURE if failed.
+*
+****************************************************************************/
+static int HopBatch(XRFdc *RFdcInstPtr, double Freq)
+{
+	int Status;
+	u32 Type;
+	u32 Tile;
+	u32 Block;
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile = 0U; Tile <= XRFDC_TILE_ID_MAX; Tile++) {
+			for (Block = 0U; Block <= XRFDC_BLOCK_ID_MAX; Block++) {
+				if (IsBlockEnabled(RFdcInstPtr, Type, Tile, Block) == 0) {
+					continue;
+				}
+				Status = XRFdc_NCOBatchAdd(RFdcInstPtr, &Batch, Type, Tile, Block, Freq, 0.0);
+				if (Status != XRFDC_SUCCESS) {
+					return XRFDC_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XRFdc_NCOBatchCommit(RFdcInstPtr, &Batch);
+}
+
+/****************************************************************************/
+/**
+*
+* This function checks whether the digital path of a block is enabled.
+*
+* @param	RFdcInstPtr is a pointer to the RFdc instance.
+* @param	Type is ADC or DAC.
+* @param	Tile is the tile number.
+* @param	Block is the block number.
+*
+* @return	1 if the block is enabled, 0 otherwise.
+*
+****************************************************************************/
+static int IsBlockEnabled(XRFdc *RFdcInstPtr, u32 Type, u32 Tile, u32 Block)
+{
+	if (Type == XRFDC_ADC_TILE) {
+		if ((XRFdc_IsHighSpeedADC(RFdcInstPtr, Tile) == 1) && (Block > XRFDC_BLK_ID1)) {
+			return 0;
+		}
+		return XRFdc_IsADCDigitalPathEnabled(RFdcInstPtr, Tile, Block);
+	}
+
+	return XRFdc_IsDACDigitalPathEnabled(RFdcInstPtr, Tile, Block);
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the current time.
+*
+* @return	Global timer ticks on baremetal, libmetal timestamp on Linux.
+*
+****************************************************************************/
+static u64 GetTime(void)
+{
+#ifdef __BAREMETAL__
+	XTime Time;
+
+	XTime_GetTime(&Time);
+	return (u64)Time;
+#else
+	return (u64)metal_get_timestamp();
+#endif
+}
@@ -208,6 +208,9 @@
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Refactor connected data components.
 *       cog    01/18/22 Added safety checks.
+*       ag     10/19/26 Clear the PLL frequency plan cache on initialization.
+*       ag     10/19/26 Added the parallel tile bring-up mode.
+*       ag     10/19/26 Clear the interrupt statistics on initialization.
 *
 * </pre>
 *
@@ -222,6 +225,7 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Start, u32 End);
+static u32 XRFdc_WaitForRestartClrTiles(XRFdc *InstancePtr, u32 Type, u32 Tiles, const u32 *EndPtr);
 static void StubHandler(void *CallBackRefPtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 StatusEvent);
 static void XRFdc_ADCInitialize(XRFdc *InstancePtr);
 static void XRFdc_DACInitialize(XRFdc *InstancePtr);
@@ -286,6 +290,9 @@ u32 XRFdc_CfgInitialize(XRFdc *InstancePtr, XRFdc_Config *ConfigPtr)
 	InstancePtr->RFdc_Config = *ConfigPtr;
 	InstancePtr->ADC4GSPS = ConfigPtr->ADCType;
 	InstancePtr->StatusHandler = StubHandler;
+	InstancePtr->PLLPlanCache = NULL;
+	InstancePtr->ParallelBringUp = 0U;
+	InstancePtr->IntrStats = NULL;
 
 	/*
 	 * Indicate the instance is now ready to use.
@@ -645,6 +652,50 @@ static void XRFdc_UpdatePLLStruct(XRFdc *InstancePtr, u32 Type, u32 Tile_Id)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* The API selects how the tiles are brought up when all the tiles are
+* restarted (Tile_Id of -1) by XRFdc_StartUp(), XRFdc_Shutdown(),
+* XRFdc_Reset() and XRFdc_CustomStartUp(), and how the DTC codes are scanned
+* by XRFdc_MultiConverter_Sync().
+* By default the tiles are restarted one after the other, each restart
+* waiting for the tile to reach its end state. In parallel mode the restart
+* of all the tiles is triggered first and the tiles are then polled together,
+* and the DTC codes of all the tiles of the MTS group are scanned together,
+* with a single SysRef count per code.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Enable is 1 for the parallel mode, 0 for the sequential mode.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     In parallel mode, a tile taking its clock from another tile may
+*           wait for the source tile within its own timeout.
+*
+******************************************************************************/
+u32 XRFdc_SetParallelBringUp(XRFdc *InstancePtr, u8 Enable)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (Enable > 1U) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid parallel bring-up value (%u) in %s\r\n", Enable, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->ParallelBringUp = Enable;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -909,6 +960,124 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This Static API waits for a set of tiles restarted together, it is the
+* XRFdc_WaitForRestartClr() of all the tiles in a single polling loop. Each
+* tile waits for its PLL lock if clocked by its internal PLL, and then for
+* the restart bit clear or for its end state, with the timeouts of
+* XRFdc_WaitForRestartClr() and XRFdc_WaitForState().
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tiles is the mask of the tiles to wait for.
+* @param    EndPtr is the end state of the State Machine of each tile.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if timeout occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_WaitForRestartClrTiles(XRFdc *InstancePtr, u32 Type, u32 Tiles, const u32 *EndPtr)
+{
+	u32 Status;
+	u32 Index;
+	u32 BaseAddr;
+	u32 ClkSrc = 0U;
+	u32 LockStatus = 0U;
+	u32 TileState;
+	u32 Budget;
+	u32 Pending = Tiles;
+	u8 WaitLock[XRFDC_NUM_OF_TILES4] = { 0U };
+	u32 Elapsed[XRFDC_NUM_OF_TILES4] = { 0U };
+
+	for (Index = XRFDC_TILE_ID0; Index < XRFDC_NUM_OF_TILES4; Index++) {
+		if ((Tiles & (1U << Index)) == 0U) {
+			continue;
+		}
+		if (XRFdc_GetClockSource(InstancePtr, Type, Index, &ClkSrc) != XRFDC_SUCCESS) {
+			Status = XRFDC_FAILURE;
+			goto RETURN_PATH;
+		}
+		if ((ClkSrc == XRFDC_INTERNAL_PLL_CLK) && (EndPtr[Index] > XRFDC_STATE_CLK_DET)) {
+			WaitLock[Index] = 1U;
+		}
+	}
+
+	while (Pending != 0U) {
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_NUM_OF_TILES4; Index++) {
+			if ((Pending & (1U << Index)) == 0U) {
+				continue;
+			}
+			BaseAddr = XRFDC_CTRL_STS_BASE(Type, Index);
+
+			if (WaitLock[Index] != 0U) {
+				/*
+				 * Wait for internal PLL to lock
+				 */
+				if (XRFdc_GetPLLLockStatus(InstancePtr, Type, Index, &LockStatus) != XRFDC_SUCCESS) {
+					Status = XRFDC_FAILURE;
+					goto RETURN_PATH;
+				}
+				if (LockStatus == XRFDC_PLL_LOCKED) {
+					WaitLock[Index] = 0U;
+					Elapsed[Index] = 0U;
+				} else if (Elapsed[Index] >= (XRFDC_PLL_LOCK_DLY_CNT * XRFDC_PLL_LOCK_WAIT)) {
+					metal_log(METAL_LOG_ERROR, "\n %s %u timed out at state %u in %s\r\n",
+						  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Index,
+						  XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_CURRENT_STATE_OFFSET),
+						  __func__);
+					Status = XRFDC_FAILURE;
+					goto RETURN_PATH;
+				} else {
+					continue;
+				}
+			}
+
+			if (EndPtr[Index] == XRFDC_STATE_FULL) {
+				/* Wait till restart bit clear */
+				TileState = (XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_RESTART_OFFSET) == 0U) ?
+						    XRFDC_STATE_FULL :
+						    0U;
+				Budget = XRFDC_RESTART_CLR_DLY_CNT * XRFDC_RESTART_CLR_WAIT;
+			} else {
+				TileState = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_CURRENT_STATE_OFFSET,
+							XRFDC_CURRENT_STATE_MASK);
+				Budget = XRFDC_WAIT_ATTEMPTS_CNT * XRFDC_STATE_WAIT;
+			}
+
+			if (TileState >= EndPtr[Index]) {
+				Pending &= ~(1U << Index);
+			} else if (Elapsed[Index] >= Budget) {
+				metal_log(METAL_LOG_ERROR, "\n %s %u timed out at state %u in %s\r\n",
+					  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Index,
+					  XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_CURRENT_STATE_OFFSET), __func__);
+				Status = XRFDC_FAILURE;
+				goto RETURN_PATH;
+			}
+		}
+
+		if (Pending != 0U) {
+			/* Wait for 0.1 msec */
+#ifdef __BAREMETAL__
+			usleep(XRFDC_STATE_WAIT);
+#else
+			metal_sleep_usec(XRFDC_STATE_WAIT);
+#endif
+			for (Index = XRFDC_TILE_ID0; Index < XRFDC_NUM_OF_TILES4; Index++) {
+				Elapsed[Index] += XRFDC_STATE_WAIT;
+			}
+		}
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -992,6 +1161,8 @@ static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Star
 	u16 NoOfTiles;
 	u16 Index;
 	u32 TileLayout;
+	u32 Started = 0U;
+	u32 TileEnd[XRFDC_NUM_OF_TILES4];
 
 	/* An input tile if of -1 selects all tiles */
 	if (Tile_Id == XRFDC_SELECT_ALL_TILES) {
@@ -1033,6 +1204,13 @@ static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Star
 			/* Trigger restart */
 			XRFdc_WriteReg(InstancePtr, BaseAddr, XRFDC_RESTART_OFFSET, XRFDC_RESTART_MASK);
 
+			if ((InstancePtr->ParallelBringUp != 0U) && (Tile_Id == XRFDC_SELECT_ALL_TILES)) {
+				/* Wait for all the tiles together once they are started */
+				Started |= (1U << Index);
+				TileEnd[Index] = End;
+				continue;
+			}
+
 			/* Wait for restart bit clear */
 			Status = XRFdc_WaitForRestartClr(InstancePtr, Type, Index, BaseAddr, End);
 			if (Status != XRFDC_SUCCESS) {
@@ -1041,6 +1219,13 @@ static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Star
 		}
 	}
 
+	if (Started != 0U) {
+		Status = XRFdc_WaitForRestartClrTiles(InstancePtr, Type, Started, TileEnd);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+	}
+
 	Status = XRFDC_SUCCESS;
 RETURN_PATH:
 	return Status;
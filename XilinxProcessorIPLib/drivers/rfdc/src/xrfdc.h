@@ -284,6 +284,14 @@
 *       cog    11/26/21 Pack all structs for RAFT compatibility.
 *       cog    12/06/21 Rearrange XRFdc_Distribution_Settings.
 *       cog    01/18/22 Added safety checks.
+*       ag     10/19/26 Added the NCO batch retune API.
+*       ag     10/19/26 Added the PLL frequency plan cache.
+*       ag     10/19/26 Added the register access trace and replay.
+*       ag     10/19/26 Added the parallel tile bring-up mode.
+*       ag     10/19/26 Added the interrupt demultiplexer and statistics.
+*       ag     10/19/26 XRFDC_NCO_BATCH_MAX can be set at build time.
+*       ag     10/19/26 XRFdc_PLLPlanCacheInit() takes the number of valid plans.
+*       ag     10/19/26 Count the common tile interrupts.
 *
 * </pre>
 *
@@ -363,6 +371,37 @@ typedef struct {
 	u64 FractionalData; /* Fractional data is currently not supported */
 	u32 FractWidth; /* Fractional width is currently not supported */
 } XRFdc_PLL_Settings;
+
+/**
+ * PLL frequency plan, the PLL register values for a reference clock and a
+ * sampling rate.
+ */
+typedef struct {
+	double RefClkFreq; /* Reference clock after the reference divider, MHz */
+	double SamplingRate; /* Requested sampling rate, MHz */
+	double ActualRate; /* Sampling rate given by the dividers, MHz */
+	u32 Type;
+	u16 FeedbackDiv;
+	u16 OutputDiv;
+	u16 Divider; /* Output divider mode and value */
+	u16 DividerAlt; /* Output divider bypass, Gen 3 only */
+	u16 Spare0;
+	u16 LoopFilter;
+	u16 ChargePump;
+} XRFdc_PLL_Plan;
+
+/**
+ * PLL frequency plan cache, a table of plans computed offline and given to
+ * XRFdc_PLLPlanCacheInit(), or filled by XRFdc_PLLPlanCompile() and by
+ * XRFdc_DynamicPLLConfig().
+ */
+typedef struct {
+	XRFdc_PLL_Plan *Plans;
+	u32 MaxPlans;
+	u32 NumPlans;
+	u32 Hits;
+	u32 Misses;
+} XRFdc_PLL_Plan_Cache;
 /**
 * ClkIntraTile Settings.
 */
@@ -488,6 +527,123 @@ typedef struct {
 	u8 MixerType;
 } XRFdc_Mixer_Settings;
 
+#ifndef XRFDC_NCO_BATCH_MAX
+#define XRFDC_NCO_BATCH_MAX 32U /* Blocks of all the ADC and DAC tiles */
+#endif
+
+/**
+ * NCO registers of a block, staged by XRFdc_NCOBatchAdd().
+ */
+typedef struct {
+	u32 Type;
+	u32 Tile_Id;
+	u32 Block_Id; /* Block holding the NCO registers */
+	u32 BaseAddr;
+	u16 FreqWord[3]; /* Low, middle and upper frequency words */
+	u16 PhaseWord[2]; /* Low and upper phase words */
+	u16 NCOUpdate; /* NCO update register, with the tile event source */
+	u8 SetNCOUpdate; /* NCO update register needs to be written */
+	double Freq;
+	double PhaseOffset;
+} XRFdc_NCO_Stage;
+
+/**
+ * NCO batch statistics, times are in libmetal timestamp units.
+ */
+typedef struct {
+	u64 PrepareTime; /* Time spent in XRFdc_NCOBatchAdd() */
+	u64 CommitTime; /* Time spent in the last XRFdc_NCOBatchCommit() */
+	u32 RegWrites; /* Register writes of the last commit */
+	u32 Events; /* Update events of the last commit */
+	u32 Commits;
+} XRFdc_NCO_Batch_Stats;
+
+/**
+ * NCO batch, a set of blocks retuned together.
+ */
+typedef struct {
+	XRFdc_NCO_Stage Stage[XRFDC_NCO_BATCH_MAX];
+	u32 NumStaged;
+	u8 TileMask[2]; /* Tiles with staged blocks, for ADC and DAC */
+	XRFdc_NCO_Batch_Stats Stats;
+} XRFdc_NCO_Batch;
+
+#define XRFDC_TRACE_MAX_SCOPES 16U
+#define XRFDC_TRACE_MODE_RECORD 0U
+#define XRFDC_TRACE_MODE_REPLAY 1U
+
+/**
+ * Interrupt statistics of a block, updated by XRFdc_IntrDemuxHandler().
+ * Sequence is odd while the handler updates the counters.
+ */
+typedef struct {
+	volatile u32 Sequence;
+	u32 Events; /* Handled interrupts of the block */
+	u32 OverVoltage;
+	u32 OverRange;
+	u32 CommonMode; /* Common mode over/under voltage */
+	u32 ConvOverflow; /* Converter FIFO and data overflows */
+	u32 FifoInterface; /* Fabric FIFO overflows/underflows */
+	u32 Decoder; /* Sub-ADC decoder */
+	u32 DataPath;
+	u32 LastStatus; /* Interrupt mask of the last event */
+	u64 LastTimestamp; /* libmetal timestamp of the last event */
+} XRFdc_Intr_Block_Stats;
+
+/**
+ * Interrupt statistics of the instance, per type, tile and block.
+ */
+typedef struct {
+	XRFdc_Intr_Block_Stats Block[2][4][4];
+	volatile u32 Common[2][4]; /* Common interrupts, per type and tile */
+	volatile u32 Interrupts; /* Calls of XRFdc_IntrDemuxHandler() */
+	volatile u32 Spurious; /* Calls with no tile pending */
+} XRFdc_Intr_Stats;
+
+/**
+ * Register access, recorded by the trace or read by the replay.
+ */
+typedef struct {
+	u64 Timestamp; /* libmetal timestamp of the access */
+	u64 Value;
+	u32 Offset; /* Offset in the RFdc register region */
+	u16 Scope; /* Scope of the access, 0 if none */
+	u8 Width; /* Access width in bytes */
+	u8 Write; /* 1 for a write, 0 for a read */
+} XRFdc_Trace_Entry;
+
+/**
+ * Register accesses and time of a traced scope, usually an API call.
+ */
+typedef struct {
+	const char *Name;
+	u32 Calls;
+	u32 Reads;
+	u32 Writes;
+	u64 Time; /* libmetal timestamp units */
+} XRFdc_Trace_Scope;
+
+/**
+ * Register access trace of an instance.
+ */
+typedef struct {
+	XRFdc_Trace_Entry *Entries; /* May be NULL to only count the accesses */
+	u32 MaxEntries;
+	u32 NumEntries;
+	u32 Dropped; /* Accesses not recorded, the entry table was full */
+	u32 Reads;
+	u32 Writes;
+	u32 Mismatches; /* Replay accesses which differ from the trace */
+	u32 ReplayIndex;
+	u32 Mode;
+	u32 NumScopes;
+	u32 CurScope; /* Index + 1 of the open scope, 0 if none */
+	u64 ScopeStart;
+	XRFdc_Trace_Scope Scope[XRFDC_TRACE_MAX_SCOPES];
+	struct metal_io_region *io;
+	struct metal_io_ops SavedOps; /* I/O operations replaced by the trace */
+} XRFdc_Trace;
+
 /**
  * ADC block Threshold settings.
  */
@@ -769,6 +925,9 @@ typedef struct {
 	XRFdc_StatusHandler StatusHandler; /* Event handler function */
 	void *CallBackRef; /* Callback reference for event handler */
 	u8 UpdateMixerScale; /* Set to 1, if user overwrite mixer scale */
+	XRFdc_PLL_Plan_Cache *PLLPlanCache; /* PLL frequency plans, may be NULL */
+	u8 ParallelBringUp; /* Set to 1, to start and sync all the tiles together */
+	XRFdc_Intr_Stats *IntrStats; /* Interrupt statistics, may be NULL */
 } XRFdc;
 #ifndef __BAREMETAL__
 #pragma pack()
@@ -1345,6 +1504,7 @@ XRFdc_Config *XRFdc_LookupConfig(u16 DeviceId);
 u32 XRFdc_RegisterMetal(XRFdc *InstancePtr, u16 DeviceId, struct metal_device **DevicePtr);
 u32 XRFdc_CfgInitialize(XRFdc *InstancePtr, XRFdc_Config *ConfigPtr);
 u32 XRFdc_StartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id);
+u32 XRFdc_SetParallelBringUp(XRFdc *InstancePtr, u8 Enable);
 u32 XRFdc_Shutdown(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_Reset(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_CustomStartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 StartState, u32 EndState);
@@ -1379,6 +1539,16 @@ u32 XRFdc_SetDecoderMode(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 Deco
 u32 XRFdc_UpdateEvent(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 Event);
 u32 XRFdc_GetDecoderMode(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 *DecoderModePtr);
 u32 XRFdc_ResetNCOPhase(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id);
+void XRFdc_NCOBatchReset(XRFdc_NCO_Batch *BatchPtr);
+u32 XRFdc_NCOBatchAdd(XRFdc *InstancePtr, XRFdc_NCO_Batch *BatchPtr, u32 Type, u32 Tile_Id, u32 Block_Id,
+		      double Freq, double PhaseOffset);
+u32 XRFdc_NCOBatchCommit(XRFdc *InstancePtr, XRFdc_NCO_Batch *BatchPtr);
+u32 XRFdc_TraceStart(XRFdc *InstancePtr, XRFdc_Trace *TracePtr, XRFdc_Trace_Entry *EntriesPtr, u32 MaxEntries);
+u32 XRFdc_ReplayStart(XRFdc *InstancePtr, XRFdc_Trace *TracePtr, XRFdc_Trace_Entry *EntriesPtr, u32 NumEntries);
+u32 XRFdc_TraceStop(XRFdc *InstancePtr, XRFdc_Trace *TracePtr);
+void XRFdc_TraceBegin(XRFdc_Trace *TracePtr, const char *Name);
+void XRFdc_TraceEnd(XRFdc_Trace *TracePtr);
+void XRFdc_TraceDump(XRFdc_Trace *TracePtr);
 void XRFdc_DumpRegs(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_MultiBand(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u8 DigitalDataPathMask, u32 MixerInOutDataType,
 		    u32 DataConverterMask);
@@ -1387,6 +1557,10 @@ int XRFdc_GetConnectedQData(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block
 u32 XRFdc_GetConnectedIQData(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, int *ConnectedIData,
 			     int *ConnectedQData);
 u32 XRFdc_IntrHandler(u32 Vector, void *XRFdcPtr);
+u32 XRFdc_IntrDemuxHandler(u32 Vector, void *XRFdcPtr);
+void XRFdc_SetIntrStats(XRFdc *InstancePtr, XRFdc_Intr_Stats *StatsPtr);
+u32 XRFdc_GetIntrBlockStats(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
+			    XRFdc_Intr_Block_Stats *StatsPtr);
 u32 XRFdc_IntrClr(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 IntrMask);
 u32 XRFdc_GetIntrStatus(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 *IntrStsPtr);
 u32 XRFdc_IntrDisable(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 IntrMask);
@@ -1414,6 +1588,11 @@ u32 XRFdc_GetPLLLockStatus(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 *LockS
 u32 XRFdc_GetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_PLL_Settings *PLLSettings);
 u32 XRFdc_DynamicPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u8 Source, double RefClkFreq,
 			   double SamplingRate);
+u32 XRFdc_ComputePLLPlan(u32 IPType, u32 Type, double RefClkFreq, double SamplingRate, XRFdc_PLL_Plan *PlanPtr);
+u32 XRFdc_PLLPlanCacheInit(XRFdc *InstancePtr, XRFdc_PLL_Plan_Cache *CachePtr, XRFdc_PLL_Plan *PlansPtr,
+			   u32 MaxPlans, u32 NumPlans);
+u32 XRFdc_PLLPlanCompile(XRFdc *InstancePtr, u32 Type, double RefClkFreq, u32 RefClkDiv, const double *SamplingRates,
+			 u32 NumRates);
 u32 XRFdc_SetInvSincFIR(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u16 Mode);
 u32 XRFdc_GetInvSincFIR(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u16 *ModePtr);
 u32 XRFdc_GetLinkCoupling(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 *ModePtr);
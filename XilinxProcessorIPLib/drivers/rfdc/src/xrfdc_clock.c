@@ -81,6 +81,9 @@
 *                       clock combinations.
 *       cog    01/12/22 Fix compiler warnings.
 *       cog    01/24/22 Fix static analysis errors.
+*       ag     10/19/26 Added the PLL frequency plan cache, the PLL registers are
+*                       written once after the divider search.
+*       ag     10/19/26 XRFdc_PLLPlanCacheInit() keeps the plans given to it.
 * </pre>
 *
 ******************************************************************************/
@@ -1165,25 +1168,27 @@ RETURN_PATH:
 /*****************************************************************************/
 /**
 *
-* This function used for configuring the internal PLL registers
-* based on reference clock and sampling rate
+* This function computes the PLL frequency plan for a reference clock and a
+* sampling rate, by sweeping the feedback and output dividers for the best
+* match of the sampling rate. The function does not access the device, so the
+* plans can also be computed offline and given to XRFdc_PLLPlanCacheInit().
 *
-* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    IPType is the IP generation, RFdc_Config.IPType of the instance.
 * @param    Type indicates ADC/DAC.
-* @param    Tile_Id indicates Tile number (0-3).
-* @param    RefClkFreq Reference Clock Frequency MHz(50MHz - 1.2GHz)
-* @param    SamplingRate Sampling Rate in MHz(0.5- 4 GHz)
+* @param    RefClkFreq Reference Clock Frequency in MHz, after the reference
+*           clock divider.
+* @param    SamplingRate Sampling Rate in MHz.
+* @param    PlanPtr is a pointer to the plan to fill.
 *
 * @return
 *           - XRFDC_SUCCESS if successful.
-*           - XRFDC_FAILURE if error occurs.
+*           - XRFDC_FAILURE if no feedback divider gives a valid VCO frequency.
 *
 * @note     None.
 *
 ******************************************************************************/
-static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double RefClkFreq, double SamplingRate)
+u32 XRFdc_ComputePLLPlan(u32 IPType, u32 Type, double RefClkFreq, double SamplingRate, XRFdc_PLL_Plan *PlanPtr)
 {
-	u32 BaseAddr;
 	u32 Status;
 	u32 FeedbackDiv;
 	u32 OutputDiv;
@@ -1197,54 +1202,17 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 	u32 DivideValue = 0x0U;
 	u32 PllFreqIndex = 0x0U;
 	u32 FbDivIndex = 0x0U;
-	u32 RefClkDiv = 0x1;
-	u16 ReadReg;
 	u32 VCOMin;
 	u32 VCOMax;
 
-	if (Type == XRFDC_ADC_TILE) {
-		BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id);
-	} else {
-		BaseAddr = XRFDC_DAC_TILE_DRP_ADDR(Tile_Id);
-	}
-
-	BaseAddr += XRFDC_HSCOM_ADDR;
-
-	ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_PLL_REFDIV);
-	if (ReadReg & XRFDC_REFCLK_DIV_1_MASK) {
-		RefClkDiv = XRFDC_REF_CLK_DIV_1;
-	} else {
-		switch (ReadReg & XRFDC_REFCLK_DIV_MASK) {
-		case XRFDC_REFCLK_DIV_2_MASK:
-			RefClkDiv = XRFDC_REF_CLK_DIV_2;
-			break;
-		case XRFDC_REFCLK_DIV_3_MASK:
-			RefClkDiv = XRFDC_REF_CLK_DIV_3;
-			break;
-		case XRFDC_REFCLK_DIV_4_MASK:
-			RefClkDiv = XRFDC_REF_CLK_DIV_4;
-			break;
-		default:
-			/*
-				 * IP currently supporting 1 to 4 divider values. This
-				 * error condition might change in future based on IP update.
-				 */
-			metal_log(METAL_LOG_ERROR,
-				  "\n Unsupported Reference clock Divider value (%u) for %s %u in %s\r\n",
-				  (ReadReg & XRFDC_REFCLK_DIV_MASK), (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id,
-				  __func__);
-			return XRFDC_FAILURE;
-		}
-	}
-
-	RefClkFreq /= RefClkDiv;
+	Xil_AssertNonvoid(PlanPtr != NULL);
 
 	/*
 	 * Sweep valid integer values of FeedbackDiv(N) and record a list
 	 * of values that fall in the valid VCO range 8.5GHz - 12.8GHz
 	 */
 
-	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+	if (IPType < XRFDC_GEN3) {
 		VCOMin = VCO_RANGE_MIN;
 		VCOMax = VCO_RANGE_MAX;
 	} else {
@@ -1260,44 +1228,31 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 	for (FeedbackDiv = PLL_FPDIV_MIN; FeedbackDiv <= PLL_FPDIV_MAX; FeedbackDiv++) {
 		PllFreq = FeedbackDiv * RefClkFreq;
 
-		if ((PllFreq >= VCOMin) && (PllFreq <= VCOMax)) {
-			/*
-			 * Sweep values of OutputDiv(M) to find the output frequency
-			 * that best matches the user requested value
-			 */
-			if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
-				OutputDiv = PLL_DIVIDER_MIN_GEN3;
-				CalcSamplingRate = (PllFreq / OutputDiv);
+		if ((PllFreq < VCOMin) || (PllFreq > VCOMax)) {
+			continue;
+		}
 
-				if (SamplingRate > CalcSamplingRate) {
-					SamplingError = SamplingRate - CalcSamplingRate;
-				} else {
-					SamplingError = CalcSamplingRate - SamplingRate;
-				}
+		/*
+		 * Sweep values of OutputDiv(M) to find the output frequency
+		 * that best matches the user requested value
+		 */
+		if (IPType >= XRFDC_GEN3) {
+			OutputDiv = PLL_DIVIDER_MIN_GEN3;
+			CalcSamplingRate = (PllFreq / OutputDiv);
 
-				if (Best_Error > SamplingError) {
-					Best_FeedbackDiv = FeedbackDiv;
-					Best_OutputDiv = OutputDiv;
-					Best_Error = SamplingError;
-				}
+			if (SamplingRate > CalcSamplingRate) {
+				SamplingError = SamplingRate - CalcSamplingRate;
+			} else {
+				SamplingError = CalcSamplingRate - SamplingRate;
 			}
-			for (OutputDiv = PLL_DIVIDER_MIN; OutputDiv <= PLL_DIVIDER_MAX; OutputDiv += 2U) {
-				CalcSamplingRate = (PllFreq / OutputDiv);
-
-				if (SamplingRate > CalcSamplingRate) {
-					SamplingError = SamplingRate - CalcSamplingRate;
-				} else {
-					SamplingError = CalcSamplingRate - SamplingRate;
-				}
 
-				if (Best_Error > SamplingError) {
-					Best_FeedbackDiv = FeedbackDiv;
-					Best_OutputDiv = OutputDiv;
-					Best_Error = SamplingError;
-				}
+			if (Best_Error > SamplingError) {
+				Best_FeedbackDiv = FeedbackDiv;
+				Best_OutputDiv = OutputDiv;
+				Best_Error = SamplingError;
 			}
-
-			OutputDiv = 3U;
+		}
+		for (OutputDiv = PLL_DIVIDER_MIN; OutputDiv <= PLL_DIVIDER_MAX; OutputDiv += 2U) {
 			CalcSamplingRate = (PllFreq / OutputDiv);
 
 			if (SamplingRate > CalcSamplingRate) {
@@ -1313,189 +1268,380 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 			}
 		}
 
-		/*
-		 * PLL Static configuration
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_CFG0, 0x80U);
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED0, 0x111U);
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED1, 0x11U);
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO1, 0x08U);
-		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x45U);
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5800U);
+		OutputDiv = 3U;
+		CalcSamplingRate = (PllFreq / OutputDiv);
 
+		if (SamplingRate > CalcSamplingRate) {
+			SamplingError = SamplingRate - CalcSamplingRate;
 		} else {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x2DU);
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5F03U);
+			SamplingError = CalcSamplingRate - SamplingRate;
 		}
-		/*
-		 * Set Feedback divisor value
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_FPDIV, Best_FeedbackDiv - 2U);
 
-		/*
-		 * Set Output divisor value
-		 */
-		if (Best_OutputDiv == 1U) {
-			DivideMode = 0x0U;
-			/*if divisor is 1 bypass toatally*/
-			DivideValue = XRFDC_PLL_DIVIDER0_BYP_OPDIV_MASK;
-		} else if (Best_OutputDiv == 2U) {
-			DivideMode = 0x1U;
-		} else if (Best_OutputDiv == 3U) {
-			DivideMode = 0x2U;
-			DivideValue = 0x1U;
-		} else if (Best_OutputDiv >= 4U) {
-			DivideMode = 0x3U;
-			DivideValue = ((Best_OutputDiv - 4U) / 2U);
+		if (Best_Error > SamplingError) {
+			Best_FeedbackDiv = FeedbackDiv;
+			Best_OutputDiv = OutputDiv;
+			Best_Error = SamplingError;
 		}
+	}
 
-		XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_MASK,
-				((DivideMode << XRFDC_PLL_DIVIDER0_SHIFT) | DivideValue));
+	if (Best_FeedbackDiv == 0U) {
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
 
-		if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
-			if (Best_OutputDiv > PLL_DIVIDER_MIN_GEN3) {
-				XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
-						XRFDC_DISABLED);
-			} else {
-				XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
-						XRFDC_PLL_DIVIDER0_BYPDIV_MASK);
-			}
-		}
-		/*
-		 * Enable fine sweep
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CRS2, XRFDC_PLL_CRS2_VAL);
+	PlanPtr->RefClkFreq = RefClkFreq;
+	PlanPtr->SamplingRate = SamplingRate;
+	PlanPtr->Type = Type;
+	PlanPtr->FeedbackDiv = (u16)Best_FeedbackDiv;
+	PlanPtr->OutputDiv = (u16)Best_OutputDiv;
+	PlanPtr->ActualRate = (Best_FeedbackDiv * RefClkFreq) / Best_OutputDiv;
 
-		/*
-		 * Set default PLL spare inputs LSB
-		 */
-		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x507U);
-		} else {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x0D37U);
+	/*
+	 * Output divisor value
+	 */
+	if (Best_OutputDiv == 1U) {
+		DivideMode = 0x0U;
+		/*if divisor is 1 bypass toatally*/
+		DivideValue = XRFDC_PLL_DIVIDER0_BYP_OPDIV_MASK;
+	} else if (Best_OutputDiv == 2U) {
+		DivideMode = 0x1U;
+	} else if (Best_OutputDiv == 3U) {
+		DivideMode = 0x2U;
+		DivideValue = 0x1U;
+	} else if (Best_OutputDiv >= 4U) {
+		DivideMode = 0x3U;
+		DivideValue = ((Best_OutputDiv - 4U) / 2U);
+	}
+	PlanPtr->Divider = (u16)((DivideMode << XRFDC_PLL_DIVIDER0_SHIFT) | DivideValue);
+
+	if (Best_OutputDiv > PLL_DIVIDER_MIN_GEN3) {
+		PlanPtr->DividerAlt = XRFDC_DISABLED;
+	} else {
+		PlanPtr->DividerAlt = XRFDC_PLL_DIVIDER0_BYPDIV_MASK;
+	}
+
+	/*
+	 * Default PLL spare inputs LSB
+	 */
+	if (IPType < XRFDC_GEN3) {
+		PlanPtr->Spare0 = 0x507U;
+	} else {
+		PlanPtr->Spare0 = 0x0D37U;
+	}
+
+	PllFreq = RefClkFreq * Best_FeedbackDiv;
+
+	if (PllFreq < 9400U) {
+		PllFreqIndex = 0U;
+		FbDivIndex = 2U;
+		if (Best_FeedbackDiv < 21U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 30U) {
+			FbDivIndex = 1U;
 		}
-		/*
-		 * Set PLL spare inputs MSB
-		 */
-		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x0U);
-		} else {
-			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x80U);
+	} else if (PllFreq < 10070U) {
+		PllFreqIndex = 1U;
+		FbDivIndex = 2U;
+		if (Best_FeedbackDiv < 18U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 30U) {
+			FbDivIndex = 1U;
 		}
-		PllFreq = RefClkFreq * Best_FeedbackDiv;
-
-		if (PllFreq < 9400U) {
-			PllFreqIndex = 0U;
+	} else if (PllFreq < 10690U) {
+		PllFreqIndex = 2U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 18U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 25U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 35U) {
 			FbDivIndex = 2U;
-			if (Best_FeedbackDiv < 21U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 30U) {
-				FbDivIndex = 1U;
-			}
-		} else if (PllFreq < 10070U) {
-			PllFreqIndex = 1U;
+		}
+	} else if (PllFreq < 10990U) {
+		PllFreqIndex = 3U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 19U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 27U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 38U) {
 			FbDivIndex = 2U;
-			if (Best_FeedbackDiv < 18U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 30U) {
-				FbDivIndex = 1U;
-			}
-		} else if (PllFreq < 10690U) {
-			PllFreqIndex = 2U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 18U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 25U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 35U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 10990U) {
-			PllFreqIndex = 3U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 19U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 27U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 38U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 11430U) {
-			PllFreqIndex = 4U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 19U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 27U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 38U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 12040U) {
-			PllFreqIndex = 5U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 20U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 28U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 40U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 12530U) {
-			PllFreqIndex = 6U;
-			FbDivIndex = 3U;
-			if (Best_FeedbackDiv < 23U) {
-				FbDivIndex = 0U;
-			} else if (Best_FeedbackDiv < 30U) {
-				FbDivIndex = 1U;
-			} else if (Best_FeedbackDiv < 42U) {
-				FbDivIndex = 2U;
-			}
-		} else if (PllFreq < 20000U) {
-			PllFreqIndex = 7U;
+		}
+	} else if (PllFreq < 11430U) {
+		PllFreqIndex = 4U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 19U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 27U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 38U) {
 			FbDivIndex = 2U;
-			if (Best_FeedbackDiv < 20U) {
-				FbDivIndex = 0U;
-				/*
-				 * Set PLL spare inputs LSB
-				 */
-				if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
-					XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x577);
-				} else {
-					XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, 0x0D37U);
-				}
-			} else if (Best_FeedbackDiv < 39U) {
-				FbDivIndex = 1U;
+		}
+	} else if (PllFreq < 12040U) {
+		PllFreqIndex = 5U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 20U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 28U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 40U) {
+			FbDivIndex = 2U;
+		}
+	} else if (PllFreq < 12530U) {
+		PllFreqIndex = 6U;
+		FbDivIndex = 3U;
+		if (Best_FeedbackDiv < 23U) {
+			FbDivIndex = 0U;
+		} else if (Best_FeedbackDiv < 30U) {
+			FbDivIndex = 1U;
+		} else if (Best_FeedbackDiv < 42U) {
+			FbDivIndex = 2U;
+		}
+	} else if (PllFreq < 20000U) {
+		PllFreqIndex = 7U;
+		FbDivIndex = 2U;
+		if (Best_FeedbackDiv < 20U) {
+			FbDivIndex = 0U;
+			/*
+			 * PLL spare inputs LSB
+			 */
+			if (IPType < XRFDC_GEN3) {
+				PlanPtr->Spare0 = 0x577U;
 			}
+		} else if (Best_FeedbackDiv < 39U) {
+			FbDivIndex = 1U;
 		}
+	}
 
-		/*
-		 * Enable automatic selection of the VCO, this will work with the
-		 * IP version 2.0.1 and above and using older version of IP is
-		 * not likely to work.
-		 */
+	/*
+	 * PLL bits for loop filters LSB and charge pumps
+	 */
+	PlanPtr->LoopFilter = (u16)PllTuningMatrix[PllFreqIndex][FbDivIndex][0];
+	PlanPtr->ChargePump = (u16)PllTuningMatrix[PllFreqIndex][FbDivIndex][1];
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
 
-		XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_CRS1, XRFDC_PLL_VCO_SEL_AUTO_MASK,
-				XRFDC_PLL_VCO_SEL_AUTO_MASK);
+/*****************************************************************************/
+/**
+*
+* This function looks up a PLL frequency plan in the cache.
+*
+* @param    CachePtr is a pointer to the plan cache.
+* @param    Type indicates ADC/DAC.
+* @param    RefClkFreq Reference Clock Frequency in MHz, after the reference
+*           clock divider.
+* @param    SamplingRate Sampling Rate in MHz.
+*
+* @return   Pointer to the plan, NULL if the plan is not in the cache.
+*
+* @note     None.
+*
+******************************************************************************/
+static XRFdc_PLL_Plan *XRFdc_LookupPLLPlan(XRFdc_PLL_Plan_Cache *CachePtr, u32 Type, double RefClkFreq,
+					   double SamplingRate)
+{
+	u32 Index;
+	XRFdc_PLL_Plan *PlanPtr;
+
+	for (Index = 0U; Index < CachePtr->NumPlans; Index++) {
+		PlanPtr = &CachePtr->Plans[Index];
+		if ((PlanPtr->Type == Type) && (PlanPtr->RefClkFreq == RefClkFreq) &&
+		    (PlanPtr->SamplingRate == SamplingRate)) {
+			return PlanPtr;
+		}
+	}
 
-		/*
-		 * PLL bits for loop filters LSB
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF0, PllTuningMatrix[PllFreqIndex][FbDivIndex][0]);
+	return NULL;
+}
 
-		/*
-		 * PLL bits for loop filters MSB
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF1, XRFDC_PLL_LPF1_VAL);
+/*****************************************************************************/
+/**
+*
+* This function writes a PLL frequency plan to the PLL registers of a tile.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    BaseAddr is the address of the HSCOM registers of the tile.
+* @param    PlanPtr is a pointer to the plan.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XRFdc_WritePLLPlan(XRFdc *InstancePtr, u32 BaseAddr, const XRFdc_PLL_Plan *PlanPtr)
+{
+	/*
+	 * PLL Static configuration
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_CFG0, 0x80U);
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED0, 0x111U);
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SDM_SEED1, 0x11U);
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO1, 0x08U);
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x45U);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5800U);
 
-		/*
-		 * Set PLL bits for charge pumps
-		 */
-		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CHARGEPUMP,
-				 PllTuningMatrix[PllFreqIndex][FbDivIndex][1]);
+	} else {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VREG, 0x2DU);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_VCO0, 0x5F03U);
+	}
+	/*
+	 * Set Feedback divisor value
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_FPDIV, PlanPtr->FeedbackDiv - 2U);
+
+	/*
+	 * Set Output divisor value
+	 */
+	XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_MASK, PlanPtr->Divider);
+
+	if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
+		XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_DIVIDER0, XRFDC_PLL_DIVIDER0_ALT_MASK,
+				PlanPtr->DividerAlt);
+	}
+	/*
+	 * Enable fine sweep
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CRS2, XRFDC_PLL_CRS2_VAL);
+
+	/*
+	 * Set PLL spare inputs LSB
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE0, PlanPtr->Spare0);
+
+	/*
+	 * Set PLL spare inputs MSB
+	 */
+	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x0U);
+	} else {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_SPARE1, 0x80U);
+	}
+
+	/*
+	 * Enable automatic selection of the VCO, this will work with the
+	 * IP version 2.0.1 and above and using older version of IP is
+	 * not likely to work.
+	 */
+
+	XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_PLL_CRS1, XRFDC_PLL_VCO_SEL_AUTO_MASK,
+			XRFDC_PLL_VCO_SEL_AUTO_MASK);
+
+	/*
+	 * PLL bits for loop filters LSB
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF0, PlanPtr->LoopFilter);
+
+	/*
+	 * PLL bits for loop filters MSB
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_LPF1, XRFDC_PLL_LPF1_VAL);
+
+	/*
+	 * Set PLL bits for charge pumps
+	 */
+	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_PLL_CHARGEPUMP, PlanPtr->ChargePump);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function used for configuring the internal PLL registers
+* based on reference clock and sampling rate. The frequency plan is taken
+* from the plan cache when one is set, otherwise it is computed, and added to
+* the cache if there is room.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type indicates ADC/DAC.
+* @param    Tile_Id indicates Tile number (0-3).
+* @param    RefClkFreq Reference Clock Frequency MHz(50MHz - 1.2GHz)
+* @param    SamplingRate Sampling Rate in MHz(0.5- 4 GHz)
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double RefClkFreq, double SamplingRate)
+{
+	u32 BaseAddr;
+	u32 Status;
+	double CalcSamplingRate;
+	u32 RefClkDiv = 0x1;
+	u16 ReadReg;
+	XRFdc_PLL_Plan Plan;
+	XRFdc_PLL_Plan *PlanPtr = NULL;
+	XRFdc_PLL_Plan_Cache *CachePtr = InstancePtr->PLLPlanCache;
+
+	if (Type == XRFDC_ADC_TILE) {
+		BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id);
+	} else {
+		BaseAddr = XRFDC_DAC_TILE_DRP_ADDR(Tile_Id);
+	}
+
+	BaseAddr += XRFDC_HSCOM_ADDR;
+
+	ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_PLL_REFDIV);
+	if (ReadReg & XRFDC_REFCLK_DIV_1_MASK) {
+		RefClkDiv = XRFDC_REF_CLK_DIV_1;
+	} else {
+		switch (ReadReg & XRFDC_REFCLK_DIV_MASK) {
+		case XRFDC_REFCLK_DIV_2_MASK:
+			RefClkDiv = XRFDC_REF_CLK_DIV_2;
+			break;
+		case XRFDC_REFCLK_DIV_3_MASK:
+			RefClkDiv = XRFDC_REF_CLK_DIV_3;
+			break;
+		case XRFDC_REFCLK_DIV_4_MASK:
+			RefClkDiv = XRFDC_REF_CLK_DIV_4;
+			break;
+		default:
+			/*
+				 * IP currently supporting 1 to 4 divider values. This
+				 * error condition might change in future based on IP update.
+				 */
+			metal_log(METAL_LOG_ERROR,
+				  "\n Unsupported Reference clock Divider value (%u) for %s %u in %s\r\n",
+				  (ReadReg & XRFDC_REFCLK_DIV_MASK), (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id,
+				  __func__);
+			return XRFDC_FAILURE;
+		}
+	}
+
+	RefClkFreq /= RefClkDiv;
+
+	if (CachePtr != NULL) {
+		PlanPtr = XRFdc_LookupPLLPlan(CachePtr, Type, RefClkFreq, SamplingRate);
 	}
 
-	CalcSamplingRate = (Best_FeedbackDiv * RefClkFreq) / Best_OutputDiv;
+	if (PlanPtr != NULL) {
+		CachePtr->Hits++;
+	} else {
+		Status = XRFdc_ComputePLLPlan(InstancePtr->RFdc_Config.IPType, Type, RefClkFreq, SamplingRate, &Plan);
+		if (Status != XRFDC_SUCCESS) {
+			metal_log(METAL_LOG_ERROR,
+				  "\n No valid PLL feedback divider for reference clock (%lf MHz) for %s %u in %s\r\n",
+				  RefClkFreq, (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, __func__);
+			return XRFDC_FAILURE;
+		}
+		PlanPtr = &Plan;
+		if (CachePtr != NULL) {
+			CachePtr->Misses++;
+			if (CachePtr->NumPlans < CachePtr->MaxPlans) {
+				CachePtr->Plans[CachePtr->NumPlans] = Plan;
+				CachePtr->NumPlans++;
+			}
+		}
+	}
+
+	XRFdc_WritePLLPlan(InstancePtr, BaseAddr, PlanPtr);
+
+	CalcSamplingRate = PlanPtr->ActualRate;
 	/* Store Sampling Frequency in kHz */
 	XRFdc_WriteReg(InstancePtr, XRFDC_CTRL_STS_BASE(Type, Tile_Id), XRFDC_PLL_FS,
 		       (u32)(CalcSamplingRate * XRFDC_MILLI));
@@ -1505,13 +1651,13 @@ static u32 XRFdc_SetPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, double
 	if (Type == XRFDC_ADC_TILE) {
 		InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.SampleRate = CalcSamplingRate;
 		InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.RefClkDivider = RefClkDiv;
-		InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.FeedbackDivider = Best_FeedbackDiv;
-		InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.OutputDivider = Best_OutputDiv;
+		InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.FeedbackDivider = PlanPtr->FeedbackDiv;
+		InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.OutputDivider = PlanPtr->OutputDiv;
 	} else {
 		InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.SampleRate = CalcSamplingRate;
 		InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.RefClkDivider = RefClkDiv;
-		InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.FeedbackDivider = Best_FeedbackDiv;
-		InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.OutputDivider = Best_OutputDiv;
+		InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.FeedbackDivider = PlanPtr->FeedbackDiv;
+		InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.OutputDivider = PlanPtr->OutputDiv;
 	}
 
 	Status = XRFDC_SUCCESS;
@@ -2035,6 +2181,143 @@ u32 XRFdc_DynamicPLLConfig(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u8 Source,
 RETURN_PATH:
 	return Status;
 }
+/*****************************************************************************/
+/**
+*
+* This function sets the PLL frequency plan cache of the instance. Once set,
+* XRFdc_DynamicPLLConfig() takes the PLL register values from the cache when
+* the reference clock and sampling rate have already been used, and adds the
+* plans it computes while there is room in the table.
+*
+* The first NumPlans entries of the table are kept as valid plans, so a table
+* computed offline with XRFdc_ComputePLLPlan() can be given to the driver
+* as is. Use 0 to start with an empty cache.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    CachePtr is a pointer to the cache, NULL to remove the cache.
+* @param    PlansPtr is a pointer to the table of plans.
+* @param    MaxPlans is the number of plans of the table.
+* @param    NumPlans is the number of valid plans at the start of the table.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     The cache must be set after XRFdc_CfgInitialize().
+*
+******************************************************************************/
+u32 XRFdc_PLLPlanCacheInit(XRFdc *InstancePtr, XRFdc_PLL_Plan_Cache *CachePtr, XRFdc_PLL_Plan *PlansPtr,
+			   u32 MaxPlans, u32 NumPlans)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (CachePtr == NULL) {
+		InstancePtr->PLLPlanCache = NULL;
+		Status = XRFDC_SUCCESS;
+		goto RETURN_PATH;
+	}
+
+	if ((PlansPtr == NULL) || (MaxPlans == 0U)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid PLL plan table in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (NumPlans > MaxPlans) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid number of PLL plans (%u of %u) in %s\r\n", NumPlans, MaxPlans,
+			  __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	CachePtr->Plans = PlansPtr;
+	CachePtr->MaxPlans = MaxPlans;
+	CachePtr->NumPlans = NumPlans;
+	CachePtr->Hits = 0U;
+	CachePtr->Misses = 0U;
+	InstancePtr->PLLPlanCache = CachePtr;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the PLL frequency plans of a list of sampling rates
+* for a reference clock, and adds them to the plan cache, so that the later
+* XRFdc_DynamicPLLConfig() calls with these rates do not search the dividers.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type indicates ADC/DAC.
+* @param    RefClkFreq Reference Clock Frequency in MHz, as given to
+*           XRFdc_DynamicPLLConfig().
+* @param    RefClkDiv is the reference clock divider of the tiles (1-4).
+* @param    SamplingRates is a pointer to the sampling rates in MHz.
+* @param    NumRates is the number of sampling rates.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if there is no cache, the cache is full or a
+*             rate has no valid plan.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_PLLPlanCompile(XRFdc *InstancePtr, u32 Type, double RefClkFreq, u32 RefClkDiv, const double *SamplingRates,
+			 u32 NumRates)
+{
+	u32 Status;
+	u32 Index;
+	XRFdc_PLL_Plan_Cache *CachePtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(SamplingRates != NULL);
+
+	CachePtr = InstancePtr->PLLPlanCache;
+	if (CachePtr == NULL) {
+		metal_log(METAL_LOG_ERROR, "\n PLL plan cache not set in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if ((RefClkDiv < XRFDC_REF_CLK_DIV_1) || (RefClkDiv > XRFDC_REF_CLK_DIV_4)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid reference clock divider (%u) in %s\r\n", RefClkDiv, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	RefClkFreq /= RefClkDiv;
+
+	for (Index = 0U; Index < NumRates; Index++) {
+		if (XRFdc_LookupPLLPlan(CachePtr, Type, RefClkFreq, SamplingRates[Index]) != NULL) {
+			continue;
+		}
+		if (CachePtr->NumPlans == CachePtr->MaxPlans) {
+			metal_log(METAL_LOG_ERROR, "\n PLL plan cache full (%u plans) in %s\r\n", CachePtr->MaxPlans,
+				  __func__);
+			Status = XRFDC_FAILURE;
+			goto RETURN_PATH;
+		}
+		Status = XRFdc_ComputePLLPlan(InstancePtr->RFdc_Config.IPType, Type, RefClkFreq, SamplingRates[Index],
+					      &CachePtr->Plans[CachePtr->NumPlans]);
+		if (Status != XRFDC_SUCCESS) {
+			metal_log(METAL_LOG_ERROR, "\n No valid PLL plan for sampling rate (%lf MHz) in %s\r\n",
+				  SamplingRates[Index], __func__);
+			goto RETURN_PATH;
+		}
+		CachePtr->NumPlans++;
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
 static void XRFdc_DistTile2TypeTile(XRFdc *InstancePtr, u32 DistTile, u32 *Type, u32 *Tile_Id)
 {
 	u8 DACEdgeTile;
@@ -54,6 +54,10 @@
 * 10.0  cog    11/26/20 Refactor and split files.
 * 11.0  cog    05/31/21 Upversion.
 * 11.1  cog    11/16/21 Upversion.
+*       ag     10/19/26 Added XRFdc_IntrDemuxHandler() and interrupt
+*                       statistics.
+*       ag     10/19/26 Read all the pending slices of a tile before the
+*                       clears and count the common tile interrupts.
 *
 * </pre>
 *
@@ -62,6 +66,9 @@
 /***************************** Include Files *********************************/
 
 #include "xrfdc.h"
+#include <metal/atomic.h>
+#include <metal/time.h>
+#include <string.h>
 
 /************************** Constant Definitions *****************************/
 
@@ -928,6 +935,364 @@ END_OF_BLOCK_LEVEL:
 	return (u32)METAL_IRQ_HANDLED;
 }
 
+/****************************************************************************/
+/**
+*
+* Reads the status registers of a converter slice once and returns their
+* pending bits as an interrupt mask in the format of XRFdc_GetIntrStatus().
+* The bits of every status register have their own place in the mask, so
+* the mask is enough to clear them, see XRFdc_IntrDemuxClear().
+*
+* @param    InstancePtr is a pointer to the XRFdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Index is the converter slice, valid values are 0-3.
+*
+* @return   The interrupt mask of the slice.
+*
+******************************************************************************/
+static u32 XRFdc_IntrDemuxRead(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Index)
+{
+	u32 BaseAddr;
+	u32 ReadReg;
+	u32 IntrMask = 0U;
+
+	BaseAddr = XRFDC_CTRL_STS_BASE(Type, Tile_Id);
+	ReadReg = XRFdc_ReadReg(InstancePtr, BaseAddr, XRFDC_CONV_INTR_STS(Index));
+	if (Type == XRFDC_ADC_TILE) {
+		IntrMask |= (ReadReg & (XRFDC_INTR_OVR_VOLTAGE_MASK | XRFDC_INTR_OVR_RANGE_MASK))
+			    << XRFDC_ADC_OVR_VOL_RANGE_SHIFT;
+		IntrMask |= (ReadReg & (XRFDC_INTR_CMODE_OVR_MASK | XRFDC_INTR_CMODE_UNDR_MASK))
+			    << XRFDC_ADC_CMODE_SHIFT;
+	}
+	IntrMask |= (ReadReg & (XRFDC_INTR_FIFO_OVR_MASK | XRFDC_INTR_DAT_OVR_MASK)) << XRFDC_DAT_FIFO_OVR_SHIFT;
+
+	if (Type == XRFDC_ADC_TILE) {
+		BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id) + XRFDC_BLOCK_ADDR_OFFSET(Index);
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_ADC_FABRIC_ISR_OFFSET);
+		IntrMask |= ReadReg & XRFDC_IXR_FIFOUSRDAT_MASK;
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_ADC_FABRIC_ISR_OBS_OFFSET);
+		IntrMask |= (ReadReg & XRFDC_IXR_FIFOUSRDAT_MASK) << XRFDC_IXR_FIFOUSRDAT_OBS_SHIFT;
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_ADC_DEC_ISR_OFFSET);
+		IntrMask |= (ReadReg & XRFDC_DEC_ISR_SUBADC_MASK) << XRFDC_ADC_SUBADC_DCDR_SHIFT;
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_DATPATH_ISR_OFFSET);
+		IntrMask |= (ReadReg & XRFDC_ADC_DAT_PATH_ISR_MASK) << XRFDC_DATA_PATH_SHIFT;
+	} else {
+		BaseAddr = XRFDC_DAC_TILE_DRP_ADDR(Tile_Id) + XRFDC_BLOCK_ADDR_OFFSET(Index);
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_DAC_FABRIC_ISR_OFFSET);
+		IntrMask |= ReadReg & XRFDC_IXR_FIFOUSRDAT_MASK;
+		IntrMask |= (ReadReg & XRFDC_DAC_FIFO_IMR_SUPP_MASK) << XRFDC_DAC_IXR_FIFOUSRDAT_SUPP_SHIFT;
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_DATPATH_ISR_OFFSET);
+		IntrMask |= (ReadReg & XRFDC_DAC_DAT_PATH_ISR_MASK) << XRFDC_DATA_PATH_SHIFT;
+	}
+
+	return IntrMask;
+}
+
+/****************************************************************************/
+/**
+*
+* Clears the pending bits of a converter slice read by XRFdc_IntrDemuxRead().
+* Every status register with pending bits gets one write with all of them,
+* where XRFdc_IntrClr() writes once per interrupt source, and the registers
+* with nothing pending are not written.
+*
+* @param    InstancePtr is a pointer to the XRFdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Index is the converter slice, valid values are 0-3.
+* @param    IntrMask is the interrupt mask of the slice.
+*
+* @return   None
+*
+******************************************************************************/
+static void XRFdc_IntrDemuxClear(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Index, u32 IntrMask)
+{
+	u32 BaseAddr;
+	u32 Pending;
+
+	Pending = (IntrMask & (XRFDC_FIFO_OVR_MASK | XRFDC_DAT_OVR_MASK)) >> XRFDC_DAT_FIFO_OVR_SHIFT;
+	if (Type == XRFDC_ADC_TILE) {
+		Pending |= (IntrMask & (XRFDC_ADC_OVR_VOLTAGE_MASK | XRFDC_ADC_OVR_RANGE_MASK)) >>
+			   XRFDC_ADC_OVR_VOL_RANGE_SHIFT;
+		Pending |= (IntrMask & (XRFDC_ADC_CMODE_OVR_MASK | XRFDC_ADC_CMODE_UNDR_MASK)) >> XRFDC_ADC_CMODE_SHIFT;
+	}
+	if (Pending != 0U) {
+		XRFdc_WriteReg(InstancePtr, XRFDC_CTRL_STS_BASE(Type, Tile_Id), XRFDC_CONV_INTR_STS(Index), Pending);
+	}
+
+	if (Type == XRFDC_ADC_TILE) {
+		BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id) + XRFDC_BLOCK_ADDR_OFFSET(Index);
+		Pending = IntrMask & XRFDC_IXR_FIFOUSRDAT_MASK;
+		if (Pending != 0U) {
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_FABRIC_ISR_OFFSET, Pending);
+		}
+		Pending = (IntrMask & XRFDC_IXR_FIFOUSRDAT_OBS_MASK) >> XRFDC_IXR_FIFOUSRDAT_OBS_SHIFT;
+		if (Pending != 0U) {
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_FABRIC_ISR_OBS_OFFSET, Pending);
+		}
+		Pending = (IntrMask & XRFDC_SUBADC_IXR_DCDR_MASK) >> XRFDC_ADC_SUBADC_DCDR_SHIFT;
+		if (Pending != 0U) {
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_DEC_ISR_OFFSET, Pending);
+		}
+		Pending = (IntrMask & XRFDC_ADC_IXR_DATAPATH_MASK) >> XRFDC_DATA_PATH_SHIFT;
+	} else {
+		BaseAddr = XRFDC_DAC_TILE_DRP_ADDR(Tile_Id) + XRFDC_BLOCK_ADDR_OFFSET(Index);
+		Pending = (IntrMask & XRFDC_IXR_FIFOUSRDAT_MASK) |
+			  ((IntrMask & XRFDC_DAC_IXR_FIFOUSRDAT_SUPP_MASK) >> XRFDC_DAC_IXR_FIFOUSRDAT_SUPP_SHIFT);
+		if (Pending != 0U) {
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_DAC_FABRIC_ISR_OFFSET, Pending);
+		}
+		Pending = (IntrMask & XRFDC_DAC_IXR_DATAPATH_MASK) >> XRFDC_DATA_PATH_SHIFT;
+	}
+	if (Pending != 0U) {
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_DATPATH_ISR_OFFSET, Pending);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Adds an interrupt event to the statistics of a block. The sequence counter
+* is odd while the counters are updated, see XRFdc_GetIntrBlockStats().
+*
+* @param    StatsPtr is a pointer to the statistics of the block.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    IntrMask is the interrupt mask of the event.
+*
+* @return   None
+*
+******************************************************************************/
+static void XRFdc_IntrUpdateStats(XRFdc_Intr_Block_Stats *StatsPtr, u32 Type, u32 IntrMask)
+{
+	StatsPtr->Sequence++;
+	atomic_thread_fence(memory_order_release);
+
+	StatsPtr->Events++;
+	if (Type == XRFDC_ADC_TILE) {
+		if ((IntrMask & XRFDC_ADC_OVR_VOLTAGE_MASK) != 0U) {
+			StatsPtr->OverVoltage++;
+		}
+		if ((IntrMask & XRFDC_ADC_OVR_RANGE_MASK) != 0U) {
+			StatsPtr->OverRange++;
+		}
+		if ((IntrMask & (XRFDC_ADC_CMODE_OVR_MASK | XRFDC_ADC_CMODE_UNDR_MASK)) != 0U) {
+			StatsPtr->CommonMode++;
+		}
+		if ((IntrMask & (XRFDC_IXR_FIFOUSRDAT_MASK | XRFDC_IXR_FIFOUSRDAT_OBS_MASK)) != 0U) {
+			StatsPtr->FifoInterface++;
+		}
+		if ((IntrMask & XRFDC_SUBADC_IXR_DCDR_MASK) != 0U) {
+			StatsPtr->Decoder++;
+		}
+		if ((IntrMask & XRFDC_ADC_IXR_DATAPATH_MASK) != 0U) {
+			StatsPtr->DataPath++;
+		}
+	} else {
+		if ((IntrMask & XRFDC_DAC_IXR_FIFOUSRDAT_MASK) != 0U) {
+			StatsPtr->FifoInterface++;
+		}
+		if ((IntrMask & XRFDC_DAC_IXR_DATAPATH_MASK) != 0U) {
+			StatsPtr->DataPath++;
+		}
+	}
+	if ((IntrMask & (XRFDC_FIFO_OVR_MASK | XRFDC_DAT_OVR_MASK)) != 0U) {
+		StatsPtr->ConvOverflow++;
+	}
+	StatsPtr->LastStatus = IntrMask;
+	StatsPtr->LastTimestamp = metal_get_timestamp();
+
+	atomic_thread_fence(memory_order_release);
+	StatsPtr->Sequence++;
+}
+
+/****************************************************************************/
+/**
+*
+* This function is an alternative interrupt handler for the driver that
+* services all the pending tiles and blocks in one call. The common status
+* is read once and only the pending tiles and slices are visited. The status
+* of all the pending slices of a tile is read first, then the clears of the
+* tile are issued together, one write per status register with pending bits.
+* If set with XRFdc_SetIntrStats(), the per block statistics and the common
+* interrupts of the tiles are counted.
+* The status handler is called once per pending block, or once with
+* XRFDC_BLK_ID_NONE for a tile that has only the common interrupt pending.
+*
+* @param    Vector is interrupt vector number, not used.
+* @param    XRFdcPtr contains a pointer to the driver instance
+*
+* @return   METAL_IRQ_HANDLED
+*
+* @note     Connect either this handler or XRFdc_IntrHandler(), not both.
+*
+******************************************************************************/
+u32 XRFdc_IntrDemuxHandler(u32 Vector, void *XRFdcPtr)
+{
+	XRFdc *InstancePtr = (XRFdc *)XRFdcPtr;
+	XRFdc_Intr_Stats *StatsPtr;
+	u32 CommonSts;
+	u32 TileSts;
+	u32 Type;
+	u32 Tile_Id;
+	u32 Index;
+	u32 Block;
+	u32 HighSpeed;
+	u32 IntrMask[XRFDC_NUM_OF_BLKS4];
+	u32 SliceMask[XRFDC_NUM_OF_BLKS4];
+	u32 CommonMask;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	(void)Vector;
+	StatsPtr = InstancePtr->IntrStats;
+	if (StatsPtr != NULL) {
+		StatsPtr->Interrupts++;
+	}
+
+	CommonSts = XRFdc_ReadReg16(InstancePtr, 0x0, XRFDC_COMMON_INTR_STS);
+	if ((CommonSts & (XRFDC_EN_INTR_DAC_TILE0_MASK | XRFDC_EN_INTR_DAC_TILE1_MASK | XRFDC_EN_INTR_DAC_TILE2_MASK |
+			  XRFDC_EN_INTR_DAC_TILE3_MASK | XRFDC_EN_INTR_ADC_TILE0_MASK | XRFDC_EN_INTR_ADC_TILE1_MASK |
+			  XRFDC_EN_INTR_ADC_TILE2_MASK | XRFDC_EN_INTR_ADC_TILE3_MASK)) == 0U) {
+		metal_log(METAL_LOG_DEBUG, "\n No tile interrupt pending \r\n");
+		if (StatsPtr != NULL) {
+			StatsPtr->Spurious++;
+		}
+		goto RETURN_PATH;
+	}
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			TileSts = (Type == XRFDC_ADC_TILE) ? XRFDC_EN_INTR_ADC_TILE0_MASK : XRFDC_EN_INTR_DAC_TILE0_MASK;
+			if ((CommonSts & (TileSts << Tile_Id)) == 0U) {
+				continue;
+			}
+			TileSts = XRFdc_ReadReg16(InstancePtr, XRFDC_CTRL_STS_BASE(Type, Tile_Id), XRFDC_INTR_STS);
+			CommonMask = ((TileSts & XRFDC_INTR_COMMON_MASK) != 0U) ? XRFDC_COMMON_MASK : 0U;
+			if ((CommonMask != 0U) && (StatsPtr != NULL)) {
+				StatsPtr->Common[Type][Tile_Id]++;
+			}
+			if ((TileSts & XRFDC_EN_INTR_SLICE_MASK) == 0U) {
+				if (CommonMask != 0U) {
+					InstancePtr->StatusHandler(InstancePtr->CallBackRef, Type, Tile_Id, XRFDC_BLK_ID_NONE,
+								   CommonMask);
+				}
+				continue;
+			}
+
+			HighSpeed = ((Type == XRFDC_ADC_TILE) && (XRFdc_IsHighSpeedADC(InstancePtr, Tile_Id) == 1)) ?
+					    1U :
+					    0U;
+			for (Index = XRFDC_BLK_ID0; Index < XRFDC_NUM_OF_BLKS4; Index++) {
+				IntrMask[Index] = 0U;
+				SliceMask[Index] = 0U;
+				if ((TileSts & (XRFDC_EN_INTR_SLICE0_MASK << Index)) != 0U) {
+					SliceMask[Index] = XRFdc_IntrDemuxRead(InstancePtr, Type, Tile_Id, Index);
+				}
+			}
+			for (Index = XRFDC_BLK_ID0; Index < XRFDC_NUM_OF_BLKS4; Index++) {
+				if (SliceMask[Index] != 0U) {
+					XRFdc_IntrDemuxClear(InstancePtr, Type, Tile_Id, Index, SliceMask[Index]);
+				}
+				if ((TileSts & (XRFDC_EN_INTR_SLICE0_MASK << Index)) != 0U) {
+					Block = (HighSpeed == 1U) ? (Index >> 1U) : Index;
+					IntrMask[Block] |= CommonMask | SliceMask[Index];
+				}
+			}
+			for (Block = XRFDC_BLK_ID0; Block < XRFDC_NUM_OF_BLKS4; Block++) {
+				if (IntrMask[Block] == 0U) {
+					continue;
+				}
+				if (StatsPtr != NULL) {
+					XRFdc_IntrUpdateStats(&StatsPtr->Block[Type][Tile_Id][Block], Type,
+							      IntrMask[Block]);
+				}
+				InstancePtr->StatusHandler(InstancePtr->CallBackRef, Type, Tile_Id, Block,
+							   IntrMask[Block]);
+			}
+		}
+	}
+
+RETURN_PATH:
+	return (u32)METAL_IRQ_HANDLED;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the statistics updated by XRFdc_IntrDemuxHandler().
+* The statistics are cleared.
+*
+* @param    InstancePtr is a pointer to the XRFdc instance.
+* @param    StatsPtr is a pointer to the statistics, NULL to stop counting.
+*
+* @return   None
+*
+* @note     Call with the interrupt disabled.
+*
+******************************************************************************/
+void XRFdc_SetIntrStats(XRFdc *InstancePtr, XRFdc_Intr_Stats *StatsPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (StatsPtr != NULL) {
+		memset(StatsPtr, 0, sizeof(XRFdc_Intr_Stats));
+	}
+	InstancePtr->IntrStats = StatsPtr;
+}
+
+/****************************************************************************/
+/**
+*
+* This function takes a consistent snapshot of the interrupt statistics of a
+* block. It does not lock, the copy is retried while the interrupt handler
+* updates the block, so it may be called from any thread.
+*
+* @param    InstancePtr is a pointer to the XRFdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile. Valid values
+*           are 0-3.
+* @param    StatsPtr is a pointer to the snapshot.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if no statistics are set or the block is invalid.
+*
+******************************************************************************/
+u32 XRFdc_GetIntrBlockStats(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
+			    XRFdc_Intr_Block_Stats *StatsPtr)
+{
+	const XRFdc_Intr_Block_Stats *BlockPtr;
+	u32 Sequence;
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(StatsPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if ((InstancePtr->IntrStats == NULL) || (Type > XRFDC_DAC_TILE) || (Tile_Id > XRFDC_TILE_ID3) ||
+	    (Block_Id > XRFDC_BLK_ID3)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid interrupt statistics request in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	BlockPtr = &InstancePtr->IntrStats->Block[Type][Tile_Id][Block_Id];
+	do {
+		Sequence = BlockPtr->Sequence;
+		atomic_thread_fence(memory_order_acquire);
+		memcpy(StatsPtr, (const void *)BlockPtr, sizeof(XRFdc_Intr_Block_Stats));
+		atomic_thread_fence(memory_order_acquire);
+	} while (((Sequence & 1U) != 0U) || (Sequence != BlockPtr->Sequence));
+	StatsPtr->Sequence = Sequence;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
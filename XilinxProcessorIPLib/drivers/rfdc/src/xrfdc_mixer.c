@@ -56,12 +56,18 @@
 * 11.0  cog    05/31/21 Upversion.
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Added safety checks.
+*       ag     10/19/26 Added XRFdc_NCOBatchReset(), XRFdc_NCOBatchAdd() and
+*                       XRFdc_NCOBatchCommit() to retune the NCOs of several
+*                       blocks with one update event per tile.
+*       ag     10/19/26 XRFdc_NCOBatchAdd() stages both blocks of a high
+*                       speed ADC pair, or none of them.
 * </pre>
 *
 ******************************************************************************/
 
 /***************************** Include Files *********************************/
 #include "xrfdc.h"
+#include <metal/time.h>
 
 /************************** Constant Definitions *****************************/
 
@@ -74,6 +80,8 @@ static void XRFdc_SetCoarseMixer(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32
 static u32 XRFdc_MixerRangeCheck(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
 				 XRFdc_Mixer_Settings *MixerSettingsPtr);
 static void XRFdc_MixersOff(XRFdc *InstancePtr, u32 BaseAddr);
+static u32 XRFdc_GetNCOFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double SamplingRate,
+				double NCOFreq, s64 *FreqWordPtr);
 
 /************************** Function Prototypes ******************************/
 
@@ -118,7 +126,6 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 	u8 CalibrationMode = 0U;
 	u32 CoarseMixFreq;
 	double NCOFreq;
-	u32 NyquistZone = 0U;
 	u32 Offset;
 	u32 DatapathMode;
 	u32 BWDiv = XRFDC_FULL_BW_DIVISOR;
@@ -271,27 +278,12 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 			}
 		}
 
-		if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
-			Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
-			if (Status != XRFDC_SUCCESS) {
-				return XRFDC_FAILURE;
-			}
-			do {
-				if (NCOFreq < -(SamplingRate / 2.0)) {
-					NCOFreq += SamplingRate;
-				}
-				if (NCOFreq > (SamplingRate / 2.0)) {
-					NCOFreq -= SamplingRate;
-				}
-			} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
-
-			if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
-				NCOFreq *= -1;
-			}
+		Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id, Block_Id, SamplingRate, NCOFreq, &Freq);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
 		}
 
 		/* NCO Frequency */
-		Freq = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
 		ReadReg = (Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK;
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, (u16)ReadReg);
@@ -512,6 +504,57 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* Static API used to compute the NCO frequency word. The frequency is folded
+* into the first Nyquist zone and inverted for the even Nyquist zone.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile.
+* @param    SamplingRate is the NCO sampling rate in MHz.
+* @param    NCOFreq is the NCO frequency in MHz.
+* @param    FreqWordPtr is a pointer to the computed frequency word.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the Nyquist zone can't be read.
+*
+* @note     Static API
+*
+******************************************************************************/
+static u32 XRFdc_GetNCOFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double SamplingRate,
+				double NCOFreq, s64 *FreqWordPtr)
+{
+	u32 Status = XRFDC_SUCCESS;
+	u32 NyquistZone = 0U;
+
+	if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
+		Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+		do {
+			if (NCOFreq < -(SamplingRate / 2.0)) {
+				NCOFreq += SamplingRate;
+			}
+			if (NCOFreq > (SamplingRate / 2.0)) {
+				NCOFreq -= SamplingRate;
+			}
+		} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
+
+		if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
+			NCOFreq *= -1;
+		}
+	}
+
+	*FreqWordPtr = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * Static API used to turn off Fine & Coarse Mixers.
@@ -1156,4 +1199,307 @@ u32 XRFdc_GetDataType(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id)
 	return MixerInputDataType;
 }
 
+/*****************************************************************************/
+/**
+* This API empties an NCO batch and clears its statistics.
+*
+* @param    BatchPtr is a pointer to the NCO batch.
+*
+* @return
+*           - None
+*
+******************************************************************************/
+void XRFdc_NCOBatchReset(XRFdc_NCO_Batch *BatchPtr)
+{
+	Xil_AssertVoid(BatchPtr != NULL);
+
+	memset(BatchPtr, 0, sizeof(XRFdc_NCO_Batch));
+}
+
+/*****************************************************************************/
+/**
+* This API stages a new NCO frequency and phase offset for a block. All the
+* checks, the register reads and the computation of the NCO words are done
+* here, so XRFdc_NCOBatchCommit() only writes registers. Staging a block which
+* is already in the batch replaces its staged settings. Block 1 of a high
+* speed ADC tile stages the two blocks of the pair, either both or none of
+* them are staged.
+*
+* The mixer of the block must have been set to the fine mixer with
+* XRFdc_SetMixerSettings(), the other mixer settings are not changed. The NCO
+* event source of the block is set to the tile event on commit.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    BatchPtr is a pointer to the NCO batch.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile. Valid values
+*           are 0-3.
+* @param    Freq is the NCO frequency in MHz, as in XRFdc_Mixer_Settings.
+* @param    PhaseOffset is the NCO phase offset in degrees.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     Common API for ADC/DAC blocks
+*
+******************************************************************************/
+u32 XRFdc_NCOBatchAdd(XRFdc *InstancePtr, XRFdc_NCO_Batch *BatchPtr, u32 Type, u32 Tile_Id, u32 Block_Id,
+		      double Freq, double PhaseOffset)
+{
+	u32 Status;
+	u32 BaseAddr;
+	u32 NoOfBlocks;
+	u32 Index;
+	u32 Stage;
+	u32 Pair;
+	u32 NumPair = 0U;
+	u32 NumNew = 0U;
+	u32 Slot[XRFDC_NUM_OF_BLKS2];
+	u32 DatapathMode;
+	u32 BWDiv = XRFDC_FULL_BW_DIVISOR;
+	u8 CalibrationMode = 0U;
+	u16 ReadReg;
+	double SamplingRate;
+	double NCOFreq = Freq;
+	s64 FreqWord;
+	s32 PhaseWord;
+	u64 StartTime;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+	XRFdc_NCO_Stage *StagePtr;
+	XRFdc_NCO_Stage Staged[XRFDC_NUM_OF_BLKS2];
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BatchPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	StartTime = metal_get_timestamp();
+
+	Status = XRFdc_CheckDigitalPathEnabled(InstancePtr, Type, Tile_Id, Block_Id);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+
+	if ((PhaseOffset >= XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT) || (PhaseOffset <= XRFDC_MIXER_PHASE_OFFSET_LOW_LIMIT)) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid phase offset value (%lf) for %s %u block %u in %s\r\n",
+			  PhaseOffset, (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	Index = Block_Id;
+	if ((XRFdc_IsHighSpeedADC(InstancePtr, Tile_Id) == 1) && (Type == XRFDC_ADC_TILE)) {
+		NoOfBlocks = XRFDC_NUM_OF_BLKS2;
+		if (Block_Id == XRFDC_BLK_ID1) {
+			Index = XRFDC_BLK_ID2;
+			NoOfBlocks = XRFDC_NUM_OF_BLKS4;
+		}
+	} else {
+		NoOfBlocks = Block_Id + 1U;
+	}
+
+	if (Type == XRFDC_ADC_TILE) {
+		MixerConfigPtr = &InstancePtr->ADC_Tile[Tile_Id].ADCBlock_Digital_Datapath[Index].Mixer_Settings;
+		SamplingRate = InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.SampleRate;
+	} else {
+		if (InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) {
+			DatapathMode = XRFdc_RDReg(InstancePtr, XRFDC_BLOCK_BASE(XRFDC_DAC_TILE, Tile_Id, Block_Id),
+						   XRFDC_DAC_DATAPATH_OFFSET, XRFDC_DATAPATH_MODE_MASK);
+			if (DatapathMode == XRFDC_DAC_INT_MODE_FULL_BW_BYPASS) {
+				metal_log(METAL_LOG_ERROR, "\n DAC %u DUC %u is in bypass mode in %s\r\n", Tile_Id,
+					  Block_Id, __func__);
+				Status = XRFDC_FAILURE;
+				goto RETURN_PATH;
+			}
+			if (DatapathMode == XRFDC_DAC_INT_MODE_HALF_BW_IMR) {
+				BWDiv = XRFDC_HALF_BW_DIVISOR;
+			}
+		}
+		MixerConfigPtr = &InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Index].Mixer_Settings;
+		SamplingRate = InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.SampleRate / BWDiv;
+	}
+
+	if (MixerConfigPtr->MixerType != XRFDC_MIXER_TYPE_FINE) {
+		metal_log(METAL_LOG_ERROR, "\n Fine mixer not set for %s %u block %u in %s\r\n",
+			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (SamplingRate <= 0) {
+		metal_log(METAL_LOG_ERROR, "\n Incorrect Sampling rate (%2.4f GHz) for %s %u in %s\r\n", SamplingRate,
+			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	SamplingRate *= XRFDC_MILLI;
+
+	if ((InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) && (Type == XRFDC_ADC_TILE)) {
+		Status = XRFdc_GetCalibrationMode(InstancePtr, Tile_Id, Block_Id, &CalibrationMode);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+		if (CalibrationMode == XRFDC_CALIB_MODE1) {
+			NCOFreq -= SamplingRate / 2.0;
+		}
+	}
+
+	Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id, Block_Id, SamplingRate, NCOFreq, &FreqWord);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	PhaseWord = ((PhaseOffset * XRFDC_NCO_PHASE_MULTIPLIER) / XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT);
+
+	/* The blocks of a high speed ADC pair are staged locally first */
+	for (; Index < NoOfBlocks; Index++) {
+		StagePtr = &Staged[NumPair];
+		BaseAddr = XRFDC_BLOCK_BASE(Type, Tile_Id, Index);
+		StagePtr->Type = Type;
+		StagePtr->Tile_Id = Tile_Id;
+		StagePtr->Block_Id = Index;
+		StagePtr->BaseAddr = BaseAddr;
+		StagePtr->FreqWord[0] = (u16)FreqWord;
+		StagePtr->FreqWord[1] = (u16)((FreqWord >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK);
+		StagePtr->FreqWord[2] = (u16)((FreqWord >> XRFDC_NCO_FQWD_UPP_SHIFT) & XRFDC_NCO_FQWD_UPP_MASK);
+		StagePtr->PhaseWord[0] = (u16)PhaseWord;
+		StagePtr->PhaseWord[1] = (u16)((PhaseWord >> XRFDC_NCO_PHASE_UPP_SHIFT) & XRFDC_NCO_PHASE_UPP_MASK);
+		StagePtr->Freq = Freq;
+		StagePtr->PhaseOffset = PhaseOffset;
+
+		ReadReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_NCO_UPDT_OFFSET);
+		StagePtr->SetNCOUpdate = ((ReadReg & XRFDC_NCO_UPDT_MODE_MASK) != XRFDC_NCO_UPDT_MODE_TILE) ? 1U : 0U;
+		StagePtr->NCOUpdate = (ReadReg & ~XRFDC_NCO_UPDT_MODE_MASK) | XRFDC_NCO_UPDT_MODE_TILE;
+		NumPair++;
+	}
+
+	for (Pair = 0U; Pair < NumPair; Pair++) {
+		for (Stage = 0U; Stage < BatchPtr->NumStaged; Stage++) {
+			StagePtr = &BatchPtr->Stage[Stage];
+			if ((StagePtr->Type == Type) && (StagePtr->Tile_Id == Tile_Id) &&
+			    (StagePtr->Block_Id == Staged[Pair].Block_Id)) {
+				break;
+			}
+		}
+		if (Stage == BatchPtr->NumStaged) {
+			Stage += NumNew;
+			NumNew++;
+		}
+		Slot[Pair] = Stage;
+	}
+	if ((BatchPtr->NumStaged + NumNew) > XRFDC_NCO_BATCH_MAX) {
+		metal_log(METAL_LOG_ERROR, "\n NCO batch is full in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	for (Pair = 0U; Pair < NumPair; Pair++) {
+		BatchPtr->Stage[Slot[Pair]] = Staged[Pair];
+	}
+	BatchPtr->NumStaged += NumNew;
+	BatchPtr->TileMask[Type] |= (u8)(1U << Tile_Id);
+	Status = XRFDC_SUCCESS;
+
+RETURN_PATH:
+	BatchPtr->Stats.PrepareTime += metal_get_timestamp() - StartTime;
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This API writes the staged NCO words of a batch and issues one update event
+* per tile, so all the staged blocks of a tile change frequency on the same
+* event. The batch is emptied, the statistics are kept.
+*
+* The events of the different tiles are issued one after the other. For a
+* retune aligned across tiles, use the SYSREF event source with
+* XRFdc_SetMixerSettings() instead.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    BatchPtr is a pointer to the NCO batch.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*
+* @note     Common API for ADC/DAC blocks
+*
+******************************************************************************/
+u32 XRFdc_NCOBatchCommit(XRFdc *InstancePtr, XRFdc_NCO_Batch *BatchPtr)
+{
+	u32 Stage;
+	u32 Type;
+	u32 Tile_Id;
+	u32 BaseAddr;
+	u32 RegWrites = 0U;
+	u32 Events = 0U;
+	u64 StartTime;
+	XRFdc_NCO_Stage *StagePtr;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BatchPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	StartTime = metal_get_timestamp();
+
+	for (Stage = 0U; Stage < BatchPtr->NumStaged; Stage++) {
+		StagePtr = &BatchPtr->Stage[Stage];
+		BaseAddr = StagePtr->BaseAddr;
+		if (StagePtr->SetNCOUpdate == 1U) {
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_UPDT_OFFSET, StagePtr->NCOUpdate);
+			RegWrites++;
+		}
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, StagePtr->FreqWord[0]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, StagePtr->FreqWord[1]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_UPP_OFFSET, StagePtr->FreqWord[2]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_PHASE_LOW_OFFSET, StagePtr->PhaseWord[0]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_PHASE_UPP_OFFSET, StagePtr->PhaseWord[1]);
+		RegWrites += 5U;
+	}
+
+	for (Type = XRFDC_ADC_TILE; Type <= XRFDC_DAC_TILE; Type++) {
+		for (Tile_Id = 0U; Tile_Id <= XRFDC_TILE_ID_MAX; Tile_Id++) {
+			if ((BatchPtr->TileMask[Type] & (1U << Tile_Id)) == 0U) {
+				continue;
+			}
+			if (Type == XRFDC_ADC_TILE) {
+				BaseAddr = XRFDC_ADC_TILE_DRP_ADDR(Tile_Id) + XRFDC_HSCOM_ADDR;
+			} else {
+				BaseAddr = XRFDC_DAC_TILE_DRP_ADDR(Tile_Id) + XRFDC_HSCOM_ADDR;
+			}
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_HSCOM_UPDT_DYN_OFFSET, 0x1);
+			RegWrites++;
+			Events++;
+		}
+	}
+
+	BatchPtr->Stats.CommitTime = metal_get_timestamp() - StartTime;
+
+	/* Update the instance with new values */
+	for (Stage = 0U; Stage < BatchPtr->NumStaged; Stage++) {
+		StagePtr = &BatchPtr->Stage[Stage];
+		if (StagePtr->Type == XRFDC_ADC_TILE) {
+			MixerConfigPtr = &InstancePtr->ADC_Tile[StagePtr->Tile_Id]
+						  .ADCBlock_Digital_Datapath[StagePtr->Block_Id]
+						  .Mixer_Settings;
+		} else {
+			MixerConfigPtr = &InstancePtr->DAC_Tile[StagePtr->Tile_Id]
+						  .DACBlock_Digital_Datapath[StagePtr->Block_Id]
+						  .Mixer_Settings;
+		}
+		MixerConfigPtr->Freq = StagePtr->Freq;
+		MixerConfigPtr->PhaseOffset = StagePtr->PhaseOffset;
+		MixerConfigPtr->EventSource = XRFDC_EVNT_SRC_TILE;
+	}
+
+	BatchPtr->Stats.RegWrites = RegWrites;
+	BatchPtr->Stats.Events = Events;
+	BatchPtr->Stats.Commits++;
+	BatchPtr->NumStaged = 0U;
+	BatchPtr->TileMask[XRFDC_ADC_TILE] = 0U;
+	BatchPtr->TileMask[XRFDC_DAC_TILE] = 0U;
+
+	return XRFDC_SUCCESS;
+}
+
 /** @} */
@@ -55,6 +55,8 @@
 *       cog    01/18/22 Added safety checks.
 *       cog    01/18/22 Add cast in XRFdc_MTS_Dtc_Calc.
 *       cog    01/18/22 Initialize DatapathMode in XRFdc_MTS_Latency.
+*       ag     10/19/26 Scan the DTC codes of all the tiles together in parallel
+*                       bring-up mode.
 *
 * </pre>
 *
@@ -107,6 +109,9 @@ static void XRFdc_MTS_Sysref_Ctrl(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32
 static u32 XRFdc_MTS_Sysref_Dist(XRFdc *InstancePtr, int Num_DAC);
 static u32 XRFdc_MTS_Sysref_Count(XRFdc *InstancePtr, u32 Type, u32 Count_Val);
 static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_MTS_DTC_Settings *SettingsPtr);
+static u32 XRFdc_MTS_Dtc_Scan_Tiles(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MTS_DTC_Settings *SettingsPtr);
+static void XRFdc_MTS_Dtc_Set(XRFdc *InstancePtr, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl, u16 SRclr_m,
+			      u32 Code);
 static u32 XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl,
 			      u16 SRclr_m, u32 Code);
 static u32 XRFdc_MTS_Dtc_Calc(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_MTS_DTC_Settings *SettingsPtr,
@@ -539,6 +544,34 @@ static u32 XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32 SR
 {
 	u32 Status;
 
+	XRFdc_MTS_Dtc_Set(InstancePtr, BaseAddr, SRCtrlAddr, DTCAddr, SRctl, SRclr_m, Code);
+
+	Status = XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API Set a DTC code and clear the SysRef capture, without waiting for
+* the SysRef count
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    BaseAddr is for internal usage.
+* @param    SRCtrlAddr is for internal usage.
+* @param    DTCAddr is for internal usage.
+* @param    SRctl is for internal usage.
+* @param    SRclr_m is for internal usage.
+* @param    Code is for internal usage.
+*
+* @note     None.
+*
+******************************************************************************/
+static void XRFdc_MTS_Dtc_Set(XRFdc *InstancePtr, u32 BaseAddr, u32 SRCtrlAddr, u32 DTCAddr, u16 SRctl, u16 SRclr_m,
+			      u32 Code)
+{
 	/* set the DTC code */
 	XRFdc_WriteReg16(InstancePtr, BaseAddr, DTCAddr, Code);
 
@@ -547,10 +580,6 @@ static u32 XRFdc_MTS_Dtc_Code(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32 SR
 
 	/* unset sysref cap clear */
 	XRFdc_WriteReg16(InstancePtr, BaseAddr, SRCtrlAddr, SRctl);
-
-	Status = XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
-
-	return Status;
 }
 
 /*****************************************************************************/
@@ -632,41 +661,164 @@ static u32 XRFdc_MTS_Dtc_Scan(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, XRFdc_M
 /*****************************************************************************/
 /**
 *
-* This API Scans the DTC codes and determine the optimal capture code for
-* PLL cases
+* This API Scan the DTC codes of a set of tiles together and determine the
+* optimal capture code of each tile. Every code is set on all the tiles before
+* waiting for the SysRef count, so the scan costs the SysRef waits of a
+* single tile. The codes are then calculated as by XRFdc_MTS_Dtc_Scan(),
+* starting with the reference tile.
 *
 *
 * @param    InstancePtr is a pointer to the XRfdc instance.
 * @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
-* @param    Tile_Id Valid values are 0-3.
+* @param    Tiles is the mask of the tiles to scan.
 * @param    SettingsPtr dtc settings structure.
 *
 * @return
-*         - XRFDC_MTS_OK if successful.
-*         - XRFDC_MTS_TIMEOUT if timeout occurs.
+* 		- XRFDC_MTS_OK if successful.
+*           - XRFDC_MTS_TIMEOUT if timeout occurs.
 *
 * @note     None.
 *
 ******************************************************************************/
-static u32 XRFdc_MTS_Dtc_Scan_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id,
-				  XRFdc_MultiConverter_Sync_Config *ConfigPtr)
+static u32 XRFdc_MTS_Dtc_Scan_Tiles(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MTS_DTC_Settings *SettingsPtr)
 {
 	u32 Status;
+	u32 BaseAddr;
+	u32 SRCtrlAddr;
+	u32 DTCAddr;
+	u8 Flags[XRFDC_TILE_ID4][XRFDC_MTS_NUM_DTC + 1];
+	u16 SRctl[XRFDC_TILE_ID4];
+	u16 SRclr_m;
+	u16 Flag_s;
+	u32 Index;
+	u32 Tile_Id;
+	u32 Order;
+
+	Status = XRFDC_MTS_OK;
+	if (Tiles == 0U) {
+		return Status;
+	}
+
+	SRCtrlAddr = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRCAP_PLL : XRFDC_MTS_SRCAP_T1;
+	DTCAddr = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRDTC_PLL : XRFDC_MTS_SRDTC_T1;
+	SRclr_m = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRCLR_PLL_M : XRFDC_MTS_SRCLR_T1_M;
+	Flag_s = (SettingsPtr->IsPLL != 0U) ? XRFDC_MTS_SRFLAG_PLL : XRFDC_MTS_SRFLAG_T1;
+
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tiles & (1U << Tile_Id)) == 0U) {
+			continue;
+		}
+		BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+
+		/*  Enable SysRef Capture and Disable Divide Reset */
+		XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, SettingsPtr->IsPLL, 1, 0);
+		SRctl[Tile_Id] = XRFdc_ReadReg16(InstancePtr, BaseAddr, SRCtrlAddr) & ~SRclr_m;
+
+		for (Index = 0U; Index < XRFDC_MTS_NUM_DTC; Index++) {
+			Flags[Tile_Id][Index] = 0U;
+		}
+	}
+
+	for (Index = 0U; (Index < XRFDC_MTS_NUM_DTC) && (Status == XRFDC_MTS_OK); Index++) {
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+				XRFdc_MTS_Dtc_Set(InstancePtr, BaseAddr, SRCtrlAddr, DTCAddr, SRctl[Tile_Id], SRclr_m,
+						  Index);
+			}
+		}
+		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+				Flags[Tile_Id][Index] =
+					(XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_SRFLAG) >> Flag_s) & 0x3U;
+			}
+		}
+	}
+
+	/* Calculate and program the best DTC codes, starting with the reference tile */
+	for (Order = 0U; Order <= XRFDC_TILE_ID4; Order++) {
+		if (Order == 0U) {
+			Tile_Id = SettingsPtr->RefTile;
+		} else if ((Order - 1U) != SettingsPtr->RefTile) {
+			Tile_Id = Order - 1U;
+		} else {
+			continue;
+		}
+		if ((Tile_Id >= XRFDC_TILE_ID4) || ((Tiles & (1U << Tile_Id)) == 0U)) {
+			continue;
+		}
+
+		(void)XRFdc_MTS_Dtc_Calc(InstancePtr, Type, Tile_Id, SettingsPtr, Flags[Tile_Id]);
+
+		if (SettingsPtr->DTC_Code[Tile_Id] == -1) {
+			metal_log(METAL_LOG_ERROR, "Unable to capture analog SysRef safely on %s tile %d\n",
+				  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id);
+			Status |= XRFDC_MTS_DTC_INVALID;
+		} else {
+			BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
+			XRFdc_MTS_Dtc_Set(InstancePtr, BaseAddr, SRCtrlAddr, DTCAddr, SRctl[Tile_Id], SRclr_m,
+					  SettingsPtr->DTC_Code[Tile_Id]);
+		}
+	}
+	(void)XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if ((Tiles & (1U << Tile_Id)) == 0U) {
+			continue;
+		}
+		if (SettingsPtr->IsPLL != 0U) {
+			/* PLL - Disable SysRef Capture */
+			XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 1, 0, 0);
+		} else {
+			/* T1 - Reset Dividers */
+			XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 1);
+		}
+	}
+
+	if (SettingsPtr->IsPLL == 0U) {
+		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_DTC_COUNT);
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if ((Tiles & (1U << Tile_Id)) != 0U) {
+				XRFdc_MTS_Sysref_Ctrl(InstancePtr, Type, Tile_Id, 0, 1, 0);
+			}
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API checks whether the DTC codes of a tile must be scanned for the PLL
+* case, that is whether the tile uses its PLL or a distributed PLL clock
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+*
+* @return
+*         - 1 if the PLL DTC codes must be scanned.
+*         - 0 otherwise.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Is_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id)
+{
 	u32 BaseAddr;
 	u32 NetCtrlReg;
 	u32 DistCtrlReg;
+	u32 IsPLL = 0U;
 
-	Status = XRFDC_MTS_OK;
 	BaseAddr = XRFDC_DRP_BASE(Type, Tile_Id) + XRFDC_HSCOM_ADDR;
 	if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
 		NetCtrlReg = XRFdc_ReadReg16(InstancePtr, BaseAddr, XRFDC_MTS_CLKSTAT);
 		if ((NetCtrlReg & XRFDC_MTS_PLLEN_M) != XRFDC_DISABLED) {
-			/* DTC Scan PLL */
-			if (Tile_Id == ConfigPtr->RefTile) {
-				metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
-			}
-			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
+			IsPLL = 1U;
 		}
 	} else {
 		NetCtrlReg = XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_CLK_NETWORK_CTRL1,
@@ -675,15 +827,47 @@ static u32 XRFdc_MTS_Dtc_Scan_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id,
 			XRFdc_RDReg(InstancePtr, BaseAddr, XRFDC_HSCOM_CLK_DSTR_OFFSET, XRFDC_DIST_CTRL_DIST_SRC_PLL);
 
 		if ((NetCtrlReg == XRFDC_DISABLED) || (DistCtrlReg != XRFDC_DISABLED)) {
-			/* DTC Scan PLL */
-			if (Tile_Id == ConfigPtr->RefTile) {
-				metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
-			}
-			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
+			IsPLL = 1U;
 		}
 	}
 
+	return IsPLL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API Scans the DTC codes and determine the optimal capture code for
+* PLL cases
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    SettingsPtr dtc settings structure.
+*
+* @return
+*         - XRFDC_MTS_OK if successful.
+*         - XRFDC_MTS_TIMEOUT if timeout occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_MTS_Dtc_Scan_PLL(XRFdc *InstancePtr, u32 Type, u32 Tile_Id,
+				  XRFdc_MultiConverter_Sync_Config *ConfigPtr)
+{
+	u32 Status;
+
+	Status = XRFDC_MTS_OK;
+	if (XRFdc_MTS_Dtc_Is_PLL(InstancePtr, Type, Tile_Id) != 0U) {
+		/* DTC Scan PLL */
+		if (Tile_Id == ConfigPtr->RefTile) {
+			metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+		}
+		ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Tile_Id, &ConfigPtr->DTC_Set_PLL);
+	}
+
 	return Status;
 }
 
@@ -1285,6 +1469,7 @@ u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter
 	u32 BaseAddr;
 	u32 TileState;
 	u32 BlockStatus;
+	u32 ScanTiles;
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(ConfigPtr != NULL);
@@ -1333,27 +1518,47 @@ u32 XRFdc_MultiConverter_Sync(XRFdc *InstancePtr, u32 Type, XRFdc_MultiConverter
 	/* Update distribution */
 	Status |= XRFdc_MTS_Sysref_Dist(InstancePtr, -1);
 
-	/* Scan DTCs for each tile starting with the reference tile */
-	Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, ConfigPtr->RefTile, ConfigPtr);
-	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
-		if (Index == ConfigPtr->RefTile) {
-			continue;
+	if (InstancePtr->ParallelBringUp != 0U) {
+		/* Scan DTCs of all the tiles together */
+		ScanTiles = 0U;
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
+			if ((((ConfigPtr->Tiles | (1U << ConfigPtr->RefTile)) & (1U << Index)) != 0U) &&
+			    (XRFdc_MTS_Dtc_Is_PLL(InstancePtr, Type, Index) != 0U)) {
+				ScanTiles |= (1U << Index);
+			}
 		}
-		if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
-			/* Run DTC Scan for PLL */
-			Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, Index, ConfigPtr);
+		if (ScanTiles != 0U) {
+			metal_log(METAL_LOG_INFO, "\nDTC Scan PLL\n");
+			ConfigPtr->DTC_Set_PLL.RefTile = ConfigPtr->RefTile;
+			Status |= XRFdc_MTS_Dtc_Scan_Tiles(InstancePtr, Type, ScanTiles, &ConfigPtr->DTC_Set_PLL);
 		}
-	}
-	/* Scan DTCs for each tile T1 starting with the reference tile */
-	metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
-	ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
-	Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, ConfigPtr->RefTile, &ConfigPtr->DTC_Set_T1);
-	for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
-		if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
+		metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
+		ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan_Tiles(InstancePtr, Type, ConfigPtr->Tiles | (1U << ConfigPtr->RefTile),
+						   &ConfigPtr->DTC_Set_T1);
+	} else {
+		/* Scan DTCs for each tile starting with the reference tile */
+		Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, ConfigPtr->RefTile, ConfigPtr);
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
 			if (Index == ConfigPtr->RefTile) {
 				continue;
 			}
-			Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Index, &ConfigPtr->DTC_Set_T1);
+			if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
+				/* Run DTC Scan for PLL */
+				Status |= XRFdc_MTS_Dtc_Scan_PLL(InstancePtr, Type, Index, ConfigPtr);
+			}
+		}
+		/* Scan DTCs for each tile T1 starting with the reference tile */
+		metal_log(METAL_LOG_INFO, "\nDTC Scan T1\n");
+		ConfigPtr->DTC_Set_T1.RefTile = ConfigPtr->RefTile;
+		Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, ConfigPtr->RefTile, &ConfigPtr->DTC_Set_T1);
+		for (Index = XRFDC_TILE_ID0; Index < XRFDC_TILE_ID4; Index++) {
+			if ((ConfigPtr->Tiles & (1U << Index)) != 0U) {
+				if (Index == ConfigPtr->RefTile) {
+					continue;
+				}
+				Status |= XRFdc_MTS_Dtc_Scan(InstancePtr, Type, Index, &ConfigPtr->DTC_Set_T1);
+			}
 		}
 	}
 
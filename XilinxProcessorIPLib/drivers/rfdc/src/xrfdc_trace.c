@@ -0,0 +1,559 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xrfdc_trace.c
+* @addtogroup Overview
+* @{
+*
+* Contains the register access trace and replay of the XRFdc driver.
+* See xrfdc.h for a detailed description of the device and driver.
+*
+* All the register accesses of the driver go through the libmetal I/O region
+* of the instance. XRFdc_TraceStart() replaces the read and write operations
+* of the region, so that every access is counted, timestamped and recorded in
+* a table of XRFdc_Trace_Entry. The accesses made between XRFdc_TraceBegin()
+* and XRFdc_TraceEnd() are also accounted to a named scope, for example
+*
+*	XRFdc_TraceBegin(&Trace, "XRFdc_StartUp");
+*	XRFdc_StartUp(InstancePtr, XRFDC_ADC_TILE, 0);
+*	XRFdc_TraceEnd(&Trace);
+*
+* gives the number of register reads and writes and the time of the call.
+*
+* XRFdc_ReplayStart() plays back a recorded table instead: the reads return
+* the recorded values and the writes are compared with the recorded ones.
+* With the I/O region of the instance set to a memory buffer, this runs the
+* driver on a Linux host against the captured behavior of the device, so the
+* register cost of an API can be measured and checked for regressions, every
+* access which differs from the trace is counted in Mismatches.
+*
+* Only one trace can be active at a time. The libmetal timestamp is not
+* implemented by the baremetal libmetal, the times are then zero.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 11.1  ag     10/19/26 Initial release.
+*       ag     10/19/26 The replay moves to the next entry on a mismatch.
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xrfdc.h"
+#include <metal/time.h>
+#include <string.h>
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u64 XRFdc_TraceIoRead(struct metal_io_region *io, unsigned long offset, memory_order order, int width);
+static void XRFdc_TraceIoWrite(struct metal_io_region *io, unsigned long offset, uint64_t value,
+			       memory_order order, int width);
+
+/************************** Variable Definitions *****************************/
+static XRFdc_Trace *XRFdc_ActiveTrace = NULL;
+
+/*****************************************************************************/
+/**
+*
+* This function reads a register of the region, with the I/O operations the
+* region had before the trace was started.
+*
+* @param    TracePtr is a pointer to the trace.
+* @param    Offset is the offset of the register in the region.
+* @param    Order is the memory ordering.
+* @param    Width is the access width in bytes.
+*
+* @return   The value read.
+*
+******************************************************************************/
+static u64 XRFdc_TraceRawRead(XRFdc_Trace *TracePtr, unsigned long Offset, memory_order Order, int Width)
+{
+	void *Ptr;
+	u64 Value = 0U;
+
+	if (TracePtr->SavedOps.read != NULL) {
+		return (*TracePtr->SavedOps.read)(TracePtr->io, Offset, Order, Width);
+	}
+
+	Ptr = metal_io_virt(TracePtr->io, Offset);
+	if (Ptr == NULL) {
+		return 0U;
+	}
+
+	switch (Width) {
+	case 1:
+		Value = *(volatile u8 *)Ptr;
+		break;
+	case 2:
+		Value = *(volatile u16 *)Ptr;
+		break;
+	case 4:
+		Value = *(volatile u32 *)Ptr;
+		break;
+	default:
+		Value = *(volatile u64 *)Ptr;
+		break;
+	}
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes a register of the region, with the I/O operations the
+* region had before the trace was started.
+*
+* @param    TracePtr is a pointer to the trace.
+* @param    Offset is the offset of the register in the region.
+* @param    Value is the value to write.
+* @param    Order is the memory ordering.
+* @param    Width is the access width in bytes.
+*
+* @return   None.
+*
+******************************************************************************/
+static void XRFdc_TraceRawWrite(XRFdc_Trace *TracePtr, unsigned long Offset, u64 Value, memory_order Order,
+				int Width)
+{
+	void *Ptr;
+
+	if (TracePtr->SavedOps.write != NULL) {
+		(*TracePtr->SavedOps.write)(TracePtr->io, Offset, Value, Order, Width);
+		return;
+	}
+
+	Ptr = metal_io_virt(TracePtr->io, Offset);
+	if (Ptr == NULL) {
+		return;
+	}
+
+	switch (Width) {
+	case 1:
+		*(volatile u8 *)Ptr = (u8)Value;
+		break;
+	case 2:
+		*(volatile u16 *)Ptr = (u16)Value;
+		break;
+	case 4:
+		*(volatile u32 *)Ptr = (u32)Value;
+		break;
+	default:
+		*(volatile u64 *)Ptr = Value;
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function counts an access, and records it in record mode.
+*
+* @param    TracePtr is a pointer to the trace.
+* @param    Offset is the offset of the register in the region.
+* @param    Value is the value read or written.
+* @param    Width is the access width in bytes.
+* @param    Write is 1 for a write, 0 for a read.
+*
+* @return   None.
+*
+******************************************************************************/
+static void XRFdc_TraceAccount(XRFdc_Trace *TracePtr, unsigned long Offset, u64 Value, int Width, u8 Write)
+{
+	XRFdc_Trace_Entry *EntryPtr;
+
+	if (Write != 0U) {
+		TracePtr->Writes++;
+	} else {
+		TracePtr->Reads++;
+	}
+
+	if (TracePtr->CurScope != 0U) {
+		if (Write != 0U) {
+			TracePtr->Scope[TracePtr->CurScope - 1U].Writes++;
+		} else {
+			TracePtr->Scope[TracePtr->CurScope - 1U].Reads++;
+		}
+	}
+
+	if ((TracePtr->Mode != XRFDC_TRACE_MODE_RECORD) || (TracePtr->Entries == NULL)) {
+		return;
+	}
+
+	if (TracePtr->NumEntries == TracePtr->MaxEntries) {
+		TracePtr->Dropped++;
+		return;
+	}
+
+	EntryPtr = &TracePtr->Entries[TracePtr->NumEntries];
+	EntryPtr->Timestamp = metal_get_timestamp();
+	EntryPtr->Value = Value;
+	EntryPtr->Offset = (u32)Offset;
+	EntryPtr->Scope = (u16)TracePtr->CurScope;
+	EntryPtr->Width = (u8)Width;
+	EntryPtr->Write = Write;
+	TracePtr->NumEntries++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the next replay entry if it matches an access. The
+* replay moves to the next entry on every access, matching or not, so the
+* driver and the trace stay in step: an access to another register counts as
+* a single mismatch and the following accesses are still compared. An extra
+* or a missing access of the driver shifts the rest of the trace, and the
+* following accesses are counted as mismatches.
+*
+* @param    TracePtr is a pointer to the trace.
+* @param    Offset is the offset of the register in the region.
+* @param    Width is the access width in bytes.
+* @param    Write is 1 for a write, 0 for a read.
+*
+* @return   Pointer to the entry, NULL if the access does not match.
+*
+******************************************************************************/
+static XRFdc_Trace_Entry *XRFdc_ReplayNext(XRFdc_Trace *TracePtr, unsigned long Offset, int Width, u8 Write)
+{
+	XRFdc_Trace_Entry *EntryPtr;
+
+	if (TracePtr->ReplayIndex >= TracePtr->MaxEntries) {
+		TracePtr->Mismatches++;
+		return NULL;
+	}
+
+	EntryPtr = &TracePtr->Entries[TracePtr->ReplayIndex];
+	TracePtr->ReplayIndex++;
+	if ((EntryPtr->Write != Write) || (EntryPtr->Offset != (u32)Offset) || (EntryPtr->Width != (u8)Width)) {
+		TracePtr->Mismatches++;
+		return NULL;
+	}
+
+	return EntryPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* Read operation of the I/O region while the trace is active.
+*
+* @param    io is the I/O region.
+* @param    offset is the offset of the register in the region.
+* @param    order is the memory ordering.
+* @param    width is the access width in bytes.
+*
+* @return   The value read, or the recorded value in replay mode.
+*
+******************************************************************************/
+static u64 XRFdc_TraceIoRead(struct metal_io_region *io, unsigned long offset, memory_order order, int width)
+{
+	XRFdc_Trace *TracePtr = XRFdc_ActiveTrace;
+	XRFdc_Trace_Entry *EntryPtr;
+	u64 Value;
+
+	(void)io;
+
+	if (TracePtr->Mode == XRFDC_TRACE_MODE_REPLAY) {
+		EntryPtr = XRFdc_ReplayNext(TracePtr, offset, width, 0U);
+		if (EntryPtr != NULL) {
+			/* Keep the memory model in line with the device */
+			XRFdc_TraceRawWrite(TracePtr, offset, EntryPtr->Value, order, width);
+			Value = EntryPtr->Value;
+		} else {
+			Value = XRFdc_TraceRawRead(TracePtr, offset, order, width);
+		}
+	} else {
+		Value = XRFdc_TraceRawRead(TracePtr, offset, order, width);
+	}
+
+	XRFdc_TraceAccount(TracePtr, offset, Value, width, 0U);
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write operation of the I/O region while the trace is active.
+*
+* @param    io is the I/O region.
+* @param    offset is the offset of the register in the region.
+* @param    value is the value to write.
+* @param    order is the memory ordering.
+* @param    width is the access width in bytes.
+*
+* @return   None.
+*
+******************************************************************************/
+static void XRFdc_TraceIoWrite(struct metal_io_region *io, unsigned long offset, uint64_t value,
+			       memory_order order, int width)
+{
+	XRFdc_Trace *TracePtr = XRFdc_ActiveTrace;
+	XRFdc_Trace_Entry *EntryPtr;
+
+	(void)io;
+
+	if (TracePtr->Mode == XRFDC_TRACE_MODE_REPLAY) {
+		EntryPtr = XRFdc_ReplayNext(TracePtr, offset, width, 1U);
+		if ((EntryPtr != NULL) && (EntryPtr->Value != value)) {
+			TracePtr->Mismatches++;
+		}
+	}
+
+	XRFdc_TraceRawWrite(TracePtr, offset, value, order, width);
+	XRFdc_TraceAccount(TracePtr, offset, value, width, 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function installs the trace on the I/O region of the instance.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TracePtr is a pointer to the trace.
+* @param    EntriesPtr is a pointer to the entry table.
+* @param    MaxEntries is the number of entries of the table.
+* @param    Mode is XRFDC_TRACE_MODE_RECORD or XRFDC_TRACE_MODE_REPLAY.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a trace is already active.
+*
+******************************************************************************/
+static u32 XRFdc_TraceInstall(XRFdc *InstancePtr, XRFdc_Trace *TracePtr, XRFdc_Trace_Entry *EntriesPtr,
+			      u32 MaxEntries, u32 Mode)
+{
+	u32 Status;
+
+	if (XRFdc_ActiveTrace != NULL) {
+		metal_log(METAL_LOG_ERROR, "\n A register trace is already active in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (InstancePtr->io == NULL) {
+		metal_log(METAL_LOG_ERROR, "\n InstancePtr->io not allocated in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	(void)memset((void *)TracePtr, 0, sizeof(XRFdc_Trace));
+	TracePtr->Entries = EntriesPtr;
+	TracePtr->MaxEntries = MaxEntries;
+	TracePtr->Mode = Mode;
+	TracePtr->io = InstancePtr->io;
+	TracePtr->SavedOps = InstancePtr->io->ops;
+
+	XRFdc_ActiveTrace = TracePtr;
+	InstancePtr->io->ops.read = XRFdc_TraceIoRead;
+	InstancePtr->io->ops.write = XRFdc_TraceIoWrite;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts recording the register accesses of the instance.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TracePtr is a pointer to the trace.
+* @param    EntriesPtr is a pointer to the entry table, NULL to only count
+*           the accesses.
+* @param    MaxEntries is the number of entries of the table.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a trace is already active.
+*
+* @note     The accesses which do not fit in the table are counted in
+*           Dropped.
+*
+******************************************************************************/
+u32 XRFdc_TraceStart(XRFdc *InstancePtr, XRFdc_Trace *TracePtr, XRFdc_Trace_Entry *EntriesPtr, u32 MaxEntries)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TracePtr != NULL);
+	Xil_AssertNonvoid((EntriesPtr != NULL) || (MaxEntries == 0U));
+
+	return XRFdc_TraceInstall(InstancePtr, TracePtr, EntriesPtr, MaxEntries, XRFDC_TRACE_MODE_RECORD);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts replaying recorded register accesses on the instance.
+* The reads return the recorded values, and the writes are compared with the
+* recorded ones. The accesses are also applied to the I/O region, which is
+* expected to be a memory buffer.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TracePtr is a pointer to the trace.
+* @param    EntriesPtr is a pointer to the recorded entries.
+* @param    NumEntries is the number of recorded entries.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a trace is already active.
+*
+******************************************************************************/
+u32 XRFdc_ReplayStart(XRFdc *InstancePtr, XRFdc_Trace *TracePtr, XRFdc_Trace_Entry *EntriesPtr, u32 NumEntries)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TracePtr != NULL);
+	Xil_AssertNonvoid(EntriesPtr != NULL);
+
+	return XRFdc_TraceInstall(InstancePtr, TracePtr, EntriesPtr, NumEntries, XRFDC_TRACE_MODE_REPLAY);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the trace and restores the I/O operations of the
+* instance. In replay mode, the recorded accesses which were not replayed
+* are added to Mismatches.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TracePtr is a pointer to the trace.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the trace is not active.
+*
+******************************************************************************/
+u32 XRFdc_TraceStop(XRFdc *InstancePtr, XRFdc_Trace *TracePtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TracePtr != NULL);
+
+	if ((XRFdc_ActiveTrace != TracePtr) || (InstancePtr->io != TracePtr->io)) {
+		metal_log(METAL_LOG_ERROR, "\n Register trace not active in %s\r\n", __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	XRFdc_TraceEnd(TracePtr);
+	InstancePtr->io->ops = TracePtr->SavedOps;
+	XRFdc_ActiveTrace = NULL;
+
+	if (TracePtr->Mode == XRFDC_TRACE_MODE_REPLAY) {
+		TracePtr->Mismatches += TracePtr->MaxEntries - TracePtr->ReplayIndex;
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function opens a named scope, the following accesses are accounted to
+* it until XRFdc_TraceEnd(). Scopes with the same name are accumulated.
+*
+* @param    TracePtr is a pointer to the trace.
+* @param    Name is the name of the scope, usually the API called.
+*
+* @return   None.
+*
+* @note     Scopes do not nest, an open scope is closed first. The accesses
+*           are not accounted to any scope once XRFDC_TRACE_MAX_SCOPES
+*           names are used.
+*
+******************************************************************************/
+void XRFdc_TraceBegin(XRFdc_Trace *TracePtr, const char *Name)
+{
+	u32 Index;
+
+	Xil_AssertVoid(TracePtr != NULL);
+	Xil_AssertVoid(Name != NULL);
+
+	XRFdc_TraceEnd(TracePtr);
+
+	for (Index = 0U; Index < TracePtr->NumScopes; Index++) {
+		if ((TracePtr->Scope[Index].Name == Name) || (strcmp(TracePtr->Scope[Index].Name, Name) == 0)) {
+			break;
+		}
+	}
+
+	if (Index == TracePtr->NumScopes) {
+		if (TracePtr->NumScopes == XRFDC_TRACE_MAX_SCOPES) {
+			return;
+		}
+		TracePtr->Scope[Index].Name = Name;
+		TracePtr->NumScopes++;
+	}
+
+	TracePtr->Scope[Index].Calls++;
+	TracePtr->CurScope = Index + 1U;
+	TracePtr->ScopeStart = metal_get_timestamp();
+}
+
+/*****************************************************************************/
+/**
+*
+* This function closes the open scope and adds its time.
+*
+* @param    TracePtr is a pointer to the trace.
+*
+* @return   None.
+*
+******************************************************************************/
+void XRFdc_TraceEnd(XRFdc_Trace *TracePtr)
+{
+	Xil_AssertVoid(TracePtr != NULL);
+
+	if (TracePtr->CurScope == 0U) {
+		return;
+	}
+
+	TracePtr->Scope[TracePtr->CurScope - 1U].Time += metal_get_timestamp() - TracePtr->ScopeStart;
+	TracePtr->CurScope = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the access counts and times of the trace and of its
+* scopes.
+*
+* @param    TracePtr is a pointer to the trace.
+*
+* @return   None.
+*
+******************************************************************************/
+void XRFdc_TraceDump(XRFdc_Trace *TracePtr)
+{
+	u32 Index;
+	XRFdc_Trace_Scope *ScopePtr;
+
+	Xil_AssertVoid(TracePtr != NULL);
+
+	metal_log(METAL_LOG_INFO, "\n %s: %u reads, %u writes, %u recorded, %u dropped, %u mismatches\r\n",
+		  (TracePtr->Mode == XRFDC_TRACE_MODE_REPLAY) ? "Replay" : "Trace", TracePtr->Reads, TracePtr->Writes,
+		  TracePtr->NumEntries, TracePtr->Dropped, TracePtr->Mismatches);
+
+	for (Index = 0U; Index < TracePtr->NumScopes; Index++) {
+		ScopePtr = &TracePtr->Scope[Index];
+		metal_log(METAL_LOG_INFO, "\n %s: %u calls, %u reads, %u writes, time %llu\r\n", ScopePtr->Name,
+			  ScopePtr->Calls, ScopePtr->Reads, ScopePtr->Writes, (unsigned long long)ScopePtr->Time);
+	}
+}
+/** @} */
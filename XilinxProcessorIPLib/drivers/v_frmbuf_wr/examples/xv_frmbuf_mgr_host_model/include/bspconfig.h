@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* The host build has no BSP configuration.
+*
+******************************************************************************/
+#ifndef XV_FRMBUF_MGR_MODEL_BSPCONFIG_H_
+#define XV_FRMBUF_MGR_MODEL_BSPCONFIG_H_
+
+#endif /* XV_FRMBUF_MGR_MODEL_BSPCONFIG_H_ */
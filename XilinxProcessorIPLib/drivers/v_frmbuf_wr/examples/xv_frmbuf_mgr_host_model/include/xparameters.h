@@ -0,0 +1,23 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* One Frame Buffer Write and one Frame Buffer Read core, their configurations
+* are in the test.
+*
+******************************************************************************/
+#ifndef XV_FRMBUF_MGR_MODEL_XPARAMETERS_H_
+#define XV_FRMBUF_MGR_MODEL_XPARAMETERS_H_
+
+#define XPAR_XV_FRMBUFWR_NUM_INSTANCES	1U
+#define XPAR_XV_FRMBUFWR_0_DEVICE_ID	0U
+#define XPAR_XV_FRMBUFRD_NUM_INSTANCES	1U
+#define XPAR_XV_FRMBUFRD_0_DEVICE_ID	0U
+
+#endif /* XV_FRMBUF_MGR_MODEL_XPARAMETERS_H_ */
@@ -0,0 +1,680 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbuf_mgr_test.c
+*
+* This file contains a host simulation of the frame buffer manager between a
+* Frame Buffer Write and a Frame Buffer Read core. The drivers of the cores
+* program their register banks in host memory, through the address functions
+* of the manager.
+*
+* - Each core is modeled in auto-restart mode: at the end of a frame the next
+*   frame starts at once with the buffer address read from the register bank,
+*   then the done interrupt is serviced after a random latency.
+* - The writer and the reader run at equal rates, the writer faster, the
+*   writer slower and the writer twice as fast, with 4 to 16 buffers and
+*   both policies.
+* - The reader must never read the buffer being written, a buffer whose
+*   frame is not complete, or a buffer mixing the luma and the chroma of two
+*   buffers. With the FIFO policy it must show every queued frame in order,
+*   with the latest policy the queued frames in order with gaps.
+* - After each done callback, every buffer must be in exactly one place, and
+*   the manager must know the buffers the cores use and have programmed.
+* - At equal rates no frame may be dropped with 5 buffers when the done
+*   interrupts of the two cores alternate, and with 6 when they are serviced
+*   in any order.
+* - The runs are repeated with address functions failing at random.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.60  ag    10/19/26   First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xv_frmbuf_mgr.h"
+#include "xv_frmbufwr_l2.h"
+#include "xv_frmbufrd_l2.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ******************************/
+
+#define BANK_SIZE	0x100U		/**< Register bank size of a core */
+#define PIX_PER_CLK	2U
+#define ADDR_ALIGN	(2U * 4U * PIX_PER_CLK)	/**< Alignment of the cores */
+#define NUM_FRAMES	20000U		/**< Writer frames per run */
+#define FAIL_PERCENT	10U		/**< Failing address functions */
+#define RANDOM_PHASE	(~(u64)0)	/**< Reader starts at random */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Writer and reader frame periods of a run
+ */
+typedef struct {
+	const char *Name;
+	u64 WrPeriod;
+	u64 RdPeriod;
+	u64 RdPhase;	/**< Reader start delay, or RANDOM_PHASE */
+} Rates;
+
+/**
+ * Model of a core in auto-restart mode
+ */
+typedef struct {
+	UINTPTR Bank;		/**< Register bank */
+	u32 LumaOffset;		/**< Offset of the buffer address */
+	u32 ChromaOffset;	/**< Offset of the chroma buffer address */
+	u64 Period;		/**< Frame period */
+	u32 Started;		/**< Core is running */
+	u32 Cur;		/**< Buffer of the frame in progress */
+	u32 Prev;		/**< Buffer of the previous frame */
+	u64 EndTime;		/**< End of the frame in progress */
+	u32 IsrPending;		/**< Done interrupt not serviced yet */
+	u64 IsrTime;		/**< Time the done interrupt is serviced */
+} SimCore;
+
+/************************** Variable Definitions *****************************/
+
+static const Rates RateList[] = {
+	{ "equal",		1000U, 1000U, RANDOM_PHASE },
+	{ "equal P/2",		1000U, 1000U, 500U },
+	{ "writer faster",	 800U, 1000U, RANDOM_PHASE },
+	{ "writer slower",	1000U,  800U, RANDOM_PHASE },
+	{ "writer 2x",		 500U, 1000U, RANDOM_PHASE },
+};
+
+#define NUM_RATES	(sizeof(RateList)/sizeof(RateList[0]))
+
+static const u32 BufferCounts[] = { 4U, 5U, 6U, 8U, 16U };
+
+#define NUM_BUFFER_COUNTS	(sizeof(BufferCounts)/sizeof(BufferCounts[0]))
+
+/**
+ * Semi-planar Frame Buffer Write and Read cores, 2 pixels per clock. The
+ * base addresses are set by InitCores.
+ */
+XV_frmbufwr_Config XV_frmbufwr_ConfigTable[XPAR_XV_FRMBUFWR_NUM_INSTANCES] = {
+	{
+		.DeviceId = XPAR_XV_FRMBUFWR_0_DEVICE_ID,
+		.PixPerClk = PIX_PER_CLK,
+		.MaxWidth = 3840U,
+		.MaxHeight = 2160U,
+		.MaxDataWidth = 8U,
+		.AXIMMDataWidth = 128U,
+		.AXIMMAddrWidth = 32U,
+		.Y_UV8En = 1U,
+		.Y_UV8_420En = 1U,
+	}
+};
+
+XV_frmbufrd_Config XV_frmbufrd_ConfigTable[XPAR_XV_FRMBUFRD_NUM_INSTANCES] = {
+	{
+		.DeviceId = XPAR_XV_FRMBUFRD_0_DEVICE_ID,
+		.PixPerClk = PIX_PER_CLK,
+		.MaxWidth = 3840U,
+		.MaxHeight = 2160U,
+		.MaxDataWidth = 8U,
+		.AXIMMDataWidth = 128U,
+		.AXIMMAddrWidth = 32U,
+		.Y_UV8En = 1U,
+		.Y_UV8_420En = 1U,
+	}
+};
+
+static XV_FrmbufWr_l2 FrmbufWr;
+static XV_FrmbufRd_l2 FrmbufRd;
+static u32 *WrBank;
+static u32 *RdBank;
+
+static XVFrmbufMgr Mgr;
+static XVFrmbufMgr_Buffer Buffers[XVFRMBUFMGR_MAX_BUFFERS];
+static SimCore Wr;
+static SimCore Rd;
+static u64 SimTime;
+
+static u32 Complete[XVFRMBUFMGR_MAX_BUFFERS];	/**< Frame is complete */
+static u32 Seq[XVFRMBUFMGR_MAX_BUFFERS];	/**< Frame in the buffer */
+static u32 Published[NUM_FRAMES];	/**< Frames queued for the reader */
+static u32 NumPublished;
+
+static u32 FailPercent;
+static u32 RestoreLuma;
+
+u32 Xil_AssertStatus;
+
+/************************** Function Definitions *****************************/
+
+#define CHECK(Cond) \
+	do { \
+		if (!(Cond)) { \
+			printf("%s line %d: %s\r\n", __FILE__, __LINE__, #Cond); \
+			return XST_FAILURE; \
+		} \
+	} while (0)
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	exit(1);
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+static u64 GetTime(void)
+{
+	return SimTime;
+}
+
+/*****************************************************************************/
+/**
+* Address functions given to the manager. They fail at random without
+* writing the register bank, as the drivers do for an unaligned address. The
+* luma address written back after a failed chroma address was programmed
+* before and does not fail.
+*
+******************************************************************************/
+static u32 Fail(void)
+{
+	return ((u32)(rand() % 100) < FailPercent);
+}
+
+static int WrSetAddr(void *InstancePtr, UINTPTR Addr)
+{
+	if (RestoreLuma) {
+		RestoreLuma = FALSE;
+	} else if (Fail()) {
+		return XST_FAILURE;
+	}
+	return XVFrmbufMgr_WrSetAddr(InstancePtr, Addr);
+}
+
+static int WrSetChromaAddr(void *InstancePtr, UINTPTR Addr)
+{
+	if (Fail()) {
+		RestoreLuma = TRUE;
+		return XST_FAILURE;
+	}
+	return XVFrmbufMgr_WrSetChromaAddr(InstancePtr, Addr);
+}
+
+static int RdSetAddr(void *InstancePtr, UINTPTR Addr)
+{
+	if (RestoreLuma) {
+		RestoreLuma = FALSE;
+	} else if (Fail()) {
+		return XST_FAILURE;
+	}
+	return XVFrmbufMgr_RdSetAddr(InstancePtr, Addr);
+}
+
+static int RdSetChromaAddr(void *InstancePtr, UINTPTR Addr)
+{
+	if (Fail()) {
+		RestoreLuma = TRUE;
+		return XST_FAILURE;
+	}
+	return XVFrmbufMgr_RdSetChromaAddr(InstancePtr, Addr);
+}
+
+/*****************************************************************************/
+/**
+* Initializes the cores through their configuration tables, with the
+* register banks in host memory.
+*
+******************************************************************************/
+static int InitCores(void)
+{
+	WrBank = calloc(1U, BANK_SIZE);
+	RdBank = calloc(1U, BANK_SIZE);
+	CHECK((WrBank != NULL) && (RdBank != NULL));
+
+	XV_frmbufwr_ConfigTable[0].BaseAddress = (UINTPTR)WrBank;
+	CHECK(XVFrmbufWr_Initialize(&FrmbufWr,
+		XPAR_XV_FRMBUFWR_0_DEVICE_ID) == XST_SUCCESS);
+
+	XV_frmbufrd_ConfigTable[0].BaseAddress = (UINTPTR)RdBank;
+	CHECK(XVFrmbufRd_Initialize(&FrmbufRd,
+		XPAR_XV_FRMBUFRD_0_DEVICE_ID) == XST_SUCCESS);
+
+	memset(&Wr, 0, sizeof(Wr));
+	Wr.Bank = (UINTPTR)WrBank;
+	Wr.LumaOffset = XV_FRMBUFWR_CTRL_ADDR_HWREG_FRM_BUFFER_V_DATA;
+	Wr.ChromaOffset = XV_FRMBUFWR_CTRL_ADDR_HWREG_FRM_BUFFER2_V_DATA;
+
+	memset(&Rd, 0, sizeof(Rd));
+	Rd.Bank = (UINTPTR)RdBank;
+	Rd.LumaOffset = XV_FRMBUFRD_CTRL_ADDR_HWREG_FRM_BUFFER_V_DATA;
+	Rd.ChromaOffset = XV_FRMBUFRD_CTRL_ADDR_HWREG_FRM_BUFFER2_V_DATA;
+
+	return XST_SUCCESS;
+}
+
+static u64 ReadAddr(UINTPTR Bank, u32 Offset)
+{
+	return (u64)Xil_In32(Bank + Offset) |
+		((u64)Xil_In32(Bank + Offset + 4U) << 32);
+}
+
+/*****************************************************************************/
+/**
+* Returns the buffer programmed into a core. The luma and chroma addresses
+* must be those of the same buffer.
+*
+******************************************************************************/
+static int Programmed(const SimCore *CorePtr, u32 *IndexPtr)
+{
+	u64 Luma = ReadAddr(CorePtr->Bank, CorePtr->LumaOffset);
+	u64 Chroma = ReadAddr(CorePtr->Bank, CorePtr->ChromaOffset);
+	u32 Index;
+
+	for (Index = 0; Index < Mgr.NumBuffers; Index++) {
+		if (Buffers[Index].Addr == Luma) {
+			break;
+		}
+	}
+	CHECK(Index < Mgr.NumBuffers);
+	CHECK(Buffers[Index].ChromaAddr == Chroma);
+
+	*IndexPtr = Index;
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Starts a frame: the core latches the buffer programmed into it.
+*
+******************************************************************************/
+static int StartFrame(SimCore *CorePtr)
+{
+	CorePtr->Prev = CorePtr->Cur;
+	CHECK(Programmed(CorePtr, &CorePtr->Cur) == XST_SUCCESS);
+	CorePtr->EndTime = SimTime + CorePtr->Period;
+	CorePtr->Started = TRUE;
+
+	/* The two cores never use the same buffer */
+	CHECK(!Wr.Started || !Rd.Started || (Wr.Cur != Rd.Cur));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Checks that every buffer is in exactly one queue or core, and that the
+* manager knows the buffer of each core and the buffer programmed into it.
+* Until the done interrupt is serviced, the manager sees the previous frame
+* in progress.
+*
+******************************************************************************/
+static int CheckPort(const XVFrmbufMgr_Port *PortPtr, const SimCore *CorePtr,
+		     u32 *Count)
+{
+	u32 Index;
+
+	if (!CorePtr->Started) {
+		/* Buffer of a failed start */
+		if (PortPtr->Pending != XVFRMBUFMGR_NO_BUFFER) {
+			Count[PortPtr->Pending]++;
+		}
+		return XST_SUCCESS;
+	}
+
+	CHECK(Programmed(CorePtr, &Index) == XST_SUCCESS);
+	if (CorePtr->IsrPending) {
+		CHECK(PortPtr->Active == CorePtr->Prev);
+		CHECK(PortPtr->Next == CorePtr->Cur);
+		CHECK(Index == CorePtr->Cur);
+	} else {
+		CHECK(PortPtr->Active == CorePtr->Cur);
+		CHECK(PortPtr->Next == Index);
+	}
+
+	Count[PortPtr->Active]++;
+	if (PortPtr->Next != PortPtr->Active) {
+		Count[PortPtr->Next]++;
+	}
+	if (PortPtr->Pending != XVFRMBUFMGR_NO_BUFFER) {
+		Count[PortPtr->Pending]++;
+	}
+
+	return XST_SUCCESS;
+}
+
+static int CheckState(void)
+{
+	u32 Count[XVFRMBUFMGR_MAX_BUFFERS];
+	const XVFrmbufMgr_Queue *Queues[2] = { &Mgr.FreeQueue, &Mgr.ReadyQueue };
+	u32 Queue;
+	u32 Pos;
+	u32 Index;
+
+	memset(Count, 0, sizeof(Count));
+
+	for (Queue = 0; Queue < 2U; Queue++) {
+		for (Pos = Queues[Queue]->Tail; Pos != Queues[Queue]->Head;
+		     Pos++) {
+			Count[Queues[Queue]->Index[Pos %
+				XVFRMBUFMGR_MAX_BUFFERS]]++;
+		}
+	}
+
+	CHECK(CheckPort(&Mgr.Wr, &Wr, Count) == XST_SUCCESS);
+	CHECK(CheckPort(&Mgr.Rd, &Rd, Count) == XST_SUCCESS);
+
+	for (Index = 0; Index < Mgr.NumBuffers; Index++) {
+		CHECK(Count[Index] == 1U);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Runs the writer and the reader for NUM_FRAMES writer frames.
+*
+******************************************************************************/
+static int RunSim(u32 NumBuffers, XVFrmbufMgr_Policy Policy,
+		  const Rates *RatesPtr, XVFrmbufMgr_Stats *StatsPtr)
+{
+	u64 MaxLatency;
+	u32 WrFrames = 0;
+	u32 RdIsrs = 0;
+	u32 Shown = 0;
+	u32 LastSeq = ~0U;
+	u32 ReaderPos = 0;
+	u32 FramesWritten;
+	u32 Index;
+	u32 Tries;
+	int Status;
+
+	for (Index = 0; Index < NumBuffers; Index++) {
+		Buffers[Index].Addr = 0x10000000U + (Index * 0x01000000U);
+		Buffers[Index].ChromaAddr = Buffers[Index].Addr + 0x00800000U;
+	}
+	memset(Complete, 0, sizeof(Complete));
+	memset(WrBank, 0, BANK_SIZE);
+	memset(RdBank, 0, BANK_SIZE);
+	NumPublished = 0;
+	SimTime = 0;
+	RestoreLuma = FALSE;
+
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Buffers, NumBuffers, ADDR_ALIGN,
+		Policy, GetTime) == XST_SUCCESS);
+	XVFrmbufMgr_SetWriter(&Mgr, &FrmbufWr, WrSetAddr, WrSetChromaAddr);
+	XVFrmbufMgr_SetReader(&Mgr, &FrmbufRd, RdSetAddr, RdSetChromaAddr);
+
+	Wr.Started = FALSE;
+	Wr.IsrPending = FALSE;
+	Wr.Period = RatesPtr->WrPeriod;
+	Rd.Started = FALSE;
+	Rd.IsrPending = FALSE;
+	Rd.Period = RatesPtr->RdPeriod;
+
+	/* The interrupts are serviced before the end of the next frame */
+	MaxLatency = ((Wr.Period < Rd.Period) ? Wr.Period : Rd.Period) / 4U;
+
+	for (Tries = 0; XVFrmbufMgr_WrStart(&Mgr) != XST_SUCCESS; Tries++) {
+		CHECK(Tries < 100U);
+	}
+	CHECK(StartFrame(&Wr) == XST_SUCCESS);
+	CHECK(CheckState() == XST_SUCCESS);
+
+	while ((WrFrames < NUM_FRAMES) || Wr.IsrPending || Rd.IsrPending) {
+		if (Wr.IsrPending &&
+		    (!Rd.IsrPending || (Wr.IsrTime <= Rd.IsrTime)) &&
+		    (Wr.IsrTime < Wr.EndTime) &&
+		    (!Rd.Started || (Wr.IsrTime < Rd.EndTime))) {
+			/* Writer done interrupt */
+			SimTime = Wr.IsrTime;
+			Wr.IsrPending = FALSE;
+			FramesWritten = Mgr.Stats.FramesWritten;
+			XVFrmbufMgr_WrDoneCallback(&Mgr);
+			if (Mgr.Stats.FramesWritten != FramesWritten) {
+				Index = Mgr.ReadyQueue.Index[
+					(Mgr.ReadyQueue.Head - 1U) %
+					XVFRMBUFMGR_MAX_BUFFERS];
+				CHECK(Complete[Index]);
+				Published[NumPublished++] = Seq[Index];
+			}
+			if (!Rd.Started) {
+				Status = XVFrmbufMgr_RdStart(&Mgr);
+				if (Status == XST_SUCCESS) {
+					CHECK(StartFrame(&Rd) == XST_SUCCESS);
+					/* Phase of the reader */
+					if (RatesPtr->RdPhase == RANDOM_PHASE) {
+						Rd.EndTime += (u64)rand() %
+							Rd.Period;
+					} else {
+						Rd.EndTime += RatesPtr->RdPhase;
+					}
+					CHECK(Complete[Rd.Cur]);
+					LastSeq = Seq[Rd.Cur];
+					CHECK(Published[ReaderPos++] == LastSeq);
+				}
+			}
+			CHECK(CheckState() == XST_SUCCESS);
+		} else if (Rd.IsrPending && (Rd.IsrTime < Rd.EndTime) &&
+			   (Rd.IsrTime < Wr.EndTime)) {
+			/* Reader done interrupt */
+			SimTime = Rd.IsrTime;
+			Rd.IsrPending = FALSE;
+			XVFrmbufMgr_RdDoneCallback(&Mgr);
+			RdIsrs++;
+			CHECK(CheckState() == XST_SUCCESS);
+		} else if (!Rd.Started || (Wr.EndTime <= Rd.EndTime)) {
+			/* End of a writer frame, the next one starts */
+			CHECK(!Wr.IsrPending);
+			if (WrFrames == NUM_FRAMES) {
+				break;
+			}
+			SimTime = Wr.EndTime;
+			Complete[Wr.Cur] = TRUE;
+			Seq[Wr.Cur] = WrFrames++;
+			CHECK(StartFrame(&Wr) == XST_SUCCESS);
+			Complete[Wr.Cur] = FALSE;
+			Wr.IsrPending = TRUE;
+			Wr.IsrTime = SimTime + 1U + ((u64)rand() % MaxLatency);
+		} else {
+			/* End of a reader frame, the next one starts */
+			CHECK(!Rd.IsrPending);
+			SimTime = Rd.EndTime;
+			Shown++;
+			CHECK(StartFrame(&Rd) == XST_SUCCESS);
+			CHECK(Complete[Rd.Cur]);
+			CHECK(Seq[Rd.Cur] >= LastSeq);
+			if (Seq[Rd.Cur] != LastSeq) {
+				/* FIFO shows the next queued frame */
+				if (Policy == XVFRMBUFMGR_POLICY_LATEST) {
+					while ((ReaderPos < NumPublished) &&
+					       (Published[ReaderPos] !=
+						Seq[Rd.Cur])) {
+						ReaderPos++;
+					}
+				}
+				CHECK(ReaderPos < NumPublished);
+				CHECK(Published[ReaderPos] == Seq[Rd.Cur]);
+				ReaderPos++;
+				LastSeq = Seq[Rd.Cur];
+			}
+			Rd.IsrPending = TRUE;
+			Rd.IsrTime = SimTime + 1U + ((u64)rand() % MaxLatency);
+		}
+	}
+
+	XVFrmbufMgr_GetStats(&Mgr, StatsPtr);
+	CHECK(StatsPtr->FramesWritten == NumPublished);
+	CHECK(StatsPtr->FramesRead == RdIsrs);
+	CHECK(RdIsrs == Shown);
+	CHECK(StatsPtr->LatencyCount <= StatsPtr->FramesWritten);
+	CHECK(StatsPtr->LatencyCount > 0U);
+	CHECK(StatsPtr->LatencyMin <= StatsPtr->LatencyMax);
+	if (Policy == XVFRMBUFMGR_POLICY_FIFO) {
+		CHECK(StatsPtr->RdDrops == 0U);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Checks the parameters of the manager initialization.
+*
+******************************************************************************/
+static int TestInitialize(void)
+{
+	XVFrmbufMgr_Buffer Bad[XVFRMBUFMGR_MAX_BUFFERS];
+	u32 Index;
+
+	for (Index = 0; Index < XVFRMBUFMGR_MAX_BUFFERS; Index++) {
+		Bad[Index].Addr = 0x10000000U + (Index * 0x01000000U);
+		Bad[Index].ChromaAddr = Bad[Index].Addr + 0x00800000U;
+	}
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, XVFRMBUFMGR_MAX_BUFFERS,
+		ADDR_ALIGN, XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_SUCCESS);
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, XVFRMBUFMGR_MIN_BUFFERS - 1U,
+		ADDR_ALIGN, XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_INVALID_PARAM);
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, XVFRMBUFMGR_MAX_BUFFERS + 1U,
+		ADDR_ALIGN, XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_INVALID_PARAM);
+
+	/* Unaligned luma, unaligned chroma and null address in the last buffer */
+	Bad[5].Addr += ADDR_ALIGN / 2U;
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, 6U, ADDR_ALIGN,
+		XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_INVALID_PARAM);
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, 5U, ADDR_ALIGN,
+		XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_SUCCESS);
+	Bad[5].Addr -= ADDR_ALIGN / 2U;
+	Bad[5].ChromaAddr += 4U;
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, 6U, ADDR_ALIGN,
+		XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_INVALID_PARAM);
+	Bad[5].ChromaAddr = 0U;
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, 6U, ADDR_ALIGN,
+		XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_SUCCESS);
+	Bad[5].Addr = 0U;
+	CHECK(XVFrmbufMgr_Initialize(&Mgr, Bad, 6U, ADDR_ALIGN,
+		XVFRMBUFMGR_POLICY_FIFO, NULL) == XST_INVALID_PARAM);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Checks that no frame is dropped at equal rates with enough buffers: 5 when
+* the done interrupts of the two cores alternate, 6 when they are serviced
+* in any order. The latencies vary by less than half a frame period. Only
+* the first frame of the reader is repeated.
+*
+******************************************************************************/
+static int CheckNoDrops(const Rates *RatesPtr, u32 NumBuffers,
+			XVFrmbufMgr_Policy Policy,
+			const XVFrmbufMgr_Stats *StatsPtr)
+{
+	u32 MinBuffers;
+
+	if (RatesPtr->WrPeriod != RatesPtr->RdPeriod) {
+		return XST_SUCCESS;
+	}
+
+	MinBuffers = (RatesPtr->RdPhase == RANDOM_PHASE) ? 6U : 5U;
+	if (NumBuffers < MinBuffers) {
+		return XST_SUCCESS;
+	}
+
+	CHECK(StatsPtr->WrDrops == 0U);
+	if ((Policy == XVFRMBUFMGR_POLICY_FIFO) ||
+	    (RatesPtr->RdPhase != RANDOM_PHASE)) {
+		CHECK(StatsPtr->RdDrops == 0U);
+		CHECK(StatsPtr->Repeats <= 1U);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Runs every rate, policy and number of buffers, first with address functions
+* that do not fail, then with address functions failing at random.
+*
+******************************************************************************/
+static int TestSim(void)
+{
+	static const char *PolicyNames[] = { "fifo", "latest" };
+	XVFrmbufMgr_Stats Stats;
+	u32 Fails[] = { 0U, FAIL_PERCENT };
+	u32 FailIdx;
+	u32 Rate;
+	u32 Count;
+	u32 Policy;
+
+	for (FailIdx = 0; FailIdx < 2U; FailIdx++) {
+		FailPercent = Fails[FailIdx];
+		printf("Address functions failing: %u%%\r\n", FailPercent);
+		printf("%-14s %-7s %4s %8s %8s %8s %8s\r\n", "Rates", "Policy",
+		       "Bufs", "WrDrops", "RdDrops", "Repeats", "Latency");
+
+		for (Rate = 0; Rate < NUM_RATES; Rate++) {
+			for (Policy = 0; Policy < 2U; Policy++) {
+				for (Count = 0; Count < NUM_BUFFER_COUNTS;
+				     Count++) {
+					CHECK(RunSim(BufferCounts[Count],
+						(XVFrmbufMgr_Policy)Policy,
+						&RateList[Rate],
+						&Stats) == XST_SUCCESS);
+					printf("%-14s %-7s %4u %8u %8u %8u %8.0f\r\n",
+					       RateList[Rate].Name,
+					       PolicyNames[Policy],
+					       BufferCounts[Count],
+					       Stats.WrDrops, Stats.RdDrops,
+					       Stats.Repeats,
+					       (double)Stats.LatencyTotal /
+					       (double)Stats.LatencyCount);
+
+					if ((FailPercent == 0U) &&
+					    (CheckNoDrops(&RateList[Rate],
+						BufferCounts[Count],
+						(XVFrmbufMgr_Policy)Policy,
+						&Stats) != XST_SUCCESS)) {
+						return XST_FAILURE;
+					}
+				}
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	srand(1U);
+
+	if ((InitCores() != XST_SUCCESS) ||
+	    (TestInitialize() != XST_SUCCESS) ||
+	    (TestSim() != XST_SUCCESS)) {
+		printf("Frame buffer manager test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran Frame buffer manager test\r\n");
+	return 0;
+}
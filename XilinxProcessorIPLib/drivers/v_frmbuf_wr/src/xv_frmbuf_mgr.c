@@ -0,0 +1,581 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbuf_mgr.c
+* @addtogroup v_frmbuf_wr_v4_6
+* @{
+*
+* Frame buffer manager. See xv_frmbuf_mgr.h for a detailed description.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.60  ag    10/19/26   First release
+*                       Honour the status of the address functions, add the
+*                       address functions of the cores and check the
+*                       alignment of the buffers
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_frmbuf_mgr.h"
+#if !defined (__MICROBLAZE__) && !defined (__linux__)
+#include "xpseudo_asm.h"
+#endif
+#ifndef __linux__
+#include "xparameters.h"
+#endif
+#include "xv_frmbufwr_l2.h"
+#if defined (XPAR_XV_FRMBUFRD_NUM_INSTANCES)
+#include "xv_frmbufrd_l2.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#define XVFRMBUFMGR_QUEUE_MASK          (XVFRMBUFMGR_MAX_BUFFERS - 1)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/*
+ * Orders the accesses to a queue entry and to the queue index publishing it,
+ * as seen by the other processor. MicroBlaze has a single in-order core.
+ */
+#if defined (__MICROBLAZE__)
+#define XVFRMBUFMGR_BARRIER()
+#elif defined (__linux__)
+#define XVFRMBUFMGR_BARRIER()           __sync_synchronize()
+#else
+#define XVFRMBUFMGR_BARRIER()           dmb()
+#endif
+
+/************************** Function Prototypes ******************************/
+static void XVFrmbufMgr_Push(XVFrmbufMgr_Queue *QueuePtr, u32 Index);
+static u32 XVFrmbufMgr_Pop(XVFrmbufMgr_Queue *QueuePtr, u32 *IndexPtr);
+static u32 XVFrmbufMgr_Take(XVFrmbufMgr_Queue *QueuePtr,
+                            XVFrmbufMgr_Port *PortPtr,
+                            u32 *IndexPtr);
+static int XVFrmbufMgr_Program(XVFrmbufMgr *MgrPtr,
+                               XVFrmbufMgr_Port *PortPtr,
+                               u32 Index);
+
+/*****************************************************************************/
+/**
+* This function queues a buffer index. Only one context may push to a queue.
+*
+* @param  QueuePtr is a pointer to the queue
+* @param  Index is the buffer index
+*
+* @return None
+*
+******************************************************************************/
+static void XVFrmbufMgr_Push(XVFrmbufMgr_Queue *QueuePtr, u32 Index)
+{
+    u32 Head = QueuePtr->Head;
+
+    /* Each buffer is in at most one queue, so a queue cannot overflow */
+    Xil_AssertVoid((Head - QueuePtr->Tail) < XVFRMBUFMGR_MAX_BUFFERS);
+
+    QueuePtr->Index[Head & XVFRMBUFMGR_QUEUE_MASK] = (u8)Index;
+    /* The entry must be visible before the consumer sees the new head */
+    XVFRMBUFMGR_BARRIER();
+    QueuePtr->Head = Head + 1;
+}
+
+/*****************************************************************************/
+/**
+* This function dequeues a buffer index. Only one context may pop from a
+* queue.
+*
+* @param  QueuePtr is a pointer to the queue
+* @param  IndexPtr is a pointer to the dequeued buffer index
+*
+* @return TRUE if a buffer was dequeued, FALSE if the queue is empty
+*
+******************************************************************************/
+static u32 XVFrmbufMgr_Pop(XVFrmbufMgr_Queue *QueuePtr, u32 *IndexPtr)
+{
+    u32 Tail = QueuePtr->Tail;
+
+    if (Tail == QueuePtr->Head) {
+        return (FALSE);
+    }
+
+    /* Read the entry after the head that published it */
+    XVFRMBUFMGR_BARRIER();
+    *IndexPtr = QueuePtr->Index[Tail & XVFRMBUFMGR_QUEUE_MASK];
+    /* The entry must be read before the producer can reuse it */
+    XVFRMBUFMGR_BARRIER();
+    QueuePtr->Tail = Tail + 1;
+
+    return (TRUE);
+}
+
+/*****************************************************************************/
+/**
+* This function takes the next buffer of a core: the buffer that could not be
+* programmed before, if any, else a buffer dequeued from a queue.
+*
+* @param  QueuePtr is a pointer to the queue the core pops from
+* @param  PortPtr is a pointer to the core
+* @param  IndexPtr is a pointer to the buffer index
+*
+* @return TRUE if a buffer was taken, FALSE if none is available
+*
+******************************************************************************/
+static u32 XVFrmbufMgr_Take(XVFrmbufMgr_Queue *QueuePtr,
+                            XVFrmbufMgr_Port *PortPtr,
+                            u32 *IndexPtr)
+{
+    if (PortPtr->Pending != XVFRMBUFMGR_NO_BUFFER) {
+        *IndexPtr = PortPtr->Pending;
+        PortPtr->Pending = XVFRMBUFMGR_NO_BUFFER;
+        return (TRUE);
+    }
+
+    return (XVFrmbufMgr_Pop(QueuePtr, IndexPtr));
+}
+
+/*****************************************************************************/
+/**
+* This function programs a buffer into a core for the frame after the next
+* one. If the address functions fail, the core keeps the buffer Next.
+*
+* @param  MgrPtr is a pointer to the manager
+* @param  PortPtr is a pointer to the core
+* @param  Index is the buffer index
+*
+* @return XST_SUCCESS if the buffer is programmed, else the status of the
+*         address function that failed
+*
+******************************************************************************/
+static int XVFrmbufMgr_Program(XVFrmbufMgr *MgrPtr,
+                               XVFrmbufMgr_Port *PortPtr,
+                               u32 Index)
+{
+    int Status;
+
+    Status = PortPtr->SetAddr(PortPtr->InstancePtr,
+                              MgrPtr->Buffers[Index].Addr);
+    if ((Status == XST_SUCCESS) && (PortPtr->SetChromaAddr != NULL)) {
+        Status = PortPtr->SetChromaAddr(PortPtr->InstancePtr,
+                                        MgrPtr->Buffers[Index].ChromaAddr);
+        if (Status != XST_SUCCESS) {
+            /* Do not mix the luma of Index with the chroma of Next */
+            (void)PortPtr->SetAddr(PortPtr->InstancePtr,
+                                   MgrPtr->Buffers[PortPtr->Next].Addr);
+        }
+    }
+
+    if (Status == XST_SUCCESS) {
+        PortPtr->Next = Index;
+    }
+
+    return (Status);
+}
+
+/*****************************************************************************/
+/**
+* This function initializes the manager and puts all buffers in the free
+* queue
+*
+* @param  MgrPtr is a pointer to the manager
+* @param  Buffers is the array of NumBuffers buffers, copied by the manager
+* @param  NumBuffers is the number of buffers, from XVFRMBUFMGR_MIN_BUFFERS
+*         to XVFRMBUFMGR_MAX_BUFFERS
+* @param  Align is the address alignment of the cores in bytes, a power of 2:
+*         2 * 4 * pixels per clock for the Frame Buffer Write and Read cores
+* @param  Policy is the reader policy
+* @param  GetTime is the time source of the latency statistics, or NULL
+*
+* @return XST_SUCCESS if the manager is initialized, else XST_INVALID_PARAM
+*         if the number of buffers is out of range or an address is not
+*         aligned
+*
+******************************************************************************/
+int XVFrmbufMgr_Initialize(XVFrmbufMgr *MgrPtr,
+                           const XVFrmbufMgr_Buffer *Buffers,
+                           u32 NumBuffers,
+                           u32 Align,
+                           XVFrmbufMgr_Policy Policy,
+                           XVFrmbufMgr_GetTime GetTime)
+{
+    u32 Index;
+
+    Xil_AssertNonvoid(MgrPtr != NULL);
+    Xil_AssertNonvoid(Buffers != NULL);
+    Xil_AssertNonvoid((Align != 0) && ((Align & (Align - 1)) == 0));
+    Xil_AssertNonvoid((Policy == XVFRMBUFMGR_POLICY_FIFO) ||
+                      (Policy == XVFRMBUFMGR_POLICY_LATEST));
+
+    if ((NumBuffers < XVFRMBUFMGR_MIN_BUFFERS) ||
+        (NumBuffers > XVFRMBUFMGR_MAX_BUFFERS)) {
+        return (XST_INVALID_PARAM);
+    }
+
+    /* The address functions reject unaligned buffers */
+    for (Index = 0; Index < NumBuffers; Index++) {
+        if ((Buffers[Index].Addr == 0) ||
+            ((Buffers[Index].Addr & (Align - 1)) != 0) ||
+            ((Buffers[Index].ChromaAddr & (Align - 1)) != 0)) {
+            return (XST_INVALID_PARAM);
+        }
+    }
+
+    memset((void *)MgrPtr, 0, sizeof(XVFrmbufMgr));
+    memcpy(MgrPtr->Buffers, Buffers, NumBuffers * sizeof(XVFrmbufMgr_Buffer));
+    MgrPtr->NumBuffers = NumBuffers;
+    MgrPtr->Policy = Policy;
+    MgrPtr->GetTime = GetTime;
+    MgrPtr->Wr.Pending = XVFRMBUFMGR_NO_BUFFER;
+    MgrPtr->Rd.Pending = XVFRMBUFMGR_NO_BUFFER;
+    MgrPtr->Stats.LatencyMin = ~(u64)0;
+
+    for (Index = 0; Index < NumBuffers; Index++) {
+        XVFrmbufMgr_Push(&MgrPtr->FreeQueue, Index);
+    }
+
+    return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function sets the Frame Buffer Write core of the manager
+*
+* @param  MgrPtr is a pointer to the manager
+* @param  InstancePtr is the core instance passed to the address functions
+* @param  SetAddr programs the buffer address
+* @param  SetChromaAddr programs the chroma buffer address of semi-planar
+*         formats, or NULL
+*
+* @return None
+*
+******************************************************************************/
+void XVFrmbufMgr_SetWriter(XVFrmbufMgr *MgrPtr,
+                           void *InstancePtr,
+                           XVFrmbufMgr_SetAddr SetAddr,
+                           XVFrmbufMgr_SetAddr SetChromaAddr)
+{
+    Xil_AssertVoid(MgrPtr != NULL);
+    Xil_AssertVoid(SetAddr != NULL);
+
+    MgrPtr->Wr.InstancePtr = InstancePtr;
+    MgrPtr->Wr.SetAddr = SetAddr;
+    MgrPtr->Wr.SetChromaAddr = SetChromaAddr;
+}
+
+/*****************************************************************************/
+/**
+* This function sets the Frame Buffer Read core of the manager
+*
+* @param  MgrPtr is a pointer to the manager
+* @param  InstancePtr is the core instance passed to the address functions
+* @param  SetAddr programs the buffer address
+* @param  SetChromaAddr programs the chroma buffer address of semi-planar
+*         formats, or NULL
+*
+* @return None
+*
+******************************************************************************/
+void XVFrmbufMgr_SetReader(XVFrmbufMgr *MgrPtr,
+                           void *InstancePtr,
+                           XVFrmbufMgr_SetAddr SetAddr,
+                           XVFrmbufMgr_SetAddr SetChromaAddr)
+{
+    Xil_AssertVoid(MgrPtr != NULL);
+    Xil_AssertVoid(SetAddr != NULL);
+
+    MgrPtr->Rd.InstancePtr = InstancePtr;
+    MgrPtr->Rd.SetAddr = SetAddr;
+    MgrPtr->Rd.SetChromaAddr = SetChromaAddr;
+}
+
+/*****************************************************************************/
+/**
+* This function programs the first buffer into the Frame Buffer Write core.
+* It must be called before the core is started, and again if it fails.
+*
+* @param  MgrPtr is a pointer to the manager
+*
+* @return XST_SUCCESS if the buffer is programmed, XST_FAILURE if no buffer
+*         is free, else the status of the address function that failed
+*
+******************************************************************************/
+int XVFrmbufMgr_WrStart(XVFrmbufMgr *MgrPtr)
+{
+    u32 Index;
+    int Status;
+
+    Xil_AssertNonvoid(MgrPtr != NULL);
+    Xil_AssertNonvoid(MgrPtr->Wr.SetAddr != NULL);
+
+    if (!XVFrmbufMgr_Take(&MgrPtr->FreeQueue, &MgrPtr->Wr, &Index)) {
+        return (XST_FAILURE);
+    }
+
+    Status = XVFrmbufMgr_Program(MgrPtr, &MgrPtr->Wr, Index);
+    if (Status == XST_SUCCESS) {
+        MgrPtr->Wr.Active = Index;
+    } else {
+        MgrPtr->Wr.Pending = Index;
+    }
+
+    return (Status);
+}
+
+/*****************************************************************************/
+/**
+* This function programs the first completed frame into the Frame Buffer
+* Read core. It must be called before the core is started, and again if it
+* fails.
+*
+* @param  MgrPtr is a pointer to the manager
+*
+* @return XST_SUCCESS if the buffer is programmed, XST_NO_DATA if no frame
+*         was completed yet, else the status of the address function that
+*         failed
+*
+******************************************************************************/
+int XVFrmbufMgr_RdStart(XVFrmbufMgr *MgrPtr)
+{
+    u32 Index;
+    int Status;
+
+    Xil_AssertNonvoid(MgrPtr != NULL);
+    Xil_AssertNonvoid(MgrPtr->Rd.SetAddr != NULL);
+
+    if (!XVFrmbufMgr_Take(&MgrPtr->ReadyQueue, &MgrPtr->Rd, &Index)) {
+        return (XST_NO_DATA);
+    }
+
+    Status = XVFrmbufMgr_Program(MgrPtr, &MgrPtr->Rd, Index);
+    if (Status == XST_SUCCESS) {
+        MgrPtr->Rd.Active = Index;
+    } else {
+        MgrPtr->Rd.Pending = Index;
+    }
+
+    return (Status);
+}
+
+/*****************************************************************************/
+/**
+* This function is the done callback of the Frame Buffer Write core. It
+* queues the completed frame for the reader and programs a free buffer for
+* the frame after the next one. If no buffer is free, the completed frame is
+* dropped and its buffer is written again. If the free buffer cannot be
+* programmed, the core writes the frame in progress again, which is dropped.
+*
+* @param  CallbackRef is a pointer to the manager
+*
+* @return None
+*
+******************************************************************************/
+void XVFrmbufMgr_WrDoneCallback(void *CallbackRef)
+{
+    XVFrmbufMgr *MgrPtr = (XVFrmbufMgr *)CallbackRef;
+    u32 Done;
+    u32 New;
+
+    Xil_AssertVoid(MgrPtr != NULL);
+
+    /* The core latched Next at the start of the frame now in progress */
+    Done = MgrPtr->Wr.Active;
+    MgrPtr->Wr.Active = MgrPtr->Wr.Next;
+
+    if (XVFrmbufMgr_Take(&MgrPtr->FreeQueue, &MgrPtr->Wr, &New)) {
+        if (XVFrmbufMgr_Program(MgrPtr, &MgrPtr->Wr, New) != XST_SUCCESS) {
+            /* Programmed at the next frame, the core keeps Next */
+            MgrPtr->Wr.Pending = New;
+        }
+    } else if (Done != MgrPtr->Wr.Active) {
+        /* Write over the completed frame */
+        (void)XVFrmbufMgr_Program(MgrPtr, &MgrPtr->Wr, Done);
+    }
+
+    /*
+     * Done is written again on the first frame after the start, or when no
+     * new buffer could be programmed
+     */
+    if ((MgrPtr->Wr.Next == MgrPtr->Wr.Active) ||
+        (MgrPtr->Wr.Next == Done)) {
+        MgrPtr->Stats.WrDrops++;
+    }
+
+    if ((Done != MgrPtr->Wr.Active) && (Done != MgrPtr->Wr.Next)) {
+        if (MgrPtr->GetTime != NULL) {
+            MgrPtr->DoneTime[Done] = MgrPtr->GetTime();
+        }
+        MgrPtr->Shown[Done] = 0;
+        XVFrmbufMgr_Push(&MgrPtr->ReadyQueue, Done);
+        MgrPtr->Stats.FramesWritten++;
+    }
+}
+
+/*****************************************************************************/
+/**
+* This function is the done callback of the Frame Buffer Read core. It
+* returns the buffer of the completed frame to the writer and programs the
+* next ready frame, or the most recent one with the latest policy, for the
+* frame after the next one. If no frame is ready, or the ready frame cannot
+* be programmed, the current one is repeated.
+*
+* @param  CallbackRef is a pointer to the manager
+*
+* @return None
+*
+******************************************************************************/
+void XVFrmbufMgr_RdDoneCallback(void *CallbackRef)
+{
+    XVFrmbufMgr *MgrPtr = (XVFrmbufMgr *)CallbackRef;
+    XVFrmbufMgr_Stats *StatsPtr;
+    u64 Latency;
+    u32 Done;
+    u32 New;
+    u32 Newer;
+
+    Xil_AssertVoid(MgrPtr != NULL);
+
+    StatsPtr = &MgrPtr->Stats;
+
+    /* The core latched Next at the start of the frame now in progress */
+    Done = MgrPtr->Rd.Active;
+    MgrPtr->Rd.Active = MgrPtr->Rd.Next;
+    StatsPtr->FramesRead++;
+
+    if (!MgrPtr->Shown[Done]) {
+        MgrPtr->Shown[Done] = 1;
+        if (MgrPtr->GetTime != NULL) {
+            Latency = MgrPtr->GetTime() - MgrPtr->DoneTime[Done];
+            if (Latency < StatsPtr->LatencyMin) {
+                StatsPtr->LatencyMin = Latency;
+            }
+            if (Latency > StatsPtr->LatencyMax) {
+                StatsPtr->LatencyMax = Latency;
+            }
+            StatsPtr->LatencyTotal += Latency;
+            StatsPtr->LatencyCount++;
+        }
+    }
+
+    if (XVFrmbufMgr_Take(&MgrPtr->ReadyQueue, &MgrPtr->Rd, &New)) {
+        if (MgrPtr->Policy == XVFRMBUFMGR_POLICY_LATEST) {
+            while (XVFrmbufMgr_Pop(&MgrPtr->ReadyQueue, &Newer)) {
+                XVFrmbufMgr_Push(&MgrPtr->FreeQueue, New);
+                StatsPtr->RdDrops++;
+                New = Newer;
+            }
+        }
+        if (XVFrmbufMgr_Program(MgrPtr, &MgrPtr->Rd, New) != XST_SUCCESS) {
+            /* Programmed at the next frame, the core keeps Next */
+            MgrPtr->Rd.Pending = New;
+        }
+    }
+
+    if (MgrPtr->Rd.Next == MgrPtr->Rd.Active) {
+        StatsPtr->Repeats++;
+    }
+
+    /* Done is no longer read unless the core reads it again */
+    if (Done != MgrPtr->Rd.Active) {
+        XVFrmbufMgr_Push(&MgrPtr->FreeQueue, Done);
+    }
+}
+
+/*****************************************************************************/
+/**
+* This function copies the statistics of the manager. The counters are
+* updated by the done callbacks and may change during the copy.
+*
+* @param  MgrPtr is a pointer to the manager
+* @param  StatsPtr is a pointer to the copy
+*
+* @return None
+*
+******************************************************************************/
+void XVFrmbufMgr_GetStats(XVFrmbufMgr *MgrPtr, XVFrmbufMgr_Stats *StatsPtr)
+{
+    Xil_AssertVoid(MgrPtr != NULL);
+    Xil_AssertVoid(StatsPtr != NULL);
+
+    memcpy(StatsPtr, &MgrPtr->Stats, sizeof(XVFrmbufMgr_Stats));
+}
+
+/*****************************************************************************/
+/**
+* This function programs the buffer address of a Frame Buffer Write core,
+* with XVFrmbufWr_SetBufferAddr()
+*
+* @param  InstancePtr is a pointer to the XV_FrmbufWr_l2 core instance
+* @param  Addr is the buffer address
+*
+* @return XST_SUCCESS if the address is programmed, else the status of
+*         XVFrmbufWr_SetBufferAddr()
+*
+******************************************************************************/
+int XVFrmbufMgr_WrSetAddr(void *InstancePtr, UINTPTR Addr)
+{
+    return (XVFrmbufWr_SetBufferAddr((XV_FrmbufWr_l2 *)InstancePtr, Addr));
+}
+
+/*****************************************************************************/
+/**
+* This function programs the chroma buffer address of a Frame Buffer Write
+* core, with XVFrmbufWr_SetChromaBufferAddr()
+*
+* @param  InstancePtr is a pointer to the XV_FrmbufWr_l2 core instance
+* @param  Addr is the chroma buffer address
+*
+* @return XST_SUCCESS if the address is programmed, else the status of
+*         XVFrmbufWr_SetChromaBufferAddr()
+*
+******************************************************************************/
+int XVFrmbufMgr_WrSetChromaAddr(void *InstancePtr, UINTPTR Addr)
+{
+    return (XVFrmbufWr_SetChromaBufferAddr((XV_FrmbufWr_l2 *)InstancePtr,
+                                           Addr));
+}
+
+#if defined (XPAR_XV_FRMBUFRD_NUM_INSTANCES)
+/*****************************************************************************/
+/**
+* This function programs the buffer address of a Frame Buffer Read core,
+* with XVFrmbufRd_SetBufferAddr()
+*
+* @param  InstancePtr is a pointer to the XV_FrmbufRd_l2 core instance
+* @param  Addr is the buffer address
+*
+* @return XST_SUCCESS if the address is programmed, else the status of
+*         XVFrmbufRd_SetBufferAddr()
+*
+******************************************************************************/
+int XVFrmbufMgr_RdSetAddr(void *InstancePtr, UINTPTR Addr)
+{
+    return (XVFrmbufRd_SetBufferAddr((XV_FrmbufRd_l2 *)InstancePtr, Addr));
+}
+
+/*****************************************************************************/
+/**
+* This function programs the chroma buffer address of a Frame Buffer Read
+* core, with XVFrmbufRd_SetChromaBufferAddr()
+*
+* @param  InstancePtr is a pointer to the XV_FrmbufRd_l2 core instance
+* @param  Addr is the chroma buffer address
+*
+* @return XST_SUCCESS if the address is programmed, else the status of
+*         XVFrmbufRd_SetChromaBufferAddr()
+*
+******************************************************************************/
+int XVFrmbufMgr_RdSetChromaAddr(void *InstancePtr, UINTPTR Addr)
+{
+    return (XVFrmbufRd_SetChromaBufferAddr((XV_FrmbufRd_l2 *)InstancePtr,
+                                           Addr));
+}
+#endif
+/** @} */
@@ -0,0 +1,236 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_frmbuf_mgr.h
+* @addtogroup v_frmbuf_wr_v4_6
+* @{
+* @details
+*
+* This header file contains the frame buffer manager, which passes the frames
+* of a Frame Buffer Write core to a Frame Buffer Read core.
+*
+* The manager owns a pool of NumBuffers frame buffers. Buffers are passed
+* between the two cores with two single producer, single consumer lock-free
+* queues: the writer done handler queues each completed frame in the ready
+* queue, and the reader done handler returns the buffers it no longer uses
+* in the free queue. The handlers only move buffer indices and do not
+* allocate, so they can run in interrupt context on different processors.
+*
+* <b>Usage</b>
+*
+*   - Call XVFrmbufMgr_Initialize() with the buffer addresses, their
+*     alignment and the reader policy.
+*   - Give the core instances and their address functions with
+*     XVFrmbufMgr_SetWriter() and XVFrmbufMgr_SetReader(), e.g.
+*     XVFrmbufMgr_WrSetAddr() and XVFrmbufMgr_RdSetAddr(), which call
+*     XVFrmbufWr_SetBufferAddr() and XVFrmbufRd_SetBufferAddr().
+*   - Register XVFrmbufMgr_WrDoneCallback() and XVFrmbufMgr_RdDoneCallback()
+*     as XVFRMBUFWR_HANDLER_DONE and XVFRMBUFRD_HANDLER_DONE callbacks of the
+*     cores, with the manager as callback reference, and enable the done
+*     interrupts.
+*   - Call XVFrmbufMgr_WrStart() then XVFrmbufWr_Start(). Once the writer
+*     completed a frame, call XVFrmbufMgr_RdStart() then XVFrmbufRd_Start().
+*
+* <b>Buffer timing</b>
+*
+* The cores run in auto-restart mode and latch the buffer address at the
+* start of a frame, so when the done interrupt of frame n is serviced frame
+* n+1 already uses the address programmed during frame n. The handlers
+* program the buffer of frame n+2. Each core therefore holds up to two
+* buffers, and at least 4 buffers are needed. When the two cores run at the
+* same rate, the writer does not drop frames with 5 buffers if the done
+* interrupts of the two cores alternate, and with 6 buffers if they may be
+* serviced in any order, with latencies varying by less than half a frame
+* period. More buffers let the ready queue absorb rate differences.
+*
+* <b>Policies</b>
+*
+*   - XVFRMBUFMGR_POLICY_FIFO: the reader shows every frame in order. If the
+*     writer finds no free buffer, it writes the next frame over the frame it
+*     just completed, which is dropped.
+*   - XVFRMBUFMGR_POLICY_LATEST: the reader shows the most recent frame and
+*     returns the older queued frames to the free queue, which are dropped.
+*
+* With both policies the reader repeats the buffer it shows if no new frame
+* is ready.
+*
+* <b>Address errors</b>
+*
+* If an address function fails, the core keeps the buffer programmed before:
+* the writer writes the frame in progress again, which is dropped, and the
+* reader repeats the frame it shows. The buffer that could not be programmed
+* is kept by the handler and programmed at the next done interrupt.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.60  ag    10/19/26   First release
+*                       Honour the status of the address functions, add the
+*                       address functions of the cores and check the
+*                       alignment of the buffers
+* </pre>
+*
+******************************************************************************/
+#ifndef XV_FRMBUF_MGR_H     /* prevent circular inclusions */
+#define XV_FRMBUF_MGR_H     /* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions *****************************/
+/** Maximum number of buffers of the pool, must be a power of 2 */
+#define XVFRMBUFMGR_MAX_BUFFERS             (16)
+/** Minimum number of buffers of the pool */
+#define XVFRMBUFMGR_MIN_BUFFERS             (4)
+/** Buffer index of no buffer */
+#define XVFRMBUFMGR_NO_BUFFER               (XVFRMBUFMGR_MAX_BUFFERS)
+
+/**************************** Type Definitions *******************************/
+/**
+* Reader policies
+*/
+typedef enum {
+  XVFRMBUFMGR_POLICY_FIFO = 0,   /**< Show every frame in order */
+  XVFRMBUFMGR_POLICY_LATEST      /**< Show the most recent frame */
+} XVFrmbufMgr_Policy;
+
+/**
+* Function programming the address of the next frame into a core, e.g.
+* XVFrmbufMgr_WrSetAddr() or XVFrmbufMgr_RdSetAddr().
+*
+* @param    InstancePtr is the core instance given to the manager.
+* @param    Addr is the buffer address.
+*
+* @return   XST_SUCCESS if the address is programmed. Else the core must
+*           keep the address programmed before.
+*
+*/
+typedef int (*XVFrmbufMgr_SetAddr)(void *InstancePtr, UINTPTR Addr);
+
+/**
+* Function returning the current time, in any unit, used for the latency
+* statistics.
+*
+* @return   Current time.
+*
+*/
+typedef u64 (*XVFrmbufMgr_GetTime)(void);
+
+/**
+* Frame buffer of the pool
+*/
+typedef struct {
+  UINTPTR Addr;           /**< Luma or packed buffer address */
+  UINTPTR ChromaAddr;     /**< Chroma buffer address of semi-planar formats,
+                               0 if not used */
+} XVFrmbufMgr_Buffer;
+
+/**
+* Single producer, single consumer queue of buffer indices
+*/
+typedef struct {
+  volatile u32 Head;      /**< Written by the producer only */
+  volatile u32 Tail;      /**< Written by the consumer only */
+  volatile u8 Index[XVFRMBUFMGR_MAX_BUFFERS]; /**< Queued buffer indices */
+} XVFrmbufMgr_Queue;
+
+/**
+* Core using the buffers
+*/
+typedef struct {
+  void *InstancePtr;                 /**< Core instance */
+  XVFrmbufMgr_SetAddr SetAddr;       /**< Programs the buffer address */
+  XVFrmbufMgr_SetAddr SetChromaAddr; /**< Programs the chroma buffer
+                                          address, NULL if not used */
+  u32 Active;                        /**< Buffer of the current frame */
+  u32 Next;                          /**< Buffer of the next frame */
+  u32 Pending;                       /**< Buffer taken from a queue that
+                                          could not be programmed, or
+                                          XVFRMBUFMGR_NO_BUFFER */
+} XVFrmbufMgr_Port;
+
+/**
+* Statistics. The writer fields are updated by the writer done handler and the
+* other fields by the reader done handler.
+*/
+typedef struct {
+  u32 FramesWritten;      /**< Frames queued for the reader */
+  u32 WrDrops;            /**< Frames overwritten, no buffer was free */
+  u32 FramesRead;         /**< Frames shown by the reader */
+  u32 RdDrops;            /**< Frames skipped by the latest policy */
+  u32 Repeats;            /**< Frames shown again, no new frame was ready */
+  u32 LatencyCount;       /**< Frames in the latency statistics */
+  u64 LatencyMin;         /**< Minimum latency */
+  u64 LatencyMax;         /**< Maximum latency */
+  u64 LatencyTotal;       /**< Sum of the latencies */
+} XVFrmbufMgr_Stats;
+
+/**
+* Frame buffer manager. The user is required to allocate a variable of this
+* type for every writer to reader path. The latency of a frame is the time
+* from the done interrupt of the writer to the done interrupt of the reader
+* for the first time the frame was shown.
+*/
+typedef struct {
+  XVFrmbufMgr_Buffer Buffers[XVFRMBUFMGR_MAX_BUFFERS]; /**< Buffer pool */
+  volatile u64 DoneTime[XVFRMBUFMGR_MAX_BUFFERS]; /**< Writer done time of
+                                                       the frame in each
+                                                       buffer */
+  volatile u8 Shown[XVFRMBUFMGR_MAX_BUFFERS]; /**< Frame in the buffer was
+                                                   shown */
+  u32 NumBuffers;                        /**< Number of buffers */
+  XVFrmbufMgr_Policy Policy;             /**< Reader policy */
+  XVFrmbufMgr_GetTime GetTime;           /**< Time source, NULL if none */
+  XVFrmbufMgr_Port Wr;                   /**< Frame Buffer Write core */
+  XVFrmbufMgr_Port Rd;                   /**< Frame Buffer Read core */
+  XVFrmbufMgr_Queue FreeQueue;           /**< Reader to writer */
+  XVFrmbufMgr_Queue ReadyQueue;          /**< Writer to reader */
+  XVFrmbufMgr_Stats Stats;               /**< Statistics */
+} XVFrmbufMgr;
+
+/************************** Function Prototypes ******************************/
+int XVFrmbufMgr_Initialize(XVFrmbufMgr *MgrPtr,
+                           const XVFrmbufMgr_Buffer *Buffers,
+                           u32 NumBuffers,
+                           u32 Align,
+                           XVFrmbufMgr_Policy Policy,
+                           XVFrmbufMgr_GetTime GetTime);
+void XVFrmbufMgr_SetWriter(XVFrmbufMgr *MgrPtr,
+                           void *InstancePtr,
+                           XVFrmbufMgr_SetAddr SetAddr,
+                           XVFrmbufMgr_SetAddr SetChromaAddr);
+void XVFrmbufMgr_SetReader(XVFrmbufMgr *MgrPtr,
+                           void *InstancePtr,
+                           XVFrmbufMgr_SetAddr SetAddr,
+                           XVFrmbufMgr_SetAddr SetChromaAddr);
+int XVFrmbufMgr_WrStart(XVFrmbufMgr *MgrPtr);
+int XVFrmbufMgr_RdStart(XVFrmbufMgr *MgrPtr);
+void XVFrmbufMgr_WrDoneCallback(void *CallbackRef);
+void XVFrmbufMgr_RdDoneCallback(void *CallbackRef);
+void XVFrmbufMgr_GetStats(XVFrmbufMgr *MgrPtr, XVFrmbufMgr_Stats *StatsPtr);
+
+/* Address functions of the cores, the reader ones need a Frame Buffer Read
+   core in the BSP */
+int XVFrmbufMgr_WrSetAddr(void *InstancePtr, UINTPTR Addr);
+int XVFrmbufMgr_WrSetChromaAddr(void *InstancePtr, UINTPTR Addr);
+int XVFrmbufMgr_RdSetAddr(void *InstancePtr, UINTPTR Addr);
+int XVFrmbufMgr_RdSetChromaAddr(void *InstancePtr, UINTPTR Addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
@@ -0,0 +1,266 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_hscaler_sw_bench_example.c
+*
+* This file contains an example which measures the software scalers of
+* xv_hscaler_sw.h and xv_vscaler_sw.h for 1080p to 720p and 4K to 1080p, on
+* the Y plane of a frame. The frame is scaled horizontally then vertically,
+* in NUM_STRIPES stripes of lines, as it would be by NUM_STRIPES threads. The
+* output is checked against the scalar model.
+*
+* The H and V Scaler instances are only used for their configuration and
+* coefficients, the cores are not started. The design must contain
+* polyphase H and V Scalers.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.4   ag    10/19/26   First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xv_hscaler_sw.h"
+#include "xv_vscaler_sw.h"
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include <string.h>
+
+/************************** Constant Definitions ******************************/
+
+#ifndef HSC_DEVICE_ID
+#define HSC_DEVICE_ID		XPAR_XV_HSCALER_0_DEVICE_ID
+#endif
+#ifndef VSC_DEVICE_ID
+#define VSC_DEVICE_ID		XPAR_XV_VSCALER_0_DEVICE_ID
+#endif
+#ifndef NUM_STRIPES
+#define NUM_STRIPES		4U	/**< Stripes per frame */
+#endif
+#define BITS_PER_COMP		8U	/**< Component depth */
+#define MAX_WIDTH		3840U	/**< Largest input width */
+#define MAX_HEIGHT		2160U	/**< Largest input height */
+#define ITERATIONS		4U	/**< Frames per measurement */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Benchmark resolution
+ */
+typedef struct {
+	u32 WidthIn;
+	u32 HeightIn;
+	u32 WidthOut;
+	u32 HeightOut;
+} BenchMode;
+
+/************************** Function Prototypes ******************************/
+
+int XV_HScalerSwBenchExample(u16 HscDeviceId, u16 VscDeviceId);
+static u64 ScaleFrame(const BenchMode *Mode, u16 *Out, u32 UseRef);
+
+/************************** Variable Definitions *****************************/
+
+static XV_Hscaler_l2 Hsc;		/**< H Scaler instance */
+static XV_Vscaler_l2 Vsc;		/**< V Scaler instance */
+static XV_HScalerSw HscSw;		/**< Software H Scaler */
+static XV_VScalerSw VscSw;		/**< Software V Scaler */
+
+static const BenchMode Modes[] = {
+	{1920U, 1080U, 1280U, 720U},
+	{3840U, 2160U, 1920U, 1080U},
+};
+
+#if defined(__ICCARM__)
+    #pragma data_alignment = 64
+	u16 BenchIn[MAX_WIDTH * MAX_HEIGHT]; /**< Input frame */
+    #pragma data_alignment = 64
+	u16 BenchMid[MAX_WIDTH * MAX_HEIGHT]; /**< H scaled frame */
+    #pragma data_alignment = 64
+	u16 BenchOut[MAX_WIDTH * MAX_HEIGHT]; /**< Output frame */
+    #pragma data_alignment = 64
+	u16 BenchRef[MAX_WIDTH * MAX_HEIGHT]; /**< Scalar model output */
+#else
+	u16 BenchIn[MAX_WIDTH * MAX_HEIGHT] __attribute__ ((aligned (64)));
+				/**< Input frame */
+	u16 BenchMid[MAX_WIDTH * MAX_HEIGHT] __attribute__ ((aligned (64)));
+				/**< H scaled frame */
+	u16 BenchOut[MAX_WIDTH * MAX_HEIGHT] __attribute__ ((aligned (64)));
+				/**< Output frame */
+	u16 BenchRef[MAX_WIDTH * MAX_HEIGHT] __attribute__ ((aligned (64)));
+				/**< Scalar model output */
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	Status = XV_HScalerSwBenchExample((u16)HSC_DEVICE_ID,
+			(u16)VSC_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Software scaler benchmark Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran Software scaler benchmark Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the scaler instances and measures the software
+* scalers for each mode of Modes.
+*
+* @param	HscDeviceId is the device Id of the H Scaler.
+* @param	VscDeviceId is the device Id of the V Scaler.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int XV_HScalerSwBenchExample(u16 HscDeviceId, u16 VscDeviceId)
+{
+	const BenchMode *Mode;
+	u64 Time;
+	u64 RefTime;
+	u32 Index;
+	int Status;
+
+	Status = XV_HScalerInitialize(&Hsc, HscDeviceId);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XV_VScalerInitialize(&Vsc, VscDeviceId);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < (MAX_WIDTH * MAX_HEIGHT); Index++) {
+		BenchIn[Index] = (u16)((Index * 7U + (Index >> 11)) &
+				((1U << BITS_PER_COMP) - 1U));
+	}
+
+	xil_printf("%20s %12s %12s %8s\r\n", "Mode", "NEON (us)",
+		"Scalar (us)", "Frames/s");
+	for (Index = 0U; Index < (sizeof(Modes) / sizeof(Modes[0])); Index++) {
+		Mode = &Modes[Index];
+
+		Status = XV_HScalerSwSetup(&Hsc, &HscSw, Mode->WidthIn,
+				Mode->WidthOut, 1U, BITS_PER_COMP);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = XV_VScalerSwSetup(&Vsc, &VscSw, Mode->WidthOut,
+				Mode->HeightIn, Mode->HeightOut, 1U,
+				BITS_PER_COMP);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Time = ScaleFrame(Mode, BenchOut, 0U);
+		RefTime = ScaleFrame(Mode, BenchRef, 1U);
+		if (memcmp(BenchOut, BenchRef, Mode->WidthOut *
+				Mode->HeightOut * sizeof(u16)) != 0) {
+			xil_printf("Output differs from the scalar model\r\n");
+			return XST_FAILURE;
+		}
+
+		xil_printf("%4dx%4d->%4dx%4d %12d %12d %8d\r\n",
+			Mode->WidthIn, Mode->HeightIn,
+			Mode->WidthOut, Mode->HeightOut,
+			(u32)((Time * 1000000U) / COUNTS_PER_SECOND),
+			(u32)((RefTime * 1000000U) / COUNTS_PER_SECOND),
+			(u32)(COUNTS_PER_SECOND / Time));
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function scales ITERATIONS frames of BenchIn, horizontally into
+* BenchMid and vertically into Out, in NUM_STRIPES stripes.
+*
+* @param	Mode is the resolution.
+* @param	Out is the output frame.
+* @param	UseRef selects the scalar model.
+*
+* @return	Time of one frame in global timer ticks.
+*
+******************************************************************************/
+static u64 ScaleFrame(const BenchMode *Mode, u16 *Out, u32 UseRef)
+{
+	XTime Start;
+	XTime End;
+	u32 Index;
+	u32 Stripe;
+	u32 First;
+	u32 Last;
+
+	XTime_GetTime(&Start);
+	for (Index = 0U; Index < ITERATIONS; Index++) {
+		for (Stripe = 0U; Stripe < NUM_STRIPES; Stripe++) {
+			First = (Mode->HeightIn * Stripe) / NUM_STRIPES;
+			Last = (Mode->HeightIn * (Stripe + 1U)) / NUM_STRIPES;
+			if (UseRef != 0U) {
+				XV_HScalerSwScaleRef(&HscSw, BenchIn,
+					Mode->WidthIn, BenchMid,
+					Mode->WidthOut, First, Last - First);
+			}
+			else {
+				XV_HScalerSwScale(&HscSw, BenchIn,
+					Mode->WidthIn, BenchMid,
+					Mode->WidthOut, First, Last - First);
+			}
+		}
+
+		/* The V stripes need the whole H scaled frame */
+		for (Stripe = 0U; Stripe < NUM_STRIPES; Stripe++) {
+			First = (Mode->HeightOut * Stripe) / NUM_STRIPES;
+			Last = (Mode->HeightOut * (Stripe + 1U)) / NUM_STRIPES;
+			if (UseRef != 0U) {
+				XV_VScalerSwScaleRef(&VscSw, BenchMid,
+					Mode->WidthOut, Out,
+					Mode->WidthOut, First, Last - First);
+			}
+			else {
+				XV_VScalerSwScale(&VscSw, BenchMid,
+					Mode->WidthOut, Out,
+					Mode->WidthOut, First, Last - First);
+			}
+		}
+	}
+	XTime_GetTime(&End);
+
+	return (u64)(End - Start) / ITERATIONS;
+}
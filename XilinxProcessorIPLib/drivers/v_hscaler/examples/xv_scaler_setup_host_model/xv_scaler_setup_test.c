@@ -0,0 +1,379 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_scaler_setup_test.c
+*
+* This file contains a host test of the setup time of the H and V Scaler
+* drivers, for mode switches between 720p, 1080p and 4K. The register banks
+* of the cores are in host memory.
+*
+* - Each mode switch is checked against a reference instance, whose caches
+*   are cleared and whose register banks are cleared before every setup. The
+*   phases past the larger width are not compared.
+* - The setup is timed without caches, as the driver did before the
+*   coefficient and phase caches, with a reset of the cores before every
+*   switch, as XVprocSs_Reset does, and without reset.
+* - A reset clears the register banks, the drivers must then write the
+*   coefficients and phases again.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.4   ag    10/19/26   First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xv_hscaler_l2.h"
+#include "xv_vscaler_l2.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ******************************/
+
+#define HSC_BANK_SIZE	(XV_HSCALER_CTRL_ADDR_HWREG_PHASESH_V_HIGH + 1U)
+#define VSC_BANK_SIZE	(XV_VSCALER_CTRL_ADDR_HWREG_VFLTCOEFF_HIGH + 1U)
+#define NUM_SWITCHES	2000U	/**< Mode switches per measurement */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Scaling of a mode switch
+ */
+typedef struct {
+	const char *Name;
+	u32 WidthIn;
+	u32 HeightIn;
+	u32 WidthOut;
+	u32 HeightOut;
+} Scaling;
+
+/**
+ * Setup of the cores on a mode switch
+ */
+typedef enum {
+	SETUP_NO_CACHE = 0,	/**< Caches cleared, as before the caches */
+	SETUP_RESET,		/**< Cores reset and caches invalidated */
+	SETUP_NO_RESET,		/**< Caches kept */
+	SETUP_NUM
+} SetupMode;
+
+/**
+ * H and V Scalers with their register banks
+ */
+typedef struct {
+	XV_Hscaler_l2 Hsc;
+	XV_Vscaler_l2 Vsc;
+	u32 *HscBank;
+	u32 *VscBank;
+} Scalers;
+
+/************************** Variable Definitions *****************************/
+
+static const Scaling Scalings[] = {
+	{ "1080p to 4K",	1920U, 1080U, 3840U, 2160U },
+	{ "4K to 1080p",	3840U, 2160U, 1920U, 1080U },
+	{ "720p to 1080p",	1280U,  720U, 1920U, 1080U },
+	{ "1080p to 720p",	1920U, 1080U, 1280U,  720U },
+};
+
+#define NUM_SCALINGS	(sizeof(Scalings)/sizeof(Scalings[0]))
+
+static const char *SetupNames[SETUP_NUM] = {
+	"no cache",
+	"reset",
+	"no reset",
+};
+
+/**
+ * 4K, 2 pixels per clock, 6 taps polyphase scalers of a video processing
+ * subsystem. The base addresses are set by InitScalers.
+ */
+XV_hscaler_Config XV_hscaler_ConfigTable[XPAR_XV_HSCALER_NUM_INSTANCES] = {
+	{
+		XPAR_XV_HSCALER_0_DEVICE_ID, 0U, XVIDC_PPC_2, 3U, 3840U, 2160U,
+		8U, 6U, XV_HSCALER_POLYPHASE, XV_HSCALER_TAPS_6, 1U, 1U, 1U
+	}
+};
+
+XV_vscaler_Config XV_vscaler_ConfigTable[XPAR_XV_VSCALER_NUM_INSTANCES] = {
+	{
+		XPAR_XV_VSCALER_0_DEVICE_ID, 0U, XVIDC_PPC_2, 3U, 3840U, 2160U,
+		8U, 6U, XV_VSCALER_POLYPHASE, XV_VSCALER_TAPS_6, 1U
+	}
+};
+
+u32 Xil_AssertStatus;
+
+/************************** Function Definitions *****************************/
+
+#define CHECK(Cond) \
+	do { \
+		if (!(Cond)) { \
+			printf("%s line %d: %s\r\n", __FILE__, __LINE__, #Cond); \
+			return XST_FAILURE; \
+		} \
+	} while (0)
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	exit(1);
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+static double Now(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + ((double)Ts.tv_nsec * 1e-9);
+}
+
+/*****************************************************************************/
+/**
+* Initializes the scalers through their configuration tables, with the
+* register banks in host memory.
+*
+******************************************************************************/
+static int InitScalers(Scalers *ScalersPtr)
+{
+	memset(ScalersPtr, 0, sizeof(*ScalersPtr));
+	ScalersPtr->HscBank = calloc(1U, HSC_BANK_SIZE);
+	ScalersPtr->VscBank = calloc(1U, VSC_BANK_SIZE);
+	CHECK((ScalersPtr->HscBank != NULL) && (ScalersPtr->VscBank != NULL));
+
+	XV_hscaler_ConfigTable[0].BaseAddress = (UINTPTR)ScalersPtr->HscBank;
+	CHECK(XV_HScalerInitialize(&ScalersPtr->Hsc,
+		XPAR_XV_HSCALER_0_DEVICE_ID) == XST_SUCCESS);
+
+	XV_vscaler_ConfigTable[0].BaseAddress = (UINTPTR)ScalersPtr->VscBank;
+	CHECK(XV_VScalerInitialize(&ScalersPtr->Vsc,
+		XPAR_XV_VSCALER_0_DEVICE_ID) == XST_SUCCESS);
+
+	return XST_SUCCESS;
+}
+
+static void FreeScalers(Scalers *ScalersPtr)
+{
+	free(ScalersPtr->HscBank);
+	free(ScalersPtr->VscBank);
+}
+
+/*****************************************************************************/
+/**
+* Resets the cores, which clears their register banks.
+*
+******************************************************************************/
+static void ResetCores(Scalers *ScalersPtr)
+{
+	memset(ScalersPtr->HscBank, 0, HSC_BANK_SIZE);
+	memset(ScalersPtr->VscBank, 0, VSC_BANK_SIZE);
+}
+
+/*****************************************************************************/
+/**
+* Clears all the caches of the drivers, so that the setup computes and writes
+* everything as it did before the caches.
+*
+******************************************************************************/
+static void ClearCaches(Scalers *ScalersPtr)
+{
+	u32 Index;
+
+	XV_HScalerInvalidateCache(&ScalersPtr->Hsc);
+	XV_VScalerInvalidateCache(&ScalersPtr->Vsc);
+	ScalersPtr->Hsc.CoeffTable = NULL;
+	ScalersPtr->Vsc.CoeffTable = NULL;
+	for (Index = 0U; Index < XV_HSCALER_PHASE_CACHE_SIZE; Index++) {
+		ScalersPtr->Hsc.PhaseCache[Index].WidthIn = 0U;
+		ScalersPtr->Hsc.PhaseCache[Index].WidthOut = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* Switches the scalers to a new scaling, as XVprocSs_SetSubsystemConfig does
+* in the scaler only topology. In SETUP_RESET mode the cores must have been
+* reset by ResetCores.
+*
+******************************************************************************/
+static int Switch(Scalers *ScalersPtr, const Scaling *ScalingPtr,
+	SetupMode Mode)
+{
+	if (Mode == SETUP_NO_CACHE) {
+		ClearCaches(ScalersPtr);
+	}
+	else if (Mode == SETUP_RESET) {
+		XV_HScalerInvalidateCache(&ScalersPtr->Hsc);
+		XV_VScalerInvalidateCache(&ScalersPtr->Vsc);
+	}
+
+	if (XV_VScalerSetup(&ScalersPtr->Vsc, ScalingPtr->WidthIn,
+		ScalingPtr->HeightIn, ScalingPtr->HeightOut,
+		XVIDC_CSF_YCRCB_422) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XV_HScalerSetup(&ScalersPtr->Hsc, ScalingPtr->HeightOut,
+		ScalingPtr->WidthIn, ScalingPtr->WidthOut,
+		XVIDC_CSF_YCRCB_422, XVIDC_CSF_YCRCB_422);
+}
+
+/*****************************************************************************/
+/**
+* Returns the size of the H Scaler register bank used by a scaling. The
+* phases past the larger width are left from earlier computations, by the
+* driver with or without caches, and are not read by the core.
+*
+******************************************************************************/
+static u32 HscUsedSize(const Scaling *ScalingPtr)
+{
+	u32 PixPerClk = XV_hscaler_ConfigTable[0].PixPerClk;
+	u32 Width = (ScalingPtr->WidthIn > ScalingPtr->WidthOut) ?
+		ScalingPtr->WidthIn : ScalingPtr->WidthOut;
+
+	/* One phase register per clock with 2 pixels per clock */
+	return XV_HSCALER_CTRL_ADDR_HWREG_PHASESH_V_BASE +
+		(((Width + PixPerClk - 1U) / PixPerClk) * 4U);
+}
+
+/*****************************************************************************/
+/**
+* Runs random mode switches in each setup mode and checks the register banks
+* against the reference after each switch.
+*
+******************************************************************************/
+static int TestSwitches(void)
+{
+	Scalers Ref;
+	Scalers Dut[SETUP_NUM];
+	u32 Mode;
+	u32 Index;
+	u32 Cur;
+
+	CHECK(InitScalers(&Ref) == XST_SUCCESS);
+	for (Mode = 0U; Mode < SETUP_NUM; Mode++) {
+		CHECK(InitScalers(&Dut[Mode]) == XST_SUCCESS);
+	}
+
+	for (Index = 0U; Index < NUM_SWITCHES; Index++) {
+		Cur = (u32)rand() % NUM_SCALINGS;
+
+		ResetCores(&Ref);
+		CHECK(Switch(&Ref, &Scalings[Cur], SETUP_NO_CACHE) ==
+			XST_SUCCESS);
+
+		for (Mode = 0U; Mode < SETUP_NUM; Mode++) {
+			if (Mode == SETUP_RESET) {
+				ResetCores(&Dut[Mode]);
+			}
+			CHECK(Switch(&Dut[Mode], &Scalings[Cur],
+				(SetupMode)Mode) == XST_SUCCESS);
+			CHECK(memcmp(Dut[Mode].HscBank, Ref.HscBank,
+				HscUsedSize(&Scalings[Cur])) == 0);
+			CHECK(memcmp(Dut[Mode].VscBank, Ref.VscBank,
+				VSC_BANK_SIZE) == 0);
+		}
+	}
+
+	FreeScalers(&Ref);
+	for (Mode = 0U; Mode < SETUP_NUM; Mode++) {
+		FreeScalers(&Dut[Mode]);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Times the switches back and forth between the two scalings of each pair of
+* the Scalings table, in each setup mode. The reset of the cores is not
+* timed.
+*
+******************************************************************************/
+static int TimeSwitches(void)
+{
+	Scalers Dut;
+	u32 Mode;
+	u32 Cur;
+	u32 Pair;
+	u32 Index;
+	double Start;
+	double Time[SETUP_NUM][NUM_SCALINGS];
+
+	for (Mode = 0U; Mode < SETUP_NUM; Mode++) {
+		CHECK(InitScalers(&Dut) == XST_SUCCESS);
+		memset(Time[Mode], 0, sizeof(Time[Mode]));
+
+		for (Pair = 0U; Pair < NUM_SCALINGS; Pair += 2U) {
+			for (Index = 0U; Index < (2U * NUM_SWITCHES); Index++) {
+				Cur = Pair + (Index & 1U);
+				if (Mode == SETUP_RESET) {
+					ResetCores(&Dut);
+				}
+				Start = Now();
+				CHECK(Switch(&Dut, &Scalings[Cur],
+					(SetupMode)Mode) == XST_SUCCESS);
+				Time[Mode][Cur] += Now() - Start;
+			}
+		}
+
+		FreeScalers(&Dut);
+	}
+
+	printf("Setup time per mode switch, us:\r\n");
+	printf("%-16s", "");
+	for (Mode = 0U; Mode < SETUP_NUM; Mode++) {
+		printf("%10s", SetupNames[Mode]);
+	}
+	printf("\r\n");
+	for (Cur = 0U; Cur < NUM_SCALINGS; Cur++) {
+		printf("%-16s", Scalings[Cur].Name);
+		for (Mode = 0U; Mode < SETUP_NUM; Mode++) {
+			printf("%10.2f", Time[Mode][Cur] * 1e6 / NUM_SWITCHES);
+		}
+		printf("\r\n");
+	}
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	srand(1U);
+
+	if (TestSwitches() != XST_SUCCESS) {
+		printf("Scaler setup test failed\r\n");
+		return 1;
+	}
+
+	if (TimeSwitches() != XST_SUCCESS) {
+		printf("Scaler setup test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran Scaler setup test\r\n");
+	return 0;
+}
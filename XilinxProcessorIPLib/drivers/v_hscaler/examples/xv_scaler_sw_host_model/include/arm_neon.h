@@ -0,0 +1,255 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file arm_neon.h
+*
+* Host emulation of the NEON intrinsics used by the software scalers. Each
+* function computes its lanes in C as described by the Arm intrinsics
+* reference: integer multiplies and adds wrap, vmovn truncates and vrshrq_n
+* rounds without overflow.
+*
+******************************************************************************/
+#ifndef XV_SCALER_SW_MODEL_ARM_NEON_H_
+#define XV_SCALER_SW_MODEL_ARM_NEON_H_
+
+#include <stdint.h>
+
+typedef struct { uint16_t val[4]; } uint16x4_t;
+typedef struct { uint16_t val[8]; } uint16x8_t;
+typedef struct { int32_t val[2]; } int32x2_t;
+typedef struct { int32_t val[4]; } int32x4_t;
+typedef struct { uint32_t val[4]; } uint32x4_t;
+
+static inline uint16x4_t vld1_u16(const uint16_t *Ptr)
+{
+	uint16x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = Ptr[i];
+	}
+	return R;
+}
+
+static inline uint16x8_t vld1q_u16(const uint16_t *Ptr)
+{
+	uint16x8_t R;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		R.val[i] = Ptr[i];
+	}
+	return R;
+}
+
+static inline int32x4_t vld1q_s32(const int32_t *Ptr)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = Ptr[i];
+	}
+	return R;
+}
+
+static inline void vst1q_u16(uint16_t *Ptr, uint16x8_t A)
+{
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		Ptr[i] = A.val[i];
+	}
+}
+
+static inline int32x4_t vdupq_n_s32(int32_t V)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = V;
+	}
+	return R;
+}
+
+static inline uint16x4_t vget_low_u16(uint16x8_t A)
+{
+	uint16x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = A.val[i];
+	}
+	return R;
+}
+
+static inline uint16x4_t vget_high_u16(uint16x8_t A)
+{
+	uint16x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = A.val[i + 4];
+	}
+	return R;
+}
+
+static inline int32x2_t vget_low_s32(int32x4_t A)
+{
+	int32x2_t R = { { A.val[0], A.val[1] } };
+
+	return R;
+}
+
+static inline int32x2_t vget_high_s32(int32x4_t A)
+{
+	int32x2_t R = { { A.val[2], A.val[3] } };
+
+	return R;
+}
+
+static inline uint16x8_t vcombine_u16(uint16x4_t Lo, uint16x4_t Hi)
+{
+	uint16x8_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = Lo.val[i];
+		R.val[i + 4] = Hi.val[i];
+	}
+	return R;
+}
+
+static inline uint32x4_t vmovl_u16(uint16x4_t A)
+{
+	uint32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = A.val[i];
+	}
+	return R;
+}
+
+static inline uint16x4_t vmovn_u32(uint32x4_t A)
+{
+	uint16x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (uint16_t)A.val[i];
+	}
+	return R;
+}
+
+static inline int32x4_t vreinterpretq_s32_u32(uint32x4_t A)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (int32_t)A.val[i];
+	}
+	return R;
+}
+
+static inline uint32x4_t vreinterpretq_u32_s32(int32x4_t A)
+{
+	uint32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (uint32_t)A.val[i];
+	}
+	return R;
+}
+
+static inline int32x4_t vmulq_s32(int32x4_t A, int32x4_t B)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (int32_t)((uint32_t)A.val[i] * (uint32_t)B.val[i]);
+	}
+	return R;
+}
+
+static inline int32x4_t vmlaq_s32(int32x4_t Acc, int32x4_t A, int32x4_t B)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (int32_t)((uint32_t)Acc.val[i] +
+			((uint32_t)A.val[i] * (uint32_t)B.val[i]));
+	}
+	return R;
+}
+
+static inline int32x2_t vadd_s32(int32x2_t A, int32x2_t B)
+{
+	int32x2_t R;
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		R.val[i] = (int32_t)((uint32_t)A.val[i] + (uint32_t)B.val[i]);
+	}
+	return R;
+}
+
+static inline int32x2_t vpadd_s32(int32x2_t A, int32x2_t B)
+{
+	int32x2_t R;
+
+	R.val[0] = (int32_t)((uint32_t)A.val[0] + (uint32_t)A.val[1]);
+	R.val[1] = (int32_t)((uint32_t)B.val[0] + (uint32_t)B.val[1]);
+	return R;
+}
+
+static inline int32x4_t vmaxq_s32(int32x4_t A, int32x4_t B)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (A.val[i] > B.val[i]) ? A.val[i] : B.val[i];
+	}
+	return R;
+}
+
+static inline int32x4_t vminq_s32(int32x4_t A, int32x4_t B)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (A.val[i] < B.val[i]) ? A.val[i] : B.val[i];
+	}
+	return R;
+}
+
+#define vget_lane_s32(A, Lane)	((A).val[(Lane)])
+
+/* Rounding shift right, the rounding constant is added in 64 bits */
+#define vrshrq_n_s32(A, N)	XvNeon_RshrqS32((A), (N))
+
+static inline int32x4_t XvNeon_RshrqS32(int32x4_t A, int N)
+{
+	int32x4_t R;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		R.val[i] = (int32_t)(((int64_t)A.val[i] +
+			((int64_t)1 << (N - 1))) >> N);
+	}
+	return R;
+}
+
+#endif /* XV_SCALER_SW_MODEL_ARM_NEON_H_ */
@@ -0,0 +1,22 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* One H and one V Scaler, their configurations are in the test.
+*
+******************************************************************************/
+#ifndef XV_SCALER_SW_MODEL_XPARAMETERS_H_
+#define XV_SCALER_SW_MODEL_XPARAMETERS_H_
+
+#define XPAR_XV_HSCALER_NUM_INSTANCES	1U
+#define XPAR_XV_HSCALER_0_DEVICE_ID	0U
+#define XPAR_XV_VSCALER_NUM_INSTANCES	1U
+#define XPAR_XV_VSCALER_0_DEVICE_ID	0U
+
+#endif /* XV_SCALER_SW_MODEL_XPARAMETERS_H_ */
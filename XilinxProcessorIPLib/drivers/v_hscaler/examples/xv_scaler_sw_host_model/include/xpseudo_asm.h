@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpseudo_asm.h
+*
+* The host build uses no processor instructions.
+*
+******************************************************************************/
+#ifndef XV_SCALER_SW_MODEL_XPSEUDO_ASM_H_
+#define XV_SCALER_SW_MODEL_XPSEUDO_ASM_H_
+
+#endif /* XV_SCALER_SW_MODEL_XPSEUDO_ASM_H_ */
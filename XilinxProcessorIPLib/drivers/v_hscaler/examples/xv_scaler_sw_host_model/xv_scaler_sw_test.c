@@ -0,0 +1,599 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_scaler_sw_test.c
+*
+* This file contains a host test of the software H and V scalers.
+*
+* - XV_HScalerSwSetup and XV_VScalerSwSetup must not change the layer-2
+*   instance or the register bank of the core, and must give the
+*   coefficients XV_HScalerSetup and XV_VScalerSetup program into the core,
+*   for all the taps configurations and scaling ratios.
+* - XV_HScalerSwScale and XV_VScalerSwScale, built with the NEON emulation
+*   of include/arm_neon.h, must give the same output as the scalar
+*   XV_HScalerSwScaleRef and XV_VScalerSwScaleRef, also when a frame is
+*   scaled in stripes.
+* - XV_HScalerSwSetup must take the phase table XV_HScalerSetup programs
+*   into the core, for 1, 2, 4 and 8 pixels per clock, and the output
+*   pixels must be at the input positions and phases of the table.
+*
+* The time of XV_HScalerSwScaleRef for a 1920 to 1280 frame is reported.
+* The NEON code is emulated on the host, so its time is not reported.
+*
+* The output is not compared with the core or its HLS C model.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.4   ag    10/19/26   First release
+*       ag    10/19/26   Added the phase table test and the time of the
+*                        scalar path
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xv_hscaler_sw.h"
+#include "xv_vscaler_sw.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ******************************/
+
+#define HSC_BANK_SIZE	(XV_HSCALER_CTRL_ADDR_HWREG_PHASESH_V_HIGH + 1U)
+#define VSC_BANK_SIZE	(XV_VSCALER_CTRL_ADDR_HWREG_VFLTCOEFF_HIGH + 1U)
+#define NUM_CASES	2000U	/**< Random scaling cases */
+#define MAX_SIZE	300U	/**< Largest width and height of the cases */
+#define MAX_COMPS	3U	/**< Largest number of components of the cases */
+#define PHASE_LINES	4U	/**< Lines of the phase table cases */
+#define PHASE_WIDTHS	50U	/**< Random widths per pixels per clock */
+#define TIME_WIDTH_IN	1920U	/**< Timed frame */
+#define TIME_WIDTH_OUT	1280U
+#define TIME_HEIGHT	1080U
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Scaling ratio, one for each coefficient table band
+ */
+typedef struct {
+	u32 In;
+	u32 Out;
+} Ratio;
+
+/************************** Variable Definitions *****************************/
+
+static const Ratio Ratios[] = {
+	{ 1080U, 2160U },	/* Up */
+	{ 1080U, 1080U },	/* 1:1 */
+	{ 1920U, 1440U },	/* 1.33 */
+	{ 1920U,  960U },	/* 2 */
+	{ 1920U,  640U },	/* 3 */
+	{ 2160U,  540U },	/* 4 */
+};
+
+#define NUM_RATIOS	(sizeof(Ratios)/sizeof(Ratios[0]))
+
+static const u16 PixPerClk[] = {
+	XVIDC_PPC_1, XVIDC_PPC_2, XVIDC_PPC_4, XVIDC_PPC_8
+};
+
+#define NUM_PPC		(sizeof(PixPerClk)/sizeof(PixPerClk[0]))
+
+static const u16 Taps[] = {
+	XV_HSCALER_TAPS_6, XV_HSCALER_TAPS_8,
+	XV_HSCALER_TAPS_10, XV_HSCALER_TAPS_12
+};
+
+#define NUM_TAPS	(sizeof(Taps)/sizeof(Taps[0]))
+
+/**
+ * 4K, 2 pixels per clock polyphase scalers. The base addresses and the
+ * number of taps are set by the tests.
+ */
+XV_hscaler_Config XV_hscaler_ConfigTable[XPAR_XV_HSCALER_NUM_INSTANCES] = {
+	{
+		XPAR_XV_HSCALER_0_DEVICE_ID, 0U, XVIDC_PPC_2, 3U, 3840U, 2160U,
+		8U, 6U, XV_HSCALER_POLYPHASE, XV_HSCALER_TAPS_6, 1U, 1U, 1U
+	}
+};
+
+XV_vscaler_Config XV_vscaler_ConfigTable[XPAR_XV_VSCALER_NUM_INSTANCES] = {
+	{
+		XPAR_XV_VSCALER_0_DEVICE_ID, 0U, XVIDC_PPC_2, 3U, 3840U, 2160U,
+		8U, 6U, XV_VSCALER_POLYPHASE, XV_VSCALER_TAPS_6, 1U
+	}
+};
+
+static XV_Hscaler_l2 Hsc;
+static XV_Hscaler_l2 HscCopy;
+static XV_Hscaler_l2 HscCore;
+static XV_Vscaler_l2 Vsc;
+static XV_Vscaler_l2 VscCopy;
+static XV_Vscaler_l2 VscCore;
+static u32 HscBank[HSC_BANK_SIZE / 4U];
+static u32 HscBankCopy[HSC_BANK_SIZE / 4U];
+static u32 HscCoreBank[HSC_BANK_SIZE / 4U];
+static u32 VscBank[VSC_BANK_SIZE / 4U];
+static u32 VscBankCopy[VSC_BANK_SIZE / 4U];
+static u32 VscCoreBank[VSC_BANK_SIZE / 4U];
+static XV_HScalerSw HscSw;
+static XV_VScalerSw VscSw;
+static u16 InFrame[MAX_SIZE * MAX_SIZE * MAX_COMPS];
+static u16 OutFrame[MAX_SIZE * MAX_SIZE * MAX_COMPS];
+static u16 RefFrame[MAX_SIZE * MAX_SIZE * MAX_COMPS];
+static u16 TimeIn[TIME_WIDTH_IN * TIME_HEIGHT];
+static u16 TimeOut[TIME_WIDTH_OUT * TIME_HEIGHT];
+static short ExtCoeff[XV_HSCALER_MAX_H_PHASES * XV_HSCALER_MAX_H_TAPS];
+
+u32 Xil_AssertStatus;
+
+/************************** Function Definitions *****************************/
+
+#define CHECK(Cond) \
+	do { \
+		if (!(Cond)) { \
+			printf("%s line %d: %s\r\n", __FILE__, __LINE__, #Cond); \
+			return XST_FAILURE; \
+		} \
+	} while (0)
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	exit(1);
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+static u32 RandRange(u32 Min, u32 Max)
+{
+	return Min + ((u32)rand() % (Max - Min + 1U));
+}
+
+static double Elapsed(const struct timespec *Start)
+{
+	struct timespec End;
+
+	clock_gettime(CLOCK_MONOTONIC, &End);
+	return (double)(End.tv_sec - Start->tv_sec) +
+		(double)(End.tv_nsec - Start->tv_nsec) / 1e9;
+}
+
+/*****************************************************************************/
+/**
+* Initializes an H and a V Scaler instance with the given number of taps.
+*
+******************************************************************************/
+static int InitScalers(XV_Hscaler_l2 *HscPtr, u32 *HscBankPtr,
+	XV_Vscaler_l2 *VscPtr, u32 *VscBankPtr, u16 NumTaps)
+{
+	XV_hscaler_ConfigTable[0].BaseAddress = (UINTPTR)HscBankPtr;
+	XV_hscaler_ConfigTable[0].NumTaps = NumTaps;
+	memset(HscBankPtr, 0, HSC_BANK_SIZE);
+	CHECK(XV_HScalerInitialize(HscPtr, XPAR_XV_HSCALER_0_DEVICE_ID) ==
+		XST_SUCCESS);
+
+	XV_vscaler_ConfigTable[0].BaseAddress = (UINTPTR)VscBankPtr;
+	XV_vscaler_ConfigTable[0].NumTaps = NumTaps;
+	memset(VscBankPtr, 0, VSC_BANK_SIZE);
+	CHECK(XV_VScalerInitialize(VscPtr, XPAR_XV_VSCALER_0_DEVICE_ID) ==
+		XST_SUCCESS);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Checks that the software coefficients are the NumTaps center coefficients
+* of a core instance.
+*
+******************************************************************************/
+static int CheckCoeff(const s32 (*SwCoeff)[XV_HSCALER_MAX_H_TAPS],
+	const short (*CoreCoeff)[XV_HSCALER_MAX_H_TAPS], u16 NumTaps,
+	u16 PhaseShift)
+{
+	u32 Offset = (XV_HSCALER_MAX_H_TAPS - NumTaps) / 2U;
+	u32 Phase;
+	u32 Tap;
+
+	for (Phase = 0U; Phase < (1U << PhaseShift); Phase++) {
+		for (Tap = 0U; Tap < XV_HSCALER_MAX_H_TAPS; Tap++) {
+			if (Tap < NumTaps) {
+				CHECK(SwCoeff[Phase][Tap] ==
+					CoreCoeff[Phase][Tap + Offset]);
+			}
+			else {
+				CHECK(SwCoeff[Phase][Tap] == 0);
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Sets up the software scalers for each ratio, after a setup of the cores
+* for another ratio. The instances and register banks must not change, and
+* the coefficients must be those a setup of the cores for the ratio gives.
+*
+******************************************************************************/
+static int TestCoeff(void)
+{
+	u32 TapIndex;
+	u32 Index;
+	u32 Other;
+	u32 Phase;
+	const Ratio *R;
+	const Ratio *O;
+	u16 NumTaps;
+
+	for (TapIndex = 0U; TapIndex < NUM_TAPS; TapIndex++) {
+		NumTaps = Taps[TapIndex];
+		for (Index = 0U; Index < NUM_RATIOS; Index++) {
+			R = &Ratios[Index];
+			Other = (Index + 1U + ((u32)rand() %
+				(NUM_RATIOS - 1U))) % NUM_RATIOS;
+			O = &Ratios[Other];
+
+			CHECK(InitScalers(&Hsc, HscBank, &Vsc, VscBank,
+				NumTaps) == XST_SUCCESS);
+			CHECK(XV_HScalerSetup(&Hsc, 1080U, O->In, O->Out,
+				XVIDC_CSF_RGB, XVIDC_CSF_RGB) == XST_SUCCESS);
+			CHECK(XV_VScalerSetup(&Vsc, 1920U, O->In, O->Out,
+				XVIDC_CSF_RGB) == XST_SUCCESS);
+			memcpy(&HscCopy, &Hsc, sizeof(Hsc));
+			memcpy(&VscCopy, &Vsc, sizeof(Vsc));
+			memcpy(HscBankCopy, HscBank, HSC_BANK_SIZE);
+			memcpy(VscBankCopy, VscBank, VSC_BANK_SIZE);
+
+			CHECK(XV_HScalerSwSetup(&Hsc, &HscSw, R->In, R->Out,
+				1U, 8U) == XST_SUCCESS);
+			CHECK(XV_VScalerSwSetup(&Vsc, &VscSw, 1920U, R->In,
+				R->Out, 1U, 8U) == XST_SUCCESS);
+			CHECK(memcmp(&HscCopy, &Hsc, sizeof(Hsc)) == 0);
+			CHECK(memcmp(&VscCopy, &Vsc, sizeof(Vsc)) == 0);
+			CHECK(memcmp(HscBankCopy, HscBank, HSC_BANK_SIZE) == 0);
+			CHECK(memcmp(VscBankCopy, VscBank, VSC_BANK_SIZE) == 0);
+
+			CHECK(InitScalers(&HscCore, HscCoreBank, &VscCore,
+				VscCoreBank, NumTaps) == XST_SUCCESS);
+			CHECK(XV_HScalerSetup(&HscCore, 1080U, R->In, R->Out,
+				XVIDC_CSF_RGB, XVIDC_CSF_RGB) == XST_SUCCESS);
+			CHECK(XV_VScalerSetup(&VscCore, 1920U, R->In, R->Out,
+				XVIDC_CSF_RGB) == XST_SUCCESS);
+			CHECK(CheckCoeff(HscSw.Coeff,
+				(const short (*)[XV_HSCALER_MAX_H_TAPS])
+				HscCore.coeff, NumTaps,
+				HscCore.Hsc.Config.PhaseShift) == XST_SUCCESS);
+			CHECK(CheckCoeff(VscSw.Coeff,
+				(const short (*)[XV_HSCALER_MAX_H_TAPS])
+				VscCore.coeff, NumTaps,
+				VscCore.Vsc.Config.PhaseShift) == XST_SUCCESS);
+		}
+
+		/* User coefficients are taken from the instance */
+		for (Phase = 0U; Phase < (XV_HSCALER_MAX_H_PHASES * NumTaps);
+			Phase++) {
+			ExtCoeff[Phase] = (short)RandRange(0U, 8191U) - 4096;
+		}
+		CHECK(InitScalers(&Hsc, HscBank, &Vsc, VscBank, NumTaps) ==
+			XST_SUCCESS);
+		XV_HScalerLoadExtCoeff(&Hsc, XV_HSCALER_MAX_H_PHASES, NumTaps,
+			ExtCoeff);
+		XV_VScalerLoadExtCoeff(&Vsc, XV_VSCALER_MAX_V_PHASES, NumTaps,
+			ExtCoeff);
+		memcpy(&HscCopy, &Hsc, sizeof(Hsc));
+		memcpy(&VscCopy, &Vsc, sizeof(Vsc));
+		CHECK(XV_HScalerSwSetup(&Hsc, &HscSw, 1920U, 1280U, 1U, 8U) ==
+			XST_SUCCESS);
+		CHECK(XV_VScalerSwSetup(&Vsc, &VscSw, 1920U, 1080U, 720U, 1U,
+			8U) == XST_SUCCESS);
+		CHECK(memcmp(&HscCopy, &Hsc, sizeof(Hsc)) == 0);
+		CHECK(memcmp(&VscCopy, &Vsc, sizeof(Vsc)) == 0);
+		CHECK(CheckCoeff(HscSw.Coeff,
+			(const short (*)[XV_HSCALER_MAX_H_TAPS])Hsc.coeff,
+			NumTaps, Hsc.Hsc.Config.PhaseShift) == XST_SUCCESS);
+		CHECK(CheckCoeff(VscSw.Coeff,
+			(const short (*)[XV_HSCALER_MAX_H_TAPS])Vsc.coeff,
+			NumTaps, Vsc.Vsc.Config.PhaseShift) == XST_SUCCESS);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Scales random frames with the NEON and the scalar implementations, as a
+* whole and in stripes, and compares the outputs.
+*
+******************************************************************************/
+static int TestScale(void)
+{
+	u32 Case;
+	u32 WidthIn, WidthOut, HeightIn, HeightOut;
+	u32 NumComps, Bits, InStride, OutStride;
+	u32 Index;
+	u32 Line;
+	u32 Lines;
+	u16 NumTaps;
+
+	for (Case = 0U; Case < NUM_CASES; Case++) {
+		NumTaps = Taps[(u32)rand() % NUM_TAPS];
+		NumComps = RandRange(1U, MAX_COMPS);
+		Bits = RandRange(8U, 16U);
+		WidthIn = RandRange(1U, MAX_SIZE);
+		WidthOut = RandRange(1U, MAX_SIZE);
+		HeightIn = RandRange(1U, MAX_SIZE);
+		HeightOut = RandRange(1U, MAX_SIZE);
+		/* Single component lines take the NEON path of the H scaler */
+		if ((Case & 1U) != 0U) {
+			NumComps = 1U;
+		}
+
+		CHECK(InitScalers(&Hsc, HscBank, &Vsc, VscBank, NumTaps) ==
+			XST_SUCCESS);
+		for (Index = 0U; Index < (MAX_SIZE * MAX_SIZE * NumComps);
+			Index++) {
+			InFrame[Index] = (u16)RandRange(0U, (1U << Bits) - 1U);
+		}
+
+		/* Horizontal, HeightIn lines of WidthIn to WidthOut pixels */
+		InStride = WidthIn * NumComps;
+		OutStride = WidthOut * NumComps;
+		CHECK(XV_HScalerSwSetup(&Hsc, &HscSw, WidthIn, WidthOut,
+			(u16)NumComps, (u16)Bits) == XST_SUCCESS);
+		XV_HScalerSwScaleRef(&HscSw, InFrame, InStride, RefFrame,
+			OutStride, 0U, HeightIn);
+		XV_HScalerSwScale(&HscSw, InFrame, InStride, OutFrame,
+			OutStride, 0U, HeightIn);
+		CHECK(memcmp(OutFrame, RefFrame,
+			HeightIn * OutStride * sizeof(u16)) == 0);
+		memset(OutFrame, 0, HeightIn * OutStride * sizeof(u16));
+		for (Line = 0U; Line < HeightIn; Line += Lines) {
+			Lines = RandRange(1U, HeightIn - Line);
+			XV_HScalerSwScale(&HscSw, InFrame, InStride, OutFrame,
+				OutStride, Line, Lines);
+		}
+		CHECK(memcmp(OutFrame, RefFrame,
+			HeightIn * OutStride * sizeof(u16)) == 0);
+
+		/* Vertical, HeightIn to HeightOut lines of WidthIn pixels */
+		CHECK(XV_VScalerSwSetup(&Vsc, &VscSw, WidthIn, HeightIn,
+			HeightOut, (u16)NumComps, (u16)Bits) == XST_SUCCESS);
+		XV_VScalerSwScaleRef(&VscSw, InFrame, InStride, RefFrame,
+			InStride, 0U, HeightOut);
+		XV_VScalerSwScale(&VscSw, InFrame, InStride, OutFrame,
+			InStride, 0U, HeightOut);
+		CHECK(memcmp(OutFrame, RefFrame,
+			HeightOut * InStride * sizeof(u16)) == 0);
+		memset(OutFrame, 0, HeightOut * InStride * sizeof(u16));
+		for (Line = 0U; Line < HeightOut; Line += Lines) {
+			Lines = RandRange(1U, HeightOut - Line);
+			XV_VScalerSwScale(&VscSw, InFrame, InStride, OutFrame,
+				InStride, Line, Lines);
+		}
+		CHECK(memcmp(OutFrame, RefFrame,
+			HeightOut * InStride * sizeof(u16)) == 0);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Counts the samples of a phase table with OutputWriteEn set.
+*
+******************************************************************************/
+static u32 CountOutputs(const XV_Hscaler_l2 *HscPtr, u32 NumClocks)
+{
+	u32 PPC = HscPtr->Hsc.Config.PixPerClk;
+	u32 Bits = (PPC == 8U) ? 11U : ((PPC == 4U) ? 10U : 9U);
+	u32 Count = 0U;
+	u32 Clock;
+	u32 Sample;
+	u64 Entry;
+
+	for (Clock = 0U; Clock < NumClocks; Clock++) {
+		for (Sample = 0U; Sample < PPC; Sample++) {
+			Entry = (Sample < 4U) ?
+				(HscPtr->phasesH[Clock] >> (Sample * Bits)) :
+				(HscPtr->phasesH_H[Clock] >>
+				 ((Sample - 4U) * Bits));
+			Count += (u32)(Entry >> (Bits - 1U)) & 1U;
+		}
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* Scales PHASE_LINES lines of a single component frame and compares the
+* output with pixels computed from the core coefficients at input pixel
+* (j * Rate) >> 16 and phase ((j * Rate) & 0xFFFF) >> (16 - PhaseShift),
+* the position and phase the core reaches at output pixel j when it follows
+* the phase table.
+*
+******************************************************************************/
+static int CheckPhaseOutput(const XV_Hscaler_l2 *HscPtr, u32 WidthIn,
+	u32 WidthOut)
+{
+	u32 NumTaps = HscPtr->Hsc.Config.NumTaps;
+	u32 Offset = (XV_HSCALER_MAX_H_TAPS - NumTaps) / 2U;
+	u32 Rate = (WidthIn << 16) / WidthOut;
+	u32 Line, j, k, Phase;
+	s32 Start, x, Acc;
+	u64 Pos;
+
+	for (j = 0U; j < (WidthIn * PHASE_LINES); j++) {
+		InFrame[j] = (u16)RandRange(0U, 255U);
+	}
+	XV_HScalerSwScaleRef(&HscSw, InFrame, WidthIn, RefFrame, WidthOut,
+		0U, PHASE_LINES);
+	XV_HScalerSwScale(&HscSw, InFrame, WidthIn, OutFrame, WidthOut,
+		0U, PHASE_LINES);
+	CHECK(memcmp(OutFrame, RefFrame,
+		WidthOut * PHASE_LINES * sizeof(u16)) == 0);
+
+	for (Line = 0U; Line < PHASE_LINES; Line++) {
+		for (j = 0U; j < WidthOut; j++) {
+			Pos = (u64)j * Rate;
+			Start = (s32)(Pos >> 16) - ((s32)(NumTaps / 2U) - 1);
+			Phase = (u32)(Pos & 0xFFFFU) >>
+				(16U - HscPtr->Hsc.Config.PhaseShift);
+			Acc = 0;
+			for (k = 0U; k < NumTaps; k++) {
+				x = Start + (s32)k;
+				x = (x < 0) ? 0 :
+					((x >= (s32)WidthIn) ? (s32)WidthIn - 1 : x);
+				Acc += HscPtr->coeff[Phase][k + Offset] *
+					(s32)InFrame[Line * WidthIn + (u32)x];
+			}
+			Acc = (Acc + 2048) >> 12;
+			Acc = (Acc < 0) ? 0 : ((Acc > 255) ? 255 : Acc);
+			CHECK(RefFrame[Line * WidthOut + j] == (u16)Acc);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Sets up the core and the software scaler for each pixels per clock and
+* ratios of the coefficient bands and random widths. The software scaler
+* must hold the phase table of the core, the table must have WidthOut
+* outputs, and the output pixels must be at the positions of the table.
+*
+******************************************************************************/
+static int TestPhases(void)
+{
+	u32 PPCIndex;
+	u32 Index;
+	u32 WidthIn;
+	u32 WidthOut;
+	u16 NumTaps;
+
+	for (PPCIndex = 0U; PPCIndex < NUM_PPC; PPCIndex++) {
+		XV_hscaler_ConfigTable[0].PixPerClk = PixPerClk[PPCIndex];
+		for (Index = 0U; Index < (NUM_RATIOS + PHASE_WIDTHS); Index++) {
+			if (Index < NUM_RATIOS) {
+				WidthIn = Ratios[Index].In;
+				WidthOut = Ratios[Index].Out;
+			}
+			else {
+				WidthIn = RandRange(1U, 3840U);
+				WidthOut = RandRange(1U, 3840U);
+			}
+			NumTaps = Taps[(u32)rand() % NUM_TAPS];
+
+			CHECK(InitScalers(&HscCore, HscCoreBank, &VscCore,
+				VscCoreBank, NumTaps) == XST_SUCCESS);
+			if (XV_HScalerSetup(&HscCore, 8U, WidthIn, WidthOut,
+				XVIDC_CSF_RGB, XVIDC_CSF_RGB) != XST_SUCCESS) {
+				/* Ratio outside of the coefficient bands */
+				continue;
+			}
+			CHECK(XV_HScalerSwSetup(&HscCore, &HscSw, WidthIn,
+				WidthOut, 1U, 8U) == XST_SUCCESS);
+
+			CHECK(HscSw.PixPerClk == PixPerClk[PPCIndex]);
+			CHECK(HscSw.NumClocks == ((((WidthIn > WidthOut) ?
+				WidthIn : WidthOut) + HscSw.PixPerClk - 1U) /
+				HscSw.PixPerClk));
+			CHECK(memcmp(HscSw.PhasesH, HscCore.phasesH,
+				HscSw.NumClocks * sizeof(u64)) == 0);
+			CHECK(memcmp(HscSw.PhasesH_H, HscCore.phasesH_H,
+				HscSw.NumClocks * sizeof(u64)) == 0);
+			CHECK(CountOutputs(&HscCore, HscSw.NumClocks) ==
+				WidthOut);
+			CHECK(CheckPhaseOutput(&HscCore, WidthIn, WidthOut) ==
+				XST_SUCCESS);
+		}
+	}
+	XV_hscaler_ConfigTable[0].PixPerClk = XVIDC_PPC_2;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Reports the time of the scalar H scaler for a single component 8-bit
+* frame, with the taps of the core configuration.
+*
+******************************************************************************/
+static int TimeScale(void)
+{
+	struct timespec Start;
+	double Time;
+	u32 Index;
+
+	CHECK(InitScalers(&Hsc, HscBank, &Vsc, VscBank, XV_HSCALER_TAPS_6) ==
+		XST_SUCCESS);
+	CHECK(XV_HScalerSwSetup(&Hsc, &HscSw, TIME_WIDTH_IN, TIME_WIDTH_OUT,
+		1U, 8U) == XST_SUCCESS);
+	for (Index = 0U; Index < (TIME_WIDTH_IN * TIME_HEIGHT); Index++) {
+		TimeIn[Index] = (u16)RandRange(0U, 255U);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	XV_HScalerSwScaleRef(&HscSw, TimeIn, TIME_WIDTH_IN, TimeOut,
+		TIME_WIDTH_OUT, 0U, TIME_HEIGHT);
+	Time = Elapsed(&Start);
+
+	printf("XV_HScalerSwScaleRef %ux%u to %ux%u, 6 taps: %.2f ms, "
+		"%.1f Mpixel/s out\r\n", TIME_WIDTH_IN, TIME_HEIGHT,
+		TIME_WIDTH_OUT, TIME_HEIGHT, Time * 1e3,
+		(double)(TIME_WIDTH_OUT * TIME_HEIGHT) / Time / 1e6);
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	srand(1U);
+
+	if (TestCoeff() != XST_SUCCESS) {
+		printf("Software scaler test failed\r\n");
+		return 1;
+	}
+
+	if (TestScale() != XST_SUCCESS) {
+		printf("Software scaler test failed\r\n");
+		return 1;
+	}
+
+	if (TestPhases() != XST_SUCCESS) {
+		printf("Software scaler test failed\r\n");
+		return 1;
+	}
+
+	if (TimeScale() != XST_SUCCESS) {
+		printf("Software scaler test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran Software scaler test\r\n");
+	return 0;
+}
@@ -30,6 +30,11 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.4   ag    10/19/26   Cache packed phase tables and skip uploads of
+*                        unchanged coefficients and phases
+*       ag    10/19/26   Added XV_HScalerGetCoeffTable for the software
+*                        scaler
+*       ag    10/19/26   Added XV_HScalerCalcPhases for the software scaler
 * </pre>
 *
 ******************************************************************************/
@@ -69,13 +74,21 @@ extern const short XV_hscaler_fixedcoeff_taps12_ScalingRatio4[XV_HSCALER_MAX_H_P
 static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
                                   u32 WidthIn,
                                   u32 WidthOut);
-static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
-                            u32 WidthIn,
-                            u32 WidthOut,
-                            u32 PixelRate);
+static u32 CalculatePhases(XV_Hscaler_l2 *HscPtr,
+                           u32 WidthIn,
+                           u32 WidthOut,
+                           u32 PixelRate,
+                           u64 *PhasesH,
+                           u64 *PhasesH_H);
 
 static void XV_HScalerSetCoeff(XV_Hscaler_l2 *HscPtr);
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr);
+static u32 XV_HScalerPackPhase(XV_Hscaler_l2 *HscPtr, u32 *Regs);
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr,
+                               const XV_Hscaler_PhaseCache *EntryPtr);
+static XV_Hscaler_PhaseCache *XV_HScalerGetPhases(XV_Hscaler_l2 *HscPtr,
+                                                  u32 WidthIn,
+                                                  u32 WidthOut,
+                                                  u32 PixelRate);
 
 /*****************************************************************************/
 /**
@@ -135,32 +148,32 @@ void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr)
 
 /*****************************************************************************/
 /**
-* This function determines the internal coeffiecient table to be used based on
-* scaling ratio and loads the filter coefficients in the scaler coefficient
-* storage.
+* This function returns the internal coefficient table used for the scaling
+* ratio. The core instance is not modified.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
 * @param  WidthIn is the input stream width
-* @param  Widthout is the output stream width
+* @param  WidthOut is the output stream width
+* @param  NumTapsPtr receives the number of taps of the table
 *
-* @return None
+* @return Pointer to the table, NumTaps coefficients per phase, or NULL if
+*         the core taps configuration is not supported
 *
 ******************************************************************************/
-static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
-                                  u32 WidthIn,
-                                  u32 WidthOut)
+const short *XV_HScalerGetCoeffTable(XV_Hscaler_l2 *InstancePtr,
+                                     u32 WidthIn,
+                                     u32 WidthOut,
+                                     u16 *NumTapsPtr)
 {
   const short *coeff;
-  u16 numTaps, numPhases;
   u16 ScalingRatio;
   u16 IsScaleDown;
 
   /*
    * validate input arguments
    */
-  Xil_AssertVoid(InstancePtr != NULL);
-
-  numPhases = (1<<InstancePtr->Hsc.Config.PhaseShift);
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(NumTapsPtr != NULL);
 
   IsScaleDown = (WidthOut < WidthIn);
 
@@ -176,75 +189,117 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
       case XV_HSCALER_TAPS_6:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		} else {// <= 1.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		}
            break;
 
       case XV_HSCALER_TAPS_8:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
+			*NumTapsPtr = XV_HSCALER_TAPS_8;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
+			*NumTapsPtr = XV_HSCALER_TAPS_8;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
+			*NumTapsPtr = XV_HSCALER_TAPS_8;
 		} else {// <= 1.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		}
            break;
 
       case XV_HSCALER_TAPS_10:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps10_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_10;
+			*NumTapsPtr = XV_HSCALER_TAPS_10;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_10;
+			*NumTapsPtr = XV_HSCALER_TAPS_10;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
+			*NumTapsPtr = XV_HSCALER_TAPS_8;
 		} else {// <= 1.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		}
            break;
 
       case XV_HSCALER_TAPS_12:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps12_ScalingRatio4[0][0];
-			numTaps = XV_HSCALER_TAPS_12;
+			*NumTapsPtr = XV_HSCALER_TAPS_12;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_hscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_HSCALER_TAPS_10;
+			*NumTapsPtr = XV_HSCALER_TAPS_10;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_hscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_HSCALER_TAPS_8;
+			*NumTapsPtr = XV_HSCALER_TAPS_8;
 		} else {// <= 1.5
 			coeff = &XV_hscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_HSCALER_TAPS_6;
+			*NumTapsPtr = XV_HSCALER_TAPS_6;
 		}
            break;
 
       default:
-          return;
+          return(NULL);
     }
   }
   else //Scale Up
   {
 	coeff = &XV_hscaler_Lanczos2_taps6[0][0];
-	numTaps = XV_HSCALER_TAPS_6;
+	*NumTapsPtr = XV_HSCALER_TAPS_6;
+  }
+
+  return(coeff);
+}
+
+/*****************************************************************************/
+/**
+* This function determines the internal coeffiecient table to be used based on
+* scaling ratio and loads the filter coefficients in the scaler coefficient
+* storage.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream width
+* @param  Widthout is the output stream width
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
+                                  u32 WidthIn,
+                                  u32 WidthOut)
+{
+  const short *coeff;
+  u16 numTaps, numPhases;
+
+  /*
+   * validate input arguments
+   */
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  numPhases = (1<<InstancePtr->Hsc.Config.PhaseShift);
+
+  coeff = XV_HScalerGetCoeffTable(InstancePtr, WidthIn, WidthOut, &numTaps);
+  if(coeff == NULL)
+  {
+    return;
+  }
+
+  /* Table already copied, no need to copy and upload it again */
+  if(coeff == InstancePtr->CoeffTable)
+  {
+    return;
   }
 
   XV_HScalerLoadExtCoeff(InstancePtr,
@@ -254,6 +309,7 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffTable = coeff;
 }
 
 /*****************************************************************************/
@@ -328,6 +384,8 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffTable = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
 }
 
 /*****************************************************************************/
@@ -339,14 +397,19 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
 * @param  WidthIn is the input frame width
 * @param  WidthOut is the scaled frame width
 * @param  PixelRate is the number of pixels per clock being processed
+* @param  PhasesH receives the phases of samples 0 to 3 of each clock
+* @param  PhasesH_H receives the phases of samples 4 to 7 of each clock, 8
+*         pixels per clock only
 *
-* @return None
+* @return Number of clocks, i.e. of PhasesH entries, of a line
 *
 ******************************************************************************/
-static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
-                            u32 WidthIn,
-                            u32 WidthOut,
-                            u32 PixelRate)
+static u32 CalculatePhases(XV_Hscaler_l2 *HscPtr,
+                           u32 WidthIn,
+                           u32 WidthOut,
+                           u32 PixelRate,
+                           u64 *PhasesH,
+                           u64 *PhasesH_H)
 {
     int loopWidth;
     int x,s;
@@ -367,8 +430,8 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
     arrayIdx = 0;
     for (x=0; x<loopWidth; x++)
     {
-        HscPtr->phasesH[x] = 0;
-	HscPtr->phasesH_H[x] = 0;
+        PhasesH[x] = 0;
+	PhasesH_H[x] = 0;
 	nrRdsClck = 0;
         for (s=0; s<HscPtr->Hsc.Config.PixPerClk; s++)
         {
@@ -396,24 +459,24 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 	    if (HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_8)
 	    {
 		    if (s < 4 ) {
-			    HscPtr->phasesH[x] |= (PhaseH << (s*11));
-			    HscPtr->phasesH[x] |= (arrayIdx << (6 + (s*11)));
-			    HscPtr->phasesH[x] |= (OutputWriteEn << (10 + (s*11)));
+			    PhasesH[x] |= (PhaseH << (s*11));
+			    PhasesH[x] |= (arrayIdx << (6 + (s*11)));
+			    PhasesH[x] |= (OutputWriteEn << (10 + (s*11)));
 		    } else {
-			    HscPtr->phasesH_H[x] |= (PhaseH << ((s-4)*11));
-			    HscPtr->phasesH_H[x] |= (arrayIdx << (6 + ((s-4)*11)));
-			    HscPtr->phasesH_H[x] |= (OutputWriteEn << (10 + ((s-4)*11)));
+			    PhasesH_H[x] |= (PhaseH << ((s-4)*11));
+			    PhasesH_H[x] |= (arrayIdx << (6 + ((s-4)*11)));
+			    PhasesH_H[x] |= (OutputWriteEn << (10 + ((s-4)*11)));
 		    }
 	    } else if (HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_4) {
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (PhaseH << (s*10));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (arrayIdx << (6 + (s*10)));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (OutputWriteEn << (9 + (s*10)));
+              PhasesH[x] = PhasesH[x] | (PhaseH << (s*10));
+              PhasesH[x] = PhasesH[x] | (arrayIdx << (6 + (s*10)));
+              PhasesH[x] = PhasesH[x] | (OutputWriteEn << (9 + (s*10)));
             }
             else
             {
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (PhaseH << (s*9));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (arrayIdx << (6 + (s*9)));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (OutputWriteEn << (8 + (s*9)));
+              PhasesH[x] = PhasesH[x] | (PhaseH << (s*9));
+              PhasesH[x] = PhasesH[x] | (arrayIdx << (6 + (s*9)));
+              PhasesH[x] = PhasesH[x] | (OutputWriteEn << (8 + (s*9)));
             }
 
             if (GetNewPix) nrRdsClck++;
@@ -425,26 +488,65 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
         if (nrRds >= HscPtr->Hsc.Config.PixPerClk)
             nrRds -= HscPtr->Hsc.Config.PixPerClk;
     }
+
+    return((u32)loopWidth);
+}
+
+/*****************************************************************************/
+/**
+* This function calculates the phase table XV_HScalerSetup() programs into
+* the core for the widths. The core instance is not modified.
+*
+* Each table entry is one clock of PixPerClk samples. Sample s of the clock
+* has PixPerClk == 8 ? 11 : (PixPerClk == 4 ? 10 : 9) bits at bit s times
+* that width, of PhasesH for s < 4 and of PhasesH_H for s >= 4: the phase in
+* the low 6 bits, then ArrayIdx, then OutputWriteEn in the top bit.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream width
+* @param  WidthOut is the output stream width
+* @param  PhasesH receives the table, XV_HSCALER_MAX_LINE_WIDTH entries
+* @param  PhasesH_H receives the samples 4 to 7 of the table,
+*         XV_HSCALER_MAX_LINE_WIDTH entries
+*
+* @return Number of table entries of a line
+*
+******************************************************************************/
+u32 XV_HScalerCalcPhases(XV_Hscaler_l2 *InstancePtr,
+                         u32 WidthIn,
+                         u32 WidthOut,
+                         u64 *PhasesH,
+                         u64 *PhasesH_H)
+{
+  /*
+   * validate input arguments
+   */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid((WidthIn > 0) && (WidthOut > 0));
+  Xil_AssertNonvoid(PhasesH != NULL);
+  Xil_AssertNonvoid(PhasesH_H != NULL);
+
+  return(CalculatePhases(InstancePtr, WidthIn, WidthOut,
+                         (WidthIn * STEP_PRECISION)/WidthOut,
+                         PhasesH, PhasesH_H));
 }
 
 /*****************************************************************************/
 /**
-* This function programs the phase data into core registers
+* This function packs the computed phase data in the layout of the core
+* registers
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  Regs is the array that receives the register words
 *
-* @return None
+* @return Number of register words
 *
-* @Note  This version of driver does not make use of computed coefficients.
-*        User must load the coefficients, using the provided API, before
-*        scaler can be used
 ******************************************************************************/
-static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
+static u32 XV_HScalerPackPhase(XV_Hscaler_l2 *HscPtr, u32 *Regs)
 {
   u32 loopWidth;
-  UINTPTR baseAddr;
-  //program phases
-  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+  u32 NumRegs = 0;
+  //pack phases
   loopWidth = HscPtr->Hsc.Config.MaxWidth/HscPtr->Hsc.Config.PixPerClk;
   switch(HscPtr->Hsc.Config.PixPerClk)
   {
@@ -463,9 +565,10 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 lsb = (u32)(HscPtr->phasesH[i]   & (u64)XHSC_MASK_LOW_16BITS);
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
                 val = (msb<<16 | lsb);
-                Xil_Out32(baseAddr+(index*4), val);
+                Regs[index] = val;
                 ++index;
               }
+              NumRegs = index;
             }
             break;
 
@@ -479,8 +582,9 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               for(i=0; i < loopWidth; ++i)
               {
                 val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(i*4), val);
+                Regs[i] = val;
               }
+              NumRegs = loopWidth;
             }
             break;
 
@@ -500,11 +604,12 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                 phaseHData = HscPtr->phasesH[index];
                 lsb = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
                 msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
-                Xil_Out32(baseAddr+(offset*4), lsb);
-                Xil_Out32(baseAddr+((offset+1)*4), msb);
+                Regs[offset] = lsb;
+                Regs[offset+1] = msb;
                 ++index;
                 offset += 2;
               }
+              NumRegs = offset;
             }
             break;
     case XVIDC_PPC_8:
@@ -533,13 +638,15 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 			bits_32_63 |= ((u32)((phaseHData_H & XHSC_MASK_LOW_20BITS)) << 12);
 			bits_64_95 = (((u32)(phaseHData_H & XHSC_MASK_LOW_32BITS)) >> 20);
 			bits_64_95 |= (((u32)(phaseHData_H>>32) & XHSC_MASK_LOW_12BITS) << 12);
-			Xil_Out32(baseAddr+(offset*4), bits_0_31);
-			Xil_Out32(baseAddr+((offset+1)*4), bits_32_63);
-			Xil_Out32(baseAddr+((offset+2)*4), bits_64_95);
+			Regs[offset] = bits_0_31;
+			Regs[offset+1] = bits_32_63;
+			Regs[offset+2] = bits_64_95;
+			Regs[offset+3] = 0;
 			/*(offset+3)*4 register is reserved,so increment offset by 4*/
 			offset += 4;
 			index++;
 		}
+		NumRegs = offset;
 	    }
 	    break;
 
@@ -547,8 +654,87 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
     default:
            break;
   }
+
+  return(NumRegs);
+}
+
+
+/*****************************************************************************/
+/**
+* This function programs packed phase data into core registers
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  EntryPtr is a pointer to the packed phase data
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr,
+                               const XV_Hscaler_PhaseCache *EntryPtr)
+{
+  UINTPTR baseAddr;
+  u32 i;
+
+  baseAddr = XV_hscaler_Get_HwReg_phasesH_V_BaseAddress(&HscPtr->Hsc);
+  for(i=0; i < EntryPtr->NumRegs; ++i)
+  {
+    /* For 8 pixels per clock every 4th register is reserved */
+    if((HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_8) && ((i & 3) == 3))
+    {
+      continue;
+    }
+    Xil_Out32(baseAddr+(i*4), EntryPtr->Regs[i]);
+  }
 }
 
+/*****************************************************************************/
+/**
+* This function returns the packed phase data for the given widths. If they
+* are not in the phase cache, the phases are computed and packed into the
+* least recently used entry.
+*
+* @param  HscPtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input frame width
+* @param  WidthOut is the scaled frame width
+* @param  PixelRate is the scaling step
+*
+* @return Pointer to the cache entry holding the packed phases
+*
+******************************************************************************/
+static XV_Hscaler_PhaseCache *XV_HScalerGetPhases(XV_Hscaler_l2 *HscPtr,
+                                                  u32 WidthIn,
+                                                  u32 WidthOut,
+                                                  u32 PixelRate)
+{
+  XV_Hscaler_PhaseCache *EntryPtr = &HscPtr->PhaseCache[0];
+  u32 i;
+
+  HscPtr->PhaseClock++;
+  for(i=0; i < XV_HSCALER_PHASE_CACHE_SIZE; ++i)
+  {
+    if((HscPtr->PhaseCache[i].WidthIn == WidthIn) &&
+       (HscPtr->PhaseCache[i].WidthOut == WidthOut))
+    {
+      HscPtr->PhaseCache[i].Age = HscPtr->PhaseClock;
+      return(&HscPtr->PhaseCache[i]);
+    }
+    if(HscPtr->PhaseCache[i].Age < EntryPtr->Age)
+    {
+      EntryPtr = &HscPtr->PhaseCache[i];
+    }
+  }
+
+  /* Compute Phase for 1 line */
+  CalculatePhases(HscPtr, WidthIn, WidthOut, PixelRate,
+                  HscPtr->phasesH, HscPtr->phasesH_H);
+
+  EntryPtr->NumRegs = XV_HScalerPackPhase(HscPtr, EntryPtr->Regs);
+  EntryPtr->WidthIn = WidthIn;
+  EntryPtr->WidthOut = WidthOut;
+  EntryPtr->Age = HscPtr->PhaseClock;
+
+  return(EntryPtr);
+}
 
 /*****************************************************************************/
 /**
@@ -607,6 +793,7 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
                      u32 ColorFormatOut)
 {
   u32 PixelRate;
+  XV_Hscaler_PhaseCache *EntryPtr;
 
   /*
    * Assert validates the input arguments
@@ -633,14 +820,25 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
       XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
     }
     /* Program generated coefficients into the IP register bank */
-    XV_HScalerSetCoeff(InstancePtr);
+    if(!InstancePtr->CoeffLoaded)
+    {
+      XV_HScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = TRUE;
+    }
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+  /* Phases for these widths are already in the IP register bank */
+  if((WidthIn != InstancePtr->PhaseWidthIn) ||
+     (WidthOut != InstancePtr->PhaseWidthOut))
+  {
+    /* Get Phase for 1 line from the cache or compute it */
+    EntryPtr = XV_HScalerGetPhases(InstancePtr, WidthIn, WidthOut, PixelRate);
 
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+    /* Program Phase into the IP register bank */
+    XV_HScalerSetPhase(InstancePtr, EntryPtr);
+    InstancePtr->PhaseWidthIn = WidthIn;
+    InstancePtr->PhaseWidthOut = WidthOut;
+  }
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
@@ -653,6 +851,28 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
 }
 
 
+/*****************************************************************************/
+/**
+* This function makes the next XV_HScalerSetup program the coefficients and
+* phases into the core. It must be called if the core register bank may have
+* lost its content, e.g. after a reset of the IP. The cached phase tables only
+* depend on the widths and on the core configuration, so they are written
+* again without being recomputed.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerInvalidateCache(XV_Hscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffLoaded = FALSE;
+  InstancePtr->PhaseWidthIn = 0;
+  InstancePtr->PhaseWidthOut = 0;
+}
+
 /*****************************************************************************/
 /**
 *
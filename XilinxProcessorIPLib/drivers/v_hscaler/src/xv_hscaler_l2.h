@@ -70,6 +70,10 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.4   ag    10/19/26   Added phase table cache and skip of unchanged
+*                        coefficient and phase uploads
+*       ag    10/19/26   Added XV_HScalerGetCoeffTable
+*       ag    10/19/26   Added XV_HScalerCalcPhases
 * </pre>
 *
 ******************************************************************************/
@@ -91,6 +95,16 @@ extern "C" {
 #define XV_HSCALER_MAX_H_TAPS           (12)
 #define XV_HSCALER_MAX_H_PHASES         (64)
 #define XV_HSCALER_MAX_LINE_WIDTH       (8192)
+#define XV_HSCALER_MAX_PHASE_REGS       (XV_HSCALER_MAX_LINE_WIDTH/2)
+
+/**
+ * Number of phase tables kept by XV_HScalerSetup, packed as they are written
+ * to the core. Switching back to a cached WidthIn/WidthOut pair does not
+ * recompute the phases. Must be at least 1.
+ */
+#ifndef XV_HSCALER_PHASE_CACHE_SIZE
+#define XV_HSCALER_PHASE_CACHE_SIZE     (2)
+#endif
 
 /**************************** Type Definitions *******************************/
 /**
@@ -114,6 +128,20 @@ typedef enum
   XV_HSCALER_TAPS_12 = 12
 }XV_HSCALER_TAPS;
 
+/**
+ * Phase table packed in the core register layout. PixPerClk, taps and phase
+ * count are fixed per core and the color format does not change the phases,
+ * so the widths are the key.
+ */
+typedef struct
+{
+  u32 WidthIn;   /*<< Input width, 0 if the entry is free */
+  u32 WidthOut;  /*<< Output width */
+  u32 Age;       /*<< Last use, for replacement */
+  u32 NumRegs;   /*<< Number of packed register words */
+  u32 Regs[XV_HSCALER_MAX_PHASE_REGS]; /*<< Packed register words */
+}XV_Hscaler_PhaseCache;
+
 /**
  * H Scaler Layer 2 data. The user is required to allocate a variable
  * of this type for every H Scaler device in the system. A pointer to a
@@ -126,6 +154,12 @@ typedef struct
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
+  const short *CoeffTable; /*<< Fixed table copied in coeff, NULL if none */
+  u8 CoeffLoaded;          /*<< coeff is programmed in the core */
+  u32 PhaseWidthIn;        /*<< Widths of the phases programmed in the core */
+  u32 PhaseWidthOut;
+  u32 PhaseClock;          /*<< Phase cache use counter */
+  XV_Hscaler_PhaseCache PhaseCache[XV_HSCALER_PHASE_CACHE_SIZE];
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -170,6 +204,15 @@ typedef struct
 int XV_HScalerInitialize(XV_Hscaler_l2 *InstancePtr, u16 DeviceId);
 void XV_HScalerStart(XV_Hscaler_l2 *InstancePtr);
 void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr);
+const short *XV_HScalerGetCoeffTable(XV_Hscaler_l2 *InstancePtr,
+                                     u32 WidthIn,
+                                     u32 WidthOut,
+                                     u16 *NumTapsPtr);
+u32 XV_HScalerCalcPhases(XV_Hscaler_l2 *InstancePtr,
+                         u32 WidthIn,
+                         u32 WidthOut,
+                         u64 *PhasesH,
+                         u64 *PhasesH_H);
 void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
@@ -184,6 +227,7 @@ int XV_HScalerValidateConfig(XV_Hscaler_l2 *InstancePtr,
                              u32 ColorFormatIn,
                              u32 ColorFormatOut);
 void XV_HScalerDbgReportStatus(XV_Hscaler_l2 *InstancePtr);
+void XV_HScalerInvalidateCache(XV_Hscaler_l2 *InstancePtr);
 
 #ifdef __cplusplus
 }
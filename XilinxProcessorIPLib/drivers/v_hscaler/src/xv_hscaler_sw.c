@@ -0,0 +1,477 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_hscaler_sw.c
+* @addtogroup v_hscaler_v3_4
+* @{
+* @details
+*
+* The software horizontal scaler. See xv_hscaler_sw.h for the processing
+* model.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.4   ag    10/19/26   First release
+*       ag    10/19/26   Copy the coefficients without changing the core
+*                        instance
+*       ag    10/19/26   Take the positions and phases from the phase table
+*                        of the core
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_hscaler_sw.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define XV_HSCALER_SW_NEON
+#endif
+
+/************************** Constant Definitions *****************************/
+#define XV_HSCALER_SW_COEFF_SHIFT   (12) /* Fraction bits of coefficients */
+#define XV_HSCALER_SW_IDX_SHIFT     (6)  /* ArrayIdx bit of a sample */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Walk through the phase table of a line
+ */
+typedef struct
+{
+  u32 Clock;    /*<< Table entry of the next sample */
+  u32 Sample;   /*<< Next sample of the entry */
+  u32 PrevIdx;  /*<< ArrayIdx of the previous sample */
+  s32 Reads;    /*<< Input pixels read up to the previous sample */
+}XV_HScalerSwPos;
+
+/************************** Function Prototypes ******************************/
+static const s32 *XV_HScalerSwNextPixel(const XV_HScalerSw *SwPtr,
+                                        XV_HScalerSwPos *PosPtr,
+                                        s32 *StartPtr);
+static u16 XV_HScalerSwPixel(const XV_HScalerSw *SwPtr,
+                             const u16 *In,
+                             const s32 *CoeffPtr,
+                             s32 Start,
+                             u32 Comp);
+static u16 XV_HScalerSwClip(const XV_HScalerSw *SwPtr, s32 Acc);
+static void XV_HScalerSwLineRef(const XV_HScalerSw *SwPtr,
+                                const u16 *In,
+                                u16 *Out);
+#ifdef XV_HSCALER_SW_NEON
+static void XV_HScalerSwLineNeon(const XV_HScalerSw *SwPtr,
+                                 const u16 *In,
+                                 u16 *Out);
+#endif
+
+/*****************************************************************************/
+/**
+* This function initializes a software scaler context for the given line
+* widths. If no user coefficients were loaded with XV_HScalerLoadExtCoeff(),
+* the coefficient table for the scaling ratio is selected as done by
+* XV_HScalerSetup(). The core instance is not modified.
+*
+* @param  InstancePtr is a pointer to the core instance whose configuration
+*         and coefficients are used
+* @param  SwPtr is a pointer to the context to initialize
+* @param  WidthIn is the input line width
+* @param  WidthOut is the output line width
+* @param  NumComps is the number of interleaved components of a pixel
+* @param  BitsPerComp is the number of bits of a component, 8 to 16
+*
+* @return XST_SUCCESS if the context is initialized
+*         XST_FAILURE if the core is not polyphase or the parameters are not
+*         supported
+*
+******************************************************************************/
+int XV_HScalerSwSetup(XV_Hscaler_l2 *InstancePtr,
+                      XV_HScalerSw *SwPtr,
+                      u32 WidthIn,
+                      u32 WidthOut,
+                      u16 NumComps,
+                      u16 BitsPerComp)
+{
+  const short *Table = NULL;
+  u16 TableTaps = 0;
+  u32 NumPhases;
+  u32 Offset;
+  u32 i,j;
+
+  /*
+   * Assert validates the input arguments
+   */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(SwPtr != NULL);
+
+  if((InstancePtr->Hsc.Config.ScalerType != XV_HSCALER_POLYPHASE) ||
+     (WidthIn == 0) || (WidthIn > InstancePtr->Hsc.Config.MaxWidth) ||
+     (WidthOut == 0) || (WidthOut > InstancePtr->Hsc.Config.MaxWidth) ||
+     (NumComps == 0) || (NumComps > XV_HSCALER_SW_MAX_COMPS) ||
+     (BitsPerComp < 8) || (BitsPerComp > 16))
+  {
+    return(XST_FAILURE);
+  }
+
+  if(!InstancePtr->UseExtCoeff) //No user defined coefficients
+  {
+    /* Coefficient table XV_HScalerSetup() would select */
+    Table = XV_HScalerGetCoeffTable(InstancePtr, WidthIn, WidthOut,
+                                    &TableTaps);
+    if(Table == NULL)
+    {
+      return(XST_FAILURE);
+    }
+  }
+
+  SwPtr->WidthIn    = WidthIn;
+  SwPtr->WidthOut   = WidthOut;
+  SwPtr->PixPerClk  = InstancePtr->Hsc.Config.PixPerClk;
+  SwPtr->SampleBits = (SwPtr->PixPerClk == XVIDC_PPC_8) ? 11 :
+                      ((SwPtr->PixPerClk == XVIDC_PPC_4) ? 10 : 9);
+  SwPtr->NumClocks  = XV_HScalerCalcPhases(InstancePtr, WidthIn, WidthOut,
+                                           SwPtr->PhasesH, SwPtr->PhasesH_H);
+  SwPtr->NumTaps    = InstancePtr->Hsc.Config.NumTaps;
+  SwPtr->PhaseShift = InstancePtr->Hsc.Config.PhaseShift;
+  SwPtr->NumComps   = NumComps;
+  SwPtr->MaxVal     = (u16)((1U << BitsPerComp) - 1);
+
+  NumPhases = 1U << SwPtr->PhaseShift;
+  memset(SwPtr->Coeff, 0, sizeof(SwPtr->Coeff));
+  if(InstancePtr->UseExtCoeff)
+  {
+    /* Keep the NumTaps center coefficients, as programmed in the core */
+    Offset = (XV_HSCALER_MAX_H_TAPS - SwPtr->NumTaps)/2;
+    for(i=0; i < NumPhases; ++i)
+    {
+      for(j=0; j < SwPtr->NumTaps; ++j)
+      {
+        SwPtr->Coeff[i][j] = InstancePtr->coeff[i][j+Offset];
+      }
+    }
+  }
+  else
+  {
+    /* Center the table in the NumTaps taps, as the core pads it */
+    Offset = (SwPtr->NumTaps - TableTaps)/2;
+    for(i=0; i < NumPhases; ++i)
+    {
+      for(j=0; j < TableTaps; ++j)
+      {
+        SwPtr->Coeff[i][j+Offset] = Table[i*TableTaps+j];
+      }
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function scales a stripe of lines of a frame. In and Out point to the
+* first line of the frames, and lines LineStart to LineStart + NumLines - 1
+* are scaled. The fastest implementation available is used.
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input frame
+* @param  InStride is the input line stride in samples
+* @param  Out is the output frame
+* @param  OutStride is the output line stride in samples
+* @param  LineStart is the first line to scale
+* @param  NumLines is the number of lines to scale
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerSwScale(const XV_HScalerSw *SwPtr,
+                       const u16 *In,
+                       u32 InStride,
+                       u16 *Out,
+                       u32 OutStride,
+                       u32 LineStart,
+                       u32 NumLines)
+{
+  u32 y;
+
+  /*
+   * Assert validates the input arguments
+   */
+  Xil_AssertVoid(SwPtr != NULL);
+  Xil_AssertVoid(In != NULL);
+  Xil_AssertVoid(Out != NULL);
+
+  for(y=LineStart; y < (LineStart + NumLines); ++y)
+  {
+#ifdef XV_HSCALER_SW_NEON
+    if(SwPtr->NumComps == 1)
+    {
+      XV_HScalerSwLineNeon(SwPtr, &In[y*InStride], &Out[y*OutStride]);
+      continue;
+    }
+#endif
+    XV_HScalerSwLineRef(SwPtr, &In[y*InStride], &Out[y*OutStride]);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function scales a stripe of lines of a frame with the scalar model.
+* The parameters are the ones of XV_HScalerSwScale().
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input frame
+* @param  InStride is the input line stride in samples
+* @param  Out is the output frame
+* @param  OutStride is the output line stride in samples
+* @param  LineStart is the first line to scale
+* @param  NumLines is the number of lines to scale
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerSwScaleRef(const XV_HScalerSw *SwPtr,
+                          const u16 *In,
+                          u32 InStride,
+                          u16 *Out,
+                          u32 OutStride,
+                          u32 LineStart,
+                          u32 NumLines)
+{
+  u32 y;
+
+  /*
+   * Assert validates the input arguments
+   */
+  Xil_AssertVoid(SwPtr != NULL);
+  Xil_AssertVoid(In != NULL);
+  Xil_AssertVoid(Out != NULL);
+
+  for(y=LineStart; y < (LineStart + NumLines); ++y)
+  {
+    XV_HScalerSwLineRef(SwPtr, &In[y*InStride], &Out[y*OutStride]);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function rounds a filter sum and clips it to the component range
+*
+* @param  SwPtr is a pointer to the context
+* @param  Acc is the sum of the coefficients times the pixels
+*
+* @return Output component
+*
+******************************************************************************/
+static u16 XV_HScalerSwClip(const XV_HScalerSw *SwPtr, s32 Acc)
+{
+  Acc = (Acc + (1 << (XV_HSCALER_SW_COEFF_SHIFT-1))) >>
+        XV_HSCALER_SW_COEFF_SHIFT;
+  if(Acc < 0)
+  {
+    return(0);
+  }
+  if(Acc > (s32)SwPtr->MaxVal)
+  {
+    return(SwPtr->MaxVal);
+  }
+  return((u16)Acc);
+}
+
+/*****************************************************************************/
+/**
+* This function computes one component of an output pixel, repeating the
+* edge pixels of the line for the taps outside of it
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input line
+* @param  CoeffPtr is the coefficients of the phase
+* @param  Start is the input pixel of the first tap
+* @param  Comp is the component
+*
+* @return Output component
+*
+******************************************************************************/
+static u16 XV_HScalerSwPixel(const XV_HScalerSw *SwPtr,
+                             const u16 *In,
+                             const s32 *CoeffPtr,
+                             s32 Start,
+                             u32 Comp)
+{
+  s32 Last = (s32)SwPtr->WidthIn - 1;
+  s32 Acc = 0;
+  s32 x;
+  u32 k;
+
+  for(k=0; k < SwPtr->NumTaps; ++k)
+  {
+    x = Start + (s32)k;
+    x = (x < 0) ? 0 : ((x > Last) ? Last : x);
+    Acc += CoeffPtr[k] * (s32)In[(u32)x*SwPtr->NumComps + Comp];
+  }
+
+  return(XV_HScalerSwClip(SwPtr, Acc));
+}
+
+/*****************************************************************************/
+/**
+* This function returns the next output pixel of a line from the phase
+* table. The samples of the table are walked up to the next one with
+* OutputWriteEn set, counting the input pixels read from the ArrayIdx steps.
+*
+* @param  SwPtr is a pointer to the context
+* @param  PosPtr is the position in the table, zeroed at the start of a line
+* @param  StartPtr receives the input pixel of the first tap
+*
+* @return Coefficients of the phase of the pixel, or NULL at the end of the
+*         table
+*
+******************************************************************************/
+static const s32 *XV_HScalerSwNextPixel(const XV_HScalerSw *SwPtr,
+                                        XV_HScalerSwPos *PosPtr,
+                                        s32 *StartPtr)
+{
+  u32 Bits = SwPtr->SampleBits;
+  u32 IdxMask = (1U << (Bits - 1 - XV_HSCALER_SW_IDX_SHIFT)) - 1;
+  u32 PhaseMask = (1U << SwPtr->PhaseShift) - 1;
+  u64 Entry;
+  u32 Sample;
+  u32 Idx;
+
+  while(PosPtr->Clock < SwPtr->NumClocks)
+  {
+    if(PosPtr->Sample < 4)
+    {
+      Entry = SwPtr->PhasesH[PosPtr->Clock] >> (PosPtr->Sample * Bits);
+    }
+    else
+    {
+      Entry = SwPtr->PhasesH_H[PosPtr->Clock] >> ((PosPtr->Sample-4) * Bits);
+    }
+    Sample = (u32)Entry & ((1U << Bits) - 1);
+
+    /* ArrayIdx steps by one per input pixel read */
+    Idx = (Sample >> XV_HSCALER_SW_IDX_SHIFT) & IdxMask;
+    PosPtr->Reads += (s32)Idx - (s32)PosPtr->PrevIdx;
+    PosPtr->PrevIdx = Idx;
+
+    if(++PosPtr->Sample == SwPtr->PixPerClk)
+    {
+      /* ArrayIdx wraps at the end of a clock */
+      PosPtr->Sample = 0;
+      PosPtr->PrevIdx &= (u32)(SwPtr->PixPerClk - 1);
+      ++PosPtr->Clock;
+    }
+
+    if(Sample >> (Bits - 1)) //OutputWriteEn
+    {
+      *StartPtr = PosPtr->Reads - ((s32)(SwPtr->NumTaps/2) - 1);
+      return(SwPtr->Coeff[Sample & PhaseMask]);
+    }
+  }
+
+  return(NULL);
+}
+
+/*****************************************************************************/
+/**
+* This function scales one line with the scalar model
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input line
+* @param  Out is the output line
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerSwLineRef(const XV_HScalerSw *SwPtr,
+                                const u16 *In,
+                                u16 *Out)
+{
+  XV_HScalerSwPos Pos;
+  u32 j, c;
+  s32 Start;
+  const s32 *CoeffPtr;
+
+  memset(&Pos, 0, sizeof(Pos));
+  for(j=0; j < SwPtr->WidthOut; ++j)
+  {
+    CoeffPtr = XV_HScalerSwNextPixel(SwPtr, &Pos, &Start);
+    if(CoeffPtr == NULL)
+    {
+      break;
+    }
+    for(c=0; c < SwPtr->NumComps; ++c)
+    {
+      Out[j*SwPtr->NumComps + c] =
+        XV_HScalerSwPixel(SwPtr, In, CoeffPtr, Start, c);
+    }
+  }
+}
+
+#ifdef XV_HSCALER_SW_NEON
+/*****************************************************************************/
+/**
+* This function scales one line of single component pixels with NEON. The
+* window of a pixel is loaded as 12 samples and multiplied with the zero
+* padded coefficients, so pixels whose 12 samples are not all in the line
+* are computed with the scalar model.
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input line
+* @param  Out is the output line
+*
+* @return None
+*
+******************************************************************************/
+static void XV_HScalerSwLineNeon(const XV_HScalerSw *SwPtr,
+                                 const u16 *In,
+                                 u16 *Out)
+{
+  s32 LastStart = (s32)SwPtr->WidthIn - XV_HSCALER_MAX_H_TAPS;
+  XV_HScalerSwPos Pos;
+  u32 j;
+  s32 Start;
+  const s32 *CoeffPtr;
+  uint16x8_t Pix0;
+  uint16x4_t Pix1;
+  int32x4_t Acc;
+  int32x2_t Sum;
+
+  memset(&Pos, 0, sizeof(Pos));
+  for(j=0; j < SwPtr->WidthOut; ++j)
+  {
+    CoeffPtr = XV_HScalerSwNextPixel(SwPtr, &Pos, &Start);
+    if(CoeffPtr == NULL)
+    {
+      break;
+    }
+
+    if((Start < 0) || (Start > LastStart))
+    {
+      Out[j] = XV_HScalerSwPixel(SwPtr, In, CoeffPtr, Start, 0);
+      continue;
+    }
+
+    Pix0 = vld1q_u16(&In[Start]);
+    Pix1 = vld1_u16(&In[Start + 8]);
+    Acc = vmulq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Pix0))),
+                    vld1q_s32(&CoeffPtr[0]));
+    Acc = vmlaq_s32(Acc,
+                    vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(Pix0))),
+                    vld1q_s32(&CoeffPtr[4]));
+    Acc = vmlaq_s32(Acc, vreinterpretq_s32_u32(vmovl_u16(Pix1)),
+                    vld1q_s32(&CoeffPtr[8]));
+    Sum = vadd_s32(vget_low_s32(Acc), vget_high_s32(Acc));
+    Sum = vpadd_s32(Sum, Sum);
+    Out[j] = XV_HScalerSwClip(SwPtr, vget_lane_s32(Sum, 0));
+  }
+}
+#endif
+/** @} */
@@ -0,0 +1,127 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_hscaler_sw.h
+* @addtogroup v_hscaler_v3_4
+* @{
+* @details
+*
+* This header file contains the software horizontal scaler of the H Scaler
+* driver. It scales frames in memory on the processor with the coefficient
+* tables selected by the layer-2 driver for the scaling ratio, and the phase
+* table programmed into the core by XV_HScalerSetup(). It can be used to
+* scale low rate streams (thumbnail, preview) while the core is busy.
+*
+* <b>Processing model</b>
+*
+* XV_HScalerSwSetup() computes the phase table of the widths with
+* XV_HScalerCalcPhases(), the function XV_HScalerSetup() uses. The table has
+* one entry per clock of PixPerClk samples, and each sample has an ArrayIdx,
+* a phase and an OutputWriteEn bit. The samples are walked in order. The
+* ArrayIdx steps count the input pixels read, and each sample with
+* OutputWriteEn set gives the next output pixel, with the phase of the
+* sample and the NumTaps window starting at input pixel Reads -
+* (NumTaps/2 - 1), Reads being the number of pixels read up to the sample.
+* Pixels outside the line repeat the edge pixel. The sum of the 12-bit
+* fraction coefficients times the pixels is rounded to nearest, shifted by 12
+* and clipped to the component range.
+*
+* The coefficients and the phase table are those of the core. The window
+* position, the edge pixels and the rounding are the model of this driver.
+*
+* Samples are u16, one per component, and the components of a pixel are
+* stored next to each other (e.g. RGB or a Y plane). A line is Width *
+* NumComps samples and the line stride is in samples.
+*
+* The NEON implementation is used if the compiler targets NEON, else the
+* scalar one. XV_HScalerSwScaleRef() always runs the scalar model, and the
+* two give the same output.
+*
+* <b> Threads </b>
+*
+* XV_HScalerSwSetup() copies the coefficients into the XV_HScalerSw context
+* and only reads the layer-2 instance, so it does not change what
+* XV_HScalerSetup() programs into the core. XV_HScalerSwScale() only reads
+* the context, so a frame can be split in stripes of lines processed at the
+* same time by several threads or processors.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.4   ag    10/19/26   First release
+*       ag    10/19/26   Copy the coefficients without changing the core
+*                        instance
+*       ag    10/19/26   Take the positions and phases from the phase table
+*                        of the core
+* </pre>
+*
+******************************************************************************/
+#ifndef XV_HSCALER_SW_H        /* prevent circular inclusions */
+#define XV_HSCALER_SW_H        /* by using protection macros  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xv_hscaler_l2.h"
+
+/************************** Constant Definitions *****************************/
+/** Maximum number of interleaved components of a pixel */
+#define XV_HSCALER_SW_MAX_COMPS         (4)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Software H Scaler context, initialized by XV_HScalerSwSetup()
+ */
+typedef struct
+{
+  u32 WidthIn;    /*<< Input line width in pixels */
+  u32 WidthOut;   /*<< Output line width in pixels */
+  u32 NumClocks;  /*<< Phase table entries of a line */
+  u16 PixPerClk;  /*<< Samples per phase table entry */
+  u16 SampleBits; /*<< Bits of a sample in a phase table entry */
+  u16 NumTaps;    /*<< Filter taps */
+  u16 PhaseShift; /*<< Number of phases is 2^PhaseShift */
+  u16 NumComps;   /*<< Interleaved components per pixel */
+  u16 MaxVal;     /*<< Largest component value */
+  s32 Coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS]; /*<< NumTaps
+                     coefficients per phase, zero padded */
+  u64 PhasesH[XV_HSCALER_MAX_LINE_WIDTH];   /*<< Phase table, samples 0-3 */
+  u64 PhasesH_H[XV_HSCALER_MAX_LINE_WIDTH]; /*<< Phase table, samples 4-7 */
+}XV_HScalerSw;
+
+/************************** Function Prototypes ******************************/
+int XV_HScalerSwSetup(XV_Hscaler_l2 *InstancePtr,
+                      XV_HScalerSw *SwPtr,
+                      u32 WidthIn,
+                      u32 WidthOut,
+                      u16 NumComps,
+                      u16 BitsPerComp);
+void XV_HScalerSwScale(const XV_HScalerSw *SwPtr,
+                       const u16 *In,
+                       u32 InStride,
+                       u16 *Out,
+                       u32 OutStride,
+                       u32 LineStart,
+                       u32 NumLines);
+void XV_HScalerSwScaleRef(const XV_HScalerSw *SwPtr,
+                          const u16 *In,
+                          u32 InStride,
+                          u16 *Out,
+                          u32 OutStride,
+                          u32 LineStart,
+                          u32 NumLines);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
@@ -0,0 +1,21 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Two mixer cores of the same configuration, which is in the test.
+*
+******************************************************************************/
+#ifndef XV_MIX_TXN_MODEL_XPARAMETERS_H_
+#define XV_MIX_TXN_MODEL_XPARAMETERS_H_
+
+#define XPAR_XV_MIX_NUM_INSTANCES	2U
+#define XPAR_XV_MIX_0_DEVICE_ID		0U
+#define XPAR_XV_MIX_1_DEVICE_ID		1U
+
+#endif /* XV_MIX_TXN_MODEL_XPARAMETERS_H_ */
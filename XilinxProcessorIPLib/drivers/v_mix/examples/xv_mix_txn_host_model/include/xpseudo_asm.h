@@ -0,0 +1,20 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpseudo_asm.h
+*
+* The host build has no processor instructions, the data memory barrier is a
+* full barrier of the host.
+*
+******************************************************************************/
+#ifndef XV_MIX_TXN_MODEL_XPSEUDO_ASM_H_
+#define XV_MIX_TXN_MODEL_XPSEUDO_ASM_H_
+
+#define dmb()	__sync_synchronize()
+
+#endif /* XV_MIX_TXN_MODEL_XPSEUDO_ASM_H_ */
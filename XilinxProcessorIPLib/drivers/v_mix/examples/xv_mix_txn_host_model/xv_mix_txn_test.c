@@ -0,0 +1,790 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_mix_txn_test.c
+*
+* This file contains a host test of the mixer transactions. Two mixer cores
+* of the same configuration have their register banks in host memory: the
+* reference core is programmed with the layer APIs, the other with
+* transactions committed by XVMix_InterruptHandler at a simulated frame done.
+*
+* - Random changes of windows, scale factors, alphas, buffer addresses and
+*   layer enables, all layers included, are made with the layer APIs. Those
+*   accepted are staged in a transaction. After the submit the register bank
+*   and the layer settings of the instance must not change, after the frame
+*   done they must be those of the reference core.
+* - Buffer addresses above 4 GB must write the same registers as the layer
+*   APIs, and read back in full.
+* - Layers enabled or disabled with the layer APIs while a transaction is
+*   pending must keep their state at the frame done.
+* - Each invalid change must be refused by the submit with the error code of
+*   the layer API, and nothing may be written at the frame done.
+* - The statistics are checked with a simulated time source.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.30  ag    10/19/26   First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xv_mix_l2.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ******************************/
+
+#define BANK_SIZE	0x41000U	/**< Register bank size of a core */
+#define CTRL_SIZE	0x10U		/**< Control and interrupt registers */
+#define PIX_PER_CLK	2U
+#define ADDR_ALIGN	(2U * 4U * PIX_PER_CLK)	/**< Alignment of the core */
+#define NUM_LAYERS	5U		/**< Master and 4 overlay layers */
+#define MAX_LOGO_SIZE	256U
+#define BUF_BASE	0x10000000U
+#define BUF_BASE_HIGH	((UINTPTR)0x8U << 32)	/**< Above 4 GB */
+#define NUM_ROUNDS	5000U
+#define FRAME_PERIOD	1000U
+
+/* Configuration of the mixer cores */
+#define MIX_CONFIG(Id) \
+	{ \
+		.DeviceId = (Id), \
+		.PixPerClk = PIX_PER_CLK, \
+		.MaxWidth = 3840U, \
+		.MaxHeight = 2160U, \
+		.MaxDataWidth = 8U, \
+		.ColorFormat = XVIDC_CSF_RGB, \
+		.NumLayers = NUM_LAYERS, \
+		.LogoEn = 1U, \
+		.MaxLogoWidth = MAX_LOGO_SIZE, \
+		.MaxLogoHeight = MAX_LOGO_SIZE, \
+		.AlphaEn = { 1U, 1U, 0U, 0U }, \
+		.ScalingEn = { 1U, 0U, 1U, 0U }, \
+		.LayerMaxWidth = { 1920U, 0U, 1920U, 0U }, \
+		.LayerIntrfType = { XVMIX_LAYER_TYPE_MEMORY, \
+				    XVMIX_LAYER_TYPE_MEMORY, \
+				    XVMIX_LAYER_TYPE_STREAM, \
+				    XVMIX_LAYER_TYPE_MEMORY }, \
+		.LayerColorFmt = { XVIDC_CSF_MEM_RGB8, XVIDC_CSF_MEM_RGB8, \
+				   XVIDC_CSF_RGB, XVIDC_CSF_MEM_RGB8 }, \
+	}
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Layer change of an error case
+ */
+typedef enum {
+	OP_WINDOW,
+	OP_SCALE,
+	OP_ALPHA,
+	OP_BUFADDR,
+	OP_CHROMA_BUFADDR,
+	OP_ENABLE
+} ChangeOp;
+
+/**
+ * Invalid layer change and the error code of the layer API
+ */
+typedef struct {
+	const char *Name;
+	ChangeOp Op;
+	XVMix_LayerId LayerId;
+	XVidC_VideoWindow Win;
+	u32 Value;	/**< Stride, scale factor, alpha or address */
+	int Status;
+} ErrorCase;
+
+/************************** Variable Definitions *****************************/
+
+/**
+ * Layer 1: memory, alpha and scaling. Layer 2: memory, alpha. Layer 3:
+ * stream, scaling. Layer 4: memory. The base addresses are set by InitCore.
+ */
+XV_mix_Config XV_mix_ConfigTable[XPAR_XV_MIX_NUM_INSTANCES] = {
+	MIX_CONFIG(XPAR_XV_MIX_0_DEVICE_ID),
+	MIX_CONFIG(XPAR_XV_MIX_1_DEVICE_ID)
+};
+
+/**
+ * Valid settings of the error cases, L1 is 4 times too large at 4x
+ */
+static const XVidC_VideoWindow SetupWin[NUM_LAYERS] = {
+	{ 0U, 0U, 0U, 0U },
+	{ 0U, 0U, 1000U, 600U },
+	{ 0U, 0U, 256U, 128U },
+	{ 0U, 0U, 256U, 128U },
+	{ 0U, 0U, 256U, 128U },
+};
+
+static const XVidC_VideoWindow SetupLogoWin = { 0U, 0U, 64U, 64U };
+
+static const ErrorCase ErrorCases[] = {
+	{ "window out of frame", OP_WINDOW, XVMIX_LAYER_1,
+	  { 3800U, 0U, 128U, 128U }, 512U, XVMIX_ERR_LAYER_WINDOW_INVALID },
+	{ "window too small", OP_WINDOW, XVMIX_LAYER_2,
+	  { 0U, 0U, 32U, 128U }, 128U, XVMIX_ERR_LAYER_WINDOW_INVALID },
+	{ "window wider than the line buffer", OP_WINDOW, XVMIX_LAYER_1,
+	  { 0U, 0U, 1920U, 128U }, 7680U, XVMIX_ERR_LAYER_WINDOW_INVALID },
+	{ "stride misaligned", OP_WINDOW, XVMIX_LAYER_2,
+	  { 0U, 0U, 256U, 128U }, 1028U, XVMIX_ERR_WIN_STRIDE_MISALIGNED },
+	{ "logo window too large", OP_WINDOW, XVMIX_LAYER_LOGO,
+	  { 0U, 0U, MAX_LOGO_SIZE + 2U, 64U }, 0U,
+	  XVMIX_ERR_LAYER_WINDOW_INVALID },
+	{ "scaled window out of frame", OP_SCALE, XVMIX_LAYER_1,
+	  { 0U }, XVMIX_SCALE_FACTOR_4X, XVMIX_ERR_LAYER_WINDOW_INVALID },
+	{ "scaling not in HW", OP_SCALE, XVMIX_LAYER_2,
+	  { 0U }, XVMIX_SCALE_FACTOR_2X, XST_FAILURE },
+	{ "alpha not in HW", OP_ALPHA, XVMIX_LAYER_3,
+	  { 0U }, 128U, XVMIX_ERR_DISABLED_IN_HW },
+	{ "buffer misaligned", OP_BUFADDR, XVMIX_LAYER_1,
+	  { 0U }, BUF_BASE + 8U, XVMIX_ERR_MEM_ADDR_MISALIGNED },
+	{ "chroma buffer misaligned", OP_CHROMA_BUFADDR, XVMIX_LAYER_4,
+	  { 0U }, BUF_BASE + 4U, XVMIX_ERR_MEM_ADDR_MISALIGNED },
+	{ "window of a layer not in HW", OP_WINDOW, NUM_LAYERS,
+	  { 0U, 0U, 256U, 128U }, 1024U, XVMIX_ERR_DISABLED_IN_HW },
+	{ "scale of a layer not in HW", OP_SCALE, NUM_LAYERS,
+	  { 0U }, XVMIX_SCALE_FACTOR_2X, XVMIX_ERR_DISABLED_IN_HW },
+	{ "alpha of a layer not in HW", OP_ALPHA, NUM_LAYERS,
+	  { 0U }, 128U, XVMIX_ERR_DISABLED_IN_HW },
+	{ "buffer of a layer not in HW", OP_BUFADDR, NUM_LAYERS,
+	  { 0U }, BUF_BASE, XST_FAILURE },
+	{ "enable of a layer not in HW", OP_ENABLE, NUM_LAYERS,
+	  { 0U }, 0U, XST_FAILURE },
+};
+
+#define NUM_ERROR_CASES	(sizeof(ErrorCases)/sizeof(ErrorCases[0]))
+
+static XV_Mix_l2 Ref;		/**< Core programmed with the layer APIs */
+static XV_Mix_l2 Mix;		/**< Core programmed with transactions */
+static u32 *RefBank;
+static u32 *MixBank;
+static u32 *Snapshot;
+static XVMix_Layer SnapshotLayer[XVMIX_MAX_SUPPORTED_LAYERS];
+static XVMix_Txn Txn;
+static XVMix_Txn Txn2;
+static u64 SimTime;
+
+u32 Xil_AssertStatus;
+
+/************************** Function Definitions *****************************/
+
+#define CHECK(Cond) \
+	do { \
+		if (!(Cond)) { \
+			printf("%s line %d: %s\r\n", __FILE__, __LINE__, #Cond); \
+			return XST_FAILURE; \
+		} \
+	} while (0)
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	exit(1);
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	vprintf(ctrl1, Args);
+	va_end(Args);
+}
+
+/* The flush wait of XVMix_Stop, not called by the test */
+void usleep(ULONG useconds)
+{
+	(void)useconds;
+}
+
+static u64 GetTime(void)
+{
+	return SimTime;
+}
+
+static u32 Rand(u32 Max)
+{
+	return (u32)rand() % Max;
+}
+
+/*****************************************************************************/
+/**
+* Initializes a core with its register bank in host memory
+*
+******************************************************************************/
+static int InitCore(XV_Mix_l2 *InstancePtr, u32 **BankPtr, u16 DeviceId)
+{
+	*BankPtr = calloc(1U, BANK_SIZE);
+	CHECK(*BankPtr != NULL);
+
+	XV_mix_ConfigTable[DeviceId].BaseAddress = (UINTPTR)*BankPtr;
+	CHECK(XVMix_Initialize(InstancePtr, DeviceId) == XST_SUCCESS);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Raises the done interrupt of a core and calls the interrupt handler
+*
+******************************************************************************/
+static void FrameDone(XV_Mix_l2 *InstancePtr, u32 *Bank)
+{
+	Bank[XV_MIX_CTRL_ADDR_ISR / 4U] = XVMIX_IRQ_DONE_MASK;
+	XVMix_InterruptHandler(InstancePtr);
+}
+
+static void TakeSnapshot(void)
+{
+	memcpy(Snapshot, MixBank, BANK_SIZE);
+	memcpy(SnapshotLayer, Mix.Layer, sizeof(Mix.Layer));
+}
+
+static int SameAsSnapshot(void)
+{
+	CHECK(memcmp(Snapshot, MixBank, BANK_SIZE) == 0);
+	CHECK(memcmp(SnapshotLayer, Mix.Layer, sizeof(Mix.Layer)) == 0);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Compares the cores, except for the control and interrupt registers, which
+* differ as only Mix runs in interrupt mode
+*
+******************************************************************************/
+static int SameCores(void)
+{
+	u32 Id;
+
+	CHECK(memcmp(RefBank + (CTRL_SIZE / 4U), MixBank + (CTRL_SIZE / 4U),
+		     BANK_SIZE - CTRL_SIZE) == 0);
+
+	for (Id = 0U; Id < XVMIX_MAX_SUPPORTED_LAYERS; Id++) {
+		CHECK(memcmp(&Ref.Layer[Id].Win, &Mix.Layer[Id].Win,
+			     sizeof(XVidC_VideoWindow)) == 0);
+		CHECK(Ref.Layer[Id].BufAddr == Mix.Layer[Id].BufAddr);
+		CHECK(Ref.Layer[Id].ChromaBufAddr ==
+		      Mix.Layer[Id].ChromaBufAddr);
+	}
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Sets the logo window of the reference core. XVMix_SetLayerWindow stores
+* the logo window in Layer[XVMIX_LAYER_LOGO], past the end of the layer
+* settings, so its checks and register writes are done here.
+*
+******************************************************************************/
+static int RefSetLogoWindow(const XVidC_VideoWindow *Win)
+{
+	XVMix_Scalefactor Scale;
+
+	Scale = (XVMix_Scalefactor)XVMix_GetLayerScaleFactor(&Ref,
+							     XVMIX_LAYER_LOGO);
+	if (!XVMix_IsWindowValid(&Ref.Stream, Win, Scale) ||
+	    (Win->Width < XVMIX_MIN_LOGO_WIDTH) ||
+	    (Win->Height < XVMIX_MIN_LOGO_HEIGHT) ||
+	    (Win->Width > MAX_LOGO_SIZE) || (Win->Height > MAX_LOGO_SIZE)) {
+		return XVMIX_ERR_LAYER_WINDOW_INVALID;
+	}
+
+	XV_mix_Set_HwReg_logoStartX(&Ref.Mix, Win->StartX);
+	XV_mix_Set_HwReg_logoStartY(&Ref.Mix, Win->StartY);
+	XV_mix_Set_HwReg_logoWidth(&Ref.Mix, Win->Width);
+	XV_mix_Set_HwReg_logoHeight(&Ref.Mix, Win->Height);
+	return XST_SUCCESS;
+}
+
+static int RefSetWindow(XVMix_LayerId LayerId, XVidC_VideoWindow *Win,
+			u32 Stride)
+{
+	if (LayerId == XVMIX_LAYER_LOGO) {
+		return RefSetLogoWindow(Win);
+	}
+	return XVMix_SetLayerWindow(&Ref, LayerId, Win, Stride);
+}
+
+/*****************************************************************************/
+/**
+* Makes a change with the layer API on the reference core and, if accepted,
+* stages it in the transaction
+*
+******************************************************************************/
+static int Change(XVMix_Txn *TxnPtr, ChangeOp Op, XVMix_LayerId LayerId,
+		  XVidC_VideoWindow *Win, UINTPTR Value)
+{
+	int Status = XST_FAILURE;
+
+	switch (Op) {
+	case OP_WINDOW:
+		Status = RefSetWindow(LayerId, Win, Value);
+		if (Status == XST_SUCCESS) {
+			XVMix_TxnSetLayerWindow(TxnPtr, LayerId, Win, Value);
+		}
+		break;
+	case OP_SCALE:
+		Status = XVMix_SetLayerScaleFactor(&Ref, LayerId,
+						   (XVMix_Scalefactor)Value);
+		if (Status == XST_SUCCESS) {
+			XVMix_TxnSetLayerScaleFactor(TxnPtr, LayerId,
+						     (XVMix_Scalefactor)Value);
+		}
+		break;
+	case OP_ALPHA:
+		Status = XVMix_SetLayerAlpha(&Ref, LayerId, (u16)Value);
+		if (Status == XST_SUCCESS) {
+			XVMix_TxnSetLayerAlpha(TxnPtr, LayerId, (u16)Value);
+		}
+		break;
+	case OP_BUFADDR:
+		Status = XVMix_SetLayerBufferAddr(&Ref, LayerId, Value);
+		if (Status == XST_SUCCESS) {
+			XVMix_TxnSetLayerBufferAddr(TxnPtr, LayerId, Value);
+		}
+		break;
+	case OP_CHROMA_BUFADDR:
+		Status = XVMix_SetLayerChromaBufferAddr(&Ref, LayerId, Value);
+		if (Status == XST_SUCCESS) {
+			XVMix_TxnSetLayerChromaBufferAddr(TxnPtr, LayerId,
+							  Value);
+		}
+		break;
+	case OP_ENABLE:
+		if (Value != 0U) {
+			Status = XVMix_LayerEnable(&Ref, LayerId);
+			if (Status == XST_SUCCESS) {
+				XVMix_TxnLayerEnable(TxnPtr, LayerId);
+			}
+		} else {
+			Status = XVMix_LayerDisable(&Ref, LayerId);
+			if (Status == XST_SUCCESS) {
+				XVMix_TxnLayerDisable(TxnPtr, LayerId);
+			}
+		}
+		break;
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* Random changes of a layer, some invalid. The windows can be too small, too
+* wide for the line buffer or out of frame, at 1x or when scaled.
+*
+******************************************************************************/
+static void RandomChanges(XVMix_LayerId LayerId)
+{
+	XVidC_VideoWindow Win;
+	u32 Stride;
+	UINTPTR Base, Align;
+
+	if (Rand(2U) == 0U) {
+		Win.StartX = PIX_PER_CLK * Rand(1000U);
+		Win.StartY = Rand(1200U);
+		if (LayerId == XVMIX_LAYER_LOGO) {
+			Win.Width = PIX_PER_CLK * (8U + Rand(124U));
+			Win.Height = 16U + Rand(248U);
+		} else {
+			Win.Width = PIX_PER_CLK * (16U + Rand(1000U));
+			Win.Height = 32U + Rand(1100U);
+		}
+		Stride = (Win.Width * 4U) + ((Rand(8U) == 0U) ? 4U : 0U);
+		(void)Change(&Txn, OP_WINDOW, LayerId, &Win, Stride);
+	}
+	if (Rand(3U) == 0U) {
+		(void)Change(&Txn, OP_SCALE, LayerId, NULL,
+			     Rand(XVMIX_SCALE_FACTOR_NUM_SUPPORTED));
+	}
+	if (Rand(3U) == 0U) {
+		(void)Change(&Txn, OP_ALPHA, LayerId, NULL,
+			     Rand(XVMIX_ALPHA_MAX + 1U));
+	}
+	if (LayerId == XVMIX_LAYER_LOGO) {
+		return;
+	}
+	Base = (Rand(2U) == 0U) ? BUF_BASE : BUF_BASE_HIGH;
+	Align = (Rand(8U) == 0U) ? 4U : 0U;
+	if (Rand(3U) == 0U) {
+		(void)Change(&Txn, OP_BUFADDR, LayerId, NULL,
+			     Base + (ADDR_ALIGN * Rand(0x10000U)) + Align);
+	}
+	if (Rand(3U) == 0U) {
+		(void)Change(&Txn, OP_CHROMA_BUFADDR, LayerId, NULL,
+			     Base + (ADDR_ALIGN * Rand(0x10000U)) + Align);
+	}
+}
+
+static void RandomEnable(XVMix_LayerId LayerId)
+{
+	u32 Op = Rand(4U);
+
+	if (Op < 2U) {
+		(void)Change(&Txn, OP_ENABLE, LayerId, NULL, Op);
+	}
+}
+
+/*****************************************************************************/
+/**
+* Random transactions against the layer APIs
+*
+******************************************************************************/
+static int TestRandom(void)
+{
+	u32 Round, Id;
+
+	for (Round = 0U; Round < NUM_ROUNDS; Round++) {
+		XVMix_TxnInit(&Txn);
+
+		if (Rand(20U) == 0U) {
+			(void)Change(&Txn, OP_ENABLE, XVMIX_LAYER_ALL, NULL,
+				     Rand(2U));
+		}
+		for (Id = XVMIX_LAYER_1; Id <= NUM_LAYERS; Id++) {
+			if (Rand(2U) == 0U) {
+				RandomChanges((XVMix_LayerId)Id);
+			}
+		}
+		if (Rand(2U) == 0U) {
+			RandomChanges(XVMIX_LAYER_LOGO);
+		}
+		for (Id = XVMIX_LAYER_MASTER; Id <= NUM_LAYERS; Id++) {
+			RandomEnable((XVMix_LayerId)Id);
+		}
+		RandomEnable(XVMIX_LAYER_LOGO);
+
+		TakeSnapshot();
+		CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+		CHECK(XVMix_IsTxnPending(&Mix));
+		CHECK(SameAsSnapshot() == XST_SUCCESS);
+		CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_DEVICE_BUSY);
+
+		FrameDone(&Mix, MixBank);
+		CHECK(!XVMix_IsTxnPending(&Mix));
+		CHECK(SameCores() == XST_SUCCESS);
+	}
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Enabling all layers in a transaction must write the same layer enable
+* register as XVMix_LayerEnable
+*
+******************************************************************************/
+static int TestEnableAll(void)
+{
+	XVMix_TxnInit(&Txn);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_ALL, NULL, 1U) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+	CHECK(XV_mix_Get_HwReg_layerEnable(&Mix.Mix) ==
+	      XVMIX_MASK_ENABLE_ALL_LAYERS);
+	CHECK(SameCores() == XST_SUCCESS);
+
+	XVMix_TxnInit(&Txn);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_ALL, NULL, 0U) ==
+	      XST_SUCCESS);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_MASTER, NULL, 1U) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+	CHECK(XV_mix_Get_HwReg_layerEnable(&Mix.Mix) ==
+	      (1U << XVMIX_LAYER_MASTER));
+	CHECK(SameCores() == XST_SUCCESS);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Buffer addresses above 4 GB must write both words of the 64-bit registers,
+* as the layer APIs do, and read back in full
+*
+******************************************************************************/
+static int TestBufferAddr64(void)
+{
+	const UINTPTR Luma = BUF_BASE_HIGH + (ADDR_ALIGN * 0x123U);
+	const UINTPTR Chroma = BUF_BASE_HIGH + (ADDR_ALIGN * 0x456U);
+	u32 Offset = XVMIX_REG_OFFSET * (XVMIX_LAYER_2 - 1);
+
+	XVMix_TxnInit(&Txn);
+	CHECK(Change(&Txn, OP_BUFADDR, XVMIX_LAYER_2, NULL, Luma) ==
+	      XST_SUCCESS);
+	CHECK(Change(&Txn, OP_CHROMA_BUFADDR, XVMIX_LAYER_2, NULL, Chroma) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+	CHECK(SameCores() == XST_SUCCESS);
+
+	CHECK(MixBank[(XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA + Offset + 4U)
+		      / 4U] == (u32)((u64)Luma >> 32));
+	CHECK(MixBank[(XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA + Offset + 4U)
+		      / 4U] == (u32)((u64)Chroma >> 32));
+	CHECK(XVMix_GetLayerBufferAddr(&Mix, XVMIX_LAYER_2) == Luma);
+	CHECK(XVMix_GetLayerChromaBufferAddr(&Mix, XVMIX_LAYER_2) == Chroma);
+	CHECK(XVMix_GetLayerBufferAddr(&Ref, XVMIX_LAYER_2) == Luma);
+	CHECK(XVMix_GetLayerChromaBufferAddr(&Ref, XVMIX_LAYER_2) == Chroma);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Layer enables made with the layer APIs while a transaction is pending must
+* be kept at the frame done, unless the transaction stages them
+*
+******************************************************************************/
+static int TestEnableWhilePending(void)
+{
+	u32 Enable;
+
+	XVMix_TxnInit(&Txn);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_ALL, NULL, 0U) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+
+	XVMix_TxnInit(&Txn);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_1, NULL, 1U) ==
+	      XST_SUCCESS);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_2, NULL, 1U) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+
+	/* Layer 2 is disabled by the API and enabled by the transaction */
+	CHECK(XVMix_LayerEnable(&Mix, XVMIX_LAYER_3) == XST_SUCCESS);
+	CHECK(XVMix_LayerEnable(&Mix, XVMIX_LAYER_LOGO) == XST_SUCCESS);
+	CHECK(XVMix_LayerDisable(&Mix, XVMIX_LAYER_2) == XST_SUCCESS);
+	CHECK(XVMix_LayerEnable(&Ref, XVMIX_LAYER_3) == XST_SUCCESS);
+	CHECK(XVMix_LayerEnable(&Ref, XVMIX_LAYER_LOGO) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+
+	Enable = XV_mix_Get_HwReg_layerEnable(&Mix.Mix);
+	CHECK(Enable == ((1U << XVMIX_LAYER_1) | (1U << XVMIX_LAYER_2) |
+			 (1U << XVMIX_LAYER_3) | (1U << XVMIX_LAYER_LOGO)));
+	CHECK(SameCores() == XST_SUCCESS);
+
+	/* A disable made while pending is kept as well */
+	XVMix_TxnInit(&Txn);
+	CHECK(Change(&Txn, OP_ENABLE, XVMIX_LAYER_MASTER, NULL, 1U) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	CHECK(XVMix_LayerDisable(&Mix, XVMIX_LAYER_3) == XST_SUCCESS);
+	CHECK(XVMix_LayerDisable(&Ref, XVMIX_LAYER_3) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+	CHECK(XV_mix_Get_HwReg_layerEnable(&Mix.Mix) ==
+	      ((Enable & ~(1U << XVMIX_LAYER_3)) | (1U << XVMIX_LAYER_MASTER)));
+	CHECK(SameCores() == XST_SUCCESS);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Sets the valid settings of the error cases on both cores
+*
+******************************************************************************/
+static int SetupErrorCases(void)
+{
+	XVidC_VideoWindow Win;
+	u32 Id;
+
+	XVMix_TxnInit(&Txn);
+	for (Id = XVMIX_LAYER_1; Id < NUM_LAYERS; Id++) {
+		if (XVMix_IsScalingEnabled(&Ref, Id)) {
+			CHECK(Change(&Txn, OP_SCALE, (XVMix_LayerId)Id, NULL,
+				     XVMIX_SCALE_FACTOR_1X) == XST_SUCCESS);
+		}
+		Win = SetupWin[Id];
+		CHECK(Change(&Txn, OP_WINDOW, (XVMix_LayerId)Id, &Win,
+			     Win.Width * 4U) == XST_SUCCESS);
+	}
+	CHECK(Change(&Txn, OP_SCALE, XVMIX_LAYER_LOGO, NULL,
+		     XVMIX_SCALE_FACTOR_1X) == XST_SUCCESS);
+	Win = SetupLogoWin;
+	CHECK(Change(&Txn, OP_WINDOW, XVMIX_LAYER_LOGO, &Win, 0U) ==
+	      XST_SUCCESS);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	FrameDone(&Mix, MixBank);
+	CHECK(SameCores() == XST_SUCCESS);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* An invalid change, staged with a valid one, must be refused with the
+* error code of the layer API and nothing written at the frame done
+*
+******************************************************************************/
+static int TestErrorCase(const ErrorCase *CasePtr)
+{
+	XVidC_VideoWindow Win = CasePtr->Win;
+	XVidC_VideoWindow RefWin = CasePtr->Win;
+
+	XVMix_TxnInit(&Txn);
+	XVMix_TxnSetLayerAlpha(&Txn, XVMIX_LAYER_1, 100U);
+
+	/* The reference core refuses the change, which is staged anyway */
+	CHECK(Change(&Txn2, CasePtr->Op, CasePtr->LayerId, &RefWin,
+		     CasePtr->Value) == CasePtr->Status);
+	switch (CasePtr->Op) {
+	case OP_WINDOW:
+		XVMix_TxnSetLayerWindow(&Txn, CasePtr->LayerId, &Win,
+					CasePtr->Value);
+		break;
+	case OP_SCALE:
+		XVMix_TxnSetLayerScaleFactor(&Txn, CasePtr->LayerId,
+					     (XVMix_Scalefactor)CasePtr->Value);
+		break;
+	case OP_ALPHA:
+		XVMix_TxnSetLayerAlpha(&Txn, CasePtr->LayerId,
+				       (u16)CasePtr->Value);
+		break;
+	case OP_BUFADDR:
+		XVMix_TxnSetLayerBufferAddr(&Txn, CasePtr->LayerId,
+					    CasePtr->Value);
+		break;
+	case OP_CHROMA_BUFADDR:
+		XVMix_TxnSetLayerChromaBufferAddr(&Txn, CasePtr->LayerId,
+						  CasePtr->Value);
+		break;
+	case OP_ENABLE:
+		XVMix_TxnLayerEnable(&Txn, CasePtr->LayerId);
+		break;
+	}
+
+	TakeSnapshot();
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == CasePtr->Status);
+	CHECK(!XVMix_IsTxnPending(&Mix));
+	FrameDone(&Mix, MixBank);
+	CHECK(SameAsSnapshot() == XST_SUCCESS);
+	CHECK(SameCores() == XST_SUCCESS);
+	return XST_SUCCESS;
+}
+
+static int TestErrors(void)
+{
+	u32 Index;
+
+	CHECK(SetupErrorCases() == XST_SUCCESS);
+
+	for (Index = 0U; Index < NUM_ERROR_CASES; Index++) {
+		if (TestErrorCase(&ErrorCases[Index]) != XST_SUCCESS) {
+			printf("Error case %s failed\r\n",
+			       ErrorCases[Index].Name);
+			return XST_FAILURE;
+		}
+	}
+
+	/* Transactions are refused without the frame done interrupt */
+	XVMix_TxnInit(&Txn);
+	XVMix_TxnSetLayerAlpha(&Txn, XVMIX_LAYER_1, 100U);
+	XVMix_InterruptDisable(&Mix);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_NOT_ENABLED);
+	CHECK(!XVMix_IsTxnPending(&Mix));
+	XVMix_InterruptEnable(&Mix);
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Submits and frame dones at set times, with a missed vblank
+*
+******************************************************************************/
+static int TestStats(void)
+{
+	XVidC_VideoWindow Win = { 0U, 0U, 500U, 300U };
+	XVMix_TxnStats Stats;
+
+	XVMix_TxnSetTimeSource(&Mix, GetTime, FRAME_PERIOD);
+
+	SimTime = 1000U;
+	FrameDone(&Mix, MixBank);
+
+	/* One write, latency 800 */
+	SimTime = 1200U;
+	XVMix_TxnInit(&Txn);
+	XVMix_TxnSetLayerAlpha(&Txn, XVMIX_LAYER_1, 10U);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	SimTime = 2000U;
+	FrameDone(&Mix, MixBank);
+
+	/* Twelve writes, latency 900, a second submit is refused */
+	SimTime = 2100U;
+	XVMix_TxnInit(&Txn);
+	XVMix_TxnSetLayerWindow(&Txn, XVMIX_LAYER_1, &Win, 2000U);
+	XVMix_TxnSetLayerScaleFactor(&Txn, XVMIX_LAYER_1,
+				     XVMIX_SCALE_FACTOR_2X);
+	XVMix_TxnSetLayerAlpha(&Txn, XVMIX_LAYER_1, 20U);
+	XVMix_TxnSetLayerBufferAddr(&Txn, XVMIX_LAYER_1, BUF_BASE);
+	XVMix_TxnSetLayerChromaBufferAddr(&Txn, XVMIX_LAYER_1, BUF_BASE);
+	XVMix_TxnLayerEnable(&Txn, XVMIX_LAYER_1);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn) == XST_SUCCESS);
+	SimTime = 2200U;
+	XVMix_TxnInit(&Txn2);
+	XVMix_TxnSetLayerAlpha(&Txn2, XVMIX_LAYER_1, 30U);
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn2) == XST_DEVICE_BUSY);
+	SimTime = 3000U;
+	FrameDone(&Mix, MixBank);
+
+	/* 2600 after the last frame done, two vblanks missed */
+	SimTime = 5600U;
+	FrameDone(&Mix, MixBank);
+
+	/* Latency 800 */
+	SimTime = 5700U;
+	CHECK(XVMix_TxnSubmit(&Mix, &Txn2) == XST_SUCCESS);
+	SimTime = 6500U;
+	FrameDone(&Mix, MixBank);
+
+	XVMix_TxnGetStats(&Mix, &Stats);
+	CHECK(Stats.Submitted == 3U);
+	CHECK(Stats.Busy == 1U);
+	CHECK(Stats.Committed == 3U);
+	CHECK(Stats.MaxWrites == 12U);
+	CHECK(Stats.MissedVblanks == 2U);
+	CHECK(Stats.LatencyMin == 800U);
+	CHECK(Stats.LatencyMax == 900U);
+	CHECK(Stats.LatencyTotal == 2500U);
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	srand(1U);
+
+	Snapshot = malloc(BANK_SIZE);
+	if ((Snapshot == NULL) ||
+	    (InitCore(&Ref, &RefBank, XPAR_XV_MIX_0_DEVICE_ID) != XST_SUCCESS) ||
+	    (InitCore(&Mix, &MixBank, XPAR_XV_MIX_1_DEVICE_ID) != XST_SUCCESS)) {
+		printf("Mixer transaction test failed\r\n");
+		return 1;
+	}
+	XVMix_InterruptEnable(&Mix);
+
+	if ((TestRandom() != XST_SUCCESS) ||
+	    (TestEnableAll() != XST_SUCCESS) ||
+	    (TestBufferAddr64() != XST_SUCCESS) ||
+	    (TestEnableWhilePending() != XST_SUCCESS) ||
+	    (TestErrors() != XST_SUCCESS) ||
+	    (TestStats() != XST_SUCCESS)) {
+		printf("Mixer transaction test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran Mixer transaction test\r\n");
+	return 0;
+}
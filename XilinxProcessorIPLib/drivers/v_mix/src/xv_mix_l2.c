@@ -48,6 +48,13 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+* 6.30  ag    10/19/26   Make the window check available to the transaction
+*                        API and restart the frame done timing when the
+*                        interrupts are enabled
+*                        Move the layer enable masks, register offset and
+*                        window limits to xv_mix_l2.h
+*                        Write and read the upper 32 bits of the buffer
+*                        addresses
 * </pre>
 *
 ******************************************************************************/
@@ -58,13 +65,6 @@
 #include "xv_mix_l2.h"
 
 /************************** Constant Definitions *****************************/
-#define XVMIX_MASK_ENABLE_ALL_LAYERS    (0xFFFFFFFF)
-#define XVMIX_MASK_DISABLE_ALL_LAYERS   (0)
-#define XVMIX_REG_OFFSET                (0x100)
-#define XVMIX_MIN_STRM_WIDTH            (64u)
-#define XVMIX_MIN_STRM_HEIGHT           (64u)
-#define XVMIX_MIN_LOGO_WIDTH            (32u)
-#define XVMIX_MIN_LOGO_HEIGHT           (32u)
 #define XV_WAIT_FOR_FLUSH_DONE		    (25)
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT	(2000)
 
@@ -90,9 +90,6 @@ static const u8 bkgndColorRGB[XVMIX_BKGND_LAST][3] =
 
 /************************** Function Prototypes ******************************/
 static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
-static int IsWindowValid(XVidC_VideoStream *Strm,
-                         XVidC_VideoWindow *Win,
-                         XVMix_Scalefactor ScaleFactor);
 
 /*****************************************************************************/
 /**
@@ -196,6 +193,7 @@ void XVMix_InterruptEnable(XV_Mix_l2 *InstancePtr)
   /* Enable Interrupts */
   XV_mix_InterruptEnable(&InstancePtr->Mix, XVMIX_IRQ_DONE_MASK);
   XV_mix_InterruptGlobalEnable(&InstancePtr->Mix);
+  InstancePtr->LastDoneTime = 0;
 
   /* Clear autostart bit */
   XV_mix_DisableAutoRestart(&InstancePtr->Mix);
@@ -278,12 +276,12 @@ void XVMix_Stop(XV_Mix_l2 *InstancePtr)
 * @param  Win is the pointer to window coordinates to be validated
 * @param  Scale is the scale factor of the window
 *
-* @return None
+* @return TRUE if the window is within the frame, else FALSE
 *
 ******************************************************************************/
-static int IsWindowValid(XVidC_VideoStream *Strm,
-                         XVidC_VideoWindow *Win,
-                         XVMix_Scalefactor Scale)
+int XVMix_IsWindowValid(const XVidC_VideoStream *Strm,
+                        const XVidC_VideoWindow *Win,
+                        XVMix_Scalefactor Scale)
 {
   XVidC_VideoWindow NewWin;
   u16 ScaleFactor[XVMIX_SCALE_FACTOR_NUM_SUPPORTED] = {1,2,4};
@@ -528,7 +526,7 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
 
   /* Check window coordinates */
   Scale = (XVMix_Scalefactor)XVMix_GetLayerScaleFactor(InstancePtr, LayerId);
-  if(!IsWindowValid(&InstancePtr->Stream, Win, Scale)) {
+  if(!XVMix_IsWindowValid(&InstancePtr->Stream, Win, Scale)) {
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
@@ -744,7 +742,7 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
   /* Validate new start position will not cause the layer window
    * to go out of scope
    */
-  if(!IsWindowValid(&InstancePtr->Stream, &CurrWin, Scale)) {
+  if(!XVMix_IsWindowValid(&InstancePtr->Stream, &CurrWin, Scale)) {
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
@@ -820,7 +818,7 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
      return(WinStatus);
   }
 
-  if(!IsWindowValid(&InstancePtr->Stream, &CurrWin, Scale)) {
+  if(!XVMix_IsWindowValid(&InstancePtr->Stream, &CurrWin, Scale)) {
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
@@ -1134,7 +1132,10 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
         XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), (u32)Addr);
+        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)+4),
+                        (u32)((u64)Addr >> 32));
 
         InstancePtr->Layer[LayerId].BufAddr = Addr;
         Status = XST_SUCCESS;
@@ -1168,10 +1169,13 @@ UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   MixPtr = &InstancePtr->Mix;
 
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
-        BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
+        BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA +
+                  ((LayerId-1)*XVMIX_REG_OFFSET);
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
+        ReadVal = (UINTPTR)((u64)XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+                                                BaseReg) |
+                            ((u64)XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+                                                 BaseReg+4) << 32));
   }
   return(ReadVal);
 }
@@ -1220,7 +1224,10 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
         XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), (u32)Addr);
+        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)+4),
+                        (u32)((u64)Addr >> 32));
 
         InstancePtr->Layer[LayerId].ChromaBufAddr = Addr;
         Status = XST_SUCCESS;
@@ -1256,10 +1263,13 @@ UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
   MixPtr = &InstancePtr->Mix;
 
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
-        BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
+        BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA +
+                  ((LayerId-1)*XVMIX_REG_OFFSET);
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
+        ReadVal = (UINTPTR)((u64)XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+                                                BaseReg) |
+                            ((u64)XV_mix_ReadReg(MixPtr->Config.BaseAddress,
+                                                 BaseReg+4) << 32));
   }
   return(ReadVal);
 }
@@ -79,6 +79,33 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Transactions </b>
+*
+* Each layer API writes its registers at once, so a change of several layers
+* done while the core runs can be split across two frames. In interrupt mode
+* the changes can instead be grouped in a transaction, which the interrupt
+* handler writes to the core between the frame done and the next frame
+* start.
+*   - Clear a XVMix_Txn with XVMix_TxnInit() and stage the changes with the
+*     XVMix_Txn* functions. Staging only records the values.
+*   - XVMix_TxnSubmit() validates all staged changes against the hardware
+*     configuration and the current layer settings, and converts them into
+*     the list of register writes. If a change is invalid the transaction is
+*     not submitted and the error code of the matching layer API is returned.
+*   - At the next frame done, XVMix_InterruptHandler() writes the list, then
+*     sets and clears the staged bits of the layer enable register, and
+*     updates the layer settings of the instance before the user callback,
+*     which can submit the next transaction.
+*     XVMix_IsTxnPending() tells if the transaction was written. The
+*     transaction must not be changed until then.
+*
+* Only one transaction can be pending. Layer API calls made while a
+* transaction is pending may be overwritten by it, except for the enables of
+* the layers whose enable state the transaction does not stage. If a time source is set
+* with XVMix_TxnSetTimeSource(), the driver measures the latency from submit
+* to commit and counts the missed vblanks, i.e. frame done interrupts later
+* than one and a half frame periods after the previous one.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -106,6 +133,11 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+* 6.30  ag    10/19/26   Add layer update transactions committed at frame done
+*                        Share the layer enable masks, register offset and
+*                        window limits of xv_mix_l2.c
+*                        Count the upper 32 bits of the buffer addresses in
+*                        the writes of a transaction
 * </pre>
 *
 ******************************************************************************/
@@ -127,6 +159,14 @@ extern "C" {
 #define XVMIX_IRQ_DONE_MASK              (0x01)
 #define XVMIX_IRQ_READY_MASK             (0x02)
 
+#define XVMIX_MASK_ENABLE_ALL_LAYERS     (0xFFFFFFFF)
+#define XVMIX_MASK_DISABLE_ALL_LAYERS    (0)
+#define XVMIX_REG_OFFSET                 (0x100)
+#define XVMIX_MIN_STRM_WIDTH             (64u)
+#define XVMIX_MIN_STRM_HEIGHT            (64u)
+#define XVMIX_MIN_LOGO_WIDTH             (32u)
+#define XVMIX_MIN_LOGO_HEIGHT            (32u)
+
 #define XVMIX_CSC_COEFF_FRACTIONAL_BITS	(12)
 #define XVMIX_CSC_COEFF_DIVISOR	(10000)
 #define XVMIX_CSC_MAX_ROWS		(3)
@@ -134,6 +174,18 @@ extern "C" {
 #define XVMIX_CSC_MATRIX_SIZE	(XVMIX_CSC_MAX_ROWS * XVMIX_CSC_MAX_COLS)
 #define XVMIX_CSC_COEFF_SIZE		(12)
 
+/* Layer settings staged in a transaction */
+#define XVMIX_TXN_WINDOW                 (0x01)
+#define XVMIX_TXN_ALPHA                  (0x02)
+#define XVMIX_TXN_SCALE                  (0x04)
+#define XVMIX_TXN_BUFADDR                (0x08)
+#define XVMIX_TXN_CHROMA_BUFADDR         (0x10)
+
+/* Transaction layers: overlay layers then logo layer */
+#define XVMIX_TXN_NUM_LAYERS             (XV_MIX_MAX_MEMORY_LAYERS + 1)
+/* Registers of a layer: window (5), alpha, scale factor, 2 64-bit buffers */
+#define XVMIX_TXN_MAX_WRITES             (XVMIX_TXN_NUM_LAYERS * 11)
+
 /**************************** Type Definitions *******************************/
 /**
  * This typedef enumerates supported background colors
@@ -294,6 +346,67 @@ typedef struct {
 */
 typedef void (*XVMix_Callback)(void *CallbackRef);
 
+/**
+* Time source of the transaction statistics.
+*
+* @return   Current time, in any unit.
+*
+*/
+typedef u64 (*XVMix_GetTime)(void);
+
+/**
+ * This typedef contains a register write of a transaction
+ */
+typedef struct {
+  u32 Offset;
+  u32 Data;
+}XVMix_RegWrite;
+
+/**
+ * This typedef contains the settings of a layer staged in a transaction
+ */
+typedef struct {
+  u32 Changed;                /**< XVMIX_TXN_* settings staged */
+  XVidC_VideoWindow Win;
+  u32 StrideInBytes;
+  u16 Alpha;
+  XVMix_Scalefactor Scale;
+  UINTPTR BufAddr;
+  UINTPTR ChromaBufAddr;
+}XVMix_TxnLayer;
+
+/**
+ * This typedef contains a transaction. The register writes are built by
+ * XVMix_TxnSubmit() and read by the interrupt handler.
+ */
+typedef struct {
+  XVMix_TxnLayer Layer[XVMIX_TXN_NUM_LAYERS]; /**< Staged layer settings */
+  u32 EnableLayers;           /**< Layers with a staged enable state */
+  u32 EnableSet;              /**< Layer enable bits to set */
+  u32 EnableClear;            /**< Layer enable bits to clear */
+  volatile u32 NumWrites;     /**< Number of register writes */
+  volatile XVMix_RegWrite Writes[XVMIX_TXN_MAX_WRITES]; /**< Register
+                                                             writes */
+  volatile u64 SubmitTime;    /**< Time of the submit */
+}XVMix_Txn;
+
+/**
+ * This typedef contains the transaction statistics. Submitted and Busy are
+ * updated by XVMix_TxnSubmit(), the other fields by the interrupt handler.
+ */
+typedef struct {
+  u32 Submitted;              /**< Transactions submitted */
+  u32 Busy;                   /**< Submits refused, a transaction was
+                                   pending */
+  u32 Committed;              /**< Transactions written to the core */
+  u32 MaxWrites;              /**< Largest number of register writes,
+                                   layer enable included */
+  u32 MissedVblanks;          /**< Frame periods without frame done */
+  u64 LatencyMin;             /**< Minimum submit to commit time */
+  u64 LatencyMax;             /**< Maximum submit to commit time */
+  u64 LatencyTotal;           /**< Sum of the submit to commit times */
+}XVMix_TxnStats;
+
 /**
  * Mixer driver Layer 2 data. The user is required to allocate a variable
  * of this type for every mixer device in the system. A pointer to a
@@ -312,6 +425,14 @@ typedef struct {
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    /* Transactions */
+    XVMix_Txn *volatile PendingTxn; /**< Transaction to commit at the next
+                                         frame done, NULL if none */
+    XVMix_GetTime GetTime;       /**< Time source, NULL if none */
+    u64 FramePeriod;             /**< Frame period in time source units */
+    u64 LastDoneTime;            /**< Time of the last frame done */
+    XVMix_TxnStats TxnStats;     /**< Transaction statistics */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -469,6 +590,18 @@ typedef struct {
 #define XVMix_IsLayerInterfaceStream(InstancePtr, LayerId) \
  ((InstancePtr)->Mix.Config.LayerIntrfType[LayerId-1] == XVMIX_LAYER_TYPE_STREAM)
 
+/*****************************************************************************/
+/**
+*
+* This macro returns if a submitted transaction is not yet written to the core
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   TRUE(1)/FALSE(0)
+*
+******************************************************************************/
+#define XVMix_IsTxnPending(InstancePtr)  ((InstancePtr)->PendingTxn != NULL)
+
 /**************************** Function Prototypes *****************************/
 int XVMix_Initialize(XV_Mix_l2 *InstancePtr, u16 DeviceId);
 void XVMix_Start(XV_Mix_l2 *InstancePtr);
@@ -480,6 +613,9 @@ void XVMix_SetVidStream(XV_Mix_l2 *InstancePtr,
 int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 int XVMix_IsLayerEnabled(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
+int XVMix_IsWindowValid(const XVidC_VideoStream *Strm,
+                        const XVidC_VideoWindow *Win,
+                        XVMix_Scalefactor Scale);
 void XVMix_SetBackgndColor(XV_Mix_l2 *InstancePtr,
                            XVMix_BackgroundId ColorId,
                            XVidC_ColorDepth  bpc);
@@ -541,6 +677,33 @@ void XVMix_InterruptHandler(void *InstancePtr);
 int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *CallbackRef);
 void XVMix_InterruptEnable(XV_Mix_l2 *InstancePtr);
 void XVMix_InterruptDisable(XV_Mix_l2 *InstancePtr);
+
+/* Transaction related functions */
+void XVMix_TxnInit(XVMix_Txn *TxnPtr);
+void XVMix_TxnLayerEnable(XVMix_Txn *TxnPtr, XVMix_LayerId LayerId);
+void XVMix_TxnLayerDisable(XVMix_Txn *TxnPtr, XVMix_LayerId LayerId);
+void XVMix_TxnSetLayerWindow(XVMix_Txn *TxnPtr,
+                             XVMix_LayerId LayerId,
+                             const XVidC_VideoWindow *Win,
+                             u32 StrideInBytes);
+void XVMix_TxnSetLayerScaleFactor(XVMix_Txn *TxnPtr,
+                                  XVMix_LayerId LayerId,
+                                  XVMix_Scalefactor Scale);
+void XVMix_TxnSetLayerAlpha(XVMix_Txn *TxnPtr,
+                            XVMix_LayerId LayerId,
+                            u16 Alpha);
+void XVMix_TxnSetLayerBufferAddr(XVMix_Txn *TxnPtr,
+                                 XVMix_LayerId LayerId,
+                                 UINTPTR Addr);
+void XVMix_TxnSetLayerChromaBufferAddr(XVMix_Txn *TxnPtr,
+                                       XVMix_LayerId LayerId,
+                                       UINTPTR Addr);
+int XVMix_TxnSubmit(XV_Mix_l2 *InstancePtr, XVMix_Txn *TxnPtr);
+void XVMix_TxnFrameDone(XV_Mix_l2 *InstancePtr);
+void XVMix_TxnSetTimeSource(XV_Mix_l2 *InstancePtr,
+                            XVMix_GetTime GetTime,
+                            u64 FramePeriod);
+void XVMix_TxnGetStats(XV_Mix_l2 *InstancePtr, XVMix_TxnStats *StatsPtr);
 static void XVMix_SetCoeffForYuvToRgb(XV_Mix_l2 *InstancePtr,
 		XVidC_ColorStd colorStandard,
 		XVidC_ColorRange colorRange,
@@ -20,6 +20,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+* 6.30  ag    10/19/26   Write the pending transaction before the user call back
 *
 * </pre>
 *
@@ -65,8 +66,8 @@ int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *Callback
 * This function is the interrupt handler for the mixer core driver.
 *
 * This handler clears the pending interrupt and determined if the source is
-* frame done signal. If yes, starts the next frame processing and calls the
-* registered callback function
+* frame done signal. If yes, writes the pending transaction, calls the
+* registered callback function and starts the next frame processing
 *
 * The application is responsible for connecting this function to the interrupt
 * system. Application beyond this driver is also responsible for providing
@@ -98,6 +99,9 @@ void XVMix_InterruptHandler(void *InstancePtr)
 
   /* Check for Done Signal */
   if(Status & XVMIX_IRQ_DONE_MASK) {
+    //Write the submitted layer updates while the core is idle
+    XVMix_TxnFrameDone(MixPtr);
+
     //Call user registered callback function, if any
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
@@ -0,0 +1,762 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_mix_l2_txn.c
+* @addtogroup v_mix_v6_3
+* @{
+*
+* The functions in this file stage layer settings in a transaction, validate
+* them and write them to the core at frame done. See xv_mix_l2.h for a
+* detailed description of the transactions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.30  ag    10/19/26   Initial Release
+*                        Update the layer settings of the instance at commit
+*                        and enable all layers with
+*                        XVMIX_MASK_ENABLE_ALL_LAYERS
+*                        Return the error codes of the layer APIs for
+*                        layers or scaling not available in HW
+*                        Write the upper 32 bits of the buffer addresses
+*                        Update the layer enable register at frame done
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_mix_l2.h"
+#if !defined (__MICROBLAZE__) && !defined (__linux__)
+#include "xpseudo_asm.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#define XVMIX_TXN_LOGO_INDEX            (XVMIX_TXN_NUM_LAYERS - 1)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/*
+ * Orders the writes of a transaction before its publication to the interrupt
+ * handler, which may run on another processor
+ */
+#if defined (__MICROBLAZE__)
+#define XVMIX_TXN_BARRIER()
+#elif defined (__linux__)
+#define XVMIX_TXN_BARRIER()             __sync_synchronize()
+#else
+#define XVMIX_TXN_BARRIER()             dmb()
+#endif
+
+/************************** Function Prototypes ******************************/
+static XVMix_TxnLayer *GetTxnLayer(XVMix_Txn *TxnPtr, XVMix_LayerId LayerId);
+static void AddWrite(XVMix_Txn *TxnPtr, u32 Offset, u32 Data);
+static int CheckWindow(XV_Mix_l2 *InstancePtr,
+                       XVMix_LayerId LayerId,
+                       const XVMix_TxnLayer *LayerPtr);
+static int AddLayerWrites(XV_Mix_l2 *InstancePtr,
+                          XVMix_Txn *TxnPtr,
+                          XVMix_LayerId LayerId);
+static int AddLogoWrites(XV_Mix_l2 *InstancePtr, XVMix_Txn *TxnPtr);
+
+/*****************************************************************************/
+/**
+* This function returns the staged settings of a layer
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the overlay or logo layer
+*
+* @return Pointer to the layer settings
+*
+******************************************************************************/
+static XVMix_TxnLayer *GetTxnLayer(XVMix_Txn *TxnPtr, XVMix_LayerId LayerId)
+{
+  Xil_AssertNonvoid(TxnPtr != NULL);
+  Xil_AssertNonvoid(((LayerId > XVMIX_LAYER_MASTER) &&
+                     (LayerId <= XV_MIX_MAX_MEMORY_LAYERS)) ||
+                    (LayerId == XVMIX_LAYER_LOGO));
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+    return(&TxnPtr->Layer[XVMIX_TXN_LOGO_INDEX]);
+  }
+  return(&TxnPtr->Layer[LayerId-1]);
+}
+
+/*****************************************************************************/
+/**
+* This function appends a register write to the transaction
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  Offset is the register offset
+* @param  Data is the register value
+*
+* @return None
+*
+******************************************************************************/
+static void AddWrite(XVMix_Txn *TxnPtr, u32 Offset, u32 Data)
+{
+  u32 Index = TxnPtr->NumWrites;
+
+  Xil_AssertVoid(Index < XVMIX_TXN_MAX_WRITES);
+
+  TxnPtr->Writes[Index].Offset = Offset;
+  TxnPtr->Writes[Index].Data   = Data;
+  TxnPtr->NumWrites = Index + 1;
+}
+
+/*****************************************************************************/
+/**
+* This function validates the window of a layer with its scale factor, both
+* taken from the transaction if staged, else from the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the overlay or logo layer
+* @param  LayerPtr is the staged layer settings
+*
+* @return XST_SUCCESS if the window is valid else error code with reason
+*
+******************************************************************************/
+static int CheckWindow(XV_Mix_l2 *InstancePtr,
+                       XVMix_LayerId LayerId,
+                       const XVMix_TxnLayer *LayerPtr)
+{
+  XVidC_VideoWindow Win;
+  XVMix_Scalefactor Scale;
+  u32 PixPerClk;
+  int Status;
+
+  if(LayerPtr->Changed & XVMIX_TXN_WINDOW) {
+    Win = LayerPtr->Win;
+    PixPerClk = InstancePtr->Mix.Config.PixPerClk;
+    if(((Win.StartX % PixPerClk) != 0) || ((Win.Width % PixPerClk) != 0)) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+    }
+  } else {
+    Status = XVMix_GetLayerWindow(InstancePtr, LayerId, &Win);
+    if(Status != XST_SUCCESS) {
+      return(Status);
+    }
+  }
+
+  if(LayerPtr->Changed & XVMIX_TXN_SCALE) {
+    Scale = LayerPtr->Scale;
+  } else {
+    Scale = (XVMix_Scalefactor)XVMix_GetLayerScaleFactor(InstancePtr, LayerId);
+  }
+
+  if(!XVMix_IsWindowValid(&InstancePtr->Stream, &Win, Scale)) {
+    return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function validates the staged settings of an overlay layer and
+* appends its register writes to the transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the overlay layer
+*
+* @return XST_SUCCESS if the settings are valid else error code with reason
+*
+******************************************************************************/
+static int AddLayerWrites(XV_Mix_l2 *InstancePtr,
+                          XVMix_Txn *TxnPtr,
+                          XVMix_LayerId LayerId)
+{
+  XV_mix *MixPtr = &InstancePtr->Mix;
+  const XVMix_TxnLayer *LayerPtr = GetTxnLayer(TxnPtr, LayerId);
+  u32 Changed = LayerPtr->Changed;
+  u32 Offset = LayerId*XVMIX_REG_OFFSET;
+  u32 BufOffset = (LayerId-1)*XVMIX_REG_OFFSET;
+  UINTPTR Align;
+  int Status;
+
+  /* Same error codes as the layer APIs */
+  if(LayerId >= XVMix_GetNumLayers(InstancePtr)) {
+    if(Changed & (XVMIX_TXN_WINDOW | XVMIX_TXN_ALPHA | XVMIX_TXN_SCALE)) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+    }
+    return(XST_FAILURE);
+  }
+
+  if((Changed & XVMIX_TXN_ALPHA) &&
+     !XVMix_IsAlphaEnabled(InstancePtr, LayerId)) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+  if((Changed & XVMIX_TXN_SCALE) &&
+     !XVMix_IsScalingEnabled(InstancePtr, LayerId)) {
+    return(XST_FAILURE);
+  }
+
+  /* Check if stride and addresses are aligned to aximm width (2*PPC*32-bits) */
+  Align = 2 * MixPtr->Config.PixPerClk * 4;
+
+  if(Changed & (XVMIX_TXN_WINDOW | XVMIX_TXN_SCALE)) {
+    Status = CheckWindow(InstancePtr, LayerId, LayerPtr);
+    if(Status != XST_SUCCESS) {
+      return(Status);
+    }
+  }
+
+  if(Changed & XVMIX_TXN_WINDOW) {
+    if(!((LayerPtr->Win.Width  > (XVMIX_MIN_STRM_WIDTH-1))  &&
+         (LayerPtr->Win.Height > (XVMIX_MIN_STRM_HEIGHT-1)) &&
+         (LayerPtr->Win.Width  < MixPtr->Config.LayerMaxWidth[LayerId-1]) &&
+         (LayerPtr->Win.Height <= MixPtr->Config.MaxHeight))) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+    }
+    if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId) &&
+       ((LayerPtr->StrideInBytes % Align) != 0)) {
+      return(XVMIX_ERR_WIN_STRIDE_MISALIGNED);
+    }
+  }
+
+  if(((Changed & XVMIX_TXN_BUFADDR) && ((LayerPtr->BufAddr % Align) != 0)) ||
+     ((Changed & XVMIX_TXN_CHROMA_BUFADDR) &&
+      ((LayerPtr->ChromaBufAddr % Align) != 0))) {
+    return(XVMIX_ERR_MEM_ADDR_MISALIGNED);
+  }
+
+  if(Changed & XVMIX_TXN_WINDOW) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA+Offset,
+             LayerPtr->Win.StartX);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA+Offset,
+             LayerPtr->Win.StartY);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA+Offset,
+             LayerPtr->Win.Width);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA+Offset,
+             LayerPtr->Win.Height);
+    if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
+      AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA+Offset,
+               LayerPtr->StrideInBytes);
+    }
+  }
+  if(Changed & XVMIX_TXN_ALPHA) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA+Offset,
+             LayerPtr->Alpha);
+  }
+  if(Changed & XVMIX_TXN_SCALE) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA+Offset,
+             LayerPtr->Scale);
+  }
+  if(Changed & XVMIX_TXN_BUFADDR) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA+BufOffset,
+             (u32)LayerPtr->BufAddr);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA+BufOffset+4,
+             (u32)((u64)LayerPtr->BufAddr >> 32));
+  }
+  if(Changed & XVMIX_TXN_CHROMA_BUFADDR) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA+BufOffset,
+             (u32)LayerPtr->ChromaBufAddr);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA+BufOffset+4,
+             (u32)((u64)LayerPtr->ChromaBufAddr >> 32));
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function validates the staged settings of the logo layer and appends
+* its register writes to the transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  TxnPtr is a pointer to the transaction
+*
+* @return XST_SUCCESS if the settings are valid else error code with reason
+*
+******************************************************************************/
+static int AddLogoWrites(XV_Mix_l2 *InstancePtr, XVMix_Txn *TxnPtr)
+{
+  XV_mix *MixPtr = &InstancePtr->Mix;
+  const XVMix_TxnLayer *LayerPtr = GetTxnLayer(TxnPtr, XVMIX_LAYER_LOGO);
+  u32 Changed = LayerPtr->Changed;
+  int Status;
+
+  if(!XVMix_IsLogoEnabled(InstancePtr)) {
+    return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  if(Changed & (XVMIX_TXN_WINDOW | XVMIX_TXN_SCALE)) {
+    Status = CheckWindow(InstancePtr, XVMIX_LAYER_LOGO, LayerPtr);
+    if(Status != XST_SUCCESS) {
+      return(Status);
+    }
+  }
+
+  if(Changed & XVMIX_TXN_WINDOW) {
+    if(!((LayerPtr->Win.Width  > (XVMIX_MIN_LOGO_WIDTH-1))  &&
+         (LayerPtr->Win.Height > (XVMIX_MIN_LOGO_HEIGHT-1)) &&
+         (LayerPtr->Win.Width  <= MixPtr->Config.MaxLogoWidth) &&
+         (LayerPtr->Win.Height <= MixPtr->Config.MaxLogoHeight))) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+    }
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA,
+             LayerPtr->Win.StartX);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA,
+             LayerPtr->Win.StartY);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA,
+             LayerPtr->Win.Width);
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA,
+             LayerPtr->Win.Height);
+  }
+  if(Changed & XVMIX_TXN_ALPHA) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA, LayerPtr->Alpha);
+  }
+  if(Changed & XVMIX_TXN_SCALE) {
+    AddWrite(TxnPtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA,
+             LayerPtr->Scale);
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function clears all staged settings of a transaction
+*
+* @param  TxnPtr is a pointer to the transaction
+*
+* @return None
+*
+* @note   A submitted transaction can be cleared once it is no longer pending
+*
+******************************************************************************/
+void XVMix_TxnInit(XVMix_Txn *TxnPtr)
+{
+  Xil_AssertVoid(TxnPtr != NULL);
+
+  memset((void *)TxnPtr, 0, sizeof(XVMix_Txn));
+}
+
+/*****************************************************************************/
+/**
+* This function stages the enable of the specified layer
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is layer number to be enabled
+*
+* @return None
+*
+* @note   To enable all layers use layer id  XVMIX_LAYER_ALL
+*
+******************************************************************************/
+void XVMix_TxnLayerEnable(XVMix_Txn *TxnPtr, XVMix_LayerId LayerId)
+{
+  Xil_AssertVoid(TxnPtr != NULL);
+  Xil_AssertVoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                 (LayerId < XVMIX_LAYER_LAST));
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    TxnPtr->EnableSet   = XVMIX_MASK_ENABLE_ALL_LAYERS;
+    TxnPtr->EnableClear = 0;
+  } else {
+    TxnPtr->EnableLayers |= (1U<<LayerId);
+    TxnPtr->EnableSet    |= (1U<<LayerId);
+    TxnPtr->EnableClear  &= ~(1U<<LayerId);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function stages the disable of the specified layer
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is layer number to be disabled
+*
+* @return None
+*
+* @note   To disable all layers use layer id  XVMIX_LAYER_ALL
+*
+******************************************************************************/
+void XVMix_TxnLayerDisable(XVMix_Txn *TxnPtr, XVMix_LayerId LayerId)
+{
+  Xil_AssertVoid(TxnPtr != NULL);
+  Xil_AssertVoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                 (LayerId < XVMIX_LAYER_LAST));
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    TxnPtr->EnableSet   = 0;
+    TxnPtr->EnableClear = XVMIX_MASK_ENABLE_ALL_LAYERS;
+  } else {
+    TxnPtr->EnableLayers |= (1U<<LayerId);
+    TxnPtr->EnableSet    &= ~(1U<<LayerId);
+    TxnPtr->EnableClear  |= (1U<<LayerId);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function stages the window coordinates of the specified layer. See
+* XVMix_SetLayerWindow() for the parameters.
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the layer for which window coordinates are to be set
+* @param  Win is the window coordinates in pixels
+* @param  StrideInBytes is the stride of the requested window
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+void XVMix_TxnSetLayerWindow(XVMix_Txn *TxnPtr,
+                             XVMix_LayerId LayerId,
+                             const XVidC_VideoWindow *Win,
+                             u32 StrideInBytes)
+{
+  XVMix_TxnLayer *LayerPtr;
+
+  Xil_AssertVoid(Win != NULL);
+
+  LayerPtr = GetTxnLayer(TxnPtr, LayerId);
+  LayerPtr->Win = *Win;
+  LayerPtr->StrideInBytes = StrideInBytes;
+  LayerPtr->Changed |= XVMIX_TXN_WINDOW;
+}
+
+/*****************************************************************************/
+/**
+* This function stages the scaling factor of the specified layer
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the layer to be updated
+* @param  Scale is the scale factor
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+void XVMix_TxnSetLayerScaleFactor(XVMix_Txn *TxnPtr,
+                                  XVMix_LayerId LayerId,
+                                  XVMix_Scalefactor Scale)
+{
+  XVMix_TxnLayer *LayerPtr;
+
+  Xil_AssertVoid((Scale >= XVMIX_SCALE_FACTOR_1X) &&
+                 (Scale <= XVMIX_SCALE_FACTOR_4X));
+
+  LayerPtr = GetTxnLayer(TxnPtr, LayerId);
+  LayerPtr->Scale = Scale;
+  LayerPtr->Changed |= XVMIX_TXN_SCALE;
+}
+
+/*****************************************************************************/
+/**
+* This function stages the Alpha level of the specified layer
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the layer to be updated
+* @param  Alpha is the new value
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+void XVMix_TxnSetLayerAlpha(XVMix_Txn *TxnPtr,
+                            XVMix_LayerId LayerId,
+                            u16 Alpha)
+{
+  XVMix_TxnLayer *LayerPtr;
+
+  Xil_AssertVoid(Alpha <= XVMIX_ALPHA_MAX);
+
+  LayerPtr = GetTxnLayer(TxnPtr, LayerId);
+  LayerPtr->Alpha = Alpha;
+  LayerPtr->Changed |= XVMIX_TXN_ALPHA;
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of buffer in memory
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16
+*
+******************************************************************************/
+void XVMix_TxnSetLayerBufferAddr(XVMix_Txn *TxnPtr,
+                                 XVMix_LayerId LayerId,
+                                 UINTPTR Addr)
+{
+  XVMix_TxnLayer *LayerPtr;
+
+  Xil_AssertVoid(LayerId != XVMIX_LAYER_LOGO);
+  Xil_AssertVoid(Addr != 0);
+
+  LayerPtr = GetTxnLayer(TxnPtr, LayerId);
+  LayerPtr->BufAddr = Addr;
+  LayerPtr->Changed |= XVMIX_TXN_BUFADDR;
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer for the UV
+* plane for semi-planar formats
+*
+* @param  TxnPtr is a pointer to the transaction
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of second buffer in memory
+*
+* @return None
+*
+* @note   Applicable only for Layer1-16
+*
+******************************************************************************/
+void XVMix_TxnSetLayerChromaBufferAddr(XVMix_Txn *TxnPtr,
+                                       XVMix_LayerId LayerId,
+                                       UINTPTR Addr)
+{
+  XVMix_TxnLayer *LayerPtr;
+
+  Xil_AssertVoid(LayerId != XVMIX_LAYER_LOGO);
+  Xil_AssertVoid(Addr != 0);
+
+  LayerPtr = GetTxnLayer(TxnPtr, LayerId);
+  LayerPtr->ChromaBufAddr = Addr;
+  LayerPtr->Changed |= XVMIX_TXN_CHROMA_BUFADDR;
+}
+
+/*****************************************************************************/
+/**
+* This function validates the staged settings of a transaction, converts
+* them into register writes and submits the transaction to be written at
+* the next frame done
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  TxnPtr is a pointer to the transaction
+*
+* @return XST_SUCCESS if the transaction is submitted
+*         XST_DEVICE_BUSY if a transaction is pending
+*         XST_NOT_ENABLED if the frame done interrupt is disabled
+*         XST_FAILURE if a staged layer enable is not available in HW
+*         else error code of the layer API of the first invalid layer
+*         setting
+*
+* @note   Nothing is submitted if a setting is invalid. The settings of the
+*         layer configuration structure and the layer enable register are
+*         updated when the transaction is written to the core.
+*
+******************************************************************************/
+int XVMix_TxnSubmit(XV_Mix_l2 *InstancePtr, XVMix_Txn *TxnPtr)
+{
+  XV_mix *MixPtr;
+  u32 ValidLayers, Index;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(TxnPtr != NULL);
+  Xil_AssertNonvoid(InstancePtr->Mix.IsReady == XIL_COMPONENT_IS_READY);
+
+  MixPtr = &InstancePtr->Mix;
+
+  if(InstancePtr->PendingTxn != NULL) {
+    InstancePtr->TxnStats.Busy++;
+    return(XST_DEVICE_BUSY);
+  }
+
+  /* Transactions are written by the interrupt handler */
+  if(!(XV_mix_InterruptGetEnabled(MixPtr) & XVMIX_IRQ_DONE_MASK)) {
+    return(XST_NOT_ENABLED);
+  }
+
+  ValidLayers = (1U<<XVMix_GetNumLayers(InstancePtr)) - 1;
+  if(XVMix_IsLogoEnabled(InstancePtr)) {
+    ValidLayers |= (1U<<XVMIX_LAYER_LOGO);
+  }
+  if(TxnPtr->EnableLayers & ~ValidLayers) {
+    return(XST_FAILURE);
+  }
+
+  TxnPtr->NumWrites = 0;
+  for(Index = 0; Index < XVMIX_TXN_NUM_LAYERS; Index++) {
+    if(TxnPtr->Layer[Index].Changed == 0) {
+      continue;
+    }
+
+    if(Index == XVMIX_TXN_LOGO_INDEX) {
+      Status = AddLogoWrites(InstancePtr, TxnPtr);
+    } else {
+      Status = AddLayerWrites(InstancePtr, TxnPtr,
+                              (XVMix_LayerId)(Index+1));
+    }
+    if(Status != XST_SUCCESS) {
+      return(Status);
+    }
+  }
+
+  if(InstancePtr->GetTime != NULL) {
+    TxnPtr->SubmitTime = InstancePtr->GetTime();
+  }
+  InstancePtr->TxnStats.Submitted++;
+
+  /* The writes must be visible before the transaction */
+  XVMIX_TXN_BARRIER();
+  InstancePtr->PendingTxn = TxnPtr;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function writes the pending transaction to the core, updates the
+* layer configuration structure and updates the frame done timing. It is
+* called by XVMix_InterruptHandler() at frame done, before the next frame is
+* started.
+*
+* The layer enable register is read and updated here rather than at the
+* submit, so the layers enabled or disabled with the layer APIs while the
+* transaction is pending keep their state, unless the transaction stages it.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_TxnFrameDone(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Txn *TxnPtr;
+  XVMix_TxnStats *StatsPtr;
+  XVMix_TxnLayer *LayerPtr;
+  XVMix_LayerId LayerId;
+  UINTPTR BaseAddress;
+  u64 Now = 0;
+  u64 Period, Interval, Latency;
+  u32 Index, NumWrites, Enable;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  StatsPtr = &InstancePtr->TxnStats;
+  Period = InstancePtr->FramePeriod;
+
+  if(InstancePtr->GetTime != NULL) {
+    Now = InstancePtr->GetTime();
+    if((Period != 0) && (InstancePtr->LastDoneTime != 0)) {
+      Interval = Now - InstancePtr->LastDoneTime;
+      if(Interval > (Period + (Period / 2))) {
+        StatsPtr->MissedVblanks +=
+                        (u32)(((Interval + (Period / 2)) / Period) - 1);
+      }
+    }
+    InstancePtr->LastDoneTime = Now;
+  }
+
+  TxnPtr = InstancePtr->PendingTxn;
+  if(TxnPtr == NULL) {
+    return;
+  }
+  XVMIX_TXN_BARRIER();
+
+  BaseAddress = InstancePtr->Mix.Config.BaseAddress;
+  NumWrites = TxnPtr->NumWrites;
+  for(Index = 0; Index < NumWrites; Index++) {
+    XV_mix_WriteReg(BaseAddress, TxnPtr->Writes[Index].Offset,
+                    TxnPtr->Writes[Index].Data);
+  }
+
+  /* Layers are enabled last, with their new settings */
+  if(TxnPtr->EnableSet | TxnPtr->EnableClear) {
+    Enable = XV_mix_ReadReg(BaseAddress,
+                            XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
+    Enable = (Enable & ~TxnPtr->EnableClear) | TxnPtr->EnableSet;
+    XV_mix_WriteReg(BaseAddress, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA,
+                    Enable);
+    NumWrites++;
+  }
+
+  /* The layer settings follow the registers */
+  for(Index = 0; Index < XVMIX_TXN_LOGO_INDEX; Index++) {
+    LayerId = (XVMix_LayerId)(Index+1);
+    LayerPtr = &TxnPtr->Layer[Index];
+    if(LayerId >= XVMIX_MAX_SUPPORTED_LAYERS) {
+      break;
+    }
+    if(LayerPtr->Changed & XVMIX_TXN_WINDOW) {
+      InstancePtr->Layer[LayerId].Win = LayerPtr->Win;
+    }
+    if(LayerPtr->Changed & XVMIX_TXN_BUFADDR) {
+      InstancePtr->Layer[LayerId].BufAddr = LayerPtr->BufAddr;
+    }
+    if(LayerPtr->Changed & XVMIX_TXN_CHROMA_BUFADDR) {
+      InstancePtr->Layer[LayerId].ChromaBufAddr = LayerPtr->ChromaBufAddr;
+    }
+  }
+
+  StatsPtr->Committed++;
+  if(NumWrites > StatsPtr->MaxWrites) {
+    StatsPtr->MaxWrites = NumWrites;
+  }
+  if(InstancePtr->GetTime != NULL) {
+    Latency = Now - TxnPtr->SubmitTime;
+    if(Latency < StatsPtr->LatencyMin) {
+      StatsPtr->LatencyMin = Latency;
+    }
+    if(Latency > StatsPtr->LatencyMax) {
+      StatsPtr->LatencyMax = Latency;
+    }
+    StatsPtr->LatencyTotal += Latency;
+  }
+
+  /* The transaction must be read before it can be reused */
+  XVMIX_TXN_BARRIER();
+  InstancePtr->PendingTxn = NULL;
+}
+
+/*****************************************************************************/
+/**
+* This function sets the time source of the transaction statistics and
+* clears the statistics
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  GetTime is the time source, or NULL to stop the time measurements
+* @param  FramePeriod is the frame period in time source units, or 0 to not
+*         count the missed vblanks
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_TxnSetTimeSource(XV_Mix_l2 *InstancePtr,
+                            XVMix_GetTime GetTime,
+                            u64 FramePeriod)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->GetTime = GetTime;
+  InstancePtr->FramePeriod = FramePeriod;
+  InstancePtr->LastDoneTime = 0;
+  memset(&InstancePtr->TxnStats, 0, sizeof(XVMix_TxnStats));
+  InstancePtr->TxnStats.LatencyMin = ~(u64)0;
+}
+
+/*****************************************************************************/
+/**
+* This function copies the transaction statistics. The average latency is
+* LatencyTotal / Committed.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  StatsPtr is a pointer to the copy
+*
+* @return None
+*
+******************************************************************************/
+void XVMix_TxnGetStats(XV_Mix_l2 *InstancePtr, XVMix_TxnStats *StatsPtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(StatsPtr != NULL);
+
+  memcpy(StatsPtr, &InstancePtr->TxnStats, sizeof(XVMix_TxnStats));
+}
+/** @} */
@@ -105,6 +105,8 @@ typedef struct {
     XVMultiScaler_Callback FrameDoneCallback;
     void *CallbackRef;
     u8 OutBitMask;
+    const short *VCoeff[XV_MAX_OUTS]; /* Vertical table programmed per channel */
+    const short *HCoeff[XV_MAX_OUTS]; /* Horizontal table programmed per channel */
 } XV_multi_scaler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -420,13 +420,17 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
 
 	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
+	/* Skip the upload if the table is already programmed for this channel */
+	if (coeff != MscPtr->VCoeff[MS_cfg->ChannelId]) {
+		for (i = 0; i < num_phases; i++) {
+			for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
+				val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
+					(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
+				XV_multi_scaler_WriteReg(baseAddr,
+						((i * num_taps + j / 2) * 4), val);
+			}
 		}
+		MscPtr->VCoeff[MS_cfg->ChannelId] = coeff;
 	}
 
 	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
@@ -482,13 +486,17 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
 
 	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
+	/* Skip the upload if the table is already programmed for this channel */
+	if (coeff != MscPtr->HCoeff[MS_cfg->ChannelId]) {
+		for (i = 0; i < num_phases; i++) {
+			for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
+				val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
+					(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
+				XV_multi_scaler_WriteReg(baseAddr,
+						((i * num_taps + j / 2) * 4), val);
+			}
 		}
+		MscPtr->HCoeff[MS_cfg->ChannelId] = coeff;
 	}
 }
 
@@ -690,4 +698,27 @@ void XV_MultiScalerSetChannelConfig(XV_multi_scaler *InstancePtr,
 	XV_MS_Set_DstImgBuf0[i](InstancePtr, MS_cfg->DstImgBuf0);
 	XV_MS_Set_DstImgBuf1[i](InstancePtr, MS_cfg->DstImgBuf1);
 }
+
+/*****************************************************************************/
+/**
+* This function makes the next XV_MultiScalerSetChannelConfig program the
+* filter coefficients of every channel into the core. It must be called if the
+* core register bank may have lost its content, e.g. after a reset of the IP.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerInvalidateCoeff(XV_multi_scaler *InstancePtr)
+{
+	u32 i;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (i = 0; i < XV_MAX_OUTS; i++) {
+		InstancePtr->VCoeff[i] = NULL;
+		InstancePtr->HCoeff[i] = NULL;
+	}
+}
 /** @} */
@@ -27,6 +27,9 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   ag    10/19/26   Skip upload of unchanged coefficients
+*       ag    10/19/26   Added XV_VScalerGetCoeffTable for the software
+*                        scaler
 *
 * </pre>
 *
@@ -59,10 +62,10 @@ extern const short XV_vscaler_fixedcoeff_taps10_ScalingRatio4[XV_VSCALER_MAX_V_P
 extern const short XV_vscaler_fixedcoeff_taps12_ScalingRatio4[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_12];
 
 /************************** Function Prototypes ******************************/
+
 static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 		                          u32 HeightIn,
 		                          u32 HeightOut);
-
 static void XV_VScalerSetCoeff(XV_Vscaler_l2 *VscPtr);
 
 /*****************************************************************************/
@@ -123,31 +126,32 @@ void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr)
 
 /*****************************************************************************/
 /**
-* This function loads default filter coefficients in the scaler coefficient
-* storage based on the selected TAP configuration
+* This function returns the internal coefficient table used for the scaling
+* ratio. The core instance is not modified.
 *
 * @param  InstancePtr is a pointer to the core instance to be worked on.
-* @param  WidthIn is the input stream height
-* @param  Widthout is the output stream height
-
-* @return None
+* @param  HeightIn is the input stream height
+* @param  HeightOut is the output stream height
+* @param  NumTapsPtr receives the number of taps of the table
+*
+* @return Pointer to the table, NumTaps coefficients per phase, or NULL if
+*         the core taps configuration is not supported
 *
 ******************************************************************************/
-static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
-		                          u32 HeightIn,
-		                          u32 HeightOut)
+const short *XV_VScalerGetCoeffTable(XV_Vscaler_l2 *InstancePtr,
+                                     u32 HeightIn,
+                                     u32 HeightOut,
+                                     u16 *NumTapsPtr)
 {
   const short *coeff;
-  u16 numTaps, numPhases;
   u16 ScalingRatio;
   u16 IsScaleDown;
 
   /*
    * validates input arguments
    */
-  Xil_AssertVoid(InstancePtr != NULL);
-
-  numPhases = (1<<InstancePtr->Vsc.Config.PhaseShift);
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(NumTapsPtr != NULL);
 
   IsScaleDown = (HeightOut < HeightIn);
   /* Scale Down Mode will use dynamic filter selection logic
@@ -162,75 +166,116 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 	case XV_VSCALER_TAPS_6:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		} else {// <= 1.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		}
 	break;
 
 	case XV_VSCALER_TAPS_8:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
+			*NumTapsPtr = XV_VSCALER_TAPS_8;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
+			*NumTapsPtr = XV_VSCALER_TAPS_8;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
+			*NumTapsPtr = XV_VSCALER_TAPS_8;
 		} else {// <= 1.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		}
 	break;
 
 	case XV_VSCALER_TAPS_10:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps10_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_10;
+			*NumTapsPtr = XV_VSCALER_TAPS_10;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_10;
+			*NumTapsPtr = XV_VSCALER_TAPS_10;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
+			*NumTapsPtr = XV_VSCALER_TAPS_8;
 		} else {// <= 1.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		}
 	break;
 
 	case XV_VSCALER_TAPS_12:
 		if (ScalingRatio > 35) {// > 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps12_ScalingRatio4[0][0];
-			numTaps = XV_VSCALER_TAPS_12;
+			*NumTapsPtr = XV_VSCALER_TAPS_12;
 		} else if (ScalingRatio > 25) {//2.6 < Ratio <= 3.5
 			coeff = &XV_vscaler_fixedcoeff_taps10_ScalingRatio3[0][0];
-			numTaps = XV_VSCALER_TAPS_10;
+			*NumTapsPtr = XV_VSCALER_TAPS_10;
 		} else if (ScalingRatio > 15) {//1.6 < Ratio <= 2.5
 			coeff = &XV_vscaler_fixedcoeff_taps8_ScalingRatio2[0][0];
-			numTaps = XV_VSCALER_TAPS_8;
+			*NumTapsPtr = XV_VSCALER_TAPS_8;
 		} else {// <= 1.5
 			coeff = &XV_vscaler_fixedcoeff_taps6_ScalingRatio1p2[0][0];
-			numTaps = XV_VSCALER_TAPS_6;
+			*NumTapsPtr = XV_VSCALER_TAPS_6;
 		}
 	break;
 
 	default:
-		return;
+		return(NULL);
 	}
   }
   else //Scale Up
   {
 	coeff = &XV_vscaler_Lanczos2_taps6[0][0];
-	numTaps = XV_VSCALER_TAPS_6;
+	*NumTapsPtr = XV_VSCALER_TAPS_6;
+  }
+
+  return(coeff);
+}
+
+/*****************************************************************************/
+/**
+* This function loads default filter coefficients in the scaler coefficient
+* storage based on the selected TAP configuration
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+* @param  WidthIn is the input stream height
+* @param  Widthout is the output stream height
+
+* @return None
+*
+******************************************************************************/
+static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
+                                  u32 HeightIn,
+                                  u32 HeightOut)
+{
+  const short *coeff;
+  u16 numTaps, numPhases;
+
+  /*
+   * validate input arguments
+   */
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  numPhases = (1<<InstancePtr->Vsc.Config.PhaseShift);
+
+  coeff = XV_VScalerGetCoeffTable(InstancePtr, HeightIn, HeightOut, &numTaps);
+  if(coeff == NULL)
+  {
+    return;
+  }
+
+  /* Table already copied, no need to copy and upload it again */
+  if(coeff == InstancePtr->CoeffTable)
+  {
+    return;
   }
 
   XV_VScalerLoadExtCoeff(InstancePtr,
@@ -240,6 +285,7 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffTable = coeff;
 }
 
 /*****************************************************************************/
@@ -314,6 +360,8 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffTable = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
 }
 
 /*****************************************************************************/
@@ -398,7 +446,11 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
     }
 
     /* Program coefficients into the IP register bank */
-    XV_VScalerSetCoeff(InstancePtr);
+    if(!InstancePtr->CoeffLoaded)
+    {
+      XV_VScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = TRUE;
+    }
   }
 
   LineRate = (HeightIn * STEP_PRECISION)/HeightOut;
@@ -412,6 +464,24 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
   return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function makes the next XV_VScalerSetup program the coefficients into
+* the core. It must be called if the core register bank may have lost its
+* content, e.g. after a reset of the IP.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerInvalidateCache(XV_Vscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffLoaded = FALSE;
+}
+
 /*****************************************************************************/
 /**
 *
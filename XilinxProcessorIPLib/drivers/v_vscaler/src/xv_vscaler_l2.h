@@ -69,6 +69,8 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   ag    10/19/26   Skip upload of unchanged coefficients
+*       ag    10/19/26   Added XV_VScalerGetCoeffTable
 *
 * </pre>
 *
@@ -124,6 +126,8 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  const short *CoeffTable; /*<< Fixed table copied in coeff, NULL if none */
+  u8 CoeffLoaded;          /*<< coeff is programmed in the core */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -144,6 +148,10 @@ typedef struct
 int XV_VScalerInitialize(XV_Vscaler_l2 *InstancePtr, u16 DeviceId);
 void XV_VScalerStart(XV_Vscaler_l2 *InstancePtr);
 void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr);
+const short *XV_VScalerGetCoeffTable(XV_Vscaler_l2 *InstancePtr,
+                                     u32 HeightIn,
+                                     u32 HeightOut,
+                                     u16 *NumTapsPtr);
 void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
@@ -154,6 +162,7 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32 HeightOut,
                     u32 ColorFormat);
 void XV_VScalerDbgReportStatus(XV_Vscaler_l2 *InstancePtr);
+void XV_VScalerInvalidateCache(XV_Vscaler_l2 *InstancePtr);
 
 #ifdef __cplusplus
 }
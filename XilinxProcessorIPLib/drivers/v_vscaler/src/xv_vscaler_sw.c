@@ -0,0 +1,408 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_vscaler_sw.c
+* @addtogroup v_vscaler_v3_2
+* @{
+* @details
+*
+* The software vertical scaler. See xv_vscaler_sw.h for the processing
+* model.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.2   ag    10/19/26   First release
+*       ag    10/19/26   Copy the coefficients without changing the core
+*                        instance
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xv_vscaler_sw.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define XV_VSCALER_SW_NEON
+#endif
+
+/************************** Constant Definitions *****************************/
+#define XV_VSCALER_SW_STEP_SHIFT    (16) /* Fraction bits of LineRate */
+#define XV_VSCALER_SW_STEP_MASK     ((1U << XV_VSCALER_SW_STEP_SHIFT) - 1)
+#define XV_VSCALER_SW_COEFF_SHIFT   (12) /* Fraction bits of coefficients */
+
+/************************** Function Prototypes ******************************/
+static const s32 *XV_VScalerSwWindow(const XV_VScalerSw *SwPtr,
+                                     const u16 *In,
+                                     u32 InStride,
+                                     u32 Line,
+                                     const u16 **Rows);
+static u16 XV_VScalerSwClip(const XV_VScalerSw *SwPtr, s32 Acc);
+static void XV_VScalerSwLineRef(const XV_VScalerSw *SwPtr,
+                                const u16 **Rows,
+                                const s32 *CoeffPtr,
+                                u32 First,
+                                u16 *Out);
+#ifdef XV_VSCALER_SW_NEON
+static void XV_VScalerSwLineNeon(const XV_VScalerSw *SwPtr,
+                                 const u16 **Rows,
+                                 const s32 *CoeffPtr,
+                                 u16 *Out);
+#endif
+
+/*****************************************************************************/
+/**
+* This function initializes a software scaler context for the given frame
+* heights. If no user coefficients were loaded with XV_VScalerLoadExtCoeff(),
+* the coefficient table for the scaling ratio is selected as done by
+* XV_VScalerSetup(). The core instance is not modified.
+*
+* @param  InstancePtr is a pointer to the core instance whose configuration
+*         and coefficients are used
+* @param  SwPtr is a pointer to the context to initialize
+* @param  Width is the line width
+* @param  HeightIn is the input frame height
+* @param  HeightOut is the output frame height
+* @param  NumComps is the number of interleaved components of a pixel
+* @param  BitsPerComp is the number of bits of a component, 8 to 16
+*
+* @return XST_SUCCESS if the context is initialized
+*         XST_FAILURE if the core is not polyphase or the parameters are not
+*         supported
+*
+******************************************************************************/
+int XV_VScalerSwSetup(XV_Vscaler_l2 *InstancePtr,
+                      XV_VScalerSw *SwPtr,
+                      u32 Width,
+                      u32 HeightIn,
+                      u32 HeightOut,
+                      u16 NumComps,
+                      u16 BitsPerComp)
+{
+  const short *Table = NULL;
+  u16 TableTaps = 0;
+  u32 NumPhases;
+  u32 Offset;
+  u32 i,j;
+
+  /*
+   * Assert validates the input arguments
+   */
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(SwPtr != NULL);
+
+  if((InstancePtr->Vsc.Config.ScalerType != XV_VSCALER_POLYPHASE) ||
+     (Width == 0) || (Width > InstancePtr->Vsc.Config.MaxWidth) ||
+     (HeightIn == 0) || (HeightIn > InstancePtr->Vsc.Config.MaxHeight) ||
+     (HeightOut == 0) || (HeightOut > InstancePtr->Vsc.Config.MaxHeight) ||
+     (NumComps == 0) || (NumComps > XV_VSCALER_SW_MAX_COMPS) ||
+     (BitsPerComp < 8) || (BitsPerComp > 16))
+  {
+    return(XST_FAILURE);
+  }
+
+  if(!InstancePtr->UseExtCoeff) //No user defined coefficients
+  {
+    /* Coefficient table XV_VScalerSetup() would select */
+    Table = XV_VScalerGetCoeffTable(InstancePtr, HeightIn, HeightOut,
+                                    &TableTaps);
+    if(Table == NULL)
+    {
+      return(XST_FAILURE);
+    }
+  }
+
+  SwPtr->Width      = Width;
+  SwPtr->HeightIn   = HeightIn;
+  SwPtr->HeightOut  = HeightOut;
+  SwPtr->LineRate   = (HeightIn << XV_VSCALER_SW_STEP_SHIFT)/HeightOut;
+  SwPtr->NumTaps    = InstancePtr->Vsc.Config.NumTaps;
+  SwPtr->PhaseShift = InstancePtr->Vsc.Config.PhaseShift;
+  SwPtr->NumComps   = NumComps;
+  SwPtr->MaxVal     = (u16)((1U << BitsPerComp) - 1);
+
+  NumPhases = 1U << SwPtr->PhaseShift;
+  memset(SwPtr->Coeff, 0, sizeof(SwPtr->Coeff));
+  if(InstancePtr->UseExtCoeff)
+  {
+    /* Keep the NumTaps center coefficients, as programmed in the core */
+    Offset = (XV_VSCALER_MAX_V_TAPS - SwPtr->NumTaps)/2;
+    for(i=0; i < NumPhases; ++i)
+    {
+      for(j=0; j < SwPtr->NumTaps; ++j)
+      {
+        SwPtr->Coeff[i][j] = InstancePtr->coeff[i][j+Offset];
+      }
+    }
+  }
+  else
+  {
+    /* Center the table in the NumTaps taps, as the core pads it */
+    Offset = (SwPtr->NumTaps - TableTaps)/2;
+    for(i=0; i < NumPhases; ++i)
+    {
+      for(j=0; j < TableTaps; ++j)
+      {
+        SwPtr->Coeff[i][j+Offset] = Table[i*TableTaps+j];
+      }
+    }
+  }
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function scales a stripe of output lines of a frame. In and Out point
+* to the first line of the frames, and output lines LineStart to
+* LineStart + NumLines - 1 are computed. The fastest implementation
+* available is used.
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input frame
+* @param  InStride is the input line stride in samples
+* @param  Out is the output frame
+* @param  OutStride is the output line stride in samples
+* @param  LineStart is the first output line to compute
+* @param  NumLines is the number of output lines to compute
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerSwScale(const XV_VScalerSw *SwPtr,
+                       const u16 *In,
+                       u32 InStride,
+                       u16 *Out,
+                       u32 OutStride,
+                       u32 LineStart,
+                       u32 NumLines)
+{
+  const u16 *Rows[XV_VSCALER_MAX_V_TAPS];
+  const s32 *CoeffPtr;
+  u32 y;
+
+  /*
+   * Assert validates the input arguments
+   */
+  Xil_AssertVoid(SwPtr != NULL);
+  Xil_AssertVoid(In != NULL);
+  Xil_AssertVoid(Out != NULL);
+  Xil_AssertVoid((LineStart + NumLines) <= SwPtr->HeightOut);
+
+  for(y=LineStart; y < (LineStart + NumLines); ++y)
+  {
+    CoeffPtr = XV_VScalerSwWindow(SwPtr, In, InStride, y, Rows);
+#ifdef XV_VSCALER_SW_NEON
+    XV_VScalerSwLineNeon(SwPtr, Rows, CoeffPtr, &Out[y*OutStride]);
+#else
+    XV_VScalerSwLineRef(SwPtr, Rows, CoeffPtr, 0, &Out[y*OutStride]);
+#endif
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function scales a stripe of output lines of a frame with the scalar
+* model. The parameters are the ones of XV_VScalerSwScale().
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input frame
+* @param  InStride is the input line stride in samples
+* @param  Out is the output frame
+* @param  OutStride is the output line stride in samples
+* @param  LineStart is the first output line to compute
+* @param  NumLines is the number of output lines to compute
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerSwScaleRef(const XV_VScalerSw *SwPtr,
+                          const u16 *In,
+                          u32 InStride,
+                          u16 *Out,
+                          u32 OutStride,
+                          u32 LineStart,
+                          u32 NumLines)
+{
+  const u16 *Rows[XV_VSCALER_MAX_V_TAPS];
+  const s32 *CoeffPtr;
+  u32 y;
+
+  /*
+   * Assert validates the input arguments
+   */
+  Xil_AssertVoid(SwPtr != NULL);
+  Xil_AssertVoid(In != NULL);
+  Xil_AssertVoid(Out != NULL);
+  Xil_AssertVoid((LineStart + NumLines) <= SwPtr->HeightOut);
+
+  for(y=LineStart; y < (LineStart + NumLines); ++y)
+  {
+    CoeffPtr = XV_VScalerSwWindow(SwPtr, In, InStride, y, Rows);
+    XV_VScalerSwLineRef(SwPtr, Rows, CoeffPtr, 0, &Out[y*OutStride]);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function finds the input lines and the coefficients of an output line,
+* repeating the edge lines of the frame for the taps outside of it
+*
+* @param  SwPtr is a pointer to the context
+* @param  In is the input frame
+* @param  InStride is the input line stride in samples
+* @param  Line is the output line
+* @param  Rows receives the NumTaps input lines
+*
+* @return Coefficients of the phase
+*
+******************************************************************************/
+static const s32 *XV_VScalerSwWindow(const XV_VScalerSw *SwPtr,
+                                     const u16 *In,
+                                     u32 InStride,
+                                     u32 Line,
+                                     const u16 **Rows)
+{
+  u32 Shift = XV_VSCALER_SW_STEP_SHIFT - SwPtr->PhaseShift;
+  u32 Pos = Line * SwPtr->LineRate;
+  s32 Last = (s32)SwPtr->HeightIn - 1;
+  s32 Start;
+  s32 y;
+  u32 k;
+
+  Start = (s32)(Pos >> XV_VSCALER_SW_STEP_SHIFT) -
+          ((s32)(SwPtr->NumTaps/2) - 1);
+  for(k=0; k < SwPtr->NumTaps; ++k)
+  {
+    y = Start + (s32)k;
+    y = (y < 0) ? 0 : ((y > Last) ? Last : y);
+    Rows[k] = &In[(u32)y*InStride];
+  }
+
+  return(SwPtr->Coeff[(Pos & XV_VSCALER_SW_STEP_MASK) >> Shift]);
+}
+
+/*****************************************************************************/
+/**
+* This function rounds a filter sum and clips it to the component range
+*
+* @param  SwPtr is a pointer to the context
+* @param  Acc is the sum of the coefficients times the pixels
+*
+* @return Output component
+*
+******************************************************************************/
+static u16 XV_VScalerSwClip(const XV_VScalerSw *SwPtr, s32 Acc)
+{
+  Acc = (Acc + (1 << (XV_VSCALER_SW_COEFF_SHIFT-1))) >>
+        XV_VSCALER_SW_COEFF_SHIFT;
+  if(Acc < 0)
+  {
+    return(0);
+  }
+  if(Acc > (s32)SwPtr->MaxVal)
+  {
+    return(SwPtr->MaxVal);
+  }
+  return((u16)Acc);
+}
+
+/*****************************************************************************/
+/**
+* This function computes an output line with the scalar model, from sample
+* First to the end of the line
+*
+* @param  SwPtr is a pointer to the context
+* @param  Rows is the NumTaps input lines
+* @param  CoeffPtr is the coefficients of the phase
+* @param  First is the first sample to compute
+* @param  Out is the output line
+*
+* @return None
+*
+******************************************************************************/
+static void XV_VScalerSwLineRef(const XV_VScalerSw *SwPtr,
+                                const u16 **Rows,
+                                const s32 *CoeffPtr,
+                                u32 First,
+                                u16 *Out)
+{
+  u32 NumSamples = SwPtr->Width * SwPtr->NumComps;
+  s32 Acc;
+  u32 i, k;
+
+  for(i=First; i < NumSamples; ++i)
+  {
+    Acc = 0;
+    for(k=0; k < SwPtr->NumTaps; ++k)
+    {
+      Acc += CoeffPtr[k] * (s32)Rows[k][i];
+    }
+    Out[i] = XV_VScalerSwClip(SwPtr, Acc);
+  }
+}
+
+#ifdef XV_VSCALER_SW_NEON
+/*****************************************************************************/
+/**
+* This function computes an output line with NEON, 8 samples at a time. The
+* samples after the last multiple of 8 are computed with the scalar model.
+*
+* @param  SwPtr is a pointer to the context
+* @param  Rows is the NumTaps input lines
+* @param  CoeffPtr is the coefficients of the phase
+* @param  Out is the output line
+*
+* @return None
+*
+******************************************************************************/
+static void XV_VScalerSwLineNeon(const XV_VScalerSw *SwPtr,
+                                 const u16 **Rows,
+                                 const s32 *CoeffPtr,
+                                 u16 *Out)
+{
+  u32 NumSamples = SwPtr->Width * SwPtr->NumComps;
+  int32x4_t MaxVal = vdupq_n_s32(SwPtr->MaxVal);
+  int32x4_t Zero = vdupq_n_s32(0);
+  int32x4_t AccLo, AccHi, Coeff;
+  uint16x8_t Pix;
+  u32 i, k;
+
+  for(i=0; (i + 8) <= NumSamples; i += 8)
+  {
+    AccLo = Zero;
+    AccHi = Zero;
+    for(k=0; k < SwPtr->NumTaps; ++k)
+    {
+      Pix = vld1q_u16(&Rows[k][i]);
+      Coeff = vdupq_n_s32(CoeffPtr[k]);
+      AccLo = vmlaq_s32(AccLo,
+                        vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(Pix))),
+                        Coeff);
+      AccHi = vmlaq_s32(AccHi,
+                        vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(Pix))),
+                        Coeff);
+    }
+    /* Same rounding and clipping as XV_VScalerSwClip() */
+    AccLo = vminq_s32(vmaxq_s32(vrshrq_n_s32(AccLo,
+                      XV_VSCALER_SW_COEFF_SHIFT), Zero), MaxVal);
+    AccHi = vminq_s32(vmaxq_s32(vrshrq_n_s32(AccHi,
+                      XV_VSCALER_SW_COEFF_SHIFT), Zero), MaxVal);
+    vst1q_u16(&Out[i],
+              vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(AccLo)),
+                           vmovn_u32(vreinterpretq_u32_s32(AccHi))));
+  }
+
+  XV_VScalerSwLineRef(SwPtr, Rows, CoeffPtr, i, Out);
+}
+#endif
+/** @} */
@@ -0,0 +1,121 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xv_vscaler_sw.h
+* @addtogroup v_vscaler_v3_2
+* @{
+* @details
+*
+* This header file contains the software vertical scaler of the V Scaler
+* driver. It scales frames in memory on the processor with the coefficient
+* tables selected by the layer-2 driver for the scaling ratio, and the line
+* rate programmed into the core by XV_VScalerSetup(). It can be used to
+* scale low rate streams (thumbnail, preview) while the core is busy.
+*
+* <b>Processing model</b>
+*
+* Output line j is computed from input line y = (j * LineRate) >> 16 and
+* phase p = ((j * LineRate) & 0xFFFF) >> (16 - PhaseShift), where LineRate
+* = (HeightIn << 16) / HeightOut is the value XV_VScalerSetup() writes to the
+* line rate register of the core. The NumTaps window starts at input line
+* y - (NumTaps/2 - 1). Lines outside the frame repeat the edge line. The sum
+* of the 12-bit fraction coefficients times the pixels is rounded to nearest,
+* shifted by 12 and clipped to the component range.
+*
+* The coefficients and the line rate are those of the core. The window
+* position, the edge lines and the rounding are the model of this driver.
+*
+* Samples are u16, one per component, and the components of a pixel are
+* stored next to each other. A line is Width * NumComps samples and the line
+* stride is in samples.
+*
+* The NEON implementation is used if the compiler targets NEON, else the
+* scalar one. XV_VScalerSwScaleRef() always runs the scalar model, and the
+* two give the same output.
+*
+* <b> Threads </b>
+*
+* XV_VScalerSwSetup() copies the coefficients into the XV_VScalerSw context
+* and only reads the layer-2 instance, so it does not change what
+* XV_VScalerSetup() programs into the core. XV_VScalerSwScale() only reads
+* the context and the input frame, so the output frame can be split in
+* stripes of lines processed at the same time by several threads or
+* processors.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 3.2   ag    10/19/26   First release
+*       ag    10/19/26   Copy the coefficients without changing the core
+*                        instance
+*       ag    10/19/26   Document the line rate shared with the core
+* </pre>
+*
+******************************************************************************/
+#ifndef XV_VSCALER_SW_H        /* prevent circular inclusions */
+#define XV_VSCALER_SW_H        /* by using protection macros  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xv_vscaler_l2.h"
+
+/************************** Constant Definitions *****************************/
+/** Maximum number of interleaved components of a pixel */
+#define XV_VSCALER_SW_MAX_COMPS         (4)
+
+/**************************** Type Definitions *******************************/
+/**
+ * Software V Scaler context, initialized by XV_VScalerSwSetup()
+ */
+typedef struct
+{
+  u32 Width;      /*<< Line width in pixels */
+  u32 HeightIn;   /*<< Input frame height */
+  u32 HeightOut;  /*<< Output frame height */
+  u32 LineRate;   /*<< Input lines per output line, 16 bit fraction */
+  u16 NumTaps;    /*<< Filter taps */
+  u16 PhaseShift; /*<< Number of phases is 2^PhaseShift */
+  u16 NumComps;   /*<< Interleaved components per pixel */
+  u16 MaxVal;     /*<< Largest component value */
+  s32 Coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS]; /*<< NumTaps
+                     coefficients per phase, zero padded */
+}XV_VScalerSw;
+
+/************************** Function Prototypes ******************************/
+int XV_VScalerSwSetup(XV_Vscaler_l2 *InstancePtr,
+                      XV_VScalerSw *SwPtr,
+                      u32 Width,
+                      u32 HeightIn,
+                      u32 HeightOut,
+                      u16 NumComps,
+                      u16 BitsPerComp);
+void XV_VScalerSwScale(const XV_VScalerSw *SwPtr,
+                       const u16 *In,
+                       u32 InStride,
+                       u16 *Out,
+                       u32 OutStride,
+                       u32 LineStart,
+                       u32 NumLines);
+void XV_VScalerSwScaleRef(const XV_VScalerSw *SwPtr,
+                          const u16 *In,
+                          u32 InStride,
+                          u16 *Out,
+                          u32 OutStride,
+                          u32 LineStart,
+                          u32 NumLines);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
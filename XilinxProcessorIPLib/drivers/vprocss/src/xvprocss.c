@@ -37,6 +37,8 @@
 * 2.40  vyc  10/04/17   Added support for conversion from 420/422/444/RGB to
 *                       420/422/444/RGB with CSC-only topology
 * 2.50  vyc  04/04/18   Fix for HScaler setup with 420 input
+*       ag   10/19/26   Invalidate the scaler coefficient and phase caches
+*                       on reset
 *
 * </pre>
 *
@@ -756,6 +758,16 @@ void XVprocSs_Reset(XVprocSs *InstancePtr)
   XVprocSs_EnableBlock(InstancePtr->RstAxisPtr,  GPIO_CH_RESET_SEL, XVPROCSS_RSTMASK_IP_AXIS);
   WaitUs(InstancePtr, 1000); /* wait 1ms for AXIS to stabilize */
 
+  /*
+   * The scaler register banks may have lost the coefficients and phases,
+   * the next setup must write them again
+   */
+  if(InstancePtr->HscalerPtr)
+    XV_HScalerInvalidateCache(InstancePtr->HscalerPtr);
+
+  if(InstancePtr->VscalerPtr)
+    XV_VScalerInvalidateCache(InstancePtr->VscalerPtr);
+
   /* Reset start core flags */
   memset(InstancePtr->CtxtData.StartCore, 0, sizeof(InstancePtr->CtxtData.StartCore));
 
@@ -0,0 +1,275 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async_bench_example.c
+*
+* This file contains an example which compares the processor memcpy with the
+* asynchronous ZDMA copy service of xzdma_async.h, for copies of increasing
+* size, and reports the size from which the ZDMA copy is faster. This size can
+* be given to XZDma_AsyncSetCpuThreshold().
+*
+* The time of a ZDMA copy is measured from the submit call to the completion
+* handler, and includes the cache maintenance done by the service. The
+* service channels are polled with XZDma_AsyncIntrHandler(), so no interrupt
+* controller setup is needed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.14  ag     10/19/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma_async.h"
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+#include <string.h>
+
+/************************** Constant Definitions ******************************/
+
+#define ZDMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID /* First ZDMA channel */
+#ifndef NUM_CHANNELS
+#define NUM_CHANNELS		1U	/**< Channels used by the service */
+#endif
+#define MAX_SIZE		0x100000U /**< Largest copy */
+#define MIN_SIZE		64U	/**< Smallest copy */
+#define ITERATIONS		16U	/**< Copies per measurement */
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+
+int XZDma_AsyncBenchExample(u16 DeviceId);
+static void CopyDone(void *CallBackRef, s32 Status);
+static u64 TimeCpu(u32 Size);
+static u64 TimeDma(u32 Size);
+
+/************************** Variable Definitions *****************************/
+
+static XZDma ZDma[NUM_CHANNELS];	/**< ZDMA channel instances */
+static XZDma_Async Async;		/**< Copy service */
+static XZDma_AsyncReq Req;		/**< Copy request */
+static volatile u32 Done;		/**< Done flag */
+static volatile s32 CopyStatus;		/**< Status of the copy */
+
+#if defined(__ICCARM__)
+    #pragma data_alignment = 64
+	u8 BenchDstBuf[MAX_SIZE]; /**< Destination buffer */
+    #pragma data_alignment = 64
+	u8 BenchSrcBuf[MAX_SIZE]; /**< Source buffer */
+    #pragma data_alignment = 64
+	u8 BenchDscrMem[NUM_CHANNELS][XZDMA_ASYNC_DSCR_MEM_SIZE];
+				/**< Descriptors */
+#else
+	u8 BenchDstBuf[MAX_SIZE] __attribute__ ((aligned (64)));
+				/**< Destination buffer */
+	u8 BenchSrcBuf[MAX_SIZE] __attribute__ ((aligned (64)));
+				/**< Source buffer */
+	u8 BenchDscrMem[NUM_CHANNELS][XZDMA_ASYNC_DSCR_MEM_SIZE]
+				__attribute__ ((aligned (64)));
+				/**< Descriptors */
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	Status = XZDma_AsyncBenchExample((u16)ZDMA_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("ZDMA async benchmark Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran ZDMA async benchmark Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes NUM_CHANNELS channels starting at DeviceId, adds
+* them to the copy service and measures the processor and ZDMA copies.
+*
+* @param	DeviceId is the device Id of the first ZDMA channel.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int XZDma_AsyncBenchExample(u16 DeviceId)
+{
+	XZDma_Config *Config;
+	u64 CpuTime;
+	u64 DmaTime;
+	u32 Crossover = 0U;
+	u32 Size;
+	u32 Index;
+	int Status;
+
+	XZDma_AsyncInitialize(&Async);
+
+	for (Index = 0U; Index < NUM_CHANNELS; Index++) {
+		Config = XZDma_LookupConfig(DeviceId + (u16)Index);
+		if (NULL == Config) {
+			return XST_FAILURE;
+		}
+
+		Status = XZDma_CfgInitialize(&ZDma[Index], Config,
+				Config->BaseAddress);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = XZDma_AsyncAddChannel(&Async, &ZDma[Index],
+				(UINTPTR)BenchDscrMem[Index]);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	for (Index = 0U; Index < MAX_SIZE; Index++) {
+		BenchSrcBuf[Index] = (u8)Index;
+	}
+
+	xil_printf("%10s %14s %14s\r\n", "Size", "CPU (ticks)", "ZDMA (ticks)");
+	for (Size = MIN_SIZE; Size <= MAX_SIZE; Size <<= 1U) {
+		CpuTime = TimeCpu(Size);
+		DmaTime = TimeDma(Size);
+		if ((DmaTime == 0U) || (CopyStatus != XST_SUCCESS)) {
+			return XST_FAILURE;
+		}
+
+		if (memcmp(BenchDstBuf, BenchSrcBuf, Size) != 0) {
+			xil_printf("Data mismatch for %d bytes\r\n", Size);
+			return XST_FAILURE;
+		}
+
+		if ((Crossover == 0U) && (DmaTime < CpuTime)) {
+			Crossover = Size;
+		}
+
+		xil_printf("%10d %14d %14d\r\n", Size,
+			(u32)(CpuTime / ITERATIONS),
+			(u32)(DmaTime / ITERATIONS));
+	}
+
+	if (Crossover != 0U) {
+		xil_printf("ZDMA is faster from %d bytes\r\n", Crossover);
+	}
+	else {
+		xil_printf("ZDMA is not faster up to %d bytes\r\n", MAX_SIZE);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Completion handler of the copies.
+*
+* @param	CallBackRef is unused.
+* @param	Status is the status of the copy.
+*
+* @return	None.
+*
+******************************************************************************/
+static void CopyDone(void *CallBackRef, s32 Status)
+{
+	(void)CallBackRef;
+
+	CopyStatus = Status;
+	Done = 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures ITERATIONS processor copies of Size bytes.
+*
+* @param	Size is the copy size.
+*
+* @return	Time in global timer ticks.
+*
+******************************************************************************/
+static u64 TimeCpu(u32 Size)
+{
+	XTime Start;
+	XTime End;
+	u32 Index;
+
+	XTime_GetTime(&Start);
+	for (Index = 0U; Index < ITERATIONS; Index++) {
+		(void)memcpy(BenchDstBuf, BenchSrcBuf, Size);
+	}
+	XTime_GetTime(&End);
+
+	return (u64)(End - Start);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures ITERATIONS ZDMA copies of Size bytes, each copy is
+* submitted once the previous one is completed.
+*
+* @param	Size is the copy size.
+*
+* @return	Time in global timer ticks, 0 if a copy could not be submitted.
+*
+******************************************************************************/
+static u64 TimeDma(u32 Size)
+{
+	XTime Start;
+	XTime End;
+	u32 Index;
+	u32 Chan;
+	s32 Status;
+
+	(void)memset(BenchDstBuf, 0, Size);
+
+	XTime_GetTime(&Start);
+	for (Index = 0U; Index < ITERATIONS; Index++) {
+		Done = 0U;
+		Status = XZDma_AsyncMemcpy(&Async, &Req, (UINTPTR)BenchDstBuf,
+				(UINTPTR)BenchSrcBuf, Size, CopyDone, NULL);
+		if (Status != XST_SUCCESS) {
+			return 0U;
+		}
+
+		while (Done == 0U) {
+			for (Chan = 0U; Chan < NUM_CHANNELS; Chan++) {
+				XZDma_AsyncIntrHandler(&ZDma[Chan]);
+			}
+		}
+	}
+	XTime_GetTime(&End);
+
+	return (u64)(End - Start);
+}
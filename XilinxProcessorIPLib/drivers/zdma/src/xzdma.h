@@ -50,6 +50,10 @@
 * functions by using XZDma_SetCallBack API. In this version Descriptor done
 * option is disabled.
 *
+* <b> Asynchronous copies </b>
+* xzdma_async.h provides a service which queues memcpy and memset requests on
+* one or more channels, and calls a completion handler for each request.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -115,6 +119,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.14	ag	10/19/26 Added the asynchronous memcpy/memset service in
+*			 xzdma_async.c.
 * </pre>
 *
 ******************************************************************************/
@@ -0,0 +1,783 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async.c
+* @addtogroup zdma_v1_14
+* @{
+*
+* This file contains the implementation of the asynchronous memory copy
+* service. Please see xzdma_async.h for more details.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.14  ag   10/19/26 First release
+*       ag   10/19/26 Start the next operations after the interrupt status
+*                     is cleared, complete the operations with an error
+*                     when XZDma_Start() fails
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma_async.h"
+#include "xil_dmamem.h"
+#include <string.h>
+
+/************************** Constant Definitions *****************************/
+
+/* Errors after which the channel is idle */
+#define XZDMA_ASYNC_AXI_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+					 XZDMA_IXR_AXI_RD_DATA_MASK | \
+					 XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+					 XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+
+/************************** Function Prototypes ******************************/
+
+static s32 XZDma_AsyncQueue(XZDma_Async *AsyncPtr, XZDma_AsyncReq *ReqPtr,
+		XZDma_AsyncOp *OpPtr);
+static u32 XZDma_AsyncKick(XZDma_AsyncChan *ChanPtr, XZDma_AsyncReq **Done);
+static u32 XZDma_AsyncBatch(XZDma_AsyncChan *ChanPtr);
+static u32 XZDma_AsyncRetire(XZDma_AsyncChan *ChanPtr, s32 Status,
+		XZDma_AsyncReq **Done);
+static void XZDma_AsyncDoneHandler(void *CallBackRef);
+static void XZDma_AsyncErrorHandler(void *CallBackRef, u32 ErrorMask);
+static void XZDma_AsyncLock(const XZDma_Async *AsyncPtr);
+static void XZDma_AsyncUnlock(const XZDma_Async *AsyncPtr);
+static void XZDma_AsyncFinish(XZDma_AsyncReq *ReqPtr);
+static void XZDma_AsyncFinishAll(XZDma_AsyncReq **Done, u32 NumDone);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the asynchronous memory copy service. Channels
+* are added afterwards with XZDma_AsyncAddChannel().
+*
+* @param	AsyncPtr is a pointer to the service instance.
+*
+* @return	None.
+*
+******************************************************************************/
+void XZDma_AsyncInitialize(XZDma_Async *AsyncPtr)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(AsyncPtr != NULL);
+
+	(void)memset(AsyncPtr, 0, sizeof(XZDma_Async));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a ZDMA channel to the service. The channel is set in
+* scatter gather linked list mode, and the done and error handlers of the
+* channel are taken over by the service.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+* @param	InstancePtr is a pointer to the initialized XZDma instance.
+* @param	DscrMemPtr is the address of XZDMA_ASYNC_DSCR_MEM_SIZE bytes,
+*		64 byte aligned, used for the descriptors of the channel.
+*		If 0, the descriptors are allocated from the DMA descriptor
+*		memory of the BSP (xil_dmamem.h).
+*
+* @return
+*		- XST_SUCCESS if the channel is added.
+*		- XST_DEVICE_BUSY if the channel is not idle.
+*		- XST_FAILURE if the maximum number of channels is reached,
+*		or if no descriptor memory is available.
+*
+******************************************************************************/
+s32 XZDma_AsyncAddChannel(XZDma_Async *AsyncPtr, XZDma *InstancePtr,
+		UINTPTR DscrMemPtr)
+{
+	s32 Status;
+	XZDma_AsyncChan *ChanPtr;
+	UINTPTR DscrAddr = DscrMemPtr;
+	u32 Count;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (AsyncPtr->NumChans >= XZDMA_ASYNC_MAX_CHANNELS) {
+		Status = XST_FAILURE;
+		goto END;
+	}
+
+	Status = XZDma_SetMode(InstancePtr, TRUE, XZDMA_NORMAL_MODE);
+	if (Status != XST_SUCCESS) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	if (DscrAddr == 0x00U) {
+		DscrAddr = (UINTPTR)Xil_DmaMemAlloc(XZDMA_ASYNC_DSCR_MEM_SIZE,
+				XIL_DMAMEM_ALIGN_ZDMA);
+		if (DscrAddr == 0x00U) {
+			Status = XST_FAILURE;
+			goto END;
+		}
+	}
+
+	ChanPtr = &AsyncPtr->Chan[AsyncPtr->NumChans];
+	(void)memset(ChanPtr, 0, sizeof(XZDma_AsyncChan));
+	ChanPtr->InstancePtr = InstancePtr;
+
+	Count = XZDma_CreateBDList(InstancePtr, XZDMA_LINKEDLIST, DscrAddr,
+			XZDMA_ASYNC_DSCR_MEM_SIZE);
+	ChanPtr->MaxBatch = (Count < XZDMA_ASYNC_MAX_BATCH) ? Count :
+			XZDMA_ASYNC_MAX_BATCH;
+
+	(void)XZDma_SetCallBack(InstancePtr, XZDMA_HANDLER_DONE,
+			(void *)XZDma_AsyncDoneHandler, ChanPtr);
+	(void)XZDma_SetCallBack(InstancePtr, XZDMA_HANDLER_ERROR,
+			(void *)XZDma_AsyncErrorHandler, ChanPtr);
+	XZDma_EnableIntr(InstancePtr, (XZDMA_IXR_DMA_DONE_MASK |
+			XZDMA_ASYNC_AXI_ERR_MASK));
+
+	AsyncPtr->NumChans++;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the size below which copies are done by the processor
+* instead of the ZDMA.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+* @param	Threshold is the size in bytes, 0 to always use the ZDMA.
+*
+* @return	None.
+*
+******************************************************************************/
+void XZDma_AsyncSetCpuThreshold(XZDma_Async *AsyncPtr, u32 Threshold)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(AsyncPtr != NULL);
+
+	AsyncPtr->CpuThreshold = Threshold;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a memory copy. The source must not be modified and the
+* destination must not be accessed until the completion handler is called.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+* @param	ReqPtr is the request, owned by the service until completion.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address.
+* @param	Size is the number of bytes to copy.
+* @param	Handler is the completion handler, may be NULL.
+* @param	CallBackRef is the argument passed to the handler.
+*
+* @return
+*		- XST_SUCCESS if the copy is queued or already completed.
+*		- XST_INVALID_PARAM if no channel is added or Size is 0.
+*		- XST_DEVICE_BUSY if the channel queues are full.
+*
+******************************************************************************/
+s32 XZDma_AsyncMemcpy(XZDma_Async *AsyncPtr, XZDma_AsyncReq *ReqPtr,
+		UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size,
+		XZDma_AsyncHandler Handler, void *CallBackRef)
+{
+	s32 Status;
+	XZDma_AsyncOp Op;
+	u32 Head = 0U;
+	u32 Tail = 0U;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	if ((AsyncPtr->NumChans == 0U) || (Size == 0U)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	ReqPtr->Handler = Handler;
+	ReqPtr->CallBackRef = CallBackRef;
+	ReqPtr->Status = XST_SUCCESS;
+	ReqPtr->Pending = 0U;
+
+	if (Size < AsyncPtr->CpuThreshold) {
+		(void)memcpy((void *)DstAddr, (const void *)SrcAddr, Size);
+		XZDma_AsyncFinish(ReqPtr);
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/*
+	 * Without coherency, invalidating a partial destination cache line
+	 * would discard the data around the destination, so those bytes are
+	 * copied by the processor.
+	 */
+	if (AsyncPtr->Chan[0].InstancePtr->Config.IsCacheCoherent == 0U) {
+		Head = (XZDMA_ASYNC_CACHE_LINE -
+			(u32)(DstAddr & (XZDMA_ASYNC_CACHE_LINE - 1U))) &
+			(XZDMA_ASYNC_CACHE_LINE - 1U);
+		if (Head > Size) {
+			Head = Size;
+		}
+		Tail = (Size - Head) & (XZDMA_ASYNC_CACHE_LINE - 1U);
+	}
+
+	Op.DstAddr = DstAddr + Head;
+	Op.SrcAddr = SrcAddr + Head;
+	Op.Size = Size - Head - Tail;
+	Op.IsMemset = FALSE;
+	Op.Value = 0U;
+
+	/* Done before queuing, the handler may be called once queued */
+	if (Head != 0U) {
+		(void)memcpy((void *)DstAddr, (const void *)SrcAddr, Head);
+	}
+	if (Tail != 0U) {
+		(void)memcpy((void *)(DstAddr + Size - Tail),
+			(const void *)(SrcAddr + Size - Tail), Tail);
+	}
+
+	if (Op.Size != 0U) {
+		Status = XZDma_AsyncQueue(AsyncPtr, ReqPtr, &Op);
+	}
+	else {
+		XZDma_AsyncFinish(ReqPtr);
+		Status = XST_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a memset. The destination must not be accessed until
+* the completion handler is called.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+* @param	ReqPtr is the request, owned by the service until completion.
+* @param	DstAddr is the destination address.
+* @param	Value is the byte written to the destination.
+* @param	Size is the number of bytes to set.
+* @param	Handler is the completion handler, may be NULL.
+* @param	CallBackRef is the argument passed to the handler.
+*
+* @return
+*		- XST_SUCCESS if the memset is queued or already completed.
+*		- XST_INVALID_PARAM if no channel is added or Size is 0.
+*		- XST_DEVICE_BUSY if the channel queues are full.
+*
+* @note		The write only mode writes a 64 or 128 bit pattern, so the
+*		bytes which are not in cache line aligned blocks are always
+*		set by the processor.
+*
+******************************************************************************/
+s32 XZDma_AsyncMemset(XZDma_Async *AsyncPtr, XZDma_AsyncReq *ReqPtr,
+		UINTPTR DstAddr, u8 Value, u32 Size,
+		XZDma_AsyncHandler Handler, void *CallBackRef)
+{
+	s32 Status;
+	XZDma_AsyncOp Op;
+	u32 Head;
+	u32 Tail;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(AsyncPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+
+	if ((AsyncPtr->NumChans == 0U) || (Size == 0U)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	ReqPtr->Handler = Handler;
+	ReqPtr->CallBackRef = CallBackRef;
+	ReqPtr->Status = XST_SUCCESS;
+	ReqPtr->Pending = 0U;
+
+	Head = (XZDMA_ASYNC_CACHE_LINE -
+		(u32)(DstAddr & (XZDMA_ASYNC_CACHE_LINE - 1U))) &
+		(XZDMA_ASYNC_CACHE_LINE - 1U);
+	if ((Head > Size) || (Size < AsyncPtr->CpuThreshold)) {
+		Head = Size;
+	}
+	Tail = (Size - Head) & (XZDMA_ASYNC_CACHE_LINE - 1U);
+
+	Op.DstAddr = DstAddr + Head;
+	Op.SrcAddr = 0U;
+	Op.Size = Size - Head - Tail;
+	Op.IsMemset = TRUE;
+	Op.Value = Value;
+
+	/* Done before queuing, the handler may be called once queued */
+	if (Head != 0U) {
+		(void)memset((void *)DstAddr, (s32)Value, Head);
+	}
+	if (Tail != 0U) {
+		(void)memset((void *)(DstAddr + Size - Tail), (s32)Value, Tail);
+	}
+
+	if (Op.Size != 0U) {
+		Status = XZDma_AsyncQueue(AsyncPtr, ReqPtr, &Op);
+	}
+	else {
+		XZDma_AsyncFinish(ReqPtr);
+		Status = XST_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function splits an operation in shards over the channels and in
+* descriptors of at most XZDMA_ASYNC_MAX_XFER bytes, queues them and starts
+* the idle channels. Nothing is queued if a channel queue is too short.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+* @param	ReqPtr is the request of the operation.
+* @param	OpPtr is the operation, its destination is cache line aligned.
+*
+* @return
+*		- XST_SUCCESS if the operation is queued.
+*		- XST_DEVICE_BUSY if a channel queue is full.
+*
+******************************************************************************/
+static s32 XZDma_AsyncQueue(XZDma_Async *AsyncPtr, XZDma_AsyncReq *ReqPtr,
+		XZDma_AsyncOp *OpPtr)
+{
+	s32 Status = XST_DEVICE_BUSY;
+	XZDma_AsyncChan *ChanPtr;
+	XZDma_AsyncOp *QOpPtr;
+	u32 NumShards;
+	u32 ShardSize;
+	u32 Shard;
+	u32 Offset;
+	u32 Len;
+	u32 Left;
+	u32 Chunk;
+	u32 NumOps = 0U;
+	XZDma_AsyncReq *Done[XZDMA_ASYNC_QUEUE_LEN];
+	u32 NumDone = 0U;
+
+	NumShards = OpPtr->Size / XZDMA_ASYNC_SHARD_SIZE;
+	if (NumShards > AsyncPtr->NumChans) {
+		NumShards = AsyncPtr->NumChans;
+	}
+	if (NumShards == 0U) {
+		NumShards = 1U;
+	}
+	ShardSize = ((OpPtr->Size / NumShards) + XZDMA_ASYNC_CACHE_LINE - 1U) &
+		~(XZDMA_ASYNC_CACHE_LINE - 1U);
+
+	XZDma_AsyncLock(AsyncPtr);
+
+	/* Check the room in the queues before queuing anything */
+	for (Shard = 0U; Shard < NumShards; Shard++) {
+		ChanPtr = &AsyncPtr->Chan[(AsyncPtr->NextChan + Shard) %
+				AsyncPtr->NumChans];
+		Offset = Shard * ShardSize;
+		Len = OpPtr->Size - Offset;
+		if (Len > ShardSize) {
+			Len = ShardSize;
+		}
+		Chunk = (Len + XZDMA_ASYNC_MAX_XFER - 1U) / XZDMA_ASYNC_MAX_XFER;
+		if ((ChanPtr->Count + Chunk) > XZDMA_ASYNC_QUEUE_LEN) {
+			goto END;
+		}
+		NumOps += Chunk;
+	}
+
+	ReqPtr->Pending += NumOps;
+
+	for (Shard = 0U; Shard < NumShards; Shard++) {
+		ChanPtr = &AsyncPtr->Chan[(AsyncPtr->NextChan + Shard) %
+				AsyncPtr->NumChans];
+		Offset = Shard * ShardSize;
+		Left = OpPtr->Size - Offset;
+		if (Left > ShardSize) {
+			Left = ShardSize;
+		}
+
+		while (Left > 0U) {
+			Chunk = (Left > XZDMA_ASYNC_MAX_XFER) ?
+				XZDMA_ASYNC_MAX_XFER : Left;
+
+			QOpPtr = &ChanPtr->Queue[(ChanPtr->Head +
+					ChanPtr->Count) % XZDMA_ASYNC_QUEUE_LEN];
+			*QOpPtr = *OpPtr;
+			QOpPtr->DstAddr = OpPtr->DstAddr + Offset;
+			QOpPtr->Size = Chunk;
+			QOpPtr->ReqPtr = ReqPtr;
+			if (OpPtr->IsMemset == FALSE) {
+				QOpPtr->SrcAddr = OpPtr->SrcAddr + Offset;
+			}
+
+			if (ChanPtr->InstancePtr->Config.IsCacheCoherent == 0U) {
+				if (OpPtr->IsMemset == FALSE) {
+					Xil_DCacheFlushRange(QOpPtr->SrcAddr,
+						Chunk);
+				}
+				Xil_DCacheInvalidateRange(QOpPtr->DstAddr,
+					Chunk);
+			}
+
+			ChanPtr->Count++;
+			Offset += Chunk;
+			Left -= Chunk;
+		}
+	}
+
+	for (Shard = 0U; Shard < NumShards; Shard++) {
+		NumDone += XZDma_AsyncKick(&AsyncPtr->Chan[
+				(AsyncPtr->NextChan + Shard) %
+				AsyncPtr->NumChans], &Done[NumDone]);
+	}
+	AsyncPtr->NextChan = (AsyncPtr->NextChan + NumShards) %
+			AsyncPtr->NumChans;
+	Status = XST_SUCCESS;
+
+END:
+	XZDma_AsyncUnlock(AsyncPtr);
+
+	/* Requests failed by XZDma_Start(), once the queues are consistent */
+	XZDma_AsyncFinishAll(Done, NumDone);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the operations at the head of the channel queue if the
+* channel is idle. Consecutive copies are started as one linked list, a
+* memset is started alone in write only mode. When XZDma_Start() fails, the
+* operations are retired with an error and the next ones are tried.
+*
+* @param	ChanPtr is a pointer to the service channel.
+* @param	Done is filled with the requests completed by a failure, their
+*		handlers are called by the caller.
+*
+* @return	Number of requests completed.
+*
+******************************************************************************/
+static u32 XZDma_AsyncKick(XZDma_AsyncChan *ChanPtr, XZDma_AsyncReq **Done)
+{
+	u32 NumDone = 0U;
+
+	while ((ChanPtr->InFlight == 0U) && (ChanPtr->Count != 0U)) {
+		ChanPtr->InFlight = XZDma_AsyncBatch(ChanPtr);
+		if (XZDma_Start(ChanPtr->InstancePtr, ChanPtr->Xfer,
+				ChanPtr->InFlight) != XST_SUCCESS) {
+			NumDone += XZDma_AsyncRetire(ChanPtr, XST_FAILURE,
+					&Done[NumDone]);
+		}
+	}
+
+	return NumDone;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prepares the transfers of the operations at the head of the
+* channel queue.
+*
+* @param	ChanPtr is a pointer to the service channel.
+*
+* @return	Number of transfers prepared.
+*
+******************************************************************************/
+static u32 XZDma_AsyncBatch(XZDma_AsyncChan *ChanPtr)
+{
+	XZDma *InstancePtr = ChanPtr->InstancePtr;
+	XZDma_AsyncOp *OpPtr;
+	XZDma_Transfer *XferPtr;
+	u32 Pattern[4U];
+	u32 Num;
+	u8 Coherent = InstancePtr->Config.IsCacheCoherent;
+
+	OpPtr = &ChanPtr->Queue[ChanPtr->Head];
+	if (OpPtr->IsMemset == TRUE) {
+		if (InstancePtr->IsSgDma == TRUE) {
+			(void)XZDma_SetMode(InstancePtr, FALSE,
+					XZDMA_WRONLY_MODE);
+		}
+		Pattern[0U] = (u32)OpPtr->Value * 0x01010101U;
+		Pattern[1U] = Pattern[0U];
+		Pattern[2U] = Pattern[0U];
+		Pattern[3U] = Pattern[0U];
+		XZDma_WOData(InstancePtr, Pattern);
+
+		XferPtr = &ChanPtr->Xfer[0U];
+		XferPtr->SrcAddr = 0U;
+		XferPtr->DstAddr = OpPtr->DstAddr;
+		XferPtr->Size = OpPtr->Size;
+		XferPtr->SrcCoherent = 0U;
+		XferPtr->DstCoherent = Coherent;
+		XferPtr->Pause = 0U;
+		Num = 1U;
+	}
+	else {
+		if (InstancePtr->IsSgDma != TRUE) {
+			(void)XZDma_SetMode(InstancePtr, TRUE,
+					XZDMA_NORMAL_MODE);
+		}
+
+		for (Num = 0U; (Num < ChanPtr->Count) &&
+				(Num < ChanPtr->MaxBatch); Num++) {
+			OpPtr = &ChanPtr->Queue[(ChanPtr->Head + Num) %
+					XZDMA_ASYNC_QUEUE_LEN];
+			if (OpPtr->IsMemset == TRUE) {
+				break;
+			}
+			XferPtr = &ChanPtr->Xfer[Num];
+			XferPtr->SrcAddr = OpPtr->SrcAddr;
+			XferPtr->DstAddr = OpPtr->DstAddr;
+			XferPtr->Size = OpPtr->Size;
+			XferPtr->SrcCoherent = Coherent;
+			XferPtr->DstCoherent = Coherent;
+			XferPtr->Pause = 0U;
+		}
+	}
+
+	return Num;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires the operations started on a channel.
+*
+* @param	ChanPtr is a pointer to the service channel.
+* @param	Status is the status of the operations.
+* @param	Done is filled with the requests completed.
+*
+* @return	Number of requests completed.
+*
+******************************************************************************/
+static u32 XZDma_AsyncRetire(XZDma_AsyncChan *ChanPtr, s32 Status,
+		XZDma_AsyncReq **Done)
+{
+	XZDma_AsyncOp *OpPtr;
+	XZDma_AsyncReq *ReqPtr;
+	u32 NumDone = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < ChanPtr->InFlight; Index++) {
+		OpPtr = &ChanPtr->Queue[ChanPtr->Head];
+		if (ChanPtr->InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheInvalidateRange(OpPtr->DstAddr, OpPtr->Size);
+		}
+
+		ReqPtr = OpPtr->ReqPtr;
+		if (Status != XST_SUCCESS) {
+			ReqPtr->Status = Status;
+		}
+		ReqPtr->Pending--;
+		if (ReqPtr->Pending == 0U) {
+			Done[NumDone] = ReqPtr;
+			NumDone++;
+		}
+
+		ChanPtr->Head = (ChanPtr->Head + 1U) % XZDMA_ASYNC_QUEUE_LEN;
+		ChanPtr->Count--;
+	}
+	ChanPtr->InFlight = 0U;
+
+	return NumDone;
+}
+
+/*****************************************************************************/
+/**
+*
+* Done handler registered with the ZDMA driver for every channel. The
+* operations are retired by XZDma_AsyncIntrHandler() once the interrupt
+* status is cleared.
+*
+* @param	CallBackRef is the service channel.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncDoneHandler(void *CallBackRef)
+{
+	XZDma_AsyncChan *ChanPtr = (XZDma_AsyncChan *)CallBackRef;
+
+	ChanPtr->Completed = TRUE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Error handler registered with the ZDMA driver for every channel. The
+* channel is idle after an AXI error, with or without the done interrupt.
+*
+* @param	CallBackRef is the service channel.
+* @param	ErrorMask is the mask of the errors.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncErrorHandler(void *CallBackRef, u32 ErrorMask)
+{
+	XZDma_AsyncChan *ChanPtr = (XZDma_AsyncChan *)CallBackRef;
+
+	if ((ErrorMask & XZDMA_ASYNC_AXI_ERR_MASK) != 0U) {
+		ChanPtr->Completed = TRUE;
+		ChanPtr->CompleteStatus = XST_FAILURE;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of a channel of the service, to be
+* connected to the interrupt controller, or called in a polling loop, in
+* place of XZDma_IntrHandler().
+*
+* XZDma_IntrHandler() clears the interrupt status after calling the done
+* handler. Starting the next operations from the done handler could let them
+* complete before that, and their done interrupt would be cleared with the
+* previous one, so the operations are retired and the next ones started once
+* XZDma_IntrHandler() returns.
+*
+* @param	Instance is a pointer to the XZDma instance of the channel.
+*
+* @return	None.
+*
+******************************************************************************/
+void XZDma_AsyncIntrHandler(void *Instance)
+{
+	XZDma *InstancePtr = (XZDma *)Instance;
+	XZDma_AsyncChan *ChanPtr;
+	XZDma_AsyncReq *Done[XZDMA_ASYNC_QUEUE_LEN];
+	u32 NumDone;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	ChanPtr = (XZDma_AsyncChan *)InstancePtr->DoneRef;
+	ChanPtr->Completed = FALSE;
+	ChanPtr->CompleteStatus = XST_SUCCESS;
+
+	XZDma_IntrHandler(InstancePtr);
+
+	if ((ChanPtr->Completed == FALSE) || (ChanPtr->InFlight == 0U)) {
+		goto END;
+	}
+
+	Status = ChanPtr->CompleteStatus;
+	NumDone = XZDma_AsyncRetire(ChanPtr, Status, Done);
+
+	/* Keep the channel busy while the handlers run */
+	NumDone += XZDma_AsyncKick(ChanPtr, &Done[NumDone]);
+
+	XZDma_AsyncFinishAll(Done, NumDone);
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function masks the interrupts of all the channels of the service.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncLock(const XZDma_Async *AsyncPtr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < AsyncPtr->NumChans; Index++) {
+		XZDma_WriteReg(AsyncPtr->Chan[Index].InstancePtr->Config.BaseAddress,
+			XZDMA_CH_IDS_OFFSET, XZDMA_IXR_ALL_INTR_MASK);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function unmasks the interrupts of the busy channels of the service,
+* the interrupts of an idle channel are enabled when it is started.
+*
+* @param	AsyncPtr is a pointer to the service instance.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncUnlock(const XZDma_Async *AsyncPtr)
+{
+	const XZDma *InstancePtr;
+	u32 Index;
+
+	for (Index = 0U; Index < AsyncPtr->NumChans; Index++) {
+		InstancePtr = AsyncPtr->Chan[Index].InstancePtr;
+		if (InstancePtr->ChannelState == XZDMA_BUSY) {
+			XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+				XZDMA_CH_IEN_OFFSET, (InstancePtr->IntrMask &
+				XZDMA_IXR_ALL_INTR_MASK));
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function calls the completion handler of a request.
+*
+* @param	ReqPtr is the completed request.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncFinish(XZDma_AsyncReq *ReqPtr)
+{
+	if (ReqPtr->Handler != NULL) {
+		ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr->Status);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function calls the completion handlers of a list of requests.
+*
+* @param	Done is the list of completed requests.
+* @param	NumDone is the number of requests.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XZDma_AsyncFinishAll(XZDma_AsyncReq **Done, u32 NumDone)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < NumDone; Index++) {
+		XZDma_AsyncFinish(Done[Index]);
+	}
+}
+/** @} */
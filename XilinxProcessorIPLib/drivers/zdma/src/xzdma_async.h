@@ -0,0 +1,178 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_async.h
+* @addtogroup zdma_v1_14
+* @{
+*
+* This file contains the asynchronous memory copy service built on top of the
+* ZDMA driver. The service queues memcpy and memset requests on one or more
+* ZDMA channels and calls a completion handler once a request is done, so the
+* caller does not have to wait for XZDma_Start() to accept a new transfer.
+*
+* - Every channel added with XZDma_AsyncAddChannel() has a queue of
+*   XZDMA_ASYNC_QUEUE_LEN operations. Consecutive copies in the queue are
+*   started together in scatter gather linked list mode, up to
+*   XZDMA_ASYNC_MAX_BATCH descriptors per start.
+* - A copy of at least XZDMA_ASYNC_SHARD_SIZE bytes is split in cache line
+*   aligned shards over the channels, and copies larger than
+*   XZDMA_ASYNC_MAX_XFER bytes are split in several descriptors.
+* - When the data cache is not coherent with the ZDMA, the bytes of the
+*   destination which don't cover a whole cache line are written by the
+*   processor, the DMA writes the cache line aligned part only.
+* - A memset is done in write only mode using XZDma_WOData(), between two
+*   scatter gather batches.
+* - Copies smaller than the threshold set with XZDma_AsyncSetCpuThreshold()
+*   are done by the processor and completed before the submit call returns.
+*   The threshold can be measured with xzdma_async_bench_example.c.
+*
+* The completion and error handlers of the ZDMA driver are used by the
+* service. XZDma_AsyncIntrHandler() of every channel must be connected to
+* the interrupt controller, or called in a polling loop, in place of
+* XZDma_IntrHandler(). The completion handler of a request is called from
+* that context, and may submit new requests. When XZDma_Start() fails, the
+* operations of the transfer are completed with XST_FAILURE, which may happen
+* before the submit call returns.
+*
+* The submit functions mask the interrupts of the channels while the queues
+* are updated, so they can be called both from the application and from the
+* completion handlers.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.14  ag   10/19/26 First release
+*       ag   10/19/26 Added XZDma_AsyncIntrHandler()
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XZDMA_ASYNC_H_
+#define XZDMA_ASYNC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XZDMA_ASYNC_MAX_CHANNELS	(8U)	/**< Channels per service */
+#ifndef XZDMA_ASYNC_QUEUE_LEN
+#define XZDMA_ASYNC_QUEUE_LEN		(32U)	/**< Operations queued per
+						  *  channel */
+#endif
+#ifndef XZDMA_ASYNC_MAX_BATCH
+#define XZDMA_ASYNC_MAX_BATCH		(8U)	/**< Descriptors per start */
+#endif
+#ifndef XZDMA_ASYNC_SHARD_SIZE
+#define XZDMA_ASYNC_SHARD_SIZE		(0x10000U) /**< Minimum shard size */
+#endif
+#define XZDMA_ASYNC_CACHE_LINE		(64U)	/**< Alignment of the DMA
+						  *  destination */
+#define XZDMA_ASYNC_MAX_XFER		(XZDMA_WORD2_SIZE_MASK & \
+					 ~(XZDMA_ASYNC_CACHE_LINE - 1U))
+						/**< Bytes per descriptor */
+
+/**
+ * Size of the descriptor memory to be given to XZDma_AsyncAddChannel(). When
+ * no memory is given, it is allocated from the BSP DMA descriptor memory.
+ */
+#define XZDMA_ASYNC_DSCR_MEM_SIZE	(2U * XZDMA_ASYNC_MAX_BATCH * \
+					 (u32)sizeof(XZDma_LlDscr))
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Completion handler of a request.
+ *
+ * @param	CallBackRef is the reference given with the request.
+ * @param	Status is XST_SUCCESS, or XST_FAILURE if the ZDMA reported an
+ *		error for the request.
+ */
+typedef void (*XZDma_AsyncHandler) (void *CallBackRef, s32 Status);
+
+/**
+ * Request, owned by the service from the submit call until the completion
+ * handler is called.
+ */
+typedef struct {
+	XZDma_AsyncHandler Handler;	/**< Completion handler */
+	void *CallBackRef;		/**< Handler argument */
+	u32 Pending;			/**< Operations not yet completed */
+	s32 Status;			/**< Status of the request */
+} XZDma_AsyncReq;
+
+/**
+ * Operation queued on a channel
+ */
+typedef struct {
+	UINTPTR SrcAddr;		/**< Source address */
+	UINTPTR DstAddr;		/**< Destination address */
+	u32 Size;			/**< Size in bytes */
+	u8 IsMemset;			/**< Memset operation */
+	u8 Value;			/**< Memset value */
+	XZDma_AsyncReq *ReqPtr;		/**< Request of the operation */
+} XZDma_AsyncOp;
+
+/**
+ * Channel of the service
+ */
+typedef struct {
+	XZDma *InstancePtr;		/**< ZDMA channel */
+	XZDma_AsyncOp Queue[XZDMA_ASYNC_QUEUE_LEN];
+					/**< Queued operations */
+	u32 Head;			/**< First queued operation */
+	u32 Count;			/**< Number of queued operations */
+	u32 InFlight;			/**< Operations started on the ZDMA */
+	u32 MaxBatch;			/**< Descriptors available */
+	XZDma_Transfer Xfer[XZDMA_ASYNC_MAX_BATCH];
+					/**< Transfers of the current start */
+	u32 Completed;			/**< Started operations completed,
+					  *  set by the ZDMA driver handlers */
+	s32 CompleteStatus;		/**< Status of the completed
+					  *  operations */
+} XZDma_AsyncChan;
+
+/**
+ * Asynchronous memory copy service
+ */
+typedef struct {
+	XZDma_AsyncChan Chan[XZDMA_ASYNC_MAX_CHANNELS];
+					/**< Channels of the service */
+	u32 NumChans;			/**< Number of channels added */
+	u32 NextChan;			/**< Next channel to be used */
+	u32 CpuThreshold;		/**< Copies below this size are done
+					  *  by the processor */
+} XZDma_Async;
+
+/************************ Prototypes of functions **************************/
+
+void XZDma_AsyncInitialize(XZDma_Async *AsyncPtr);
+s32 XZDma_AsyncAddChannel(XZDma_Async *AsyncPtr, XZDma *InstancePtr,
+		UINTPTR DscrMemPtr);
+void XZDma_AsyncSetCpuThreshold(XZDma_Async *AsyncPtr, u32 Threshold);
+s32 XZDma_AsyncMemcpy(XZDma_Async *AsyncPtr, XZDma_AsyncReq *ReqPtr,
+		UINTPTR DstAddr, UINTPTR SrcAddr, u32 Size,
+		XZDma_AsyncHandler Handler, void *CallBackRef);
+s32 XZDma_AsyncMemset(XZDma_Async *AsyncPtr, XZDma_AsyncReq *ReqPtr,
+		UINTPTR DstAddr, u8 Value, u32 Size,
+		XZDma_AsyncHandler Handler, void *CallBackRef);
+void XZDma_AsyncIntrHandler(void *Instance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XZDMA_ASYNC_H_ */
+/** @} */
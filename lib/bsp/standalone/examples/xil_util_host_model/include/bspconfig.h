@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* The host build has no BSP configuration.
+*
+******************************************************************************/
+#ifndef XIL_UTIL_MODEL_BSPCONFIG_H_
+#define XIL_UTIL_MODEL_BSPCONFIG_H_
+
+#endif /* XIL_UTIL_MODEL_BSPCONFIG_H_ */
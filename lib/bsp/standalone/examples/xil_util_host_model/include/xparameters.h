@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* The host build has no hardware parameters.
+*
+******************************************************************************/
+#ifndef XIL_UTIL_MODEL_XPARAMETERS_H_
+#define XIL_UTIL_MODEL_XPARAMETERS_H_
+
+#endif /* XIL_UTIL_MODEL_XPARAMETERS_H_ */
@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpseudo_asm.h
+*
+* The host build uses no processor instructions.
+*
+******************************************************************************/
+#ifndef XIL_UTIL_MODEL_XPSEUDO_ASM_H_
+#define XIL_UTIL_MODEL_XPSEUDO_ASM_H_
+
+#endif /* XIL_UTIL_MODEL_XPSEUDO_ASM_H_ */
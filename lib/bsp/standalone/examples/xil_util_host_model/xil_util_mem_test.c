@@ -0,0 +1,400 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_util_mem_test.c
+*
+* This file contains the host test of the word by word versions of
+* Xil_SecureMemCpy, Xil_MemCmp, Xil_SecureZeroize and Xil_SMemCmp_CT.
+*
+* - Random cases, with all the relative alignments of the buffers, lengths
+*   around the word size and destination lengths shorter than the copy,
+*   give the same results and buffers as the byte by byte versions.
+* - A dudect-style timing test times Xil_SMemCmp_CT on buffers which differ
+*   only in their last byte and on random buffers, in pairs. Both classes
+*   fail the compare, so only the position of the first mismatch differs.
+*   The mean time difference must be below 1% of the time. The same test
+*   on Xil_MemCmp, which returns at the first mismatch, must find a
+*   difference above 10%, which checks that the test detects a leak.
+* - The time of both versions of each helper on 4 KiB buffers, and of
+*   Xil_SMemCmp_CT on 64 bytes, is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 7.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_util.h"
+#include "xil_util_ref.h"
+
+/************************** Constant Definitions *****************************/
+#define BUF_LEN			(640U)
+#define MAX_OFFSET		(16U)
+#define MAX_CASE_LEN		(300U)
+#define NUM_CASES		(200000U)
+#define CT_LEN			(1024U)
+#define CT_MEASUREMENTS		(200000U)
+#define CT_POOL			(64U)	/**< Inputs prepared before the timing */
+#define CT_CROP_PERCENT		(90U)	/**< Measurements kept by the t-test */
+#define CT_MAX_DIFF		(0.01)	/**< Largest relative time difference
+					  *  of a constant time compare */
+#define CT_MIN_LEAK		(0.10)	/**< Smallest relative time difference
+					  *  expected from an early exit */
+#define PERF_LEN		(4096U)
+#define PERF_SMALL_LEN		(64U)
+#define PERF_RUNS		(4000U)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond) \
+	if (!(Cond)) { \
+		printf("%s line %d: %s\r\n", __func__, __LINE__, #Cond); \
+		return XST_FAILURE; \
+	}
+
+/**************************** Type Definitions *******************************/
+typedef int (*CmpFunc)(const u8 *Buf1, const u8 *Buf2, u32 Len);
+
+typedef struct {
+	double T;	/**< t statistic of the time differences */
+	double Diff;	/**< Mean time difference, relative to the mean time */
+} CtResult;
+
+/************************** Variable Definitions *****************************/
+static u8 Src[BUF_LEN] __attribute__((aligned(16)));
+static u8 Dst[BUF_LEN] __attribute__((aligned(16)));
+static u8 RefDst[BUF_LEN] __attribute__((aligned(16)));
+static u8 PerfSrc[PERF_LEN] __attribute__((aligned(16)));
+static u8 PerfDst[PERF_LEN] __attribute__((aligned(16)));
+static u8 CtBuf1[CT_LEN] __attribute__((aligned(16)));
+static u8 CtInput[CT_POOL][CT_LEN] __attribute__((aligned(16)));
+static u32 CtTime[CT_MEASUREMENTS * 2U];
+static u8 CtIndex[CT_MEASUREMENTS];
+static u8 CtOrder[CT_MEASUREMENTS];
+static volatile int Sink;
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time in ns of a monotonic clock.
+*
+******************************************************************************/
+static u64 TimeNs(void)
+{
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((u64)Now.tv_sec * 1000000000ULL) + (u64)Now.tv_nsec;
+}
+
+static void FillRandom(u8 *Buf, u32 Len)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		Buf[Index] = (u8)rand();
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares the results of both versions of each helper on
+* random cases.
+*
+******************************************************************************/
+static int TestEquivalence(void)
+{
+	u32 Case;
+	u32 SrcOffset;
+	u32 DstOffset;
+	u32 Len;
+	u32 DstLen;
+	u32 Size1;
+	u32 Size2;
+	u32 Pos;
+
+	for (Case = 0U; Case < NUM_CASES; Case++) {
+		SrcOffset = (u32)rand() % MAX_OFFSET;
+		DstOffset = ((Case % 2U) == 0U) ? SrcOffset :
+			((u32)rand() % MAX_OFFSET);
+		Len = ((Case % 4U) < 2U) ? ((u32)rand() % 20U) :
+			((u32)rand() % MAX_CASE_LEN);
+		DstLen = ((Case % 8U) == 7U) ? ((u32)rand() % (Len + 1U)) : Len;
+		FillRandom(Src, BUF_LEN);
+		FillRandom(Dst, BUF_LEN);
+		memcpy(RefDst, Dst, BUF_LEN);
+
+		/* Copy, including the zero fill of a short destination */
+		CHECK(Xil_SecureMemCpy(&Dst[DstOffset], DstLen, &Src[SrcOffset],
+			Len) == XilRef_SecureMemCpy(&RefDst[DstOffset], DstLen,
+			&Src[SrcOffset], Len));
+		CHECK(memcmp(Dst, RefDst, BUF_LEN) == 0);
+
+		/* Compare equal data, or data with one or two differences */
+		memcpy(&Dst[DstOffset], &Src[SrcOffset], Len);
+		if (((Case % 3U) != 0U) && (Len != 0U)) {
+			Pos = (u32)rand() % Len;
+			Dst[DstOffset + Pos] ^= (u8)(1U + ((u32)rand() % 255U));
+			if ((Case % 3U) == 2U) {
+				Pos = (u32)rand() % Len;
+				Dst[DstOffset + Pos] ^= (u8)rand();
+			}
+		}
+		CHECK(Xil_MemCmp(&Src[SrcOffset], &Dst[DstOffset], Len) ==
+			XilRef_MemCmp(&Src[SrcOffset], &Dst[DstOffset], Len));
+		Size1 = ((Case % 16U) == 5U) ? ((u32)rand() % (Len + 1U)) : Len;
+		Size2 = ((Case % 16U) == 6U) ? ((u32)rand() % (Len + 1U)) : Len;
+		CHECK(Xil_SMemCmp_CT(&Src[SrcOffset], Size1, &Dst[DstOffset],
+			Size2, Len) == XilRef_SMemCmp_CT(&Src[SrcOffset], Size1,
+			&Dst[DstOffset], Size2, Len));
+
+		/* Zeroize, the bytes around the buffer are kept */
+		memcpy(RefDst, Dst, BUF_LEN);
+		CHECK(Xil_SecureZeroize(&Dst[DstOffset], Len) ==
+			XilRef_SecureZeroize(&RefDst[DstOffset], Len));
+		CHECK(memcmp(Dst, RefDst, BUF_LEN) == 0);
+	}
+
+	printf("%u random cases give the same results\r\n", (unsigned)NUM_CASES);
+
+	return XST_SUCCESS;
+}
+
+static int CmpCt(const u8 *Buf1, const u8 *Buf2, u32 Len)
+{
+	return Xil_SMemCmp_CT(Buf1, Len, Buf2, Len, Len);
+}
+
+static int CmpEarlyExit(const u8 *Buf1, const u8 *Buf2, u32 Len)
+{
+	return Xil_MemCmp(Buf1, Buf2, Len);
+}
+
+static int CompareTime(const void *Time1, const void *Time2)
+{
+	u32 Value1 = *(const u32 *)Time1;
+	u32 Value2 = *(const u32 *)Time2;
+
+	return (Value1 > Value2) - (Value1 < Value2);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures the time of a compare function on buffers which
+* differ from CtBuf1 in their last byte (class 0) and on random buffers
+* (class 1). As in dudect, the inputs of both classes are prepared before
+* the timing. Each measurement times one input of each class, back to back
+* in random order, so that the slow changes of the host speed cancel out.
+* The t statistic and the mean relative difference are computed on the
+* measurements whose times are below the CT_CROP_PERCENT percentile.
+*
+******************************************************************************/
+static void PairedT(CmpFunc Func, CtResult *Result)
+{
+	static u32 Sorted[CT_MEASUREMENTS * 2U];
+	double Sum = 0.0;
+	double SumSq = 0.0;
+	double SumTime = 0.0;
+	double Count = 0.0;
+	double Diff;
+	double Mean;
+	u32 Crop;
+	u32 Index;
+	u32 First;
+	u32 Input;
+	u64 Start;
+
+	FillRandom(CtBuf1, CT_LEN);
+	for (Index = 0U; Index < CT_POOL; Index++) {
+		if ((Index % 2U) == 0U) {
+			memcpy(CtInput[Index], CtBuf1, CT_LEN);
+			CtInput[Index][CT_LEN - 1U] ^= 1U;
+		}
+		else {
+			FillRandom(CtInput[Index], CT_LEN);
+		}
+	}
+	for (Index = 0U; Index < CT_MEASUREMENTS; Index++) {
+		CtOrder[Index] = (u8)((u32)rand() & 1U);
+		CtIndex[Index] = (u8)((u32)rand() % (CT_POOL / 2U));
+	}
+	for (Index = 0U; Index < CT_MEASUREMENTS; Index++) {
+		First = CtOrder[Index];
+		/* Even inputs are of class 0, odd inputs of class 1 */
+		Input = (2U * CtIndex[Index]) + First;
+		Start = TimeNs();
+		Sink = Func(CtBuf1, CtInput[Input], CT_LEN);
+		CtTime[(2U * Index) + First] = (u32)(TimeNs() - Start);
+		Input ^= 1U;
+		Start = TimeNs();
+		Sink = Func(CtBuf1, CtInput[Input], CT_LEN);
+		CtTime[(2U * Index) + (First ^ 1U)] = (u32)(TimeNs() - Start);
+	}
+
+	memcpy(Sorted, CtTime, sizeof(Sorted));
+	qsort(Sorted, CT_MEASUREMENTS * 2U, sizeof(u32), CompareTime);
+	Crop = Sorted[((CT_MEASUREMENTS * 2U) / 100U) * CT_CROP_PERCENT];
+
+	for (Index = 0U; Index < CT_MEASUREMENTS; Index++) {
+		if ((CtTime[2U * Index] <= Crop) &&
+			(CtTime[(2U * Index) + 1U] <= Crop)) {
+			Diff = (double)CtTime[2U * Index] -
+				(double)CtTime[(2U * Index) + 1U];
+			Count += 1.0;
+			Sum += Diff;
+			SumTime += (double)CtTime[2U * Index] +
+				(double)CtTime[(2U * Index) + 1U];
+			SumSq += Diff * Diff;
+		}
+	}
+	Mean = Sum / Count;
+
+	Result->T = Mean / sqrt(((SumSq / Count) - (Mean * Mean)) / Count);
+	Result->Diff = Mean / (SumTime / (2.0 * Count));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks that the time of Xil_SMemCmp_CT does not depend on
+* the data, and that the test sees the time of Xil_MemCmp depend on it.
+*
+******************************************************************************/
+static int TestConstantTime(void)
+{
+	CtResult Ct;
+	CtResult EarlyExit;
+
+	PairedT(CmpCt, &Ct);
+	PairedT(CmpEarlyExit, &EarlyExit);
+	printf("Paired t on %u bytes, last byte vs random: Xil_SMemCmp_CT "
+		"t=%.2f diff=%.2f%%, Xil_MemCmp t=%.2f diff=%.2f%%\r\n",
+		(unsigned)CT_LEN, Ct.T, 100.0 * Ct.Diff, EarlyExit.T,
+		100.0 * EarlyExit.Diff);
+	CHECK(fabs(Ct.Diff) < CT_MAX_DIFF);
+	CHECK(EarlyExit.Diff > CT_MIN_LEAK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time of both versions of each helper.
+*
+******************************************************************************/
+static void PrintPerf(const char *Name, u64 RefNs, u64 Ns)
+{
+	printf("%-32s %8.1f ns byte by byte, %8.1f ns by words, %.1fx\r\n",
+		Name, (double)RefNs / PERF_RUNS, (double)Ns / PERF_RUNS,
+		(double)RefNs / (double)Ns);
+}
+
+static void TestPerformance(void)
+{
+	u64 Start;
+	u64 RefNs;
+	u32 Run;
+
+	FillRandom(PerfSrc, PERF_LEN);
+
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = XilRef_SecureMemCpy(PerfDst, PERF_LEN, PerfSrc, PERF_LEN);
+	}
+	RefNs = TimeNs() - Start;
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = Xil_SecureMemCpy(PerfDst, PERF_LEN, PerfSrc, PERF_LEN);
+	}
+	PrintPerf("Xil_SecureMemCpy 4 KiB", RefNs, TimeNs() - Start);
+
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = XilRef_MemCmp(PerfDst, PerfSrc, PERF_LEN);
+	}
+	RefNs = TimeNs() - Start;
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = Xil_MemCmp(PerfDst, PerfSrc, PERF_LEN);
+	}
+	PrintPerf("Xil_MemCmp 4 KiB", RefNs, TimeNs() - Start);
+
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = XilRef_SecureZeroize(PerfDst, PERF_LEN);
+	}
+	RefNs = TimeNs() - Start;
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = Xil_SecureZeroize(PerfDst, PERF_LEN);
+	}
+	PrintPerf("Xil_SecureZeroize 4 KiB", RefNs, TimeNs() - Start);
+
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = XilRef_SMemCmp_CT(PerfDst, PERF_LEN, PerfSrc, PERF_LEN,
+			PERF_LEN);
+	}
+	RefNs = TimeNs() - Start;
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = Xil_SMemCmp_CT(PerfDst, PERF_LEN, PerfSrc, PERF_LEN,
+			PERF_LEN);
+	}
+	PrintPerf("Xil_SMemCmp_CT 4 KiB", RefNs, TimeNs() - Start);
+
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = XilRef_SMemCmp_CT(PerfDst, PERF_SMALL_LEN, PerfSrc,
+			PERF_SMALL_LEN, PERF_SMALL_LEN);
+	}
+	RefNs = TimeNs() - Start;
+	Start = TimeNs();
+	for (Run = 0U; Run < PERF_RUNS; Run++) {
+		Sink = Xil_SMemCmp_CT(PerfDst, PERF_SMALL_LEN, PerfSrc,
+			PERF_SMALL_LEN, PERF_SMALL_LEN);
+	}
+	PrintPerf("Xil_SMemCmp_CT 64 B", RefNs, TimeNs() - Start);
+}
+
+int main(void)
+{
+	int Status = XST_FAILURE;
+
+	srand(1U);
+	Status = TestEquivalence();
+	if (Status == XST_SUCCESS) {
+		Status = TestConstantTime();
+	}
+	if (Status == XST_SUCCESS) {
+		TestPerformance();
+	}
+
+	if (Status != XST_SUCCESS) {
+		printf("xil_util memory test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran xil_util memory test\r\n");
+	return 0;
+}
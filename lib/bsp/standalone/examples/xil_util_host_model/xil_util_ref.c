@@ -0,0 +1,164 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_util_ref.c
+*
+* This file contains the byte by byte versions of Xil_SecureMemCpy,
+* Xil_MemCmp, Xil_SecureZeroize and Xil_SMemCmp_CT of xil_util.c 7.7, before
+* the native word accesses. The test compares the current versions with
+* them.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 7.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xil_util_ref.h"
+
+/************************** Function Definitions *****************************/
+
+int XilRef_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr, u32 Len)
+{
+	int Status = XST_FAILURE;
+	u8 *Dest = (u8 *)DestPtr;
+	const u8 *Src = (const u8 *)SrcPtr;
+
+	if ((DestPtr == NULL) || (SrcPtr == NULL)) {
+		goto END;
+	}
+
+	if (Len > DestPtrLen) {
+		while (DestPtrLen != 0U) {
+			*Dest = 0U;
+			Dest++;
+			DestPtrLen--;
+		}
+		goto END;
+	}
+
+	/* Loop and copy.  */
+	while (Len != 0U) {
+		*Dest = *Src;
+		Dest++;
+		Src++;
+		Len--;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+int XilRef_MemCmp(const void * Buf1Ptr, const void * Buf2Ptr, u32 Len)
+{
+	volatile int RetVal = 1;
+	const u8 *Buf1 = Buf1Ptr;
+	const u8 *Buf2 = Buf2Ptr;
+	u32 Size = Len;
+
+	/* Assert validates the input arguments */
+	if ((Buf1 == NULL) || (Buf2 == NULL) || (Len == 0x0U)) {
+		goto END;
+	}
+
+	/* Loop and compare */
+	while (Size != 0U) {
+		if (*Buf1 > *Buf2) {
+			RetVal = 1;
+			goto END;
+		} else if (*Buf1 < *Buf2) {
+			RetVal = -1;
+			goto END;
+		} else {
+			Buf1++;
+			Buf2++;
+			Size--;
+		}
+	}
+
+	/* Make sure size is zero to know the whole of data is compared */
+	if (Size == 0U) {
+		RetVal = 0;
+	}
+
+END:
+	return RetVal;
+}
+
+int XilRef_SecureZeroize(u8 *DataPtr, const u32 Length)
+{
+	u32 Index;
+	int Status = XST_FAILURE;
+
+	/* Clear the data */
+	(void)memset(DataPtr, 0, Length);
+
+	/* Read it back to verify */
+	 for (Index = 0U; Index < Length; Index++) {
+		if (DataPtr[Index] != 0x00U) {
+			goto END;
+		}
+	}
+	if (Index == Length) {
+		Status = XST_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
+int XilRef_SMemCmp_CT(const void *Src1, const u32 Src1Size,
+	const void *Src2, const u32 Src2Size, const u32 CmpLen)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int StatusRedundant = XST_FAILURE;
+	volatile u32 Data = 0U;
+	volatile u32 DataRedundant = 0xFFFFFFFFU;
+	u32 Cnt = CmpLen;
+	const u8 *Src_1 = (const u8 *)Src1;
+	const u8 *Src_2 = (const u8 *)Src2;
+
+
+	if ((Src1 == NULL) || (Src2 == NULL)) {
+		Status =  XST_INVALID_PARAM;
+	}
+	else if ((CmpLen == 0U) || (Src1Size < CmpLen) || (Src2Size < CmpLen)) {
+		Status =  XST_INVALID_PARAM;
+	}
+	else {
+		while (Cnt >= sizeof(u32)) {
+			Data |= (*(const u32 *)Src_1 ^ *(const u32 *)Src_2);
+			DataRedundant &= ~Data;
+			Src_1 += sizeof(u32);
+			Src_2 += sizeof(u32);
+			Cnt -= sizeof(u32);
+		}
+
+		while (Cnt > 0U) {
+			Data |= (u32)(*Src_1 ^ *Src_2);
+			DataRedundant &= ~Data;
+			Src_1++;
+			Src_2++;
+			Cnt--;
+		}
+
+		if ((Data == 0U) && (DataRedundant == 0xFFFFFFFFU)) {
+			Status = XST_SUCCESS;
+			StatusRedundant = XST_SUCCESS;
+		}
+	}
+
+	return (Status | StatusRedundant);
+}
@@ -0,0 +1,38 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_util_ref.h
+*
+* This file contains the prototypes of the byte by byte reference versions
+* of the secure memory helpers of xil_util.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 7.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef XIL_UTIL_REF_H_
+#define XIL_UTIL_REF_H_
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Function Prototypes ******************************/
+int XilRef_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr,
+	u32 Len);
+int XilRef_MemCmp(const void * Buf1Ptr, const void * Buf2Ptr, u32 Len);
+int XilRef_SecureZeroize(u8 *DataPtr, const u32 Length);
+int XilRef_SMemCmp_CT(const void *Src1, const u32 Src1Size,
+	const void *Src2, const u32 Src2Size, const u32 CmpLen);
+
+#endif /* XIL_UTIL_REF_H_ */
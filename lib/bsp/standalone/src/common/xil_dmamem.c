@@ -0,0 +1,459 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_dmamem.c
+*
+* This file contains the allocator of the DMA descriptor memory. See
+* xil_dmamem.h for a description of the region and of the size classes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 7.7   ag       10/19/26 First release.
+*       ag       10/19/26 Fail the allocations when the MPU region of the
+*                         Cortex-R5 can't be set.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xil_dmamem.h"
+#include "xparameters.h"
+#if !defined (XIL_DMAMEM_CACHEABLE)
+#if defined (ARMR5)
+#include "xil_mpu.h"
+#include "xreg_cortexr5.h"
+#elif defined (__aarch64__) || defined (__arm__)
+#include "xil_mmu.h"
+#endif
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#if defined (__aarch64__)
+#define XIL_DMAMEM_MMU_BLOCK	0x200000U	/* Translation table block */
+#else
+#define XIL_DMAMEM_MMU_BLOCK	0x100000U	/* Translation table section */
+#endif
+
+#if ((XIL_DMAMEM_SIZE % XIL_DMAMEM_PAGE_SIZE) != 0) || \
+	((XIL_DMAMEM_SIZE & (XIL_DMAMEM_SIZE - 1)) != 0)
+#error "XIL_DMAMEM_SIZE must be a power of two multiple of the page size"
+#endif
+#if !defined (XIL_DMAMEM_CACHEABLE) && !defined (ARMR5) && \
+	(defined (__aarch64__) || defined (__arm__)) && \
+	((XIL_DMAMEM_SIZE % XIL_DMAMEM_MMU_BLOCK) != 0)
+#error "XIL_DMAMEM_SIZE must be a multiple of the translation table block"
+#endif
+
+#define XIL_DMAMEM_MAP_WORDS	8U	/* Bitmap words, for the smallest
+					   size class */
+
+#define XIL_DMAMEM_PAGE_FREE		0U	/* Page not allocated */
+#define XIL_DMAMEM_PAGE_RUN_HEAD	(XIL_DMAMEM_NUM_CLASSES + 1U)
+					/* First page of a run */
+#define XIL_DMAMEM_PAGE_RUN_TAIL	(XIL_DMAMEM_NUM_CLASSES + 2U)
+					/* Other pages of a run */
+
+/**************************** Type Definitions ******************************/
+
+/* Page of the region */
+typedef struct {
+	u8 Kind;			/* Free, size class + 1, or run */
+	u16 Used;			/* Blocks allocated in the page */
+	u16 RunLen;			/* Pages of the run, first page only */
+	u32 Map[XIL_DMAMEM_MAP_WORDS];	/* Allocated blocks */
+} Xil_DmaMemPage;
+
+/************************** Function Prototypes *****************************/
+
+static s32 Xil_DmaMemInit(void);
+static void *Xil_DmaMemAllocBlock(u32 Class);
+static void *Xil_DmaMemAllocRun(u32 NumPages, u32 Align);
+
+/************************** Variable Definitions ****************************/
+
+#if defined (__ICCARM__)
+#pragma data_alignment = XIL_DMAMEM_SIZE
+static u8 DmaMemRegion[XIL_DMAMEM_SIZE];
+#else
+static u8 DmaMemRegion[XIL_DMAMEM_SIZE]
+	__attribute__ ((aligned (XIL_DMAMEM_SIZE)));
+#endif
+
+static const u32 DmaMemClassSize[XIL_DMAMEM_NUM_CLASSES] = {
+	0x100U, 0x1000U
+};
+
+static Xil_DmaMemPage DmaMemPages[XIL_DMAMEM_NUM_PAGES];
+static Xil_DmaMemStats DmaMemStats;
+static u8 DmaMemInitialized;
+
+/****************************************************************************/
+/**
+* @brief	This function makes the region non-cacheable.
+*
+* @return	- XST_SUCCESS if the region is ready.
+*		- XST_FAILURE if no MPU region is left on Cortex-R5. The
+*		drivers expect non-cacheable descriptors, so the region is
+*		not used and the function is tried again at the next
+*		allocation.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemInit(void)
+{
+#if !defined (XIL_DMAMEM_CACHEABLE)
+#if defined (ARMR5)
+	if (Xil_SetMPURegion((INTPTR)DmaMemRegion, XIL_DMAMEM_SIZE,
+			STRONG_ORDERD_SHARED | PRIV_RW_USER_RW) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	DmaMemStats.NonCacheable = 1U;
+#elif defined (__aarch64__) || defined (__arm__)
+	UINTPTR Addr;
+
+	for (Addr = (UINTPTR)DmaMemRegion;
+		Addr < ((UINTPTR)DmaMemRegion + XIL_DMAMEM_SIZE);
+		Addr += XIL_DMAMEM_MMU_BLOCK) {
+#if defined (__aarch64__)
+		Xil_SetTlbAttributes(Addr, NORM_NONCACHE | INNER_SHAREABLE);
+#else
+		Xil_SetTlbAttributes((INTPTR)Addr, DEVICE_MEMORY);
+#endif
+	}
+	DmaMemStats.NonCacheable = 1U;
+#endif
+#endif
+
+	DmaMemStats.BaseAddr = (UINTPTR)DmaMemRegion;
+	DmaMemStats.TotalBytes = XIL_DMAMEM_SIZE;
+	DmaMemInitialized = 1U;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function allocates a block of a size class, from the
+*		highest page holding a free block of that class.
+*
+* @param	Class: Size class.
+*
+* @return	Address of the block, or NULL if no page is available.
+*
+*****************************************************************************/
+static void *Xil_DmaMemAllocBlock(u32 Class)
+{
+	u32 Blocks = XIL_DMAMEM_PAGE_SIZE / DmaMemClassSize[Class];
+	u32 Kind = Class + 1U;
+	u32 Page = XIL_DMAMEM_NUM_PAGES;
+	u32 Index;
+	u32 Block;
+	Xil_DmaMemPage *PagePtr;
+
+	for (Index = XIL_DMAMEM_NUM_PAGES; Index > 0U; Index--) {
+		if ((DmaMemPages[Index - 1U].Kind == Kind) &&
+			(DmaMemPages[Index - 1U].Used < Blocks)) {
+			Page = Index - 1U;
+			break;
+		}
+	}
+
+	if (Page == XIL_DMAMEM_NUM_PAGES) {
+		for (Index = XIL_DMAMEM_NUM_PAGES; Index > 0U; Index--) {
+			if (DmaMemPages[Index - 1U].Kind ==
+					XIL_DMAMEM_PAGE_FREE) {
+				Page = Index - 1U;
+				break;
+			}
+		}
+		if (Page == XIL_DMAMEM_NUM_PAGES) {
+			return NULL;
+		}
+		(void)memset(&DmaMemPages[Page], 0, sizeof(Xil_DmaMemPage));
+		DmaMemPages[Page].Kind = (u8)Kind;
+	}
+
+	PagePtr = &DmaMemPages[Page];
+	for (Block = 0U; Block < Blocks; Block++) {
+		if ((PagePtr->Map[Block / 32U] & (1U << (Block % 32U))) == 0U) {
+			break;
+		}
+	}
+
+	PagePtr->Map[Block / 32U] |= (1U << (Block % 32U));
+	PagePtr->Used++;
+	DmaMemStats.ClassBlocks[Class]++;
+
+	return &DmaMemRegion[(Page * XIL_DMAMEM_PAGE_SIZE) +
+			(Block * DmaMemClassSize[Class])];
+}
+
+/****************************************************************************/
+/**
+* @brief	This function allocates a run of free pages, starting from the
+*		bottom of the region.
+*
+* @param	NumPages: Number of pages.
+* @param	Align: Alignment of the run.
+*
+* @return	Address of the first page, or NULL if no run is available.
+*
+*****************************************************************************/
+static void *Xil_DmaMemAllocRun(u32 NumPages, u32 Align)
+{
+	u32 Step = 1U;
+	u32 Start;
+	u32 Index;
+
+	if (Align > XIL_DMAMEM_PAGE_SIZE) {
+		Step = Align / XIL_DMAMEM_PAGE_SIZE;
+	}
+
+	for (Start = 0U; (Start + NumPages) <= XIL_DMAMEM_NUM_PAGES;
+			Start += Step) {
+		for (Index = 0U; Index < NumPages; Index++) {
+			if (DmaMemPages[Start + Index].Kind !=
+					XIL_DMAMEM_PAGE_FREE) {
+				break;
+			}
+		}
+		if (Index == NumPages) {
+			break;
+		}
+	}
+
+	if ((Start + NumPages) > XIL_DMAMEM_NUM_PAGES) {
+		return NULL;
+	}
+
+	for (Index = 0U; Index < NumPages; Index++) {
+		DmaMemPages[Start + Index].Kind = (u8)XIL_DMAMEM_PAGE_RUN_TAIL;
+	}
+	DmaMemPages[Start].Kind = (u8)XIL_DMAMEM_PAGE_RUN_HEAD;
+	DmaMemPages[Start].RunLen = (u16)NumPages;
+	DmaMemStats.RunPages += NumPages;
+
+	return &DmaMemRegion[Start * XIL_DMAMEM_PAGE_SIZE];
+}
+
+/****************************************************************************/
+/**
+* @brief	This function returns the number of bytes of the region used
+*		by an allocation.
+*
+* @param	Size: Size of the allocation in bytes.
+* @param	Align: Alignment of the allocation, a power of two. 0 selects
+*		XIL_DMAMEM_MIN_ALIGN.
+*
+* @return	Size of the block, 0 if the allocation can never succeed.
+*
+*****************************************************************************/
+u32 Xil_DmaMemGetBlockSize(u32 Size, u32 Align)
+{
+	u32 Need = Size;
+	u32 BlockSize = 0U;
+	u32 Class;
+
+	if ((Size == 0U) || ((Align & (Align - 1U)) != 0U) ||
+		(Size > XIL_DMAMEM_SIZE) || (Align > XIL_DMAMEM_SIZE)) {
+		goto END;
+	}
+
+	if (Need < Align) {
+		Need = Align;
+	}
+
+	for (Class = 0U; Class < XIL_DMAMEM_NUM_CLASSES; Class++) {
+		if (Need <= DmaMemClassSize[Class]) {
+			BlockSize = DmaMemClassSize[Class];
+			goto END;
+		}
+	}
+
+	BlockSize = (Need + XIL_DMAMEM_PAGE_SIZE - 1U) &
+			~(XIL_DMAMEM_PAGE_SIZE - 1U);
+
+END:
+	return BlockSize;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function allocates cleared memory for DMA descriptors.
+*		The region is made non-cacheable at the first call.
+*
+* @param	Size: Size in bytes.
+* @param	Align: Alignment in bytes, a power of two. Every allocation
+*		is aligned to at least XIL_DMAMEM_MIN_ALIGN bytes.
+*
+* @return	Address of the memory, or NULL if the request is invalid, no
+*		memory is available, or the region can't be made
+*		non-cacheable.
+*
+*****************************************************************************/
+void *Xil_DmaMemAlloc(u32 Size, u32 Align)
+{
+	void *Ptr = NULL;
+	u32 BlockSize;
+	u32 Class;
+
+	if ((DmaMemInitialized == 0U) && (Xil_DmaMemInit() != XST_SUCCESS)) {
+		goto END;
+	}
+
+	BlockSize = Xil_DmaMemGetBlockSize(Size, Align);
+	if (BlockSize == 0U) {
+		goto END;
+	}
+
+	for (Class = 0U; Class < XIL_DMAMEM_NUM_CLASSES; Class++) {
+		if (BlockSize == DmaMemClassSize[Class]) {
+			break;
+		}
+	}
+
+	if (Class < XIL_DMAMEM_NUM_CLASSES) {
+		Ptr = Xil_DmaMemAllocBlock(Class);
+	} else {
+		Ptr = Xil_DmaMemAllocRun(BlockSize / XIL_DMAMEM_PAGE_SIZE,
+				Align);
+	}
+
+	if (Ptr != NULL) {
+		(void)memset(Ptr, 0, BlockSize);
+		DmaMemStats.UsedBytes += BlockSize;
+		if (DmaMemStats.UsedBytes > DmaMemStats.PeakBytes) {
+			DmaMemStats.PeakBytes = DmaMemStats.UsedBytes;
+		}
+		DmaMemStats.Allocs++;
+	}
+
+END:
+	if (Ptr == NULL) {
+		DmaMemStats.Failures++;
+	}
+
+	return Ptr;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function frees memory allocated with Xil_DmaMemAlloc().
+*		The DMA engine must not use the descriptors anymore.
+*
+* @param	Ptr: Address returned by Xil_DmaMemAlloc().
+*
+* @return	- XST_SUCCESS if the memory is freed.
+*		- XST_INVALID_PARAM if Ptr is not an allocated address.
+*
+*****************************************************************************/
+s32 Xil_DmaMemFree(void *Ptr)
+{
+	s32 Status = XST_INVALID_PARAM;
+	UINTPTR Addr = (UINTPTR)Ptr;
+	UINTPTR Offset;
+	Xil_DmaMemPage *PagePtr;
+	u32 Page;
+	u32 Class;
+	u32 Block;
+	u32 Index;
+
+	if ((Addr < (UINTPTR)DmaMemRegion) ||
+		(Addr >= ((UINTPTR)DmaMemRegion + XIL_DMAMEM_SIZE))) {
+		goto END;
+	}
+
+	Offset = Addr - (UINTPTR)DmaMemRegion;
+	Page = (u32)(Offset / XIL_DMAMEM_PAGE_SIZE);
+	PagePtr = &DmaMemPages[Page];
+
+	if (PagePtr->Kind == (u8)XIL_DMAMEM_PAGE_RUN_HEAD) {
+		if ((Offset % XIL_DMAMEM_PAGE_SIZE) != 0U) {
+			goto END;
+		}
+		for (Index = 0U; Index < PagePtr->RunLen; Index++) {
+			DmaMemPages[Page + Index].Kind =
+					(u8)XIL_DMAMEM_PAGE_FREE;
+		}
+		DmaMemStats.RunPages -= PagePtr->RunLen;
+		DmaMemStats.UsedBytes -= (u32)PagePtr->RunLen *
+				XIL_DMAMEM_PAGE_SIZE;
+		PagePtr->RunLen = 0U;
+	} else if ((PagePtr->Kind != (u8)XIL_DMAMEM_PAGE_FREE) &&
+		(PagePtr->Kind <= (u8)XIL_DMAMEM_NUM_CLASSES)) {
+		Class = (u32)PagePtr->Kind - 1U;
+		if ((Offset % DmaMemClassSize[Class]) != 0U) {
+			goto END;
+		}
+		Block = (u32)(Offset % XIL_DMAMEM_PAGE_SIZE) /
+				DmaMemClassSize[Class];
+		if ((PagePtr->Map[Block / 32U] & (1U << (Block % 32U))) == 0U) {
+			goto END;
+		}
+		PagePtr->Map[Block / 32U] &= ~(1U << (Block % 32U));
+		PagePtr->Used--;
+		if (PagePtr->Used == 0U) {
+			PagePtr->Kind = (u8)XIL_DMAMEM_PAGE_FREE;
+		}
+		DmaMemStats.ClassBlocks[Class]--;
+		DmaMemStats.UsedBytes -= DmaMemClassSize[Class];
+	} else {
+		goto END;
+	}
+
+	DmaMemStats.Frees++;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function returns the usage of the descriptor memory.
+*
+* @param	StatsPtr: Pointer to the structure to be filled.
+*
+* @return	None.
+*
+*****************************************************************************/
+void Xil_DmaMemGetStats(Xil_DmaMemStats *StatsPtr)
+{
+	u32 Index;
+	u32 Run = 0U;
+
+	if (StatsPtr == NULL) {
+		return;
+	}
+
+	*StatsPtr = DmaMemStats;
+	StatsPtr->BaseAddr = (UINTPTR)DmaMemRegion;
+	StatsPtr->TotalBytes = XIL_DMAMEM_SIZE;
+	StatsPtr->FreePages = 0U;
+	StatsPtr->LargestFreeRun = 0U;
+
+	for (Index = 0U; Index < XIL_DMAMEM_NUM_PAGES; Index++) {
+		if (DmaMemPages[Index].Kind == (u8)XIL_DMAMEM_PAGE_FREE) {
+			StatsPtr->FreePages++;
+			Run++;
+			if ((Run * XIL_DMAMEM_PAGE_SIZE) >
+					StatsPtr->LargestFreeRun) {
+				StatsPtr->LargestFreeRun =
+					Run * XIL_DMAMEM_PAGE_SIZE;
+			}
+		} else {
+			Run = 0U;
+		}
+	}
+}
@@ -0,0 +1,140 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_dmamem.h
+*
+* @addtogroup common_dmamem_api DMA Descriptor Memory APIs
+*
+* The xil_dmamem.h file contains the allocator of the memory used by the DMA
+* drivers for their scatter gather descriptors. Instead of every driver or
+* library reserving its own aligned array and changing the memory attributes
+* of it, the descriptors of all the DMA engines are allocated from a single
+* region, which is made non-cacheable once.
+*
+* - The region is XIL_DMAMEM_SIZE bytes, aligned to its size. The default size
+*   is one translation table block, 2MB for Cortex-A53/A72 64-bit and 1MB for
+*   the other processors. The region is made non-cacheable at the first
+*   allocation: with Xil_SetTlbAttributes() on the processors with a MMU,
+*   and with a MPU region on Cortex-R5. If no MPU region is left, the
+*   allocations fail instead of returning cacheable memory. MicroBlaze has
+*   no MMU, the region is cacheable and the drivers flush their descriptors
+*   as usual. Define XIL_DMAMEM_CACHEABLE to keep the region cacheable, for
+*   DMA engines which are cache coherent.
+* - The region is linked only into the applications which call
+*   Xil_DmaMemAlloc(), directly or through the pool functions of the DMA
+*   drivers, which are in their own source files.
+* - The region is divided in pages of XIL_DMAMEM_PAGE_SIZE bytes. A page is
+*   either split in blocks of one of the size classes, or belongs to a run of
+*   pages of a single larger allocation. Small allocations are taken from the
+*   top of the region and runs from the bottom, which limits fragmentation.
+* - Every allocation is aligned to its block size, so to at least
+*   XIL_DMAMEM_MIN_ALIGN bytes. A larger power of two alignment can be
+*   requested, the XIL_DMAMEM_ALIGN_* constants give the descriptor alignment
+*   of the DMA engines.
+* - The memory is cleared by Xil_DmaMemAlloc().
+* - The usage of the region is returned by Xil_DmaMemGetStats().
+*
+* The allocator is meant to be used while the drivers are initialized and is
+* not thread safe.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 7.7   ag       10/19/26 First release.
+*       ag       10/19/26 Fail the allocations when the MPU region of the
+*                         Cortex-R5 can't be set, AXI Ethernet alignment
+*                         set to the one of the lwIP port.
+*
+* </pre>
+*
+*****************************************************************************/
+
+#ifndef XIL_DMAMEM_H		/* prevent circular inclusions */
+#define XIL_DMAMEM_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ****************************/
+
+#ifndef XIL_DMAMEM_SIZE
+#if defined (__aarch64__)
+#define XIL_DMAMEM_SIZE		0x200000U	/**< Size of the region */
+#else
+#define XIL_DMAMEM_SIZE		0x100000U	/**< Size of the region */
+#endif
+#endif
+
+#define XIL_DMAMEM_PAGE_SIZE	0x10000U	/**< Size of a page */
+#define XIL_DMAMEM_NUM_PAGES	(XIL_DMAMEM_SIZE / XIL_DMAMEM_PAGE_SIZE)
+						/**< Pages of the region */
+#define XIL_DMAMEM_NUM_CLASSES	2U		/**< Size classes below the
+						  *  page size */
+#define XIL_DMAMEM_MIN_ALIGN	0x40U		/**< Minimum alignment */
+
+/**
+ * @name Descriptor alignment of the DMA engines
+ * @{
+ */
+#define XIL_DMAMEM_ALIGN_AXIDMA		0x40U	/**< AXI DMA */
+#define XIL_DMAMEM_ALIGN_MCDMA		0x40U	/**< AXI MCDMA */
+#define XIL_DMAMEM_ALIGN_ZDMA		0x40U	/**< ZDMA linked list */
+#define XIL_DMAMEM_ALIGN_EMACPS		0x80U	/**< GEM, twice the minimum
+						  *  alignment as in lwIP */
+#define XIL_DMAMEM_ALIGN_AXIETHERNET	0x80U	/**< AXI Ethernet DMA, twice
+						  *  the minimum alignment as
+						  *  in lwIP */
+/** @} */
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Usage of the descriptor memory region
+ */
+typedef struct {
+	UINTPTR BaseAddr;	/**< Base address of the region */
+	u32 TotalBytes;		/**< Size of the region */
+	u32 UsedBytes;		/**< Bytes allocated, rounded up to the
+				  *  block size */
+	u32 PeakBytes;		/**< Highest value of UsedBytes */
+	u32 FreePages;		/**< Pages not used by any allocation */
+	u32 LargestFreeRun;	/**< Largest free contiguous area, in bytes,
+				  *  made of whole pages */
+	u32 ClassBlocks[XIL_DMAMEM_NUM_CLASSES];
+				/**< Blocks allocated per size class */
+	u32 RunPages;		/**< Pages allocated to runs */
+	u32 Allocs;		/**< Successful allocations */
+	u32 Frees;		/**< Successful frees */
+	u32 Failures;		/**< Allocations which failed */
+	u8 NonCacheable;	/**< Region is non-cacheable */
+} Xil_DmaMemStats;
+
+/************************** Function Prototypes *****************************/
+
+void *Xil_DmaMemAlloc(u32 Size, u32 Align);
+s32 Xil_DmaMemFree(void *Ptr);
+void Xil_DmaMemGetStats(Xil_DmaMemStats *StatsPtr);
+u32 Xil_DmaMemGetBlockSize(u32 Size, u32 Align);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_DMAMEM_H */
+/**
+* @} End of "addtogroup common_dmamem_api".
+*/
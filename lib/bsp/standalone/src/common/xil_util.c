@@ -73,6 +73,8 @@
 * 			  fix misra_c_2012_rule_13_3 violation.
 * 7.7	sk	 03/02/22 Update values from signed to unsigned to fix
 * 			  misra_c_2012_rule_10_4 violation.
+*       ag       10/19/26 Use native word accesses in Xil_SecureMemCpy,
+*                         Xil_MemCmp, Xil_SecureZeroize and Xil_SMemCmp_CT
 *
 * </pre>
 *
@@ -84,6 +86,9 @@
 
 /************************** Constant Definitions ****************************/
 #define MAX_NIBBLES			8U
+#define XIL_UTIL_WORD_SIZE		((u32)sizeof(UINTPTR))
+#define XIL_UTIL_WORD_MASK		((UINTPTR)XIL_UTIL_WORD_SIZE - 1U)
+#define XIL_UTIL_HALF_WORD_BITS		(XIL_UTIL_WORD_SIZE * 4U)
 
 /************************** Function Prototypes *****************************/
 
@@ -724,6 +729,17 @@ int Xil_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr, u32 Le
 	}
 
 	if (Len > DestPtrLen) {
+		while ((DestPtrLen != 0U) &&
+			(((UINTPTR)Dest & XIL_UTIL_WORD_MASK) != 0U)) {
+			*Dest = 0U;
+			Dest++;
+			DestPtrLen--;
+		}
+		while (DestPtrLen >= XIL_UTIL_WORD_SIZE) {
+			*(UINTPTR *)Dest = 0U;
+			Dest += XIL_UTIL_WORD_SIZE;
+			DestPtrLen -= XIL_UTIL_WORD_SIZE;
+		}
 		while (DestPtrLen != 0U) {
 			*Dest = 0U;
 			Dest++;
@@ -732,6 +748,22 @@ int Xil_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr, u32 Le
 		goto END;
 	}
 
+	/* Copy words if both buffers can be aligned together */
+	if ((((UINTPTR)Dest ^ (UINTPTR)Src) & XIL_UTIL_WORD_MASK) == 0U) {
+		while ((Len != 0U) && (((UINTPTR)Dest & XIL_UTIL_WORD_MASK) != 0U)) {
+			*Dest = *Src;
+			Dest++;
+			Src++;
+			Len--;
+		}
+		while (Len >= XIL_UTIL_WORD_SIZE) {
+			*(UINTPTR *)Dest = *(const UINTPTR *)Src;
+			Dest += XIL_UTIL_WORD_SIZE;
+			Src += XIL_UTIL_WORD_SIZE;
+			Len -= XIL_UTIL_WORD_SIZE;
+		}
+	}
+
 	/* Loop and copy.  */
 	while (Len != 0U) {
 		*Dest = *Src;
@@ -771,6 +803,23 @@ int Xil_MemCmp(const void * Buf1Ptr, const void * Buf2Ptr, u32 Len)
 		goto END;
 	}
 
+	/* Skip equal words, the loop below finds the first mismatching byte */
+	if ((((UINTPTR)Buf1 ^ (UINTPTR)Buf2) & XIL_UTIL_WORD_MASK) == 0U) {
+		while ((Size != 0U) && (((UINTPTR)Buf1 & XIL_UTIL_WORD_MASK) != 0U) &&
+			(*Buf1 == *Buf2)) {
+			Buf1++;
+			Buf2++;
+			Size--;
+		}
+		while ((Size >= XIL_UTIL_WORD_SIZE) &&
+			(((UINTPTR)Buf1 & XIL_UTIL_WORD_MASK) == 0U) &&
+			(*(const UINTPTR *)Buf1 == *(const UINTPTR *)Buf2)) {
+			Buf1 += XIL_UTIL_WORD_SIZE;
+			Buf2 += XIL_UTIL_WORD_SIZE;
+			Size -= XIL_UTIL_WORD_SIZE;
+		}
+	}
+
 	/* Loop and compare */
 	while (Size != 0U) {
 		if (*Buf1 > *Buf2) {
@@ -808,23 +857,36 @@ END:
  ********************************************************************************/
 int Xil_SecureZeroize(u8 *DataPtr, const u32 Length)
 {
-	u32 Index;
+	u32 Index = 0U;
 	int Status = XST_FAILURE;
+	UINTPTR Data = 0U;
+	const volatile u8 *Data8 = DataPtr;
 
 	/* Clear the data */
 	(void)memset(DataPtr, 0, Length);
 
-	/* Read it back to verify */
-	 for (Index = 0U; Index < Length; Index++) {
-		if (DataPtr[Index] != 0x00U) {
-			goto END;
-		}
+	/*
+	 * Read it back to verify. The reads are volatile so that they are not
+	 * folded with the memset above.
+	 */
+	while ((Index < Length) &&
+		(((UINTPTR)&Data8[Index] & XIL_UTIL_WORD_MASK) != 0U)) {
+		Data |= Data8[Index];
+		Index++;
+	}
+	while ((Length - Index) >= XIL_UTIL_WORD_SIZE) {
+		Data |= *(const volatile UINTPTR *)&Data8[Index];
+		Index += XIL_UTIL_WORD_SIZE;
 	}
-	if (Index == Length) {
+	while (Index < Length) {
+		Data |= Data8[Index];
+		Index++;
+	}
+
+	if ((Index == Length) && (Data == 0U)) {
 		Status = XST_SUCCESS;
 	}
 
-END:
 	return Status;
 }
 
@@ -899,6 +961,7 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 	u32 Cnt = CmpLen;
 	const u8 *Src_1 = (const u8 *)Src1;
 	const u8 *Src_2 = (const u8 *)Src2;
+	UINTPTR Word;
 
 
 	if ((Src1 == NULL) || (Src2 == NULL)) {
@@ -908,6 +971,30 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
+		/*
+		 * Compare native words if both buffers can be aligned together.
+		 * Only the addresses and the length decide the path taken, so
+		 * the time taken does not depend on the contents.
+		 */
+		if ((((UINTPTR)Src_1 ^ (UINTPTR)Src_2) & XIL_UTIL_WORD_MASK) == 0U) {
+			while ((Cnt > 0U) &&
+				(((UINTPTR)Src_1 & XIL_UTIL_WORD_MASK) != 0U)) {
+				Data |= (u32)(*Src_1 ^ *Src_2);
+				DataRedundant &= ~Data;
+				Src_1++;
+				Src_2++;
+				Cnt--;
+			}
+			while (Cnt >= XIL_UTIL_WORD_SIZE) {
+				Word = *(const UINTPTR *)Src_1 ^ *(const UINTPTR *)Src_2;
+				Data |= (u32)(Word | (Word >> XIL_UTIL_HALF_WORD_BITS));
+				DataRedundant &= ~Data;
+				Src_1 += XIL_UTIL_WORD_SIZE;
+				Src_2 += XIL_UTIL_WORD_SIZE;
+				Cnt -= XIL_UTIL_WORD_SIZE;
+			}
+		}
+
 		while (Cnt >= sizeof(u32)) {
 			Data |= (*(const u32 *)Src_1 ^ *(const u32 *)Src_2);
 			DataRedundant &= ~Data;
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+
+# Decodes the PLM event trace records into a boot timeline.
+#
+# The records are built with PLM_EVENT_TRACE enabled in xplmi_config.h and
+# are copied to memory using the PLM Event Logging command:
+#   sub command 0xA returns the number of records and the timer frequency
+#   sub command 0x9 copies the records, oldest first, to the given address
+# The copied records can be dumped to a file from XSDB, for example
+#   mrd -bin -file trace.bin <address> <number of records * 4>
+#
+# usage: plm_event_trace.py trace.bin --freq <timer frequency in Hz>
+
+import argparse
+import struct
+import sys
+
+RECORD_FMT = "<4I"
+RECORD_LEN = struct.calcsize(RECORD_FMT)
+EVENT_TRACE_END = 0x8000
+
+# Event IDs from xplmi_event_logging.h
+EVENT_NAMES = {
+    0x1: "PMC CDO processing",
+    0x2: "Boot PDI load",
+    0x3: "PDI initialization",
+    0x4: "Image load",
+    0x5: "Partition load",
+    0x6: "CDO processing",
+}
+
+
+def read_records(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    for offset in range(0, len(data) - RECORD_LEN + 1, RECORD_LEN):
+        event_id, ticks_hi, ticks_lo, arg = struct.unpack_from(
+            RECORD_FMT, data, offset)
+        yield event_id, (ticks_hi << 32) | ticks_lo, arg
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode PLM event trace records")
+    parser.add_argument("file", help="binary dump of the event trace records")
+    parser.add_argument("--freq", type=int, default=320000000,
+                        help="PLM timer frequency in Hz as returned by the "
+                        "event trace info command (default: %(default)s)")
+    args = parser.parse_args()
+
+    ticks_per_ms = args.freq / 1000.0
+    open_phases = {}
+    totals = {}
+
+    print("%12s %12s  %-4s %s" % ("Time (ms)", "Phase (ms)", "Evt", "Event"))
+    for event_id, ticks, arg in read_records(args.file):
+        base_id = event_id & ~EVENT_TRACE_END
+        name = EVENT_NAMES.get(base_id, "Event 0x%x" % base_id)
+        time_ms = ticks / ticks_per_ms
+        key = (base_id, arg)
+
+        if event_id & EVENT_TRACE_END:
+            start = open_phases.pop(key, None)
+            if start is None:
+                duration = ""
+            else:
+                phase_ms = (ticks - start) / ticks_per_ms
+                duration = "%.3f" % phase_ms
+                count, total = totals.get(base_id, (0, 0.0))
+                totals[base_id] = (count + 1, total + phase_ms)
+            print("%12.3f %12s  %-4s %s done, arg 0x%x" %
+                  (time_ms, duration, "<", name, arg))
+        else:
+            open_phases[key] = ticks
+            print("%12.3f %12s  %-4s %s, arg 0x%x" %
+                  (time_ms, "", ">", name, arg))
+
+    for (base_id, arg) in open_phases:
+        print("Incomplete: %s, arg 0x%x" %
+              (EVENT_NAMES.get(base_id, "Event 0x%x" % base_id), arg))
+
+    print("\n%-24s %8s %12s" % ("Phase", "Count", "Total (ms)"))
+    for base_id in sorted(totals):
+        count, total = totals[base_id]
+        print("%-24s %8u %12.3f" %
+              (EVENT_NAMES.get(base_id, "Event 0x%x" % base_id), count, total))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -33,6 +33,7 @@
 *       bsv  08/02/2021 Updated function return type as part of code clean up
 *       bsv  08/13/2021 Code clean up to reduce size
 * 1.07  bsv  11/08/2021 Move XLoader_IsJtagSbiMode to Xilloader
+*       ag   10/19/2026 Added boot PDI load event trace
 *
 * </pre>
 *
@@ -110,7 +111,9 @@ int XPlm_LoadBootPdi(void *Arg)
 	PdiInstance.IpiMask = 0U;
 	PdiInstance.ValidHeader = (u8)TRUE;
 	SubsystemPdiIns.ValidHeader = (u8)TRUE;
+	XPlmi_EventTraceStart(XPLMI_EVENT_BOOT_PDI_LOAD, BootMode);
 	Status = XLoader_LoadPdi(&PdiInstance, BootMode, 0U);
+	XPlmi_EventTraceEnd(XPLMI_EVENT_BOOT_PDI_LOAD, BootMode);
 	if (Status != XST_SUCCESS) {
 		goto ERR_END;
 	}
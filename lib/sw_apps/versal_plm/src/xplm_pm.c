@@ -38,6 +38,7 @@
 *       kpt  09/09/2021 Fixed SW-BP-BLIND-WRITE in XLoader_SecureClear
 * 1.06  skd  11/18/2021 Added time stamps in XPlm_ProcessPmcCdo
 *       bm   01/05/2022 Fixed ZEROIZE-PRIORITY for XLoader_SecureClear
+*       ag   10/19/2026 Added PMC CDO processing event trace
 *
 * </pre>
 *
@@ -224,6 +225,7 @@ int XPlm_ProcessPmcCdo(void *Arg)
 	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
 	(void )Arg;
 
+	XPlmi_EventTraceStart(XPLMI_EVENT_PMC_CDO_PROCESS, 0U);
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	TaskStartTime = XPlmi_GetTimerValue();
 #endif
@@ -260,6 +262,7 @@ int XPlm_ProcessPmcCdo(void *Arg)
 		(void)XLoader_SecureClear();
 		goto END;
 	}
+	XPlmi_EventTraceEnd(XPLMI_EVENT_PMC_CDO_PROCESS, 0U);
 
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
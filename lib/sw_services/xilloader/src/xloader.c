@@ -125,6 +125,7 @@
 *                       case of invalid header
 *       bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
 *       bsv  01/29/2022 Added redundancy to Status variable in XLoader_LoadImage
+*       ag   10/19/2026 Added PDI initialization and image load event traces
 *
 * </pre>
 *
@@ -286,8 +287,10 @@ int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSrc, u64 PdiAddr)
 {
 	volatile int Status = XST_FAILURE;
 	u32 RegVal = XPlmi_In32(PMC_GLOBAL_PMC_MULTI_BOOT);
+#ifndef PLM_EVENT_TRACE
 	u64 PdiInitTime = XPlmi_GetTimerValue();
 	XPlmi_PerfTime PerfTime;
+#endif
 	u8 DeviceFlags = (u8)(PdiSrc & XLOADER_PDISRC_FLAGS_MASK);
 	u32 SdRawBootVal = RegVal & XLOADER_SD_RAWBOOT_MASK;
 	const char *RawString = "";
@@ -310,6 +313,7 @@ int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSrc, u64 PdiAddr)
 		{"DDR", XLOADER_DDR_INDEX}, /* DDR - 0xF */
 	};
 
+	XPlmi_EventTraceStart(XPLMI_EVENT_PDI_INIT, PdiSrc);
 	/*
 	 * Mark PDI loading is started.
 	 */
@@ -397,10 +401,14 @@ END1:
 		PdiPtr->PdiSrc);
 	Status = XPlmi_UpdateStatus(XLOADER_UNSUPPORTED_BOOT_MODE, 0);
 END:
+#ifdef PLM_EVENT_TRACE
+	XPlmi_EventTraceEnd(XPLMI_EVENT_PDI_INIT, PdiSrc);
+#else
 	XPlmi_MeasurePerfTime(PdiInitTime, &PerfTime);
 	XPlmi_Printf(DEBUG_PRINT_PERF,
 		"%u.%03u ms: PDI initialization time\n\r",
 		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
 	return Status;
 }
 
@@ -1332,6 +1340,8 @@ static int XLoader_LoadImage(XilPdi *PdiPtr)
 	volatile int Status = XST_FAILURE;
 	u32 NodeId = NODESUBCLASS(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 
+	XPlmi_EventTraceStart(XPLMI_EVENT_IMAGE_LOAD,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 #ifdef XPLM_SEM
 	/* Stop the SEM scan before PL load */
 	if ((PdiPtr->PdiType != XLOADER_PDI_TYPE_FULL) &&
@@ -1403,6 +1413,8 @@ static int XLoader_LoadImage(XilPdi *PdiPtr)
 #endif
 
 END:
+	XPlmi_EventTraceEnd(XPLMI_EVENT_IMAGE_LOAD,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 	return Status;
 }
 
@@ -55,6 +55,8 @@
 * 1.07  bm   10/21/2021 Updated Extract Metaheader command to return data size as
 *                       response
 *       bm   12/15/2021 Fix error case in Add ImageStore command
+*       ag   10/19/2026 Replaced XLoader_CheckIpiAccess with IPI permission
+*                       table
 *
 * </pre>
 *
@@ -136,10 +138,6 @@ static XPlmi_Module XPlmi_Loader;
 #define XLOADER_DEFAULT_RAWBOOT_VAL			(0U)
 #define XLOADER_SD_FILE_SYSTEM_VAL			(0xF0000000U)
 
-/* Loader command defines */
-#define XLOADER_CMD_READBACK_CMD_ID				(0x7U)
-#define XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID	(0x8U)
-
 #define XLOADER_IMG_HDR_TBL_EXPORT_MASK0	(0x00021F7FU)
 #define XLOADER_IMG_HDR_EXPORT_MASK0	(0x00003FFBU)
 #define XLOADER_PRTN_HDR_EXPORT_MASK0	(0x00001DFFU)
@@ -817,49 +815,6 @@ END:
  * @cond xloader_internal
  */
 
-/*****************************************************************************/
-/**
- * @brief	This function checks if the IPI command is accessible or not
- *
- * @param	CmdId is the Command ID
- * @param	IpiReqType is the IPI command request type
- *
- * @return	XST_SUCCESS on success and XST_FAILURE on failure
- *
- *****************************************************************************/
-static int XLoader_CheckIpiAccess(u32 CmdId, u32 IpiReqType)
-{
-	int Status = XST_FAILURE;
-	volatile u8 ModuleCmdId = (u8)(CmdId & XPLMI_PLM_GENERIC_CMD_ID_MASK);
-	volatile u8 ModuleCmdIdTmp = (u8)(CmdId & XPLMI_PLM_GENERIC_CMD_ID_MASK);
-	volatile u32 IpiRequestType = IpiReqType;
-	volatile u32 IpiRequestTypeTmp = IpiReqType;
-
-	/* Secure check for Loader IPI commands */
-	if (((ModuleCmdId == XLOADER_CMD_READBACK_CMD_ID) &&
-		(ModuleCmdIdTmp == XLOADER_CMD_READBACK_CMD_ID)) ||
-		((ModuleCmdId == XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID) &&
-		(ModuleCmdIdTmp == XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID))) {
-		if ((XPLMI_CMD_SECURE == IpiRequestType) &&
-			(XPLMI_CMD_SECURE == IpiRequestTypeTmp)) {
-			Status = XST_SUCCESS;
-		}
-	}
-	else if (((ModuleCmdId != XLOADER_CMD_READBACK_CMD_ID) &&
-		(ModuleCmdIdTmp != XLOADER_CMD_READBACK_CMD_ID)) &&
-		((ModuleCmdId != XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID) &&
-		(ModuleCmdIdTmp != XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID))) {
-		if (ModuleCmdId == ModuleCmdIdTmp) {
-			Status = XST_SUCCESS;
-		}
-	}
-	else {
-		Status = (int)XLOADER_ERR_GLITCH_DETECTED;
-	}
-
-	return Status;
-}
-
 /*****************************************************************************/
 /**
  * @brief	Contains the array of PLM loader commands
@@ -880,6 +835,28 @@ static const XPlmi_ModuleCmd XLoader_Cmds[] =
 	XPLMI_MODULE_COMMAND(XLoader_RemoveImageStorePdi)
 };
 
+/*****************************************************************************/
+/**
+ * @brief	Contains the IPI permissions of PLM loader commands. Set Image
+ * Info command is allowed only from CDO file and Readback and Update
+ * Multiboot commands are allowed only for secure IPI requests.
+ *
+ *****************************************************************************/
+static const u8 XLoader_IpiPerm[] =
+{
+	XPLMI_IPI_PERM_ALLOWED,	/* Features */
+	XPLMI_IPI_PERM_ALLOWED,	/* LoadSubsystemPdi */
+	XPLMI_IPI_PERM_ALLOWED,	/* LoadDdrCpyImg */
+	XPLMI_IPI_PERM_ALLOWED,	/* GetImageInfo */
+	XPLMI_IPI_PERM_DENIED,	/* SetImageInfo */
+	XPLMI_IPI_PERM_ALLOWED,	/* GetImageInfoList */
+	XPLMI_IPI_PERM_ALLOWED,	/* ExtractMetaheader */
+	XPLMI_IPI_PERM_SECURE,	/* LoadReadBackPdi */
+	XPLMI_IPI_PERM_SECURE,	/* UpdateMultiboot */
+	XPLMI_IPI_PERM_ALLOWED,	/* AddImageStorePdi */
+	XPLMI_IPI_PERM_ALLOWED,	/* RemoveImageStorePdi */
+};
+
 /*****************************************************************************/
 /**
  * @brief	Contains the module ID and loader commands array
@@ -890,7 +867,7 @@ static XPlmi_Module XPlmi_Loader =
 	XPLMI_MODULE_LOADER_ID,
 	XLoader_Cmds,
 	XPLMI_ARRAY_SIZE(XLoader_Cmds),
-	XLoader_CheckIpiAccess,
+	NULL,
 };
 
 /*****************************************************************************/
@@ -905,6 +882,8 @@ static XPlmi_Module XPlmi_Loader =
 void XLoader_CmdsInit(void)
 {
 	XPlmi_ModuleRegister(&XPlmi_Loader);
+	XPlmi_ModuleRegisterIpiPerm(XPLMI_MODULE_LOADER_ID, XLoader_IpiPerm,
+		XPLMI_ARRAY_SIZE(XLoader_IpiPerm));
 }
 
 /**
@@ -85,6 +85,9 @@
 *       bsv  03/17/2022 Add support for A72 elfs to run from TCM
 *       bsv  03/23/2022 Minor change in loading of A72 elfs to TCM
 *       bsv  03/29/2022 Dump Ddrmc registers only when PLM DEBUG MODE is enabled
+*       ag   10/19/2026 Added parallel partition copy on PMCDMA0 and PMCDMA1
+*                       under PLM_PARALLEL_PRTN_LOAD
+*       ag   10/19/2026 Added partition load and CDO processing event traces
 *
 * </pre>
 *
@@ -111,6 +114,17 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+#ifdef PLM_PARALLEL_PRTN_LOAD
+/* Structure to track a partition copy in flight on one of the PMC DMAs */
+typedef struct {
+	u64 DestAddr;	/**< Destination address of the copy */
+	u64 StartTime;	/**< Timer value when the copy was initiated */
+	u32 Len;	/**< Length of the copy in bytes */
+	u32 DmaFlags;	/**< PMC DMA used for the copy */
+	u8 PrtnNum;	/**< Partition number being copied */
+	u8 InUse;	/**< Set while the copy is in flight */
+} XLoader_PrtnCopyDesc;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SUCCESS_NOT_PRTN_OWNER	(0x100U) /**< Indicates that PLM is not the partition owner */
@@ -119,6 +133,11 @@
 #define XLOADER_RPU_GLBL_CNTL	(0xFF9A0000U)
 #define XLOADER_TCMCOMB_MASK		(0x40U)
 #define XLOADER_TCMCOMB_SHIFT		(6U)
+#ifdef PLM_PARALLEL_PRTN_LOAD
+#define XLOADER_DEVICE_COPY_ASYNC	((u32)0x1U << 31U) /**< Partition copy
+						can be left in flight */
+#define XLOADER_MAX_PRTN_COPIES		(2U) /**< One copy per PMC DMA */
+#endif
 
 #ifdef PLM_DEBUG_MODE
 /**
@@ -151,8 +170,21 @@ static int XLoader_ProcessElf(XilPdi* PdiPtr, const XilPdi_PrtnHdr* PrtnHdr,
 static int XLoader_DumpDdrmcRegisters(void);
 #endif
 static int XLoader_RequestTCM(u8 TcmId);
+#ifdef PLM_PARALLEL_PRTN_LOAD
+static u8 XLoader_IsPrtnCopyAsync(const XilPdi* PdiPtr,
+	const XilPdi_PrtnHdr* PrtnHdr);
+static int XLoader_StartPrtnCopy(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy);
+static int XLoader_WaitForPrtnCopy(XLoader_PrtnCopyDesc *CopyDesc);
+static int XLoader_WaitForPrtnCopies(u64 DestAddr, u32 Len);
+#endif
 
 /************************** Variable Definitions *****************************/
+#ifdef PLM_PARALLEL_PRTN_LOAD
+static XLoader_PrtnCopyDesc PrtnCopyDesc[XLOADER_MAX_PRTN_COPIES]; /**< Copies
+						in flight, indexed by PMC DMA */
+static u8 NextPrtnCopyDma; /**< PMC DMA to be used for the next copy */
+#endif
 
 /*****************************************************************************/
 /**
@@ -167,8 +199,13 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 {
 	int Status = XST_FAILURE;
 	u32 PrtnIndex;
+#ifndef PLM_EVENT_TRACE
 	u64 PrtnLoadTime;
 	XPlmi_PerfTime PerfTime;
+#endif
+#ifdef PLM_PARALLEL_PRTN_LOAD
+	int StatusTmp = XST_FAILURE;
+#endif
 
 	if ((PdiPtr->CopyToMem == (u8)FALSE) && (PdiPtr->DelayLoad == (u8)FALSE)) {
 		XPlmi_Printf(DEBUG_GENERAL,
@@ -225,30 +262,41 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 			}
 		}
 
+#ifdef PLM_EVENT_TRACE
+		XPlmi_EventTraceStart(XPLMI_EVENT_PRTN_LOAD, PdiPtr->PrtnNum);
+#else
 		PrtnLoadTime = XPlmi_GetTimerValue();
+#endif
 		/* Prtn Hdr Validation */
 		Status = XLoader_PrtnHdrValidation(
 				&(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]), PdiPtr->PrtnNum);
 		/* PLM is not partition owner and skip this partition */
 		if (Status == (int)XLOADER_SUCCESS_NOT_PRTN_OWNER) {
+			XPlmi_EventTraceEnd(XPLMI_EVENT_PRTN_LOAD, PdiPtr->PrtnNum);
 			Status = XST_SUCCESS;
 			continue;
 		}
 		if (XST_SUCCESS != Status) {
+			XPlmi_EventTraceEnd(XPLMI_EVENT_PRTN_LOAD, PdiPtr->PrtnNum);
 			goto END;
 		}
 
 		/* Process Partition */
 		Status = XLoader_ProcessPrtn(PdiPtr);
 		if (XST_SUCCESS != Status) {
+			XPlmi_EventTraceEnd(XPLMI_EVENT_PRTN_LOAD, PdiPtr->PrtnNum);
 			goto END;
 		}
+#ifdef PLM_EVENT_TRACE
+		XPlmi_EventTraceEnd(XPLMI_EVENT_PRTN_LOAD, PdiPtr->PrtnNum);
+#else
 		XPlmi_MeasurePerfTime(PrtnLoadTime, &PerfTime);
 		XPlmi_Printf(DEBUG_PRINT_PERF,
 			" %u.%03u ms for Partition#: 0x%0x, Size: %u Bytes\n\r",
 			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, PdiPtr->PrtnNum,
 			(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen) *
 			XPLMI_WORD_LEN);
+#endif
 
 		++PdiPtr->PrtnNum;
 		if (XPlmi_NpiOutOfReset() == (u8)TRUE) {
@@ -268,6 +316,13 @@ END:
 		}
 	}
 END1:
+#ifdef PLM_PARALLEL_PRTN_LOAD
+	/* All the partition copies must land before the image is handed off */
+	StatusTmp = XLoader_WaitForPrtnCopies(0U, 0U);
+	if (Status == XST_SUCCESS) {
+		Status = StatusTmp;
+	}
+#endif
 	return Status;
 }
 
@@ -341,6 +396,13 @@ static int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* Devi
 	if ((SecureParams->SecureEn == (u8)FALSE) &&
 			(SecureTempParams->SecureEn == (u8)FALSE) &&
 			(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
+#ifdef PLM_PARALLEL_PRTN_LOAD
+		if ((DeviceCopy->Flags & XLOADER_DEVICE_COPY_ASYNC) ==
+			XLOADER_DEVICE_COPY_ASYNC) {
+			Status = XLoader_StartPrtnCopy(PdiPtr, DeviceCopy);
+			goto END;
+		}
+#endif
 		Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
 			DeviceCopy->DestAddr,DeviceCopy->Len, DeviceCopy->Flags);
 	}
@@ -352,6 +414,9 @@ static int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* Devi
 			Status |= StatusTmp;
 		}
 	}
+#ifdef PLM_PARALLEL_PRTN_LOAD
+END:
+#endif
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL, "Device Copy Failed\n\r");
 	}
@@ -393,6 +458,22 @@ static int XLoader_ProcessElf(XilPdi* PdiPtr, const XilPdi_PrtnHdr * PrtnHdr,
 	}
 	PrtnParams->DstnCpu = XilPdi_GetDstnCpu(PrtnHdr);
 
+#ifdef PLM_PARALLEL_PRTN_LOAD
+	if ((PrtnParams->DstnCpu == XIH_PH_ATTRB_DSTN_CPU_PSM) ||
+		(PrtnParams->DstnCpu == XIH_PH_ATTRB_DSTN_CPU_R5_0) ||
+		(PrtnParams->DstnCpu == XIH_PH_ATTRB_DSTN_CPU_R5_1) ||
+		(PrtnParams->DstnCpu == XIH_PH_ATTRB_DSTN_CPU_R5_L)) {
+		/*
+		 * Requesting the processor and its memories ECC initializes them
+		 * using PMC DMA, so no copy can be in flight at this point
+		 */
+		Status = XLoader_WaitForPrtnCopies(0U, 0U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+#endif
+
 	/*
 	 * Requirements:
 	 *
@@ -657,6 +738,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 #endif
 
 	XPlmi_Printf(DEBUG_INFO, "Processing CDO partition \n\r");
+	XPlmi_EventTraceStart(XPLMI_EVENT_CDO_PROCESS, PdiPtr->PrtnNum);
 	/*
 	 * Initialize the Cdo Pointer and
 	 * check CDO header contents
@@ -822,6 +904,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	Status = XST_SUCCESS;
 
 END:
+	XPlmi_EventTraceEnd(XPLMI_EVENT_CDO_PROCESS, PdiPtr->PrtnNum);
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	XPlmi_MeasurePerfTime((XPlmi_GetTimerValue() + CdoProcessTime),
 				&PerfTime);
@@ -859,6 +942,23 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr)
 	/* Assign the partition header to local variable */
 	const XilPdi_PrtnHdr * PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PrtnNum]);
 	u32 RstReason;
+#ifdef PLM_PARALLEL_PRTN_LOAD
+	u32 AsyncFlags = 0U;
+
+	if (XLoader_IsPrtnCopyAsync(PdiPtr, PrtnHdr) == (u8)TRUE) {
+		AsyncFlags = XLOADER_DEVICE_COPY_ASYNC;
+	}
+	else {
+		/*
+		 * CDO, secure and checksum processing use the PMC DMAs, so retire
+		 * the copies in flight before processing this partition
+		 */
+		Status = XLoader_WaitForPrtnCopies(0U, 0U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+#endif
 
 	/* Read Partition Type */
 	PrtnType = XilPdi_GetPrtnType(PrtnHdr);
@@ -982,6 +1082,9 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr)
 		}
 	}
 
+#ifdef PLM_PARALLEL_PRTN_LOAD
+	PrtnParams.DeviceCopy.Flags |= AsyncFlags;
+#endif
 	if (PrtnType == XIH_PH_ATTRB_PRTN_TYPE_CDO) {
 		Status = XLoader_ProcessCdo(PdiPtr, &PrtnParams.DeviceCopy, &SecureParams);
 	}
@@ -1189,6 +1292,14 @@ static int XLoader_RequestTCM(u8 TcmId)
 	u32 CapContext = (u32)PM_CAP_CONTEXT;
 	u32 ErrorCode;
 
+#ifdef PLM_PARALLEL_PRTN_LOAD
+	/* TCM banks are ECC initialized using PMC DMA when requested */
+	Status = XLoader_WaitForPrtnCopies(0U, 0U);
+	if (Status != XST_SUCCESS) {
+		goto END1;
+	}
+#endif
+
 	if (TcmId == XLOADER_TCM_0) {
 		Status = XPm_RequestDevice(PM_SUBSYS_PMC, PM_DEV_TCM_0_A,
 			(CapSecureAccess | CapContext), XPM_DEF_QOS, 0U,
@@ -1221,5 +1332,172 @@ END:
 	if (Status != XST_SUCCESS) {
 		Status = XPlmi_UpdateStatus(ErrorCode, 0);
 	}
+#ifdef PLM_PARALLEL_PRTN_LOAD
+END1:
+#endif
+	return Status;
+}
+
+#ifdef PLM_PARALLEL_PRTN_LOAD
+/*****************************************************************************/
+/**
+ * @brief	This function checks from the partition header whether the
+ * partition copy can be left in flight while the next partitions are
+ * processed. Only non-secure ELF and data partitions of PDIs loaded from
+ * DDR qualify, as their copy is a plain PMC DMA transfer.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	PrtnHdr is pointer to the partition header
+ *
+ * @return	TRUE if the copy can be asynchronous, else FALSE
+ *
+ *****************************************************************************/
+static u8 XLoader_IsPrtnCopyAsync(const XilPdi* PdiPtr,
+	const XilPdi_PrtnHdr* PrtnHdr)
+{
+	u8 IsAsync = (u8)FALSE;
+
+	if ((PdiPtr->MetaHdr.DeviceCopy == XLoader_DdrCopy) &&
+		(PdiPtr->CopyToMem == (u8)FALSE) &&
+		(PdiPtr->DelayLoad == (u8)FALSE) &&
+		(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID !=
+			PM_MISC_MJTAG_WA_IMG) &&
+		(XilPdi_GetPrtnType(PrtnHdr) != XIH_PH_ATTRB_PRTN_TYPE_CDO) &&
+		(XilPdi_GetChecksumType(PrtnHdr) == 0x0U) &&
+		(PrtnHdr->AuthCertificateOfst == 0x0U) &&
+		(PrtnHdr->EncStatus == 0x0U) &&
+		(XilPdi_IsAuthEnabled(&PdiPtr->MetaHdr.ImgHdrTbl) == (u8)FALSE) &&
+		(XilPdi_IsEncEnabled(&PdiPtr->MetaHdr.ImgHdrTbl) == (u8)FALSE)) {
+		IsAsync = (u8)TRUE;
+	}
+
+	return IsAsync;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function initiates a non blocking partition copy on the
+ * PMC DMAs in round robin order. Copies in flight to an overlapping
+ * destination and the previous copy on the selected PMC DMA are waited for
+ * before the new copy is started.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	DeviceCopy is pointer to the structure variable with parameters
+ *			required for copying
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_StartPrtnCopy(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy)
+{
+	int Status = XST_FAILURE;
+	XLoader_PrtnCopyDesc *CopyDesc = &PrtnCopyDesc[NextPrtnCopyDma];
+
+	Status = XLoader_WaitForPrtnCopies(DeviceCopy->DestAddr, DeviceCopy->Len);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if (CopyDesc->InUse == (u8)TRUE) {
+		Status = XLoader_WaitForPrtnCopy(CopyDesc);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	if (NextPrtnCopyDma == 0U) {
+		CopyDesc->DmaFlags = XPLMI_PMCDMA_0;
+	}
+	else {
+		CopyDesc->DmaFlags = XPLMI_PMCDMA_1;
+	}
+	CopyDesc->DestAddr = DeviceCopy->DestAddr;
+	CopyDesc->Len = DeviceCopy->Len;
+	CopyDesc->PrtnNum = PdiPtr->PrtnNum;
+	CopyDesc->StartTime = XPlmi_GetTimerValue();
+
+	Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
+		DeviceCopy->DestAddr, DeviceCopy->Len,
+		CopyDesc->DmaFlags | XPLMI_DEVICE_COPY_STATE_INITIATE);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	CopyDesc->InUse = (u8)TRUE;
+	NextPrtnCopyDma ^= 1U;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for a partition copy in flight to complete
+ * and prints the time taken by it.
+ *
+ * @param	CopyDesc is pointer to the copy descriptor to be retired
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_WaitForPrtnCopy(XLoader_PrtnCopyDesc *CopyDesc)
+{
+	int Status = XST_FAILURE;
+	XPlmi_PerfTime PerfTime;
+
+	Status = XLoader_DdrCopy(0U, 0U, 0U, CopyDesc->DmaFlags |
+		XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+	CopyDesc->InUse = (u8)FALSE;
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	XPlmi_MeasurePerfTime(CopyDesc->StartTime, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF,
+		" %u.%03u ms for Partition#: 0x%0x copy on PMCDMA%u, Size: %u Bytes\n\r",
+		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac,
+		(u32)CopyDesc->PrtnNum,
+		(u32)(CopyDesc->DmaFlags == XPLMI_PMCDMA_1), CopyDesc->Len);
+
+END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the partition copies in flight whose
+ * destination overlaps the given range. All the copies in flight are waited
+ * for if Len is zero.
+ *
+ * @param	DestAddr is the start address of the range
+ * @param	Len is the length of the range in bytes
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_WaitForPrtnCopies(u64 DestAddr, u32 Len)
+{
+	int Status = XST_SUCCESS;
+	int StatusTmp = XST_FAILURE;
+	u32 Index;
+	XLoader_PrtnCopyDesc *CopyDesc;
+
+	for (Index = 0U; Index < XLOADER_MAX_PRTN_COPIES; ++Index) {
+		CopyDesc = &PrtnCopyDesc[Index];
+		if (CopyDesc->InUse == (u8)FALSE) {
+			continue;
+		}
+		if ((Len != 0U) &&
+			((DestAddr >= (CopyDesc->DestAddr + CopyDesc->Len)) ||
+			((DestAddr + Len) <= CopyDesc->DestAddr))) {
+			continue;
+		}
+		StatusTmp = XLoader_WaitForPrtnCopy(CopyDesc);
+		if (Status == XST_SUCCESS) {
+			Status = StatusTmp;
+		}
+	}
+
+	return Status;
+}
+#endif
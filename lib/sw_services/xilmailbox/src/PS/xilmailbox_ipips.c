@@ -27,6 +27,7 @@
  *                        initalizing GIC again and just register handlers.
  * 1.6   sd   28/02/21    Add support for microblaze
  *       kpt  03/16/21    Fixed compilation warning on microblaze
+ *       ag   10/19/26    Added XIpiPs_IsDone for XMailbox_IsDone
  *</pre>
  *
  *@note
@@ -46,6 +47,7 @@ static u32 XIpiPs_Send(XMailbox *InstancePtr, u8 Is_Blocking);
 static u32 XIpiPs_SendData(XMailbox *InstancePtr, void *MsgBufferPtr,
 			   u32 MsgLen, u8 BufferType, u8 Is_Blocking);
 static u32 XIpiPs_PollforDone(XMailbox *InstancePtr);
+static u32 XIpiPs_IsDone(XMailbox *InstancePtr);
 static u32 XIpiPs_RecvData(XMailbox *InstancePtr, void *MsgBufferPtr,
 			   u32 MsgLen, u8 BufferType);
 #ifndef __MICROBLAZE__
@@ -79,6 +81,7 @@ u32 XMailbox_Initialize(XMailbox *InstancePtr, u8 DeviceId)
 	InstancePtr->XMbox_IPI_SendData = XIpiPs_SendData;
 	InstancePtr->XMbox_IPI_Send = XIpiPs_Send;
 	InstancePtr->XMbox_IPI_Recv = XIpiPs_RecvData;
+	InstancePtr->XMbox_IPI_IsDone = XIpiPs_IsDone;
 
 	Status = XIpiPs_Init(InstancePtr, DeviceId);
 	return Status;
@@ -208,16 +211,11 @@ static u32 XIpiPs_SendData(XMailbox *InstancePtr, void *MsgBufferPtr,
 /****************************************************************************/
 static u32 XIpiPs_PollforDone(XMailbox *InstancePtr)
 {
-	XMailbox_Agent *DataPtr = &InstancePtr->Agent;
-	XIpiPsu *IpiInstancePtr = &DataPtr->IpiInst;
 	u32 Timeout = XIPI_DONE_TIMEOUT_VAL;
 	u32 Status = XST_SUCCESS;
-	u32 Flag;
 
 	do {
-		Flag = (XIpiPsu_ReadReg(IpiInstancePtr->Config.BaseAddress,
-				XIPIPSU_OBS_OFFSET)) & (DataPtr->RemoteId);
-		if (Flag == 0U) {
+		if (XIpiPs_IsDone(InstancePtr) == (u32)XST_SUCCESS) {
 			break;
 		}
 		usleep(100);
@@ -231,6 +229,32 @@ static u32 XIpiPs_PollforDone(XMailbox *InstancePtr)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Read the Observation Register once for an acknowledgement.
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ *
+ * @return	XST_SUCCESS if the IPI is acknowledged
+ * 		XST_DEVICE_BUSY if the destination CPU has not acknowledged it
+ */
+/****************************************************************************/
+static u32 XIpiPs_IsDone(XMailbox *InstancePtr)
+{
+	XMailbox_Agent *DataPtr = &InstancePtr->Agent;
+	XIpiPsu *IpiInstancePtr = &DataPtr->IpiInst;
+	u32 Status = XST_DEVICE_BUSY;
+	u32 Flag;
+
+	Flag = (XIpiPsu_ReadReg(IpiInstancePtr->Config.BaseAddress,
+			XIPIPSU_OBS_OFFSET)) & (DataPtr->RemoteId);
+	if (Flag == 0U) {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * This function reads an IPI message
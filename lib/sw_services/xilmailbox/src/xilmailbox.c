@@ -24,6 +24,7 @@
  * 1.3   sd   03/03/21    Doxygen Fixes
  * 1.4   sd   23/06/21    Fix MISRA-C warnings
  * 1.6   kpt  03/16/22    Added shared memory API's for IPI utilization
+ *       ag   10/19/26    Added XMailbox_IsDone
  *</pre>
  *
  *@note
@@ -132,6 +133,32 @@ u32 XMailbox_Recv(XMailbox *InstancePtr, u32 SourceId, void *BufferPtr,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function checks once, without waiting, whether the destination CPU
+ * has acknowledged the IPI sent with XMailbox_Send or XMailbox_SendData in
+ * non-blocking mode
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param RemoteId is the Mask of the CPU to which the IPI was triggered
+ *
+ * @return
+ *	- XST_SUCCESS if the IPI is acknowledged
+ *	- XST_DEVICE_BUSY if the destination CPU is still processing it
+ *
+ ****************************************************************************/
+u32 XMailbox_IsDone(XMailbox *InstancePtr, u32 RemoteId)
+{
+	u32 Status = XST_FAILURE;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	InstancePtr->Agent.RemoteId = RemoteId;
+	Status = InstancePtr->XMbox_IPI_IsDone(InstancePtr);
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
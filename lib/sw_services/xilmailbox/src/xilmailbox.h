@@ -30,6 +30,8 @@
  *   Message type should be either XILMBOX_MSG_TYPE_REQ (OR) XILMBOX_MSG_TYPE_RESP.
  * - XMailbox_Recv() function reads an IPI message from a specified source agent,
  *   Message type should be either XILMBOX_MSG_TYPE_REQ (OR) XILMBOX_MSG_TYPE_RESP.
+ * - XMailbox_IsDone() function checks once, without waiting, whether a remote
+ *   agent has acknowledged the IPI sent in non-blocking mode.
  * - XMailbox_SetCallBack() using this function user can register call backs
  *   for recv and error events.
  *
@@ -44,6 +46,7 @@
  * 1.3   sd   03/03/21    Doxygen Fixes
  * 1.6   sd   28/02/21    Add support for microblaze
  *       kpt  03/16/22    Added shared memory API's for IPI utilization
+ *       ag   10/19/26    Added XMailbox_IsDone
  *</pre>
  *
  *@note
@@ -96,6 +99,7 @@ typedef struct XMboxTag {
 				  u32 MsgLen, u8 BufferType, u8 Is_Blocking); /**< Sends an IPI message to a destination CPU */
 	u32 (*XMbox_IPI_Recv)(struct XMboxTag *InstancePtr, void *BufferPtr,
 			      u32 MsgLen, u8 BufferType); /**< Reads an IPI message */
+	u32 (*XMbox_IPI_IsDone)(struct XMboxTag *InstancePtr); /**< Checks the acknowledgement of an IPI */
 	XMailbox_RecvHandler RecvHandler;   /**< Recieve handler */
 	XMailbox_ErrorHandler ErrorHandler; /**< Callback for rx IPI event */
 	void *ErrorRefPtr; /**<  To be passed to the error interrupt callback */
@@ -119,6 +123,7 @@ u32 XMailbox_SendData(XMailbox *InstancePtr, u32 RemoteId,
 		      void *BufferPtr, u32 MsgLen, u8 BufferType, u8 Is_Blocking);
 u32 XMailbox_Recv(XMailbox *InstancePtr, u32 SourceId, void *BufferPtr,
 		  u32 MsgLen, u8 BufferType);
+u32 XMailbox_IsDone(XMailbox *InstancePtr, u32 RemoteId);
 s32 XMailbox_SetCallBack(XMailbox *InstancePtr, XMailbox_Handler HandlerType,
 			 void *CallBackFuncPtr, void *CallBackRefPtr);
 u32 XMailbox_SetSharedMem(XMailbox *InstancePtr, u64 Address, u32 Size);
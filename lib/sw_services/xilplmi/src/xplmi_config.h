@@ -42,6 +42,9 @@
 * 1.08  kpt  01/04/2022 Added PLM_PUF and PLM_PUF_EXCLUDE macros
 *       kpt  01/31/2022 Added description for PLM_PUF_EXCLUDE
 *       ssc  03/05/2022 Moved default config definitions to xparameters.h
+*       ag   10/19/2026 Added PLM_PARALLEL_PRTN_LOAD macro
+*       ag   10/19/2026 Added PLM_IPI_STATS macro
+*       ag   10/19/2026 Added PLM_EVENT_TRACE macro
 *
 * </pre>
 *
@@ -192,6 +195,33 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Enable the below define to overlap the copies of independent non-secure
+ * ELF and data partitions across PMCDMA0 and PMCDMA1 when the PDI is loaded
+ * from DDR. CDO, secure and checksum enabled partitions are still loaded
+ * sequentially and act as barriers for the copies in flight.
+ * Enable PLM_PRINT_PERF to see the completion time of every copy.
+ */
+//#define PLM_PARALLEL_PRTN_LOAD
+
+/**
+ * Enable the below define to track the count and the minimum, average and
+ * maximum handling time of every IPI command received by PLM. The statistics
+ * can be read and cleared using the IPI Stats generic command.
+ */
+//#define PLM_IPI_STATS
+
+/**
+ * Enable the below define to log the boot phases (PMC CDO, PDI, image,
+ * partition and CDO processing) as fixed size binary records with raw timer
+ * ticks, instead of computing and printing the time taken by every
+ * partition. The records can be retrieved using the Event Logging command
+ * and decoded on host to get the boot timeline.
+ * XPLMI_EVENT_TRACE_MAX_RECORDS can be defined to change the number of
+ * records stored.
+ */
+//#define PLM_EVENT_TRACE
+
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
 #define XPLMI_MJTAG_WA_DELAY_USED_IN_GASKET_TOGGLE 1U /**< Delay in usec in
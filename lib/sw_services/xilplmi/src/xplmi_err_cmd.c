@@ -33,6 +33,7 @@
 * 1.05  td   07/08/2021 Fix doxygen warnings
 *       bsv  08/02/2021 Code clean up to reduce size
 *       ma   08/19/2021 Renamed error related macros
+* 1.06  ag   10/19/2026 Added IPI permission table for EM commands
 *
 * </pre>
 *
@@ -226,6 +227,18 @@ static const XPlmi_ModuleCmd XPlmi_ErrCmds[] =
 	XPLMI_MODULE_COMMAND(XPlmi_CmdEmSetAction),
 };
 
+/*****************************************************************************/
+/**
+ * @brief	Contains the IPI permissions of PLM error commands. Only features
+ * command is allowed through IPI, other EM commands are allowed only from
+ * CDO file.
+ *
+ *****************************************************************************/
+static const u8 XPlmi_ErrIpiPerm[] =
+{
+	[XPLMI_PLM_MODULES_FEATURES_VAL] = XPLMI_IPI_PERM_ALLOWED,
+};
+
 /*****************************************************************************/
 /**
  * @brief	Contains the module ID and PLM error commands array
@@ -249,6 +262,8 @@ static XPlmi_Module XPlmi_ErrModule =
 void XPlmi_ErrModuleInit(void)
 {
 	XPlmi_ModuleRegister(&XPlmi_ErrModule);
+	XPlmi_ModuleRegisterIpiPerm(XPLMI_MODULE_ERROR_ID, XPlmi_ErrIpiPerm,
+		XPLMI_ARRAY_SIZE(XPlmi_ErrIpiPerm));
 }
 
 /**
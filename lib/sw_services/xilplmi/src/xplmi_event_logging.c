@@ -45,6 +45,7 @@
 *                       Return error codes as minor error codes from this file
 *       ma   09/13/2021 Set PLM prints log level to 0 in
 *                       XPlmi_InitDebugLogBuffer function
+*       ag   10/19/2026 Added binary event trace buffer
 *
 * </pre>
 *
@@ -80,6 +81,10 @@
 #define XPLMI_TRACE_LOG_BUFFER	(0U)
 #define XPLMI_DEBUG_LOG_BUFFER	(1U)
 
+/* Timer value at PLM start, the PLM timer counts down from this value */
+#define XPLMI_EVENT_TRACE_TIMER_START	((XPLMI_PIT1_CYCLE_VALUE << 32U) | \
+						XPLMI_PIT2_CYCLE_VALUE)
+
 /**
  * @}
  * @endcond
@@ -102,6 +107,68 @@ static XPlmi_CircularBuffer TraceLog = {
 	.IsBufferFull = (u32)FALSE,
 };
 
+#ifdef PLM_EVENT_TRACE
+/* Event trace buffer */
+static u32 EventTraceBuf[XPLMI_EVENT_TRACE_MAX_RECORDS *
+	XPLMI_EVENT_TRACE_RECORD_WORDS];
+static u32 EventTraceIndex; /**< Index of the next record to be written */
+static u8 EventTraceFull; /**< Set when the records have wrapped around */
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies the event trace records, oldest first, to
+ * the destination location.
+ *
+ * @param 	DestAddr to which the records are to be copied
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_RetrieveEventTrace(u64 DestAddr)
+{
+	u32 Index = 0U;
+	u32 Len = EventTraceIndex * XPLMI_EVENT_TRACE_RECORD_WORDS;
+
+	if (EventTraceFull == (u8)TRUE) {
+		Index = Len;
+		Len = XPLMI_ARRAY_SIZE(EventTraceBuf);
+	}
+	while (Len > 0U) {
+		if (Index == XPLMI_ARRAY_SIZE(EventTraceBuf)) {
+			Index = 0U;
+		}
+		XPlmi_Out64(DestAddr, EventTraceBuf[Index]);
+		DestAddr += XPLMI_WORD_LEN;
+		++Index;
+		--Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function retrieves event trace buffer info into cmd
+ * response.
+ *
+ * @param 	Cmd is the pointer to command structure
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_RetrieveEventTraceInfo(XPlmi_Cmd *Cmd)
+{
+	u32 NumRecords = EventTraceIndex;
+
+	if (EventTraceFull == (u8)TRUE) {
+		NumRecords = XPLMI_EVENT_TRACE_MAX_RECORDS;
+	}
+	Cmd->Response[1U] = NumRecords;
+	Cmd->Response[2U] = XPLMI_EVENT_TRACE_RECORD_WORDS * XPLMI_WORD_LEN;
+	Cmd->Response[3U] = XPlmi_GetPmcIroFreq();
+	Cmd->Response[4U] = XPLMI_EVENT_TRACE_MAX_RECORDS;
+	Cmd->Response[5U] = EventTraceFull;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function retrieves buffer data to the destination location.
@@ -251,6 +318,10 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
  *		8 - Configure Uart
  *			Arg1 - Uart Select
  *			Arg2 - Uart Enable
+ *		9 - Retrieve Event Trace records
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *		10 - Retrieve Event Trace buffer information
  *
  * @param	Cmd is pointer to the command structure
 
@@ -305,6 +376,16 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 		case XPLMI_LOGGING_CMD_CONFIG_UART:
 			Status = XPlmi_ConfigUart((u8)Arg1, (u8)Arg2);
 			break;
+#ifdef PLM_EVENT_TRACE
+		case XPLMI_LOGGING_CMD_RETRIEVE_EVENT_TRACE_DATA:
+			XPlmi_RetrieveEventTrace((Arg1 << 32U) | Arg2);
+			Status = XST_SUCCESS;
+			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_EVENT_TRACE_INFO:
+			XPlmi_RetrieveEventTraceInfo(Cmd);
+			Status = XST_SUCCESS;
+			break;
+#endif
 		default:
 			XPlmi_Printf(DEBUG_GENERAL,
 				"Received invalid event logging command\n\r");
@@ -353,6 +434,38 @@ void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 	}
 }
 
+#ifdef PLM_EVENT_TRACE
+/*****************************************************************************/
+/**
+ * @brief	This function stores an event record to the Event Trace buffer.
+ * Only the raw timer value is recorded, conversion to time is left to the
+ * host decoding the records.
+ *
+ * @param	EventId is the ID of the event
+ * @param	Arg is the argument of the event
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_StoreEventTrace(u32 EventId, u32 Arg)
+{
+	u64 Ticks = XPLMI_EVENT_TRACE_TIMER_START - XPlmi_GetTimerValue();
+	u32 *Record = &EventTraceBuf[EventTraceIndex *
+		XPLMI_EVENT_TRACE_RECORD_WORDS];
+
+	Record[0U] = EventId;
+	Record[1U] = (u32)(Ticks >> 32U);
+	Record[2U] = (u32)Ticks;
+	Record[3U] = Arg;
+
+	++EventTraceIndex;
+	if (EventTraceIndex == XPLMI_EVENT_TRACE_MAX_RECORDS) {
+		EventTraceIndex = 0U;
+		EventTraceFull = (u8)TRUE;
+	}
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function initializes the the DebugLog structure.
@@ -29,6 +29,7 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+*       ag   10/19/2026 Added binary event trace support
 *
 *
 * </pre>
@@ -47,6 +48,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xplmi_cmd.h"
 #include "xplmi_util.h"
+#include "xplmi_config.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -75,6 +77,9 @@ typedef struct {
 int XPlmi_EventLogging(XPlmi_Cmd * Cmd);
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len);
 void XPlmi_InitDebugLogBuffer(void);
+#ifdef PLM_EVENT_TRACE
+void XPlmi_StoreEventTrace(u32 EventId, u32 Arg);
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /** Event Logging sub command IDs */
@@ -86,6 +91,8 @@ void XPlmi_InitDebugLogBuffer(void);
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA	(0x6U)
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_BUFFER_INFO	(0x7U)
 #define XPLMI_LOGGING_CMD_CONFIG_UART			(0x8U)
+#define XPLMI_LOGGING_CMD_RETRIEVE_EVENT_TRACE_DATA	(0x9U)
+#define XPLMI_LOGGING_CMD_RETRIEVE_EVENT_TRACE_INFO	(0xAU)
 #define XPLMI_LOG_LEVEL_SHIFT		(0x4U)
 
 /* Trace log buffer length shift */
@@ -94,6 +101,40 @@ void XPlmi_InitDebugLogBuffer(void);
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
 
+/*
+ * Event trace records
+ * Every record is XPLMI_EVENT_TRACE_RECORD_WORDS words long
+ * 		0U - Event ID
+ * 		1U - Timer ticks since PLM start, higher 32 bits
+ * 		2U - Timer ticks since PLM start, lower 32 bits
+ * 		3U - Event argument
+ * Start and end of a boot phase are logged with the same event ID, the end
+ * record has XPLMI_EVENT_TRACE_END set.
+ */
+#define XPLMI_EVENT_TRACE_RECORD_WORDS		(4U)
+#ifndef XPLMI_EVENT_TRACE_MAX_RECORDS
+#define XPLMI_EVENT_TRACE_MAX_RECORDS		(64U)
+#endif
+#define XPLMI_EVENT_TRACE_END			(0x8000U)
+
+/* Event trace IDs */
+#define XPLMI_EVENT_PMC_CDO_PROCESS		(0x1U)
+#define XPLMI_EVENT_BOOT_PDI_LOAD		(0x2U) /**< Arg: Boot mode */
+#define XPLMI_EVENT_PDI_INIT			(0x3U) /**< Arg: PDI source */
+#define XPLMI_EVENT_IMAGE_LOAD			(0x4U) /**< Arg: Image ID */
+#define XPLMI_EVENT_PRTN_LOAD			(0x5U) /**< Arg: Partition number */
+#define XPLMI_EVENT_CDO_PROCESS			(0x6U) /**< Arg: Partition number */
+
+#ifdef PLM_EVENT_TRACE
+#define XPlmi_EventTraceStart(EventId, Arg)	\
+	XPlmi_StoreEventTrace((EventId), (Arg))
+#define XPlmi_EventTraceEnd(EventId, Arg)	\
+	XPlmi_StoreEventTrace(((EventId) | XPLMI_EVENT_TRACE_END), (Arg))
+#else
+#define XPlmi_EventTraceStart(EventId, Arg)
+#define XPlmi_EventTraceEnd(EventId, Arg)
+#endif
+
 /*
  * Trace log functions
  * TraceBuffer structure
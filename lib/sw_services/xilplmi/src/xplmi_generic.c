@@ -65,6 +65,8 @@
 *       is   01/10/2022 Added support for OT_CHECK command (XPlmi_OTCheck)
 *       is   01/10/2022 Updated Copyright Year to 2022
 *       bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
+*       ag   10/19/2026 Replaced XPlmi_CheckIpiAccess with IPI permission
+*                       table and added IPI Stats command
 *
 * </pre>
 *
@@ -84,6 +86,7 @@
 #include "xplmi_event_logging.h"
 #include "xplmi_wdt.h"
 #include "xplmi_modules.h"
+#include "xplmi_ipi.h"
 #include "xplmi_cmd.h"
 #include "xil_util.h"
 #include "xplmi_cdo.h"
@@ -1695,37 +1698,55 @@ static int XPlmi_OTCheck(XPlmi_Cmd *Cmd)
 
 /*****************************************************************************/
 /**
- * @brief	This function checks if the IPI command is accessible or not
+ * @brief	This function provides the handling time statistics of the IPI
+ * commands received by PLM.
+ *		Command: IpiStats
+ *		Reserved[31:24]=0 Length[23:16]=2 PLM=1 CMD_IPI_STATS=31
+ *		Payload = SubCmd, Index
+ *		SubCmd 0 - Get statistics of the tracked command at Index
+ *		SubCmd 1 - Clear all statistics
+ *		Get response: Command ID, Count, Min, Avg and Max time in us and
+ *		the number of tracked commands
  *
- * @param	CmdId is the Command ID
- * @param	IpiReqType is the IPI command request type
+ * @param	Cmd is pointer to the command structure
  *
- * @return	XST_SUCCESS on success and XST_FAILURE on failure
+ * @return	XST_SUCCESS on success and error code on failure
  *
  *****************************************************************************/
-static int XPlmi_CheckIpiAccess(u32 CmdId, u32 IpiReqType)
+static int XPlmi_IpiStats(XPlmi_Cmd *Cmd)
 {
 	int Status = XST_FAILURE;
-	u32 ModuleCmdId = CmdId & XPLMI_PLM_GENERIC_CMD_ID_MASK;
+#if defined(XPAR_XIPIPSU_0_DEVICE_ID) && defined(PLM_IPI_STATS)
+	u32 SubCmd = Cmd->Payload[0U];
+	u32 NumCmds;
+	const XPlmi_IpiCmdStats *Stats;
 
-	/* Secure check for PLMI IPI commands */
-	switch (ModuleCmdId) {
-		/*
-		 * Check IPI request type for Event Logging IPI command
-		 * and allow access only if the request is secure
-		 */
-		case XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL:
-			if (XPLMI_CMD_SECURE == IpiReqType) {
-				Status = XST_SUCCESS;
-			}
-			break;
+	if (SubCmd == XPLMI_IPI_STATS_RESET) {
+		XPlmi_ResetIpiStats();
+		Status = XST_SUCCESS;
+		goto END;
+	}
+	if (SubCmd != XPLMI_IPI_STATS_GET) {
+		goto END;
+	}
 
-		/* Allow access for all other IPI commands */
-		default:
-			Status = XST_SUCCESS;
-			break;
+	Stats = XPlmi_GetIpiStats(Cmd->Payload[1U], &NumCmds);
+	Cmd->Response[6U] = NumCmds;
+	if (Stats == NULL) {
+		goto END;
 	}
+	Cmd->Response[1U] = Stats->CmdId;
+	Cmd->Response[2U] = Stats->Count;
+	Cmd->Response[3U] = XPlmi_TimerTicksToUs(Stats->MinTicks);
+	Cmd->Response[4U] = XPlmi_TimerTicksToUs(Stats->TotalTicks /
+		Stats->Count);
+	Cmd->Response[5U] = XPlmi_TimerTicksToUs(Stats->MaxTicks);
+	Status = XST_SUCCESS;
 
+END:
+#else
+	(void)Cmd;
+#endif
 	return Status;
 }
 
@@ -1779,14 +1800,26 @@ void XPlmi_GenericInit(void)
 		XPLMI_MODULE_COMMAND(NULL),	/* Reserved for future */
 		XPLMI_MODULE_COMMAND(NULL),	/* Reserved for future */
 		XPLMI_MODULE_COMMAND(XPlmi_OTCheck),
+		XPLMI_MODULE_COMMAND(XPlmi_IpiStats),
+	};
+	/* IPI permissions of PLM generic commands */
+	static const u8 XPlmi_GenericIpiPerm[] =
+	{
+		[XPLMI_PLM_MODULES_FEATURES_VAL] = XPLMI_IPI_PERM_ALLOWED,
+		[XPLMI_PLM_GENERIC_DEVICE_ID_VAL] = XPLMI_IPI_PERM_ALLOWED,
+		[XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL] = XPLMI_IPI_PERM_SECURE,
+		[XPLMI_PLM_MODULES_GET_BOARD_VAL] = XPLMI_IPI_PERM_ALLOWED,
+		[XPLMI_PLM_GENERIC_IPI_STATS_VAL] = XPLMI_IPI_PERM_ALLOWED,
 	};
 
 	XPlmi_Generic.Id = XPLMI_MODULE_GENERIC_ID;
 	XPlmi_Generic.CmdAry = XPlmi_GenericCmds;
 	XPlmi_Generic.CmdCnt = XPLMI_ARRAY_SIZE(XPlmi_GenericCmds);
-	XPlmi_Generic.CheckIpiAccess = XPlmi_CheckIpiAccess;
+	XPlmi_Generic.CheckIpiAccess = NULL;
 
 	XPlmi_ModuleRegister(&XPlmi_Generic);
+	XPlmi_ModuleRegisterIpiPerm(XPLMI_MODULE_GENERIC_ID, XPlmi_GenericIpiPerm,
+		XPLMI_ARRAY_SIZE(XPlmi_GenericIpiPerm));
 }
 
 /*****************************************************************************/
@@ -41,6 +41,7 @@
 *       ma   06/28/2021 Added support for proc command
 *       bsv  07/16/2021 Fix doxygen warnings
 * 1.07  ma   11/22/2021 Remove hardcoding of Proc addresses
+*       ag   10/19/2026 Added defines for IPI Stats command
 *
 * </pre>
 *
@@ -140,6 +141,11 @@ typedef struct {
 #define XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL	(0x13U)
 #define XPLMI_PLM_MODULES_GET_BOARD_VAL		(0x15U)
 #define XPLMI_PLM_LOADER_SET_IMG_INFO_VAL	(0x4U)
+#define XPLMI_PLM_GENERIC_IPI_STATS_VAL		(0x1FU)
+
+/* IPI Stats command sub commands */
+#define XPLMI_IPI_STATS_GET			(0U)
+#define XPLMI_IPI_STATS_RESET			(1U)
 
 /************************** Function Prototypes ******************************/
 void XPlmi_GenericInit(void);
@@ -58,6 +58,8 @@
  * 1.05  ma   12/15/2021 Update function header for XPlmi_IpiDispatchHandler
  *       ma   01/17/2022 Enable SLVERR for IPI
  *       ma   02/04/2022 Print Command ID when IPI command execute fails
+ *       ag   10/19/2026 Replaced IPI command validation with per module
+ *                       permission tables and added IPI command statistics
  *
  * </pre>
  *
@@ -84,9 +86,16 @@
 #define XPLMI_IPI_PMC_IMR_SHIFT		(0x2U)
 #define XPLMI_GIC_IPI_INTR_ID		(0x1B0010U)
 #define PM_FORCE_POWERDOWN		(0x8U)
+#define XPLMI_IPI_STATS_CMD_ID_MASK	\
+	(XPLMI_CMD_MODULE_ID_MASK | XPLMI_PLM_GENERIC_CMD_ID_MASK)
 
 /************************** Function Prototypes ******************************/
 static int XPlmi_ValidateIpiCmd(XPlmi_Cmd *Cmd, u32 SrcIndex);
+static u32 XPlmi_GetIpiPerm(u32 ModuleId, u32 ApiId);
+static int XPlmi_CheckIpiPerm(u32 ModuleId, u32 ApiId, u32 IpiReqType);
+#ifdef PLM_IPI_STATS
+static void XPlmi_UpdateIpiStats(u32 CmdId, u64 StartTime);
+#endif
 static u32 XPlmi_GetIpiReqType(u32 CmdId, u32 SrcIndex);
 static XPlmi_SubsystemHandler XPlmi_GetPmSubsystemHandler(
 	XPlmi_SubsystemHandler SubsystemHandler);
@@ -96,6 +105,11 @@ static XPlmi_SubsystemHandler XPlmi_GetPmSubsystemHandler(
 /*****************************************************************************/
 /* Instance of IPI Driver */
 static XIpiPsu IpiInst;
+#ifdef PLM_IPI_STATS
+/* Handling time statistics of the IPI commands received */
+static XPlmi_IpiCmdStats IpiCmdStats[XPLMI_IPI_STATS_MAX_CMDS];
+static u32 IpiCmdStatsCnt;
+#endif
 
 /*****************************************************************************/
 /**
@@ -228,6 +242,10 @@ int XPlmi_IpiDispatchHandler(void *Data)
 	u8 PendingPsmIpi = (u8)FALSE;
 	u8 ModuleId;
 	u8 ApiId;
+#ifdef PLM_IPI_STATS
+	u64 StartTime = XPlmi_GetTimerValue();
+	u8 IsValidCmd = (u8)FALSE;
+#endif
 
 	for (MaskIndex = 0U; MaskIndex < XPLMI_IPI_MASK_COUNT; MaskIndex++) {
 		if (IpiInst.Config.TargetList[MaskIndex].BufferIndex == (u32)Data) {
@@ -255,6 +273,9 @@ int XPlmi_IpiDispatchHandler(void *Data)
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
+#ifdef PLM_IPI_STATS
+		IsValidCmd = (u8)TRUE;
+#endif
 
 		Cmd.Len = (Cmd.CmdId >> 16U) & 255U;
 		if (Cmd.Len > XPLMI_MAX_IPI_CMD_LEN) {
@@ -297,6 +318,11 @@ END:
 				}
 			}
 		}
+#ifdef PLM_IPI_STATS
+		if (IsValidCmd == (u8)TRUE) {
+			XPlmi_UpdateIpiStats(Cmd.CmdId, StartTime);
+		}
+#endif
 	}
 
 	if (XST_SUCCESS != Status) {
@@ -422,59 +448,54 @@ int XPlmi_IpiPollForAck(u32 DestCpuMask, u32 TimeOutCount)
 
 /*****************************************************************************/
 /**
- * @brief	This function checks whether the Cmd passed is supported
- * 			via IPI mechanism or not.
+ * @brief	This function returns the IPI permission of a command from the
+ * permission table registered by its module.
  *
  * @param	ModuleId is the module ID
  * @param	ApiId is the API ID
  *
- * @return	XST_SUCCESS on success and XST_FAILURE on failure
+ * @return	XPLMI_IPI_PERM_* value of the command
  *
  *****************************************************************************/
-static int XPlmi_ValidateCmd(u32 ModuleId, u32 ApiId)
+static u32 XPlmi_GetIpiPerm(u32 ModuleId, u32 ApiId)
 {
-	int Status = XST_FAILURE;
+	u32 Perm = XPLMI_IPI_PERM_ALLOWED;
+	const XPlmi_ModuleIpiPerm *IpiPerm = &ModuleIpiPerms[ModuleId];
 
-	/* Validate IPI Command */
-	switch (ModuleId) {
-		case XPLMI_MODULE_GENERIC_ID:
-			/*
-			 * Only Device ID, Event Logging and Get Board
-			 * commands are allowed through IPI.
-			 * All other commands are allowed only from CDO file.
-			 */
-			if ((ApiId == XPLMI_PLM_GENERIC_DEVICE_ID_VAL) ||
-					(ApiId == XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL) ||
-					(ApiId == XPLMI_PLM_MODULES_FEATURES_VAL) ||
-					(ApiId == XPLMI_PLM_MODULES_GET_BOARD_VAL)) {
-				Status = XST_SUCCESS;
-			}
-			break;
+	/* Other module's commands are allowed through IPI */
+	if (IpiPerm->Perm != NULL) {
+		if (ApiId < IpiPerm->PermCnt) {
+			Perm = IpiPerm->Perm[ApiId];
+		}
+		else {
+			Perm = XPLMI_IPI_PERM_DENIED;
+		}
+	}
 
-		case XPLMI_MODULE_ERROR_ID:
-			/*
-			 * Only features command is allowed in EM module through IPI.
-			 * Other EM commands are allowed only from CDO file.
-			 */
-			if (ApiId == XPLMI_PLM_MODULES_FEATURES_VAL) {
-				Status = XST_SUCCESS;
-			}
-			break;
+	return Perm;
+}
 
-		case XPLMI_MODULE_LOADER_ID:
-			/*
-			 * Except Set Image Info command, all other commands are allowed
-			 * in Loader module through IPI.
-			 */
-			if (ApiId != XPLMI_PLM_LOADER_SET_IMG_INFO_VAL) {
-				Status = XST_SUCCESS;
-			}
-			break;
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the IPI request type satisfies the
+ * permission of the command.
+ *
+ * @param	ModuleId is the module ID
+ * @param	ApiId is the API ID
+ * @param	IpiReqType is the IPI command request type
+ *
+ * @return	XST_SUCCESS on success and XST_FAILURE on failure
+ *
+ *****************************************************************************/
+static int XPlmi_CheckIpiPerm(u32 ModuleId, u32 ApiId, u32 IpiReqType)
+{
+	int Status = XST_FAILURE;
+	u32 Perm = XPlmi_GetIpiPerm(ModuleId, ApiId);
 
-		default:
-			/* Other module's commands are allowed through IPI */
-			Status = XST_SUCCESS;
-			break;
+	if ((Perm == XPLMI_IPI_PERM_ALLOWED) ||
+		((Perm == XPLMI_IPI_PERM_SECURE) &&
+		(IpiReqType == XPLMI_CMD_SECURE))) {
+		Status = XST_SUCCESS;
 	}
 
 	return Status;
@@ -508,8 +529,7 @@ static int XPlmi_ValidateIpiCmd(XPlmi_Cmd *Cmd, u32 SrcIndex)
 	}
 
 	/* Validate IPI Command */
-	Status = XPlmi_ValidateCmd(CmdHndlr, ApiId);
-	if (XST_SUCCESS != Status) {
+	if (XPlmi_GetIpiPerm(CmdHndlr, ApiId) == XPLMI_IPI_PERM_DENIED) {
 		/* Return error code if IPI validation failed */
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD, 0);
 		goto END;
@@ -526,6 +546,15 @@ static int XPlmi_ValidateIpiCmd(XPlmi_Cmd *Cmd, u32 SrcIndex)
 
 	/* Get IPI request type */
 	Cmd->IpiReqType = XPlmi_GetIpiReqType(Cmd->CmdId, SrcIndex);
+	/* Check command IPI access against the module permission table */
+	XSECURE_TEMPORAL_IMPL(Status, StatusTmp, XPlmi_CheckIpiPerm, CmdHndlr,
+		ApiId, Cmd->IpiReqType);
+	if ((XST_SUCCESS != Status) || (XST_SUCCESS != StatusTmp)) {
+		Status |= StatusTmp;
+		Status = XPlmi_UpdateStatus(XPLMI_IPI_ACCESS_ERR, Status);
+		goto END;
+	}
+
 	/*
 	 * Check command IPI access if module has registered the handler
 	 * If handler is not registered, do nothing
@@ -592,4 +621,96 @@ static u32 XPlmi_GetIpiReqType(u32 CmdId, u32 SrcIndex)
 END:
 	return IpiReqType;
 }
+
+#ifdef PLM_IPI_STATS
+/*****************************************************************************/
+/**
+ * @brief	This function accounts the handling time of an IPI command.
+ * Commands received after XPLMI_IPI_STATS_MAX_CMDS distinct commands have
+ * been tracked are not accounted.
+ *
+ * @param	CmdId is the command ID of the IPI command
+ * @param	StartTime is the timer value when the IPI was dispatched
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_UpdateIpiStats(u32 CmdId, u64 StartTime)
+{
+	u32 Index;
+	u32 Ticks = (u32)(StartTime - XPlmi_GetTimerValue());
+	XPlmi_IpiCmdStats *Stats;
+
+	CmdId &= XPLMI_IPI_STATS_CMD_ID_MASK;
+	for (Index = 0U; Index < IpiCmdStatsCnt; ++Index) {
+		if (IpiCmdStats[Index].CmdId == CmdId) {
+			break;
+		}
+	}
+	if (Index == IpiCmdStatsCnt) {
+		if (IpiCmdStatsCnt == XPLMI_IPI_STATS_MAX_CMDS) {
+			goto END;
+		}
+		IpiCmdStats[Index].CmdId = CmdId;
+		IpiCmdStats[Index].MinTicks = Ticks;
+		++IpiCmdStatsCnt;
+	}
+
+	Stats = &IpiCmdStats[Index];
+	++Stats->Count;
+	Stats->TotalTicks += Ticks;
+	if (Ticks < Stats->MinTicks) {
+		Stats->MinTicks = Ticks;
+	}
+	if (Ticks > Stats->MaxTicks) {
+		Stats->MaxTicks = Ticks;
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the statistics of a tracked IPI command.
+ *
+ * @param	Index is the index of the tracked command
+ * @param	NumCmds is pointer to store the number of tracked commands
+ *
+ * @return	Pointer to the command statistics or NULL if Index is invalid
+ *
+ *****************************************************************************/
+const XPlmi_IpiCmdStats *XPlmi_GetIpiStats(u32 Index, u32 *NumCmds)
+{
+	const XPlmi_IpiCmdStats *Stats = NULL;
+
+	*NumCmds = IpiCmdStatsCnt;
+	if (Index < IpiCmdStatsCnt) {
+		Stats = &IpiCmdStats[Index];
+	}
+
+	return Stats;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the statistics of all IPI commands.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_ResetIpiStats(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < IpiCmdStatsCnt; ++Index) {
+		IpiCmdStats[Index].CmdId = 0U;
+		IpiCmdStats[Index].Count = 0U;
+		IpiCmdStats[Index].MinTicks = 0U;
+		IpiCmdStats[Index].MaxTicks = 0U;
+		IpiCmdStats[Index].TotalTicks = 0U;
+	}
+	IpiCmdStatsCnt = 0U;
+}
+#endif /* PLM_IPI_STATS */
 #endif /* XPAR_XIPIPSU_0_DEVICE_ID */
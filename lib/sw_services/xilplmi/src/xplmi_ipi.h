@@ -34,6 +34,7 @@
 * 1.03  ma   03/04/2021 Added IPI secure related defines
 *       bsv  04/16/2021 Added provision to store Subsystem Id in XilPlmi
 *       ma   08/09/2021 Added IPI_PMC_IMR register define
+*       ag   10/19/2026 Added IPI command statistics
 *
 * </pre>
 *
@@ -76,7 +77,18 @@ extern "C" {
 #define IPI_APER_TZ_000_ADDR			(0xFF3000BCU)
 #define IPI_APER_TZ_PMC_REQ_BUF_MASK	(0x4U)
 
+/* Maximum number of distinct IPI commands tracked for statistics */
+#define XPLMI_IPI_STATS_MAX_CMDS		(32U)
+
 /**************************** Type Definitions *******************************/
+/* Handling time statistics of an IPI command, in PMC IRO timer ticks */
+typedef struct {
+	u32 CmdId; /**< Module ID and API ID of the command */
+	u32 Count; /**< Number of commands handled */
+	u32 MinTicks; /**< Minimum handling time */
+	u32 MaxTicks; /**< Maximum handling time */
+	u64 TotalTicks; /**< Total handling time */
+} XPlmi_IpiCmdStats;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 typedef u32 (*XPlmi_SubsystemHandler)(u32 IpiMask);
@@ -88,6 +100,10 @@ int XPlmi_IpiWrite(u32 DestCpuMask, u32 *MsgPtr, u32 MsgLen, u8 Type);
 int XPlmi_IpiRead(u32 SrcCpuMask, u32 *MsgPtr, u32 MsgLen, u8 Type);
 int XPlmi_IpiTrigger(u32 DestCpuMask);
 int XPlmi_IpiPollForAck(u32 DestCpuMask, u32 TimeOutCount);
+#ifdef PLM_IPI_STATS
+const XPlmi_IpiCmdStats *XPlmi_GetIpiStats(u32 Index, u32 *NumCmds);
+void XPlmi_ResetIpiStats(void);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -20,6 +20,7 @@
 * 1.01  bsv  04/04/2020 Code clean up
 * 1.02  bm   10/14/2020 Code clean up
 * 1.03  td   07/08/2021 Fix doxygen warnings
+* 1.04  ag   10/19/2026 Added XPlmi_ModuleRegisterIpiPerm
 *
 * </pre>
 *
@@ -44,6 +45,7 @@
 
 /*****************************************************************************/
 XPlmi_Module * Modules[XPLMI_MAX_MODULES];
+XPlmi_ModuleIpiPerm ModuleIpiPerms[XPLMI_MAX_MODULES];
 
 /*****************************************************************************/
 /**
@@ -62,3 +64,24 @@ void XPlmi_ModuleRegister(XPlmi_Module *Module)
 	Xil_AssertVoid(Modules[ModuleId] == NULL);
 	Modules[ModuleId] = Module;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function registers the IPI permission table of a module.
+ * The table is indexed by API ID and is looked up for every IPI command
+ * received for the module, so it must be a constant array.
+ *
+ * @param	ModuleId is the module ID
+ * @param	Perm is pointer to the XPLMI_IPI_PERM_* value of every API ID
+ * @param	PermCnt is the number of entries in Perm
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_ModuleRegisterIpiPerm(u32 ModuleId, const u8 *Perm, u32 PermCnt)
+{
+	Xil_AssertVoid(ModuleId < XPLMI_MAX_MODULES);
+	Xil_AssertVoid(Perm != NULL);
+	ModuleIpiPerms[ModuleId].Perm = Perm;
+	ModuleIpiPerms[ModuleId].PermCnt = PermCnt;
+}
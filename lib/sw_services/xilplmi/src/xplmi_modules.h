@@ -28,6 +28,7 @@
 *       kal  07/17/2021 Added XilNvm module ID
 *       bsv  08/02/2021 Removed incorrect comment
 * 1.05  kpt  01/04/2022 Added XilPuf module ID
+*       ag   10/19/2026 Added IPI permission tables for module commands
 *
 * </pre>
 *
@@ -63,6 +64,14 @@ extern "C" {
 #define XPLMI_MODULE_XILPUF_ID			(12U)
 #define XPLMI_MODULE_COMMAND(FUNC)		{ (FUNC) }
 
+/* IPI permissions of module commands */
+#define XPLMI_IPI_PERM_DENIED			(0U) /**< Command is allowed
+						only from CDO */
+#define XPLMI_IPI_PERM_ALLOWED			(1U) /**< Command is allowed
+						through IPI */
+#define XPLMI_IPI_PERM_SECURE			(2U) /**< Command is allowed
+						only for secure IPI requests */
+
 /**************************** Type Definitions *******************************/
 typedef struct {
 	int (*Handler)(XPlmi_Cmd *Cmd);
@@ -75,13 +84,24 @@ typedef struct {
 	int (*CheckIpiAccess)(u32 CmdId, u32 IpiReqType);
 } XPlmi_Module;
 
+/*
+ * IPI permission table of a module, indexed by API ID. Modules which do not
+ * register a table allow all their commands through IPI.
+ */
+typedef struct {
+	const u8 *Perm; /**< XPLMI_IPI_PERM_* value for every API ID */
+	u32 PermCnt; /**< Number of entries in Perm */
+} XPlmi_ModuleIpiPerm;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 void XPlmi_ModuleRegister(XPlmi_Module *Module);
+void XPlmi_ModuleRegisterIpiPerm(u32 ModuleId, const u8 *Perm, u32 PermCnt);
 
 /************************** Variable Definitions *****************************/
 extern XPlmi_Module *Modules[XPLMI_MAX_MODULES];
+extern XPlmi_ModuleIpiPerm ModuleIpiPerms[XPLMI_MAX_MODULES];
 
 /**
  * @}
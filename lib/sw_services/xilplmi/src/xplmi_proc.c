@@ -42,6 +42,8 @@
 *       bm   01/27/2022 Fix setup interrupt system logic
 *       rama 01/31/2022 Added STL error interrupt register functionality
 *       bm   03/16/2022 Fix ROM time calculation
+*       ag   10/19/2026 Added XPlmi_TimerTicksToUs
+*       ag   10/19/2026 Added XPlmi_GetPmcIroFreq
 *
 * </pre>
 *
@@ -218,6 +220,33 @@ void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime)
 	XPlmi_GetPerfTime(TCur, TEnd, PmcIroFreq, PerfTime);
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function converts a number of PMC IRO timer ticks, as
+ * measured between two XPlmi_GetTimerValue calls, to microseconds.
+ *
+ * @param	Ticks is the number of timer ticks
+ *
+ * @return	Time in microseconds
+ *
+ *****************************************************************************/
+u32 XPlmi_TimerTicksToUs(u64 Ticks)
+{
+	return (u32)((Ticks * (u64)XPLMI_MEGA) / (u64)PmcIroFreq);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the frequency at which the PLM timer runs.
+ *
+ * @return	PMC IRO frequency in Hz
+ *
+ *****************************************************************************/
+u32 XPlmi_GetPmcIroFreq(void)
+{
+	return PmcIroFreq;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function prints the ROM time.
@@ -34,6 +34,8 @@
 * 1.05  bm   07/12/2021 Updated IRO freqency defines
 *       bsv  07/16/2021 Fix doxygen warnings
 *       bsv  08/02/2021 Removed unnecessary structure
+* 1.06  ag   10/19/2026 Added XPlmi_TimerTicksToUs
+*       ag   10/19/2026 Added XPlmi_GetPmcIroFreq
 *
 * </pre>
 *
@@ -111,6 +113,8 @@ int XPlmi_StartTimer(void);
 u64 XPlmi_GetTimerValue(void);
 int XPlmi_SetUpInterruptSystem(void);
 void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime);
+u32 XPlmi_TimerTicksToUs(u64 Ticks);
+u32 XPlmi_GetPmcIroFreq(void);
 void XPlmi_PlmIntrEnable(u32 IntrId);
 int XPlmi_PlmIntrDisable(u32 IntrId);
 int XPlmi_PlmIntrClear(u32 IntrId);
@@ -0,0 +1,21 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file sleep.h
+*
+* Sleep function of the host model.
+*
+******************************************************************************/
+#ifndef XSECURE_CLIENT_MODEL_SLEEP_H_
+#define XSECURE_CLIENT_MODEL_SLEEP_H_
+
+#include "xil_types.h"
+
+void usleep(ULONG useconds);
+
+#endif /* XSECURE_CLIENT_MODEL_SLEEP_H_ */
@@ -0,0 +1,22 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache.h
+*
+* The host has coherent memory, the cache functions do nothing.
+*
+******************************************************************************/
+#ifndef XSECURE_CLIENT_MODEL_XIL_CACHE_H_
+#define XSECURE_CLIENT_MODEL_XIL_CACHE_H_
+
+#include "xil_types.h"
+
+void Xil_DCacheFlushRange(INTPTR Adr, INTPTR Len);
+void Xil_DCacheInvalidateRange(INTPTR Adr, INTPTR Len);
+
+#endif /* XSECURE_CLIENT_MODEL_XIL_CACHE_H_ */
@@ -0,0 +1,25 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Register accesses of the host model. They are functions so that the model
+* can simulate the IPI registers.
+*
+******************************************************************************/
+#ifndef XSECURE_CLIENT_MODEL_XIL_IO_H_
+#define XSECURE_CLIENT_MODEL_XIL_IO_H_
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+
+u32 Xil_In32(UINTPTR Addr);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+
+#endif /* XSECURE_CLIENT_MODEL_XIL_IO_H_ */
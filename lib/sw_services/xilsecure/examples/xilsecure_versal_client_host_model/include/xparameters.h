@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Hardware parameters of the IPI channel of the host model. The client uses
+* IPI0, and the model table of xilsecure_client_model.c lists the PMC and
+* IPI0 as targets.
+*
+******************************************************************************/
+#ifndef XSECURE_CLIENT_MODEL_XPARAMETERS_H_
+#define XSECURE_CLIENT_MODEL_XPARAMETERS_H_
+
+#define XPAR_XIPIPSU_NUM_INSTANCES	1U
+#define XPAR_XIPIPSU_NUM_TARGETS	2U
+#define XPAR_XIPIPSU_0_DEVICE_ID	0U
+#define XPAR_XIPIPSU_0_BASE_ADDRESS	0xFF340000U
+#define XPAR_XIPIPSU_0_BIT_MASK		0x00000004U
+#define XPAR_XIPIPSU_0_BUFFER_INDEX	2U
+#define XPAR_XIPIPSU_0_INT_ID		62U
+
+#endif /* XSECURE_CLIENT_MODEL_XPARAMETERS_H_ */
@@ -0,0 +1,544 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilsecure_client_loopback_test.c
+*
+* This file contains the loopback test of the synchronous and asynchronous
+* SHA3 and AES client APIs, with the host model of the IPI channel and of the
+* PLM server.
+*
+* - The SHA3-384 of "abc" computed by the server through the synchronous
+*   client is checked against the FIPS 202 vector.
+* - Random messages are hashed with random chunk sizes through the request
+*   queue and compared with the hash of the model. The order of the
+*   callbacks, the rejection of synchronous calls and of a new operation
+*   while requests are pending are checked.
+* - A request that fails on the server is reported to its callback, the
+*   requests queued behind it are dropped, and the SHA3 state is ended when
+*   the failure completes, so that a new operation can start.
+* - A request that cannot be sent is queued, and reported once, to its
+*   callback.
+* - The asynchronous AES encryption and decryption give the same data and
+*   tag as the synchronous APIs, and a wrong tag fails the decrypt final.
+* - The SHA3 throughput of the synchronous and asynchronous APIs is printed
+*   for several chunk sizes, with a modelled server time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xilmailbox.h"
+#include "xsecure_mailbox.h"
+#include "xsecure_shaclient.h"
+#include "xsecure_aesclient.h"
+#include "xilsecure_client_model.h"
+
+/************************** Constant Definitions *****************************/
+#define RING_SIZE		(8U)
+#define MAX_CALLBACKS		(256U)
+#define MAX_MSG_LEN		(20000U)
+#define MAX_CHUNK_LEN		(3000U)
+#define NUM_SHA3_TRIALS		(40U)
+#define AES_MSG_LEN		(10000U)
+#define AES_IV_LEN		(12U)
+#define PERF_MSG_LEN		(256U * 1024U)
+#define PERF_REQUEST_NS		(8000U)	/**< Modelled time of a request */
+#define PERF_BYTE_NS		(50U)	/**< Modelled time of a data byte */
+#define TEST_SERVER_ERROR	(0x123)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond) \
+	if (!(Cond)) { \
+		printf("%s line %d: %s\r\n", __func__, __LINE__, #Cond); \
+		return XST_FAILURE; \
+	}
+
+#define ADDR(Ptr)	((u64)(UINTPTR)(Ptr))
+
+/************************** Variable Definitions *****************************/
+static XMailbox Mailbox;
+static XSecure_ClientInstance Client;
+static XSecure_ClientRequest Requests[RING_SIZE];
+static u64 SharedMem[XSECURE_SHARED_MEM_SIZE / sizeof(u64)];
+
+static u32 CallbackCount;
+static u32 CallbackRef[MAX_CALLBACKS];
+static int CallbackStatus[MAX_CALLBACKS];
+
+static u8 Msg[PERF_MSG_LEN];
+static u8 Out[AES_MSG_LEN];
+static u8 Back[AES_MSG_LEN];
+
+/*****************************************************************************/
+/**
+*
+* Callback that records the order and status of the completions.
+*
+******************************************************************************/
+static void TestCallback(void *Ref, int Status)
+{
+	if (CallbackCount < MAX_CALLBACKS) {
+		CallbackRef[CallbackCount] = (u32)(UINTPTR)Ref;
+		CallbackStatus[CallbackCount] = Status;
+	}
+	CallbackCount++;
+}
+
+static void *TestRef(u32 Index)
+{
+	return (void *)(UINTPTR)Index;
+}
+
+static double NowUs(void)
+{
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+	return ((double)Now.tv_sec * 1e6) + ((double)Now.tv_nsec / 1e3);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues an SHA3 update, polling the queue while it is full.
+*
+******************************************************************************/
+static int QueueSha3Update(const u8 *Data, u32 Size, u32 Ref)
+{
+	while (XSecure_ClientGetRequest(&Client) == NULL) {
+		(void)XSecure_ClientPoll(&Client);
+	}
+
+	return XSecure_Sha3UpdateAsync(&Client, ADDR(Data), Size, TestCallback,
+		TestRef(Ref));
+}
+
+static int QueueSha3Finish(u8 *Hash, u32 Ref)
+{
+	while (XSecure_ClientGetRequest(&Client) == NULL) {
+		(void)XSecure_ClientPoll(&Client);
+	}
+
+	return XSecure_Sha3FinishAsync(&Client, ADDR(Hash), TestCallback,
+		TestRef(Ref));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the SHA3-384 of "abc" computed through the
+* synchronous client.
+*
+******************************************************************************/
+static int TestSha3Vector(void)
+{
+	static const u8 Expected[XSECURE_MODEL_SHA3_HASH_LEN] = {
+		0xEC, 0x01, 0x49, 0x82, 0x88, 0x51, 0x6F, 0xC9,
+		0x26, 0x45, 0x9F, 0x58, 0xE2, 0xC6, 0xAD, 0x8D,
+		0xF9, 0xB4, 0x73, 0xCB, 0x0F, 0xC0, 0x8C, 0x25,
+		0x96, 0xDA, 0x7C, 0xF0, 0xE4, 0x9B, 0xE4, 0xB2,
+		0x98, 0xD8, 0x8C, 0xEA, 0x92, 0x7A, 0xC7, 0xF5,
+		0x39, 0xF1, 0xED, 0xF2, 0x28, 0x37, 0x6D, 0x25
+	};
+	u8 Data[3U] = { 'a', 'b', 'c' };
+	u8 Hash[XSECURE_MODEL_SHA3_HASH_LEN];
+
+	CHECK(XSecure_Sha3Digest(&Client, ADDR(Data), ADDR(Hash), 3U) ==
+		XST_SUCCESS);
+	CHECK(memcmp(Hash, Expected, sizeof(Hash)) == 0);
+	XSecureModel_Sha3Digest(Data, 3U, Hash);
+	CHECK(memcmp(Hash, Expected, sizeof(Hash)) == 0);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function hashes random messages in random chunks through the queue.
+*
+******************************************************************************/
+static int TestSha3Async(void)
+{
+	u8 Hash[XSECURE_MODEL_SHA3_HASH_LEN];
+	u8 Expected[XSECURE_MODEL_SHA3_HASH_LEN];
+	u32 Trial;
+	u32 Len;
+	u32 Offset;
+	u32 Chunk;
+	u32 Chunks;
+	u32 Index;
+	u32 CheckedPending = FALSE;
+
+	XSecureModel_SetCost(2000U, 1U);
+	for (Trial = 0U; Trial < NUM_SHA3_TRIALS; Trial++) {
+		Len = (u32)rand() % MAX_MSG_LEN;
+		for (Index = 0U; Index < Len; Index++) {
+			Msg[Index] = (u8)rand();
+		}
+
+		CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+		CallbackCount = 0U;
+		Chunks = 0U;
+		Offset = 0U;
+		do {
+			Chunk = 1U + ((u32)rand() % MAX_CHUNK_LEN);
+			if (Chunk > (Len - Offset)) {
+				Chunk = Len - Offset;
+			}
+			CHECK(QueueSha3Update(&Msg[Offset], Chunk, Chunks) ==
+				XST_SUCCESS);
+			Offset += Chunk;
+			Chunks++;
+		} while (Offset < Len);
+
+		if ((CheckedPending == FALSE) &&
+			(XSecure_ClientPoll(&Client) != 0U)) {
+			/* Synchronous calls share the IPI buffers */
+			CHECK(XSecure_Sha3Update(&Client, ADDR(Msg), 4U) ==
+				XST_FAILURE);
+			CHECK(XSecure_Sha3Finish(&Client, ADDR(Hash)) ==
+				XST_FAILURE);
+			CheckedPending = TRUE;
+		}
+
+		CHECK(QueueSha3Finish(Hash, Chunks) == XST_SUCCESS);
+		/* A new operation waits for the finish to complete */
+		if (XSecure_ClientPoll(&Client) != 0U) {
+			CHECK(XSecure_Sha3Initialize() == XST_FAILURE);
+		}
+		CHECK(XSecure_ClientWait(&Client) == XST_SUCCESS);
+
+		XSecureModel_Sha3Digest(Msg, Len, Expected);
+		CHECK(memcmp(Hash, Expected, sizeof(Hash)) == 0);
+		CHECK(CallbackCount == (Chunks + 1U));
+		for (Index = 0U; Index < CallbackCount; Index++) {
+			CHECK(CallbackRef[Index] == Index);
+			CHECK(CallbackStatus[Index] == XST_SUCCESS);
+		}
+	}
+	CHECK(CheckedPending == TRUE);
+	XSecureModel_SetCost(0U, 0U);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the failure of a request on the server.
+*
+******************************************************************************/
+static int TestSha3ServerFailure(void)
+{
+	u8 Hash[XSECURE_MODEL_SHA3_HASH_LEN];
+	u8 Expected[XSECURE_MODEL_SHA3_HASH_LEN];
+	u32 Index;
+
+	/* The second update fails, the third and the finish are dropped */
+	CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+	CallbackCount = 0U;
+	XSecureModel_FailRequest(1U, TEST_SERVER_ERROR);
+	for (Index = 0U; Index < 3U; Index++) {
+		CHECK(QueueSha3Update(&Msg[Index * 100U], 100U, Index) ==
+			XST_SUCCESS);
+	}
+	CHECK(QueueSha3Finish(Hash, 3U) == XST_SUCCESS);
+	CHECK(XSecure_ClientWait(&Client) == TEST_SERVER_ERROR);
+	CHECK(CallbackCount == 4U);
+	CHECK(CallbackStatus[0U] == XST_SUCCESS);
+	for (Index = 1U; Index < 4U; Index++) {
+		CHECK(CallbackRef[Index] == Index);
+		CHECK(CallbackStatus[Index] == TEST_SERVER_ERROR);
+	}
+
+	/* The state is ended when the failed update completes */
+	CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+	CallbackCount = 0U;
+	XSecureModel_FailRequest(0U, TEST_SERVER_ERROR);
+	CHECK(QueueSha3Update(Msg, 100U, 0U) == XST_SUCCESS);
+	CHECK(XSecure_ClientWait(&Client) == TEST_SERVER_ERROR);
+	CHECK(CallbackCount == 1U);
+	CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+
+	/* The next operation starts with a first packet */
+	CHECK(QueueSha3Update(Msg, 1000U, 0U) == XST_SUCCESS);
+	CHECK(QueueSha3Finish(Hash, 1U) == XST_SUCCESS);
+	CHECK(XSecure_ClientWait(&Client) == XST_SUCCESS);
+	XSecureModel_Sha3Digest(Msg, 1000U, Expected);
+	CHECK(memcmp(Hash, Expected, sizeof(Hash)) == 0);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks a request that cannot be sent. The PMC is removed
+* from the IPI targets, so that the driver has no buffer for it.
+*
+******************************************************************************/
+static int TestSendFailure(void)
+{
+	XIpiPsu_Target *TargetPtr =
+		&Mailbox.Agent.IpiInst.Config.TargetList[0U];
+	u32 Mask = TargetPtr->Mask;
+	u32 Requests = XSecureModel_GetRequestCount();
+
+	CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+	CallbackCount = 0U;
+	TargetPtr->Mask = 0U;
+	CHECK(QueueSha3Update(Msg, 100U, 7U) == XST_SUCCESS);
+	TargetPtr->Mask = Mask;
+
+	CHECK(CallbackCount == 1U);
+	CHECK(CallbackRef[0U] == 7U);
+	CHECK(CallbackStatus[0U] != XST_SUCCESS);
+	CHECK(XSecure_ClientWait(&Client) == CallbackStatus[0U]);
+	CHECK(CallbackCount == 1U);
+	CHECK(XSecureModel_GetRequestCount() == Requests);
+	CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+	CHECK(XSecure_Sha3Update(&Client, ADDR(Msg), 100U) == XST_SUCCESS);
+	CHECK(XSecure_Sha3Finish(&Client, ADDR(Out)) == XST_SUCCESS);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares the asynchronous AES with the synchronous one.
+*
+******************************************************************************/
+static int AesAsync(u32 OperationId, const u8 *In, u8 *OutPtr, u8 *Tag)
+{
+	u32 Offset = 0U;
+	u32 Chunk;
+	u32 IsLast;
+	int Status;
+
+	CallbackCount = 0U;
+	do {
+		Chunk = 16U * (1U + ((u32)rand() % 100U));
+		if (Chunk >= (AES_MSG_LEN - Offset)) {
+			Chunk = AES_MSG_LEN - Offset;
+		}
+		IsLast = ((Offset + Chunk) == AES_MSG_LEN) ? TRUE : FALSE;
+		while (XSecure_ClientGetRequest(&Client) == NULL) {
+			(void)XSecure_ClientPoll(&Client);
+		}
+		if (OperationId == (u32)XSECURE_ENCRYPT) {
+			Status = XSecure_AesEncryptUpdateAsync(&Client,
+				ADDR(&In[Offset]), ADDR(&OutPtr[Offset]), Chunk,
+				IsLast, TestCallback, NULL);
+		}
+		else {
+			Status = XSecure_AesDecryptUpdateAsync(&Client,
+				ADDR(&In[Offset]), ADDR(&OutPtr[Offset]), Chunk,
+				IsLast, TestCallback, NULL);
+		}
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		Offset += Chunk;
+	} while (Offset < AES_MSG_LEN);
+
+	while (XSecure_ClientGetRequest(&Client) == NULL) {
+		(void)XSecure_ClientPoll(&Client);
+	}
+	if (OperationId == (u32)XSECURE_ENCRYPT) {
+		Status = XSecure_AesEncryptFinalAsync(&Client, ADDR(Tag),
+			TestCallback, NULL);
+	}
+	else {
+		Status = XSecure_AesDecryptFinalAsync(&Client, ADDR(Tag),
+			TestCallback, NULL);
+	}
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	return XSecure_ClientWait(&Client);
+}
+
+static int TestAesAsync(void)
+{
+	static u8 RefOut[AES_MSG_LEN];
+	u8 Iv[AES_IV_LEN];
+	u8 RefTag[XSECURE_MODEL_GCM_TAG_LEN];
+	u8 Tag[XSECURE_MODEL_GCM_TAG_LEN];
+	u32 Index;
+
+	for (Index = 0U; Index < AES_MSG_LEN; Index++) {
+		Msg[Index] = (u8)rand();
+	}
+	for (Index = 0U; Index < AES_IV_LEN; Index++) {
+		Iv[Index] = (u8)rand();
+	}
+
+	XSecureModel_SetCost(2000U, 1U);
+	CHECK(XSecure_AesInitialize(&Client) == XST_SUCCESS);
+	CHECK(XSecure_AesEncryptInit(&Client, XSECURE_AES_USER_KEY_0,
+		XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+	CHECK(XSecure_AesEncryptUpdate(&Client, ADDR(Msg), ADDR(RefOut),
+		AES_MSG_LEN, TRUE) == XST_SUCCESS);
+	CHECK(XSecure_AesEncryptFinal(&Client, ADDR(RefTag)) == XST_SUCCESS);
+
+	CHECK(XSecure_AesEncryptInit(&Client, XSECURE_AES_USER_KEY_0,
+		XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+	CHECK(AesAsync((u32)XSECURE_ENCRYPT, Msg, Out, Tag) == XST_SUCCESS);
+	CHECK(memcmp(Out, RefOut, AES_MSG_LEN) == 0);
+	CHECK(memcmp(Tag, RefTag, sizeof(Tag)) == 0);
+	CHECK(CallbackCount > 2U);
+
+	CHECK(XSecure_AesDecryptInit(&Client, XSECURE_AES_USER_KEY_0,
+		XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+	CHECK(AesAsync((u32)XSECURE_DECRYPT, Out, Back, Tag) == XST_SUCCESS);
+	CHECK(memcmp(Back, Msg, AES_MSG_LEN) == 0);
+
+	Tag[0U] ^= 1U;
+	CHECK(XSecure_AesDecryptInit(&Client, XSECURE_AES_USER_KEY_0,
+		XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+	CHECK(AesAsync((u32)XSECURE_DECRYPT, Out, Back, Tag) != XST_SUCCESS);
+	CHECK(CallbackStatus[CallbackCount - 1U] != XST_SUCCESS);
+	CHECK(CallbackStatus[CallbackCount - 2U] == XST_SUCCESS);
+	XSecureModel_SetCost(0U, 0U);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the SHA3 throughput of the synchronous and
+* asynchronous APIs. The server time is modelled, the client time and the
+* polling of the IPI are real.
+*
+******************************************************************************/
+static int TestThroughput(void)
+{
+	static const u32 ChunkLen[] = { 64U, 256U, 1024U, 4096U, 16384U,
+		65536U };
+	u8 SyncHash[XSECURE_MODEL_SHA3_HASH_LEN];
+	u8 AsyncHash[XSECURE_MODEL_SHA3_HASH_LEN];
+	double Start;
+	double SyncUs;
+	double AsyncUs;
+	double ServerUs;
+	u32 Index;
+	u32 Offset;
+	u32 Chunk;
+	u32 Chunks;
+
+	for (Index = 0U; Index < PERF_MSG_LEN; Index++) {
+		Msg[Index] = (u8)rand();
+	}
+
+	XSecureModel_SetCost(PERF_REQUEST_NS, PERF_BYTE_NS);
+	printf("SHA3 of %u KB, server time %u ns per request and %u ns per "
+		"byte\r\n", PERF_MSG_LEN / 1024U, PERF_REQUEST_NS, PERF_BYTE_NS);
+	printf("  chunk  server MB/s   sync MB/s  async MB/s\r\n");
+	for (Index = 0U; Index < (sizeof(ChunkLen) / sizeof(ChunkLen[0U]));
+		Index++) {
+		Chunk = ChunkLen[Index];
+		Chunks = PERF_MSG_LEN / Chunk;
+
+		Start = NowUs();
+		CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+		for (Offset = 0U; Offset < PERF_MSG_LEN; Offset += Chunk) {
+			CHECK(XSecure_Sha3Update(&Client, ADDR(&Msg[Offset]),
+				Chunk) == XST_SUCCESS);
+		}
+		CHECK(XSecure_Sha3Finish(&Client, ADDR(SyncHash)) ==
+			XST_SUCCESS);
+		SyncUs = NowUs() - Start;
+
+		Start = NowUs();
+		CHECK(XSecure_Sha3Initialize() == XST_SUCCESS);
+		for (Offset = 0U; Offset < PERF_MSG_LEN; Offset += Chunk) {
+			CHECK(QueueSha3Update(&Msg[Offset], Chunk, 0U) ==
+				XST_SUCCESS);
+		}
+		CHECK(QueueSha3Finish(AsyncHash, 0U) == XST_SUCCESS);
+		CHECK(XSecure_ClientWait(&Client) == XST_SUCCESS);
+		AsyncUs = NowUs() - Start;
+
+		CHECK(memcmp(SyncHash, AsyncHash, sizeof(SyncHash)) == 0);
+		ServerUs = (((double)(Chunks + 1U) * PERF_REQUEST_NS) +
+			((double)PERF_MSG_LEN * PERF_BYTE_NS)) / 1e3;
+		printf("  %5u  %11.1f  %10.1f  %10.1f\r\n", Chunk,
+			PERF_MSG_LEN / ServerUs, PERF_MSG_LEN / SyncUs,
+			PERF_MSG_LEN / AsyncUs);
+	}
+	XSecureModel_SetCost(0U, 0U);
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	int Status = XST_FAILURE;
+
+	srand(1U);
+	if (XSecureModel_Init() != XST_SUCCESS) {
+		goto END;
+	}
+	if (XMailbox_Initialize(&Mailbox, 0U) != XST_SUCCESS) {
+		goto END;
+	}
+	if (XMailbox_SetSharedMem(&Mailbox, ADDR(SharedMem),
+		sizeof(SharedMem)) != XST_SUCCESS) {
+		goto END;
+	}
+	if (XSecure_ClientInit(&Client, &Mailbox) != XST_SUCCESS) {
+		goto END;
+	}
+	if (XSecure_ClientAsyncInit(&Client, Requests, RING_SIZE) !=
+		XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = TestSha3Vector();
+	if (Status == XST_SUCCESS) {
+		Status = TestSha3Async();
+	}
+	if (Status == XST_SUCCESS) {
+		Status = TestSha3ServerFailure();
+	}
+	if (Status == XST_SUCCESS) {
+		Status = TestSendFailure();
+	}
+	if (Status == XST_SUCCESS) {
+		Status = TestAesAsync();
+	}
+	if (Status == XST_SUCCESS) {
+		Status = TestThroughput();
+	}
+
+END:
+	if (Status != XST_SUCCESS) {
+		printf("Client loopback test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran client loopback test\r\n");
+	return 0;
+}
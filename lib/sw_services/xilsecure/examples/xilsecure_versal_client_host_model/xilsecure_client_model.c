@@ -0,0 +1,633 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilsecure_client_model.c
+*
+* This file contains the host model of the IPI channel between the client and
+* the PMC, and a stand-in for the PLM server.
+*
+* - The IPI message RAM is mapped at its hardware address, so that the
+*   ipipsu driver computes the buffer addresses as on the target.
+* - The IPI registers are simulated by Xil_In32 and Xil_Out32. A trigger to
+*   the PMC serves the request and sets its bit in the observation
+*   register. The bit is cleared by the first read of the observation
+*   register once the modelled processing time has elapsed.
+* - The server computes SHA3-384. Its AES is a stand-in stream cipher with a
+*   checksum tag, which checks that the chunks reach the server in order and
+*   with their own parameters. It is not AES-GCM.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "sleep.h"
+#include "xipipsu.h"
+#include "xipipsu_buf.h"
+#include "xsecure_defs.h"
+#include "xsecure_mailbox.h"
+#include "xilsecure_client_model.h"
+
+/************************** Constant Definitions *****************************/
+#define MODEL_MSG_RAM_SIZE		(0x10000U)
+#define MODEL_PMC_BUFFER_INDEX		(1U)
+#define MODEL_SHA3_RATE			(104U)
+#define MODEL_SHA3_FIRST_PACKET_MASK	(0x40000000U)
+#define MODEL_SHA3_CONTINUE_MASK	(0x80000000U)
+#define MODEL_SHA3_SIZE_MASK		(0x3FFFFFFFU)
+#define MODEL_AES_GCM_TAG_MISMATCH	(0x40)
+	/**< Value of XSECURE_AES_GCM_TAG_MISMATCH of the server */
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u64 Lane[25];
+	u32 Pos;
+	u32 Started;
+} Model_Sha3;
+
+typedef struct {
+	u64 Seed;
+	u64 Offset;
+	u64 Tag[2];
+	u32 OperationId;
+	u32 Started;
+} Model_Aes;
+
+typedef struct {
+	XIpiPsu Ipi;		/**< Used for the buffer addresses */
+	u32 Obs;		/**< Observation register of the client */
+	u64 DoneNs;		/**< Completion time of the request */
+	u32 RequestNs;		/**< Processing time of a request */
+	u32 ByteNs;		/**< Processing time of a data byte */
+	u32 Requests;		/**< Number of served requests */
+	u32 FailSet;		/**< TRUE if a request fails */
+	u32 FailIndex;		/**< Index of the request that fails */
+	int FailStatus;		/**< Status of the request that fails */
+	Model_Sha3 Sha3;
+	Model_Aes Aes;
+} Model_Server;
+
+/************************** Variable Definitions *****************************/
+u32 Xil_AssertStatus;
+
+XIpiPsu_Config XIpiPsu_ConfigTable[] =
+{
+	{
+		XPAR_XIPIPSU_0_DEVICE_ID,
+		XPAR_XIPIPSU_0_BASE_ADDRESS,
+		XPAR_XIPIPSU_0_BIT_MASK,
+		XPAR_XIPIPSU_0_BUFFER_INDEX,
+		XPAR_XIPIPSU_0_INT_ID,
+		XPAR_XIPIPSU_NUM_TARGETS,
+		{
+			{
+				XSECURE_TARGET_IPI_INT_MASK,
+				MODEL_PMC_BUFFER_INDEX
+			},
+			{
+				XPAR_XIPIPSU_0_BIT_MASK,
+				XPAR_XIPIPSU_0_BUFFER_INDEX
+			}
+		}
+	}
+};
+
+static Model_Server Model;
+
+static const u64 Sha3RoundConst[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+	0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+	0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* Destination lane of the pi step for each source lane */
+static const u8 Sha3Pi[25] = {
+	 0U, 10U, 20U,  5U, 15U,
+	16U,  1U, 11U, 21U,  6U,
+	 7U, 17U,  2U, 12U, 22U,
+	23U,  8U, 18U,  3U, 13U,
+	14U, 24U,  9U, 19U,  4U
+};
+
+static const u8 Sha3Rotation[25] = {
+	0U, 1U, 62U, 28U, 27U,
+	36U, 44U, 6U, 55U, 20U,
+	3U, 10U, 43U, 25U, 39U,
+	41U, 45U, 15U, 21U, 8U,
+	18U, 2U, 61U, 56U, 14U
+};
+
+/*****************************************************************************/
+/**
+*
+* SHA3-384 of the server.
+*
+******************************************************************************/
+static u64 Model_Rol(u64 Value, u32 Shift)
+{
+	return (Shift == 0U) ? Value : ((Value << Shift) | (Value >> (64U - Shift)));
+}
+
+static void Model_KeccakF(u64 *A)
+{
+	static const u8 Mod5[10] = { 0U, 1U, 2U, 3U, 4U, 0U, 1U, 2U, 3U, 4U };
+	u64 B[25];
+	u64 C[5];
+	u64 D;
+	u32 Round;
+	u32 X;
+	u32 Y;
+
+	for (Round = 0U; Round < 24U; Round++) {
+		for (X = 0U; X < 5U; X++) {
+			C[X] = A[X] ^ A[X + 5U] ^ A[X + 10U] ^ A[X + 15U] ^
+				A[X + 20U];
+		}
+		for (X = 0U; X < 5U; X++) {
+			D = C[Mod5[X + 4U]] ^ Model_Rol(C[Mod5[X + 1U]], 1U);
+			for (Y = 0U; Y < 25U; Y += 5U) {
+				A[X + Y] ^= D;
+			}
+		}
+		for (X = 0U; X < 25U; X++) {
+			B[Sha3Pi[X]] = Model_Rol(A[X], Sha3Rotation[X]);
+		}
+		for (Y = 0U; Y < 25U; Y += 5U) {
+			for (X = 0U; X < 5U; X++) {
+				A[X + Y] = B[X + Y] ^ ((~B[Mod5[X + 1U] + Y]) &
+					B[Mod5[X + 2U] + Y]);
+			}
+		}
+		A[0U] ^= Sha3RoundConst[Round];
+	}
+}
+
+static void Model_Sha3Start(Model_Sha3 *Sha3)
+{
+	memset(Sha3, 0, sizeof(*Sha3));
+	Sha3->Started = TRUE;
+}
+
+static void Model_Sha3XorByte(Model_Sha3 *Sha3, u32 Pos, u8 Byte)
+{
+	Sha3->Lane[Pos / 8U] ^= (u64)Byte << (8U * (Pos % 8U));
+}
+
+static void Model_Sha3Update(Model_Sha3 *Sha3, const u8 *Data, u32 Size)
+{
+	u32 Index;
+	u32 Lane;
+	u64 Value;
+
+	Index = 0U;
+	while (Index < Size) {
+		/* Whole lanes at a time when aligned to the block */
+		if ((Sha3->Pos == 0U) && ((Size - Index) >= MODEL_SHA3_RATE)) {
+			for (Lane = 0U; Lane < (MODEL_SHA3_RATE / 8U); Lane++) {
+				memcpy(&Value, &Data[Index + (8U * Lane)], 8U);
+				Sha3->Lane[Lane] ^= Value;
+			}
+			Index += MODEL_SHA3_RATE;
+			Model_KeccakF(Sha3->Lane);
+			continue;
+		}
+		Model_Sha3XorByte(Sha3, Sha3->Pos, Data[Index]);
+		Index++;
+		Sha3->Pos++;
+		if (Sha3->Pos == MODEL_SHA3_RATE) {
+			Model_KeccakF(Sha3->Lane);
+			Sha3->Pos = 0U;
+		}
+	}
+}
+
+static void Model_Sha3Finish(Model_Sha3 *Sha3, u8 *Hash)
+{
+	u32 Index;
+
+	Model_Sha3XorByte(Sha3, Sha3->Pos, 0x06U);
+	Model_Sha3XorByte(Sha3, MODEL_SHA3_RATE - 1U, 0x80U);
+	Model_KeccakF(Sha3->Lane);
+	for (Index = 0U; Index < XSECURE_MODEL_SHA3_HASH_LEN; Index++) {
+		Hash[Index] = (u8)(Sha3->Lane[Index / 8U] >> (8U * (Index % 8U)));
+	}
+	Sha3->Started = FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the SHA3-384 hash of a buffer with the model of the
+* server, as a reference for the tests.
+*
+* @param	Data is the data to hash.
+* @param	Size is the size of the data in bytes.
+* @param	Hash is the buffer of XSECURE_MODEL_SHA3_HASH_LEN bytes for the
+*		hash.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_Sha3Digest(const u8 *Data, u32 Size, u8 *Hash)
+{
+	Model_Sha3 Sha3;
+
+	Model_Sha3Start(&Sha3);
+	Model_Sha3Update(&Sha3, Data, Size);
+	Model_Sha3Finish(&Sha3, Hash);
+}
+
+/*****************************************************************************/
+/**
+*
+* Stand-in AES of the server. The key stream depends on the IV and on the
+* offset in the message, and the tag is a checksum of the ciphertext.
+*
+******************************************************************************/
+static u64 Model_Mix(u64 Value)
+{
+	Value += 0x9E3779B97F4A7C15ULL;
+	Value = (Value ^ (Value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+	Value = (Value ^ (Value >> 27U)) * 0x94D049BB133111EBULL;
+	return Value ^ (Value >> 31U);
+}
+
+static void Model_AesCrypt(Model_Aes *Aes, const u8 *In, u8 *Out, u32 Size)
+{
+	u32 Index;
+	u8 Cipher;
+	u8 Plain;
+
+	for (Index = 0U; Index < Size; Index++) {
+		u8 Key = (u8)(Model_Mix(Aes->Seed + (Aes->Offset / 8U)) >>
+			(8U * (Aes->Offset % 8U)));
+
+		if (Aes->OperationId == (u32)XSECURE_ENCRYPT) {
+			Plain = In[Index];
+			Cipher = Plain ^ Key;
+		}
+		else {
+			Cipher = In[Index];
+			Plain = Cipher ^ Key;
+		}
+		Out[Index] = (Aes->OperationId == (u32)XSECURE_ENCRYPT) ?
+			Cipher : Plain;
+		Aes->Tag[0U] = (Aes->Tag[0U] ^ Cipher) * 0x100000001B3ULL;
+		Aes->Tag[1U] = Model_Mix(Aes->Tag[1U] + Cipher);
+		Aes->Offset++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Server.
+*
+******************************************************************************/
+static void *Model_Addr(u32 Low, u32 High)
+{
+	return (void *)(UINTPTR)(((u64)High << 32U) | Low);
+}
+
+static u64 Model_NowNs(void)
+{
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+	return ((u64)Now.tv_sec * 1000000000ULL) + (u64)Now.tv_nsec;
+}
+
+static u32 *Model_Buffer(u32 SrcMask, u32 DestMask, u32 BufferType)
+{
+	return XIpiPsu_GetBufferAddress(&Model.Ipi, SrcMask, DestMask,
+		BufferType);
+}
+
+static u32 Model_DataSize(const u32 *Msg)
+{
+	u32 ApiId = Msg[0U] & XSECURE_API_ID_MASK;
+	const XSecure_AesInParams *InParams;
+	u32 Size = 0U;
+
+	if ((ApiId == (u32)XSECURE_API_SHA3_UPDATE) &&
+		((Msg[3U] & MODEL_SHA3_CONTINUE_MASK) != 0U)) {
+		Size = Msg[3U] & MODEL_SHA3_SIZE_MASK;
+	}
+	else if ((ApiId == (u32)XSECURE_API_AES_ENCRYPT_UPDATE) ||
+		(ApiId == (u32)XSECURE_API_AES_DECRYPT_UPDATE)) {
+		InParams = Model_Addr(Msg[1U], Msg[2U]);
+		Size = InParams->Size;
+	}
+
+	return Size;
+}
+
+static int Model_Sha3Request(const u32 *Msg)
+{
+	if ((Msg[3U] & MODEL_SHA3_FIRST_PACKET_MASK) != 0U) {
+		Model_Sha3Start(&Model.Sha3);
+	}
+	if (Model.Sha3.Started == FALSE) {
+		return XST_FAILURE;
+	}
+
+	if ((Msg[3U] & MODEL_SHA3_CONTINUE_MASK) != 0U) {
+		Model_Sha3Update(&Model.Sha3, Model_Addr(Msg[1U], Msg[2U]),
+			Msg[3U] & MODEL_SHA3_SIZE_MASK);
+	}
+	else {
+		Model_Sha3Finish(&Model.Sha3, Model_Addr(Msg[4U], Msg[5U]));
+	}
+
+	return XST_SUCCESS;
+}
+
+static int Model_AesRequest(u32 ApiId, const u32 *Msg)
+{
+	const XSecure_AesInitOps *InitOps;
+	const XSecure_AesInParams *InParams;
+	u8 Tag[XSECURE_MODEL_GCM_TAG_LEN];
+	u32 OperationId = (u32)XSECURE_ENCRYPT;
+	int Status = XST_SUCCESS;
+
+	if ((ApiId == (u32)XSECURE_API_AES_DECRYPT_UPDATE) ||
+		(ApiId == (u32)XSECURE_API_AES_DECRYPT_FINAL)) {
+		OperationId = (u32)XSECURE_DECRYPT;
+	}
+
+	switch (ApiId) {
+	case XSECURE_API_AES_OP_INIT:
+		InitOps = Model_Addr(Msg[1U], Msg[2U]);
+		memset(&Model.Aes, 0, sizeof(Model.Aes));
+		Model.Aes.Seed = Model_Mix(*(const u64 *)Model_Addr(
+			(u32)InitOps->IvAddr, (u32)(InitOps->IvAddr >> 32U)));
+		Model.Aes.OperationId = InitOps->OperationId;
+		Model.Aes.Started = TRUE;
+		break;
+	case XSECURE_API_AES_ENCRYPT_UPDATE:
+	case XSECURE_API_AES_DECRYPT_UPDATE:
+		if ((Model.Aes.Started == FALSE) ||
+			(Model.Aes.OperationId != OperationId)) {
+			Status = XST_FAILURE;
+			break;
+		}
+		InParams = Model_Addr(Msg[1U], Msg[2U]);
+		Model_AesCrypt(&Model.Aes, Model_Addr((u32)InParams->InDataAddr,
+			(u32)(InParams->InDataAddr >> 32U)),
+			Model_Addr(Msg[3U], Msg[4U]), InParams->Size);
+		break;
+	case XSECURE_API_AES_ENCRYPT_FINAL:
+	case XSECURE_API_AES_DECRYPT_FINAL:
+		if ((Model.Aes.Started == FALSE) ||
+			(Model.Aes.OperationId != OperationId)) {
+			Status = XST_FAILURE;
+			break;
+		}
+		memcpy(Tag, Model.Aes.Tag, sizeof(Tag));
+		if (OperationId == (u32)XSECURE_ENCRYPT) {
+			memcpy(Model_Addr(Msg[1U], Msg[2U]), Tag, sizeof(Tag));
+		}
+		else if (memcmp(Model_Addr(Msg[1U], Msg[2U]), Tag,
+			sizeof(Tag)) != 0) {
+			Status = MODEL_AES_GCM_TAG_MISMATCH;
+		}
+		Model.Aes.Started = FALSE;
+		break;
+	default:
+		/* Initialization, key and AAD requests only succeed */
+		break;
+	}
+
+	return Status;
+}
+
+static void Model_Serve(void)
+{
+	u32 *Msg = Model_Buffer(XPAR_XIPIPSU_0_BIT_MASK,
+		XSECURE_TARGET_IPI_INT_MASK, XIPIPSU_BUF_TYPE_MSG);
+	u32 *Resp = Model_Buffer(XSECURE_TARGET_IPI_INT_MASK,
+		XPAR_XIPIPSU_0_BIT_MASK, XIPIPSU_BUF_TYPE_RESP);
+	u32 ApiId = Msg[0U] & XSECURE_API_ID_MASK;
+	int Status;
+
+	if ((Model.FailSet == TRUE) && (Model.FailIndex == Model.Requests)) {
+		Model.FailSet = FALSE;
+		Status = Model.FailStatus;
+	}
+	else if (((Msg[0U] >> 8U) & 0xFFU) != XILSECURE_MODULE_ID) {
+		Status = XST_INVALID_PARAM;
+	}
+	else if (ApiId == (u32)XSECURE_API_SHA3_UPDATE) {
+		Status = Model_Sha3Request(Msg);
+	}
+	else if ((ApiId >= (u32)XSECURE_API_AES_INIT) &&
+		(ApiId < (u32)XSECURE_API_MAX)) {
+		Status = Model_AesRequest(ApiId, Msg);
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+
+	memset(Resp, 0, RESPONSE_ARG_CNT * sizeof(u32));
+	Resp[0U] = (u32)Status;
+	Model.Requests++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function maps the IPI message RAM and resets the server.
+*
+* @return	XST_SUCCESS if the message RAM is mapped, XST_FAILURE if its
+*		address is not available on the host.
+*
+******************************************************************************/
+int XSecureModel_Init(void)
+{
+	void *Ram = mmap((void *)(UINTPTR)XIPIPSU_MSG_RAM_BASE,
+		MODEL_MSG_RAM_SIZE, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+	if (Ram != (void *)(UINTPTR)XIPIPSU_MSG_RAM_BASE) {
+		printf("Cannot map the IPI message RAM at 0x%x\r\n",
+			XIPIPSU_MSG_RAM_BASE);
+		return XST_FAILURE;
+	}
+
+	memset(&Model, 0, sizeof(Model));
+	(void)XIpiPsu_CfgInitialize(&Model.Ipi, &XIpiPsu_ConfigTable[0U],
+		XIpiPsu_ConfigTable[0U].BaseAddress);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the processing time of the server. A request completes
+* RequestNs plus ByteNs for every data byte after its trigger.
+*
+* @param	RequestNs is the time of a request in ns.
+* @param	ByteNs is the time of a data byte in ns.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_SetCost(u32 RequestNs, u32 ByteNs)
+{
+	Model.RequestNs = RequestNs;
+	Model.ByteNs = ByteNs;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function makes a request fail with the given status instead of being
+* served.
+*
+* @param	Index is the number of requests served before the one that
+*		fails.
+* @param	Status is the response status of the request.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_FailRequest(u32 Index, int Status)
+{
+	Model.FailSet = TRUE;
+	Model.FailIndex = Model.Requests + Index;
+	Model.FailStatus = Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of requests served since the model was
+* initialized.
+*
+* @return	Number of served requests.
+*
+******************************************************************************/
+u32 XSecureModel_GetRequestCount(void)
+{
+	return Model.Requests;
+}
+
+/*****************************************************************************/
+/**
+*
+* Register accesses. The IPI registers of the client are simulated, the
+* other addresses are host memory.
+*
+******************************************************************************/
+u32 Xil_In32(UINTPTR Addr)
+{
+	if (Addr == (XPAR_XIPIPSU_0_BASE_ADDRESS + XIPIPSU_OBS_OFFSET)) {
+		if ((Model.Obs != 0U) && (Model_NowNs() >= Model.DoneNs)) {
+			Model.Obs = 0U;
+		}
+		return Model.Obs;
+	}
+	if ((Addr & ~(UINTPTR)0xFFFFU) == XPAR_XIPIPSU_0_BASE_ADDRESS) {
+		return 0U;
+	}
+
+	return *(volatile u32 *)Addr;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	const u32 *Msg;
+	u64 StartNs;
+
+	if (Addr == (XPAR_XIPIPSU_0_BASE_ADDRESS + XIPIPSU_TRIG_OFFSET)) {
+		if ((Value & XSECURE_TARGET_IPI_INT_MASK) != 0U) {
+			/*
+			 * The request is served right away, its modelled time
+			 * includes the time taken by the model itself.
+			 */
+			StartNs = Model_NowNs();
+			Msg = Model_Buffer(XPAR_XIPIPSU_0_BIT_MASK,
+				XSECURE_TARGET_IPI_INT_MASK,
+				XIPIPSU_BUF_TYPE_MSG);
+			Model.DoneNs = StartNs + Model.RequestNs +
+				((u64)Model.ByteNs * Model_DataSize(Msg));
+			Model_Serve();
+			Model.Obs |= XSECURE_TARGET_IPI_INT_MASK;
+		}
+		return;
+	}
+	if ((Addr & ~(UINTPTR)0xFFFFU) == XPAR_XIPIPSU_0_BASE_ADDRESS) {
+		return;
+	}
+
+	*(volatile u32 *)Addr = Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* BSP functions used by the libraries.
+*
+******************************************************************************/
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+void xil_printf(const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, Ctrl1);
+	(void)vprintf(Ctrl1, Args);
+	va_end(Args);
+}
+
+void usleep(ULONG useconds)
+{
+	struct timespec Delay;
+
+	Delay.tv_sec = (time_t)(useconds / 1000000UL);
+	Delay.tv_nsec = (long)((useconds % 1000000UL) * 1000UL);
+	(void)nanosleep(&Delay, NULL);
+}
+
+void Xil_DCacheFlushRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	(void)Len;
+}
+
+void Xil_DCacheInvalidateRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	(void)Len;
+}
@@ -0,0 +1,40 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilsecure_client_model.h
+*
+* This file contains the interface of the host model of the IPI channel and
+* of the PLM server used by the client tests.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef XILSECURE_CLIENT_MODEL_H_
+#define XILSECURE_CLIENT_MODEL_H_
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_MODEL_SHA3_HASH_LEN	(48U)	/**< SHA3-384 hash length */
+#define XSECURE_MODEL_GCM_TAG_LEN	(16U)	/**< Stand-in tag length */
+
+/************************** Function Prototypes ******************************/
+int XSecureModel_Init(void);
+void XSecureModel_SetCost(u32 RequestNs, u32 ByteNs);
+void XSecureModel_FailRequest(u32 Index, int Status);
+u32 XSecureModel_GetRequestCount(void);
+void XSecureModel_Sha3Digest(const u8 *Data, u32 Size, u8 *Hash);
+
+#endif /* XILSECURE_CLIENT_MODEL_H_ */
@@ -0,0 +1,17 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* The host model has no BSP configuration.
+*
+******************************************************************************/
+#ifndef XSECURE_SERVER_MODEL_BSPCONFIG_H_
+#define XSECURE_SERVER_MODEL_BSPCONFIG_H_
+
+#endif /* XSECURE_SERVER_MODEL_BSPCONFIG_H_ */
@@ -0,0 +1,24 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mb_interface.h
+*
+* Extended address accesses of the PLM, as host memory accesses.
+*
+******************************************************************************/
+#ifndef XSECURE_SERVER_MODEL_MB_INTERFACE_H_
+#define XSECURE_SERVER_MODEL_MB_INTERFACE_H_
+
+#include "xil_types.h"
+
+#define lwea(lladdr)		(*(volatile u32 *)(UINTPTR)(lladdr))
+#define lbuea(lladdr)		(*(volatile u8 *)(UINTPTR)(lladdr))
+#define swea(lladdr, data)	(*(volatile u32 *)(UINTPTR)(lladdr) = (data))
+#define sbea(lladdr, data)	(*(volatile u8 *)(UINTPTR)(lladdr) = (data))
+
+#endif /* XSECURE_SERVER_MODEL_MB_INTERFACE_H_ */
@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Register accesses of the host model. The 32-bit accesses are functions so
+* that the model can simulate the SHA3, AES and SSS registers. The other
+* accesses are host memory accesses.
+*
+******************************************************************************/
+#ifndef XSECURE_SERVER_MODEL_XIL_IO_H_
+#define XSECURE_SERVER_MODEL_XIL_IO_H_
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "mb_interface.h"
+
+#define INLINE inline
+
+u32 Xil_In32(UINTPTR Addr);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+
+static INLINE u8 Xil_In8(UINTPTR Addr)
+{
+	return *(volatile u8 *)Addr;
+}
+
+static INLINE u64 Xil_In64(UINTPTR Addr)
+{
+	return *(volatile u64 *)Addr;
+}
+
+static INLINE void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	*(volatile u8 *)Addr = Value;
+}
+
+static INLINE void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	*(volatile u64 *)Addr = Value;
+}
+
+static INLINE int Xil_SecureOut32(UINTPTR Addr, u32 Value)
+{
+	int Status = XST_FAILURE;
+
+	Xil_Out32(Addr, Value);
+	if ((Xil_In32(Addr) == Value) && (Xil_In32(Addr) == Value)) {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+static INLINE u32 Xil_EndianSwap32(u32 Data)
+{
+	return ((Data & 0xFFU) << 24U) | ((Data & 0xFF00U) << 8U) |
+		((Data >> 8U) & 0xFF00U) | (Data >> 24U);
+}
+
+#define Xil_Htonl	Xil_EndianSwap32
+#define Xil_Ntohl	Xil_EndianSwap32
+
+#endif /* XSECURE_SERVER_MODEL_XIL_IO_H_ */
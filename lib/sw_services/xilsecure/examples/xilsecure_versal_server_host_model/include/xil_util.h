@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_util.h
+*
+* Utility functions of the host model. The BSP header includes the BSP
+* xil_io.h from its own directory, which would bypass the register model.
+*
+******************************************************************************/
+#ifndef XSECURE_SERVER_MODEL_XIL_UTIL_H_
+#define XSECURE_SERVER_MODEL_XIL_UTIL_H_
+
+#include "xil_types.h"
+#include "xil_io.h"
+#include "xstatus.h"
+
+u32 Xil_WaitForEvent(u32 RegAddr, u32 EventMask, u32 Event, u32 Timeout);
+int Xil_SecureZeroize(u8 *DataPtr, const u32 Length);
+int Xil_SMemSet(void *Dest, const u32 DestSize, const u8 Data,
+	const u32 Len);
+
+#endif /* XSECURE_SERVER_MODEL_XIL_UTIL_H_ */
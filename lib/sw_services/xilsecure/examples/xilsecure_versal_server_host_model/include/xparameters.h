@@ -0,0 +1,21 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Hardware parameters of the host model. The server uses PMC DMA 0.
+*
+******************************************************************************/
+#ifndef XSECURE_SERVER_MODEL_XPARAMETERS_H_
+#define XSECURE_SERVER_MODEL_XPARAMETERS_H_
+
+#define XPAR_XCSUDMA_NUM_INSTANCES	2U
+#define XPAR_XCSUDMA_0_DEVICE_ID	0U
+#define XPAR_XCSUDMA_1_DEVICE_ID	1U
+
+#endif /* XSECURE_SERVER_MODEL_XPARAMETERS_H_ */
@@ -0,0 +1,749 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilsecure_server_model.c
+*
+* This file contains the host model of the PMC DMA and of the SHA3 and AES
+* engines, under the Versal SHA3 and AES server drivers.
+*
+* - The PMC DMA functions move the data between host memory and the engine
+*   selected by the SSS configuration register. They count the transfers,
+*   the transfers from unaligned addresses, which the hardware does not
+*   support, and the byte swap settings that do not match the engine.
+* - The SHA3 engine absorbs the data as the hardware does, the driver adding
+*   the padding. The digest registers give the SHA3-384 hash, which
+*   XSecure_Sha3Kat checks against the hardware vector.
+* - The AES engine takes the IV after the start of a message, then the data
+*   up to the transfer marked last, then the tag. It is a stand-in stream
+*   cipher with a checksum tag, computed on the byte swapped stream the
+*   engine sees. It is not AES-GCM.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_printf.h"
+#include "xil_io.h"
+#include "xil_cache.h"
+#include "xil_util.h"
+#include "sleep.h"
+#include "xpmcdma.h"
+#include "xsecure_sss.h"
+#include "xsecure_sha.h"
+#include "xsecure_sha_hw.h"
+#include "xsecure_aes.h"
+#include "xsecure_aes_core_hw.h"
+#include "xilsecure_server_model.h"
+
+/************************** Constant Definitions *****************************/
+#define MODEL_SHA3_RATE			(104U)
+#define MODEL_MAX_REGS			(64U)
+
+/**************************** Type Definitions *******************************/
+typedef enum {
+	MODEL_AES_IDLE = 0,
+	MODEL_AES_IV,
+	MODEL_AES_DATA,
+	MODEL_AES_TAG
+} Model_AesPhase;
+
+typedef struct {
+	u64 Lane[25];
+	u32 Pos;
+} Model_Sha3;
+
+typedef struct {
+	Model_AesPhase Phase;
+	u8 Iv[XSECURE_MODEL_AES_IV_LEN];
+	u32 IvLen;
+	u64 Seed;
+	u32 Pos;
+	u64 Sum[2];
+	u8 IsEncrypt;
+	u8 TagPass;
+} Model_Aes;
+
+typedef struct {
+	u32 RegAddr[MODEL_MAX_REGS];
+	u32 RegVal[MODEL_MAX_REGS];
+	u32 RegCount;
+	u8 EndianType[2];
+	u8 DstPending;
+	u64 DstAddr;
+	u32 DstLen;
+	Model_Sha3 Sha3;
+	Model_Aes Aes;
+	XSecureModel_Counters Counters;
+} Model_Engines;
+
+/************************** Variable Definitions *****************************/
+static Model_Engines Model;
+u32 Xil_AssertStatus;
+
+static const u64 Sha3RoundConst[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+	0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+	0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* Destination lane of the pi step for each source lane */
+static const u8 Sha3Pi[25] = {
+	 0U, 10U, 20U,  5U, 15U,
+	16U,  1U, 11U, 21U,  6U,
+	 7U, 17U,  2U, 12U, 22U,
+	23U,  8U, 18U,  3U, 13U,
+	14U, 24U,  9U, 19U,  4U
+};
+
+static const u8 Sha3Rotation[25] = {
+	0U, 1U, 62U, 28U, 27U,
+	36U, 44U, 6U, 55U, 20U,
+	3U, 10U, 43U, 25U, 39U,
+	41U, 45U, 15U, 21U, 8U,
+	18U, 2U, 61U, 56U, 14U
+};
+
+/*****************************************************************************/
+/**
+*
+* SHA3 engine. It absorbs the data it receives, without padding.
+*
+******************************************************************************/
+static u64 Model_Rol(u64 Value, u32 Shift)
+{
+	return (Shift == 0U) ? Value : ((Value << Shift) | (Value >> (64U - Shift)));
+}
+
+static void Model_KeccakF(u64 *A)
+{
+	static const u8 Mod5[10] = { 0U, 1U, 2U, 3U, 4U, 0U, 1U, 2U, 3U, 4U };
+	u64 B[25];
+	u64 C[5];
+	u64 D;
+	u32 Round;
+	u32 X;
+	u32 Y;
+
+	for (Round = 0U; Round < 24U; Round++) {
+		for (X = 0U; X < 5U; X++) {
+			C[X] = A[X] ^ A[X + 5U] ^ A[X + 10U] ^ A[X + 15U] ^
+				A[X + 20U];
+		}
+		for (X = 0U; X < 5U; X++) {
+			D = C[Mod5[X + 4U]] ^ Model_Rol(C[Mod5[X + 1U]], 1U);
+			for (Y = 0U; Y < 25U; Y += 5U) {
+				A[X + Y] ^= D;
+			}
+		}
+		for (X = 0U; X < 25U; X++) {
+			B[Sha3Pi[X]] = Model_Rol(A[X], Sha3Rotation[X]);
+		}
+		for (Y = 0U; Y < 25U; Y += 5U) {
+			for (X = 0U; X < 5U; X++) {
+				A[X + Y] = B[X + Y] ^ ((~B[Mod5[X + 1U] + Y]) &
+					B[Mod5[X + 2U] + Y]);
+			}
+		}
+		A[0U] ^= Sha3RoundConst[Round];
+	}
+}
+
+static void Model_Sha3Absorb(Model_Sha3 *Sha3, const u8 *Data, u32 Size)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Size; Index++) {
+		Sha3->Lane[Sha3->Pos / 8U] ^=
+			(u64)Data[Index] << (8U * (Sha3->Pos % 8U));
+		Sha3->Pos++;
+		if (Sha3->Pos == MODEL_SHA3_RATE) {
+			Model_KeccakF(Sha3->Lane);
+			Sha3->Pos = 0U;
+		}
+	}
+}
+
+static u8 Model_Sha3Byte(const Model_Sha3 *Sha3, u32 Index)
+{
+	return (u8)(Sha3->Lane[Index / 8U] >> (8U * (Index % 8U)));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the SHA3-384 hash of a buffer with the model of the
+* engine and the NIST padding, as a reference for the tests.
+*
+* @param	Data is the data to hash.
+* @param	Size is the size of the data in bytes.
+* @param	Hash is the buffer of XSECURE_MODEL_SHA3_HASH_LEN bytes for the
+*		hash.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_Sha3Digest(const u8 *Data, u32 Size, u8 *Hash)
+{
+	Model_Sha3 Sha3;
+	u8 Pad[MODEL_SHA3_RATE];
+	u32 PadLen;
+	u32 Index;
+
+	memset(&Sha3, 0, sizeof(Sha3));
+	Model_Sha3Absorb(&Sha3, Data, Size);
+	PadLen = MODEL_SHA3_RATE - Sha3.Pos;
+	memset(Pad, 0, sizeof(Pad));
+	Pad[0U] = 0x06U;
+	Pad[PadLen - 1U] |= 0x80U;
+	Model_Sha3Absorb(&Sha3, Pad, PadLen);
+	for (Index = 0U; Index < XSECURE_MODEL_SHA3_HASH_LEN; Index++) {
+		Hash[Index] = Model_Sha3Byte(&Sha3, Index);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* AES engine stand-in. The keystream depends on the IV and on the position
+* in the message, the tag on the ciphertext and its length.
+*
+******************************************************************************/
+static u64 Model_Mix(u64 Value)
+{
+	u64 Mixed = Value + 0x9E3779B97F4A7C15ULL;
+
+	Mixed = (Mixed ^ (Mixed >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+	Mixed = (Mixed ^ (Mixed >> 27U)) * 0x94D049BB133111EBULL;
+	return Mixed ^ (Mixed >> 31U);
+}
+
+static void Model_AesStart(Model_Aes *Aes, const u8 *Iv)
+{
+	u64 Low;
+	u64 High;
+
+	memcpy(&Low, Iv, sizeof(Low));
+	memcpy(&High, &Iv[8U], sizeof(High));
+	Aes->Seed = Model_Mix(Low ^ Model_Mix(High));
+	Aes->Pos = 0U;
+	Aes->Sum[0U] = 0U;
+	Aes->Sum[1U] = 0U;
+}
+
+static u8 Model_AesByte(Model_Aes *Aes, u8 In)
+{
+	u8 Out = In ^ (u8)(Model_Mix(Aes->Seed + (Aes->Pos / 8U)) >>
+		(8U * (Aes->Pos % 8U)));
+	u8 Cipher = (Aes->IsEncrypt == TRUE) ? Out : In;
+
+	Aes->Sum[Aes->Pos % 2U] = Model_Mix(Aes->Sum[Aes->Pos % 2U] ^ Cipher);
+	Aes->Pos++;
+	return Out;
+}
+
+static void Model_AesTag(const Model_Aes *Aes, u8 *Tag)
+{
+	u64 Value[2];
+
+	Value[0U] = Model_Mix(Aes->Sum[0U] ^ Aes->Seed ^ Aes->Pos);
+	Value[1U] = Model_Mix(Aes->Sum[1U] ^ Value[0U]);
+	memcpy(Tag, Value, XSECURE_MODEL_AES_TAG_LEN);
+}
+
+static void Model_SwapWords(u8 *Data, u32 Size)
+{
+	u32 Index;
+	u8 Byte;
+
+	for (Index = 0U; (Index + 3U) < Size; Index += 4U) {
+		Byte = Data[Index];
+		Data[Index] = Data[Index + 3U];
+		Data[Index + 3U] = Byte;
+		Byte = Data[Index + 1U];
+		Data[Index + 1U] = Data[Index + 2U];
+		Data[Index + 2U] = Byte;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts or decrypts a buffer with the AES stand-in, with the
+* byte swap of the driver, as a reference for the tests.
+*
+* @param	Iv is the IV of XSECURE_MODEL_AES_IV_LEN bytes.
+* @param	In is the input data.
+* @param	Out is the output buffer.
+* @param	Size is the size of the data in bytes, a multiple of 4.
+* @param	IsEncrypt is TRUE to encrypt and FALSE to decrypt.
+* @param	Tag is the buffer of XSECURE_MODEL_AES_TAG_LEN bytes for the
+*		tag.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_AesCrypt(const u8 *Iv, const u8 *In, u8 *Out, u32 Size,
+	u8 IsEncrypt, u8 *Tag)
+{
+	Model_Aes Aes;
+	u8 SwappedIv[XSECURE_MODEL_AES_IV_LEN];
+	u32 Index;
+
+	memset(&Aes, 0, sizeof(Aes));
+	memcpy(SwappedIv, Iv, sizeof(SwappedIv));
+	Model_SwapWords(SwappedIv, sizeof(SwappedIv));
+	Aes.IsEncrypt = IsEncrypt;
+	Model_AesStart(&Aes, SwappedIv);
+
+	memcpy(Out, In, Size);
+	Model_SwapWords(Out, Size);
+	for (Index = 0U; Index < Size; Index++) {
+		Out[Index] = Model_AesByte(&Aes, Out[Index]);
+	}
+	Model_SwapWords(Out, Size);
+
+	Model_AesTag(&Aes, Tag);
+	Model_SwapWords(Tag, XSECURE_MODEL_AES_TAG_LEN);
+}
+
+/*****************************************************************************/
+/**
+*
+* Register file of the engines and of the SSS.
+*
+******************************************************************************/
+static u32 *Model_Reg(u32 Addr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Model.RegCount; Index++) {
+		if (Model.RegAddr[Index] == Addr) {
+			return &Model.RegVal[Index];
+		}
+	}
+	if (Model.RegCount == MODEL_MAX_REGS) {
+		printf("Model register file full\r\n");
+		return NULL;
+	}
+	Model.RegAddr[Model.RegCount] = Addr;
+	Model.RegVal[Model.RegCount] = 0U;
+	Model.RegCount++;
+
+	return &Model.RegVal[Model.RegCount - 1U];
+}
+
+static u32 Model_ReadReg(u32 Addr)
+{
+	u32 *Reg = Model_Reg(Addr);
+
+	return (Reg != NULL) ? *Reg : 0U;
+}
+
+static int Model_IsRegister(UINTPTR Addr)
+{
+	/* The PMC registers are above the host buffers */
+	return (Addr >= 0xF0000000U) && (Addr <= 0xFFFFFFFFU);
+}
+
+/*****************************************************************************/
+/**
+*
+* PMC DMA. A source transfer goes to the engine the SSS routes DMA 0 to. A
+* destination transfer is held until the engine produces its data.
+*
+******************************************************************************/
+static void Model_CheckAddress(u64 Addr)
+{
+	if ((Addr & (u64)XPMCDMA_ADDR_LSB_MASK) != 0U) {
+		Model.Counters.Unaligned++;
+	}
+}
+
+static u8 *Model_DstPtr(u32 Size)
+{
+	u8 *Ptr = NULL;
+
+	if ((Model.DstPending == TRUE) && (Model.DstLen >= Size)) {
+		/* The DMA ignores the low address bits */
+		Ptr = (u8 *)(UINTPTR)(Model.DstAddr &
+			~(u64)XPMCDMA_ADDR_LSB_MASK);
+		Model.DstAddr += Size;
+		Model.DstLen -= Size;
+		if (Model.DstLen == 0U) {
+			Model.DstPending = FALSE;
+		}
+	}
+	else {
+		Model.Counters.SequenceErrors++;
+	}
+
+	return Ptr;
+}
+
+static void Model_AesTransfer(u8 *Data, u32 Size, u8 IsLast)
+{
+	Model_Aes *Aes = &Model.Aes;
+	u8 Tag[XSECURE_MODEL_AES_TAG_LEN];
+	u8 *Out;
+	u32 Index;
+
+	if ((Model.EndianType[XPMCDMA_SRC_CHANNEL] != XSECURE_AES_DATA_SWAP_VAL_MASK) &&
+		(Size != 0U)) {
+		Model.Counters.SwapErrors++;
+	}
+	Model_SwapWords(Data, Size);
+
+	switch (Aes->Phase) {
+	case MODEL_AES_IV:
+		if (Size != XSECURE_MODEL_AES_IV_LEN) {
+			Model.Counters.SequenceErrors++;
+			break;
+		}
+		Aes->IsEncrypt = (Model_ReadReg(XSECURE_AES_BASEADDR +
+			XSECURE_AES_MODE_OFFSET) == XSECURE_AES_MODE_ENC) ?
+			TRUE : FALSE;
+		Model_AesStart(Aes, Data);
+		Aes->Phase = MODEL_AES_DATA;
+		break;
+	case MODEL_AES_DATA:
+		if (Model.EndianType[XPMCDMA_DST_CHANNEL] !=
+			XSECURE_AES_DATA_SWAP_VAL_MASK) {
+			Model.Counters.SwapErrors++;
+		}
+		Out = Model_DstPtr(Size);
+		for (Index = 0U; Index < Size; Index++) {
+			Data[Index] = Model_AesByte(Aes, Data[Index]);
+		}
+		Model_SwapWords(Data, Size);
+		if (Out != NULL) {
+			memcpy(Out, Data, Size);
+		}
+		if (IsLast == TRUE) {
+			Aes->Phase = MODEL_AES_TAG;
+		}
+		break;
+	case MODEL_AES_TAG:
+		/* Tag given to a decryption */
+		Model_AesTag(Aes, Tag);
+		Aes->TagPass = ((Size == sizeof(Tag)) &&
+			(memcmp(Data, Tag, sizeof(Tag)) == 0)) ? TRUE : FALSE;
+		Aes->Phase = MODEL_AES_IDLE;
+		break;
+	default:
+		Model.Counters.SequenceErrors++;
+		break;
+	}
+}
+
+static void Model_Transfer(XPmcDma_Channel Channel, u64 Addr, u32 Size,
+	u8 IsLast)
+{
+	u32 Sss = Model_ReadReg(XSECURE_SSS_ADDRESS);
+	u8 Data[4096U];
+	u8 *Src;
+	u32 Chunk;
+	u32 Offset;
+
+	Model_CheckAddress(Addr);
+	if (Channel == XPMCDMA_DST_CHANNEL) {
+		Model.DstPending = TRUE;
+		Model.DstAddr = Addr;
+		Model.DstLen = Size;
+		return;
+	}
+
+	Model.Counters.Transfers++;
+	Src = (u8 *)(UINTPTR)(Addr & ~(u64)XPMCDMA_ADDR_LSB_MASK);
+	if ((Sss & XSECURE_SSS_SHA_MASK) == XSECURE_SSS_SHA_DMA0_VAL) {
+		if (Model.EndianType[XPMCDMA_SRC_CHANNEL] != 0U) {
+			Model.Counters.SwapErrors++;
+		}
+		Model_Sha3Absorb(&Model.Sha3, Src, Size);
+		if ((IsLast == TRUE) && (Model.Sha3.Pos != 0U)) {
+			Model.Counters.SequenceErrors++;
+		}
+	}
+	else if ((Sss & XSECURE_SSS_AES_MASK) == XSECURE_SSS_AES_DMA0_VAL) {
+		/* The stand-in works on chunks, the last flag ends the data */
+		Offset = 0U;
+		do {
+			Chunk = Size - Offset;
+			if (Chunk > sizeof(Data)) {
+				Chunk = sizeof(Data);
+			}
+			memcpy(Data, &Src[Offset], Chunk);
+			Model_AesTransfer(Data, Chunk,
+				((Offset + Chunk) == Size) ? IsLast : FALSE);
+			Offset += Chunk;
+		} while (Offset < Size);
+	}
+	else {
+		Model.Counters.SequenceErrors++;
+	}
+}
+
+void XCsuDma_Transfer(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+	u64 Addr, u32 Size, u8 EnDataLast)
+{
+	(void)InstancePtr;
+	Model_Transfer(Channel, Addr, Size * XSECURE_WORD_SIZE, EnDataLast);
+}
+
+void XCsuDma_64BitTransfer(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+	u32 AddrLow, u32 AddrHigh, u32 Size, u8 EnDataLast)
+{
+	(void)InstancePtr;
+	Model_Transfer(Channel, ((u64)AddrHigh << 32U) | AddrLow,
+		Size * XSECURE_WORD_SIZE, EnDataLast);
+}
+
+u32 XCsuDma_WaitForDoneTimeout(XCsuDma *InstancePtr, XCsuDma_Channel Channel)
+{
+	u8 Tag[XSECURE_MODEL_AES_TAG_LEN];
+	u8 *Out;
+
+	(void)InstancePtr;
+	/* A destination transfer without source data reads the tag */
+	if ((Channel == XPMCDMA_DST_CHANNEL) && (Model.DstPending == TRUE)) {
+		if ((Model.Aes.Phase != MODEL_AES_TAG) ||
+			(Model.DstLen != sizeof(Tag))) {
+			Model.Counters.SequenceErrors++;
+			Model.DstPending = FALSE;
+		}
+		else {
+			Model_AesTag(&Model.Aes, Tag);
+			Model_SwapWords(Tag, sizeof(Tag));
+			Out = Model_DstPtr(sizeof(Tag));
+			memcpy(Out, Tag, sizeof(Tag));
+			Model.Aes.Phase = MODEL_AES_IDLE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+void XCsuDma_IntrClear(XCsuDma *InstancePtr, XCsuDma_Channel Channel, u32 Mask)
+{
+	(void)InstancePtr;
+	(void)Channel;
+	(void)Mask;
+}
+
+void XCsuDma_GetConfig(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+	XCsuDma_Configure *ConfigurValues)
+{
+	(void)InstancePtr;
+	memset(ConfigurValues, 0, sizeof(*ConfigurValues));
+	ConfigurValues->EndianType = Model.EndianType[Channel];
+}
+
+void XCsuDma_SetConfig(XCsuDma *InstancePtr, XCsuDma_Channel Channel,
+	XCsuDma_Configure *ConfigurValues)
+{
+	(void)InstancePtr;
+	Model.EndianType[Channel] = ConfigurValues->EndianType;
+}
+
+/*****************************************************************************/
+/**
+*
+* Register accesses. The engine and SSS registers are simulated, the other
+* addresses are host memory.
+*
+******************************************************************************/
+u32 Xil_In32(UINTPTR Addr)
+{
+	u32 Index;
+	u32 Value;
+
+	if (Model_IsRegister(Addr) == FALSE) {
+		return *(volatile u32 *)Addr;
+	}
+
+	if (Addr == (XSECURE_SHA3_BASE + XSECURE_SHA3_DONE_OFFSET)) {
+		Value = XSECURE_SHA3_DONE_DONE;
+	}
+	else if ((Addr >= (XSECURE_SHA3_BASE + XSECURE_SHA3_DIGEST_0_OFFSET)) &&
+		(Addr < (XSECURE_SHA3_BASE + XSECURE_SHA3_DIGEST_0_OFFSET +
+		XSECURE_MODEL_SHA3_HASH_LEN))) {
+		/* The driver reads the digest from the last word */
+		Index = XSECURE_MODEL_SHA3_HASH_LEN - XSECURE_WORD_SIZE -
+			((u32)Addr - XSECURE_SHA3_BASE -
+			XSECURE_SHA3_DIGEST_0_OFFSET);
+		Value = (u32)Model_Sha3Byte(&Model.Sha3, Index) |
+			((u32)Model_Sha3Byte(&Model.Sha3, Index + 1U) << 8U) |
+			((u32)Model_Sha3Byte(&Model.Sha3, Index + 2U) << 16U) |
+			((u32)Model_Sha3Byte(&Model.Sha3, Index + 3U) << 24U);
+	}
+	else if (Addr == (XSECURE_AES_BASEADDR + XSECURE_AES_STATUS_OFFSET)) {
+		Value = XSECURE_AES_STATUS_DONE_MASK |
+			XSECURE_AES_STATUS_KEY_INIT_DONE_MASK;
+		if (Model.Aes.TagPass == TRUE) {
+			Value |= XSECURE_AES_STATUS_GCM_TAG_PASS_MASK;
+		}
+	}
+	else if (Addr == (XSECURE_AES_BASEADDR +
+		XSECURE_AES_KEY_ZEROED_STATUS_OFFSET)) {
+		Value = 0xFFFFFFFFU;
+	}
+	else {
+		Value = Model_ReadReg((u32)Addr);
+	}
+
+	return Value;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	u32 *Reg;
+
+	if (Model_IsRegister(Addr) == FALSE) {
+		*(volatile u32 *)Addr = Value;
+		return;
+	}
+
+	if ((Addr == (XSECURE_SHA3_BASE + XSECURE_SHA3_START_OFFSET)) &&
+		(Value == XSECURE_SHA3_START_START)) {
+		memset(&Model.Sha3, 0, sizeof(Model.Sha3));
+	}
+	else if ((Addr == (XSECURE_AES_BASEADDR +
+		XSECURE_AES_START_MSG_OFFSET)) &&
+		(Value == XSECURE_AES_START_MSG_VAL_MASK)) {
+		Model.Aes.Phase = MODEL_AES_IV;
+		Model.Aes.TagPass = FALSE;
+	}
+
+	Reg = Model_Reg((u32)Addr);
+	if (Reg != NULL) {
+		*Reg = Value;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function resets the model and fills the PMC DMA instance.
+*
+* @param	DmaPtr is the PMC DMA instance given to the drivers.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_Init(XPmcDma *DmaPtr)
+{
+	memset(&Model, 0, sizeof(Model));
+	memset(DmaPtr, 0, sizeof(*DmaPtr));
+	DmaPtr->Config.DeviceId = PMCDMA_0_DEVICE_ID;
+	DmaPtr->Config.DmaType = XPMCDMA_DMATYPEIS_DMA0;
+	DmaPtr->IsReady = XIL_COMPONENT_IS_READY;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the counters of the model.
+*
+* @param	Counters is filled with the counters.
+*
+* @return	None.
+*
+******************************************************************************/
+void XSecureModel_GetCounters(XSecureModel_Counters *Counters)
+{
+	*Counters = Model.Counters;
+}
+
+/*****************************************************************************/
+/**
+*
+* BSP functions used by the drivers.
+*
+******************************************************************************/
+u32 Xil_WaitForEvent(u32 RegAddr, u32 EventMask, u32 Event, u32 Timeout)
+{
+	u32 Count;
+
+	for (Count = 0U; Count <= Timeout; Count++) {
+		if ((Xil_In32(RegAddr) & EventMask) == Event) {
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+int Xil_SecureZeroize(u8 *DataPtr, const u32 Length)
+{
+	memset(DataPtr, 0, Length);
+
+	return XST_SUCCESS;
+}
+
+int Xil_SMemSet(void *Dest, const u32 DestSize, const u8 Data, const u32 Len)
+{
+	if ((Dest == NULL) || (Len > DestSize)) {
+		return XST_INVALID_PARAM;
+	}
+	memset(Dest, Data, Len);
+
+	return XST_SUCCESS;
+}
+
+void Xil_Assert(const char8 *File, s32 Line)
+{
+	printf("Assert in %s line %d\r\n", File, (int)Line);
+	Xil_AssertStatus = XIL_ASSERT_OCCURRED;
+}
+
+void xil_printf(const char8 *Ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, Ctrl1);
+	(void)vprintf(Ctrl1, Args);
+	va_end(Args);
+}
+
+void usleep(ULONG useconds)
+{
+	struct timespec Delay;
+
+	Delay.tv_sec = (time_t)(useconds / 1000000UL);
+	Delay.tv_nsec = (long)((useconds % 1000000UL) * 1000UL);
+	(void)nanosleep(&Delay, NULL);
+}
+
+void Xil_DCacheFlushRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	(void)Len;
+}
+
+void Xil_DCacheInvalidateRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	(void)Len;
+}
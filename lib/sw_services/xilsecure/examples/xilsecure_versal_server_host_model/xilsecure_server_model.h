@@ -0,0 +1,54 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilsecure_server_model.h
+*
+* This file contains the interface of the host model of the PMC DMA and of
+* the SHA3 and AES engines used by the server tests.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+#ifndef XILSECURE_SERVER_MODEL_H_
+#define XILSECURE_SERVER_MODEL_H_
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xpmcdma.h"
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_MODEL_SHA3_HASH_LEN	(48U)	/**< SHA3-384 hash length */
+#define XSECURE_MODEL_AES_IV_LEN	(16U)	/**< IV length on the DMA */
+#define XSECURE_MODEL_AES_TAG_LEN	(16U)	/**< Stand-in tag length */
+
+/**************************** Type Definitions *******************************/
+/**
+ * Counters of the model, reset by XSecureModel_Init
+ */
+typedef struct {
+	u32 Transfers;		/**< Source DMA transfers */
+	u32 Unaligned;		/**< Transfers from or to unaligned addresses */
+	u32 SwapErrors;		/**< AES transfers without the DMA byte swap, or
+				  *  SHA3 transfers with it */
+	u32 SequenceErrors;	/**< Data out of the engine sequence */
+} XSecureModel_Counters;
+
+/************************** Function Prototypes ******************************/
+void XSecureModel_Init(XPmcDma *DmaPtr);
+void XSecureModel_GetCounters(XSecureModel_Counters *Counters);
+void XSecureModel_Sha3Digest(const u8 *Data, u32 Size, u8 *Hash);
+void XSecureModel_AesCrypt(const u8 *Iv, const u8 *In, u8 *Out, u32 Size,
+	u8 IsEncrypt, u8 *Tag);
+
+#endif /* XILSECURE_SERVER_MODEL_H_ */
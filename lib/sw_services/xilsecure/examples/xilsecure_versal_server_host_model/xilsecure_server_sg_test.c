@@ -0,0 +1,357 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilsecure_server_sg_test.c
+*
+* This file contains the test of the scatter-gather updates of the Versal
+* SHA3 and AES server drivers, with the host model of the PMC DMA and of the
+* engines.
+*
+* - XSecure_Sha3Kat passes on the model.
+* - Random lists of contiguous and scattered segments, at unaligned
+*   addresses and of unaligned sizes, are hashed with XSecure_Sha3UpdateSg
+*   and with XSecure_Sha3Update64Bit for each segment. Both hashes are
+*   compared with the hash of the model, and no DMA transfer uses an
+*   unaligned address.
+* - Random lists of segments are encrypted with XSecure_AesEncryptUpdateSg
+*   and with XSecure_AesEncryptUpdate for each segment. The data and tags
+*   are compared with the model, the data is decrypted back with
+*   XSecure_AesDecryptUpdateSg, and a wrong tag fails the decrypt final.
+* - The number of DMA transfers of both paths is printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.7   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xpmcdma.h"
+#include "xsecure_sha.h"
+#include "xsecure_aes.h"
+#include "xsecure_utils.h"
+#include "xilsecure_server_model.h"
+
+/************************** Constant Definitions *****************************/
+#define BUF_LEN			(64U * 1024U)
+#define MAX_SEGMENTS		(12U)
+#define MAX_SEGMENT_LEN		(3000U)
+#define SEGMENT_SLOT_LEN	(BUF_LEN / MAX_SEGMENTS)
+#define NUM_SHA3_TRIALS		(60U)
+#define NUM_AES_TRIALS		(40U)
+#define AES_KEY_LEN		(32U)
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define CHECK(Cond) \
+	if (!(Cond)) { \
+		printf("%s line %d: %s\r\n", __func__, __LINE__, #Cond); \
+		return XST_FAILURE; \
+	}
+
+#define ADDR(Ptr)	((u64)(UINTPTR)(Ptr))
+
+/************************** Variable Definitions *****************************/
+static XPmcDma PmcDma;
+static XSecure_Sha3 Sha3;
+static XSecure_Aes Aes;
+static u8 Src[BUF_LEN];
+static u8 Dst[BUF_LEN];
+static u8 Msg[MAX_SEGMENTS * MAX_SEGMENT_LEN];
+static u8 Ref[MAX_SEGMENTS * MAX_SEGMENT_LEN];
+static u8 Out[MAX_SEGMENTS * MAX_SEGMENT_LEN];
+static u32 Iv[XSECURE_MODEL_AES_IV_LEN / sizeof(u32)];
+static u32 Key[AES_KEY_LEN / sizeof(u32)];
+static u32 Tag[XSECURE_MODEL_AES_TAG_LEN / sizeof(u32)];
+static u32 SgTransfers;
+static u32 SegmentTransfers;
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of source DMA transfers since the last
+* call.
+*
+******************************************************************************/
+static u32 Transfers(void)
+{
+	static u32 Last;
+	XSecureModel_Counters Counters;
+	u32 Count;
+
+	XSecureModel_GetCounters(&Counters);
+	Count = Counters.Transfers - Last;
+	Last = Counters.Transfers;
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a random list of segments of Src. The segments follow
+* each other if Contiguous is TRUE, and are apart from each other otherwise.
+* They never overlap. The sizes are multiples of Align and the offsets are
+* aligned to Align.
+*
+* @return	Total size of the segments.
+*
+******************************************************************************/
+static u32 RandomSegments(u32 *Offset, u32 *Size, u32 Count, u8 Contiguous,
+	u32 Align)
+{
+	u32 Index;
+	u32 Total = 0U;
+	u32 Next = Align * ((u32)rand() % 64U);
+
+	for (Index = 0U; Index < Count; Index++) {
+		Size[Index] = Align * (1U + ((u32)rand() %
+			(MAX_SEGMENT_LEN / Align)));
+		if (Contiguous == TRUE) {
+			Offset[Index] = Next;
+		}
+		else {
+			Offset[Index] = Align * (((Index * SEGMENT_SLOT_LEN) +
+				1U + ((u32)rand() % (SEGMENT_SLOT_LEN -
+				MAX_SEGMENT_LEN - 4U))) / Align);
+		}
+		Next = Offset[Index] + Size[Index];
+		memcpy(&Msg[Total], &Src[Offset[Index]], Size[Index]);
+		Total += Size[Index];
+	}
+
+	return Total;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the SHA3 KAT on the model.
+*
+******************************************************************************/
+static int TestSha3Kat(void)
+{
+	CHECK(XSecure_Sha3Initialize(&Sha3, &PmcDma) == XST_SUCCESS);
+	CHECK(XSecure_Sha3Kat(&Sha3) == XST_SUCCESS);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function hashes random lists of segments with and without the
+* scatter-gather update.
+*
+******************************************************************************/
+static int TestSha3Sg(void)
+{
+	XSecure_Sha3SgEntry SgList[MAX_SEGMENTS];
+	XSecure_Sha3Hash SgHash;
+	XSecure_Sha3Hash SegmentHash;
+	XSecureModel_Counters Counters;
+	u8 RefHash[XSECURE_MODEL_SHA3_HASH_LEN];
+	u32 Offset[MAX_SEGMENTS];
+	u32 Size[MAX_SEGMENTS];
+	u32 Trial;
+	u32 Count;
+	u32 Total;
+	u32 Index;
+	u8 Contiguous;
+
+	for (Trial = 0U; Trial < NUM_SHA3_TRIALS; Trial++) {
+		Count = 1U + ((u32)rand() % MAX_SEGMENTS);
+		Contiguous = ((Trial % 2U) == 0U) ? TRUE : FALSE;
+		/* Odd sizes and offsets, then whole words from a word */
+		Total = RandomSegments(Offset, Size, Count, Contiguous,
+			((Trial % 4U) < 2U) ? 1U : 4U);
+		XSecureModel_Sha3Digest(Msg, Total, RefHash);
+
+		for (Index = 0U; Index < Count; Index++) {
+			SgList[Index].DataAddr = ADDR(&Src[Offset[Index]]);
+			SgList[Index].Size = Size[Index];
+		}
+		(void)Transfers();
+		CHECK(XSecure_Sha3Start(&Sha3) == XST_SUCCESS);
+		CHECK(XSecure_Sha3UpdateSg(&Sha3, SgList, Count) == XST_SUCCESS);
+		CHECK(XSecure_Sha3Finish(&Sha3, &SgHash) == XST_SUCCESS);
+		SgTransfers += Transfers();
+
+		CHECK(XSecure_Sha3Start(&Sha3) == XST_SUCCESS);
+		for (Index = 0U; Index < Count; Index++) {
+			CHECK(XSecure_Sha3Update64Bit(&Sha3,
+				ADDR(&Src[Offset[Index]]), Size[Index]) ==
+				XST_SUCCESS);
+		}
+		CHECK(XSecure_Sha3Finish(&Sha3, &SegmentHash) == XST_SUCCESS);
+		SegmentTransfers += Transfers();
+
+		CHECK(memcmp(SgHash.Hash, RefHash, sizeof(RefHash)) == 0);
+		CHECK(memcmp(SegmentHash.Hash, RefHash, sizeof(RefHash)) == 0);
+	}
+
+	XSecureModel_GetCounters(&Counters);
+	CHECK(Counters.Unaligned == 0U);
+	CHECK(Counters.SwapErrors == 0U);
+	CHECK(Counters.SequenceErrors == 0U);
+	printf("SHA3: %u DMA transfers with XSecure_Sha3UpdateSg, %u with "
+		"XSecure_Sha3Update64Bit\r\n", (unsigned)SgTransfers,
+		(unsigned)SegmentTransfers);
+	CHECK(SgTransfers < SegmentTransfers);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts random lists of segments with and without the
+* scatter-gather update, and decrypts them back.
+*
+******************************************************************************/
+static int TestAesSg(void)
+{
+	XSecure_AesSgEntry SgList[MAX_SEGMENTS];
+	XSecureModel_Counters Counters;
+	u8 RefTag[XSECURE_MODEL_AES_TAG_LEN];
+	u32 Offset[MAX_SEGMENTS];
+	u32 Size[MAX_SEGMENTS];
+	u32 Trial;
+	u32 Count;
+	u32 Total;
+	u32 Pos;
+	u32 Index;
+
+	SgTransfers = 0U;
+	SegmentTransfers = 0U;
+	CHECK(XSecure_AesInitialize(&Aes, &PmcDma) == XST_SUCCESS);
+	CHECK(XSecure_AesWriteKey(&Aes, XSECURE_AES_USER_KEY_0,
+		XSECURE_AES_KEY_SIZE_256, ADDR(Key)) == XST_SUCCESS);
+
+	for (Trial = 0U; Trial < NUM_AES_TRIALS; Trial++) {
+		Count = 1U + ((u32)rand() % MAX_SEGMENTS);
+		Total = RandomSegments(Offset, Size, Count,
+			((Trial % 4U) != 3U) ? TRUE : FALSE, XSECURE_WORD_SIZE);
+		Iv[0U] = (u32)rand();
+		XSecureModel_AesCrypt((const u8 *)Iv, Msg, Ref, Total, TRUE, RefTag);
+
+		/* Scatter-gather encryption */
+		for (Index = 0U; Index < Count; Index++) {
+			SgList[Index].InDataAddr = ADDR(&Src[Offset[Index]]);
+			SgList[Index].OutDataAddr = ADDR(&Dst[Offset[Index]]);
+			SgList[Index].Size = Size[Index];
+		}
+		(void)Transfers();
+		CHECK(XSecure_AesEncryptInit(&Aes, XSECURE_AES_USER_KEY_0,
+			XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+		CHECK(XSecure_AesEncryptUpdateSg(&Aes, SgList, Count, TRUE) ==
+			XST_SUCCESS);
+		CHECK(XSecure_AesEncryptFinal(&Aes, ADDR(Tag)) == XST_SUCCESS);
+		SgTransfers += Transfers();
+		CHECK(memcmp(Tag, RefTag, sizeof(RefTag)) == 0);
+		for (Index = 0U, Pos = 0U; Index < Count; Index++) {
+			memcpy(&Out[Pos], &Dst[Offset[Index]], Size[Index]);
+			Pos += Size[Index];
+		}
+		CHECK(memcmp(Out, Ref, Total) == 0);
+
+		/* Same encryption one segment at a time */
+		memset(Dst, 0, sizeof(Dst));
+		CHECK(XSecure_AesEncryptInit(&Aes, XSECURE_AES_USER_KEY_0,
+			XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+		for (Index = 0U; Index < Count; Index++) {
+			CHECK(XSecure_AesEncryptUpdate(&Aes,
+				ADDR(&Src[Offset[Index]]), ADDR(&Dst[Offset[Index]]),
+				Size[Index], (Index == (Count - 1U)) ? TRUE : FALSE) ==
+				XST_SUCCESS);
+		}
+		CHECK(XSecure_AesEncryptFinal(&Aes, ADDR(Tag)) == XST_SUCCESS);
+		SegmentTransfers += Transfers();
+		CHECK(memcmp(Tag, RefTag, sizeof(RefTag)) == 0);
+		for (Index = 0U, Pos = 0U; Index < Count; Index++) {
+			CHECK(memcmp(&Dst[Offset[Index]], &Ref[Pos], Size[Index]) == 0);
+			Pos += Size[Index];
+		}
+
+		/* Decrypt the ciphertext in Dst back into Src */
+		for (Index = 0U; Index < Count; Index++) {
+			SgList[Index].InDataAddr = ADDR(&Dst[Offset[Index]]);
+			SgList[Index].OutDataAddr = ADDR(&Src[Offset[Index]]);
+		}
+		CHECK(XSecure_AesDecryptInit(&Aes, XSECURE_AES_USER_KEY_0,
+			XSECURE_AES_KEY_SIZE_256, ADDR(Iv)) == XST_SUCCESS);
+		CHECK(XSecure_AesDecryptUpdateSg(&Aes, SgList, Count, TRUE) ==
+			XST_SUCCESS);
+		if ((Trial % 8U) == 7U) {
+			Tag[0U] ^= 1U;
+			CHECK(XSecure_AesDecryptFinal(&Aes, ADDR(Tag)) != XST_SUCCESS);
+		}
+		else {
+			CHECK(XSecure_AesDecryptFinal(&Aes, ADDR(Tag)) == XST_SUCCESS);
+		}
+		for (Index = 0U, Pos = 0U; Index < Count; Index++) {
+			CHECK(memcmp(&Src[Offset[Index]], &Msg[Pos], Size[Index]) == 0);
+			Pos += Size[Index];
+		}
+		(void)Transfers();
+	}
+
+	XSecureModel_GetCounters(&Counters);
+	CHECK(Counters.Unaligned == 0U);
+	CHECK(Counters.SwapErrors == 0U);
+	CHECK(Counters.SequenceErrors == 0U);
+	printf("AES: %u DMA transfers with XSecure_AesEncryptUpdateSg, %u with "
+		"XSecure_AesEncryptUpdate\r\n", (unsigned)SgTransfers,
+		(unsigned)SegmentTransfers);
+	CHECK(SgTransfers < SegmentTransfers);
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	int Status = XST_FAILURE;
+	u32 Index;
+
+	srand(1U);
+	for (Index = 0U; Index < BUF_LEN; Index++) {
+		Src[Index] = (u8)rand();
+	}
+	for (Index = 0U; Index < (AES_KEY_LEN / sizeof(u32)); Index++) {
+		Key[Index] = (u32)rand();
+	}
+	for (Index = 0U; Index < (XSECURE_MODEL_AES_IV_LEN / sizeof(u32));
+		Index++) {
+		Iv[Index] = (u32)rand();
+	}
+	XSecureModel_Init(&PmcDma);
+
+	Status = TestSha3Kat();
+	if (Status == XST_SUCCESS) {
+		Status = TestSha3Sg();
+	}
+	if (Status == XST_SUCCESS) {
+		Status = TestAesSg();
+	}
+
+	if (Status != XST_SUCCESS) {
+		printf("Server SG test failed\r\n");
+		return 1;
+	}
+
+	printf("Successfully ran server SG test\r\n");
+	return 0;
+}
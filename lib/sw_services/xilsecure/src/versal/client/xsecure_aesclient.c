@@ -27,6 +27,7 @@
 *                     user
 *       am   03/08/22 Fixed MISRA C violations
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+*       ag   10/19/26 Added asynchronous AES update and final APIs
 *
 * </pre>
 * @note
@@ -43,6 +44,11 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static int XSecure_AesUpdateAsync(XSecure_ClientInstance *InstancePtr, u32 ApiId,
+	u64 InDataAddr, u64 OutDataAddr, u32 Size, u32 IsLast,
+	XSecure_ClientCallback Callback, void *CallbackRef);
+static int XSecure_AesFinalAsync(XSecure_ClientInstance *InstancePtr, u32 ApiId,
+	u64 GcmTagAddr, XSecure_ClientCallback Callback, void *CallbackRef);
 
 /************************** Variable Definitions *****************************/
 
@@ -737,3 +743,210 @@ int XSecure_AesDecryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySo
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an IPI request to encrypt a chunk of data
+ *		and returns without waiting for the server. Several chunks can
+ *		be queued; they are processed in order.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	InDataAddr	Address of the input data which needs to be
+ * 				encrypted
+ * @param	OutDataAddr	Address of the buffer where the encrypted data
+ * 				to be updated
+ * @param	Size		Size of the input data to be encrypted
+ * @param	IsLast		If this is the last update of data to be
+ * 				encrypted, this parameter should be set to TRUE
+ * 				otherwise FALSE
+ * @param	Callback	Function called when the chunk is encrypted
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the request is queued
+ *	-	XST_FAILURE - On failure or if the queue is full
+ *
+ * @note	The request queue must be set with XSecure_ClientAsyncInit.
+ *		The data buffers must remain valid until the request completes.
+ *
+ *****************************************************************************/
+int XSecure_AesEncryptUpdateAsync(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_ClientCallback Callback,
+	void *CallbackRef)
+{
+	return XSecure_AesUpdateAsync(InstancePtr, XSECURE_API_AES_ENCRYPT_UPDATE,
+		InDataAddr, OutDataAddr, Size, IsLast, Callback, CallbackRef);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an IPI request to decrypt a chunk of data
+ *		and returns without waiting for the server. Several chunks can
+ *		be queued; they are processed in order.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	InDataAddr	Address of the input data which needs to be
+ * 				decrypted
+ * @param	OutDataAddr	Address of the buffer where the decrypted data
+ * 				to be updated
+ * @param	Size		Size of the input data to be decrypted
+ * @param	IsLast		If this is the last update of data to be
+ * 				decrypted, this parameter should be set to TRUE
+ * 				otherwise FALSE
+ * @param	Callback	Function called when the chunk is decrypted
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the request is queued
+ *	-	XST_FAILURE - On failure or if the queue is full
+ *
+ * @note	The request queue must be set with XSecure_ClientAsyncInit.
+ *		The data buffers must remain valid until the request completes.
+ *
+ *****************************************************************************/
+int XSecure_AesDecryptUpdateAsync(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_ClientCallback Callback,
+	void *CallbackRef)
+{
+	return XSecure_AesUpdateAsync(InstancePtr, XSECURE_API_AES_DECRYPT_UPDATE,
+		InDataAddr, OutDataAddr, Size, IsLast, Callback, CallbackRef);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an IPI request to finish the encryption
+ *		and write the GCM tag, and returns without waiting for the server
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	GcmTagAddr	Address to the buffer of GCM tag size,
+ * 				where the server writes the GCM tag
+ * @param	Callback	Function called when the GCM tag is available
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the request is queued
+ *	-	XST_FAILURE - On failure or if the queue is full
+ *
+ *****************************************************************************/
+int XSecure_AesEncryptFinalAsync(XSecure_ClientInstance *InstancePtr, u64 GcmTagAddr,
+	XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	return XSecure_AesFinalAsync(InstancePtr, XSECURE_API_AES_ENCRYPT_FINAL,
+		GcmTagAddr, Callback, CallbackRef);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an IPI request to finish the decryption
+ *		and verify the GCM tag, and returns without waiting for the server
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	GcmTagAddr	Address of the GCM tag to be verified
+ * @param	Callback	Function called with the verification status
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the request is queued
+ *	-	XST_FAILURE - On failure or if the queue is full
+ *
+ *****************************************************************************/
+int XSecure_AesDecryptFinalAsync(XSecure_ClientInstance *InstancePtr, u64 GcmTagAddr,
+	XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	return XSecure_AesFinalAsync(InstancePtr, XSECURE_API_AES_DECRYPT_FINAL,
+		GcmTagAddr, Callback, CallbackRef);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function fills a queued request for an AES update. The
+ *		input parameters are kept in the request itself, so every queued
+ *		chunk has its own copy in shared memory.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	ApiId		XSECURE_API_AES_ENCRYPT_UPDATE or
+ *				XSECURE_API_AES_DECRYPT_UPDATE
+ * @param	InDataAddr	Address of the input data
+ * @param	OutDataAddr	Address of the output data
+ * @param	Size		Size of the input data
+ * @param	IsLast		TRUE for the last update
+ * @param	Callback	Completion callback
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the request is queued
+ *	-	XST_FAILURE - On failure or if the queue is full
+ *
+ *****************************************************************************/
+static int XSecure_AesUpdateAsync(XSecure_ClientInstance *InstancePtr, u32 ApiId,
+	u64 InDataAddr, u64 OutDataAddr, u32 Size, u32 IsLast,
+	XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_ClientRequest *RequestPtr;
+	XSecure_AesInParams *InParams;
+	u64 SrcAddr;
+
+	RequestPtr = XSecure_ClientGetRequest(InstancePtr);
+	if ((RequestPtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	InParams = (XSecure_AesInParams *)(UINTPTR)RequestPtr->Params;
+	InParams->InDataAddr = InDataAddr;
+	InParams->Size = Size;
+	InParams->IsLast = IsLast;
+	SrcAddr = (u64)(UINTPTR)InParams;
+
+	/* Fill IPI Payload */
+	RequestPtr->Payload[0U] = HEADER(0U, ApiId);
+	RequestPtr->Payload[1U] = (u32)SrcAddr;
+	RequestPtr->Payload[2U] = (u32)(SrcAddr >> 32U);
+	RequestPtr->Payload[3U] = (u32)(OutDataAddr);
+	RequestPtr->Payload[4U] = (u32)(OutDataAddr >> 32U);
+	RequestPtr->PayloadLen = XSECURE_PAYLOAD_LEN_5U;
+
+	Status = XSecure_ClientQueueRequest(InstancePtr, Callback, CallbackRef);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function fills a queued request for an AES final
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	ApiId		XSECURE_API_AES_ENCRYPT_FINAL or
+ *				XSECURE_API_AES_DECRYPT_FINAL
+ * @param	GcmTagAddr	Address of the GCM tag
+ * @param	Callback	Completion callback
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the request is queued
+ *	-	XST_FAILURE - On failure or if the queue is full
+ *
+ *****************************************************************************/
+static int XSecure_AesFinalAsync(XSecure_ClientInstance *InstancePtr, u32 ApiId,
+	u64 GcmTagAddr, XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_ClientRequest *RequestPtr;
+
+	RequestPtr = XSecure_ClientGetRequest(InstancePtr);
+	if ((RequestPtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	/* Fill IPI Payload */
+	RequestPtr->Payload[0U] = HEADER(0U, ApiId);
+	RequestPtr->Payload[1U] = (u32)GcmTagAddr;
+	RequestPtr->Payload[2U] = (u32)(GcmTagAddr >> 32U);
+	RequestPtr->PayloadLen = XSECURE_PAYLOAD_LEN_3U;
+
+	Status = XSecure_ClientQueueRequest(InstancePtr, Callback, CallbackRef);
+
+END:
+	return Status;
+}
@@ -21,6 +21,7 @@
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 *       har  04/14/21 Added XSecure_AesEncryptData and XSecure_AesDecryptData
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+*       ag   10/19/26 Added asynchronous AES update and final APIs
 *
 * </pre>
 * @note
@@ -99,6 +100,16 @@ int XSecure_AesEncryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySo
 	u64 InDataAddr, u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
 int XSecure_AesDecryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySource KeySrc, u32 KeySize, u64 IvAddr,
 	u64 InDataAddr, u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
+int XSecure_AesEncryptUpdateAsync(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_ClientCallback Callback,
+	void *CallbackRef);
+int XSecure_AesDecryptUpdateAsync(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u32 Size, u32 IsLast, XSecure_ClientCallback Callback,
+	void *CallbackRef);
+int XSecure_AesEncryptFinalAsync(XSecure_ClientInstance *InstancePtr, u64 GcmTagAddr,
+	XSecure_ClientCallback Callback, void *CallbackRef);
+int XSecure_AesDecryptFinalAsync(XSecure_ClientInstance *InstancePtr, u64 GcmTagAddr,
+	XSecure_ClientCallback Callback, void *CallbackRef);
 
 #ifdef __cplusplus
 }
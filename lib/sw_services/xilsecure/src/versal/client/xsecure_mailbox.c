@@ -27,6 +27,9 @@
 * 4.7   kpt  01/13/21 Added API's to set and get the shared memory
 *       am   03/08/22 Fixed MISRA C violations
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+*       ag   10/19/26 Added asynchronous request queue
+*       ag   10/19/26 Reported send failures through the callback only and
+*                     polled the acknowledgement with XMailbox_IsDone
 *
 * </pre>
 *
@@ -37,6 +40,7 @@
 /***************************** Include Files *********************************/
 #include "xil_types.h"
 #include "xsecure_mailbox.h"
+#include "xsecure_defs.h"
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -46,6 +50,11 @@
 
 /************************** Variable Definitions *****************************/
 
+/************************** Function Prototypes ******************************/
+static void XSecure_ClientSendRequest(XSecure_ClientInstance *InstancePtr);
+static void XSecure_ClientCompleteRequest(XSecure_ClientInstance *InstancePtr,
+	int Status);
+
 /************************** Function Definitions *****************************/
 
 /****************************************************************************/
@@ -105,8 +114,303 @@ int XSecure_ClientInit(XSecure_ClientInstance* const InstancePtr, XMailbox* cons
 
 	if (InstancePtr != NULL) {
 			InstancePtr->MailboxPtr = MailboxPtr;
+			InstancePtr->Queue.RequestPtr = NULL;
+			InstancePtr->Queue.Size = 0U;
+			InstancePtr->Queue.Head = 0U;
+			InstancePtr->Queue.Tail = 0U;
+			InstancePtr->Queue.Count = 0U;
+			InstancePtr->Queue.InFlight = FALSE;
+			InstancePtr->Queue.Status = XST_SUCCESS;
 			Status = XST_SUCCESS;
 	}
 
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+*
+* This function sets the request ring used by the asynchronous client APIs.
+* Requests are sent to the server one at a time in queue order. Sending the
+* next request does not wait for the caller, so the server stays busy while
+* the caller prepares further requests.
+*
+* The synchronous client APIs share the IPI buffers with the queue. They must
+* not be called while requests are pending, that is before
+* XSecure_ClientWait has returned or XSecure_ClientPoll has returned 0.
+*
+* @param InstancePtr Pointer to the client instance
+* @param RequestPtr Pointer to an array of requests in memory accessible to
+*		the PMC
+* @param Size Number of requests in the array
+*
+* @return
+* 	- XST_SUCCESS	On successful initialization
+* 	- XST_FAILURE	On invalid parameters or if requests are pending
+*
+******************************************************************************/
+int XSecure_ClientAsyncInit(XSecure_ClientInstance *InstancePtr,
+	XSecure_ClientRequest *RequestPtr, u32 Size)
+{
+	int Status = XST_FAILURE;
+
+	if ((InstancePtr == NULL) || (RequestPtr == NULL) || (Size == 0U)) {
+		goto END;
+	}
+
+	if (InstancePtr->Queue.Count != 0U) {
+		goto END;
+	}
+
+	InstancePtr->Queue.RequestPtr = RequestPtr;
+	InstancePtr->Queue.Size = Size;
+	InstancePtr->Queue.Head = 0U;
+	InstancePtr->Queue.Tail = 0U;
+	InstancePtr->Queue.InFlight = FALSE;
+	InstancePtr->Queue.Status = XST_SUCCESS;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the next free request of the queue, to be filled by
+* the caller and queued with XSecure_ClientQueueRequest.
+*
+* @param InstancePtr Pointer to the client instance
+*
+* @return
+* 	- Pointer to the free request
+* 	- NULL if the queue is not set or is full
+*
+******************************************************************************/
+XSecure_ClientRequest *XSecure_ClientGetRequest(XSecure_ClientInstance *InstancePtr)
+{
+	XSecure_ClientRequest *RequestPtr = NULL;
+
+	if ((InstancePtr == NULL) || (InstancePtr->Queue.RequestPtr == NULL)) {
+		goto END;
+	}
+
+	if (InstancePtr->Queue.Count == InstancePtr->Queue.Size) {
+		goto END;
+	}
+
+	RequestPtr = &InstancePtr->Queue.RequestPtr[InstancePtr->Queue.Head];
+	RequestPtr->ApiCallback = NULL;
+	RequestPtr->ApiCallbackRef = NULL;
+
+END:
+	return RequestPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues the request returned by XSecure_ClientGetRequest and
+* sends it right away if no other request is in flight. After a request has
+* failed, queued requests are dropped until XSecure_ClientWait is called.
+*
+* Once the request is queued, its callback is called exactly once with its
+* status. A failure to send it is reported there, and to XSecure_ClientWait,
+* not by the return value. The callback may thus be called before this
+* function returns.
+*
+* @param InstancePtr Pointer to the client instance
+* @param Callback Function called when the request completes, may be NULL
+* @param CallbackRef Reference passed to the callback
+*
+* @return
+* 	- XST_SUCCESS	If the request is queued
+* 	- XST_FAILURE	If the queue is not set or is full
+*
+******************************************************************************/
+int XSecure_ClientQueueRequest(XSecure_ClientInstance *InstancePtr,
+	XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	int Status = XST_FAILURE;
+	XSecure_ClientRequest *RequestPtr;
+
+	if ((InstancePtr == NULL) || (InstancePtr->Queue.RequestPtr == NULL)) {
+		goto END;
+	}
+
+	if (InstancePtr->Queue.Count == InstancePtr->Queue.Size) {
+		goto END;
+	}
+
+	/* The API callback set on the request by the client API is kept */
+	RequestPtr = &InstancePtr->Queue.RequestPtr[InstancePtr->Queue.Head];
+	RequestPtr->Callback = Callback;
+	RequestPtr->CallbackRef = CallbackRef;
+	XSecure_DCacheFlushRange(RequestPtr->Params, sizeof(RequestPtr->Params));
+
+	InstancePtr->Queue.Head = (InstancePtr->Queue.Head + 1U) %
+		InstancePtr->Queue.Size;
+	InstancePtr->Queue.Count++;
+
+	if (InstancePtr->Queue.InFlight == FALSE) {
+		XSecure_ClientSendRequest(InstancePtr);
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks whether the request in flight has completed. If so,
+* it reads the response, calls the completion callback and sends the next
+* queued request. Callbacks are called from the context of this function.
+*
+* @param InstancePtr Pointer to the client instance
+*
+* @return	Number of requests still pending
+*
+******************************************************************************/
+u32 XSecure_ClientPoll(XSecure_ClientInstance *InstancePtr)
+{
+	int Status = XST_FAILURE;
+	u32 Response[RESPONSE_ARG_CNT];
+	u32 Count = 0U;
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	if (InstancePtr->Queue.InFlight == TRUE) {
+		Status = (int)XMailbox_IsDone(InstancePtr->MailboxPtr,
+			XSECURE_TARGET_IPI_INT_MASK);
+		if (Status != XST_SUCCESS) {
+			goto COUNT;
+		}
+
+		Status = (int)XMailbox_Recv(InstancePtr->MailboxPtr,
+			XSECURE_TARGET_IPI_INT_MASK, Response, RESPONSE_ARG_CNT,
+			XILMBOX_MSG_TYPE_RESP);
+		if (Status == XST_SUCCESS) {
+			Status = (int)Response[0];
+		}
+
+		InstancePtr->Queue.InFlight = FALSE;
+		XSecure_ClientCompleteRequest(InstancePtr, Status);
+
+		/* The callback may already have sent a new request */
+		if ((InstancePtr->Queue.InFlight == FALSE) &&
+			(InstancePtr->Queue.Count != 0U)) {
+			XSecure_ClientSendRequest(InstancePtr);
+		}
+	}
+
+COUNT:
+	Count = InstancePtr->Queue.Count;
+END:
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function polls until all queued requests have completed.
+*
+* @param InstancePtr Pointer to the client instance
+*
+* @return
+* 	- XST_SUCCESS	If all requests since the last wait succeeded
+* 	- Status of the first failed request otherwise
+*
+******************************************************************************/
+int XSecure_ClientWait(XSecure_ClientInstance *InstancePtr)
+{
+	int Status = XST_FAILURE;
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	while (XSecure_ClientPoll(InstancePtr) != 0U) {
+		;
+	}
+
+	Status = InstancePtr->Queue.Status;
+	InstancePtr->Queue.Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends the oldest queued request without waiting for the
+* server. If a request fails, it and all queued requests behind it are
+* completed with the failure status, as they belong to the same operation.
+*
+* @param InstancePtr Pointer to the client instance
+*
+******************************************************************************/
+static void XSecure_ClientSendRequest(XSecure_ClientInstance *InstancePtr)
+{
+	int Status = InstancePtr->Queue.Status;
+	XSecure_ClientRequest *RequestPtr;
+
+	if (Status == XST_SUCCESS) {
+		RequestPtr = &InstancePtr->Queue.RequestPtr[InstancePtr->Queue.Tail];
+		Status = (int)XMailbox_SendData(InstancePtr->MailboxPtr,
+			XSECURE_TARGET_IPI_INT_MASK, RequestPtr->Payload,
+			RequestPtr->PayloadLen, XILMBOX_MSG_TYPE_REQ, FALSE);
+		if (Status == XST_SUCCESS) {
+			InstancePtr->Queue.InFlight = TRUE;
+		}
+	}
+
+	if (Status != XST_SUCCESS) {
+		while (InstancePtr->Queue.Count != 0U) {
+			XSecure_ClientCompleteRequest(InstancePtr, Status);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the oldest request from the queue and calls the
+* completion callback of the client API, then the one of the caller.
+*
+* @param InstancePtr Pointer to the client instance
+* @param Status Completion status of the request
+*
+******************************************************************************/
+static void XSecure_ClientCompleteRequest(XSecure_ClientInstance *InstancePtr,
+	int Status)
+{
+	XSecure_ClientRequest *RequestPtr =
+		&InstancePtr->Queue.RequestPtr[InstancePtr->Queue.Tail];
+	XSecure_ClientCallback ApiCallback = RequestPtr->ApiCallback;
+	void *ApiCallbackRef = RequestPtr->ApiCallbackRef;
+	XSecure_ClientCallback Callback = RequestPtr->Callback;
+	void *CallbackRef = RequestPtr->CallbackRef;
+
+	/* The request is free once removed, the callbacks may reuse it */
+	InstancePtr->Queue.Tail = (InstancePtr->Queue.Tail + 1U) %
+		InstancePtr->Queue.Size;
+	InstancePtr->Queue.Count--;
+
+	if ((Status != XST_SUCCESS) &&
+		(InstancePtr->Queue.Status == XST_SUCCESS)) {
+		InstancePtr->Queue.Status = Status;
+	}
+
+	if (ApiCallback != NULL) {
+		ApiCallback(ApiCallbackRef, Status);
+	}
+
+	if (Callback != NULL) {
+		Callback(CallbackRef, Status);
+	}
+}
@@ -24,6 +24,7 @@
 * 4.7   kpt  01/13/22 Added macro XSECURE_SHARED_MEM_SIZE
 *       am   03/08/22 Fixed MISRA C violations
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+*       ag   10/19/26 Added asynchronous request queue
 *
 * </pre>
 * @note
@@ -72,9 +73,54 @@ extern "C" {
 #define XSECURE_PAYLOAD_LEN_6U		(6U)
 #define XSECURE_PAYLOAD_LEN_7U		(7U)
 
+#define XSECURE_ASYNC_PARAMS_LEN	(2U)
+	/**< Number of 64-bit words of CDO parameters held by a request */
+
 /**************************** Type Definitions *******************************/
+/**
+ * Completion callback of an asynchronous request. Status is the response
+ * status of the server, the status of sending the request, or the status of
+ * the first failed request for requests that were dropped after it.
+ */
+typedef void (*XSecure_ClientCallback)(void *CallbackRef, int Status);
+
+/**
+ * Asynchronous request. The queue of requests is read by the server, so it
+ * must be allocated in memory accessible to the PMC, like the shared memory
+ * set with XMailbox_SetSharedMem.
+ */
+typedef struct {
+	u64 Params[XSECURE_ASYNC_PARAMS_LEN];	/**< CDO parameters referenced
+						  *  by the payload */
+	u32 Payload[PAYLOAD_ARG_CNT];	/**< IPI payload */
+	u32 PayloadLen;			/**< IPI payload length in words */
+	XSecure_ClientCallback ApiCallback;	/**< Completion callback of
+						  *  the client API, called
+						  *  before Callback */
+	void *ApiCallbackRef;		/**< Client API callback reference */
+	XSecure_ClientCallback Callback;	/**< Completion callback */
+	void *CallbackRef;		/**< Completion callback reference */
+} XSecure_ClientRequest;
+
+/**
+ * Ring of asynchronous requests. Requests are sent in order, the oldest one
+ * is in flight while the next ones are queued behind it. The synchronous
+ * client APIs use the same IPI buffers, so they must not be called while
+ * requests are pending: call XSecure_ClientWait first.
+ */
+typedef struct {
+	XSecure_ClientRequest *RequestPtr;	/**< Request ring */
+	u32 Size;		/**< Number of requests in the ring */
+	u32 Head;		/**< Next free request */
+	u32 Tail;		/**< Oldest pending request */
+	u32 Count;		/**< Number of pending requests */
+	u32 InFlight;		/**< TRUE if the oldest request was sent */
+	int Status;		/**< First error since the last wait */
+} XSecure_ClientQueue;
+
 typedef struct {
 	XMailbox *MailboxPtr;
+	XSecure_ClientQueue Queue;	/**< Asynchronous request queue */
 } XSecure_ClientInstance;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -84,6 +130,13 @@ typedef struct {
 /************************** Function Definitions *****************************/
 int XSecure_ProcessMailbox(XMailbox *MailboxPtr, u32 *MsgPtr, u32 MsgLen);
 int XSecure_ClientInit(XSecure_ClientInstance* const InstancePtr, XMailbox* const MailboxPtr);
+int XSecure_ClientAsyncInit(XSecure_ClientInstance *InstancePtr,
+	XSecure_ClientRequest *RequestPtr, u32 Size);
+XSecure_ClientRequest *XSecure_ClientGetRequest(XSecure_ClientInstance *InstancePtr);
+int XSecure_ClientQueueRequest(XSecure_ClientInstance *InstancePtr,
+	XSecure_ClientCallback Callback, void *CallbackRef);
+u32 XSecure_ClientPoll(XSecure_ClientInstance *InstancePtr);
+int XSecure_ClientWait(XSecure_ClientInstance *InstancePtr);
 
 #ifdef __cplusplus
 }
@@ -25,6 +25,9 @@
 * 4.6   kal  08/22/21 Updated doxygen comment description for
 *                     XSecure_Sha3Initialize API
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+*       ag   10/19/26 Added XSecure_Sha3UpdateAsync and XSecure_Sha3FinishAsync
+*       ag   10/19/26 Advanced the SHA3 state when asynchronous requests
+*                     complete
 *
 * </pre>
 *
@@ -37,6 +40,9 @@
 
 /************************** Constant Definitions *****************************/
 static XSecure_ShaState Sha3State = XSECURE_SHA_UNINITIALIZED;
+	/**< State of the SHA3 operation after the completed requests */
+static XSecure_ShaState Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
+	/**< State once the queued requests complete, used to build requests */
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -44,6 +50,10 @@ static XSecure_ShaState Sha3State = XSECURE_SHA_UNINITIALIZED;
 #define XSECURE_SHA_UPDATE_CONTINUE_SHIFT	(31U)
 
 /************************** Function Prototypes ******************************/
+static int XSecure_Sha3UpdatePayload(u32 *Payload, const u64 InDataAddr, u32 Size);
+static int XSecure_Sha3FinishPayload(u32 *Payload, const u64 OutDataAddr);
+static void XSecure_Sha3UpdateDone(void *CallbackRef, int Status);
+static void XSecure_Sha3FinishDone(void *CallbackRef, int Status);
 
 /************************** Variable Definitions *****************************/
 
@@ -56,13 +66,18 @@ static XSecure_ShaState Sha3State = XSECURE_SHA_UNINITIALIZED;
  *	-	XST_SUCCESS - If the Sha3 state is changed to initialized state
  * 	-	XST_FAILURE - If the Sha3 is not in uninitialized state
  *
+ * @note	A new operation can only start once the asynchronous finish of
+ *		the previous one has completed.
+ *
  ******************************************************************************/
 int XSecure_Sha3Initialize(void)
 {
 	volatile int Status = XST_FAILURE;
 
-	if (Sha3State == XSECURE_SHA_UNINITIALIZED) {
+	if ((Sha3State == XSECURE_SHA_UNINITIALIZED) &&
+		(Sha3QueuedState == XSECURE_SHA_UNINITIALIZED)) {
 		Sha3State = XSECURE_SHA_INITIALIZED;
+		Sha3QueuedState = XSECURE_SHA_INITIALIZED;
 		Status = XST_SUCCESS;
 	}
 
@@ -81,38 +96,28 @@ int XSecure_Sha3Initialize(void)
  *
  * @return
  *	-	XST_SUCCESS - If the update is successful
- * 	-	XST_FAILURE - If there is a failure
+ * 	-	XST_FAILURE - If there is a failure or asynchronous requests
+ *			      are pending
  *
  ******************************************************************************/
 int XSecure_Sha3Update(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr, u32 Size)
 {
 	volatile int Status = XST_FAILURE;
-	u32 Sha3InitializeMask = 0U;
 	u32 Payload[XSECURE_PAYLOAD_LEN_6U];
 
 	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
 		goto END;
 	}
 
-	if ((Sha3State != XSECURE_SHA_INITIALIZED) &&
-		(Sha3State != XSECURE_SHA_UPDATE)) {
-		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+	if (InstancePtr->Queue.Count != 0U) {
 		goto END;
 	}
 
-	if (Sha3State == XSECURE_SHA_INITIALIZED) {
-		Sha3InitializeMask = 1U << XSECURE_SHA_FIRST_PACKET_SHIFT;
+	Status = XSecure_Sha3UpdatePayload(Payload, InDataAddr, Size);
+	if (Status != XST_SUCCESS) {
+		goto END;
 	}
 
-	/* Fill IPI Payload */
-	Payload[0U] = HEADER(0U, XSECURE_API_SHA3_UPDATE);
-	Payload[1U] = (u32)InDataAddr;
-	Payload[2U] = (u32)(InDataAddr >> 32);
-	Payload[3U] = (u32)((1U << XSECURE_SHA_UPDATE_CONTINUE_SHIFT)|
-						(Sha3InitializeMask) | Size);
-	Payload[4U] = XSECURE_IPI_UNUSED_PARAM;
-	Payload[5U] = XSECURE_IPI_UNUSED_PARAM;
-
 	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
 	if (Status != XST_SUCCESS) {
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Sha3 Update Failed \r\n");
@@ -120,6 +125,7 @@ int XSecure_Sha3Update(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr
 	}
 
 	Sha3State = XSECURE_SHA_UPDATE;
+	Sha3QueuedState = XSECURE_SHA_UPDATE;
 END:
 	return Status;
 }
@@ -137,7 +143,8 @@ END:
  *	-	XST_SUCCESS - If finished without any errors
  *	-	XSECURE_SHA3_INVALID_PARAM - On invalid parameter
  *	-	XSECURE_SHA3_STATE_MISMATCH_ERROR - If State mismatch is occurred
- *	-	XST_FAILURE - If Sha3PadType is other than KECCAK or NIST
+ *	-	XST_FAILURE - If Sha3PadType is other than KECCAK or NIST, or
+ *			      asynchronous requests are pending
  *
  *****************************************************************************/
 int XSecure_Sha3Finish(XSecure_ClientInstance *InstancePtr, const u64 OutDataAddr)
@@ -149,19 +156,14 @@ int XSecure_Sha3Finish(XSecure_ClientInstance *InstancePtr, const u64 OutDataAdd
 		goto END;
 	}
 
-	if ((Sha3State != XSECURE_SHA_INITIALIZED) &&
-		(Sha3State != XSECURE_SHA_UPDATE)) {
-		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+	if (InstancePtr->Queue.Count != 0U) {
 		goto END;
 	}
 
-	/* Fill IPI Payload */
-	Payload[0U] = HEADER(0U, XSECURE_API_SHA3_UPDATE);
-	Payload[1U] = XSECURE_IPI_UNUSED_PARAM;
-	Payload[2U] = XSECURE_IPI_UNUSED_PARAM;
-	Payload[3U] = XSECURE_IPI_UNUSED_PARAM;
-	Payload[4U] = (u32)OutDataAddr;
-	Payload[5U] = (u32)(OutDataAddr >> 32);
+	Status = XSecure_Sha3FinishPayload(Payload, OutDataAddr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
 	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
 	if (Status != XST_SUCCESS) {
@@ -170,6 +172,7 @@ int XSecure_Sha3Finish(XSecure_ClientInstance *InstancePtr, const u64 OutDataAdd
 	}
 
 	Sha3State = XSECURE_SHA_UNINITIALIZED;
+	Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
 END:
 	return Status;
 }
@@ -256,3 +259,231 @@ int XSecure_Sha3Kat(XSecure_ClientInstance *InstancePtr)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an IPI request to update the SHA3 engine
+ *		with the input data and returns without waiting for the server.
+ *		Several updates can be queued; they are processed in order.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	InDataAddr	Address of the input data, which must remain
+ *				unchanged until the request completes
+ * @param	Size		Size of the data to be updated to SHA3 engine
+ * @param	Callback	Function called when the update completes
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the update is queued
+ * 	-	XST_FAILURE - If there is a failure or the queue is full
+ *
+ * @note	The request queue must be set with XSecure_ClientAsyncInit.
+ *		The SHA3 state advances when the update completes. A failed
+ *		update ends the SHA3 operation, as the requests queued behind
+ *		it are dropped.
+ *
+ ******************************************************************************/
+int XSecure_Sha3UpdateAsync(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr,
+	u32 Size, XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_ClientRequest *RequestPtr;
+	XSecure_ShaState PrevState = Sha3QueuedState;
+
+	RequestPtr = XSecure_ClientGetRequest(InstancePtr);
+	if ((RequestPtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3UpdatePayload(RequestPtr->Payload, InDataAddr, Size);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	RequestPtr->PayloadLen = XSECURE_PAYLOAD_LEN_6U;
+	RequestPtr->ApiCallback = XSecure_Sha3UpdateDone;
+
+	/*
+	 * Requests queued behind this one are built for the state it leaves.
+	 * It is set before queueing, as a failure to send the request calls
+	 * XSecure_Sha3UpdateDone before XSecure_ClientQueueRequest returns.
+	 */
+	Sha3QueuedState = XSECURE_SHA_UPDATE;
+	Status = XSecure_ClientQueueRequest(InstancePtr, Callback, CallbackRef);
+	if (Status != XST_SUCCESS) {
+		Sha3QueuedState = PrevState;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues an IPI request to finish the SHA3
+ *		operation and returns without waiting for the server.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	OutDataAddr	Address of the output buffer to store the
+ * 				output hash, valid once the request completes
+ * @param	Callback	Function called when the hash is available
+ * @param	CallbackRef	Reference passed to the callback
+ *
+ * @return
+ *	-	XST_SUCCESS - If the finish is queued
+ *	-	XST_FAILURE - If there is a failure or the queue is full
+ *
+ * @note	The SHA3 state returns to uninitialized when the finish
+ *		completes. A new SHA3 operation can be initialized from then on.
+ *
+ *****************************************************************************/
+int XSecure_Sha3FinishAsync(XSecure_ClientInstance *InstancePtr, const u64 OutDataAddr,
+	XSecure_ClientCallback Callback, void *CallbackRef)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_ClientRequest *RequestPtr;
+	XSecure_ShaState PrevState = Sha3QueuedState;
+
+	RequestPtr = XSecure_ClientGetRequest(InstancePtr);
+	if ((RequestPtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3FinishPayload(RequestPtr->Payload, OutDataAddr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	RequestPtr->PayloadLen = XSECURE_PAYLOAD_LEN_6U;
+	RequestPtr->ApiCallback = XSecure_Sha3FinishDone;
+
+	Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
+	Status = XSecure_ClientQueueRequest(InstancePtr, Callback, CallbackRef);
+	if (Status != XST_SUCCESS) {
+		Sha3QueuedState = PrevState;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks the SHA3 state left by the queued
+ *		requests and fills the SHA3 update payload
+ *
+ * @param	Payload		Pointer to the payload of 6 words
+ * @param	InDataAddr	Address of the input data
+ * @param	Size		Size of the data to be updated to SHA3 engine
+ *
+ * @return
+ *	-	XST_SUCCESS - If the payload is filled
+ * 	-	XST_FAILURE - If the SHA3 state is invalid
+ *
+ ******************************************************************************/
+static int XSecure_Sha3UpdatePayload(u32 *Payload, const u64 InDataAddr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	u32 Sha3InitializeMask = 0U;
+
+	if ((Sha3QueuedState != XSECURE_SHA_INITIALIZED) &&
+		(Sha3QueuedState != XSECURE_SHA_UPDATE)) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+		goto END;
+	}
+
+	if (Sha3QueuedState == XSECURE_SHA_INITIALIZED) {
+		Sha3InitializeMask = 1U << XSECURE_SHA_FIRST_PACKET_SHIFT;
+	}
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, XSECURE_API_SHA3_UPDATE);
+	Payload[1U] = (u32)InDataAddr;
+	Payload[2U] = (u32)(InDataAddr >> 32);
+	Payload[3U] = (u32)((1U << XSECURE_SHA_UPDATE_CONTINUE_SHIFT)|
+						(Sha3InitializeMask) | Size);
+	Payload[4U] = XSECURE_IPI_UNUSED_PARAM;
+	Payload[5U] = XSECURE_IPI_UNUSED_PARAM;
+
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks the SHA3 state left by the queued
+ *		requests and fills the SHA3 finish payload
+ *
+ * @param	Payload		Pointer to the payload of 6 words
+ * @param	OutDataAddr	Address of the output buffer to store the
+ * 				output hash
+ *
+ * @return
+ *	-	XST_SUCCESS - If the payload is filled
+ * 	-	XST_FAILURE - If the SHA3 state is invalid
+ *
+ ******************************************************************************/
+static int XSecure_Sha3FinishPayload(u32 *Payload, const u64 OutDataAddr)
+{
+	int Status = XST_FAILURE;
+
+	if ((Sha3QueuedState != XSECURE_SHA_INITIALIZED) &&
+		(Sha3QueuedState != XSECURE_SHA_UPDATE)) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "Invalid SHA3 State \r\n");
+		goto END;
+	}
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, XSECURE_API_SHA3_UPDATE);
+	Payload[1U] = XSECURE_IPI_UNUSED_PARAM;
+	Payload[2U] = XSECURE_IPI_UNUSED_PARAM;
+	Payload[3U] = XSECURE_IPI_UNUSED_PARAM;
+	Payload[4U] = (u32)OutDataAddr;
+	Payload[5U] = (u32)(OutDataAddr >> 32);
+
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function advances the SHA3 state when an asynchronous
+ *		update completes. On failure the SHA3 operation ends, as the
+ *		requests queued behind the update are dropped.
+ *
+ * @param	CallbackRef	Unused
+ * @param	Status		Completion status of the update
+ *
+ ******************************************************************************/
+static void XSecure_Sha3UpdateDone(void *CallbackRef, int Status)
+{
+	(void)CallbackRef;
+
+	if (Status == XST_SUCCESS) {
+		Sha3State = XSECURE_SHA_UPDATE;
+	}
+	else {
+		Sha3State = XSECURE_SHA_UNINITIALIZED;
+		Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function ends the SHA3 operation when an asynchronous
+ *		finish completes
+ *
+ * @param	CallbackRef	Unused
+ * @param	Status		Completion status of the finish
+ *
+ ******************************************************************************/
+static void XSecure_Sha3FinishDone(void *CallbackRef, int Status)
+{
+	(void)CallbackRef;
+	(void)Status;
+
+	Sha3State = XSECURE_SHA_UNINITIALIZED;
+	Sha3QueuedState = XSECURE_SHA_UNINITIALIZED;
+}
@@ -22,6 +22,7 @@
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 *       kpt  04/28/21 Added enum XSecure_ShaState to update sha driver states
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+*       ag   10/19/26 Added XSecure_Sha3UpdateAsync and XSecure_Sha3FinishAsync
 *
 * </pre>
 *
@@ -57,6 +58,10 @@ int XSecure_Sha3Update(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr
 int XSecure_Sha3Finish(XSecure_ClientInstance *InstancePtr, const u64 OutDataAddr);
 int XSecure_Sha3Digest(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr, const u64 OutDataAddr, u32 Size);
 int XSecure_Sha3Kat(XSecure_ClientInstance *InstancePtr);
+int XSecure_Sha3UpdateAsync(XSecure_ClientInstance *InstancePtr, const u64 InDataAddr,
+	u32 Size, XSecure_ClientCallback Callback, void *CallbackRef);
+int XSecure_Sha3FinishAsync(XSecure_ClientInstance *InstancePtr, const u64 OutDataAddr,
+	XSecure_ClientCallback Callback, void *CallbackRef);
 
 /************************** Variable Definitions *****************************/
 
@@ -72,6 +72,7 @@
 *       har  01/20/2022 Added glitch checks for clearing keys in
 *                       XSecure_AesWriteKey()
 *       har  02/16/2022 Updated Status with ClearStatus only in case of success
+*       ag   10/19/2026 Added scatter-gather encrypt and decrypt updates
 *
 * </pre>
 *
@@ -102,6 +103,9 @@
 #define XSECURE_ENABLE_BYTE_SWAP		(0x1U)	/**< Enables data swap in AES */
 #define XSECURE_DISABLE_BYTE_SWAP		(0x0U)	/**< Disables data swap in AES */
 
+#define XSECURE_AES_MAX_SG_LEN			(0x1FFFFFFCU)	/**< Maximum length of
+											merged SG segments */
+
 /**
  * @name AES KAT parameters
  * @{
@@ -195,6 +199,9 @@ static int XSecure_AesOpInit(const XSecure_Aes *InstancePtr,
 	XSecure_AesKeySrc KeySrc, XSecure_AesKeySize KeySize, u64 IvAddr);
 static int XSecure_AesPmcDmaCfgAndXfer(const XSecure_Aes *InstancePtr,
 	XSecure_AesDmaCfg AesDmaCfg, u32 Size);
+static int XSecure_AesUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastChunk,
+	XSecure_AesState AesState);
 
 /************************** Variable Definitions *****************************/
 static const XSecure_AesKeyLookup AesKeyLookupTbl [XSECURE_MAX_KEY_SOURCES] =
@@ -1026,6 +1033,34 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function decrypts a scatter-gather list of segments. The
+ *		result is the same as calling XSecure_AesDecryptUpdate for each
+ *		segment in order.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	SgList		Pointer to the list of segments, the size of each
+ *				  segment should be a non-zero multiple of 4
+ * @param	SgCount		Number of segments in the list
+ * @param	IsLastChunk	If the last segment is the last update of data to
+ *				  be decrypted, this parameter should be set to
+ *				  TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful decryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure to configure switch
+ *
+ ******************************************************************************/
+int XSecure_AesDecryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastChunk)
+{
+	return XSecure_AesUpdateSg(InstancePtr, SgList, SgCount, IsLastChunk,
+		XSECURE_AES_DECRYPT_INITIALIZED);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function verifies the GCM tag provided for the data decrypted
@@ -1337,6 +1372,34 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function encrypts a scatter-gather list of segments. The
+ *		result is the same as calling XSecure_AesEncryptUpdate for each
+ *		segment in order.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	SgList		Pointer to the list of segments, the size of each
+ *				  segment should be a non-zero multiple of 4
+ * @param	SgCount		Number of segments in the list
+ * @param	IsLastChunk	If the last segment is the last update of data to
+ *				  be encrypted, this parameter should be set to
+ *				  TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful encryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure to configure switch
+ *
+ ******************************************************************************/
+int XSecure_AesEncryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastChunk)
+{
+	return XSecure_AesUpdateSg(InstancePtr, SgList, SgCount, IsLastChunk,
+		XSECURE_AES_ENCRYPT_INITIALIZED);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function updates the GCM tag for the encrypted data
@@ -2319,3 +2382,120 @@ static int XSecure_AesPmcDmaCfgAndXfer(const XSecure_Aes *InstancePtr,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function transfers a scatter-gather list of segments
+ *		through the AES engine. Segments whose source and destination
+ *		both continue the previous segment are merged into a single DMA
+ *		transfer. The byte swap is configured once for the whole list.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	SgList		Pointer to the list of segments
+ * @param	SgCount		Number of segments in the list
+ * @param	IsLastChunk	TRUE if the last segment is the last update
+ * @param	AesState	XSECURE_AES_ENCRYPT_INITIALIZED or
+ *				  XSECURE_AES_DECRYPT_INITIALIZED
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful transfer of all segments
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure to configure switch
+ *
+ ******************************************************************************/
+static int XSecure_AesUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastChunk,
+	XSecure_AesState AesState)
+{
+	int Status = XST_FAILURE;
+	XSecure_AesDmaCfg AesDmaCfg = {0U};
+	u32 Index;
+	u32 Size;
+	u64 NextOutAddr;
+
+	/* Validate the input arguments */
+	if (InstancePtr == NULL) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	if ((SgList == NULL) || (SgCount == 0U) ||
+		((IsLastChunk != TRUE) && (IsLastChunk != FALSE))) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END_RST;
+	}
+
+	for (Index = 0U; Index < SgCount; Index++) {
+		if ((SgList[Index].Size == 0U) ||
+			(SgList[Index].Size > XSECURE_AES_MAX_SG_LEN) ||
+			((SgList[Index].Size % XSECURE_WORD_SIZE) != 0x00U)) {
+			Status = (int)XSECURE_AES_INVALID_PARAM;
+			goto END_RST;
+		}
+	}
+
+	if (InstancePtr->AesState != AesState) {
+		Status = (int)XSECURE_AES_STATE_MISMATCH_ERROR;
+		goto END_RST;
+	}
+
+	AesDmaCfg.SrcChannelCfg = TRUE;
+	AesDmaCfg.DestChannelCfg = TRUE;
+	AesDmaCfg.IsLastChunkDest = FALSE;
+
+	Index = 0U;
+	while (Index < SgCount) {
+		AesDmaCfg.SrcDataAddr = SgList[Index].InDataAddr;
+		AesDmaCfg.DestDataAddr = SgList[Index].OutDataAddr;
+		Size = SgList[Index].Size;
+		Index++;
+
+		/* Merge the segments which continue the current one */
+		while (Index < SgCount) {
+			if ((u32)AesDmaCfg.DestDataAddr == XSECURE_AES_NO_CFG_DST_DMA) {
+				NextOutAddr = AesDmaCfg.DestDataAddr;
+			}
+			else {
+				NextOutAddr = AesDmaCfg.DestDataAddr + Size;
+			}
+			if ((SgList[Index].InDataAddr != (AesDmaCfg.SrcDataAddr + Size)) ||
+				(SgList[Index].OutDataAddr != NextOutAddr) ||
+				(SgList[Index].Size > (XSECURE_AES_MAX_SG_LEN - Size))) {
+				break;
+			}
+			Size += SgList[Index].Size;
+			Index++;
+		}
+
+		AesDmaCfg.IsLastChunkSrc = FALSE;
+		if (Index == SgCount) {
+			AesDmaCfg.IsLastChunkSrc = IsLastChunk;
+		}
+
+		Status = XSecure_AesPmcDmaCfgAndXfer(InstancePtr, AesDmaCfg, Size);
+		if (Status != XST_SUCCESS) {
+			goto END_RST;
+		}
+	}
+
+END_RST:
+	/* Clear endianness */
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_SRC_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_DST_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+	if (Status != XST_SUCCESS) {
+		/*
+		 * Issue a soft to reset to AES engine and
+		 * set the AES state back to initilization state
+		 */
+		InstancePtr->NextBlkLen = 0U;
+		InstancePtr->AesState = XSECURE_AES_INITIALIZED;
+		XSecure_SetReset(InstancePtr->BaseAddress,
+			XSECURE_AES_SOFT_RST_OFFSET);
+	}
+
+END:
+	return Status;
+}
@@ -35,6 +35,7 @@
 *       ana  10/15/2020 Updated doxygen tags
 * 4.5   har  03/02/2021 Added prototype for XSecure_AesUpdateAad
 * 4.6   har  07/14/2021 Fixed doxygen warnings
+* 4.7   ag   10/19/2026 Added scatter-gather encrypt and decrypt updates
 *
 * </pre>
 *
@@ -156,6 +157,12 @@ typedef struct {
 	XSecure_AesKeySrc KeySrc;  /**< Key Source */
 	u32 NextBlkLen;		   /**< Next Block Length */
 } XSecure_Aes;
+
+typedef struct {
+	u64 InDataAddr;		   /**< Address of the input segment */
+	u64 OutDataAddr;	   /**< Address of the output segment */
+	u32 Size;		   /**< Size of the segment in bytes */
+} XSecure_AesSgEntry;
 /** @}
  * @endcond
  */
@@ -182,6 +189,8 @@ int XSecure_AesDecryptInit(XSecure_Aes *InstancePtr, XSecure_AesKeySrc KeySrc,
 
 int XSecure_AesDecryptUpdate(XSecure_Aes *InstancePtr, u64 InDataAddr,
 	u64 OutDataAddr, u32 Size, u8 IsLastChunk);
+int XSecure_AesDecryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastChunk);
 int XSecure_AesDecryptFinal(XSecure_Aes *InstancePtr, u64 GcmTagAddr);
 
 int XSecure_AesDecryptData(XSecure_Aes *InstancePtr, u64 InDataAddr,
@@ -192,6 +201,8 @@ int XSecure_AesEncryptInit(XSecure_Aes *InstancePtr, XSecure_AesKeySrc KeySrc,
 
 int XSecure_AesEncryptUpdate(XSecure_Aes *InstancePtr, u64 InDataAddr,
 	u64 OutDataAddr, u32 Size, u8 IsLastChunk);
+int XSecure_AesEncryptUpdateSg(XSecure_Aes *InstancePtr,
+	const XSecure_AesSgEntry *SgList, u32 SgCount, u8 IsLastChunk);
 int XSecure_AesEncryptFinal(XSecure_Aes *InstancePtr, u64 GcmTagAddr);
 
 int XSecure_AesEncryptData(XSecure_Aes *InstancePtr, u64 InDataAddr,
@@ -42,6 +42,8 @@
 * 4.7   kpt  12/01/21 Replaced library specific,standard utility functions
 *                     with xilinx maintained functions
 *       am   03/08/22 Replaced memset() with Xil_SMemSet()
+*       ag   10/19/26 Added XSecure_Sha3UpdateSg
+*       ag   10/19/26 Fixed DMA of unaligned data following partial data
 *
 * </pre>
 * @note
@@ -66,6 +68,8 @@
 						/**< Nist Start padding masks */
 #define XSECURE_SHA3_END_NIST_PADDING_MASK		(0x80U)
 						/**< Nist End padding masks */
+#define XSECURE_SHA3_MAX_SG_LEN				(0xFFFFFFFFU)
+				/**< Maximum length of merged SG segments */
 
 static const u8 ExpectedHash[XSECURE_HASH_SIZE_IN_BYTES] = {
 			0x86U, 0x89U, 0xACU, 0xE3U, 0xA5U, 0xF9U, 0xF5U, 0x71U, 0xD6U,
@@ -113,6 +117,8 @@ static int XSecure_Sha3DmaTransfer(const XSecure_Sha3 *InstancePtr,
 	u64 InDataAddr, const u32 Size, u8 IsLastUpdate);
 static int XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr,
 	u64 InDataAddr, const u32 Size, u8 IsLastUpdate);
+static int XSecure_Sha3SegmentUpdate(XSecure_Sha3 *InstancePtr,
+	u64 InDataAddr, const u32 Size, u8 IsLastUpdate);
 static int XSecure_Sha3NistPadd(u8 *Dst, u32 MsgLen);
 
 /************************** Variable Definitions *****************************/
@@ -314,8 +320,6 @@ int XSecure_Sha3Update64Bit(XSecure_Sha3 *InstancePtr, u64 InDataAddr,
 						const u32 Size)
 {
 	int Status = XST_FAILURE;
-	u32 DataSize;
-	u32 TransferredBytes;
 
 	/* Validate the input arguments */
 	if (InstancePtr == NULL) {
@@ -328,29 +332,8 @@ int XSecure_Sha3Update64Bit(XSecure_Sha3 *InstancePtr, u64 InDataAddr,
 		goto END_RST;
 	}
 
-	InstancePtr->Sha3Len += Size;
-	DataSize = Size;
-	TransferredBytes = 0U;
-
-	/*
-	 * PMC DMA can transfer Max 0x7FFFFFF no of words(0x1FFFFFFC bytes)
-	 * at a time .So if the data sent more than that will be handled
-	 * in the next update internally
-	 */
-	while (DataSize > XSECURE_PMC_DMA_MAX_TRANSFER) {
-		Status = XSecure_Sha3DataUpdate(InstancePtr,
-				(InDataAddr + TransferredBytes),
-				XSECURE_PMC_DMA_MAX_TRANSFER, FALSE);
-		if (Status != XST_SUCCESS) {
-			goto END_RST;
-		}
-		DataSize = DataSize - XSECURE_PMC_DMA_MAX_TRANSFER;
-		TransferredBytes = TransferredBytes +
-			XSECURE_PMC_DMA_MAX_TRANSFER;
-	}
-	Status = XSecure_Sha3DataUpdate(InstancePtr,
-				(InDataAddr + TransferredBytes),
-				DataSize, (u8)InstancePtr->IsLastUpdate);
+	Status = XSecure_Sha3SegmentUpdate(InstancePtr, InDataAddr, Size,
+				(u8)InstancePtr->IsLastUpdate);
 
 END_RST:
 	if (Status != XST_SUCCESS) {
@@ -386,6 +369,87 @@ int XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const UINTPTR InDataAddr,
 	return XSecure_Sha3Update64Bit(InstancePtr, (u64)InDataAddr, Size);
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function updates the SHA3 engine with a scatter-gather list
+ *		of input data segments. The result is the same as calling
+ *		XSecure_Sha3Update64Bit for each segment in order.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Sha3 instance
+ * @param	SgList		Pointer to the list of segments
+ * @param	SgCount		Number of segments in the list
+ *
+ * @return
+ *	-	XST_SUCCESS - If the update is successful
+ *	-	XSECURE_SHA3_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_SHA3_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - If there is a failure in SSS configuration
+ *
+ * @note	Segments that are contiguous in memory are hashed with a single
+ *		DMA transfer. A segment that ends in the middle of a SHA3
+ *		block is joined with the start of the next one, so only the
+ *		joined block is copied. If XSecure_Sha3LastUpdate is called
+ *		before this function, the last segment is the last update.
+ *
+ ******************************************************************************/
+int XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+			const XSecure_Sha3SgEntry *SgList, u32 SgCount)
+{
+	int Status = XST_FAILURE;
+	u32 Index;
+	u64 DataAddr;
+	u32 DataSize;
+	u8 IsLastUpdate;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (SgList == NULL) || (SgCount == 0U)) {
+		Status = (int)XSECURE_SHA3_INVALID_PARAM;
+		goto END;
+	}
+
+	if (InstancePtr->Sha3State != XSECURE_SHA3_ENGINE_STARTED) {
+		Status = (int)XSECURE_SHA3_STATE_MISMATCH_ERROR;
+		goto END_RST;
+	}
+
+	Index = 0U;
+	while (Index < SgCount) {
+		DataAddr = SgList[Index].DataAddr;
+		DataSize = SgList[Index].Size;
+		Index++;
+
+		/* Merge the segments which continue the current one */
+		while ((Index < SgCount) &&
+			(SgList[Index].DataAddr == (DataAddr + DataSize)) &&
+			(SgList[Index].Size <= (XSECURE_SHA3_MAX_SG_LEN - DataSize))) {
+			DataSize += SgList[Index].Size;
+			Index++;
+		}
+
+		IsLastUpdate = FALSE;
+		if (Index == SgCount) {
+			IsLastUpdate = (u8)InstancePtr->IsLastUpdate;
+		}
+
+		Status = XSecure_Sha3SegmentUpdate(InstancePtr, DataAddr,
+					DataSize, IsLastUpdate);
+		if (Status != XST_SUCCESS) {
+			goto END_RST;
+		}
+	}
+
+END_RST:
+	if (Status != XST_SUCCESS) {
+		/* Set SHA under reset on failure condition */
+		XSecure_SetReset(InstancePtr->BaseAddress,
+					XSECURE_SHA3_RESET_OFFSET);
+		InstancePtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function updates SHA3 engine with final data which includes
@@ -668,7 +732,7 @@ static int XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr,
 	{
 		/* Handle Partial data and non dword aligned data address */
 		if ((PrevPartialLen != 0U) ||
-		    ((InDataAddr & (u64)XPMCDMA_ADDR_LSB_MASK) != 0U)) {
+		    ((DataAddr & (u64)XPMCDMA_ADDR_LSB_MASK) != 0U)) {
 			XSecure_MemCpy64((u64)(UINTPTR)&PartialData[PrevPartialLen], DataAddr,
 				XSECURE_SHA3_BLOCK_LEN - PrevPartialLen);
 			DmableDataAddr = (u64)(UINTPTR)PartialData;
@@ -714,6 +778,58 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function updates hash for a data block of any size. Blocks
+ *		larger than the maximum PMC DMA transfer are split.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Sha3 instance
+ * @param	InDataAddr 	Starting address of the data, which has to be updated
+ *				  to SHA engine
+ * @param	Size 	 	Size of the input data in bytes
+ * @param	IsLastUpdate	Flag to indicate whether this is the last update
+ *				  or not
+ *
+ * @return
+ *	-	XST_SUCCESS - If the update is successful
+ *	-	XST_FAILURE - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_Sha3SegmentUpdate(XSecure_Sha3 *InstancePtr,
+			u64 InDataAddr, const u32 Size, u8 IsLastUpdate)
+{
+	int Status = XST_FAILURE;
+	u32 DataSize;
+	u32 TransferredBytes;
+
+	InstancePtr->Sha3Len += Size;
+	DataSize = Size;
+	TransferredBytes = 0U;
+
+	/*
+	 * PMC DMA can transfer Max 0x7FFFFFF no of words(0x1FFFFFFC bytes)
+	 * at a time .So if the data sent more than that will be handled
+	 * in the next update internally
+	 */
+	while (DataSize > XSECURE_PMC_DMA_MAX_TRANSFER) {
+		Status = XSecure_Sha3DataUpdate(InstancePtr,
+				(InDataAddr + TransferredBytes),
+				XSECURE_PMC_DMA_MAX_TRANSFER, FALSE);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		DataSize = DataSize - XSECURE_PMC_DMA_MAX_TRANSFER;
+		TransferredBytes = TransferredBytes +
+			XSECURE_PMC_DMA_MAX_TRANSFER;
+	}
+	Status = XSecure_Sha3DataUpdate(InstancePtr,
+				(InDataAddr + TransferredBytes),
+				DataSize, IsLastUpdate);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  *
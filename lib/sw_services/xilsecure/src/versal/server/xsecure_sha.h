@@ -45,6 +45,7 @@
 *       har  10/12/20 Addressed security review comments
 *       ana  10/15/20 Updated doxygen tags
 * 4.5   bm   01/13/21 Added support for 64-bit input data address
+* 4.7   ag   10/19/26 Added XSecure_Sha3UpdateSg
 *
 * </pre>
 *
@@ -115,6 +116,14 @@ typedef struct {
 	XSecure_Sss SssInstance; /**< SSS Instance */
 	XSecure_Sha3State Sha3State; /**< SHA engine state */
 } XSecure_Sha3;
+
+/**
+ * Segment of a scatter-gather list passed to XSecure_Sha3UpdateSg
+ */
+typedef struct {
+	u64 DataAddr; /**< 64 bit address of the segment */
+	u32 Size; /**< Size of the segment in bytes */
+} XSecure_Sha3SgEntry;
 /**
  * @}
  * @endcond
@@ -131,6 +140,8 @@ int XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const UINTPTR InDataAddr,
 		       const u32 Size);
 int XSecure_Sha3Update64Bit(XSecure_Sha3 *InstancePtr, u64 InDataAddr,
 			const u32 Size);
+int XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+			const XSecure_Sha3SgEntry *SgList, u32 SgCount);
 int XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, XSecure_Sha3Hash *Sha3Hash);
 
 